@@ -77,6 +77,14 @@ static int sprt_qlock_wake_all(__SPRT_ID(sprt_qlock_t) * value,
 	return result;
 }
 
+static int sprt_qlock_wait_any(__SPRT_ID(sprt_qlock_t) * const *values,
+		const __SPRT_ID(sprt_qlock_t) * expected, __SPRT_ID(uint32_t) count,
+		__SPRT_ID(sprt_timeout_t) timeout, __SPRT_ID(sprt_lock_flags_t) flags) {
+	// no system API to wait on multiple addresses
+	__sprt_errno = ENOSYS;
+	return -1;
+}
+
 static int sprt_rlock_supports(__SPRT_ID(sprt_lock_flags_t) flags) {
 	// Shared locks supported with OS_SYNC_WAIT_ON_ADDRESS_SHARED / OS_SYNC_WAKE_BY_ADDRESS_SHARED
 	if ((flags & ~__SPRT_SPRT_LOCK_FLAG_SHARED) == 0) {
@@ -0,0 +1,4931 @@
+/**
+ Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+// Generated by __unicode_tables.pl from Unicode 14.0.0 character database and
+// DUCET 13.0.0 (allkeys.txt), do not edit
+//
+// Characters, added after DUCET 13.0.0, have no collation weights and are
+// ordered after all assigned characters by code point (see __unicode_tables.pl)
+
+#ifndef RUNTIME_CORE_INCLUDE___UNICODE_TABLES_H_
+#define RUNTIME_CORE_INCLUDE___UNICODE_TABLES_H_
+
+#include <sprt/runtime/init.h>
+
+namespace sprt::unicode::detail {
+
+// clang-format off
+
+enum CaseFlags : uint16_t {
+	CaseFlagCased = 1,
+	CaseFlagIgnorable = 2,
+	CaseFlagWord = 4, // non-ideographic Alphabetic or decimal digit
+};
+
+// Simple mappings as a difference with the code point
+struct CaseRecord {
+	int32_t lower;
+	int32_t upper;
+	int32_t title;
+	int32_t fold;
+	uint16_t flags;
+	uint16_t special; // index in s_caseSpecials for characters with multi-char full mappings
+};
+
+// Offsets of full mappings in s_caseSpecialChars: length, then UTF-16 units
+struct CaseSpecial {
+	uint16_t lower;
+	uint16_t upper;
+	uint16_t title;
+	uint16_t fold;
+};
+
+static constexpr uint16_t CaseDefaultValue = 0;
+
+// Max length of the full mapping for a single code point
+static constexpr uint32_t CaseMaxChars = 3;
+
+// Max growth of the string length after the full mapping
+static constexpr uint32_t CaseMaxUtf8Growth = 3;
+static constexpr uint32_t CaseMaxUtf16Growth = 3;
+
+static constexpr uint32_t CaseChunkShift = 9;
+static constexpr uint32_t CaseBlockShift = 3;
+
+static constexpr uint8_t s_caseChunks[2176] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 17, 17, 17, 19, 20, 21, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	22, 23, 24, 25, 26, 27, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 28, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 30, 31,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	23, 48, 49, 17, 17, 17, 17, 50, 23, 23, 51, 17, 17, 17, 17, 17,
+	17, 17, 23, 52, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 23, 53, 17, 54, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 55, 56, 17, 17, 17, 17, 17, 57, 17,
+	17, 17, 17, 17, 17, 17, 17, 58, 59, 60, 61, 62, 17, 63, 17, 64,
+	65, 66, 17, 67, 68, 17, 17, 69, 70, 71, 17, 17, 17, 72, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	73, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+};
+
+static constexpr uint16_t s_caseBlocks[4736] = {
+	0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10,
+	0, 0, 0, 0, 0, 11, 12, 13, 6, 6, 14, 15, 9, 9, 16, 17,
+	18, 18, 18, 18, 18, 18, 19, 20, 21, 22, 18, 18, 18, 18, 18, 23,
+	24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 21, 34, 18, 18, 35, 18,
+	18, 18, 18, 18, 36, 18, 37, 38, 39, 18, 40, 41, 42, 43, 44, 45,
+	46, 47, 48, 49, 50, 50, 51, 52, 53, 54, 55, 56, 57, 58, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 59, 56, 56, 56, 56, 56, 60, 61,
+	62, 63, 64, 6, 65, 66, 67, 9, 68, 69, 70, 18, 18, 18, 71, 72,
+	73, 73, 6, 6, 6, 6, 9, 9, 9, 9, 74, 74, 18, 18, 18, 18,
+	75, 76, 18, 18, 18, 18, 18, 18, 77, 78, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 79, 80, 80, 80, 81, 82, 83, 84, 84, 84,
+	85, 86, 87, 56, 56, 56, 54, 88, 89, 0, 3, 3, 3, 90, 91, 0,
+	92, 0, 54, 93, 3, 3, 3, 3, 94, 95, 54, 96, 3, 97, 94, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 98, 99, 96, 100, 3, 101,
+	0, 1, 102, 3, 3, 3, 54, 54, 56, 103, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 104, 54, 105, 0, 3, 3, 3, 3, 3, 106, 107, 108,
+	3, 3, 104, 109, 54, 110, 0, 0, 3, 3, 3, 111, 3, 112, 3, 3,
+	3, 113, 114, 56, 3, 3, 3, 3, 3, 115, 116, 54, 117, 55, 54, 54,
+	118, 3, 3, 3, 3, 3, 3, 119, 120, 121, 122, 3, 123, 3, 124, 3,
+	125, 101, 126, 3, 3, 127, 128, 129, 130, 131, 132, 133, 123, 3, 134, 135,
+	136, 90, 126, 3, 3, 127, 137, 138, 139, 140, 141, 142, 143, 3, 144, 0,
+	136, 145, 146, 3, 3, 127, 147, 129, 148, 149, 150, 0, 123, 3, 0, 151,
+	152, 101, 126, 3, 3, 127, 147, 153, 130, 154, 155, 133, 123, 3, 156, 0,
+	157, 158, 159, 160, 161, 158, 3, 97, 162, 163, 164, 0, 143, 3, 0, 0,
+	165, 166, 127, 3, 3, 127, 3, 167, 168, 169, 170, 171, 123, 3, 0, 0,
+	125, 166, 127, 3, 3, 127, 172, 153, 173, 174, 175, 175, 123, 3, 176, 0,
+	177, 166, 127, 3, 3, 3, 3, 178, 179, 180, 181, 132, 123, 3, 0, 182,
+	152, 3, 183, 182, 3, 3, 146, 184, 183, 185, 186, 3, 143, 3, 187, 0,
+	188, 3, 3, 3, 3, 3, 189, 190, 191, 192, 3, 134, 0, 0, 0, 0,
+	160, 193, 3, 3, 194, 3, 189, 195, 196, 197, 3, 198, 0, 0, 0, 0,
+	150, 0, 0, 114, 3, 134, 199, 200, 3, 188, 3, 3, 3, 201, 202, 203,
+	204, 205, 54, 202, 54, 54, 54, 206, 2, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 205, 207, 208, 3, 134, 3, 209, 94, 3, 210, 3,
+	211, 212, 3, 213, 214, 214, 214, 214, 215, 216, 217, 217, 217, 217, 217, 218,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 159, 183, 159, 3, 3, 3, 3,
+	3, 159, 3, 3, 3, 3, 159, 183, 159, 3, 183, 3, 3, 3, 3, 3,
+	3, 3, 159, 3, 3, 3, 3, 3, 3, 3, 3, 219, 0, 0, 0, 0,
+	3, 3, 0, 0, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 221, 222,
+	188, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 101, 3, 3,
+	188, 3, 3, 112, 3, 3, 3, 3, 3, 3, 3, 3, 3, 158, 3, 150,
+	3, 3, 223, 132, 3, 3, 224, 0, 3, 3, 224, 0, 3, 166, 225, 0,
+	3, 3, 3, 3, 3, 3, 226, 227, 228, 229, 230, 231, 3, 134, 0, 0,
+	0, 232, 3, 134, 3, 3, 3, 3, 233, 3, 3, 3, 3, 3, 3, 150,
+	234, 3, 3, 3, 3, 235, 3, 3, 3, 3, 3, 3, 3, 3, 236, 0,
+	3, 3, 3, 183, 237, 238, 239, 111, 143, 3, 3, 3, 3, 236, 201, 0,
+	3, 3, 3, 3, 3, 240, 3, 3, 3, 134, 3, 134, 0, 0, 0, 0,
+	3, 3, 241, 242, 3, 3, 3, 3, 3, 3, 228, 243, 244, 245, 246, 247,
+	3, 134, 3, 134, 248, 0, 56, 249, 250, 251, 0, 0, 0, 0, 0, 0,
+	252, 3, 3, 3, 3, 3, 253, 254, 255, 201, 3, 134, 0, 232, 256, 0,
+	177, 3, 3, 3, 257, 258, 3, 3, 3, 3, 3, 3, 259, 260, 261, 0,
+	3, 3, 3, 3, 3, 262, 263, 0, 3, 264, 3, 3, 3, 3, 3, 265,
+	266, 267, 268, 268, 268, 268, 268, 269, 0, 0, 270, 56, 271, 272, 273, 274,
+	50, 50, 50, 50, 50, 275, 51, 51, 51, 51, 51, 51, 51, 276, 50, 277,
+	50, 278, 50, 279, 51, 51, 51, 51, 56, 56, 56, 56, 249, 54, 280, 56,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 281, 282, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	283, 284, 285, 286, 283, 284, 283, 284, 285, 286, 287, 288, 283, 284, 289, 290,
+	291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+	0, 232, 0, 114, 307, 308, 0, 0, 0, 0, 0, 0, 309, 56, 310, 311,
+	0, 0, 51, 312, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 313, 0,
+	314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 0, 0, 324, 324, 325, 325,
+	326, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 327, 328, 328, 328, 329, 329, 329, 330, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	80, 80, 80, 80, 80, 80, 84, 84, 84, 84, 84, 84, 331, 332, 333, 334,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 335, 336, 337, 0,
+	338, 338, 338, 338, 339, 340, 3, 3, 3, 3, 3, 3, 3, 248, 0, 1,
+	3, 3, 183, 0, 183, 183, 183, 183, 183, 183, 183, 183, 54, 54, 54, 54,
+	0, 0, 0, 0, 0, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	341, 0, 0, 0, 0, 342, 343, 344, 188, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 183, 345, 188, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 346,
+	347, 3, 3, 3, 3, 3, 188, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 183, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 3,
+	3, 3, 212, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 201, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 265,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 348, 3, 3, 3, 240, 0, 0, 18, 18, 18, 18, 18, 349, 350, 351,
+	18, 18, 18, 352, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 114, 0,
+	56, 56, 249, 54, 76, 18, 353, 18, 18, 18, 18, 18, 18, 18, 354, 355,
+	18, 356, 357, 18, 18, 358, 359, 18, 360, 361, 362, 363, 0, 0, 364, 365,
+	366, 233, 3, 3, 234, 367, 0, 0, 3, 3, 3, 3, 3, 3, 240, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 368, 0, 3, 134, 56, 56, 369, 370,
+	3, 3, 3, 3, 104, 371, 3, 3, 241, 54, 372, 0, 3, 3, 3, 201,
+	118, 3, 3, 3, 3, 3, 373, 374, 0, 248, 3, 134, 234, 3, 3, 183,
+	3, 3, 3, 3, 3, 375, 376, 0, 233, 377, 3, 134, 3, 3, 378, 379,
+	3, 3, 3, 3, 3, 3, 380, 381, 382, 0, 0, 383, 3, 384, 385, 0,
+	386, 386, 386, 0, 183, 183, 50, 50, 50, 50, 387, 388, 50, 389, 390, 390,
+	390, 390, 390, 390, 390, 390, 390, 390, 3, 3, 3, 3, 212, 391, 3, 134,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 240, 0, 3, 3, 183, 392, 3, 3, 3, 3, 3, 240,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	393, 0, 394, 395, 3, 127, 183, 396, 397, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 398, 56, 399, 0, 392, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 236, 0, 0, 3, 3, 3, 3, 3, 3,
+	3, 3, 182, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 3, 240,
+	56, 56, 400, 0, 56, 56, 0, 0, 0, 0, 401, 0, 0, 0, 166, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 402,
+	1, 2, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 143, 3, 94, 3,
+	3, 3, 3, 104, 3, 3, 3, 183, 182, 182, 182, 403, 400, 0, 0, 404,
+	3, 172, 3, 3, 183, 3, 3, 405, 3, 236, 3, 236, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 112,
+	0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 201, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 201, 3, 3, 3, 3, 3, 3, 150, 0, 313, 0, 0, 0,
+	3, 3, 3, 3, 0, 347, 3, 3, 3, 112, 3, 3, 3, 3, 104, 190,
+	3, 3, 3, 236, 3, 3, 3, 3, 240, 3, 407, 0, 0, 0, 0, 0,
+	408, 408, 408, 408, 408, 409, 409, 409, 409, 409, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 236, 3, 134, 408, 408, 408, 408, 410, 409, 409, 409, 409, 411,
+	3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 240, 0, 412, 413,
+	412, 413, 414, 415, 416, 415, 416, 417, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 183, 0, 3, 3, 236, 0, 3, 0, 0, 0,
+	418, 51, 51, 51, 51, 51, 419, 420, 0, 0, 0, 0, 0, 0, 0, 0,
+	236, 127, 3, 3, 3, 3, 145, 421, 3, 3, 236, 0, 3, 3, 183, 0,
+	3, 3, 3, 183, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 422, 0,
+	3, 3, 236, 0, 3, 3, 3, 134, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 143, 0, 0, 0, 0, 0, 0, 0, 0,
+	423, 424, 172, 188, 3, 3, 236, 425, 0, 0, 0, 0, 3, 3, 3, 201,
+	3, 3, 3, 201, 0, 0, 0, 0, 3, 188, 3, 3, 426, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 236, 0, 3, 3, 236, 0, 3, 3, 112, 0,
+	3, 3, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 150, 0, 0, 0, 0, 0, 0,
+	427, 427, 427, 427, 427, 427, 428, 0, 429, 429, 429, 429, 429, 429, 430, 0,
+	3, 3, 3, 3, 262, 0, 3, 134, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 431, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 201, 132, 0, 3, 3, 432, 56, 313, 0, 0, 0, 3, 3,
+	433, 0, 0, 0, 0, 0, 3, 3, 201, 0, 0, 0, 3, 3, 183, 0,
+	102, 3, 3, 3, 3, 3, 3, 54, 434, 0, 0, 0, 143, 3, 435, 1,
+	369, 3, 3, 3, 3, 3, 436, 437, 438, 406, 3, 3, 3, 150, 3, 134,
+	118, 3, 3, 3, 241, 439, 440, 3, 181, 0, 3, 3, 3, 3, 441, 0,
+	177, 3, 3, 3, 3, 3, 104, 203, 442, 443, 3, 444, 0, 0, 0, 0,
+	3, 3, 146, 3, 3, 241, 445, 446, 0, 0, 0, 0, 0, 0, 0, 0,
+	183, 447, 3, 145, 3, 150, 3, 3, 3, 3, 3, 241, 95, 448, 3, 134,
+	449, 101, 126, 3, 3, 127, 147, 450, 451, 452, 164, 347, 453, 454, 454, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 54, 455, 112, 3, 456, 134, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 95, 457, 458, 0, 3, 134, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 459, 460, 313, 0, 0, 461, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 95, 462, 463, 0, 3, 134, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 464, 465, 150, 3, 134, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 466, 467, 468, 3, 134, 183, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 241, 54, 469, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 6, 6, 6, 9, 9, 9, 9, 3, 134, 0, 132,
+	183, 470, 471, 3, 3, 3, 145, 472, 473, 0, 3, 134, 0, 0, 0, 0,
+	0, 0, 0, 0, 3, 182, 3, 3, 3, 3, 262, 474, 475, 0, 0, 0,
+	120, 118, 3, 3, 3, 3, 476, 477, 1, 0, 375, 478, 3, 3, 3, 3,
+	3, 479, 203, 480, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 150,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 127, 3, 3, 3, 3, 243, 481, 150, 0, 3, 134, 0, 0, 182, 3,
+	3, 3, 482, 54, 54, 483, 484, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	183, 146, 3, 3, 3, 3, 485, 486, 487, 0, 3, 134, 145, 127, 3, 3,
+	3, 183, 488, 150, 3, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 489, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 183, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 240, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 150, 0,
+	3, 3, 3, 3, 3, 183, 56, 313, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 183, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 150, 3, 3, 3, 183, 3, 134, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 183, 3, 134, 3, 3, 3, 236, 454, 0,
+	3, 3, 3, 3, 3, 3, 490, 0, 491, 0, 3, 134, 392, 3, 3, 347,
+	3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 9, 9, 9, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 492, 3, 3, 3, 3, 3, 3,
+	3, 248, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 493, 0, 134, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 494, 495,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 112, 0, 0, 0, 0, 0, 112, 0, 181, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 112, 3, 201,
+	3, 150, 3, 496, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	56, 56, 56, 56, 56, 92, 56, 56, 490, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 114, 232, 56,
+	497, 256, 0, 0, 0, 342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 498, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 499, 50, 50, 50, 50, 50,
+	50, 50, 50, 499, 500, 501, 50, 502, 503, 50, 50, 50, 50, 50, 50, 50,
+	504, 505, 499, 499, 50, 50, 50, 506, 507, 315, 508, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	50, 50, 50, 50, 509, 50, 50, 50, 508, 50, 50, 510, 50, 50, 50, 510,
+	50, 50, 499, 50, 50, 50, 499, 50, 50, 511, 50, 50, 50, 511, 50, 50,
+	50, 508, 50, 50, 50, 508, 50, 50, 510, 512, 3, 3, 3, 3, 3, 3,
+	56, 56, 56, 56, 56, 56, 490, 232, 56, 56, 56, 56, 56, 454, 406, 0,
+	367, 0, 0, 232, 87, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	50, 513, 50, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	243, 54, 54, 514, 515, 190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 201, 249, 265, 3, 516, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 3, 3, 517, 0, 0, 3, 3, 3, 3, 3, 518, 3, 134,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 471, 3, 183,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 201, 0, 490, 0, 0, 0, 0, 0,
+	519, 519, 519, 519, 520, 521, 521, 521, 522, 523, 3, 134, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	172, 3, 3, 3, 524, 188, 193, 525, 526, 527, 524, 528, 524, 193, 193, 142,
+	3, 146, 3, 240, 529, 146, 3, 240, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 50, 50, 50, 530, 50, 50, 50, 530, 50, 50,
+	50, 530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 232,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 134,
+	200, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 0,
+};
+
+static constexpr uint16_t s_caseData[4248] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 1, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 1, 0,
+	1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 0, 0, 0, 0, 0, 1, 0, 5, 0, 0, 1, 0, 1,
+	0, 0, 0, 0, 1, 6, 0, 1, 1, 0, 5, 0, 0, 0, 0, 0,
+	3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 7,
+	4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 8,
+	9, 10, 9, 10, 9, 10, 9, 10, 11, 12, 9, 10, 9, 10, 9, 10,
+	5, 9, 10, 9, 10, 9, 10, 9, 10, 9, 10, 9, 10, 9, 10, 9,
+	10, 13, 9, 10, 9, 10, 9, 10, 14, 9, 10, 9, 10, 9, 10, 15,
+	16, 17, 9, 10, 9, 10, 18, 9, 10, 19, 19, 9, 10, 5, 20, 21,
+	22, 9, 10, 19, 23, 24, 25, 26, 9, 10, 27, 5, 25, 28, 29, 30,
+	9, 10, 9, 10, 9, 10, 31, 9, 10, 31, 5, 5, 9, 10, 31, 9,
+	10, 32, 32, 9, 10, 9, 10, 33, 9, 10, 5, 2, 9, 10, 5, 34,
+	2, 2, 2, 2, 35, 36, 37, 35, 36, 37, 35, 36, 37, 9, 10, 9,
+	10, 9, 10, 9, 10, 38, 9, 10, 39, 35, 36, 37, 9, 10, 40, 41,
+	42, 5, 9, 10, 9, 10, 9, 10, 9, 10, 9, 10, 5, 5, 5, 5,
+	5, 5, 43, 9, 10, 44, 45, 46, 46, 9, 10, 47, 48, 49, 9, 10,
+	50, 51, 52, 53, 54, 5, 55, 55, 5, 56, 5, 57, 58, 5, 5, 5,
+	55, 59, 5, 60, 5, 61, 62, 5, 63, 64, 62, 65, 66, 5, 5, 64,
+	5, 67, 68, 5, 5, 69, 5, 5, 5, 5, 5, 5, 5, 70, 5, 5,
+	71, 5, 72, 71, 5, 5, 5, 73, 71, 74, 75, 75, 76, 5, 5, 5,
+	5, 5, 77, 5, 2, 5, 5, 5, 5, 5, 5, 5, 5, 78, 79, 5,
+	5, 5, 5, 5, 5, 5, 5, 5, 80, 80, 80, 80, 80, 80, 80, 80,
+	80, 81, 81, 81, 81, 81, 81, 81, 80, 80, 1, 1, 1, 1, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 80, 80, 80, 80, 80, 1, 1, 1,
+	1, 1, 1, 1, 81, 1, 81, 1, 1, 1, 1, 1, 1, 82, 1, 1,
+	9, 10, 9, 10, 81, 1, 9, 10, 0, 0, 80, 29, 29, 29, 0, 83,
+	0, 0, 0, 0, 1, 1, 84, 1, 85, 85, 85, 0, 86, 0, 87, 87,
+	88, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 89, 90, 90, 90, 91, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 92, 4, 4, 4, 4, 4, 4, 4, 4, 4, 93, 94, 94, 95,
+	96, 97, 5, 5, 5, 98, 99, 100, 101, 102, 103, 104, 105, 106, 0, 9,
+	10, 107, 9, 10, 5, 42, 42, 42, 108, 108, 108, 108, 108, 108, 108, 108,
+	109, 109, 109, 109, 109, 109, 109, 109, 9, 10, 0, 1, 1, 1, 1, 1,
+	1, 1, 9, 10, 9, 10, 9, 10, 110, 9, 10, 9, 10, 9, 10, 9,
+	10, 9, 10, 9, 10, 9, 10, 111, 0, 112, 112, 112, 112, 112, 112, 112,
+	112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 0,
+	0, 81, 0, 0, 0, 0, 0, 1, 5, 113, 113, 113, 113, 113, 113, 113,
+	113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 114,
+	5, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	81, 81, 81, 81, 81, 81, 0, 81, 0, 81, 81, 0, 81, 81, 0, 81,
+	2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 0, 1, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 0, 0, 81, 81, 81, 0, 1, 0, 0, 0,
+	81, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 81, 81, 81, 81, 81,
+	1, 81, 81, 81, 81, 81, 81, 81, 2, 2, 0, 0, 0, 0, 2, 2,
+	2, 2, 2, 2, 0, 2, 81, 81, 81, 81, 81, 81, 81, 1, 0, 1,
+	81, 0, 1, 1, 1, 81, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+	2, 81, 2, 2, 2, 2, 2, 2, 1, 1, 1, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 81, 81, 81, 2, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 81, 81, 0, 0,
+	0, 0, 81, 0, 0, 1, 0, 0, 1, 1, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 1, 0, 0, 2, 1, 1, 1, 0, 0, 0, 0,
+	2, 2, 2, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2, 2, 0,
+	1, 1, 0, 0, 0, 0, 0, 0, 2, 81, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 81, 81, 81, 81, 1, 1, 1, 81, 81, 81, 81, 81,
+	81, 81, 81, 2, 2, 2, 2, 2, 2, 2, 81, 2, 1, 2, 2, 2,
+	2, 81, 81, 81, 81, 81, 81, 81, 81, 2, 2, 2, 2, 1, 2, 2,
+	2, 1, 1, 1, 1, 81, 81, 81, 2, 2, 81, 81, 0, 0, 2, 2,
+	0, 81, 2, 2, 2, 2, 2, 2, 2, 81, 2, 2, 0, 2, 2, 2,
+	2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2,
+	2, 0, 2, 0, 0, 0, 2, 2, 2, 2, 0, 0, 1, 2, 2, 2,
+	2, 81, 81, 81, 81, 0, 0, 2, 2, 0, 0, 2, 2, 1, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 0, 2,
+	2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0,
+	0, 81, 81, 2, 0, 2, 2, 2, 2, 0, 2, 2, 0, 2, 2, 0,
+	2, 2, 0, 0, 1, 0, 2, 2, 2, 81, 81, 0, 0, 0, 0, 81,
+	81, 0, 0, 81, 81, 1, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+	81, 81, 2, 2, 2, 81, 0, 0, 2, 2, 2, 2, 2, 2, 0, 2,
+	2, 2, 0, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0, 2, 2, 2,
+	2, 81, 81, 81, 81, 81, 0, 81, 81, 2, 0, 2, 2, 1, 0, 0,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 81, 81, 81, 1, 1, 1,
+	0, 81, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 1, 2, 2, 81,
+	2, 0, 0, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 81, 2,
+	0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 81, 2, 0, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0,
+	0, 2, 2, 0, 2, 0, 2, 2, 0, 0, 0, 2, 2, 0, 0, 0,
+	81, 2, 2, 0, 0, 0, 2, 2, 2, 0, 2, 2, 2, 1, 0, 0,
+	2, 0, 0, 0, 0, 0, 0, 2, 81, 2, 2, 2, 1, 2, 2, 2,
+	2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 1, 2, 81, 81,
+	81, 2, 2, 2, 2, 0, 81, 81, 81, 0, 81, 81, 81, 1, 0, 0,
+	0, 0, 0, 0, 0, 81, 81, 0, 2, 2, 2, 0, 0, 2, 0, 0,
+	2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 81, 2,
+	2, 0, 2, 2, 81, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0,
+	0, 2, 2, 0, 0, 0, 0, 0, 81, 81, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 1, 1, 2, 2, 2, 2, 81, 81, 81, 81, 0, 2, 2,
+	2, 0, 2, 2, 2, 1, 2, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+	0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+	2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2,
+	2, 2, 81, 81, 81, 0, 81, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2, 2, 81, 2, 2, 81, 81, 81, 81,
+	81, 81, 81, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 81, 1,
+	1, 1, 1, 1, 1, 81, 1, 0, 2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 2, 0, 2, 81, 81, 1, 81, 81, 2, 0, 0,
+	2, 2, 2, 2, 2, 0, 81, 0, 1, 1, 1, 1, 1, 81, 0, 0,
+	2, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 1, 0, 1,
+	0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0,
+	0, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 2,
+	81, 81, 1, 1, 1, 0, 1, 1, 2, 2, 2, 2, 2, 81, 81, 81,
+	81, 81, 81, 81, 81, 0, 0, 0, 81, 2, 81, 81, 81, 81, 81, 1,
+	2, 1, 1, 2, 2, 81, 81, 2, 81, 81, 2, 2, 2, 2, 81, 81,
+	2, 81, 81, 81, 81, 2, 2, 2, 2, 2, 81, 2, 2, 81, 81, 2,
+	2, 2, 2, 2, 2, 81, 2, 2, 2, 2, 2, 2, 2, 81, 0, 0,
+	115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 0, 115,
+	0, 0, 0, 0, 0, 115, 0, 0, 116, 116, 116, 116, 116, 116, 116, 116,
+	116, 116, 116, 0, 81, 116, 116, 116, 2, 2, 2, 0, 0, 1, 1, 1,
+	117, 117, 117, 117, 117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 0, 0,
+	119, 119, 119, 119, 119, 119, 0, 0, 2, 2, 81, 81, 1, 0, 0, 0,
+	2, 2, 81, 81, 0, 0, 0, 0, 2, 0, 81, 81, 0, 0, 0, 0,
+	2, 2, 2, 2, 1, 1, 2, 81, 81, 81, 81, 81, 81, 81, 2, 2,
+	2, 2, 2, 2, 2, 2, 81, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 0, 0, 0, 81, 0, 0, 0, 0, 2, 1, 0, 0,
+	0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 81, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 81, 81, 2, 2, 81, 2, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 0, 0, 81, 81, 81, 2, 2, 2, 2, 81,
+	81, 2, 2, 2, 0, 0, 0, 0, 2, 2, 81, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 81,
+	81, 2, 2, 81, 0, 0, 0, 0, 81, 81, 81, 81, 81, 81, 81, 0,
+	1, 2, 81, 2, 2, 81, 81, 81, 81, 81, 81, 81, 81, 2, 2, 2,
+	2, 2, 2, 81, 81, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 81, 1, 1, 1, 1, 1, 1, 1, 81,
+	81, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 81, 81, 81, 0,
+	81, 81, 81, 81, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 81, 81,
+	81, 81, 81, 2, 81, 2, 2, 2, 2, 2, 81, 2, 0, 2, 2, 2,
+	1, 1, 1, 1, 0, 0, 0, 0, 2, 2, 81, 81, 81, 81, 2, 2,
+	81, 81, 0, 1, 81, 81, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+	81, 81, 2, 2, 2, 81, 2, 81, 81, 81, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 81, 81, 81, 81, 81, 81, 81, 81, 2, 2, 81, 1,
+	2, 2, 0, 0, 0, 2, 2, 2, 81, 81, 81, 81, 81, 81, 0, 0,
+	120, 121, 122, 123, 123, 124, 125, 126, 127, 0, 0, 0, 0, 0, 0, 0,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 128, 128, 128,
+	1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+	1, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 0,
+	1, 1, 2, 0, 0, 0, 0, 0, 5, 5, 5, 5, 80, 80, 80, 80,
+	80, 80, 80, 5, 5, 5, 5, 5, 80, 129, 5, 5, 5, 130, 5, 5,
+	5, 5, 5, 5, 5, 5, 131, 5, 5, 5, 5, 80, 80, 80, 80, 80,
+	81, 81, 81, 81, 81, 1, 1, 1, 9, 10, 9, 10, 9, 10, 132, 133,
+	134, 135, 136, 137, 5, 5, 138, 5, 139, 139, 139, 139, 139, 139, 139, 139,
+	140, 140, 140, 140, 140, 140, 140, 140, 139, 139, 139, 139, 139, 139, 0, 0,
+	140, 140, 140, 140, 140, 140, 0, 0, 141, 139, 142, 139, 143, 139, 144, 139,
+	0, 140, 0, 140, 0, 140, 0, 140, 145, 145, 146, 146, 146, 146, 147, 147,
+	148, 148, 149, 149, 150, 150, 0, 0, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+	175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+	191, 192, 193, 194, 195, 196, 197, 198, 139, 139, 199, 200, 201, 0, 202, 203,
+	140, 140, 204, 204, 205, 1, 206, 1, 1, 1, 207, 208, 209, 0, 210, 211,
+	212, 212, 212, 212, 213, 1, 1, 1, 139, 139, 214, 215, 0, 0, 216, 217,
+	140, 140, 218, 218, 0, 1, 1, 1, 139, 139, 219, 220, 221, 103, 222, 223,
+	140, 140, 224, 224, 107, 1, 1, 1, 0, 0, 225, 226, 227, 0, 228, 229,
+	230, 230, 231, 231, 232, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+	0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1,
+	0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+	80, 80, 80, 80, 80, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 5, 5, 5, 5, 5, 5,
+	5, 5, 5, 5, 0, 5, 0, 0, 0, 5, 5, 5, 5, 5, 0, 0,
+	0, 0, 0, 0, 5, 0, 233, 0, 5, 0, 234, 235, 5, 5, 0, 5,
+	5, 5, 236, 5, 5, 2, 2, 2, 2, 5, 0, 0, 5, 5, 5, 5,
+	0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0, 237, 0,
+	238, 238, 238, 238, 238, 238, 238, 238, 239, 239, 239, 239, 239, 239, 239, 239,
+	2, 2, 2, 9, 10, 2, 2, 2, 0, 0, 0, 0, 0, 0, 240, 240,
+	240, 240, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241,
+	241, 241, 0, 0, 0, 0, 0, 0, 9, 10, 242, 243, 244, 245, 246, 9,
+	10, 9, 10, 9, 10, 247, 248, 249, 250, 5, 9, 10, 5, 9, 10, 5,
+	5, 5, 5, 5, 80, 80, 251, 251, 9, 10, 9, 10, 5, 0, 0, 0,
+	0, 0, 0, 9, 10, 9, 10, 1, 1, 1, 9, 10, 0, 0, 0, 0,
+	252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252, 0, 252,
+	0, 0, 0, 0, 0, 252, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+	0, 0, 1, 1, 1, 1, 0, 0, 0, 81, 81, 81, 81, 81, 0, 0,
+	0, 0, 0, 81, 2, 0, 0, 0, 0, 1, 1, 1, 1, 81, 81, 2,
+	2, 2, 2, 0, 81, 81, 81, 2, 0, 0, 0, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 81, 0, 0, 0, 9, 10, 9, 10, 9, 10, 2, 1,
+	1, 1, 1, 0, 81, 81, 81, 81, 81, 81, 81, 81, 1, 1, 0, 81,
+	9, 10, 9, 10, 80, 80, 81, 81, 5, 5, 9, 10, 9, 10, 9, 10,
+	80, 5, 5, 5, 5, 5, 5, 5, 5, 9, 10, 9, 10, 253, 9, 10,
+	81, 1, 1, 9, 10, 254, 5, 2, 9, 10, 9, 10, 255, 5, 9, 10,
+	9, 10, 256, 257, 258, 259, 256, 5, 260, 261, 262, 263, 9, 10, 9, 10,
+	9, 10, 9, 10, 264, 265, 266, 9, 10, 9, 10, 0, 0, 0, 0, 0,
+	9, 10, 0, 5, 0, 5, 9, 10, 9, 10, 0, 0, 0, 0, 0, 0,
+	0, 0, 81, 81, 81, 9, 10, 2, 80, 80, 5, 2, 2, 2, 2, 2,
+	2, 2, 81, 2, 2, 2, 1, 2, 0, 0, 0, 0, 1, 0, 0, 0,
+	2, 2, 2, 2, 1, 81, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2,
+	0, 0, 0, 2, 0, 2, 2, 81, 81, 81, 81, 1, 1, 1, 0, 0,
+	81, 81, 2, 0, 0, 0, 0, 0, 2, 2, 2, 1, 2, 2, 81, 81,
+	81, 81, 2, 2, 81, 81, 2, 2, 2, 81, 81, 81, 81, 81, 81, 2,
+	2, 81, 81, 2, 2, 81, 81, 0, 2, 2, 2, 2, 81, 2, 0, 0,
+	81, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2, 81, 2, 2, 2,
+	81, 2, 81, 81, 81, 2, 2, 81, 81, 2, 2, 2, 2, 2, 81, 1,
+	2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 81, 0, 0,
+	2, 2, 2, 2, 81, 81, 2, 2, 0, 0, 2, 81, 81, 2, 1, 0,
+	0, 2, 2, 2, 2, 2, 2, 0, 5, 5, 5, 267, 5, 5, 5, 5,
+	5, 5, 5, 1, 80, 80, 80, 80, 5, 81, 1, 1, 0, 0, 0, 0,
+	268, 268, 268, 268, 268, 268, 268, 268, 81, 2, 2, 0, 0, 1, 0, 0,
+	0, 0, 0, 2, 2, 2, 2, 2, 269, 270, 271, 272, 273, 274, 275, 0,
+	0, 0, 0, 276, 277, 278, 279, 280, 0, 0, 0, 0, 0, 2, 81, 2,
+	2, 2, 2, 2, 2, 0, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2,
+	2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+	2, 2, 2, 2, 2, 0, 0, 1, 0, 0, 2, 2, 2, 0, 0, 0,
+	0, 1, 1, 1, 0, 0, 0, 0, 2, 2, 2, 0, 2, 2, 0, 2,
+	0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	281, 281, 281, 281, 0, 0, 0, 0, 282, 282, 282, 282, 0, 0, 0, 0,
+	283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 0, 283, 283, 283, 283,
+	283, 283, 283, 0, 283, 283, 0, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+	284, 284, 0, 284, 284, 284, 284, 284, 284, 284, 0, 284, 284, 0, 0, 0,
+	80, 81, 81, 80, 80, 80, 0, 80, 80, 0, 80, 80, 80, 80, 80, 80,
+	80, 80, 80, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 2,
+	2, 2, 2, 0, 2, 2, 0, 0, 2, 81, 81, 81, 0, 81, 81, 0,
+	0, 0, 0, 0, 81, 81, 81, 81, 1, 1, 1, 0, 0, 0, 0, 1,
+	2, 2, 2, 2, 2, 1, 1, 0, 86, 86, 86, 86, 86, 86, 86, 86,
+	86, 86, 86, 0, 0, 0, 0, 0, 93, 93, 93, 93, 93, 93, 93, 93,
+	93, 93, 93, 0, 0, 0, 0, 0, 2, 2, 0, 81, 81, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 1, 1, 1, 1, 0, 0,
+	81, 81, 81, 81, 81, 81, 1, 0, 1, 2, 2, 81, 81, 2, 0, 0,
+	2, 2, 2, 81, 81, 81, 81, 2, 2, 1, 1, 0, 0, 1, 0, 0,
+	0, 0, 81, 0, 0, 0, 0, 0, 81, 81, 81, 81, 2, 81, 81, 81,
+	81, 81, 81, 1, 1, 0, 2, 2, 2, 2, 2, 1, 0, 0, 2, 0,
+	0, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1, 1, 1, 0, 2, 81,
+	2, 2, 2, 0, 2, 0, 0, 0, 81, 81, 2, 2, 81, 0, 1, 81,
+	0, 0, 0, 0, 0, 0, 81, 0, 2, 0, 2, 2, 2, 2, 0, 2,
+	81, 1, 1, 0, 0, 0, 0, 0, 81, 81, 2, 2, 0, 2, 2, 2,
+	2, 2, 0, 1, 1, 2, 2, 2, 81, 2, 2, 2, 2, 0, 0, 2,
+	2, 0, 0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 0, 0, 1, 1,
+	1, 1, 1, 1, 1, 0, 0, 0, 2, 2, 1, 81, 81, 2, 1, 2,
+	2, 2, 0, 0, 0, 0, 1, 2, 81, 2, 81, 2, 2, 2, 2, 81,
+	81, 2, 1, 1, 2, 2, 0, 2, 2, 2, 81, 81, 81, 81, 0, 0,
+	2, 2, 2, 2, 81, 81, 2, 1, 2, 2, 2, 2, 81, 81, 0, 0,
+	81, 81, 81, 2, 2, 81, 2, 1, 81, 0, 0, 0, 2, 0, 0, 0,
+	2, 2, 2, 81, 2, 81, 2, 2, 81, 81, 81, 81, 81, 81, 0, 1,
+	2, 2, 2, 0, 0, 81, 81, 81, 2, 2, 81, 81, 81, 81, 2, 81,
+	81, 81, 81, 1, 0, 0, 0, 0, 2, 1, 1, 0, 0, 0, 0, 0,
+	0, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 0,
+	2, 0, 0, 81, 81, 0, 1, 2, 2, 2, 2, 1, 0, 0, 0, 0,
+	0, 0, 81, 81, 2, 2, 2, 2, 1, 2, 0, 2, 2, 0, 0, 0,
+	2, 2, 2, 1, 1, 81, 81, 81, 81, 2, 2, 81, 81, 81, 81, 0,
+	2, 81, 81, 81, 2, 2, 2, 2, 2, 2, 81, 81, 81, 81, 81, 81,
+	1, 1, 0, 0, 0, 2, 0, 0, 81, 81, 81, 81, 81, 81, 2, 1,
+	0, 0, 81, 81, 81, 81, 81, 81, 0, 2, 81, 81, 81, 81, 81, 81,
+	81, 2, 81, 81, 2, 81, 81, 0, 2, 81, 81, 81, 81, 81, 81, 0,
+	0, 0, 81, 0, 81, 81, 0, 81, 81, 81, 1, 81, 1, 1, 2, 81,
+	81, 81, 0, 2, 2, 81, 2, 1, 2, 2, 2, 81, 81, 2, 2, 0,
+	1, 1, 1, 1, 1, 1, 1, 0, 81, 81, 81, 81, 0, 0, 0, 0,
+	2, 2, 2, 0, 0, 0, 0, 81, 81, 81, 0, 81, 1, 0, 0, 0,
+	81, 81, 81, 81, 0, 81, 81, 81, 81, 81, 81, 81, 0, 81, 81, 0,
+	2, 2, 0, 0, 0, 1, 81, 0, 1, 1, 1, 0, 0, 1, 1, 1,
+	0, 0, 1, 1, 1, 0, 0, 0, 5, 5, 5, 5, 5, 0, 5, 5,
+	0, 0, 5, 0, 0, 5, 5, 0, 0, 5, 5, 5, 5, 0, 5, 5,
+	5, 5, 0, 5, 0, 5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5,
+	5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 0, 0, 5, 5, 5,
+	5, 5, 0, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 0,
+	5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+	5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+	5, 5, 5, 5, 0, 0, 2, 2, 5, 5, 2, 5, 5, 5, 5, 5,
+	81, 0, 0, 81, 81, 81, 81, 81, 81, 81, 0, 81, 81, 0, 81, 81,
+	2, 2, 0, 0, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2, 1, 0,
+	2, 2, 2, 2, 1, 1, 1, 1, 285, 285, 285, 285, 285, 285, 285, 285,
+	285, 285, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286, 286,
+	286, 286, 286, 286, 1, 1, 1, 81, 1, 1, 1, 81, 0, 0, 0, 0,
+	0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0,
+	0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 2, 2,
+	0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 2, 2, 0, 2, 2, 2,
+	5, 5, 0, 0, 0, 0, 0, 0,
+};
+
+SPRT_INLINE inline uint16_t getCaseValue(char32_t c) {
+	if (c >= 0x11'0000) {
+		return CaseDefaultValue;
+	}
+	const auto chunk = s_caseChunks[c >> CaseChunkShift];
+	const auto block = s_caseBlocks[(uint32_t(chunk) << (CaseChunkShift - CaseBlockShift))
+			+ ((c >> CaseBlockShift) & ((1 << (CaseChunkShift - CaseBlockShift)) - 1))];
+	return s_caseData[(uint32_t(block) << CaseBlockShift) + (c & ((1 << CaseBlockShift) - 1))];
+}
+
+static constexpr CaseRecord s_caseRecords[287] = {
+	{0, 0, 0, 0, 0, 0},
+	{0, 0, 0, 0, 2, 0},
+	{0, 0, 0, 0, 4, 0},
+	{32, 0, 0, 32, 5, 0},
+	{0, -32, -32, 0, 5, 0},
+	{0, 0, 0, 0, 5, 0},
+	{0, 743, 743, 775, 5, 0},
+	{0, 0, 0, 0, 5, 1},
+	{0, 121, 121, 0, 5, 0},
+	{1, 0, 0, 1, 5, 0},
+	{0, -1, -1, 0, 5, 0},
+	{-199, 0, 0, 0, 5, 2},
+	{0, -232, -232, 0, 5, 0},
+	{0, 0, 0, 0, 5, 3},
+	{-121, 0, 0, -121, 5, 0},
+	{0, -300, -300, -268, 5, 0},
+	{0, 195, 195, 0, 5, 0},
+	{210, 0, 0, 210, 5, 0},
+	{206, 0, 0, 206, 5, 0},
+	{205, 0, 0, 205, 5, 0},
+	{79, 0, 0, 79, 5, 0},
+	{202, 0, 0, 202, 5, 0},
+	{203, 0, 0, 203, 5, 0},
+	{207, 0, 0, 207, 5, 0},
+	{0, 97, 97, 0, 5, 0},
+	{211, 0, 0, 211, 5, 0},
+	{209, 0, 0, 209, 5, 0},
+	{0, 163, 163, 0, 5, 0},
+	{213, 0, 0, 213, 5, 0},
+	{0, 130, 130, 0, 5, 0},
+	{214, 0, 0, 214, 5, 0},
+	{218, 0, 0, 218, 5, 0},
+	{217, 0, 0, 217, 5, 0},
+	{219, 0, 0, 219, 5, 0},
+	{0, 56, 56, 0, 5, 0},
+	{2, 0, 1, 2, 5, 0},
+	{1, -1, 0, 1, 5, 0},
+	{0, -2, -1, 0, 5, 0},
+	{0, -79, -79, 0, 5, 0},
+	{0, 0, 0, 0, 5, 4},
+	{-97, 0, 0, -97, 5, 0},
+	{-56, 0, 0, -56, 5, 0},
+	{-130, 0, 0, -130, 5, 0},
+	{10795, 0, 0, 10795, 5, 0},
+	{-163, 0, 0, -163, 5, 0},
+	{10792, 0, 0, 10792, 5, 0},
+	{0, 10815, 10815, 0, 5, 0},
+	{-195, 0, 0, -195, 5, 0},
+	{69, 0, 0, 69, 5, 0},
+	{71, 0, 0, 71, 5, 0},
+	{0, 10783, 10783, 0, 5, 0},
+	{0, 10780, 10780, 0, 5, 0},
+	{0, 10782, 10782, 0, 5, 0},
+	{0, -210, -210, 0, 5, 0},
+	{0, -206, -206, 0, 5, 0},
+	{0, -205, -205, 0, 5, 0},
+	{0, -202, -202, 0, 5, 0},
+	{0, -203, -203, 0, 5, 0},
+	{0, 42319, 42319, 0, 5, 0},
+	{0, 42315, 42315, 0, 5, 0},
+	{0, -207, -207, 0, 5, 0},
+	{0, 42280, 42280, 0, 5, 0},
+	{0, 42308, 42308, 0, 5, 0},
+	{0, -209, -209, 0, 5, 0},
+	{0, -211, -211, 0, 5, 0},
+	{0, 10743, 10743, 0, 5, 0},
+	{0, 42305, 42305, 0, 5, 0},
+	{0, 10749, 10749, 0, 5, 0},
+	{0, -213, -213, 0, 5, 0},
+	{0, -214, -214, 0, 5, 0},
+	{0, 10727, 10727, 0, 5, 0},
+	{0, -218, -218, 0, 5, 0},
+	{0, 42307, 42307, 0, 5, 0},
+	{0, 42282, 42282, 0, 5, 0},
+	{0, -69, -69, 0, 5, 0},
+	{0, -217, -217, 0, 5, 0},
+	{0, -71, -71, 0, 5, 0},
+	{0, -219, -219, 0, 5, 0},
+	{0, 42261, 42261, 0, 5, 0},
+	{0, 42258, 42258, 0, 5, 0},
+	{0, 0, 0, 0, 7, 0},
+	{0, 0, 0, 0, 6, 0},
+	{0, 84, 84, 116, 7, 0},
+	{116, 0, 0, 116, 5, 0},
+	{38, 0, 0, 38, 5, 0},
+	{37, 0, 0, 37, 5, 0},
+	{64, 0, 0, 64, 5, 0},
+	{63, 0, 0, 63, 5, 0},
+	{0, 0, 0, 0, 5, 5},
+	{0, -38, -38, 0, 5, 0},
+	{0, -37, -37, 0, 5, 0},
+	{0, 0, 0, 0, 5, 6},
+	{0, -31, -31, 1, 5, 0},
+	{0, -64, -64, 0, 5, 0},
+	{0, -63, -63, 0, 5, 0},
+	{8, 0, 0, 8, 5, 0},
+	{0, -62, -62, -30, 5, 0},
+	{0, -57, -57, -25, 5, 0},
+	{0, -47, -47, -15, 5, 0},
+	{0, -54, -54, -22, 5, 0},
+	{0, -8, -8, 0, 5, 0},
+	{0, -86, -86, -54, 5, 0},
+	{0, -80, -80, -48, 5, 0},
+	{0, 7, 7, 0, 5, 0},
+	{0, -116, -116, 0, 5, 0},
+	{-60, 0, 0, -60, 5, 0},
+	{0, -96, -96, -64, 5, 0},
+	{-7, 0, 0, -7, 5, 0},
+	{80, 0, 0, 80, 5, 0},
+	{0, -80, -80, 0, 5, 0},
+	{15, 0, 0, 15, 5, 0},
+	{0, -15, -15, 0, 5, 0},
+	{48, 0, 0, 48, 5, 0},
+	{0, -48, -48, 0, 5, 0},
+	{0, 0, 0, 0, 5, 7},
+	{7264, 0, 0, 7264, 5, 0},
+	{0, 3008, 0, 0, 5, 0},
+	{38864, 0, 0, 0, 5, 0},
+	{8, 0, 0, 0, 5, 0},
+	{0, -8, -8, -8, 5, 0},
+	{0, -6254, -6254, -6222, 5, 0},
+	{0, -6253, -6253, -6221, 5, 0},
+	{0, -6244, -6244, -6212, 5, 0},
+	{0, -6242, -6242, -6210, 5, 0},
+	{0, -6243, -6243, -6211, 5, 0},
+	{0, -6236, -6236, -6204, 5, 0},
+	{0, -6181, -6181, -6180, 5, 0},
+	{0, 35266, 35266, 35267, 5, 0},
+	{-3008, 0, 0, -3008, 5, 0},
+	{0, 35332, 35332, 0, 5, 0},
+	{0, 3814, 3814, 0, 5, 0},
+	{0, 35384, 35384, 0, 5, 0},
+	{0, 0, 0, 0, 5, 8},
+	{0, 0, 0, 0, 5, 9},
+	{0, 0, 0, 0, 5, 10},
+	{0, 0, 0, 0, 5, 11},
+	{0, 0, 0, 0, 5, 12},
+	{0, -59, -59, -58, 5, 0},
+	{-7615, 0, 0, -7615, 5, 13},
+	{0, 8, 8, 0, 5, 0},
+	{-8, 0, 0, -8, 5, 0},
+	{0, 0, 0, 0, 5, 14},
+	{0, 0, 0, 0, 5, 15},
+	{0, 0, 0, 0, 5, 16},
+	{0, 0, 0, 0, 5, 17},
+	{0, 74, 74, 0, 5, 0},
+	{0, 86, 86, 0, 5, 0},
+	{0, 100, 100, 0, 5, 0},
+	{0, 128, 128, 0, 5, 0},
+	{0, 112, 112, 0, 5, 0},
+	{0, 126, 126, 0, 5, 0},
+	{0, 8, 8, 0, 5, 18},
+	{0, 8, 8, 0, 5, 19},
+	{0, 8, 8, 0, 5, 20},
+	{0, 8, 8, 0, 5, 21},
+	{0, 8, 8, 0, 5, 22},
+	{0, 8, 8, 0, 5, 23},
+	{0, 8, 8, 0, 5, 24},
+	{0, 8, 8, 0, 5, 25},
+	{-8, 0, 0, -8, 5, 18},
+	{-8, 0, 0, -8, 5, 19},
+	{-8, 0, 0, -8, 5, 20},
+	{-8, 0, 0, -8, 5, 21},
+	{-8, 0, 0, -8, 5, 22},
+	{-8, 0, 0, -8, 5, 23},
+	{-8, 0, 0, -8, 5, 24},
+	{-8, 0, 0, -8, 5, 25},
+	{0, 8, 8, 0, 5, 26},
+	{0, 8, 8, 0, 5, 27},
+	{0, 8, 8, 0, 5, 28},
+	{0, 8, 8, 0, 5, 29},
+	{0, 8, 8, 0, 5, 30},
+	{0, 8, 8, 0, 5, 31},
+	{0, 8, 8, 0, 5, 32},
+	{0, 8, 8, 0, 5, 33},
+	{-8, 0, 0, -8, 5, 26},
+	{-8, 0, 0, -8, 5, 27},
+	{-8, 0, 0, -8, 5, 28},
+	{-8, 0, 0, -8, 5, 29},
+	{-8, 0, 0, -8, 5, 30},
+	{-8, 0, 0, -8, 5, 31},
+	{-8, 0, 0, -8, 5, 32},
+	{-8, 0, 0, -8, 5, 33},
+	{0, 8, 8, 0, 5, 34},
+	{0, 8, 8, 0, 5, 35},
+	{0, 8, 8, 0, 5, 36},
+	{0, 8, 8, 0, 5, 37},
+	{0, 8, 8, 0, 5, 38},
+	{0, 8, 8, 0, 5, 39},
+	{0, 8, 8, 0, 5, 40},
+	{0, 8, 8, 0, 5, 41},
+	{-8, 0, 0, -8, 5, 34},
+	{-8, 0, 0, -8, 5, 35},
+	{-8, 0, 0, -8, 5, 36},
+	{-8, 0, 0, -8, 5, 37},
+	{-8, 0, 0, -8, 5, 38},
+	{-8, 0, 0, -8, 5, 39},
+	{-8, 0, 0, -8, 5, 40},
+	{-8, 0, 0, -8, 5, 41},
+	{0, 0, 0, 0, 5, 42},
+	{0, 9, 9, 0, 5, 43},
+	{0, 0, 0, 0, 5, 44},
+	{0, 0, 0, 0, 5, 45},
+	{0, 0, 0, 0, 5, 46},
+	{-74, 0, 0, -74, 5, 0},
+	{-9, 0, 0, -9, 5, 43},
+	{0, -7205, -7205, -7173, 5, 0},
+	{0, 0, 0, 0, 5, 47},
+	{0, 9, 9, 0, 5, 48},
+	{0, 0, 0, 0, 5, 49},
+	{0, 0, 0, 0, 5, 50},
+	{0, 0, 0, 0, 5, 51},
+	{-86, 0, 0, -86, 5, 0},
+	{-9, 0, 0, -9, 5, 48},
+	{0, 0, 0, 0, 5, 52},
+	{0, 0, 0, 0, 5, 53},
+	{0, 0, 0, 0, 5, 54},
+	{0, 0, 0, 0, 5, 55},
+	{-100, 0, 0, -100, 5, 0},
+	{0, 0, 0, 0, 5, 56},
+	{0, 0, 0, 0, 5, 57},
+	{0, 0, 0, 0, 5, 58},
+	{0, 0, 0, 0, 5, 59},
+	{0, 0, 0, 0, 5, 60},
+	{-112, 0, 0, -112, 5, 0},
+	{0, 0, 0, 0, 5, 61},
+	{0, 9, 9, 0, 5, 62},
+	{0, 0, 0, 0, 5, 63},
+	{0, 0, 0, 0, 5, 64},
+	{0, 0, 0, 0, 5, 65},
+	{-128, 0, 0, -128, 5, 0},
+	{-126, 0, 0, -126, 5, 0},
+	{-9, 0, 0, -9, 5, 62},
+	{-7517, 0, 0, -7517, 5, 0},
+	{-8383, 0, 0, -8383, 5, 0},
+	{-8262, 0, 0, -8262, 5, 0},
+	{28, 0, 0, 28, 5, 0},
+	{0, -28, -28, 0, 5, 0},
+	{16, 0, 0, 16, 5, 0},
+	{0, -16, -16, 0, 5, 0},
+	{26, 0, 0, 26, 5, 0},
+	{0, -26, -26, 0, 5, 0},
+	{-10743, 0, 0, -10743, 5, 0},
+	{-3814, 0, 0, -3814, 5, 0},
+	{-10727, 0, 0, -10727, 5, 0},
+	{0, -10795, -10795, 0, 5, 0},
+	{0, -10792, -10792, 0, 5, 0},
+	{-10780, 0, 0, -10780, 5, 0},
+	{-10749, 0, 0, -10749, 5, 0},
+	{-10783, 0, 0, -10783, 5, 0},
+	{-10782, 0, 0, -10782, 5, 0},
+	{-10815, 0, 0, -10815, 5, 0},
+	{0, -7264, -7264, 0, 5, 0},
+	{-35332, 0, 0, -35332, 5, 0},
+	{-42280, 0, 0, -42280, 5, 0},
+	{0, 48, 48, 0, 5, 0},
+	{-42308, 0, 0, -42308, 5, 0},
+	{-42319, 0, 0, -42319, 5, 0},
+	{-42315, 0, 0, -42315, 5, 0},
+	{-42305, 0, 0, -42305, 5, 0},
+	{-42258, 0, 0, -42258, 5, 0},
+	{-42282, 0, 0, -42282, 5, 0},
+	{-42261, 0, 0, -42261, 5, 0},
+	{928, 0, 0, 928, 5, 0},
+	{-48, 0, 0, -48, 5, 0},
+	{-42307, 0, 0, -42307, 5, 0},
+	{-35384, 0, 0, -35384, 5, 0},
+	{0, -928, -928, 0, 5, 0},
+	{0, -38864, -38864, -38864, 5, 0},
+	{0, 0, 0, 0, 5, 66},
+	{0, 0, 0, 0, 5, 67},
+	{0, 0, 0, 0, 5, 68},
+	{0, 0, 0, 0, 5, 69},
+	{0, 0, 0, 0, 5, 70},
+	{0, 0, 0, 0, 5, 71},
+	{0, 0, 0, 0, 5, 72},
+	{0, 0, 0, 0, 5, 73},
+	{0, 0, 0, 0, 5, 74},
+	{0, 0, 0, 0, 5, 75},
+	{0, 0, 0, 0, 5, 76},
+	{0, 0, 0, 0, 5, 77},
+	{40, 0, 0, 40, 5, 0},
+	{0, -40, -40, 0, 5, 0},
+	{39, 0, 0, 39, 5, 0},
+	{0, -39, -39, 0, 5, 0},
+	{34, 0, 0, 34, 5, 0},
+	{0, -34, -34, 0, 5, 0},
+};
+
+static constexpr CaseSpecial s_caseSpecials[78] = {
+	{0, 0, 0, 0},
+	{1, 3, 6, 9},
+	{12, 15, 15, 12},
+	{17, 19, 19, 22},
+	{25, 27, 27, 30},
+	{33, 35, 35, 39},
+	{43, 45, 45, 49},
+	{53, 55, 58, 61},
+	{64, 66, 66, 69},
+	{72, 74, 74, 77},
+	{80, 82, 82, 85},
+	{88, 90, 90, 93},
+	{96, 98, 98, 101},
+	{1, 104, 104, 9},
+	{106, 108, 108, 111},
+	{114, 116, 116, 120},
+	{124, 126, 126, 130},
+	{134, 136, 136, 140},
+	{144, 146, 149, 151},
+	{154, 156, 159, 161},
+	{164, 166, 169, 171},
+	{174, 176, 179, 181},
+	{184, 186, 189, 191},
+	{194, 196, 199, 201},
+	{204, 206, 209, 211},
+	{214, 216, 219, 221},
+	{224, 226, 229, 231},
+	{234, 236, 239, 241},
+	{244, 246, 249, 251},
+	{254, 256, 259, 261},
+	{264, 266, 269, 271},
+	{274, 276, 279, 281},
+	{284, 286, 289, 291},
+	{294, 296, 299, 301},
+	{304, 306, 309, 311},
+	{314, 316, 319, 321},
+	{324, 326, 329, 331},
+	{334, 336, 339, 341},
+	{344, 346, 349, 351},
+	{354, 356, 359, 361},
+	{364, 366, 369, 371},
+	{374, 376, 379, 381},
+	{384, 386, 389, 392},
+	{395, 397, 400, 402},
+	{405, 407, 410, 413},
+	{416, 418, 418, 421},
+	{424, 426, 430, 434},
+	{438, 440, 443, 446},
+	{449, 451, 454, 456},
+	{459, 461, 464, 467},
+	{470, 472, 472, 475},
+	{478, 480, 484, 488},
+	{492, 494, 494, 498},
+	{502, 35, 35, 39},
+	{504, 506, 506, 509},
+	{512, 514, 514, 518},
+	{522, 524, 524, 528},
+	{532, 45, 45, 49},
+	{534, 536, 536, 539},
+	{542, 544, 544, 547},
+	{550, 552, 552, 556},
+	{560, 562, 565, 568},
+	{571, 573, 576, 578},
+	{581, 583, 586, 589},
+	{592, 594, 594, 597},
+	{600, 602, 606, 610},
+	{614, 616, 619, 622},
+	{625, 627, 630, 633},
+	{636, 638, 641, 644},
+	{647, 649, 653, 657},
+	{661, 663, 667, 671},
+	{675, 677, 680, 683},
+	{686, 677, 680, 683},
+	{688, 690, 693, 696},
+	{699, 701, 704, 707},
+	{710, 712, 715, 718},
+	{721, 723, 726, 729},
+	{732, 734, 737, 740},
+};
+
+static constexpr char16_t s_caseSpecialChars[743] = {
+	0x0000, 0x0001, 0x00DF, 0x0002, 0x0053, 0x0053, 0x0002, 0x0053, 0x0073, 0x0002, 0x0073, 0x0073,
+	0x0002, 0x0069, 0x0307, 0x0001, 0x0130, 0x0001, 0x0149, 0x0002, 0x02BC, 0x004E, 0x0002, 0x02BC,
+	0x006E, 0x0001, 0x01F0, 0x0002, 0x004A, 0x030C, 0x0002, 0x006A, 0x030C, 0x0001, 0x0390, 0x0003,
+	0x0399, 0x0308, 0x0301, 0x0003, 0x03B9, 0x0308, 0x0301, 0x0001, 0x03B0, 0x0003, 0x03A5, 0x0308,
+	0x0301, 0x0003, 0x03C5, 0x0308, 0x0301, 0x0001, 0x0587, 0x0002, 0x0535, 0x0552, 0x0002, 0x0535,
+	0x0582, 0x0002, 0x0565, 0x0582, 0x0001, 0x1E96, 0x0002, 0x0048, 0x0331, 0x0002, 0x0068, 0x0331,
+	0x0001, 0x1E97, 0x0002, 0x0054, 0x0308, 0x0002, 0x0074, 0x0308, 0x0001, 0x1E98, 0x0002, 0x0057,
+	0x030A, 0x0002, 0x0077, 0x030A, 0x0001, 0x1E99, 0x0002, 0x0059, 0x030A, 0x0002, 0x0079, 0x030A,
+	0x0001, 0x1E9A, 0x0002, 0x0041, 0x02BE, 0x0002, 0x0061, 0x02BE, 0x0001, 0x1E9E, 0x0001, 0x1F50,
+	0x0002, 0x03A5, 0x0313, 0x0002, 0x03C5, 0x0313, 0x0001, 0x1F52, 0x0003, 0x03A5, 0x0313, 0x0300,
+	0x0003, 0x03C5, 0x0313, 0x0300, 0x0001, 0x1F54, 0x0003, 0x03A5, 0x0313, 0x0301, 0x0003, 0x03C5,
+	0x0313, 0x0301, 0x0001, 0x1F56, 0x0003, 0x03A5, 0x0313, 0x0342, 0x0003, 0x03C5, 0x0313, 0x0342,
+	0x0001, 0x1F80, 0x0002, 0x1F08, 0x0399, 0x0001, 0x1F88, 0x0002, 0x1F00, 0x03B9, 0x0001, 0x1F81,
+	0x0002, 0x1F09, 0x0399, 0x0001, 0x1F89, 0x0002, 0x1F01, 0x03B9, 0x0001, 0x1F82, 0x0002, 0x1F0A,
+	0x0399, 0x0001, 0x1F8A, 0x0002, 0x1F02, 0x03B9, 0x0001, 0x1F83, 0x0002, 0x1F0B, 0x0399, 0x0001,
+	0x1F8B, 0x0002, 0x1F03, 0x03B9, 0x0001, 0x1F84, 0x0002, 0x1F0C, 0x0399, 0x0001, 0x1F8C, 0x0002,
+	0x1F04, 0x03B9, 0x0001, 0x1F85, 0x0002, 0x1F0D, 0x0399, 0x0001, 0x1F8D, 0x0002, 0x1F05, 0x03B9,
+	0x0001, 0x1F86, 0x0002, 0x1F0E, 0x0399, 0x0001, 0x1F8E, 0x0002, 0x1F06, 0x03B9, 0x0001, 0x1F87,
+	0x0002, 0x1F0F, 0x0399, 0x0001, 0x1F8F, 0x0002, 0x1F07, 0x03B9, 0x0001, 0x1F90, 0x0002, 0x1F28,
+	0x0399, 0x0001, 0x1F98, 0x0002, 0x1F20, 0x03B9, 0x0001, 0x1F91, 0x0002, 0x1F29, 0x0399, 0x0001,
+	0x1F99, 0x0002, 0x1F21, 0x03B9, 0x0001, 0x1F92, 0x0002, 0x1F2A, 0x0399, 0x0001, 0x1F9A, 0x0002,
+	0x1F22, 0x03B9, 0x0001, 0x1F93, 0x0002, 0x1F2B, 0x0399, 0x0001, 0x1F9B, 0x0002, 0x1F23, 0x03B9,
+	0x0001, 0x1F94, 0x0002, 0x1F2C, 0x0399, 0x0001, 0x1F9C, 0x0002, 0x1F24, 0x03B9, 0x0001, 0x1F95,
+	0x0002, 0x1F2D, 0x0399, 0x0001, 0x1F9D, 0x0002, 0x1F25, 0x03B9, 0x0001, 0x1F96, 0x0002, 0x1F2E,
+	0x0399, 0x0001, 0x1F9E, 0x0002, 0x1F26, 0x03B9, 0x0001, 0x1F97, 0x0002, 0x1F2F, 0x0399, 0x0001,
+	0x1F9F, 0x0002, 0x1F27, 0x03B9, 0x0001, 0x1FA0, 0x0002, 0x1F68, 0x0399, 0x0001, 0x1FA8, 0x0002,
+	0x1F60, 0x03B9, 0x0001, 0x1FA1, 0x0002, 0x1F69, 0x0399, 0x0001, 0x1FA9, 0x0002, 0x1F61, 0x03B9,
+	0x0001, 0x1FA2, 0x0002, 0x1F6A, 0x0399, 0x0001, 0x1FAA, 0x0002, 0x1F62, 0x03B9, 0x0001, 0x1FA3,
+	0x0002, 0x1F6B, 0x0399, 0x0001, 0x1FAB, 0x0002, 0x1F63, 0x03B9, 0x0001, 0x1FA4, 0x0002, 0x1F6C,
+	0x0399, 0x0001, 0x1FAC, 0x0002, 0x1F64, 0x03B9, 0x0001, 0x1FA5, 0x0002, 0x1F6D, 0x0399, 0x0001,
+	0x1FAD, 0x0002, 0x1F65, 0x03B9, 0x0001, 0x1FA6, 0x0002, 0x1F6E, 0x0399, 0x0001, 0x1FAE, 0x0002,
+	0x1F66, 0x03B9, 0x0001, 0x1FA7, 0x0002, 0x1F6F, 0x0399, 0x0001, 0x1FAF, 0x0002, 0x1F67, 0x03B9,
+	0x0001, 0x1FB2, 0x0002, 0x1FBA, 0x0399, 0x0002, 0x1FBA, 0x0345, 0x0002, 0x1F70, 0x03B9, 0x0001,
+	0x1FB3, 0x0002, 0x0391, 0x0399, 0x0001, 0x1FBC, 0x0002, 0x03B1, 0x03B9, 0x0001, 0x1FB4, 0x0002,
+	0x0386, 0x0399, 0x0002, 0x0386, 0x0345, 0x0002, 0x03AC, 0x03B9, 0x0001, 0x1FB6, 0x0002, 0x0391,
+	0x0342, 0x0002, 0x03B1, 0x0342, 0x0001, 0x1FB7, 0x0003, 0x0391, 0x0342, 0x0399, 0x0003, 0x0391,
+	0x0342, 0x0345, 0x0003, 0x03B1, 0x0342, 0x03B9, 0x0001, 0x1FC2, 0x0002, 0x1FCA, 0x0399, 0x0002,
+	0x1FCA, 0x0345, 0x0002, 0x1F74, 0x03B9, 0x0001, 0x1FC3, 0x0002, 0x0397, 0x0399, 0x0001, 0x1FCC,
+	0x0002, 0x03B7, 0x03B9, 0x0001, 0x1FC4, 0x0002, 0x0389, 0x0399, 0x0002, 0x0389, 0x0345, 0x0002,
+	0x03AE, 0x03B9, 0x0001, 0x1FC6, 0x0002, 0x0397, 0x0342, 0x0002, 0x03B7, 0x0342, 0x0001, 0x1FC7,
+	0x0003, 0x0397, 0x0342, 0x0399, 0x0003, 0x0397, 0x0342, 0x0345, 0x0003, 0x03B7, 0x0342, 0x03B9,
+	0x0001, 0x1FD2, 0x0003, 0x0399, 0x0308, 0x0300, 0x0003, 0x03B9, 0x0308, 0x0300, 0x0001, 0x1FD3,
+	0x0001, 0x1FD6, 0x0002, 0x0399, 0x0342, 0x0002, 0x03B9, 0x0342, 0x0001, 0x1FD7, 0x0003, 0x0399,
+	0x0308, 0x0342, 0x0003, 0x03B9, 0x0308, 0x0342, 0x0001, 0x1FE2, 0x0003, 0x03A5, 0x0308, 0x0300,
+	0x0003, 0x03C5, 0x0308, 0x0300, 0x0001, 0x1FE3, 0x0001, 0x1FE4, 0x0002, 0x03A1, 0x0313, 0x0002,
+	0x03C1, 0x0313, 0x0001, 0x1FE6, 0x0002, 0x03A5, 0x0342, 0x0002, 0x03C5, 0x0342, 0x0001, 0x1FE7,
+	0x0003, 0x03A5, 0x0308, 0x0342, 0x0003, 0x03C5, 0x0308, 0x0342, 0x0001, 0x1FF2, 0x0002, 0x1FFA,
+	0x0399, 0x0002, 0x1FFA, 0x0345, 0x0002, 0x1F7C, 0x03B9, 0x0001, 0x1FF3, 0x0002, 0x03A9, 0x0399,
+	0x0001, 0x1FFC, 0x0002, 0x03C9, 0x03B9, 0x0001, 0x1FF4, 0x0002, 0x038F, 0x0399, 0x0002, 0x038F,
+	0x0345, 0x0002, 0x03CE, 0x03B9, 0x0001, 0x1FF6, 0x0002, 0x03A9, 0x0342, 0x0002, 0x03C9, 0x0342,
+	0x0001, 0x1FF7, 0x0003, 0x03A9, 0x0342, 0x0399, 0x0003, 0x03A9, 0x0342, 0x0345, 0x0003, 0x03C9,
+	0x0342, 0x03B9, 0x0001, 0xFB00, 0x0002, 0x0046, 0x0046, 0x0002, 0x0046, 0x0066, 0x0002, 0x0066,
+	0x0066, 0x0001, 0xFB01, 0x0002, 0x0046, 0x0049, 0x0002, 0x0046, 0x0069, 0x0002, 0x0066, 0x0069,
+	0x0001, 0xFB02, 0x0002, 0x0046, 0x004C, 0x0002, 0x0046, 0x006C, 0x0002, 0x0066, 0x006C, 0x0001,
+	0xFB03, 0x0003, 0x0046, 0x0046, 0x0049, 0x0003, 0x0046, 0x0066, 0x0069, 0x0003, 0x0066, 0x0066,
+	0x0069, 0x0001, 0xFB04, 0x0003, 0x0046, 0x0046, 0x004C, 0x0003, 0x0046, 0x0066, 0x006C, 0x0003,
+	0x0066, 0x0066, 0x006C, 0x0001, 0xFB05, 0x0002, 0x0053, 0x0054, 0x0002, 0x0053, 0x0074, 0x0002,
+	0x0073, 0x0074, 0x0001, 0xFB06, 0x0001, 0xFB13, 0x0002, 0x0544, 0x0546, 0x0002, 0x0544, 0x0576,
+	0x0002, 0x0574, 0x0576, 0x0001, 0xFB14, 0x0002, 0x0544, 0x0535, 0x0002, 0x0544, 0x0565, 0x0002,
+	0x0574, 0x0565, 0x0001, 0xFB15, 0x0002, 0x0544, 0x053B, 0x0002, 0x0544, 0x056B, 0x0002, 0x0574,
+	0x056B, 0x0001, 0xFB16, 0x0002, 0x054E, 0x0546, 0x0002, 0x054E, 0x0576, 0x0002, 0x057E, 0x0576,
+	0x0001, 0xFB17, 0x0002, 0x0544, 0x053D, 0x0002, 0x0544, 0x056D, 0x0002, 0x0574, 0x056D,
+};
+
+// Collation value for the code point:
+//   0 - fully ignorable
+//   1 .. CollationImplicitValue - 1 - single element with primary key and common secondary
+//   CollationImplicitValue - no value in DUCET, implicit weights should be computed
+//   CollationExpansionFlag | offset - offset in s_collationExpansions: length, then elements
+//
+// Collation element is (primaryKey << 8) | secondaryRank, primary key is a rank of the DUCET
+// primary weight, or CollationImplicitBase + weight for implicit weights and U+FFFD
+static constexpr uint16_t CollationImplicitValue = 32767;
+static constexpr uint16_t CollationExpansionFlag = 32768;
+static constexpr uint16_t CollationDefaultValue = CollationImplicitValue;
+static constexpr uint32_t CollationImplicitBase = 65536;
+static constexpr uint32_t CollationCommonSecondary = 1;
+
+static constexpr uint32_t CollationChunkShift = 10;
+static constexpr uint32_t CollationBlockShift = 4;
+
+static constexpr uint8_t s_collationChunks[1088] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+	13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 17, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 18, 13, 13, 13, 13, 13, 13, 13, 13, 19, 20,
+	21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 13, 13, 31, 32, 13, 13,
+	13, 33, 13, 13, 13, 13, 13, 13, 13, 13, 34, 35, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 36, 13, 13, 37,
+	13, 13, 13, 13, 38, 39, 40, 13, 41, 13, 42, 43, 44, 45, 46, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 47, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	48, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+};
+
+static constexpr uint16_t s_collationBlocks[3136] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 11, 13,
+	14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+	30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+	46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+	62, 63, 64, 63, 64, 62, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+	75, 76, 77, 78, 79, 80, 81, 79, 82, 83, 1, 84, 85, 86, 87, 88,
+	89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+	105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+	121, 122, 123, 124, 125, 126, 127, 128, 128, 128, 129, 130, 131, 132, 133, 134,
+	135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150,
+	151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+	167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 157, 181,
+	182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+	198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 157, 212,
+	213, 214, 215, 216, 217, 218, 128, 128, 219, 220, 221, 222, 223, 224, 128, 128,
+	225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 128, 128,
+	239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+	255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+	271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+	287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+	303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+	319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+	335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+	351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 365,
+	366, 365, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+	381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+	397, 398, 399, 400, 401, 402, 403, 404, 365, 365, 405, 406, 407, 128, 128, 128,
+	408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
+	424, 425, 426, 427, 428, 429, 430, 431, 432, 252, 253, 433, 434, 1, 435, 436,
+	437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
+	453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+	469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+	485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 128, 497, 498, 499,
+	500, 501, 502, 503, 504, 505, 506, 506, 507, 508, 509, 510, 511, 512, 513, 514,
+	515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+	531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546,
+	547, 548, 549, 128, 550, 128, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560,
+	561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576,
+	577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592,
+	593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608,
+	609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624,
+	625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640,
+	641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656,
+	657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672,
+	673, 674, 675, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685,
+	249, 250, 251, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698,
+	699, 700, 701, 702, 703, 704, 128, 128, 705, 706, 707, 708, 709, 710, 711, 712,
+	713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 128, 727,
+	728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 733, 734, 735, 736, 739,
+	740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755,
+	756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771,
+	772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 788, 789, 790, 791,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807,
+	808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823,
+	824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839,
+	840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855,
+	856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871,
+	872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887,
+	888, 889, 890, 128, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902,
+	903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 128, 128, 916,
+	917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 365, 1, 930,
+	931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946,
+	947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962,
+	963, 964, 965, 966, 967, 968, 969, 297, 298, 299, 300, 301, 970, 971, 972, 365,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 973, 974, 975, 976, 977,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993,
+	994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 128, 128,
+	1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+	1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+	1040, 1041, 1042, 1043, 128, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 128, 128, 1052,
+	1, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+	1068, 3, 4, 5, 6, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
+	1080, 1081, 1082, 1083, 1084, 1085, 128, 128, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+	1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 128, 128, 1105, 1106, 1107,
+	128, 128, 128, 128, 128, 128, 128, 128, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
+	1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 128, 128,
+	1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 365, 1140, 1141, 1142, 1143, 1144,
+	1145, 1146, 1147, 1148, 1149, 1150, 1151, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+	1168, 1169, 1170, 1171, 1172, 1173, 1174, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 128, 128, 128, 1186, 1187,
+	1188, 1189, 1190, 1191, 128, 128, 128, 128, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
+	1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 128, 128, 1210, 1211, 1212, 1213,
+	1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 128, 128, 128, 128, 128,
+	1225, 1226, 1227, 1228, 1229, 128, 128, 128, 1230, 1231, 1232, 1233, 1230, 1231, 1232, 1234,
+	1235, 1236, 1237, 365, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 1238, 1239, 1240, 1241, 1242, 1243, 128, 128, 128, 128,
+	1244, 1245, 1246, 1247, 1248, 1249, 128, 128, 128, 128, 128, 1250, 1251, 128, 1252, 1253,
+	1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 365,
+	1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
+	1285, 1286, 1287, 1288, 128, 128, 128, 128, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 365,
+	1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 128, 128, 128, 128, 128, 128, 128, 128,
+	1304, 1305, 1306, 1307, 1308, 1309, 1310, 128, 1311, 1312, 1313, 1314, 1315, 365, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 1316, 1317, 1318, 1319, 1320, 1321, 128, 128,
+	1322, 1323, 1324, 1325, 1326, 365, 1327, 128, 1328, 1329, 1330, 1331, 365, 128, 128, 128,
+	1332, 1333, 1334, 1335, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1336, 1337, 1338, 1339, 128, 128, 128, 128, 128, 128, 1340, 1341, 1340, 1341, 1342, 1343,
+	1344, 1345, 1346, 1347, 1348, 365, 128, 128, 128, 128, 1349, 1350, 1351, 1352, 1353, 128,
+	1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 128, 1365, 1366, 1367, 1368,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1369, 1370, 1371, 1372, 1373, 227, 1374, 1375, 1376, 1377, 1378, 1379, 128, 128, 128, 128,
+	1380, 1381, 1382, 1383, 1384, 365, 1385, 1386, 1387, 1388, 365, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 1389, 1390,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 1391, 1392, 1393, 1394, 1395,
+	1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+	1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
+	1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443,
+	1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 128, 128, 128, 128, 128, 128,
+	1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+	1470, 1471, 1472, 1473, 1474, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490,
+	1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506,
+	1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522,
+	1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538,
+	1539, 1540, 1541, 1542, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558,
+	1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574,
+	1575, 1576, 1577, 1578, 1579, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595,
+	1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611,
+	1612, 1613, 1614, 1615, 1616, 1617, 1618, 128, 128, 128, 128, 128, 128, 1619, 1620, 1621,
+	1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 1631, 1632, 1631, 1632, 1633, 1634, 128, 128, 128, 128, 128, 128,
+	1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 128, 128, 128, 128, 1645, 1646,
+	1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662,
+	1663, 1664, 128, 128, 128, 1665, 1666, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693,
+	1694, 1695, 1696, 1697, 1698, 1699, 1700, 1, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 128,
+	1708, 1709, 1710, 1711, 1712, 128, 128, 128, 128, 128, 128, 128, 128, 128, 1713, 1714,
+	1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 128, 128, 128, 128, 128, 128, 128, 128,
+	558, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 558, 1723, 1724,
+	1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 557, 558, 1723, 1724, 1725, 1726, 1737,
+	1728, 1729, 1730, 1741, 1742, 1743, 557, 558, 1723, 1724, 1744, 1745, 1746, 1747, 1748, 1749,
+	1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1757, 1759, 1760, 1761, 1762, 1763, 1764,
+	1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780,
+	1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796,
+	1, 1, 1, 1797, 1, 1, 1798, 1799, 1800, 1801, 83, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1802, 1803, 1804, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1805, 1806, 1807, 1808, 1809, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 1810, 1811, 1812, 1813,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 128, 128,
+	1828, 1829, 1830, 1831, 1832, 1833, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 1834, 1835, 1836, 1837, 1838, 128, 128, 128, 128,
+	1839, 1840, 1841, 1842, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1852, 128, 128, 128, 1854,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+	1871, 1872, 1873, 558, 1874, 558, 1875, 558, 1876, 1877, 1878, 128, 128, 128, 1879, 1880,
+	1881, 1882, 1883, 1884, 1885, 1886, 1887, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+	1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919,
+	1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+	1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+	1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 128,
+	1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 128, 128, 128, 128,
+	1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
+	1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 128, 128,
+	2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 128, 128, 365,
+	2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+	2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+	2054, 2055, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	2056, 128, 1, 1, 1, 1, 1, 1, 128, 128, 128, 128, 128, 128, 128, 128,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+	128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+};
+
+static constexpr uint16_t s_collationData[32912] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 103, 285, 428, 7524, 429, 425, 278, 296, 297, 417, 1126, 35, 13, 126, 422,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 64, 58, 1130, 1131, 1132, 109,
+	416, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7762,
+	7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 298, 423, 299, 695, 11,
+	692, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7762,
+	7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 300, 1134, 301, 1136, 0,
+	0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 104, 7523, 7525, 7522, 7526, 1135, 410, 699, 978, 7586, 294, 1133, 0, 980, 696,
+	810, 1127, 7578, 7579, 693, 8001, 412, 147, 702, 7577, 7762, 295, 32768, 32772, 32776, 110,
+	32780, 32783, 32786, 32789, 32792, 32795, 32798, 32802, 32805, 32808, 32811, 32814, 32817, 32820, 32823, 32826,
+	32829, 32832, 32835, 32838, 32841, 32844, 32847, 1129, 32850, 32853, 32856, 32859, 32862, 32865, 7938, 32868,
+	32829, 32832, 32835, 32838, 32841, 32844, 32847, 1128, 32850, 32853, 32856, 32859, 32862, 32865, 7938, 32872,
+	32875, 32875, 32878, 32878, 32881, 32881, 32884, 32884, 32887, 32887, 32890, 32890, 32893, 32893, 32896, 32896,
+	32899, 32899, 32902, 32902, 32905, 32905, 32908, 32908, 32911, 32911, 32914, 32914, 32917, 32917, 32920, 32920,
+	32923, 32923, 32926, 32926, 32929, 32929, 32932, 32932, 32935, 32935, 32938, 32938, 32941, 32941, 32944, 32944,
+	32947, 7690, 32950, 32950, 32953, 32953, 32956, 32956, 7809, 32959, 32959, 32962, 32962, 32965, 32965, 32968,
+	32968, 32971, 32971, 32974, 32974, 32977, 32977, 32980, 32980, 32983, 7760, 7760, 32986, 32986, 32989, 32989,
+	32992, 32992, 32995, 32995, 32999, 32999, 33002, 33002, 33005, 33005, 33008, 33008, 33011, 33011, 33014, 33014,
+	33017, 33017, 33020, 33020, 33023, 33023, 7858, 7858, 33026, 33026, 33029, 33029, 33032, 33032, 33035, 33035,
+	33038, 33038, 33041, 33041, 33044, 33044, 33047, 33047, 32872, 33050, 33050, 33053, 33053, 33056, 33056, 33059,
+	7602, 7608, 7609, 7609, 7956, 7956, 7775, 7616, 7616, 7626, 7627, 7629, 7629, 33062, 7641, 7643,
+	7645, 7662, 7662, 7671, 7675, 7679, 7699, 7695, 7711, 7711, 7722, 7736, 7885, 7752, 7753, 7785,
+	33065, 33065, 7676, 7676, 7797, 7797, 7812, 7954, 7954, 7849, 7852, 7861, 7862, 7862, 7863, 33068,
+	33068, 7889, 7895, 7917, 7917, 7923, 7923, 7932, 7934, 7934, 7936, 7950, 7955, 7955, 33071, 7941,
+	7975, 7976, 7977, 7978, 33074, 33074, 33074, 33078, 33078, 33078, 33081, 33081, 33081, 33084, 33084, 33087,
+	33087, 33090, 33090, 33093, 33093, 33096, 33096, 33100, 33100, 33104, 33104, 33108, 33108, 7641, 33112, 33112,
+	33116, 33116, 33120, 33120, 7669, 7669, 33125, 33125, 33128, 33128, 33131, 33131, 33134, 33134, 33138, 33138,
+	33141, 33144, 33144, 33144, 33147, 33147, 7679, 7941, 33150, 33150, 33153, 33153, 33157, 33157, 33162, 33162,
+	33166, 33166, 33169, 33169, 33172, 33172, 33175, 33175, 33178, 33178, 33181, 33181, 33184, 33184, 33187, 33187,
+	33190, 33190, 33193, 33193, 33196, 33196, 33199, 33199, 33202, 33202, 33205, 33205, 7920, 7920, 33208, 33208,
+	7753, 7630, 7789, 7789, 7926, 7926, 33211, 33211, 33214, 33214, 33217, 33217, 33221, 33221, 33225, 33225,
+	33228, 33228, 33232, 33232, 7732, 7757, 7864, 7702, 33235, 33238, 7588, 7613, 7613, 7722, 7859, 7846,
+	7929, 7958, 7958, 7602, 7875, 7899, 7637, 7637, 7704, 7704, 7808, 7808, 7816, 7816, 7916, 7916,
+	7594, 7595, 7598, 7608, 7775, 7617, 7626, 7627, 7647, 7643, 7648, 7645, 7649, 7652, 7653, 7706,
+	7671, 7666, 7668, 7675, 7655, 7882, 7681, 7686, 7695, 7699, 7691, 7724, 7727, 7730, 7734, 7885,
+	7888, 7742, 7752, 7756, 7748, 7785, 7766, 7787, 7801, 7818, 7820, 7822, 7824, 7825, 7827, 7829,
+	7812, 7835, 7845, 7849, 7707, 7853, 7855, 7866, 7863, 7875, 7889, 7895, 7899, 7904, 7737, 7915,
+	7927, 7928, 7932, 7937, 7957, 7966, 7974, 7979, 7980, 7601, 7654, 7672, 7678, 7705, 7716, 7718,
+	7807, 7972, 7973, 33144, 33241, 33244, 33071, 33247, 33250, 33253, 33256, 33259, 7981, 7982, 7883, 7884,
+	7677, 7681, 7701, 7810, 7818, 7822, 7835, 7900, 7914, 709, 711, 7687, 7960, 7688, 7962, 7967,
+	7959, 7968, 712, 713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725,
+	7494, 7495, 726, 727, 728, 729, 732, 733, 697, 698, 700, 703, 694, 701, 734, 735,
+	7675, 7717, 7840, 7905, 7966, 736, 737, 738, 739, 740, 741, 742, 743, 744, 7961, 745,
+	746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761,
+	33262, 33264, 33266, 33268, 33270, 33272, 33274, 33276, 33278, 33280, 33282, 33284, 33286, 33288, 33288, 33290,
+	33292, 33294, 33288, 33296, 33298, 33288, 33300, 33300, 33300, 33300, 33288, 33302, 33300, 33300, 33300, 33300,
+	33300, 33304, 33306, 33308, 33310, 33312, 33314, 33316, 33318, 33300, 33300, 33300, 33300, 33320, 33322, 33300,
+	33324, 33326, 33328, 33300, 33330, 33332, 33334, 33334, 33336, 33338, 33300, 33300, 33300, 33288, 33288, 33288,
+	33262, 33264, 33340, 33296, 33342, 33345, 33288, 33300, 33300, 33300, 33288, 33288, 33288, 33300, 33300, 0,
+	33288, 33288, 33288, 33300, 33300, 33300, 33300, 33288, 33347, 33300, 33300, 33288, 33300, 33288, 33288, 33300,
+	33349, 33351, 33300, 7586, 7633, 7689, 7762, 7867, 7611, 7620, 7677, 7738, 7810, 7856, 7891, 7905,
+	7993, 7993, 8026, 8026, 709, 710, 7990, 7990, 32767, 32767, 7996, 8015, 8014, 8016, 58, 7997,
+	32767, 32767, 32767, 32767, 693, 33353, 33356, 147, 33359, 33362, 33365, 32767, 33368, 32767, 33371, 33374,
+	33377, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003, 8004,
+	8005, 8010, 32767, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 33381, 33384, 33356, 33359, 33362, 33365,
+	33387, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003, 8004,
+	8005, 8010, 8013, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 33381, 33384, 33368, 33371, 33374, 33391,
+	7984, 7995, 8018, 33371, 33384, 8019, 8005, 33391, 8009, 8009, 7991, 7991, 7989, 7989, 8008, 8008,
+	8025, 8025, 8059, 8059, 8064, 8064, 8065, 8065, 8068, 8068, 8075, 8075, 8078, 8078, 8082, 8082,
+	7998, 8010, 8013, 7997, 7995, 7988, 1121, 8027, 8027, 8013, 8007, 8007, 8012, 8015, 8014, 8016,
+	33395, 33398, 8101, 33401, 8106, 8116, 8124, 33404, 8127, 8143, 8157, 8176, 33407, 33410, 33413, 8209,
+	8088, 8091, 8092, 8093, 8098, 8105, 8107, 8111, 8122, 8126, 8129, 8137, 8147, 8150, 8159, 8161,
+	8165, 8168, 8171, 8177, 8182, 8183, 8195, 8200, 8210, 8212, 8216, 8218, 8219, 8223, 8224, 8227,
+	8190, 8190, 8221, 8221, 8229, 8229, 8230, 8230, 8234, 8234, 8232, 8232, 8236, 8236, 8237, 8237,
+	8238, 8238, 8239, 8239, 8240, 8240, 33416, 33416, 8181, 8181, 8194, 8194, 8193, 8193, 8191, 8191,
+	8164, 8164, 811, 33419, 33288, 33298, 33296, 33288, 0, 0, 8123, 8123, 8220, 8220, 8166, 8166,
+	33421, 33421, 8094, 8094, 8096, 8096, 8110, 8110, 8104, 8104, 8130, 8130, 8134, 8134, 8133, 8133,
+	8132, 8132, 8153, 8153, 8156, 8156, 8163, 8163, 8242, 8242, 8170, 8170, 8174, 8174, 8178, 8178,
+	8179, 8179, 8186, 8186, 8198, 8198, 8203, 8203, 8205, 8205, 8187, 8187, 8207, 8207, 8208, 8208,
+	8244, 33424, 33424, 8131, 8131, 8139, 8139, 8154, 8154, 8152, 8152, 8204, 8204, 8148, 8148, 8244,
+	33427, 33427, 33430, 33430, 8090, 8090, 33433, 33433, 8089, 8089, 33436, 33436, 33439, 33439, 33442, 33442,
+	8118, 8118, 33445, 33445, 33448, 33448, 33451, 33451, 8160, 8160, 33454, 33454, 33457, 33457, 33460, 33460,
+	33463, 33463, 33466, 33466, 33469, 33469, 8097, 8097, 33472, 33472, 8095, 8095, 8184, 8184, 8185, 8185,
+	8099, 8099, 8103, 8103, 8113, 8113, 8120, 8120, 8145, 8145, 8158, 8158, 8169, 8169, 8173, 8173,
+	8114, 8114, 8141, 8141, 8146, 8146, 8167, 8167, 8228, 8228, 8136, 8136, 8243, 8243, 8135, 8135,
+	8142, 8142, 8155, 8155, 8162, 8162, 8188, 8188, 8151, 8151, 8108, 8108, 8201, 8201, 8140, 8140,
+	32767, 8416, 8418, 8419, 8420, 8421, 8422, 8423, 8424, 8425, 8426, 8427, 8428, 8429, 8430, 8431,
+	8432, 8433, 8434, 8435, 8436, 8437, 8439, 8440, 8441, 8442, 8443, 8444, 8445, 8446, 8447, 8448,
+	8449, 8450, 8451, 8452, 8453, 8454, 8455, 32767, 32767, 8456, 484, 485, 105, 42, 112, 486,
+	8417, 8416, 8418, 8419, 8420, 8421, 8422, 8423, 8424, 8425, 8426, 8427, 8428, 8429, 8430, 8431,
+	8449, 8450, 8451, 8452, 8453, 8454, 8455, 33475, 8438, 65, 14, 32767, 32767, 812, 813, 7527,
+	32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	33478, 33480, 33482, 33484, 33486, 33488, 33490, 33492, 33494, 33496, 33496, 33498, 33500, 0, 487, 33502,
+	488, 33504, 33506, 489, 0, 0, 490, 33494, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	8457, 8458, 8459, 8460, 8461, 8462, 8463, 8464, 8465, 8466, 8467, 8467, 8468, 8469, 8469, 8470,
+	8470, 8471, 8472, 8473, 8473, 8474, 8474, 8475, 8476, 8477, 8478, 32767, 32767, 32767, 32767, 33508,
+	33513, 33516, 33519, 491, 492, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	0, 0, 0, 0, 0, 0, 1149, 1151, 814, 432, 434, 7528, 43, 44, 817, 818,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 32767, 66, 113,
+	8747, 8527, 8528, 8529, 8532, 8533, 8537, 8541, 8543, 8559, 8560, 8561, 8570, 8580, 8581, 8591,
+	8592, 8606, 8607, 8625, 8626, 8636, 8637, 8642, 8643, 8646, 8647, 8690, 8691, 8744, 8745, 8746,
+	0, 8655, 8667, 8673, 8695, 8703, 8707, 8717, 8723, 8737, 8738, 33522, 33524, 33526, 33528, 33530,
+	33532, 33534, 33536, 33538, 33540, 33542, 33544, 33546, 33548, 33550, 33552, 33554, 33556, 33558, 33560, 33562,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 430, 45, 46, 420, 8542, 8666,
+	33564, 8531, 8530, 8534, 8527, 33566, 33569, 33572, 33575, 8562, 8563, 8544, 8564, 8565, 8545, 8566,
+	8546, 8582, 8583, 8571, 8572, 8584, 8573, 8575, 8593, 8594, 8595, 8596, 8597, 8598, 8600, 8601,
+	8602, 8608, 8609, 8610, 8611, 8612, 8613, 8614, 8615, 8616, 8627, 8628, 8629, 8638, 8640, 8644,
+	8648, 8656, 8657, 8659, 8660, 8662, 8663, 8668, 8670, 8674, 8675, 8676, 8677, 8679, 8680, 8682,
+	8684, 8685, 8686, 8687, 8688, 8696, 8697, 8698, 8699, 8713, 8708, 8710, 8711, 8712, 8718, 8574,
+	33578, 8719, 33581, 8720, 8724, 8725, 8726, 8727, 8728, 8729, 8730, 8731, 8739, 8740, 8741, 8733,
+	8742, 8743, 8752, 33584, 128, 8722, 0, 0, 0, 0, 0, 0, 0, 0, 819, 0,
+	0, 0, 0, 0, 0, 8723, 8738, 0, 0, 820, 0, 0, 0, 0, 8603, 8617,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 8630, 8641, 8650, 33587, 33590, 8721,
+	205, 129, 130, 67, 68, 69, 70, 71, 72, 114, 493, 494, 495, 496, 32767, 0,
+	8755, 33593, 8756, 8757, 33595, 8759, 8758, 8760, 8761, 8762, 8764, 8765, 33598, 8766, 8767, 8768,
+	8770, 8771, 8772, 8773, 8773, 8774, 8775, 33601, 8777, 8778, 8779, 8780, 8781, 33604, 33607, 33610,
+	33613, 33615, 33617, 33619, 33621, 33623, 33625, 33627, 33629, 33631, 33633, 33635, 33637, 33639, 33641, 33643,
+	0, 33288, 33300, 0, 0, 33288, 33300, 0, 0, 0, 0, 32767, 32767, 8763, 8769, 8776,
+	8547, 8548, 8549, 8550, 8551, 8552, 8554, 8585, 8586, 8604, 8605, 8618, 8631, 8651, 8652, 8653,
+	8664, 8665, 8689, 8692, 8693, 8704, 8705, 8714, 8715, 8716, 8700, 8619, 8620, 8632, 8587, 8588,
+	8633, 8621, 8589, 8535, 8536, 8748, 8749, 8750, 8734, 8735, 8753, 8754, 8590, 8634, 8635, 8678,
+	8818, 8821, 8822, 8823, 8825, 8826, 8827, 8828, 8831, 8833, 8834, 8835, 8837, 8841, 8842, 8844,
+	8845, 8849, 8850, 8851, 8852, 8853, 8854, 8855, 8838, 8819, 8820, 8836, 8824, 8846, 8847, 8848,
+	8839, 8840, 8829, 8830, 8843, 8832, 8857, 8858, 8859, 8860, 8861, 8862, 8863, 8864, 8865, 8866,
+	8867, 8856, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 8868, 8869, 8870, 8871, 8872, 8873,
+	8874, 8875, 8876, 8877, 8878, 8879, 8880, 8881, 8882, 8883, 8884, 8885, 8886, 8887, 8888, 8889,
+	8890, 8891, 8892, 8893, 8894, 8895, 8896, 8897, 33645, 33648, 33651, 33654, 33656, 33658, 33660, 33662,
+	33664, 33666, 33668, 33670, 8898, 8899, 838, 206, 47, 106, 0, 32767, 32767, 33300, 7529, 7530,
+	8501, 8502, 8503, 8504, 8505, 8506, 8507, 8508, 8509, 8510, 8511, 8512, 8513, 8514, 8515, 8516,
+	8517, 8518, 8519, 8520, 8521, 8522, 8523, 8524, 33672, 33674, 8525, 8526, 33676, 33676, 33678, 33678,
+	33678, 33680, 33680, 33680, 33682, 33682, 33684, 33684, 33686, 33686, 33686, 33688, 33690, 33692, 32767, 32767,
+	73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 32767,
+	8793, 8794, 8795, 8796, 8797, 8798, 8799, 8800, 8801, 8802, 8803, 8804, 8805, 8806, 8807, 8808,
+	8809, 8810, 8811, 8812, 8813, 8814, 8815, 8816, 8817, 33300, 33300, 33300, 32767, 32767, 497, 32767,
+	8782, 8783, 8784, 8785, 8786, 8787, 8788, 8789, 8790, 8791, 8792, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	8553, 8556, 8576, 8645, 8661, 8672, 8701, 8706, 8538, 8539, 8622, 8736, 8540, 8541, 8599, 8639,
+	8683, 8732, 8623, 8654, 8681, 32767, 8557, 8558, 8567, 8624, 8751, 8658, 8669, 8709, 8555, 8568,
+	8569, 8577, 8694, 8649, 8671, 8578, 8579, 8702, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 33694, 33696, 33698, 33700, 33702, 33704, 33706, 0, 0, 0, 0, 0, 0,
+	33708, 33710, 33712, 0, 33714, 33716, 33718, 33720, 33722, 33724, 33726, 33728, 33730, 33732, 33734, 33736,
+	33738, 33738, 33740, 33742, 9413, 9414, 9415, 9421, 9422, 9423, 9424, 9425, 9427, 9429, 9430, 9431,
+	9432, 9434, 9435, 9436, 9437, 9438, 9439, 9440, 9442, 9443, 9444, 9445, 9446, 9449, 9450, 9451,
+	9452, 9454, 9456, 9457, 9458, 9459, 9460, 9461, 9462, 33744, 9463, 9464, 9465, 9467, 9468, 9469,
+	9471, 33747, 9472, 9473, 33750, 9474, 9475, 9476, 9477, 9478, 9487, 9488, 33753, 9479, 9486, 9492,
+	9493, 9494, 9495, 9496, 9497, 9500, 9502, 9503, 9505, 9507, 9508, 9509, 9510, 9511, 9504, 9489,
+	9410, 0, 0, 33262, 33264, 9501, 9490, 9491, 33755, 33758, 33761, 33764, 33767, 33770, 33773, 33776,
+	9426, 9428, 9498, 9499, 150, 151, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	512, 7496, 9412, 9416, 9417, 9418, 9419, 9420, 9453, 9447, 9470, 9441, 9448, 9480, 9455, 9466,
+	9512, 33738, 33740, 33742, 32767, 9513, 9514, 9515, 9516, 9517, 9518, 9519, 9521, 32767, 32767, 9523,
+	9524, 32767, 32767, 9525, 9526, 9527, 9528, 9529, 9530, 9531, 9532, 9533, 9534, 9535, 9536, 9537,
+	9538, 9539, 9540, 9541, 9542, 9543, 9544, 9545, 9546, 32767, 9547, 9548, 9549, 9550, 9551, 9552,
+	9553, 32767, 9555, 32767, 32767, 32767, 9557, 9558, 9559, 9560, 32767, 32767, 33753, 9561, 9562, 9563,
+	9564, 9565, 9566, 9567, 9568, 32767, 32767, 9571, 9572, 32767, 32767, 9573, 9574, 9575, 33779, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 9576, 32767, 32767, 32767, 32767, 33782, 33785, 32767, 33788,
+	9520, 9522, 9569, 9570, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	9554, 9556, 7531, 7532, 6998, 6999, 7000, 7001, 7002, 7003, 839, 7533, 9577, 517, 33791, 32767,
+	32767, 33738, 33740, 33742, 32767, 9583, 9584, 9588, 9589, 9580, 9581, 32767, 32767, 32767, 32767, 9590,
+	9585, 32767, 32767, 9582, 9586, 9594, 9595, 9596, 9597, 9598, 9599, 9600, 9601, 9602, 9603, 9604,
+	9605, 9606, 9607, 9608, 9609, 9610, 9611, 9612, 9613, 32767, 9614, 9615, 9616, 9617, 9618, 9619,
+	9621, 32767, 9622, 33793, 32767, 9623, 33796, 32767, 9591, 9592, 32767, 32767, 33753, 32767, 9625, 9626,
+	9627, 9628, 9629, 32767, 32767, 32767, 32767, 9630, 9631, 32767, 32767, 9632, 9633, 9634, 32767, 32767,
+	32767, 9593, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 33799, 33802, 33805, 9624, 32767, 33808, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	33811, 33813, 9587, 9579, 9578, 9620, 518, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 33738, 33740, 33742, 32767, 9636, 9637, 9638, 9639, 9640, 9641, 9642, 9644, 9646, 32767, 9647,
+	9648, 9649, 32767, 9650, 9651, 9652, 9653, 9654, 9655, 9656, 9657, 9658, 9659, 9661, 9662, 9663,
+	9664, 9665, 9666, 9667, 9668, 9669, 9670, 9671, 9672, 32767, 9673, 9674, 9675, 9676, 9677, 9678,
+	9679, 32767, 9680, 9686, 32767, 9681, 9682, 9683, 9684, 9685, 32767, 32767, 33753, 9687, 9688, 9689,
+	9690, 9691, 9692, 9693, 9694, 9697, 32767, 9698, 9699, 9700, 32767, 9701, 9702, 9703, 32767, 32767,
+	9635, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	9643, 9645, 9695, 9696, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	519, 7534, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 9660, 33536, 33534, 33538, 33753, 33753, 33753,
+	32767, 33738, 33740, 33742, 32767, 9704, 9705, 9706, 9707, 9708, 9709, 9710, 9712, 32767, 32767, 9714,
+	9715, 32767, 32767, 9716, 9717, 9718, 9719, 9720, 9721, 9722, 9723, 9724, 9725, 9726, 9727, 9728,
+	9729, 9730, 9731, 9732, 9733, 9734, 9735, 9736, 9737, 32767, 9738, 9739, 9740, 9741, 9742, 9743,
+	9745, 32767, 9746, 9747, 32767, 9748, 9750, 9751, 9752, 9753, 32767, 32767, 33753, 9754, 9755, 9756,
+	9757, 9758, 9759, 9760, 9761, 32767, 32767, 9764, 9765, 32767, 32767, 9766, 9767, 9768, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 33288, 9769, 9770, 32767, 32767, 32767, 32767, 33815, 33818, 32767, 9744,
+	9711, 9713, 9762, 9763, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	840, 9749, 7004, 7005, 7006, 7007, 7008, 7009, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 33740, 9784, 32767, 9772, 9773, 9774, 9775, 9776, 9777, 32767, 32767, 32767, 9778, 9779,
+	9780, 32767, 9781, 9782, 9783, 9785, 32767, 32767, 32767, 9786, 9787, 32767, 9803, 32767, 9788, 9789,
+	32767, 32767, 32767, 9790, 9791, 32767, 32767, 32767, 9792, 9802, 9793, 32767, 32767, 32767, 9794, 9795,
+	9796, 9801, 9797, 9800, 9799, 9798, 9804, 9805, 9806, 9807, 32767, 32767, 32767, 32767, 9808, 9809,
+	9810, 9811, 9812, 32767, 32767, 32767, 9813, 9814, 9815, 32767, 9816, 9817, 9818, 9819, 32767, 32767,
+	9771, 32767, 32767, 32767, 32767, 32767, 32767, 9820, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7016, 7017, 7018, 841, 842, 843, 844, 845, 846, 7536, 847, 32767, 32767, 32767, 32767, 32767,
+	33738, 33738, 33740, 33742, 33740, 9821, 9822, 9823, 9824, 9825, 9826, 9827, 9829, 32767, 9831, 9832,
+	9833, 32767, 9834, 9835, 9836, 9837, 9838, 9839, 9840, 9841, 9842, 9844, 9845, 9847, 9848, 9849,
+	9850, 9851, 9852, 9853, 9854, 9855, 9856, 9857, 9858, 32767, 9859, 9860, 9861, 9862, 9863, 9864,
+	9865, 9866, 9867, 9873, 9874, 9868, 9869, 9870, 9871, 9872, 32767, 32767, 32767, 9876, 9877, 9878,
+	9879, 9880, 9881, 9882, 9883, 32767, 9886, 9887, 9888, 32767, 9889, 9890, 9891, 9892, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 9893, 9894, 32767, 9843, 9846, 9875, 32767, 32767, 32767, 32767, 32767,
+	9828, 9830, 9884, 9885, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 520, 7576, 7577, 7578, 7579, 7577, 7578, 7579, 873,
+	9950, 33738, 33740, 33742, 521, 9895, 9896, 9897, 9898, 9899, 9900, 9901, 9903, 32767, 9905, 9906,
+	9907, 32767, 9908, 9909, 9910, 9911, 9912, 9913, 9914, 9915, 9916, 9917, 9918, 9919, 9920, 9921,
+	9922, 9923, 9924, 9925, 9926, 9927, 9928, 9929, 9930, 32767, 9931, 9932, 9933, 9934, 9935, 9936,
+	9937, 9938, 9939, 9945, 32767, 9940, 9941, 9942, 9943, 9944, 32767, 32767, 33753, 9947, 9951, 9952,
+	9953, 9954, 9955, 9956, 9957, 32767, 9960, 9961, 9962, 32767, 9963, 9964, 9965, 9966, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 9967, 9968, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 9946, 32767,
+	9902, 9904, 9958, 9959, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	32767, 9948, 9949, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	33740, 33738, 33740, 33742, 10025, 9969, 9970, 9971, 9972, 9974, 9975, 9976, 9978, 32767, 9980, 9981,
+	9982, 32767, 9983, 9984, 9985, 9986, 9987, 9988, 9989, 9990, 9991, 9992, 9993, 9994, 9995, 9996,
+	9997, 9998, 9999, 10000, 10001, 10002, 10003, 10004, 10005, 10006, 10007, 10008, 10009, 10010, 10011, 10012,
+	10013, 10022, 10014, 10020, 10021, 10015, 10016, 10017, 10018, 10019, 10023, 10042, 10042, 10024, 10026, 10027,
+	10028, 10029, 10030, 10031, 10032, 32767, 10035, 10036, 10037, 32767, 10038, 10039, 10040, 10042, 33821, 874,
+	32767, 32767, 32767, 32767, 33824, 33827, 33830, 10041, 7040, 7041, 7042, 7043, 7044, 7045, 7046, 9973,
+	9977, 9979, 10033, 10034, 32767, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	7047, 7048, 7049, 7050, 7051, 7052, 7053, 7054, 7055, 875, 33833, 33836, 33821, 33839, 33842, 33845,
+	32767, 33738, 33740, 33742, 32767, 10043, 10044, 10045, 10046, 10047, 10048, 10049, 10050, 10051, 10052, 10053,
+	10054, 10055, 10056, 10057, 10058, 10059, 10060, 32767, 32767, 32767, 10061, 10062, 10063, 10064, 10065, 10066,
+	10067, 10068, 10069, 10070, 10071, 10072, 10073, 10074, 10075, 10076, 10077, 10078, 10079, 10080, 10081, 10082,
+	10083, 10084, 32767, 10085, 10086, 10087, 10088, 10089, 10090, 10091, 10092, 10093, 32767, 10094, 32767, 32767,
+	10095, 10096, 10097, 10098, 10099, 10100, 10101, 32767, 32767, 32767, 10119, 32767, 32767, 32767, 32767, 10102,
+	10103, 10104, 10105, 10106, 10107, 32767, 10108, 32767, 10109, 10113, 10114, 10115, 10116, 10117, 10118, 10111,
+	32767, 32767, 10110, 10112, 522, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 11522, 11523, 11524, 11525, 11526, 11527, 11528, 11529, 11530, 11531, 11532, 11533, 11534, 11535, 11536,
+	11537, 11538, 11539, 11540, 11541, 11542, 11543, 11544, 11545, 11546, 11547, 11548, 11549, 11550, 11551, 11552,
+	11553, 11554, 11555, 11556, 11557, 11558, 11559, 11560, 11561, 11562, 11563, 11564, 11565, 11566, 11567, 11568,
+	11569, 11570, 11571, 11572, 11573, 11574, 11575, 11576, 11577, 11578, 11579, 32767, 32767, 32767, 32767, 7541,
+	11580, 11581, 11582, 11583, 11584, 11585, 7497, 33848, 33850, 33852, 33854, 33856, 33858, 33860, 33862, 523,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 524, 525, 32767, 32767, 32767, 32767,
+	32767, 11587, 11588, 32767, 11589, 32767, 11590, 11591, 11592, 11593, 11595, 32767, 11596, 11599, 11597, 11600,
+	11601, 11602, 11603, 11604, 11605, 11606, 11607, 11608, 11609, 11610, 11611, 11612, 11613, 11614, 11615, 11616,
+	11617, 11618, 11619, 11620, 32767, 11621, 32767, 11622, 11623, 11624, 11594, 11625, 11626, 11627, 11628, 11629,
+	11630, 11631, 11632, 11633, 11634, 11635, 11636, 11637, 11638, 11639, 11640, 11641, 11642, 11643, 32767, 32767,
+	11644, 11645, 11646, 11647, 11648, 32767, 7498, 32767, 33864, 33866, 33868, 33870, 33872, 33874, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 33876, 33879, 11586, 11598,
+	33882, 883, 884, 885, 528, 529, 530, 531, 532, 533, 534, 537, 537, 538, 539, 540,
+	541, 542, 543, 886, 95, 887, 888, 889, 0, 0, 890, 891, 892, 893, 894, 895,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7577, 7578, 7579, 7580, 7581, 7582,
+	7583, 7584, 7585, 7576, 896, 0, 897, 0, 898, 33886, 302, 303, 304, 305, 0, 0,
+	11716, 11719, 11721, 33888, 11723, 11725, 11727, 11729, 32767, 11731, 11733, 11735, 11737, 33891, 11739, 11741,
+	11743, 11745, 33894, 11747, 11749, 11751, 11753, 33897, 11755, 11757, 11759, 11761, 33900, 11763, 11765, 11767,
+	11769, 11771, 11773, 11776, 11778, 11780, 11782, 11784, 11786, 33903, 33906, 11718, 11775, 32767, 32767, 32767,
+	32767, 11796, 11797, 11798, 11801, 11802, 11803, 11804, 11805, 11806, 11807, 11808, 11809, 11810, 33740, 33742,
+	11799, 11800, 0, 0, 11811, 544, 0, 0, 11788, 11790, 11794, 11795, 11792, 11789, 11791, 11793,
+	11717, 11720, 11722, 33909, 11724, 11726, 11728, 11730, 32767, 11732, 11734, 11736, 11738, 33912, 11740, 11742,
+	11744, 11746, 33915, 11748, 11750, 11752, 11754, 33918, 11756, 11758, 11760, 11762, 33921, 11764, 11766, 11768,
+	11770, 11772, 11774, 11777, 11779, 11781, 11783, 11785, 11787, 33924, 33927, 33930, 33933, 32767, 899, 900,
+	901, 902, 903, 904, 905, 906, 0, 907, 908, 909, 910, 911, 912, 32767, 913, 914,
+	535, 536, 545, 546, 547, 915, 916, 917, 918, 548, 549, 32767, 32767, 32767, 32767, 32767,
+	12375, 12377, 12379, 12383, 12386, 12388, 12391, 12395, 12400, 12407, 12411, 12412, 12414, 12416, 12419, 12422,
+	12426, 12427, 12428, 12431, 12434, 12438, 12439, 12445, 12448, 12451, 12453, 12455, 12459, 12461, 12468, 12470,
+	12476, 12483, 12484, 12485, 12486, 12487, 12488, 12493, 12494, 12495, 12496, 12497, 12497, 12501, 12503, 12505,
+	12508, 12513, 12517, 12504, 12519, 12515, 33740, 33936, 33742, 12525, 12526, 12454, 12458, 12462, 12473, 33938,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 161, 162, 571, 572, 573, 574,
+	12465, 12466, 12489, 12490, 12491, 12492, 12509, 12510, 12511, 12512, 12387, 12401, 12478, 12479, 12437, 12452,
+	12460, 12405, 12520, 12527, 12528, 12467, 12482, 12521, 12522, 12529, 12530, 12531, 12532, 12533, 12423, 12480,
+	12481, 12502, 12499, 12506, 12507, 12376, 12378, 12380, 12389, 12398, 12408, 12429, 12435, 12440, 12441, 12446,
+	12464, 12471, 12463, 12498, 12514, 12516, 12524, 12534, 12536, 12539, 12540, 12535, 12537, 12538, 12443, 12541,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 12542, 12543, 12500, 12518, 921, 922,
+	8331, 8333, 8335, 8337, 8339, 8341, 8343, 8347, 8349, 8351, 8353, 8355, 8357, 8361, 8363, 8365,
+	8367, 8369, 8371, 8375, 8377, 8379, 8381, 8383, 8385, 8387, 8389, 8391, 8393, 8395, 8397, 8401,
+	8403, 8345, 8359, 8373, 8399, 8405, 32767, 8408, 32767, 32767, 32767, 32767, 32767, 8413, 32767, 32767,
+	8330, 8332, 8334, 8336, 8338, 8340, 8342, 8346, 8348, 8350, 8352, 8354, 8356, 8360, 8362, 8364,
+	8366, 8368, 8370, 8374, 8376, 8378, 8380, 8382, 8384, 8386, 8388, 8390, 8392, 8394, 8396, 8400,
+	8402, 8344, 8358, 8372, 8398, 8404, 8406, 8407, 8409, 8410, 8411, 207, 8356, 8412, 8414, 8415,
+	15456, 15457, 15458, 15459, 15460, 15461, 15462, 15463, 15464, 15465, 15466, 15467, 15468, 15469, 15470, 15471,
+	15472, 15473, 15474, 15475, 15476, 15477, 15478, 15479, 15480, 15481, 15482, 15483, 15484, 15485, 15486, 15487,
+	15488, 15489, 15490, 15491, 15492, 15493, 15494, 15495, 15496, 15497, 15498, 15499, 15500, 15501, 15502, 15503,
+	15504, 15505, 15506, 15507, 15508, 15509, 15510, 15511, 15512, 15513, 15514, 15515, 15516, 15517, 15518, 15519,
+	15520, 15521, 15522, 15523, 15524, 15525, 15526, 15527, 15528, 15529, 15530, 15531, 15532, 15533, 15534, 15535,
+	15536, 15537, 15538, 15539, 15540, 15541, 15542, 15543, 15544, 15545, 15546, 15547, 15548, 15549, 15550, 15580,
+	15581, 15582, 15583, 15584, 15585, 15586, 15587, 15588, 15589, 15590, 15591, 15592, 15593, 15594, 15595, 15596,
+	15597, 15598, 15599, 15600, 15601, 15602, 15603, 15604, 15605, 15606, 15607, 15608, 15609, 15610, 15611, 15612,
+	15613, 15614, 15615, 15616, 15617, 15618, 15619, 15620, 15621, 15622, 15623, 15624, 15625, 15626, 15627, 15628,
+	15629, 15630, 15631, 15632, 15633, 15634, 15635, 15636, 15637, 15638, 15639, 15640, 15641, 15642, 15643, 15644,
+	15645, 15646, 15647, 15648, 15649, 15650, 15651, 15652, 15676, 15677, 15678, 15679, 15680, 15681, 15682, 15683,
+	15684, 15685, 15686, 15687, 15688, 15689, 15690, 15691, 15692, 15693, 15694, 15695, 15696, 15697, 15698, 15699,
+	15700, 15701, 15702, 15703, 15704, 15705, 15706, 15707, 15708, 15709, 15710, 15711, 15712, 15713, 15714, 15715,
+	15716, 15717, 15718, 15719, 15720, 15721, 15722, 15723, 15724, 15725, 15726, 15727, 15728, 15729, 15730, 15731,
+	15732, 15733, 15734, 15735, 15736, 15737, 15738, 15739, 15740, 15741, 15742, 15743, 15744, 15745, 15746, 15747,
+	15748, 15749, 15750, 15751, 15752, 15753, 15754, 15755, 15756, 15757, 15758, 15759, 15760, 15761, 15762, 15763,
+	8957, 8958, 8959, 8960, 8961, 8962, 8963, 8964, 8965, 8966, 8967, 8968, 8969, 8970, 8971, 8972,
+	8974, 8975, 8976, 8977, 8978, 8979, 8980, 8981, 8982, 8983, 8984, 8985, 8986, 8987, 8988, 8989,
+	8995, 8996, 8997, 8998, 8999, 9000, 9001, 9002, 9003, 9004, 9005, 9006, 9007, 9008, 9009, 9010,
+	9012, 9013, 9014, 9015, 9016, 9017, 9018, 9019, 9027, 9028, 9029, 9030, 9031, 9032, 9033, 9034,
+	9036, 9037, 9038, 9039, 9040, 9041, 9042, 9043, 9044, 32767, 9045, 9046, 9047, 9048, 32767, 32767,
+	9049, 9050, 9051, 9052, 9053, 9054, 9055, 32767, 9056, 32767, 9057, 9058, 9059, 9060, 32767, 32767,
+	9061, 9062, 9063, 9064, 9065, 9066, 9067, 9068, 9074, 9075, 9076, 9077, 9078, 9079, 9080, 9081,
+	9082, 9083, 9084, 9085, 9086, 9087, 9088, 9089, 9091, 9092, 9093, 9094, 9095, 9096, 9097, 9098,
+	9100, 9101, 9102, 9103, 9104, 9105, 9106, 9107, 9108, 32767, 9109, 9110, 9111, 9112, 32767, 32767,
+	9113, 9114, 9115, 9116, 9117, 9118, 9119, 9120, 9122, 9123, 9124, 9125, 9126, 9127, 9128, 9129,
+	9131, 9132, 9133, 9134, 9135, 9136, 9137, 9138, 9140, 9141, 9142, 9143, 9144, 9145, 9146, 9147,
+	9148, 32767, 9149, 9150, 9151, 9152, 32767, 32767, 9153, 9154, 9155, 9156, 9157, 9158, 9159, 32767,
+	9160, 32767, 9161, 9162, 9163, 9164, 32767, 32767, 9165, 9166, 9167, 9168, 9169, 9170, 9171, 9172,
+	9173, 9174, 9175, 9176, 9177, 9178, 9179, 32767, 9180, 9181, 9182, 9183, 9184, 9185, 9186, 9187,
+	9195, 9196, 9197, 9198, 9199, 9200, 9201, 9202, 9203, 9204, 9205, 9206, 9207, 9208, 9209, 9210,
+	9211, 9212, 9213, 9214, 9215, 9216, 9217, 9218, 9226, 9227, 9228, 9229, 9230, 9231, 9232, 9233,
+	9235, 9236, 9237, 9238, 9239, 9240, 9241, 9242, 9244, 9245, 9246, 9247, 9248, 9249, 9250, 9251,
+	9252, 32767, 9253, 9254, 9255, 9256, 32767, 32767, 9257, 9258, 9259, 9260, 9261, 9262, 9263, 9264,
+	9269, 9270, 9271, 9272, 9273, 9274, 9275, 9276, 9278, 9279, 9280, 9281, 9282, 9283, 9284, 9285,
+	9294, 9295, 9296, 9297, 9298, 9299, 9300, 9301, 9303, 9304, 9305, 9306, 9307, 9308, 9309, 9310,
+	9318, 9319, 9320, 9321, 9322, 9323, 9324, 9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332, 9333,
+	9338, 9339, 9340, 9341, 9342, 9343, 9344, 9345, 9351, 9352, 9353, 32767, 32767, 33942, 33944, 33946,
+	208, 88, 131, 89, 90, 91, 92, 115, 209, 7577, 7578, 7579, 7580, 7581, 7582, 7583,
+	7584, 7585, 7056, 7057, 7058, 7059, 7060, 7061, 7062, 7063, 7064, 7065, 7066, 32767, 32767, 32767,
+	8990, 8991, 8992, 8993, 9069, 9070, 9071, 9072, 9334, 9335, 9336, 9337, 9346, 9347, 9348, 9349,
+	762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 32767, 32767, 32767, 32767, 32767, 32767,
+	13257, 13258, 13259, 13260, 13261, 13262, 13263, 13264, 13265, 13266, 13267, 13268, 13269, 13270, 13271, 13272,
+	13273, 13274, 13275, 13276, 13277, 13278, 13279, 13280, 13281, 13282, 13283, 13284, 13285, 13286, 13287, 13288,
+	13289, 13290, 13291, 13292, 13293, 13294, 13295, 13296, 13297, 13298, 13299, 13300, 13301, 13302, 13303, 13304,
+	13305, 13306, 13307, 13308, 13309, 13310, 13311, 13312, 13313, 13314, 13315, 13316, 13317, 13318, 13319, 13320,
+	13321, 13322, 13323, 13324, 13325, 13326, 13327, 13328, 13329, 13330, 13331, 13332, 13333, 13334, 13335, 13336,
+	13337, 13338, 13339, 13340, 13341, 13342, 32767, 32767, 13337, 13338, 13339, 13340, 13341, 13342, 32767, 32767,
+	15, 13379, 13380, 13381, 13382, 13383, 13384, 13385, 13386, 13387, 13388, 13389, 13390, 13391, 13392, 13393,
+	13394, 13395, 13396, 13397, 13398, 13399, 13400, 13401, 13402, 13403, 13404, 13405, 13406, 13407, 13408, 13409,
+	13410, 13411, 13412, 13413, 13414, 13415, 13416, 13417, 13418, 13419, 13420, 13421, 13422, 13423, 13424, 13425,
+	13426, 13427, 13428, 13429, 13430, 13431, 13432, 13433, 13434, 13435, 13436, 13437, 13438, 13439, 13440, 13441,
+	13442, 13443, 13444, 13445, 13446, 13447, 13448, 13449, 13450, 13451, 13452, 13453, 13454, 13455, 13456, 13457,
+	13458, 13459, 13460, 13461, 13462, 13463, 13464, 13465, 13466, 13467, 13468, 13469, 13470, 13471, 13472, 13473,
+	13474, 13475, 13476, 13477, 13478, 13479, 13480, 13481, 13482, 13483, 13484, 13485, 13486, 13487, 13488, 13489,
+	13490, 13491, 13492, 13493, 13494, 13495, 13496, 13497, 13498, 13499, 13500, 13501, 13502, 13503, 13504, 13505,
+	13506, 13507, 13508, 13509, 13510, 13511, 13512, 13513, 13514, 13515, 13516, 13517, 13518, 13519, 13520, 13521,
+	13522, 13523, 13524, 13525, 13526, 13527, 13528, 13529, 13530, 13531, 13532, 13533, 13534, 13535, 13536, 13537,
+	13538, 13539, 13540, 13541, 13542, 13543, 13544, 13545, 13546, 13547, 13548, 13549, 13550, 13551, 13552, 13553,
+	13554, 13555, 13556, 13557, 13558, 13559, 13560, 13561, 13562, 13563, 13564, 13565, 13566, 13567, 13568, 13569,
+	13570, 13571, 13572, 13573, 13574, 13575, 13576, 13577, 13578, 13579, 13580, 13581, 13582, 13583, 13584, 13585,
+	13586, 13587, 13588, 13589, 13590, 13591, 13592, 13593, 13594, 13595, 13596, 13597, 13598, 13599, 13600, 13601,
+	13602, 13603, 13604, 13605, 13606, 13607, 13608, 13609, 13610, 13611, 13612, 13613, 13614, 13615, 13616, 13617,
+	13618, 13619, 13620, 13621, 13622, 13623, 13624, 13625, 13626, 13627, 13628, 13629, 13630, 13631, 13632, 13633,
+	13634, 13635, 13636, 13637, 13638, 13639, 13640, 13641, 13642, 13643, 13644, 13645, 13646, 13647, 13648, 13649,
+	13650, 13651, 13652, 13653, 13654, 13655, 13656, 13657, 13658, 13659, 13660, 13661, 13662, 13663, 13664, 13665,
+	13666, 13667, 13668, 13669, 13670, 13671, 13672, 13673, 13674, 13675, 13676, 13677, 13678, 13679, 13680, 13681,
+	13682, 13683, 13684, 13685, 13686, 13687, 13688, 13689, 13690, 13691, 13692, 13693, 13694, 13695, 13696, 13697,
+	13698, 13699, 13700, 13701, 13702, 13703, 13704, 13705, 13706, 13707, 13708, 13709, 13710, 13711, 13712, 13713,
+	13714, 13715, 13716, 13717, 13718, 13719, 13720, 13721, 13722, 13723, 13724, 13725, 13726, 13727, 13728, 13729,
+	13730, 13731, 13732, 13733, 13734, 13735, 13736, 13737, 13738, 13739, 13740, 13741, 13742, 13743, 13744, 13745,
+	13746, 13747, 13748, 13749, 13750, 13751, 13752, 13753, 13754, 13755, 13756, 13757, 13808, 13758, 13760, 13761,
+	13762, 13763, 13764, 13765, 13766, 13767, 13768, 13769, 13770, 13771, 13772, 13773, 13774, 13775, 13777, 13778,
+	13779, 13780, 13781, 13782, 13783, 13784, 13791, 13792, 13793, 13794, 13795, 13796, 13797, 13798, 13799, 13800,
+	13801, 13802, 13803, 13804, 13805, 13806, 13807, 13809, 13810, 13811, 13812, 13813, 13814, 13815, 13816, 13817,
+	13818, 13819, 13820, 13821, 13822, 13823, 13824, 13825, 13826, 13827, 13828, 13829, 13830, 13831, 13832, 13833,
+	13834, 13835, 13836, 13837, 13838, 13839, 13840, 13841, 13842, 13843, 13844, 13845, 13846, 13847, 13848, 13849,
+	13850, 13851, 13852, 13853, 13854, 13855, 13856, 13857, 13858, 13859, 13860, 13861, 13862, 13863, 13864, 13865,
+	13866, 13867, 13868, 13869, 13870, 13871, 13872, 13873, 13874, 13875, 13876, 13877, 13878, 13879, 13880, 13881,
+	13882, 13883, 13884, 13885, 13886, 13887, 13888, 13889, 13890, 13891, 13892, 13893, 13894, 13895, 13896, 13897,
+	13898, 13899, 13900, 13901, 13902, 13903, 13904, 13905, 13906, 13907, 13908, 13909, 13910, 13911, 13912, 13913,
+	13914, 13915, 13916, 13917, 13918, 13919, 13920, 13921, 13922, 13923, 13924, 13925, 13926, 13927, 13928, 13929,
+	13930, 13931, 13932, 13933, 13934, 13935, 13936, 13937, 13938, 13939, 13940, 13941, 13942, 13943, 13944, 13945,
+	13946, 13947, 13948, 13949, 13950, 13951, 13952, 13953, 13954, 13955, 13956, 13957, 13958, 13959, 13960, 13961,
+	13962, 13963, 13964, 13965, 13966, 13967, 13968, 13969, 13970, 13971, 13972, 13973, 13974, 13975, 13976, 13977,
+	13978, 13979, 13980, 13981, 13982, 13983, 13984, 13985, 13986, 13987, 13988, 13989, 13990, 13991, 13992, 13993,
+	13994, 13995, 13996, 13997, 13998, 13999, 14000, 14001, 14002, 14003, 14004, 14005, 14006, 919, 134, 13759,
+	13776, 13785, 13786, 13787, 13788, 13789, 13790, 14007, 14008, 14009, 14010, 14011, 14012, 14013, 14014, 14015,
+	9, 14086, 14087, 14088, 14089, 14090, 14091, 14092, 14093, 14094, 14095, 14096, 14097, 14098, 14099, 14100,
+	14101, 14102, 14103, 14104, 14105, 14106, 14107, 14108, 14109, 14110, 14111, 306, 307, 32767, 32767, 32767,
+	14112, 33948, 14113, 14149, 33951, 33954, 14114, 33957, 14115, 33960, 14145, 14147, 33963, 33966, 33969, 14117,
+	14118, 14119, 14120, 33972, 33975, 33978, 33981, 14122, 14152, 14123, 14124, 33984, 33987, 33990, 14125, 33993,
+	33996, 14126, 33999, 14128, 34002, 14129, 34005, 14130, 14131, 14132, 14133, 34008, 34011, 34014, 34017, 14135,
+	34020, 34023, 14136, 34026, 34029, 34032, 14137, 14139, 34035, 34038, 14140, 34041, 14141, 34044, 14142, 14143,
+	14150, 14154, 14155, 14151, 14153, 14156, 14157, 34047, 34050, 34053, 34056, 99, 100, 101, 34059, 34062,
+	34067, 14121, 14134, 14144, 14116, 14127, 14138, 14146, 14148, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12145, 12146, 12147, 12148, 12149, 12150, 12151, 12152, 12153, 12154, 12155, 12156, 12157, 32767, 12158, 12159,
+	12160, 12161, 12162, 12163, 12164, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12165, 12166, 12167, 12168, 12169, 12170, 12171, 12172, 12173, 12174, 12175, 12176, 12177, 12178, 12179, 12180,
+	12181, 12182, 12183, 12184, 12185, 158, 159, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12186, 12187, 12188, 12189, 12190, 12191, 12192, 12193, 12194, 12195, 12196, 12197, 12198, 12199, 12200, 12201,
+	12202, 12203, 12204, 12205, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12206, 12207, 12208, 12209, 12210, 12211, 12212, 12213, 12214, 12215, 12216, 12217, 12218, 32767, 12219, 12220,
+	12221, 32767, 12222, 12223, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12640, 12641, 12642, 12643, 12644, 12645, 12646, 12647, 12648, 12649, 12650, 12651, 12652, 12653, 12654, 12655,
+	12656, 12657, 12658, 12659, 12660, 12661, 12662, 12663, 12664, 12665, 12666, 12667, 12668, 12669, 12670, 12671,
+	12672, 12673, 12674, 12676, 12677, 12678, 12679, 12680, 12681, 12682, 12683, 12684, 12685, 12686, 12687, 12688,
+	12689, 12690, 12691, 12692, 0, 0, 12693, 12694, 12695, 12696, 12697, 12698, 12699, 12700, 12701, 12702,
+	12703, 12704, 12705, 12706, 12707, 12708, 33740, 33742, 34070, 34072, 34074, 33288, 33288, 33288, 33288, 33288,
+	33288, 33288, 12709, 0, 163, 164, 96, 7499, 575, 576, 577, 7542, 12675, 33288, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 32767, 32767, 32767,
+	498, 127, 48, 132, 93, 94, 17, 18, 49, 133, 0, 0, 0, 0, 0, 32767,
+	13097, 13099, 13102, 13108, 13110, 13113, 13115, 13118, 13119, 13120, 13125, 13127, 13130, 13132, 13137, 13139,
+	13140, 13141, 13148, 13151, 13154, 13160, 13164, 13167, 13169, 13171, 13174, 13179, 13180, 13183, 13187, 13190,
+	13191, 13192, 13193, 13096, 13100, 13103, 13109, 13111, 13114, 13116, 13121, 13126, 13128, 13131, 13133, 13138,
+	13149, 13152, 13155, 13161, 13181, 13165, 13170, 13175, 13185, 13188, 13194, 13195, 13158, 13101, 13104, 13107,
+	13117, 13112, 13122, 13176, 13134, 13136, 13129, 13142, 13150, 13153, 13162, 13172, 13186, 13189, 13182, 13184,
+	13196, 13156, 13166, 13105, 13177, 13168, 13173, 13163, 13157, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	13089, 13090, 13091, 13092, 13093, 13094, 13095, 13098, 13106, 13178, 13123, 13159, 13197, 13199, 13200, 13202,
+	13203, 13206, 13208, 13209, 13211, 13213, 13215, 13216, 13204, 13214, 13135, 13124, 13143, 13144, 13198, 13201,
+	13205, 13207, 13145, 13212, 13146, 13147, 13217, 13218, 13210, 13220, 13219, 32767, 32767, 32767, 32767, 32767,
+	14016, 14017, 14018, 14019, 14020, 14021, 14022, 14023, 14024, 14025, 14026, 14027, 14028, 14029, 14030, 14031,
+	14032, 14033, 14034, 14035, 14036, 14037, 14038, 14039, 14040, 14041, 14042, 14043, 14044, 14045, 14046, 14047,
+	14048, 14049, 14050, 14051, 14052, 14053, 14054, 14055, 14056, 14057, 14058, 14059, 14060, 14061, 14062, 14063,
+	14064, 14065, 14066, 14067, 14068, 14069, 14070, 14071, 14072, 14073, 14074, 14075, 14076, 14077, 14078, 14079,
+	14080, 14081, 14082, 14083, 14084, 14085, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12095, 12096, 12097, 12098, 12099, 12100, 12101, 12102, 12103, 12104, 12105, 12106, 12107, 12108, 12109, 12110,
+	12111, 12112, 12113, 12114, 12115, 12116, 12117, 12118, 12119, 12120, 12121, 12122, 12123, 34076, 34079, 32767,
+	12124, 12125, 12126, 12127, 12128, 12129, 12130, 12131, 12132, 12133, 12134, 12135, 32767, 32767, 32767, 32767,
+	12136, 12137, 12138, 12139, 12140, 12141, 12142, 12143, 12144, 34082, 34084, 34086, 32767, 32767, 32767, 32767,
+	920, 32767, 32767, 32767, 107, 116, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	12710, 12711, 12712, 12713, 12714, 12715, 12716, 12717, 12718, 12719, 12720, 12721, 12722, 12723, 12724, 12725,
+	12726, 12727, 12728, 12729, 12730, 12731, 12732, 12733, 12734, 12735, 12736, 12737, 12738, 12739, 32767, 32767,
+	12740, 12741, 12742, 12743, 12744, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12745, 12746, 12747, 12748, 12749, 12750, 12751, 12752, 12753, 12754, 12755, 12756, 12757, 12758, 12759, 12760,
+	12761, 12762, 12763, 12764, 12765, 12766, 12767, 12768, 12769, 12770, 12771, 12772, 12773, 12774, 12775, 12776,
+	12777, 12778, 12779, 12780, 12781, 12782, 12783, 12784, 12785, 12786, 12787, 12788, 32767, 32767, 32767, 32767,
+	12789, 12790, 12791, 12792, 12793, 12794, 12795, 12796, 12797, 12798, 12799, 12800, 12801, 12802, 12803, 12804,
+	12805, 12806, 12807, 12808, 12809, 12810, 12811, 12812, 12813, 12814, 32767, 32767, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7577, 32767, 32767, 32767, 34088, 34091,
+	927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942,
+	943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+	12224, 12225, 12226, 12227, 12228, 12229, 12230, 12231, 12232, 12233, 12234, 12235, 12236, 12237, 12238, 12239,
+	12240, 12241, 12242, 12243, 12244, 12245, 12246, 12247, 12248, 12249, 12250, 12251, 32767, 32767, 210, 211,
+	12815, 12816, 12817, 12818, 12819, 12820, 12821, 12822, 12823, 12824, 12825, 12826, 12827, 12828, 12829, 12830,
+	12831, 12832, 12833, 12834, 12835, 12836, 12837, 12838, 12839, 12840, 12841, 12842, 12843, 12844, 12845, 12846,
+	12847, 12848, 12849, 12850, 12851, 12852, 12853, 12854, 12855, 12856, 12857, 12858, 12859, 12868, 12869, 12870,
+	12871, 12872, 12873, 12860, 34095, 12862, 12863, 12864, 12821, 12821, 12842, 12842, 12865, 12866, 12867, 32767,
+	12891, 12874, 12876, 12877, 12877, 12878, 12879, 12880, 12881, 12882, 12883, 12861, 12875, 12890, 12884, 12885,
+	12887, 12888, 12889, 12886, 33740, 34099, 34101, 34103, 34105, 34107, 34109, 34111, 34113, 32767, 32767, 0,
+	578, 579, 580, 581, 582, 583, 584, 7500, 165, 166, 167, 168, 585, 586, 32767, 32767,
+	33288, 33288, 33288, 33288, 33288, 33300, 33300, 33300, 33300, 33300, 33300, 33288, 33288, 33300, 34115, 7900,
+	7904, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	33738, 33738, 33740, 34117, 33742, 12961, 12962, 12963, 12964, 12965, 12966, 12967, 12968, 12969, 12970, 12971,
+	12972, 12973, 12974, 12975, 12978, 12979, 12980, 12981, 12982, 12983, 12984, 12985, 12986, 12987, 12988, 12989,
+	12990, 12991, 12992, 12994, 12995, 12996, 12997, 12998, 13000, 13001, 13002, 13003, 13004, 13005, 13006, 13007,
+	13009, 13010, 13011, 13014, 33753, 13015, 13016, 13017, 13018, 13019, 13020, 13021, 13022, 13023, 13024, 13025,
+	13026, 13027, 13028, 13029, 13030, 12976, 12977, 12993, 12999, 13008, 13012, 13013, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 212, 213, 135, 97, 169, 170,
+	16, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 969, 970, 971, 972, 973, 974, 975, 976, 977, 32767, 32767, 32767,
+	33740, 34119, 33742, 11301, 11302, 11303, 11304, 11305, 11306, 11307, 11308, 11310, 11311, 11312, 11313, 11314,
+	11315, 11316, 11317, 11318, 11319, 11320, 11321, 11322, 11323, 11325, 11327, 11329, 11332, 11335, 11337, 11338,
+	11340, 11328, 11330, 11333, 11341, 11342, 11343, 11344, 11345, 11346, 11347, 11348, 11326, 11336, 11309, 11339,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 11301, 11331, 11334, 11324, 11308, 11325,
+	12275, 12275, 12276, 12276, 12276, 12277, 12277, 12278, 12278, 12279, 12279, 12280, 12280, 12280, 12281, 12281,
+	12282, 12283, 12284, 12284, 12285, 12285, 12286, 12286, 12287, 12287, 12287, 12288, 12288, 12289, 12290, 12290,
+	12291, 12292, 12293, 12294, 12295, 12296, 33753, 12297, 12297, 12298, 12299, 12299, 12300, 12300, 12301, 12301,
+	12302, 12303, 12304, 12305, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 598, 599, 600, 601,
+	11985, 11986, 11987, 11988, 11989, 11990, 11991, 11992, 11993, 11994, 11998, 11999, 12000, 12001, 12002, 12003,
+	12004, 12005, 12006, 12007, 12008, 12009, 12010, 12011, 12012, 12013, 12014, 12016, 12018, 12019, 12020, 12021,
+	12022, 12023, 12024, 12025, 12015, 12017, 12027, 12028, 12029, 12030, 12031, 12032, 12033, 12034, 12035, 12036,
+	12037, 12038, 12039, 12040, 12041, 12042, 12026, 33753, 32767, 32767, 32767, 154, 155, 568, 569, 570,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 11995, 11996, 11997,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 13221, 13222, 13223, 13224, 13225, 13226,
+	13227, 13228, 13229, 13230, 13231, 13232, 13233, 13234, 13235, 13236, 13237, 13238, 13239, 13240, 13241, 13242,
+	13243, 13244, 13245, 13246, 13247, 13248, 13249, 13250, 13251, 13252, 13253, 13254, 13255, 13256, 203, 204,
+	8092, 8098, 8159, 8168, 8171, 8171, 8216, 8221, 8180, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	8402, 8344, 8358, 8372, 8398, 8404, 8406, 8407, 8409, 8410, 8411, 32767, 32767, 8412, 8414, 8415,
+	587, 588, 589, 590, 591, 592, 593, 594, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9481, 9481, 9481, 9481, 33740, 9481, 9481,
+	9481, 9481, 33742, 33742, 0, 9482, 9483, 0, 0, 0, 9481, 32767, 32767, 32767, 32767, 32767,
+	7587, 7591, 7592, 7604, 7612, 7621, 7622, 7634, 7651, 7694, 7703, 7709, 7720, 7739, 7750, 7763,
+	7776, 7764, 7777, 7773, 7767, 7790, 7782, 7783, 7792, 7815, 7819, 7857, 7868, 7870, 7871, 7887,
+	7892, 7901, 7922, 7933, 7969, 7970, 7986, 8000, 8006, 8011, 8022, 8138, 7586, 32798, 7600, 7603,
+	7620, 7633, 7641, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7749, 7762, 7789, 7791, 7810,
+	7856, 7867, 7900, 7586, 7594, 7595, 7592, 7600, 7620, 7633, 7643, 7645, 7651, 7665, 7694, 7708,
+	7738, 7760, 7762, 7775, 7782, 7783, 7791, 7856, 7867, 7870, 7885, 7891, 7970, 7984, 7985, 7987,
+	8019, 8020, 7689, 7810, 7867, 7891, 7984, 7985, 8010, 8019, 8020, 7872, 7605, 7624, 7660, 7740,
+	7751, 7795, 7817, 7828, 7843, 7860, 7924, 7673, 8150, 34121, 34124, 7696, 7700, 7793, 7878, 7890,
+	7607, 7625, 7661, 7670, 7710, 7729, 7741, 7755, 7796, 7821, 7844, 7851, 7894, 7906, 7925, 7589,
+	7597, 7628, 7638, 7646, 7650, 7644, 7697, 7779, 7854, 7879, 7935, 7598, 7611, 7617, 32829, 7649,
+	7656, 7706, 7666, 7882, 7695, 7699, 7691, 7696, 7705, 7730, 7729, 7718, 7742, 7888, 7752, 7756,
+	7748, 7785, 7801, 7845, 7849, 7861, 7875, 7889, 7868, 7895, 7899, 7921, 7927, 7928, 7932, 7995,
+	33288, 33288, 33300, 33288, 33288, 33288, 33288, 33288, 33288, 33288, 7810, 33288, 33288, 33288, 33288, 33300,
+	33300, 33288, 7948, 34128, 32798, 34131, 34134, 32802, 34137, 32829, 7665, 7668, 7708, 7717, 7718, 7739,
+	7747, 7748, 7812, 7814, 7840, 33059, 7921, 7595, 7600, 7610, 7643, 7656, 7725, 34140, 7791, 7849,
+	34143, 7900, 32792, 32847, 32862, 33288, 33288, 33288, 33288, 33300, 32767, 33288, 33300, 33300, 33288, 33300,
+	34146, 34146, 34149, 34149, 34152, 34152, 34155, 34155, 34158, 34158, 34162, 34162, 34165, 34165, 34168, 34168,
+	34171, 34171, 34174, 34174, 34177, 34177, 34181, 34181, 34185, 34185, 34188, 34188, 34191, 34191, 34195, 34195,
+	34198, 34198, 34201, 34201, 34204, 34204, 34207, 34207, 34210, 34210, 34213, 34213, 34216, 34216, 34219, 34219,
+	34223, 34223, 34226, 34226, 34229, 34229, 34232, 34232, 34235, 34235, 34239, 34239, 34242, 34242, 34245, 34245,
+	34248, 34248, 34251, 34251, 34254, 34254, 34257, 34257, 34260, 34260, 34263, 34263, 34266, 34266, 34270, 34270,
+	34274, 34274, 34278, 34278, 34282, 34282, 34285, 34285, 34288, 34288, 34291, 34291, 34294, 34294, 34298, 34298,
+	34301, 34301, 34304, 34304, 34307, 34307, 34311, 34311, 34315, 34315, 34319, 34319, 34322, 34322, 34325, 34325,
+	34328, 34328, 34331, 34331, 34334, 34334, 34337, 34337, 34340, 34340, 34344, 34344, 34348, 34348, 34351, 34351,
+	34354, 34354, 34357, 34357, 34360, 34360, 34363, 34363, 34366, 34366, 34369, 34369, 34372, 34372, 34375, 34375,
+	34378, 34378, 34381, 34381, 34384, 34384, 34387, 34390, 34393, 34396, 34399, 34402, 7847, 7848, 32868, 7632,
+	34406, 34406, 34409, 34409, 34412, 34412, 34416, 34416, 34420, 34420, 34424, 34424, 34428, 34428, 34432, 34432,
+	34436, 34436, 34440, 34440, 34444, 34444, 34448, 34448, 34452, 34452, 34455, 34455, 34458, 34458, 34461, 34461,
+	34465, 34465, 34469, 34469, 34473, 34473, 34477, 34477, 34481, 34481, 34484, 34484, 34487, 34487, 34490, 34490,
+	34493, 34493, 34497, 34497, 34501, 34501, 34505, 34505, 34509, 34509, 34513, 34513, 34517, 34517, 34521, 34521,
+	34525, 34525, 34529, 34529, 34533, 34533, 34536, 34536, 34539, 34539, 34543, 34543, 34547, 34547, 34551, 34551,
+	34555, 34555, 34559, 34559, 34562, 34562, 34565, 34565, 34568, 34568, 34571, 34571, 7898, 7898, 7918, 7918,
+	34574, 34577, 34580, 34584, 34588, 34592, 34596, 34600, 34574, 34577, 34580, 34584, 34588, 34592, 34596, 34600,
+	34604, 34607, 34610, 34614, 34618, 34622, 32767, 32767, 34604, 34607, 34610, 34614, 34618, 34622, 32767, 32767,
+	34626, 34629, 34632, 34636, 34640, 34644, 34648, 34652, 34626, 34629, 34632, 34636, 34640, 34644, 34648, 34652,
+	34656, 34659, 34662, 34666, 34670, 34674, 34678, 34682, 34656, 34659, 34662, 34666, 34670, 34674, 34678, 34682,
+	34686, 34689, 34692, 34696, 34700, 34704, 32767, 32767, 34686, 34689, 34692, 34696, 34700, 34704, 32767, 32767,
+	34708, 34711, 34714, 34718, 34722, 34726, 34730, 34734, 32767, 34711, 32767, 34718, 32767, 34726, 32767, 34734,
+	34738, 34741, 34744, 34748, 34752, 34756, 34760, 34764, 34738, 34741, 34744, 34748, 34752, 34756, 34760, 34764,
+	34768, 33356, 34771, 33359, 34774, 33362, 34777, 33365, 34780, 33368, 34783, 33371, 34786, 33374, 32767, 32767,
+	34789, 34793, 34797, 34802, 34807, 34812, 34817, 34822, 34789, 34793, 34797, 34802, 34807, 34812, 34817, 34822,
+	34827, 34831, 34835, 34840, 34845, 34850, 34855, 34860, 34827, 34831, 34835, 34840, 34845, 34850, 34855, 34860,
+	34865, 34869, 34873, 34878, 34883, 34888, 34893, 34898, 34865, 34869, 34873, 34878, 34883, 34888, 34893, 34898,
+	34903, 34906, 34909, 34913, 34916, 32767, 34920, 34923, 34903, 34906, 34768, 33356, 34913, 704, 7996, 704,
+	706, 34927, 34930, 34934, 34937, 32767, 34941, 34944, 34771, 33359, 34774, 33362, 34934, 34948, 34951, 34954,
+	34957, 34960, 34963, 33377, 32767, 32767, 34967, 34970, 34957, 34960, 34777, 33365, 32767, 34974, 34977, 34980,
+	34983, 34986, 34989, 33387, 34993, 34996, 34999, 35002, 34983, 34986, 34783, 33371, 34996, 35006, 33353, 692,
+	32767, 32767, 35009, 35013, 35016, 32767, 35020, 35023, 34780, 33368, 34786, 33374, 35013, 693, 705, 32767,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0,
+	19, 19, 20, 21, 22, 23, 404, 12, 279, 280, 281, 282, 286, 287, 288, 289,
+	435, 436, 441, 442, 126, 35027, 35030, 443, 7, 8, 0, 0, 0, 0, 0, 9,
+	431, 433, 447, 35034, 35037, 448, 35041, 35044, 451, 283, 284, 452, 35048, 124, 10, 453,
+	455, 457, 458, 444, 1142, 308, 309, 35051, 35054, 35057, 426, 413, 445, 446, 418, 60,
+	456, 419, 1138, 26, 454, 249, 250, 35060, 251, 252, 253, 254, 255, 256, 257, 9,
+	0, 0, 0, 0, 0, 32767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7576, 7689, 32767, 32767, 7580, 7581, 7582, 7583, 7584, 7585, 1126, 1137, 1131, 296, 297, 7747,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 1126, 1137, 1131, 296, 297, 32767,
+	7586, 7633, 7762, 7905, 7643, 7677, 7708, 7717, 7738, 7747, 7791, 7840, 7856, 32767, 32767, 32767,
+	7544, 7545, 7546, 7547, 7548, 7549, 7550, 7551, 35065, 7552, 7553, 7554, 7555, 7556, 7557, 7558,
+	7559, 7560, 7561, 7562, 7563, 7564, 7565, 7566, 7567, 7568, 7570, 7571, 7572, 7573, 7574, 7575,
+	35068, 35070, 35072, 35072, 35074, 35076, 35078, 35080, 33334, 33334, 33334, 35082, 35084, 34115, 34115, 34115,
+	34115, 35086, 34115, 34115, 34115, 33334, 35088, 35090, 35092, 35094, 33334, 33334, 33300, 33300, 33300, 33300,
+	33288, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	35096, 35100, 7611, 35104, 982, 35107, 35111, 7645, 983, 35115, 7665, 7677, 7677, 7677, 7677, 32932,
+	7689, 7689, 7717, 7717, 984, 7747, 35118, 985, 986, 7791, 7803, 7810, 7810, 7810, 987, 988,
+	35121, 35124, 35128, 989, 7921, 990, 8023, 991, 7921, 992, 7708, 32795, 7600, 7611, 993, 7633,
+	7633, 7656, 7663, 7738, 7762, 8457, 8458, 8459, 8460, 7689, 994, 35131, 8005, 7985, 7985, 8005,
+	1125, 995, 996, 997, 998, 7620, 7620, 7633, 7689, 7701, 999, 1281, 1000, 35100, 7663, 1001,
+	35135, 35139, 35143, 35148, 35152, 35156, 35160, 35164, 35168, 35172, 35176, 35180, 35184, 35188, 35192, 35196,
+	7689, 35199, 35202, 35206, 7891, 35209, 35212, 35216, 35221, 7905, 35224, 35227, 7717, 7611, 7620, 7738,
+	7067, 7068, 7069, 7618, 7618, 7582, 7070, 7071, 7072, 35231, 1002, 1003, 32767, 32767, 32767, 32767,
+	1004, 1006, 1005, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 35235, 35238, 1014, 1015, 1016, 1017,
+	1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 35241, 1032,
+	1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+	1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 35244, 35247, 35250,
+	1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+	1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+	1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+	1110, 1111, 1112, 1113, 35253, 1114, 1115, 1116, 1117, 35256, 1118, 1119, 35259, 1120, 1122, 1123,
+	1124, 1125, 1137, 1139, 1140, 1141, 1143, 1144, 1145, 1146, 1147, 1148, 1150, 1152, 1153, 1154,
+	1155, 1156, 1157, 1158, 35262, 1159, 35265, 1160, 1161, 1162, 1163, 1164, 35268, 35271, 1165, 35275,
+	35278, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+	1181, 35282, 1182, 1183, 35285, 1184, 1185, 35288, 1186, 35291, 1187, 1188, 1189, 1190, 1191, 1192,
+	1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+	35294, 1209, 35297, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 35300, 35303, 35306,
+	35309, 35312, 1220, 1221, 35315, 35318, 1222, 1223, 35321, 35324, 1224, 1225, 1226, 1227, 1228, 1229,
+	35327, 35330, 1230, 1231, 35333, 35336, 1232, 1233, 35339, 35342, 1234, 1235, 1236, 1237, 1238, 1239,
+	1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+	1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 35345, 35348, 35351, 35354,
+	1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1282, 1283, 1284,
+	1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+	1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+	35357, 35360, 35363, 35366, 1317, 1318, 1319, 1320, 1321, 1322, 35369, 35372, 35375, 35378, 1323, 1324,
+	1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+	1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 310, 311, 312, 313, 1349, 1350, 1351, 1352,
+	1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368,
+	1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 384, 385, 1378, 1379, 1380, 1381, 1382,
+	1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398,
+	1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+	1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+	1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446,
+	1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462,
+	1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478,
+	1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494,
+	1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510,
+	1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526,
+	1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542,
+	1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558,
+	1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574,
+	1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+	1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606,
+	1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,
+	1623, 1624, 1625, 1626, 1627, 1628, 1629, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 32767, 32767, 32767, 32767, 32767,
+	7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 35381, 35384, 35387, 35390, 35393, 35396, 35399,
+	35402, 35405, 35408, 35411, 35414, 35418, 35422, 35426, 35430, 35434, 35438, 35442, 35446, 35450, 35455, 35460,
+	35465, 35470, 35475, 35480, 35485, 35490, 35495, 35500, 35505, 35508, 35511, 35514, 35517, 35520, 35523, 35526,
+	35529, 35532, 35536, 35540, 35544, 35548, 35552, 35556, 35560, 35564, 35568, 35572, 35576, 35580, 35584, 35588,
+	35592, 35596, 35600, 35604, 35608, 35612, 35616, 35620, 35624, 35628, 35632, 35636, 35640, 35644, 35648, 35652,
+	35656, 35660, 35664, 35668, 35672, 35676, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701,
+	7708, 7717, 7738, 7747, 7762, 7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921,
+	7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7762, 7791,
+	7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7576, 35384, 35387, 35390, 35393, 35396,
+	35399, 35402, 35405, 35408, 35411, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 35381, 7576,
+	1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+	1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
+	1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+	1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+	1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720,
+	1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736,
+	1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752,
+	1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+	1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+	1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800,
+	1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816,
+	1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832,
+	1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+	1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864,
+	1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880,
+	1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896,
+	2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114,
+	2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130,
+	2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146,
+	3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154,
+	2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170,
+	2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186,
+	2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 4161, 4162, 4163,
+	2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215,
+	2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 3560, 3561, 3562, 3563, 3564, 3565,
+	2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241,
+	2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257,
+	2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273,
+	2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289,
+	2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305,
+	2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321,
+	2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337,
+	2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379,
+	2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
+	2396, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+	2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429,
+	2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+	2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461,
+	2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 350, 351, 352, 353, 354, 355, 356, 357,
+	358, 359, 360, 361, 362, 363, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 35381,
+	7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 35381, 7577, 7578, 7579, 7580, 7581, 7582,
+	7583, 7584, 7585, 35381, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481,
+	2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497,
+	2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513,
+	2514, 2515, 2516, 2517, 2518, 338, 339, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527,
+	2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+	2544, 2545, 2546, 2547, 2548, 2549, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+	2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565,
+	3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319,
+	3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3335,
+	3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351,
+	3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367,
+	3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383,
+	3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399,
+	3400, 3401, 3402, 3403, 3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415,
+	3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431,
+	3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447,
+	3448, 3449, 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463,
+	3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479,
+	3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3494, 3495,
+	3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511,
+	3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527,
+	3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543,
+	3544, 3545, 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559,
+	2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
+	2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597,
+	2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
+	2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629,
+	2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645,
+	2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661,
+	2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2675, 2676, 2677,
+	2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+	2694, 2695, 2696, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328,
+	329, 330, 331, 332, 333, 334, 335, 336, 337, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
+	2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719,
+	2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735,
+	2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751,
+	2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 406, 407, 408, 409, 2760, 2761, 2762, 2763,
+	2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779,
+	2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 314, 315, 2792, 2793,
+	2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 35680, 2806, 2807, 2808,
+	2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824,
+	2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840,
+	2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856,
+	2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872,
+	2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888,
+	2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904,
+	2905, 2906, 2907, 2908, 35685, 35689, 35692, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917,
+	2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933,
+	2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949,
+	2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964, 2965,
+	2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981,
+	2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997,
+	2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 35696, 3010, 3011, 3012,
+	3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028,
+	3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044,
+	3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060,
+	3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076,
+	3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092,
+	3093, 3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108,
+	3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124,
+	3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140,
+	3141, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156,
+	3157, 3158, 3159, 3160, 32767, 32767, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 3168, 3169, 3170,
+	3171, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186,
+	3187, 3188, 3189, 3190, 3191, 3192, 32767, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201,
+	3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217,
+	3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233,
+	3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249,
+	3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265,
+	3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281,
+	3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296, 3297,
+	8245, 8246, 8247, 8248, 8249, 8250, 8251, 8252, 8253, 8254, 8255, 8256, 8257, 8258, 8259, 8260,
+	8261, 8262, 8263, 8264, 8265, 8266, 8267, 8268, 8269, 8270, 8271, 8272, 8273, 8274, 8275, 8276,
+	8277, 8278, 8279, 8280, 8281, 8282, 8283, 8284, 8285, 8286, 8287, 8288, 8289, 8290, 8291, 32767,
+	7723, 7723, 7724, 7793, 7825, 7588, 7859, 7682, 7682, 7712, 7712, 7930, 7930, 7595, 7742, 7594,
+	7598, 7896, 7903, 7903, 7897, 7683, 7683, 7802, 7640, 7823, 7784, 7642, 7701, 7891, 7846, 7929,
+	8028, 8028, 8029, 8029, 8030, 8030, 8031, 8031, 8032, 8032, 8034, 8034, 8035, 8035, 8036, 8036,
+	8037, 8037, 8038, 8038, 8039, 8039, 8041, 8041, 8042, 8042, 8043, 8043, 8046, 8046, 8047, 8047,
+	8048, 8048, 8049, 8049, 8050, 8050, 8051, 8051, 8052, 8052, 8053, 8053, 8054, 8054, 8055, 8055,
+	8056, 8056, 8083, 8083, 8084, 8084, 8033, 8033, 8040, 8040, 8044, 8044, 8045, 8045, 8057, 8057,
+	8058, 8058, 8061, 8061, 8062, 8062, 8063, 8063, 8067, 8067, 8069, 8069, 8070, 8070, 8071, 8071,
+	8072, 8072, 8073, 8073, 8074, 8074, 8077, 8077, 8079, 8079, 8080, 8080, 8081, 8081, 8085, 8085,
+	8086, 8086, 8087, 8087, 35699, 3298, 3299, 3300, 3301, 3302, 3303, 8060, 8060, 8076, 8076, 33288,
+	33298, 33296, 8066, 8066, 32767, 32767, 32767, 32767, 32767, 136, 117, 118, 263, 7095, 137, 264,
+	8900, 8901, 8902, 8903, 8904, 8905, 8906, 8907, 8908, 8909, 8910, 8911, 8913, 8914, 8915, 8916,
+	8917, 8918, 8919, 8920, 8921, 8922, 8923, 8924, 8925, 8926, 8927, 8928, 8929, 8930, 8931, 8932,
+	8933, 8934, 8935, 8936, 8938, 8939, 8940, 8941, 8942, 8943, 8944, 8945, 8946, 8947, 8948, 8949,
+	8950, 8951, 8952, 8953, 8954, 8955, 8912, 8937, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 8956,
+	595, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0,
+	8973, 8994, 9011, 9020, 9035, 9073, 9090, 9099, 9121, 9130, 9139, 9188, 9219, 9234, 9243, 9277,
+	9286, 9302, 9350, 9265, 9266, 9267, 9268, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	9354, 9355, 9356, 9357, 9358, 9359, 9360, 32767, 9361, 9362, 9363, 9364, 9365, 9366, 9367, 32767,
+	9368, 9369, 9370, 9371, 9372, 9373, 9374, 32767, 9375, 9376, 9377, 9378, 9379, 9380, 9381, 32767,
+	9382, 9383, 9384, 9385, 9386, 9387, 9388, 32767, 9389, 9390, 9391, 9392, 9393, 9394, 9395, 32767,
+	9396, 9397, 9398, 9399, 9400, 9401, 9402, 32767, 9403, 9404, 9405, 9406, 9407, 9408, 9409, 32767,
+	8091, 8092, 8093, 8098, 8107, 8111, 8129, 8137, 8147, 8150, 8159, 8161, 8165, 8168, 8171, 8183,
+	8195, 8200, 8210, 8212, 8239, 35703, 8088, 8105, 8128, 8180, 8221, 8224, 8226, 8230, 8232, 8236,
+	459, 460, 364, 365, 366, 367, 461, 462, 463, 368, 369, 464, 370, 371, 465, 466,
+	467, 468, 469, 470, 471, 472, 473, 28, 125, 265, 474, 475, 372, 373, 476, 477,
+	374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 258, 259, 260, 261, 111, 8214,
+	138, 148, 37, 149, 36, 61, 437, 438, 439, 411, 24, 25, 139, 262, 405, 415,
+	29, 38, 290, 27, 478, 479, 480, 481, 482, 63, 424, 440, 39, 414, 40, 41,
+	2397, 2398, 427, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	35706, 35710, 35714, 35717, 35720, 35724, 35727, 35731, 35735, 35739, 35742, 35746, 35750, 35754, 35758, 35762,
+	35765, 35768, 35772, 35775, 35778, 35781, 35785, 35788, 35792, 35795, 32767, 35798, 35801, 35805, 35809, 35813,
+	35816, 35819, 35822, 35825, 35828, 35831, 35835, 35838, 35842, 35845, 35849, 35853, 35857, 35861, 35864, 35868,
+	35871, 35874, 35877, 35880, 35884, 35888, 35892, 35896, 35900, 35903, 35906, 35909, 35913, 35917, 35921, 35924,
+	35928, 35932, 35935, 35938, 35941, 35944, 35947, 35950, 35954, 35957, 35960, 35964, 35967, 35970, 35974, 35978,
+	35982, 35985, 35988, 35991, 35994, 35997, 36001, 36004, 36008, 36011, 36014, 36017, 36020, 36023, 36026, 36030,
+	36033, 36036, 36040, 36043, 36047, 36051, 36054, 36057, 36061, 36064, 36067, 36070, 36074, 36077, 36081, 36084,
+	36088, 36091, 36095, 36099, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	36102, 36105, 36108, 36111, 36114, 36117, 36120, 36123, 36126, 36129, 36132, 36135, 36138, 36141, 36144, 36147,
+	36150, 36153, 36156, 36159, 36162, 36165, 36168, 36171, 36174, 36177, 36180, 36183, 36186, 36189, 36192, 36195,
+	36198, 36201, 36204, 36207, 36210, 36213, 36216, 36219, 36222, 36225, 35765, 36228, 36231, 36234, 36237, 36240,
+	36243, 36246, 36249, 35775, 36252, 36255, 36258, 36261, 36264, 36267, 36270, 36273, 36276, 36279, 36282, 36285,
+	36288, 36291, 36294, 36297, 36300, 36303, 36306, 36309, 36312, 36315, 36318, 36321, 36324, 36327, 36330, 36333,
+	36336, 36339, 36342, 36345, 36348, 36351, 36354, 36357, 36360, 36363, 36366, 36369, 36372, 36375, 36378, 36381,
+	36384, 36387, 36390, 36393, 36396, 36399, 36402, 36405, 36408, 36411, 36414, 36417, 36420, 36423, 36426, 36429,
+	36432, 36435, 36438, 36441, 36444, 36447, 36450, 36453, 36456, 36459, 36462, 36465, 36468, 36471, 36474, 36477,
+	36480, 36483, 36486, 36489, 36492, 36495, 36498, 36501, 36504, 36507, 36510, 36513, 36516, 36519, 36522, 36525,
+	36528, 36531, 36534, 35947, 36537, 36540, 36543, 36546, 36549, 36552, 36555, 36558, 36561, 36564, 36567, 36570,
+	36573, 36576, 36579, 36582, 36585, 36588, 36591, 35985, 36594, 36597, 36600, 36603, 36606, 36609, 36612, 36615,
+	36618, 36621, 36624, 36627, 36630, 36633, 36636, 36023, 36639, 36642, 36645, 36648, 36651, 36654, 36657, 36660,
+	36663, 36666, 36669, 36672, 36675, 36678, 36681, 36684, 36687, 36690, 36693, 36696, 36699, 36702, 36705, 36708,
+	36711, 36714, 36717, 36720, 36723, 36726, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	6939, 6940, 6941, 6942, 6943, 6944, 6945, 6946, 6947, 6948, 6949, 6950, 32767, 32767, 32767, 32767,
+	9, 54, 146, 449, 6987, 7511, 36729, 7576, 384, 385, 386, 387, 388, 389, 390, 391,
+	392, 393, 6988, 6989, 394, 395, 396, 397, 398, 399, 400, 401, 30, 291, 292, 293,
+	6990, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 36732, 36734, 36736, 36738, 36740, 36742,
+	31, 7516, 36744, 7517, 36747, 7518, 6988, 6991, 36171, 36750, 36753, 7512, 36756, 450, 6992, 6993,
+	32767, 15813, 15813, 15814, 15814, 15815, 15815, 15817, 15817, 15818, 15818, 15819, 36759, 15820, 36762, 15821,
+	36765, 15822, 36768, 15823, 36771, 15824, 36774, 15825, 36777, 15826, 36780, 15827, 36783, 15828, 36786, 15829,
+	36789, 15830, 36792, 15831, 15831, 36795, 15832, 36798, 15833, 36801, 15834, 15835, 15836, 15837, 15838, 15839,
+	36804, 36807, 15840, 36810, 36813, 15841, 36816, 36819, 15842, 36822, 36825, 15843, 36828, 36831, 15844, 15845,
+	15846, 15847, 15848, 15849, 15849, 15850, 15850, 15851, 15851, 15852, 15853, 15854, 15855, 15856, 15857, 15857,
+	15858, 15859, 15860, 15861, 36834, 15819, 15822, 32767, 32767, 36837, 36839, 707, 708, 7519, 36841, 36844,
+	32, 15813, 15813, 15814, 15814, 15815, 15815, 15817, 15817, 15818, 15818, 15819, 36759, 15820, 36762, 15821,
+	15858, 15859, 15860, 15861, 36834, 15819, 15822, 36847, 36850, 36853, 36856, 33, 7520, 7521, 36859, 36862,
+	32767, 32767, 32767, 32767, 32767, 16148, 16149, 16150, 16152, 16154, 16155, 16156, 16158, 16159, 16160, 16163,
+	16164, 16165, 16166, 16170, 16171, 16172, 16173, 16174, 16175, 16176, 16180, 16181, 16183, 16184, 16186, 16187,
+	16188, 16189, 16190, 16191, 16192, 16194, 16197, 16198, 16199, 16200, 16153, 16161, 16167, 16201, 16183, 16157,
+	32767, 15456, 15457, 15678, 15458, 15680, 15681, 15459, 15460, 15461, 15684, 15685, 15686, 15687, 15688, 15689,
+	15482, 15462, 15463, 15464, 15489, 15465, 15466, 15467, 15468, 15469, 15470, 15471, 15472, 15473, 15474, 15582,
+	15583, 15584, 15585, 15586, 15587, 15588, 15589, 15590, 15591, 15592, 15593, 15594, 15595, 15596, 15597, 15598,
+	15599, 15600, 15601, 15602, 15581, 15476, 15477, 15707, 15708, 15712, 15714, 15719, 15723, 15725, 15484, 15729,
+	15731, 15485, 15486, 15488, 15490, 15491, 15495, 15497, 15499, 15500, 15501, 15502, 15503, 15506, 15510, 15520,
+	15527, 15532, 15749, 15750, 15543, 15544, 15545, 15617, 15618, 15621, 15630, 15631, 15633, 15643, 15646, 32767,
+	6994, 6995, 36102, 36120, 36865, 36868, 36871, 36874, 36877, 36880, 36114, 36883, 36886, 36889, 36892, 36126,
+	36895, 36898, 36901, 36904, 16185, 36907, 16182, 36910, 36913, 36916, 36919, 36922, 16151, 16162, 36925, 36928,
+	16195, 16196, 16193, 36919, 16149, 16155, 16160, 16163, 16177, 16178, 16179, 16159, 16168, 16169, 16202, 16203,
+	6951, 6952, 6953, 6954, 6955, 6956, 6957, 6958, 6959, 6960, 6961, 6962, 6963, 6964, 6965, 6966,
+	6967, 6968, 6969, 6970, 6971, 6972, 6973, 6974, 6975, 6976, 6977, 6978, 6979, 6980, 6981, 6982,
+	6983, 6984, 6985, 6986, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	15821, 15825, 15826, 15833, 15836, 15839, 15840, 15841, 15842, 15843, 15846, 15852, 15853, 15854, 15855, 15856,
+	36931, 36935, 36939, 36943, 36947, 36951, 36955, 36959, 36963, 36967, 36971, 36975, 36979, 36983, 36987, 36992,
+	36997, 37002, 37007, 37012, 37017, 37022, 37027, 37032, 37037, 37042, 37047, 37052, 37057, 37062, 37070, 32767,
+	37077, 37082, 37087, 37092, 37097, 37102, 37107, 37112, 37117, 37122, 37127, 37132, 37137, 37142, 37147, 37152,
+	37157, 37162, 37167, 37172, 37177, 37182, 37187, 37192, 37197, 37202, 37207, 37212, 37217, 37222, 37227, 37232,
+	37237, 37242, 37247, 37252, 37257, 37260, 36294, 37263, 35381, 35411, 37266, 37269, 37272, 37275, 37278, 37281,
+	37284, 37288, 37291, 37294, 37297, 37300, 37303, 37306, 37309, 37312, 37266, 37315, 37318, 37321, 37324, 37327,
+	15456, 15458, 15459, 15461, 15462, 15463, 15465, 15467, 15468, 15470, 15471, 15472, 15473, 15474, 37330, 37333,
+	37336, 37339, 37342, 37345, 37348, 37351, 37354, 37357, 37360, 37363, 37366, 37369, 37372, 37378, 37383, 6996,
+	36102, 36120, 36865, 36868, 37386, 37389, 37392, 36135, 37395, 36171, 36315, 36351, 36348, 36318, 36591, 36195,
+	36309, 37398, 37401, 37404, 37407, 37410, 37413, 37416, 37419, 37422, 37425, 36213, 37428, 37431, 37434, 37437,
+	37440, 37443, 37446, 37449, 36871, 36874, 36877, 37452, 37455, 37458, 37461, 37464, 37467, 37470, 37473, 37476,
+	37479, 37482, 37485, 37488, 37491, 37269, 37494, 37497, 37500, 37503, 37506, 37509, 37512, 37515, 37518, 37272,
+	37521, 37525, 37529, 37533, 37537, 37541, 37545, 37549, 37553, 37557, 37562, 37567, 37572, 37575, 37579, 37582,
+	15813, 15814, 15815, 15817, 15818, 15819, 15820, 15821, 15822, 15823, 15824, 15825, 15826, 15827, 15828, 15829,
+	15830, 15831, 15832, 15833, 15834, 15835, 15836, 15837, 15838, 15839, 15840, 15841, 15842, 15843, 15844, 15845,
+	15846, 15847, 15848, 15849, 15850, 15851, 15852, 15853, 15854, 15855, 15856, 15857, 15858, 15859, 15860, 37586,
+	37591, 37597, 37602, 37608, 37612, 37618, 37622, 37626, 37633, 37638, 37642, 37646, 37650, 37655, 37660, 37665,
+	37670, 37675, 37680, 37685, 37692, 37695, 37702, 37709, 37715, 37720, 37727, 37734, 37739, 37743, 37747, 37752,
+	37757, 37763, 37769, 37773, 37777, 37782, 37786, 37790, 37793, 37796, 37800, 37804, 37811, 37816, 37822, 37829,
+	37834, 37838, 37842, 37849, 37854, 37861, 37865, 37871, 37875, 37880, 37884, 37889, 37895, 37900, 37906, 37911,
+	37914, 37920, 37924, 37928, 37933, 37937, 37941, 37945, 37951, 37956, 37959, 37966, 37970, 37976, 37981, 37986,
+	37990, 37994, 37999, 38002, 38007, 38013, 38016, 38023, 38027, 38031, 38035, 38039, 38043, 38047, 38051, 38055,
+	38059, 38063, 38067, 38072, 38077, 38082, 38087, 38092, 38097, 38102, 38107, 38112, 38117, 38122, 38127, 38132,
+	38137, 38142, 38146, 38149, 38152, 38156, 38159, 38162, 38165, 38169, 38173, 38176, 38181, 38186, 38191, 38196,
+	38205, 38208, 38211, 38214, 38217, 38220, 38223, 38226, 38229, 38233, 38238, 38241, 38244, 38247, 38250, 38253,
+	38256, 38259, 38263, 38267, 38271, 38275, 38278, 38281, 38284, 38287, 38290, 38293, 38296, 38299, 38302, 38305,
+	38309, 38313, 38316, 38320, 38324, 38328, 38331, 38335, 38339, 38205, 38344, 38348, 38352, 38356, 38360, 38366,
+	38373, 38376, 38379, 38382, 38385, 38388, 38391, 38394, 38397, 38394, 38400, 38403, 38406, 38409, 38412, 38409,
+	38415, 38418, 38421, 38426, 38429, 38432, 38435, 38440, 33235, 38444, 38447, 38450, 38453, 38456, 38302, 38459,
+	38462, 38465, 38468, 38472, 38223, 38475, 38479, 38483, 38486, 38491, 38495, 38498, 38501, 38504, 38507, 38511,
+	38515, 38519, 38523, 38527, 38531, 38535, 38539, 38543, 38547, 38551, 38556, 38561, 38566, 38571, 38576, 38581,
+	38586, 38591, 38596, 38601, 38606, 38611, 38616, 38621, 38626, 38631, 38636, 38641, 38646, 38651, 38656, 38661,
+	3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 3589,
+	3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605,
+	3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621,
+	3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637,
+	16204, 16205, 16206, 16207, 16208, 16209, 16210, 16211, 16212, 16213, 16214, 16215, 16216, 16217, 16218, 16219,
+	16220, 16221, 16222, 16223, 16224, 16225, 16226, 16227, 16228, 16229, 16230, 16231, 16232, 16233, 16234, 16235,
+	16236, 16237, 16238, 16239, 16240, 16241, 16242, 16243, 16244, 16245, 16246, 16247, 16248, 16249, 16250, 16251,
+	16252, 16253, 16254, 16255, 16256, 16257, 16258, 16259, 16260, 16261, 16262, 16263, 16264, 16265, 16266, 16267,
+	16268, 16269, 16270, 16271, 16272, 16273, 16274, 16275, 16276, 16277, 16278, 16279, 16280, 16281, 16282, 16283,
+	16284, 16285, 16286, 16287, 16288, 16289, 16290, 16291, 16292, 16293, 16294, 16295, 16296, 16297, 16298, 16299,
+	16300, 16301, 16302, 16303, 16304, 16305, 16306, 16307, 16308, 16309, 16310, 16311, 16312, 16313, 16314, 16315,
+	16316, 16317, 16318, 16319, 16320, 16321, 16322, 16323, 16324, 16325, 16326, 16327, 16328, 16329, 16330, 16331,
+	16332, 16333, 16334, 16335, 16336, 16337, 16338, 16339, 16340, 16341, 16342, 16343, 16344, 16345, 16346, 16347,
+	16348, 16349, 16350, 16351, 16352, 16353, 16354, 16355, 16356, 16357, 16358, 16359, 16360, 16361, 16362, 16363,
+	16364, 16365, 16366, 16367, 16368, 16369, 16370, 16371, 16372, 16373, 16374, 16375, 16376, 16377, 16378, 16379,
+	16380, 16381, 16382, 16383, 16384, 16385, 16386, 16387, 16388, 16389, 16390, 16391, 16392, 16393, 16394, 16395,
+	16396, 16397, 16398, 16399, 16400, 16401, 16402, 16403, 16404, 16405, 16406, 16407, 16408, 16409, 16410, 16411,
+	16412, 16413, 16414, 16415, 16416, 16417, 16418, 16419, 16420, 16421, 16422, 16423, 16424, 16425, 16426, 16427,
+	16428, 16429, 16430, 16431, 16432, 16433, 16434, 16435, 16436, 16437, 16438, 16439, 16440, 16441, 16442, 16443,
+	16444, 16445, 16446, 16447, 16448, 16449, 16450, 16451, 16452, 16453, 16454, 16455, 16456, 16457, 16458, 16459,
+	16460, 16461, 16462, 16463, 16464, 16465, 16466, 16467, 16468, 16469, 16470, 16471, 16472, 16473, 16474, 16475,
+	16476, 16477, 16478, 16479, 16480, 16481, 16482, 16483, 16484, 16485, 16486, 16487, 16488, 16489, 16490, 16491,
+	16492, 16493, 16494, 16495, 16496, 16497, 16498, 16499, 16500, 16501, 16502, 16503, 16504, 16505, 16506, 16507,
+	16508, 16509, 16510, 16511, 16512, 16513, 16514, 16515, 16516, 16517, 16518, 16519, 16520, 16521, 16522, 16523,
+	16524, 16525, 16526, 16527, 16528, 16529, 16530, 16531, 16532, 16533, 16534, 16535, 16536, 16537, 16538, 16539,
+	16540, 16541, 16542, 16543, 16544, 16545, 16546, 16547, 16548, 16549, 16550, 16551, 16552, 16553, 16554, 16555,
+	16556, 16557, 16558, 16559, 16560, 16561, 16562, 16563, 16564, 16565, 16566, 16567, 16568, 16569, 16570, 16571,
+	16572, 16573, 16574, 16575, 16576, 16577, 16578, 16579, 16580, 16581, 16582, 16583, 16584, 16585, 16586, 16587,
+	16588, 16589, 16590, 16591, 16592, 16593, 16594, 16595, 16596, 16597, 16598, 16599, 16600, 16601, 16602, 16603,
+	16604, 16605, 16606, 16607, 16608, 16609, 16610, 16611, 16612, 16613, 16614, 16615, 16616, 16617, 16618, 16619,
+	16620, 16621, 16622, 16623, 16624, 16625, 16626, 16627, 16628, 16629, 16630, 16631, 16632, 16633, 16634, 16635,
+	16636, 16637, 16638, 16639, 16640, 16641, 16642, 16643, 16644, 16645, 16646, 16647, 16648, 16649, 16650, 16651,
+	16652, 16653, 16654, 16655, 16656, 16657, 16658, 16659, 16660, 16661, 16662, 16663, 16664, 16665, 16666, 16667,
+	16668, 16669, 16670, 16671, 16672, 16673, 16674, 16675, 16676, 16677, 16678, 16679, 16680, 16681, 16682, 16683,
+	16684, 16685, 16686, 16687, 16688, 16689, 16690, 16691, 16692, 16693, 16694, 16695, 16696, 16697, 16698, 16699,
+	16700, 16701, 16702, 16703, 16704, 16705, 16706, 16707, 16708, 16709, 16710, 16711, 16712, 16713, 16714, 16715,
+	16716, 16717, 16718, 16719, 16720, 16721, 16722, 16723, 16724, 16725, 16726, 16727, 16728, 16729, 16730, 16731,
+	16732, 16733, 16734, 16735, 16736, 16737, 16738, 16739, 16740, 16741, 16742, 16743, 16744, 16745, 16746, 16747,
+	16748, 16749, 16750, 16751, 16752, 16753, 16754, 16755, 16756, 16757, 16758, 16759, 16760, 16761, 16762, 16763,
+	16764, 16765, 16766, 16767, 16768, 16769, 16770, 16771, 16772, 16773, 16774, 16775, 16776, 16777, 16778, 16779,
+	16780, 16781, 16782, 16783, 16784, 16785, 16786, 16787, 16788, 16789, 16790, 16791, 16792, 16793, 16794, 16795,
+	16796, 16797, 16798, 16799, 16800, 16801, 16802, 16803, 16804, 16805, 16806, 16807, 16808, 16809, 16810, 16811,
+	16812, 16813, 16814, 16815, 16816, 16817, 16818, 16819, 16820, 16821, 16822, 16823, 16824, 16825, 16826, 16827,
+	16828, 16829, 16830, 16831, 16832, 16833, 16834, 16835, 16836, 16837, 16838, 16839, 16840, 16841, 16842, 16843,
+	16844, 16845, 16846, 16847, 16848, 16849, 16850, 16851, 16852, 16853, 16854, 16855, 16856, 16857, 16858, 16859,
+	16860, 16861, 16862, 16863, 16864, 16865, 16866, 16867, 16868, 16869, 16870, 16871, 16872, 16873, 16874, 16875,
+	16876, 16877, 16878, 16879, 16880, 16881, 16882, 16883, 16884, 16885, 16886, 16887, 16888, 16889, 16890, 16891,
+	16892, 16893, 16894, 16895, 16896, 16897, 16898, 16899, 16900, 16901, 16902, 16903, 16904, 16905, 16906, 16907,
+	16908, 16909, 16910, 16911, 16912, 16913, 16914, 16915, 16916, 16917, 16918, 16919, 16920, 16921, 16922, 16923,
+	16924, 16925, 16926, 16927, 16928, 16929, 16930, 16931, 16932, 16933, 16934, 16935, 16936, 16937, 16938, 16939,
+	16940, 16941, 16942, 16943, 16944, 16945, 16946, 16947, 16948, 16949, 16950, 16951, 16952, 16953, 16954, 16955,
+	16956, 16957, 16958, 16959, 16960, 16961, 16962, 16963, 16964, 16965, 16966, 16967, 16968, 16969, 16970, 16971,
+	16972, 16973, 16974, 16975, 16976, 16977, 16978, 16979, 16980, 16981, 16982, 16983, 16984, 16985, 16986, 16987,
+	16988, 16989, 16990, 16991, 16992, 16993, 16994, 16995, 16996, 16997, 16998, 16999, 17000, 17001, 17002, 17003,
+	17004, 17005, 17006, 17007, 17008, 17009, 17010, 17011, 17012, 17013, 17014, 17015, 17016, 17017, 17018, 17019,
+	17020, 17021, 17022, 17023, 17024, 17025, 17026, 17027, 17028, 17029, 17030, 17031, 17032, 17033, 17034, 17035,
+	17036, 17037, 17038, 17039, 17040, 17041, 17042, 17043, 17044, 17045, 17046, 17047, 17048, 17049, 17050, 17051,
+	17052, 17053, 17054, 17055, 17056, 17057, 17058, 17059, 17060, 17061, 17062, 17063, 17064, 17065, 17066, 17067,
+	17068, 17069, 17070, 17071, 17072, 17073, 17074, 17075, 17076, 17077, 17078, 17079, 17080, 17081, 17082, 17083,
+	17084, 17085, 17086, 17087, 17088, 17089, 17090, 17091, 17092, 17093, 17094, 17095, 17096, 17097, 17098, 17099,
+	17100, 17101, 17102, 17103, 17104, 17105, 17106, 17107, 17108, 17109, 17110, 17111, 17112, 17113, 17114, 17115,
+	17116, 17117, 17118, 17119, 17120, 17121, 17122, 17123, 17124, 17125, 17126, 17127, 17128, 17129, 17130, 17131,
+	17132, 17133, 17134, 17135, 17136, 17137, 17138, 17139, 17140, 17141, 17142, 17143, 17144, 17145, 17146, 17147,
+	17148, 17149, 17150, 17151, 17152, 17153, 17154, 17155, 17156, 17157, 17158, 17159, 17160, 17161, 17162, 17163,
+	17164, 17165, 17166, 17167, 17168, 17169, 17170, 17171, 17172, 17173, 17174, 17175, 17176, 17177, 17178, 17179,
+	17180, 17181, 17182, 17183, 17184, 17185, 17186, 17187, 17188, 17189, 17190, 17191, 17192, 17193, 17194, 17195,
+	17196, 17197, 17198, 17199, 17200, 17201, 17202, 17203, 17204, 17205, 17206, 17207, 17208, 17209, 17210, 17211,
+	17212, 17213, 17214, 17215, 17216, 17217, 17218, 17219, 17220, 17221, 17222, 17223, 17224, 17225, 17226, 17227,
+	17228, 17229, 17230, 17231, 17232, 17233, 17234, 17235, 17236, 17237, 17238, 17239, 17240, 17241, 17242, 17243,
+	17244, 17245, 17246, 17247, 17248, 17249, 17250, 17251, 17252, 17253, 17254, 17255, 17256, 17257, 17258, 17259,
+	17260, 17261, 17262, 17263, 17264, 17265, 17266, 17267, 17268, 17269, 17270, 17271, 17272, 17273, 17274, 17275,
+	17276, 17277, 17278, 17279, 17280, 17281, 17282, 17283, 17284, 17285, 17286, 17287, 17288, 17289, 17290, 17291,
+	17292, 17293, 17294, 17295, 17296, 17297, 17298, 17299, 17300, 17301, 17302, 17303, 17304, 17305, 17306, 17307,
+	17308, 17309, 17310, 17311, 17312, 17313, 17314, 17315, 17316, 17317, 17318, 17319, 17320, 17321, 17322, 17323,
+	17324, 17325, 17326, 17327, 17328, 17329, 17330, 17331, 17332, 17333, 17334, 17335, 17336, 17337, 17338, 17339,
+	17340, 17341, 17342, 17343, 17344, 17345, 17346, 17347, 17348, 17349, 17350, 17351, 17352, 17353, 17354, 17355,
+	17356, 17357, 17358, 17359, 17360, 17361, 17362, 17363, 17364, 17365, 17366, 17367, 17368, 32767, 32767, 32767,
+	3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740,
+	3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756,
+	3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772,
+	3773, 3774, 3775, 3776, 3777, 3778, 3779, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	17375, 17376, 17377, 17378, 17379, 17380, 17381, 17382, 17383, 17384, 17385, 17386, 17387, 17388, 17389, 17390,
+	17391, 17392, 17393, 17394, 17395, 17396, 17397, 17398, 17399, 17400, 17403, 17401, 17404, 17402, 17406, 17407,
+	17408, 17409, 17410, 17411, 17412, 17413, 17414, 17415, 17369, 17370, 17371, 17372, 17374, 17373, 50, 140,
+	14244, 14245, 14246, 14247, 14248, 14249, 14250, 14251, 14252, 14253, 14254, 14255, 14256, 14257, 14258, 14259,
+	14260, 14261, 14262, 14263, 14264, 14265, 14266, 14267, 14268, 14269, 14270, 14271, 14272, 14273, 14274, 14275,
+	14276, 14277, 14278, 14279, 14280, 14281, 14282, 14283, 14284, 14285, 14286, 14287, 14288, 14289, 14290, 14291,
+	14292, 14293, 14294, 14295, 14296, 14297, 14298, 14299, 14300, 14301, 14302, 14303, 14304, 14305, 14306, 14307,
+	14308, 14309, 14310, 14311, 14312, 14313, 14314, 14315, 14316, 14317, 14318, 14319, 14320, 14321, 14322, 14323,
+	14324, 14325, 14326, 14327, 14328, 14329, 14330, 14331, 14332, 14333, 14334, 14335, 14336, 14337, 14338, 14339,
+	14340, 14341, 14342, 14343, 14344, 14345, 14346, 14347, 14348, 14349, 14350, 14351, 14352, 14353, 14354, 14355,
+	14356, 14357, 14358, 14359, 14360, 14361, 14362, 14363, 14364, 14365, 14366, 14367, 14368, 14369, 14370, 14371,
+	14372, 14373, 14374, 14375, 14376, 14377, 14378, 14379, 14380, 14381, 14382, 14383, 14384, 14385, 14386, 14387,
+	14388, 14389, 14390, 14391, 14392, 14393, 14394, 14395, 14396, 14397, 14398, 14399, 14400, 14401, 14402, 14403,
+	14404, 14405, 14406, 14407, 14408, 14409, 14410, 14411, 14412, 14413, 14414, 14415, 14416, 14417, 14418, 14419,
+	14420, 14421, 14422, 14423, 14424, 14425, 14426, 14427, 14428, 14429, 14430, 14431, 14432, 14433, 14434, 14435,
+	14436, 14437, 14438, 14439, 14440, 14441, 14442, 14443, 14444, 14445, 14446, 14447, 14448, 14449, 14450, 14451,
+	14452, 14453, 14454, 14455, 14456, 14457, 14458, 14459, 14460, 14461, 14462, 14463, 14464, 14465, 14466, 14467,
+	14468, 14469, 14470, 14471, 14472, 14473, 14474, 14475, 14476, 14477, 14478, 14479, 14480, 14481, 14482, 14483,
+	14484, 14485, 14486, 14487, 14488, 14489, 14490, 14491, 14492, 14493, 14494, 14495, 14496, 14497, 14498, 14499,
+	14500, 14501, 14502, 14503, 14504, 14505, 14506, 14507, 14508, 14509, 14510, 14511, 14512, 51, 141, 119,
+	14332, 14350, 14379, 38665, 38668, 38671, 38674, 38677, 38680, 38683, 38686, 38689, 38692, 38695, 38698, 38701,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 14354, 14453, 32767, 32767, 32767, 32767,
+	8112, 8112, 8115, 8115, 8117, 8117, 8125, 8125, 8128, 8128, 8180, 8180, 8192, 8192, 8213, 8213,
+	8217, 8217, 8222, 8222, 8225, 8225, 8226, 8226, 8231, 8231, 8233, 8233, 8235, 8235, 8241, 8241,
+	8196, 8196, 8102, 8102, 8144, 8144, 8149, 8149, 8159, 8159, 8159, 8159, 8159, 8159, 8159, 38704,
+	0, 0, 0, 421, 8106, 8122, 33404, 8177, 8216, 8218, 8219, 8190, 33288, 33288, 483, 8215,
+	8100, 8100, 8121, 8121, 8109, 8109, 8206, 8206, 8119, 8119, 8175, 8175, 8172, 8172, 8197, 8197,
+	8199, 8199, 8202, 8202, 8189, 8189, 8211, 8211, 8159, 8159, 8159, 8159, 8216, 8219, 8182, 8229,
+	14513, 14514, 14515, 14516, 14517, 14518, 14519, 14520, 14521, 14522, 14523, 14524, 14525, 14526, 14527, 14528,
+	14529, 14530, 14531, 14532, 14533, 14534, 14535, 14536, 14537, 14538, 14539, 14540, 14541, 14542, 14543, 14544,
+	14545, 14546, 14547, 14548, 14549, 14550, 14551, 14552, 14553, 14554, 14555, 14556, 14557, 14558, 14559, 14560,
+	14561, 14562, 14563, 14564, 14565, 14566, 14567, 14568, 14569, 14570, 14571, 14572, 14573, 14574, 14575, 14576,
+	14577, 14578, 14579, 14580, 14581, 14582, 14583, 14584, 14585, 14586, 14587, 14588, 14589, 14590, 14591, 14592,
+	38706, 38708, 224, 142, 102, 52, 62, 120, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787,
+	788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803,
+	804, 805, 7963, 7963, 7971, 7971, 7685, 7685, 38710, 38710, 7951, 7951, 7952, 7952, 7953, 7953,
+	7657, 7841, 38713, 38713, 34131, 34131, 38149, 38149, 34134, 34134, 38716, 38716, 38720, 38720, 7619, 7619,
+	7713, 7713, 7714, 7714, 7715, 7715, 7719, 7719, 7721, 7721, 7786, 7786, 7781, 7781, 38723, 38723,
+	7794, 7794, 7798, 7798, 7799, 7799, 7805, 7805, 7806, 7806, 7814, 7814, 7839, 7839, 7893, 7893,
+	38726, 38726, 7931, 7931, 7939, 7939, 7940, 7940, 7942, 7942, 7946, 7946, 7947, 7947, 7948, 7948,
+	7948, 7631, 7733, 7746, 7759, 7837, 7838, 7865, 7949, 34137, 34137, 38729, 38729, 34121, 7674, 7674,
+	7735, 7735, 38732, 38732, 33059, 33059, 38735, 38735, 806, 807, 808, 7964, 7964, 7882, 7731, 7965,
+	7754, 7754, 7614, 7614, 7615, 7680, 7606, 7606, 7659, 7659, 32792, 32792, 32847, 32847, 32862, 32862,
+	38738, 38738, 38741, 38741, 38744, 38744, 38747, 38747, 38750, 38750, 7681, 7649, 7666, 7727, 7691, 7804,
+	7716, 7866, 7705, 7911, 7610, 7610, 7788, 7788, 7877, 7877, 7590, 7590, 7698, 7698, 7881, 7881,
+	32767, 32767, 7902, 7902, 7615, 7845, 7925, 7623, 7623, 7842, 7842, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 7684, 7684, 7693, 32932, 32995, 7886, 7664, 7800, 7744, 7692, 7745,
+	10183, 10184, 10185, 10186, 10187, 10188, 10189, 10191, 10192, 10193, 10194, 33740, 10195, 10196, 10197, 10198,
+	10199, 10200, 10201, 10202, 10203, 10204, 10205, 10206, 10207, 10208, 10209, 10210, 10211, 10212, 10213, 10214,
+	10215, 10216, 10217, 10218, 10219, 10220, 10221, 10222, 876, 877, 878, 879, 10190, 32767, 32767, 32767,
+	7010, 7011, 7012, 7013, 7014, 7015, 880, 881, 7535, 882, 32767, 32767, 32767, 32767, 32767, 32767,
+	12043, 12044, 12045, 12046, 12047, 12048, 12049, 12050, 12055, 12056, 12057, 12058, 12059, 12060, 12061, 12062,
+	12063, 12064, 12065, 12066, 12068, 12069, 12070, 12071, 12074, 12077, 12078, 12080, 12081, 12084, 12089, 12090,
+	12091, 12092, 12085, 12086, 12087, 12088, 12093, 12067, 12072, 12051, 12052, 12053, 12054, 12073, 12079, 12082,
+	12083, 12075, 12076, 12094, 596, 597, 156, 157, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	33740, 33742, 10223, 10224, 10225, 10226, 10227, 10228, 10229, 10230, 10231, 10232, 10233, 10234, 10235, 10236,
+	10237, 10238, 10239, 10240, 10241, 10242, 10243, 10244, 10245, 10246, 10247, 10248, 10249, 10250, 10251, 10252,
+	10253, 10254, 10255, 10256, 10257, 10258, 10259, 10260, 10261, 10262, 10263, 10264, 10265, 10266, 10267, 10268,
+	10269, 10270, 10271, 10272, 10273, 10274, 10275, 10276, 10277, 10278, 10279, 10280, 10281, 10282, 10283, 10284,
+	10285, 10286, 10287, 10288, 10289, 33738, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 152, 153,
+	0, 0, 9484, 9484, 9484, 9484, 9484, 9484, 513, 514, 515, 9485, 516, 9411, 9433, 9506,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 12342, 12343, 12344, 12345, 12346, 12347,
+	12348, 12349, 12350, 12351, 12352, 12353, 12354, 12355, 12356, 12357, 12358, 12359, 12360, 12361, 12362, 12363,
+	12364, 12365, 12366, 12367, 12368, 12369, 12370, 12371, 12372, 12373, 12374, 38753, 38755, 38757, 602, 160,
+	12306, 12307, 12308, 12309, 12310, 12311, 12312, 12313, 12314, 12315, 12316, 12317, 12318, 12319, 12320, 12321,
+	12322, 12323, 12324, 12325, 12326, 12327, 12328, 12329, 12330, 12331, 12332, 12333, 12334, 12335, 12336, 12337,
+	12338, 12339, 12340, 12341, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 225,
+	15551, 15552, 15553, 15554, 15555, 15556, 15557, 15558, 15559, 15560, 15561, 15562, 15563, 15564, 15565, 15566,
+	15567, 15568, 15569, 15570, 15571, 15572, 15573, 15574, 15575, 15576, 15577, 15578, 15579, 32767, 32767, 32767,
+	33738, 33740, 38759, 33742, 13031, 13032, 13033, 13034, 13035, 13036, 13037, 13038, 13039, 13040, 13041, 13042,
+	13043, 13044, 13045, 13046, 13047, 13048, 13049, 13050, 13051, 13052, 13053, 13054, 13055, 13056, 13057, 13058,
+	13059, 13060, 13061, 13062, 13063, 13064, 13065, 13066, 13067, 13068, 13069, 13071, 13071, 13073, 13074, 13075,
+	13076, 13077, 13078, 33753, 13079, 13079, 13081, 13082, 13083, 13084, 13086, 13087, 13080, 13085, 13070, 13072,
+	13088, 214, 215, 216, 217, 218, 219, 98, 171, 172, 220, 221, 222, 223, 32767, 7501,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 32767, 603, 604,
+	12384, 12392, 12402, 12424, 12449, 12523, 7502, 12410, 12444, 12382, 12385, 12397, 12404, 12418, 12421, 12425,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 12477, 12430, 12433, 12447, 12450, 32767,
+	12892, 12893, 12894, 12895, 12896, 12897, 12898, 12899, 12900, 12901, 12902, 12903, 12904, 12905, 12906, 12907,
+	12908, 12909, 12910, 12911, 12912, 12913, 12914, 12915, 12916, 12917, 12918, 12919, 12920, 12921, 12922, 12923,
+	12924, 12925, 12926, 12927, 12928, 12929, 12930, 12931, 12932, 12937, 12938, 12939, 12940, 12941, 12942, 12943,
+	12944, 12945, 12946, 12933, 12934, 12935, 12936, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12947, 12948, 12949, 12950, 12951, 12952, 12953, 12954, 12955, 12956, 12957, 12958, 12959, 12960, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 605, 173, 174, 175,
+	12381, 12390, 12393, 12396, 12403, 12409, 12413, 12415, 12417, 12420, 12432, 12436, 12469, 12472, 12474, 12442,
+	7503, 12475, 12399, 12456, 12547, 12548, 12549, 923, 924, 925, 12457, 12544, 12545, 12546, 12394, 12406,
+	11649, 11650, 11651, 11652, 11653, 11654, 11655, 11656, 11657, 11658, 11659, 11660, 11661, 11662, 11663, 11664,
+	11665, 11666, 11667, 11668, 11669, 11670, 11671, 11672, 11673, 11674, 11675, 11676, 11677, 11678, 11679, 11680,
+	11681, 11682, 11683, 11684, 11685, 11686, 11687, 11688, 11689, 11690, 11691, 11692, 11693, 11694, 11695, 11696,
+	11697, 11698, 11699, 11700, 11701, 11702, 11703, 11704, 11705, 11706, 11707, 11708, 11709, 11710, 11711, 38761,
+	11712, 38763, 11713, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 11714, 11715, 7504, 526, 527,
+	10148, 10149, 10150, 10151, 10152, 10153, 10154, 10155, 10156, 10157, 10158, 10167, 10168, 10169, 10170, 10171,
+	176, 121, 10120, 7505, 7506, 10172, 10182, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 9021, 9022, 9023, 9024, 9025, 9026, 32767, 32767, 9220, 9221, 9222, 9223, 9224, 9225, 32767,
+	32767, 9189, 9190, 9191, 9192, 9193, 9194, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	9287, 9288, 9289, 9290, 9291, 9292, 9293, 32767, 9311, 9312, 9313, 9314, 9315, 9316, 9317, 32767,
+	7596, 7593, 7635, 7636, 7639, 7658, 7667, 7728, 7725, 7726, 7743, 7758, 7761, 7765, 7774, 7778,
+	7770, 7768, 7769, 7771, 7772, 7811, 7813, 7830, 7831, 7826, 7832, 7833, 7834, 7850, 7869, 7876,
+	7873, 7874, 7880, 7911, 7912, 7913, 7907, 7908, 7909, 7910, 7919, 809, 7685, 7728, 7724, 7880,
+	7943, 7944, 7780, 7945, 7599, 8024, 38765, 38768, 7836, 7904, 730, 731, 32767, 32767, 32767, 32767,
+	10121, 10122, 10123, 10124, 10125, 10126, 10127, 10128, 10129, 10130, 10131, 10132, 10133, 10134, 10135, 10136,
+	10137, 10138, 10139, 10140, 10141, 10142, 10143, 10144, 10145, 10146, 10147, 10173, 10174, 10175, 10176, 10177,
+	10178, 10179, 10180, 10159, 10160, 10161, 10162, 10163, 10164, 10165, 10166, 177, 38771, 10181, 32767, 32767,
+	15653, 15654, 15655, 15656, 15657, 15658, 15659, 15660, 15661, 15662, 15663, 15664, 15665, 15666, 15667, 15668,
+	15669, 15670, 15671, 15672, 15673, 15674, 15675, 32767, 32767, 32767, 32767, 15764, 15765, 15766, 15767, 15768,
+	15769, 15770, 15771, 15772, 15773, 15774, 15775, 15776, 15777, 15778, 15779, 15780, 15781, 15782, 15783, 15784,
+	15785, 15786, 15787, 15788, 15789, 15790, 15791, 15792, 15793, 15794, 15795, 15796, 15797, 15798, 15799, 15800,
+	15801, 15802, 15803, 15804, 15805, 15806, 15807, 15808, 15809, 15810, 15811, 15812, 32767, 32767, 32767, 32767,
+	38773, 38776, 36567, 38779, 38782, 38785, 38788, 36723, 36723, 38791, 36591, 38794, 38797, 38800, 38803, 38806,
+	38809, 38812, 38815, 38818, 38821, 38824, 38827, 38830, 38833, 38836, 38839, 38842, 38845, 38848, 38851, 38854,
+	38857, 38860, 38863, 38866, 38869, 38872, 38875, 38878, 38881, 38884, 38887, 38890, 38893, 38896, 38899, 38902,
+	38905, 38908, 38911, 38914, 36468, 38917, 38920, 38923, 38926, 38929, 38932, 38935, 38938, 38941, 38944, 38947,
+	36678, 38950, 38953, 38956, 38959, 38962, 38965, 38968, 38971, 38974, 38977, 38980, 38983, 38986, 38989, 38992,
+	38995, 38998, 39001, 39004, 39007, 39010, 39013, 39016, 39019, 39022, 39025, 39028, 38821, 39031, 39034, 39037,
+	39040, 39043, 39046, 39049, 39052, 39055, 39058, 39061, 39064, 39067, 39070, 39073, 39076, 39079, 39082, 39085,
+	39088, 36573, 39091, 39094, 39097, 39100, 39103, 39106, 39109, 39112, 39115, 39118, 39121, 39124, 39127, 39130,
+	39133, 36213, 39136, 39139, 39142, 39145, 39148, 39151, 39154, 39157, 36156, 39160, 39163, 39166, 39169, 39172,
+	39175, 39178, 39181, 39184, 39187, 39190, 39193, 39196, 39199, 39202, 39205, 39208, 39211, 39214, 39217, 39220,
+	39223, 39085, 39226, 39229, 39232, 39235, 39238, 39241, 39244, 39247, 39037, 39250, 39253, 39256, 39259, 39262,
+	39265, 39268, 39271, 39274, 39277, 39280, 39283, 39286, 39289, 39292, 39295, 39298, 39301, 39304, 39307, 38821,
+	39310, 39313, 39316, 39319, 36720, 39322, 39325, 39328, 39331, 39334, 39337, 39340, 39343, 39346, 39349, 39352,
+	39355, 37389, 39358, 39361, 39364, 39367, 39370, 39373, 39376, 39379, 39382, 39043, 39385, 39388, 39391, 39394,
+	39397, 39400, 39403, 39406, 39409, 39412, 39415, 39418, 39421, 36588, 39424, 39427, 39430, 39433, 39436, 39439,
+	39442, 39445, 39448, 39451, 39454, 39457, 39460, 36444, 39463, 39466, 39469, 39472, 39475, 39478, 39481, 39484,
+	39487, 39490, 39493, 39496, 39499, 39502, 39505, 39508, 36525, 39511, 36534, 39514, 39517, 39520, 39523, 39526,
+	39529, 39532, 39535, 39538, 39541, 39544, 39547, 39550, 39553, 39556, 39559, 39562, 39565, 39568, 36465, 39571,
+	39574, 39577, 39580, 39583, 39586, 39589, 39592, 39595, 39598, 39601, 39604, 39607, 39610, 39613, 39616, 39619,
+	39622, 39625, 39628, 39631, 39634, 39637, 39640, 39643, 39646, 39649, 39652, 39655, 36231, 39658, 39661, 39664,
+	39667, 39670, 39673, 39676, 39679, 39682, 39685, 39688, 39691, 35828, 39694, 39697, 37404, 39700, 39703, 39706,
+	39709, 37416, 39712, 39715, 39718, 39721, 39724, 39193, 39727, 39730, 39733, 39736, 39739, 35921, 35921, 39742,
+	39745, 39748, 39751, 39754, 39757, 39760, 35967, 39589, 39763, 39766, 39769, 39772, 39775, 39778, 32767, 32767,
+	39781, 39784, 39787, 39790, 39793, 39796, 39799, 39802, 39640, 39805, 39808, 39811, 39529, 39814, 39817, 39820,
+	39823, 39826, 39829, 39832, 39835, 39838, 39841, 39844, 39847, 39664, 39850, 39667, 39853, 39856, 39859, 39862,
+	39865, 39535, 38884, 39868, 39871, 36327, 39088, 39337, 39874, 39877, 39688, 39880, 39691, 39883, 39886, 39889,
+	39547, 39892, 39895, 39898, 39901, 39904, 39550, 39907, 39910, 39913, 39916, 39919, 39922, 39724, 39925, 39928,
+	39193, 39931, 39736, 39934, 39937, 39940, 39943, 39946, 39748, 39949, 39580, 39952, 39751, 39031, 39955, 39754,
+	39958, 39760, 39961, 39964, 39967, 39970, 39973, 39763, 39565, 39976, 39766, 39979, 39769, 39982, 36723, 39985,
+	39988, 39991, 39994, 39997, 40000, 40003, 40006, 40009, 40012, 40015, 32767, 32767, 32767, 32767, 32767, 32767,
+	40018, 40021, 40024, 40027, 40031, 40035, 40039, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 40042, 40045, 40048, 40051, 40054, 32767, 32767, 32767, 32767, 32767, 40057, 40060, 40062,
+	8472, 8457, 8460, 8461, 8467, 8468, 8469, 8476, 8478, 1126, 40066, 40069, 40072, 40076, 40080, 40083,
+	40086, 40089, 40092, 40095, 40098, 40101, 40104, 32767, 40107, 40110, 40113, 40113, 40116, 32767, 40119, 32767,
+	40122, 40125, 32767, 40128, 40128, 32767, 40131, 40134, 40137, 40140, 40143, 40146, 40149, 40152, 40155, 40158,
+	8531, 8531, 8544, 8544, 8544, 8544, 8545, 8545, 8545, 8545, 8546, 8546, 8546, 8546, 8563, 8563,
+	8563, 8563, 8566, 8566, 8566, 8566, 8562, 8562, 8562, 8562, 8660, 8660, 8660, 8660, 8663, 8663,
+	8663, 8663, 8572, 8572, 8572, 8572, 8571, 8571, 8571, 8571, 8573, 8573, 8573, 8573, 8575, 8575,
+	8575, 8575, 8598, 8598, 8597, 8597, 8600, 8600, 8593, 8593, 8615, 8615, 8608, 8608, 8674, 8674,
+	8674, 8674, 8682, 8682, 8682, 8682, 8687, 8687, 8687, 8687, 8685, 8685, 8685, 8685, 8708, 8708,
+	8710, 8710, 8710, 8710, 33578, 33578, 8719, 8719, 8719, 8719, 8718, 8718, 8718, 8718, 8752, 8752,
+	33584, 33584, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835,
+	836, 837, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 8679, 8679, 8679, 8679, 8727, 8727, 8726, 8726, 8728, 8728, 33572, 8731, 8731,
+	8725, 8725, 8729, 8729, 8742, 8742, 8742, 8742, 8737, 8737, 40161, 40161, 40164, 40164, 40167, 40167,
+	40170, 40170, 40173, 40173, 40176, 40176, 40179, 40179, 40179, 40182, 40182, 40182, 8739, 8739, 8739, 8739,
+	40185, 40188, 40191, 40182, 40194, 40197, 40200, 40203, 40206, 40209, 40212, 40215, 40218, 40221, 40224, 40227,
+	40230, 40233, 40236, 40239, 40242, 40245, 40248, 40251, 40254, 40257, 40260, 40263, 40266, 40269, 40272, 40275,
+	40278, 40281, 40284, 40287, 40290, 40293, 40296, 40299, 40302, 40305, 40308, 40311, 40314, 40317, 40320, 40323,
+	40326, 40329, 40332, 40335, 40338, 40341, 40344, 40347, 40350, 40353, 40356, 40359, 40362, 40365, 40368, 40371,
+	40374, 40377, 40380, 40383, 40386, 40389, 40392, 40395, 40398, 40401, 40404, 40407, 40410, 40413, 40416, 40419,
+	40422, 40425, 40428, 40431, 40434, 40437, 40440, 40443, 40446, 40449, 40452, 40455, 40458, 40461, 40464, 40467,
+	40470, 40473, 40476, 40479, 40482, 40485, 40191, 40488, 40182, 40194, 40491, 40494, 40206, 40497, 40209, 40212,
+	40500, 40503, 40224, 40506, 40227, 40230, 40509, 40512, 40236, 40515, 40239, 40242, 40329, 40332, 40341, 40344,
+	40347, 40359, 40362, 40365, 40368, 40380, 40383, 40386, 40518, 40398, 40521, 40524, 40416, 40527, 40419, 40422,
+	40461, 40530, 40533, 40446, 40536, 40449, 40452, 40185, 40188, 40539, 40191, 40542, 40197, 40200, 40203, 40206,
+	40545, 40215, 40218, 40221, 40224, 40548, 40236, 40245, 40248, 40251, 40254, 40257, 40263, 40266, 40269, 40272,
+	40275, 40278, 40551, 40281, 40284, 40287, 40290, 40293, 40296, 40302, 40305, 40308, 40311, 40314, 40317, 40320,
+	40323, 40326, 40335, 40338, 40350, 40353, 40356, 40359, 40362, 40371, 40374, 40377, 40380, 40554, 40389, 40392,
+	40395, 40398, 40407, 40410, 40413, 40416, 40557, 40425, 40428, 40560, 40437, 40440, 40443, 40446, 40563, 40191,
+	40542, 40206, 40545, 40224, 40548, 40236, 40566, 40275, 40569, 40572, 40575, 40359, 40362, 40380, 40416, 40557,
+	40446, 40563, 40470, 40473, 40476, 40578, 40581, 40584, 40587, 40590, 40593, 40596, 40599, 40602, 40605, 40608,
+	40611, 40614, 40617, 40620, 40623, 40626, 40629, 40632, 40635, 40638, 40641, 40644, 40572, 40647, 40650, 40653,
+	40656, 40578, 40581, 40584, 40587, 40590, 40593, 40596, 40599, 40602, 40605, 40608, 40611, 40614, 40617, 40620,
+	40623, 40626, 40629, 40632, 40635, 40638, 40641, 40644, 40572, 40647, 40650, 40653, 40656, 40638, 40641, 40644,
+	40572, 40569, 40575, 40299, 40266, 40269, 40272, 40638, 40641, 40644, 40299, 40302, 40659, 40659, 402, 403,
+	40662, 40666, 40666, 40670, 40674, 40678, 40682, 40686, 40690, 40690, 40694, 40698, 40702, 40706, 40710, 40714,
+	40714, 40718, 40722, 40722, 40726, 40726, 40730, 40734, 40734, 40738, 40742, 40742, 40746, 40746, 40750, 40754,
+	40754, 40758, 40758, 40762, 40766, 40770, 40774, 40774, 40778, 40782, 40786, 40790, 40794, 40794, 40798, 40802,
+	40806, 40810, 40814, 40818, 40818, 40822, 40822, 40826, 40826, 40830, 40834, 40838, 40842, 40846, 40850, 40854,
+	32767, 32767, 40858, 40862, 40866, 40870, 40874, 40878, 40878, 40882, 40886, 40890, 40894, 40894, 40898, 40902,
+	40906, 40910, 40914, 40918, 40922, 40926, 40930, 40934, 40938, 40942, 40946, 40950, 40954, 40958, 40962, 40966,
+	40970, 40974, 40978, 40982, 40798, 40806, 40986, 40990, 40994, 40998, 41002, 41006, 41002, 40994, 41010, 41014,
+	41018, 41022, 41026, 41006, 40770, 40730, 41030, 41034, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	41038, 41042, 41046, 41051, 41056, 41061, 41066, 41071, 41076, 41081, 41085, 41104, 41113, 821, 32767, 32767,
+	35, 54, 146, 64, 58, 103, 109, 396, 397, 35030, 32767, 32767, 32767, 32767, 32767, 32767,
+	33351, 0, 33349, 0, 0, 0, 0, 33300, 0, 33349, 0, 0, 0, 0, 33419, 0,
+	35027, 22, 21, 11, 11, 296, 297, 300, 301, 394, 395, 392, 393, 386, 387, 384,
+	385, 388, 389, 390, 391, 55, 56, 298, 299, 10, 10, 10, 10, 11, 11, 11,
+	35, 54, 126, 32767, 58, 64, 109, 103, 22, 296, 297, 300, 301, 394, 395, 428,
+	425, 417, 1126, 13, 1130, 1132, 1131, 32767, 423, 7524, 429, 416, 32767, 32767, 32767, 32767,
+	33522, 33522, 33524, 0, 33526, 32767, 33528, 33528, 33530, 33530, 33532, 33532, 33534, 33534, 33536, 33536,
+	8527, 8528, 8528, 8529, 8529, 8532, 8532, 8533, 8533, 8537, 8537, 8537, 8537, 8541, 8541, 8543,
+	8543, 8543, 8543, 8559, 8559, 8560, 8560, 8560, 8560, 8561, 8561, 8561, 8561, 8570, 8570, 8570,
+	8570, 8580, 8580, 8580, 8580, 8581, 8581, 8581, 8581, 8591, 8591, 8592, 8592, 8606, 8606, 8607,
+	8607, 8625, 8625, 8625, 8625, 8626, 8626, 8626, 8626, 8636, 8636, 8636, 8636, 8637, 8637, 8637,
+	8637, 8642, 8642, 8642, 8642, 8643, 8643, 8643, 8643, 8646, 8646, 8646, 8646, 8647, 8647, 8647,
+	8647, 8655, 8655, 8655, 8655, 8667, 8667, 8667, 8667, 8673, 8673, 8673, 8673, 8695, 8695, 8695,
+	8695, 8703, 8703, 8703, 8703, 8707, 8707, 8707, 8707, 8717, 8717, 8717, 8717, 8723, 8723, 8737,
+	8737, 8738, 8738, 8738, 8738, 41118, 41118, 41121, 41121, 41124, 41124, 41127, 41127, 32767, 32767, 0,
+	32767, 103, 285, 428, 7524, 429, 425, 278, 296, 297, 417, 1126, 35, 13, 126, 422,
+	7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 300, 1134, 301, 1136, 318,
+	319, 146, 388, 389, 54, 33, 15860, 15813, 15814, 15815, 15817, 15818, 15849, 15850, 15851, 15831,
+	7520, 15813, 15814, 15815, 15817, 15818, 15819, 15820, 15821, 15822, 15823, 15824, 15825, 15826, 15827, 15828,
+	15829, 15830, 15831, 15832, 15833, 15834, 15835, 15836, 15837, 15838, 15839, 15840, 15841, 15842, 15843, 15844,
+	15845, 15846, 15847, 15848, 15849, 15850, 15851, 15852, 15853, 15854, 15855, 15856, 15857, 15861, 36837, 36839,
+	15581, 15456, 15457, 15678, 15458, 15680, 15681, 15459, 15460, 15461, 15684, 15685, 15686, 15687, 15688, 15689,
+	15482, 15462, 15463, 15464, 15489, 15465, 15466, 15467, 15468, 15469, 15470, 15471, 15472, 15473, 15474, 32767,
+	32767, 32767, 15582, 15583, 15584, 15585, 15586, 15587, 32767, 32767, 15588, 15589, 15590, 15591, 15592, 15593,
+	32767, 32767, 15594, 15595, 15596, 15597, 15598, 15599, 32767, 32767, 15600, 15601, 15602, 32767, 32767, 32767,
+	7523, 7525, 1133, 696, 1135, 7526, 7552, 32767, 1643, 1004, 1006, 1005, 1007, 1801, 1844, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 0, 0, 6997, 41130, 32767, 32767,
+	18407, 18408, 18409, 18410, 18411, 18412, 18413, 18414, 18415, 18416, 18417, 18418, 32767, 18419, 18420, 18421,
+	18422, 18423, 18424, 18425, 18426, 18427, 18428, 18429, 18430, 18431, 18432, 18433, 18434, 18435, 18436, 18437,
+	18438, 18439, 18440, 18441, 18442, 18443, 18444, 32767, 18445, 18446, 18447, 18448, 18449, 18450, 18451, 18452,
+	18453, 18454, 18455, 18456, 18457, 18458, 18459, 18460, 18461, 18462, 18463, 32767, 18464, 18465, 32767, 18466,
+	18467, 18468, 18469, 18470, 18471, 18472, 18473, 18474, 18475, 18476, 18477, 18478, 18479, 18480, 32767, 32767,
+	18481, 18482, 18483, 18484, 18485, 18486, 18487, 18488, 18489, 18490, 18491, 18492, 18493, 18494, 32767, 32767,
+	18495, 18496, 18497, 18498, 18499, 18500, 18501, 18502, 18503, 18504, 18505, 18506, 18507, 18508, 18509, 18510,
+	18511, 18512, 18513, 18514, 18515, 18516, 18517, 18518, 18519, 18520, 18521, 18522, 18523, 18524, 18525, 18526,
+	18527, 18528, 18529, 18530, 18531, 18532, 18533, 18534, 18535, 18536, 18537, 18538, 18539, 18540, 18541, 18542,
+	18543, 18544, 18545, 18546, 18547, 18548, 18549, 18550, 18551, 18552, 18553, 18554, 18555, 18556, 18557, 18558,
+	18559, 18560, 18561, 18562, 18563, 18564, 18565, 18566, 18567, 18568, 18569, 18570, 18571, 18572, 18573, 18574,
+	18575, 18576, 18577, 18578, 18579, 18580, 18581, 18582, 18583, 18584, 18585, 18586, 18587, 18588, 18589, 18590,
+	18591, 18592, 18593, 18594, 18595, 18596, 18597, 18598, 18599, 18600, 18601, 18602, 18603, 18604, 18605, 18606,
+	18607, 18608, 18609, 18610, 18611, 18612, 18613, 18614, 18615, 18616, 18617, 32767, 32767, 32767, 32767, 32767,
+	267, 268, 269, 32767, 32767, 32767, 32767, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	7102, 7103, 7104, 7105, 7106, 7107, 7108, 7109, 7110, 7111, 7112, 7113, 7114, 7115, 7116, 7117,
+	7118, 7119, 7120, 7121, 7122, 7123, 7124, 7125, 7126, 7127, 7128, 7129, 7130, 7131, 7132, 7133,
+	7134, 7135, 7136, 7137, 32767, 32767, 32767, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788,
+	7138, 7139, 7577, 7581, 7140, 7141, 7142, 7143, 7581, 7144, 7145, 7146, 7147, 7148, 7149, 7581,
+	7150, 7151, 7152, 7153, 7154, 7155, 7156, 7157, 7577, 7577, 7577, 7578, 7578, 7578, 7578, 7581,
+	7158, 7159, 7160, 7161, 7162, 7163, 7164, 7165, 7166, 7167, 7168, 7169, 7170, 7171, 7172, 7173,
+	7174, 7175, 7176, 7581, 7177, 7178, 7179, 7180, 7181, 3789, 3790, 3791, 3792, 3793, 3794, 3795,
+	3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 7576, 7182, 3806, 3807, 3808, 32767,
+	3809, 3810, 3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 32767, 32767, 32767,
+	3822, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	3823, 3824, 3825, 3826, 3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838,
+	3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854,
+	3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 41132, 32767, 32767,
+	17836, 17837, 17838, 17839, 17840, 17841, 17842, 17843, 17844, 17845, 17846, 17847, 17848, 17849, 17850, 17851,
+	17852, 17853, 17854, 17855, 17856, 17857, 17858, 17859, 17860, 17861, 17862, 17863, 17864, 32767, 32767, 32767,
+	17865, 17866, 17867, 17868, 17869, 17870, 17871, 17872, 17873, 17874, 17875, 17876, 17877, 17878, 17879, 17880,
+	17881, 17882, 17883, 17884, 17885, 17886, 17887, 17888, 17889, 17890, 17891, 17892, 17893, 17894, 17895, 17896,
+	17897, 17898, 17899, 17900, 17901, 17902, 17903, 17904, 17905, 17906, 17907, 17908, 17909, 17910, 17911, 17912,
+	17913, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	0, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7183, 7184, 7185, 7186, 7187, 7188,
+	7189, 7190, 7191, 7192, 7193, 7194, 7195, 7196, 7197, 7198, 7199, 7200, 32767, 32767, 32767, 32767,
+	17940, 17941, 17942, 17943, 17944, 17945, 17946, 17947, 17948, 17949, 17950, 17951, 17952, 17953, 17954, 17956,
+	17957, 17958, 17959, 17960, 17961, 17962, 17963, 17964, 17965, 17966, 17967, 17968, 17969, 17970, 17971, 17955,
+	7577, 7581, 7096, 7097, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 17972, 17973, 17974,
+	17975, 17976, 17977, 17978, 17979, 17980, 17981, 17982, 17983, 17984, 17985, 17986, 17987, 17988, 17989, 17990,
+	17991, 17992, 17993, 17994, 17995, 17996, 17997, 17998, 17999, 18000, 18001, 32767, 32767, 32767, 32767, 32767,
+	8292, 8293, 8294, 8295, 8296, 8297, 8298, 8299, 8300, 8301, 8302, 8303, 8304, 8305, 8306, 8307,
+	8308, 8309, 8310, 8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321, 8322, 8323,
+	8324, 8325, 8326, 8327, 8328, 8329, 8292, 8295, 8299, 8305, 8309, 32767, 32767, 32767, 32767, 32767,
+	19434, 19435, 19436, 19437, 19438, 19439, 19440, 19441, 19442, 19443, 19444, 19445, 19446, 19447, 19448, 19449,
+	19450, 19451, 19452, 19453, 19454, 19455, 19456, 19457, 19458, 19459, 19460, 19461, 19462, 19463, 32767, 270,
+	19464, 19465, 19466, 19467, 19468, 19469, 19470, 19471, 19472, 19473, 19474, 19475, 19476, 19477, 19478, 19479,
+	19480, 19481, 19482, 19483, 19484, 19485, 19486, 19487, 19488, 19489, 19490, 19491, 19492, 19493, 19494, 19495,
+	19496, 19497, 19498, 19499, 32767, 32767, 32767, 32767, 19500, 19501, 19502, 19503, 19504, 19505, 19506, 19507,
+	271, 7577, 7578, 7201, 7202, 7203, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18002, 18003, 18004, 18005, 18006, 18007, 18008, 18009, 18010, 18011, 18012, 18013, 18014, 18015, 18016, 18017,
+	18018, 18019, 18020, 18021, 18022, 18023, 18024, 18025, 18026, 18027, 18028, 18029, 18030, 18031, 18032, 18033,
+	18034, 18035, 18036, 18037, 18038, 18039, 18040, 18041, 18002, 18003, 18004, 18005, 18006, 18007, 18008, 18009,
+	18010, 18011, 18012, 18013, 18014, 18015, 18016, 18017, 18018, 18019, 18020, 18021, 18022, 18023, 18024, 18025,
+	18026, 18027, 18028, 18029, 18030, 18031, 18032, 18033, 18034, 18035, 18036, 18037, 18038, 18039, 18040, 18041,
+	18042, 18043, 18044, 18045, 18046, 18047, 18048, 18049, 18050, 18051, 18052, 18053, 18054, 18055, 18056, 18057,
+	18058, 18059, 18060, 18061, 18062, 18063, 18064, 18065, 18066, 18067, 18068, 18069, 18070, 18071, 18072, 18073,
+	18074, 18075, 18076, 18077, 18078, 18079, 18080, 18081, 18082, 18083, 18084, 18085, 18086, 18087, 18088, 18089,
+	18229, 18230, 18231, 18232, 18233, 18234, 18235, 18236, 18237, 18238, 18239, 18240, 18241, 18242, 18243, 18244,
+	18245, 18246, 18247, 18248, 18249, 18250, 18251, 18252, 18253, 18254, 18255, 18256, 18257, 18258, 32767, 32767,
+	13343, 13344, 13345, 13346, 13347, 13348, 13349, 13350, 13351, 13352, 13353, 13354, 13355, 13356, 13357, 13358,
+	13359, 13360, 13361, 13362, 13363, 13364, 13365, 13366, 13367, 13368, 13369, 13370, 13371, 13372, 13373, 13374,
+	13375, 13376, 13377, 13378, 32767, 32767, 32767, 32767, 13343, 13344, 13345, 13346, 13347, 13348, 13349, 13350,
+	13351, 13352, 13353, 13354, 13355, 13356, 13357, 13358, 13359, 13360, 13361, 13362, 13363, 13364, 13365, 13366,
+	13367, 13368, 13369, 13370, 13371, 13372, 13373, 13374, 13375, 13376, 13377, 13378, 32767, 32767, 32767, 32767,
+	18259, 18260, 18261, 18262, 18263, 18264, 18265, 18266, 18267, 18268, 18269, 18270, 18271, 18272, 18273, 18274,
+	18275, 18276, 18277, 18278, 18279, 18280, 18281, 18282, 18283, 18284, 18285, 18286, 18287, 18288, 18289, 18290,
+	18291, 18292, 18293, 18294, 18295, 18296, 18297, 18298, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18299, 18300, 18301, 18302, 18303, 18304, 18305, 18306, 18307, 18308, 18309, 18310, 18311, 18312, 18313, 18314,
+	18315, 18316, 18317, 18318, 18319, 18320, 18321, 18322, 18323, 18324, 18325, 18326, 18327, 18328, 18329, 18330,
+	18331, 18332, 18333, 18334, 18335, 18336, 18337, 18338, 18339, 18340, 18341, 18342, 18343, 18344, 18345, 18346,
+	18347, 18348, 18349, 18350, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 606,
+	18618, 18619, 18620, 18621, 18622, 18623, 18624, 18625, 18626, 18627, 18628, 18629, 18630, 18631, 18632, 18633,
+	18634, 18635, 18636, 18637, 18638, 18639, 18640, 18641, 18642, 18643, 18644, 18645, 18646, 18647, 18648, 18649,
+	18650, 18651, 18652, 18653, 18654, 18655, 18656, 18657, 18658, 18659, 18660, 18661, 18662, 18663, 18664, 18665,
+	18666, 18667, 18668, 18669, 18670, 18671, 18672, 18673, 18674, 18675, 18676, 18677, 18678, 18679, 18680, 18681,
+	18682, 18683, 18684, 18685, 18686, 18687, 18688, 18689, 18690, 18691, 18692, 18693, 18694, 18695, 18696, 18697,
+	18698, 18699, 18700, 18701, 18702, 18703, 18704, 18705, 18706, 18707, 18708, 18709, 18710, 18711, 18712, 18713,
+	18714, 18715, 18716, 18717, 18718, 18719, 18720, 18721, 18722, 18723, 18724, 18725, 18726, 18727, 18728, 18729,
+	18730, 18731, 18732, 18733, 18734, 18735, 18736, 18737, 18738, 18739, 18740, 18741, 18742, 18743, 18744, 18745,
+	18746, 18747, 18748, 18749, 18750, 18751, 18752, 18753, 18754, 18755, 18756, 18757, 18758, 18759, 18760, 18761,
+	18762, 18763, 18764, 18765, 18766, 18767, 18768, 18769, 18770, 18771, 18772, 18773, 18774, 18775, 18776, 18777,
+	18778, 18779, 18780, 18781, 18782, 18783, 18784, 18785, 18786, 18787, 18788, 18789, 18790, 18791, 18792, 18793,
+	18794, 18795, 18796, 18797, 18798, 18799, 18800, 18801, 18802, 18803, 18804, 18805, 18806, 18807, 18808, 18809,
+	18810, 18811, 18812, 18813, 18814, 18815, 18816, 18817, 18818, 18819, 18820, 18821, 18822, 18823, 18824, 18825,
+	18826, 18827, 18828, 18829, 18830, 18831, 18832, 18833, 18834, 18835, 18836, 18837, 18838, 18839, 18840, 18841,
+	18842, 18843, 18844, 18845, 18846, 18847, 18848, 18849, 18850, 18851, 18852, 18853, 18854, 18855, 18856, 18857,
+	18858, 18859, 18860, 18861, 18862, 18863, 18864, 18865, 18866, 18867, 18868, 18869, 18870, 18871, 18872, 18873,
+	18874, 18875, 18876, 18877, 18878, 18879, 18880, 18881, 18882, 18883, 18884, 18885, 18886, 18887, 18888, 18889,
+	18890, 18891, 18892, 18893, 18894, 18895, 18896, 18897, 18898, 18899, 18900, 18901, 18902, 18903, 18904, 18905,
+	18906, 18907, 18908, 18909, 18910, 18911, 18912, 18913, 18914, 18915, 18916, 18917, 18918, 18919, 18920, 18921,
+	18922, 18923, 18924, 18925, 18926, 18927, 18928, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18929, 18930, 18931, 18932, 18933, 18934, 18935, 18936, 18937, 18938, 18939, 18940, 18941, 18942, 18943, 18944,
+	18945, 18946, 18947, 18948, 18949, 18950, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18951, 18952, 18953, 18954, 18955, 18956, 18957, 18958, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18959, 18960, 18961, 18962, 18963, 18964, 32767, 32767, 18965, 32767, 18966, 18967, 18968, 18969, 18970, 18971,
+	18972, 18973, 18974, 18975, 18976, 18977, 18978, 18979, 18980, 18981, 18982, 18983, 18984, 18985, 18986, 18987,
+	18988, 18989, 18990, 18991, 18992, 18993, 18994, 18995, 18996, 18997, 18998, 18999, 19000, 19001, 19002, 19003,
+	19004, 19005, 19006, 19007, 19008, 19009, 32767, 19010, 19011, 32767, 32767, 32767, 19012, 32767, 32767, 19013,
+	19190, 19191, 19192, 19193, 19194, 19195, 19196, 19197, 19198, 19199, 19200, 19201, 19202, 19203, 19204, 19205,
+	19206, 19207, 19208, 19209, 19210, 19211, 32767, 226, 7577, 7578, 7579, 7219, 7220, 7221, 7222, 7223,
+	19125, 19126, 19127, 19128, 19129, 19130, 19131, 19132, 19133, 19134, 19135, 19136, 19137, 19138, 19138, 19139,
+	19140, 19141, 19142, 19143, 19144, 19145, 19146, 3868, 3869, 7577, 7578, 7579, 7580, 7581, 7204, 7205,
+	19147, 19147, 19148, 19148, 19149, 19150, 19151, 19151, 19152, 19153, 19154, 19155, 19156, 19156, 19157, 19157,
+	19158, 19158, 19159, 19159, 19160, 19160, 19161, 19162, 19163, 19164, 19165, 19166, 19167, 19167, 19168, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 7577, 7578, 7579, 7580, 7580, 7581, 7206, 7207, 7208,
+	19169, 19170, 19171, 19172, 19173, 19174, 19175, 19176, 19177, 19178, 19179, 19180, 19181, 19182, 19183, 19184,
+	19185, 19186, 19187, 32767, 19188, 19189, 32767, 32767, 32767, 32767, 32767, 7577, 7581, 7209, 7210, 7211,
+	8479, 8480, 8481, 8482, 8483, 8484, 8485, 8486, 8487, 8488, 8489, 8490, 8491, 8492, 8493, 8494,
+	8495, 8496, 8497, 8498, 8499, 8500, 7577, 7216, 7217, 7218, 7578, 7579, 32767, 32767, 32767, 272,
+	17914, 17915, 17916, 17917, 17918, 17919, 17920, 17921, 17922, 17923, 17924, 17925, 17926, 17927, 17928, 17929,
+	17930, 17931, 17932, 17933, 17934, 17935, 17936, 17937, 17938, 17939, 32767, 32767, 32767, 32767, 32767, 266,
+	41134, 41137, 41140, 41143, 41146, 41149, 41152, 41155, 41158, 41161, 41164, 41167, 41170, 41173, 41176, 41179,
+	41182, 41185, 41188, 41191, 41194, 41197, 41200, 41203, 41206, 41209, 41212, 41215, 41218, 41221, 21722, 21723,
+	21697, 21698, 21699, 21700, 21701, 21702, 21703, 21704, 21705, 21706, 21707, 21708, 21709, 21710, 21711, 21712,
+	41224, 21713, 21714, 21715, 21716, 21717, 21718, 21719, 32767, 32767, 32767, 32767, 7467, 7456, 21720, 21721,
+	7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7413, 7414, 7415, 7416, 7417, 7418, 7419,
+	32767, 32767, 7420, 7421, 7422, 7423, 7424, 7425, 7426, 7427, 7428, 7429, 7430, 7431, 7432, 7433,
+	7434, 7435, 7436, 7437, 7438, 7439, 7440, 7441, 7442, 7443, 7444, 7445, 7446, 7447, 7448, 7449,
+	7450, 7451, 7452, 7453, 7454, 7455, 7457, 7458, 7459, 7460, 7461, 7462, 7463, 7464, 7465, 7466,
+	11418, 11419, 11420, 11421, 32767, 11422, 11423, 32767, 32767, 32767, 32767, 32767, 11424, 33300, 33740, 33742,
+	11425, 11427, 11428, 11429, 32767, 11430, 11431, 11432, 32767, 11433, 11434, 11436, 11438, 11439, 11440, 11441,
+	11442, 11443, 11444, 11445, 11446, 11447, 11448, 11449, 11450, 11451, 11452, 11453, 11454, 11456, 11457, 11458,
+	11459, 11460, 11426, 11437, 11435, 11455, 32767, 32767, 41227, 41229, 41231, 32767, 32767, 32767, 32767, 11461,
+	7577, 7578, 7579, 7580, 7262, 7263, 7264, 7265, 7266, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	612, 613, 614, 615, 616, 617, 178, 179, 618, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	19014, 19015, 19016, 19017, 19018, 19019, 19020, 19021, 19022, 19023, 19024, 19025, 19026, 19027, 19028, 19029,
+	19030, 19031, 19032, 19033, 19034, 19035, 19036, 19037, 19038, 19039, 19040, 19041, 19042, 7577, 7212, 7213,
+	19043, 19044, 19045, 19046, 19047, 19048, 19049, 19050, 19051, 19052, 19053, 19054, 19055, 19056, 19057, 19058,
+	19059, 19060, 19061, 19062, 19063, 19064, 19065, 19066, 19067, 19068, 19069, 19070, 19071, 7577, 7214, 7215,
+	19293, 19294, 19295, 19296, 19297, 19298, 19299, 19300, 41233, 19301, 19302, 19303, 19304, 19305, 19306, 19307,
+	19308, 19309, 19310, 19311, 19312, 19313, 19314, 19315, 19316, 19317, 19318, 19319, 19320, 19321, 19322, 19323,
+	19324, 19325, 19326, 19327, 19328, 33288, 33300, 32767, 32767, 32767, 32767, 7577, 7581, 7224, 7225, 7226,
+	623, 624, 625, 626, 627, 628, 629, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	19072, 19073, 19074, 19075, 19076, 19077, 19078, 19079, 19080, 19081, 19082, 19083, 19084, 19085, 19086, 19087,
+	19088, 19089, 19090, 19091, 19092, 19093, 19094, 19095, 19096, 19097, 19098, 19099, 19100, 19101, 19102, 19103,
+	19104, 19105, 19106, 19107, 19108, 19109, 19110, 19111, 19112, 19113, 19114, 19115, 19116, 19117, 41236, 19118,
+	19119, 19120, 19121, 19122, 19123, 19124, 32767, 32767, 32767, 622, 227, 228, 229, 230, 231, 232,
+	19212, 19213, 19214, 19215, 19216, 19217, 19218, 19219, 19220, 19221, 19222, 19223, 19224, 19225, 19226, 19227,
+	19228, 19229, 19230, 19231, 19232, 19233, 32767, 32767, 7577, 7578, 7579, 7580, 7227, 7228, 7229, 7230,
+	19234, 19235, 19236, 19237, 19238, 19239, 19240, 19241, 19242, 19243, 19244, 19245, 19246, 19247, 19248, 19249,
+	19250, 19251, 19252, 32767, 32767, 32767, 32767, 32767, 7577, 7578, 7579, 7580, 7231, 7232, 7233, 7234,
+	19253, 19254, 19255, 19256, 19257, 19258, 19259, 19260, 19261, 19262, 19263, 19264, 19265, 19266, 19267, 19268,
+	19269, 19270, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 630, 631, 632, 633, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 7577, 7578, 7579, 7580, 7235, 7236, 7237,
+	14199, 41239, 14200, 14201, 41242, 14202, 14203, 14204, 41245, 14205, 41248, 14206, 41251, 14207, 41254, 14208,
+	41257, 14209, 41260, 14210, 14211, 41263, 14212, 41266, 14213, 41269, 14214, 41272, 14215, 41275, 14216, 41278,
+	14217, 14218, 14219, 14220, 14221, 41281, 14222, 41284, 14223, 41287, 14224, 41290, 14225, 14226, 41293, 14227,
+	14228, 14229, 14230, 41296, 14231, 41299, 14232, 41302, 14233, 41305, 14234, 41308, 14235, 14236, 14237, 14238,
+	41311, 14239, 41314, 14240, 41317, 14241, 41320, 14242, 14243, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	14158, 41323, 14159, 14160, 14161, 14162, 14163, 14164, 14165, 14166, 41326, 41329, 14167, 14168, 14169, 14170,
+	14171, 41332, 14172, 14173, 14174, 14175, 14176, 14177, 14178, 14179, 14180, 14181, 41335, 14182, 41338, 41341,
+	14183, 14184, 14185, 41344, 14186, 14187, 14188, 14189, 14190, 14191, 14192, 41347, 14193, 41350, 14194, 14195,
+	14196, 14197, 14198, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	14196, 14197, 14198, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 7577, 7581, 7098, 7099, 7100, 7101,
+	12550, 12556, 12557, 12558, 12559, 12560, 12561, 12562, 12563, 12564, 12565, 12566, 12567, 12568, 12569, 12570,
+	12571, 12572, 12573, 12574, 12575, 12576, 12577, 12578, 12579, 12580, 12581, 12582, 12583, 12551, 12552, 12553,
+	12554, 12555, 12584, 12585, 33288, 33288, 33288, 33288, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7073, 7074, 7075, 7076, 7077, 7078, 7079,
+	7080, 7081, 7082, 7083, 7084, 7085, 7086, 7087, 7088, 7089, 7090, 7091, 7092, 7093, 7094, 32767,
+	19369, 19370, 19371, 19372, 19373, 19374, 19375, 19376, 19377, 19378, 19379, 19380, 19381, 19382, 19383, 19384,
+	19385, 19386, 19387, 19388, 19389, 19390, 19391, 19392, 19393, 19394, 19395, 19396, 19397, 19398, 19399, 19400,
+	19401, 19403, 19404, 19405, 19406, 19407, 19408, 19409, 19410, 19412, 32767, 33540, 33538, 34, 32767, 32767,
+	19402, 19411, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	19329, 19329, 19330, 19330, 19331, 19332, 19332, 19333, 19334, 19335, 19336, 19337, 19338, 19339, 19340, 19340,
+	41353, 19341, 19342, 41356, 19343, 19344, 19344, 41359, 19345, 19346, 19347, 19347, 41362, 7577, 7578, 7579,
+	7580, 7581, 7238, 7239, 7240, 7241, 7242, 41365, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	19348, 19349, 19350, 19351, 19352, 19353, 19354, 19355, 19356, 19357, 19358, 19359, 19360, 19361, 19362, 19363,
+	19364, 19365, 19366, 19367, 19368, 41368, 33300, 33300, 33288, 33288, 33288, 33300, 33288, 33300, 33300, 33300,
+	33300, 7577, 7243, 7244, 7245, 233, 234, 235, 236, 237, 32767, 32767, 32767, 32767, 32767, 32767,
+	19413, 19414, 19415, 19416, 19417, 19418, 19419, 19420, 19421, 19422, 19423, 19424, 19425, 19426, 19427, 19428,
+	19429, 19430, 19431, 19432, 19433, 7577, 7578, 7579, 7580, 7246, 7247, 7248, 32767, 32767, 32767, 32767,
+	19271, 19272, 19273, 19274, 19275, 19276, 19277, 19278, 19279, 19280, 19281, 19282, 19283, 19284, 19285, 19286,
+	19287, 19288, 19289, 19290, 19291, 19292, 41371, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	33738, 33740, 33742, 11396, 11397, 11349, 11350, 11351, 11352, 11353, 11354, 11355, 11356, 11357, 11358, 11359,
+	11360, 11361, 11362, 11363, 11364, 11365, 11366, 11367, 11368, 11369, 11370, 11371, 11372, 11373, 11374, 11375,
+	11376, 11377, 11378, 11379, 11380, 11381, 11382, 11383, 11384, 11385, 11386, 11387, 11388, 11389, 11390, 11391,
+	11392, 11393, 11394, 11395, 11398, 11399, 11400, 11401, 11402, 11403, 11404, 11405, 11406, 11407, 11408, 11409,
+	11410, 11411, 11412, 11413, 11414, 11415, 11416, 180, 181, 607, 608, 609, 610, 611, 32767, 32767,
+	32767, 32767, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7251, 7252, 7253, 7254, 7255,
+	7256, 7257, 7258, 7259, 7260, 7261, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 11417,
+	33738, 33740, 33742, 10290, 10291, 10292, 10293, 10294, 10295, 10296, 10297, 10298, 10299, 10300, 10301, 10302,
+	10303, 10304, 10305, 10306, 10307, 10308, 10309, 10310, 10311, 10312, 41374, 10313, 41377, 10314, 10315, 10316,
+	10317, 10318, 10319, 10320, 10321, 10322, 10323, 10324, 10325, 10326, 10327, 41380, 10328, 10329, 10330, 10331,
+	10332, 10333, 10334, 10335, 10336, 10337, 10338, 10339, 10340, 10341, 33753, 634, 635, 0, 238, 239,
+	182, 183, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 32767, 32767,
+	18351, 18352, 18353, 18354, 18355, 18356, 18357, 18358, 18359, 18360, 18361, 18362, 18363, 18364, 18365, 18366,
+	18367, 18368, 18369, 18370, 18371, 18372, 18373, 18374, 18375, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	33738, 33740, 33742, 12586, 12587, 12588, 12589, 12590, 12591, 12592, 12593, 12594, 12595, 12596, 12597, 12598,
+	12599, 12600, 12601, 12602, 12603, 12604, 12605, 12606, 12607, 12608, 12609, 12610, 12611, 12612, 12613, 12614,
+	12615, 12616, 12617, 12618, 12620, 12621, 12622, 12624, 12625, 12626, 12627, 12628, 12629, 12630, 12631, 12632,
+	12633, 12634, 12635, 12638, 12639, 32767, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	240, 184, 185, 122, 12623, 12636, 12637, 12619, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	10342, 10343, 10344, 10345, 10346, 10347, 10348, 10349, 10350, 10351, 10352, 10353, 10354, 10355, 10356, 10357,
+	10358, 10359, 10360, 10361, 10362, 10363, 10364, 10365, 10366, 10367, 10368, 10369, 10370, 10371, 10372, 10373,
+	10375, 10376, 10377, 33753, 636, 637, 10374, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	33738, 33740, 33742, 10380, 10381, 10382, 10383, 10384, 10385, 10386, 10387, 10388, 10389, 10390, 10391, 10392,
+	10393, 10394, 10395, 10396, 10397, 10398, 10399, 10400, 10401, 10402, 10403, 10404, 10405, 10406, 10407, 10408,
+	10409, 10410, 10411, 10412, 10413, 10414, 10415, 10416, 10417, 10418, 10419, 10420, 10421, 10422, 10423, 10424,
+	10425, 10426, 10427, 10432, 10433, 10434, 10435, 10436, 10437, 10438, 10439, 10440, 10441, 10443, 10444, 10445,
+	10446, 10428, 10429, 10430, 10378, 186, 187, 639, 241, 33791, 33753, 41383, 41385, 638, 10442, 33738,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 10379, 640, 10431, 641, 242, 243,
+	32767, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7277, 7278, 7279, 7280, 7281, 7282,
+	7283, 7284, 7285, 7286, 7287, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	10447, 10448, 10449, 10450, 10451, 10452, 10453, 10454, 10455, 10456, 10457, 10458, 10459, 10460, 10461, 10462,
+	10463, 10464, 32767, 10465, 10466, 10467, 10468, 10469, 10470, 10471, 10472, 10473, 10474, 10475, 10476, 10477,
+	10478, 10479, 10480, 10481, 10482, 10483, 10484, 10485, 10486, 10487, 10488, 10489, 10490, 10491, 10492, 10493,
+	10494, 10495, 10496, 10497, 33740, 10498, 33753, 33534, 188, 189, 642, 643, 644, 645, 33536, 32767,
+	10556, 10557, 10558, 10559, 10562, 10563, 10564, 32767, 10565, 32767, 10566, 10567, 10568, 10569, 32767, 10570,
+	10571, 10572, 10573, 10574, 10575, 10576, 10577, 10578, 10579, 10580, 10581, 10582, 10583, 10584, 32767, 10585,
+	10586, 10587, 10588, 10589, 10590, 10560, 10561, 10591, 10592, 244, 32767, 32767, 32767, 32767, 32767, 32767,
+	10499, 10500, 10501, 10502, 10503, 10504, 10505, 10506, 10507, 10508, 10509, 10510, 10511, 10512, 10513, 10514,
+	10515, 10516, 10517, 10518, 10519, 10520, 10521, 10522, 10523, 10524, 10525, 10526, 10527, 10528, 10529, 10530,
+	10531, 10532, 10533, 10534, 10535, 10536, 10537, 10538, 10539, 10540, 10541, 10542, 10543, 10544, 10545, 33740,
+	10546, 10547, 10548, 10549, 10550, 10551, 10552, 10553, 10554, 33753, 10555, 32767, 32767, 32767, 32767, 32767,
+	33740, 33738, 33740, 33742, 32767, 10594, 10595, 10596, 10597, 10598, 10599, 10600, 10602, 32767, 32767, 10604,
+	10605, 32767, 32767, 10606, 10607, 10608, 10609, 10610, 10611, 10612, 10613, 10614, 10615, 10616, 10617, 10618,
+	10619, 10620, 10621, 10622, 10623, 10624, 10625, 10626, 10627, 32767, 10628, 10629, 10630, 10631, 10632, 10633,
+	10634, 32767, 10635, 10636, 32767, 10637, 10638, 10639, 10640, 10641, 32767, 33753, 33753, 10642, 10645, 10646,
+	10647, 10648, 10649, 10650, 10651, 32767, 32767, 10654, 10655, 32767, 32767, 10656, 10657, 10658, 32767, 32767,
+	10593, 32767, 32767, 32767, 32767, 32767, 32767, 10659, 32767, 32767, 32767, 32767, 32767, 10660, 10643, 10644,
+	10601, 10603, 10652, 10653, 32767, 32767, 0, 0, 0, 0, 0, 0, 0, 32767, 32767, 32767,
+	0, 0, 0, 0, 0, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	10663, 10664, 10665, 10666, 10667, 10668, 10669, 10670, 10671, 10672, 10673, 10674, 10675, 10676, 10677, 10678,
+	10679, 10680, 10681, 10682, 10683, 10684, 10685, 10686, 10687, 10688, 10689, 10690, 10691, 10692, 10693, 10694,
+	10695, 10696, 10697, 10698, 10699, 10700, 10701, 10702, 10703, 10704, 10705, 10706, 10707, 10708, 10709, 10710,
+	10711, 10712, 10713, 10714, 10715, 10721, 10722, 10723, 10724, 10725, 10726, 10727, 10728, 10729, 10730, 10731,
+	10732, 10733, 10734, 33738, 33740, 33742, 33753, 10716, 10719, 10661, 10662, 190, 191, 646, 648, 649,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 647, 650, 32767, 651, 33791, 10720,
+	10717, 10718, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	10736, 10737, 10738, 10739, 10740, 10741, 10742, 10743, 10744, 10745, 10746, 10747, 10748, 10749, 10750, 10751,
+	10752, 10753, 10754, 10755, 10756, 10757, 10758, 10759, 10760, 10761, 10762, 10763, 10764, 10765, 10766, 10767,
+	10768, 10769, 10770, 10771, 10772, 10773, 10774, 10775, 10776, 10777, 10778, 10779, 10780, 10781, 10782, 10783,
+	10786, 10787, 10788, 10789, 10790, 10791, 10792, 10793, 10794, 10795, 10796, 10797, 10798, 10799, 10800, 33738,
+	33740, 33742, 10801, 33753, 10784, 10785, 652, 10735, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	10802, 10803, 10804, 10805, 10806, 10807, 10808, 10809, 10810, 10811, 10812, 10813, 10814, 10815, 10816, 10817,
+	10818, 10819, 10820, 10821, 10822, 10823, 10824, 10825, 10826, 10827, 10828, 10829, 10830, 10831, 10832, 10833,
+	10834, 10835, 10836, 10837, 10838, 10839, 10840, 10841, 10842, 10843, 10844, 10845, 10846, 10847, 10848, 10849,
+	10850, 10851, 10852, 10853, 10854, 10855, 32767, 32767, 10856, 10857, 10858, 10859, 33738, 33740, 33742, 10860,
+	33753, 653, 192, 193, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665,
+	666, 667, 668, 669, 670, 671, 672, 673, 41387, 41390, 41393, 41396, 41399, 41402, 32767, 32767,
+	10861, 10862, 10863, 10864, 10865, 10866, 10867, 10868, 10869, 10870, 10871, 10872, 10873, 10874, 10875, 10876,
+	10877, 10878, 10879, 10880, 10881, 10882, 10883, 10884, 10885, 10886, 10887, 10888, 10889, 10890, 10891, 10892,
+	10893, 10894, 10895, 10896, 10897, 10898, 10899, 10900, 10901, 10902, 10903, 10904, 10905, 10906, 10907, 10908,
+	10909, 10910, 10911, 10912, 10913, 10914, 10915, 10916, 10917, 10918, 10919, 10920, 10921, 33740, 33742, 10922,
+	33738, 194, 195, 674, 10923, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 32767, 32767, 32767,
+	10924, 10925, 10926, 10927, 10928, 10929, 10930, 10931, 10932, 10933, 10937, 10938, 10940, 10941, 10942, 10943,
+	10944, 10945, 10946, 10947, 10948, 10949, 10950, 10951, 10952, 10953, 10954, 10955, 10956, 10957, 10958, 10959,
+	10960, 10961, 10962, 10963, 10964, 10965, 10966, 10935, 10934, 10936, 10967, 33740, 33742, 10968, 10969, 10970,
+	10971, 10972, 10973, 10974, 10975, 10976, 10977, 33753, 10939, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11152, 11153, 11154, 11155, 11156, 41405, 11157, 11158, 11159, 11160, 11161, 11162, 11163, 11164, 11165, 11166,
+	11167, 11168, 11169, 11170, 11171, 11172, 41408, 11173, 11174, 11175, 41411, 32767, 32767, 11188, 11189, 11190,
+	11176, 11177, 11178, 11179, 11180, 11181, 11182, 11183, 11184, 11185, 11186, 11187, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7249, 7250, 196, 197, 245, 926,
+	11096, 11097, 11098, 11099, 11100, 11101, 11102, 11103, 11104, 11105, 11106, 11107, 11108, 11109, 11110, 11111,
+	11112, 11113, 11114, 11115, 11116, 11117, 11118, 11119, 11120, 11121, 11122, 11123, 11124, 11125, 11126, 11127,
+	11128, 11129, 11130, 11131, 11132, 11133, 11134, 11135, 11136, 11137, 11138, 11139, 11140, 11141, 11142, 11143,
+	11144, 11145, 11146, 11147, 11148, 11149, 11150, 33740, 33742, 11151, 33753, 675, 32767, 32767, 32767, 32767,
+	17562, 17563, 17564, 17565, 17566, 17567, 17568, 17569, 17570, 17571, 17572, 17573, 17574, 17575, 17576, 17577,
+	17578, 17579, 17580, 17581, 17582, 17583, 17584, 17585, 17586, 17587, 17588, 17589, 17590, 17591, 17592, 17593,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7288, 7289, 7290, 7291, 7292, 7293,
+	7294, 7295, 7296, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 17561,
+	10978, 10979, 10980, 10981, 10982, 10983, 10984, 32767, 32767, 10985, 32767, 32767, 10986, 10987, 10988, 10989,
+	10990, 10992, 10993, 10994, 32767, 10995, 10996, 32767, 10997, 10998, 10999, 11000, 11001, 11002, 11003, 11004,
+	11005, 11006, 11007, 11008, 11009, 11010, 11012, 11014, 11016, 11017, 11018, 11019, 11020, 11021, 11022, 11023,
+	11024, 11025, 11026, 11027, 11028, 11029, 32767, 11030, 11031, 32767, 32767, 33740, 33738, 11032, 11033, 10991,
+	11011, 11013, 11015, 33753, 198, 676, 246, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11034, 11035, 11036, 11037, 11038, 11039, 11040, 11041, 32767, 32767, 11042, 11043, 11044, 11045, 11046, 11047,
+	11048, 11049, 11050, 11051, 11052, 11053, 11054, 11055, 11056, 11057, 11058, 11059, 11060, 11061, 11062, 11063,
+	11064, 11065, 11066, 11067, 11068, 11069, 11070, 11071, 11072, 11073, 11074, 11075, 11076, 11077, 11078, 11079,
+	11080, 11083, 11084, 11085, 11086, 11087, 11088, 11089, 32767, 32767, 11090, 11092, 11093, 11094, 33740, 33742,
+	11095, 11081, 677, 11082, 11091, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11852, 11853, 11854, 11855, 11856, 11857, 11858, 11859, 11860, 11861, 11862, 11812, 11814, 11815, 11816, 11817,
+	11818, 11819, 11820, 11821, 11822, 11823, 11824, 11825, 11826, 11827, 11828, 11829, 11830, 11831, 11832, 11833,
+	11834, 11835, 11836, 11837, 11838, 11839, 11840, 11841, 11842, 11843, 11844, 11845, 11846, 11847, 11848, 11849,
+	11850, 11851, 11813, 33753, 11863, 33738, 33738, 33738, 33740, 33742, 11845, 11844, 11845, 11846, 11847, 550,
+	551, 552, 553, 554, 555, 556, 557, 11864, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11865, 11866, 11867, 11868, 11871, 11873, 11872, 11874, 11875, 11869, 11870, 11876, 11877, 11879, 11880, 11881,
+	11882, 11883, 11884, 11885, 11886, 11887, 11888, 11889, 11890, 11891, 11892, 11893, 11894, 11895, 11896, 11897,
+	11898, 11899, 11900, 11901, 11902, 11903, 11904, 11905, 11906, 11907, 11908, 11909, 11910, 11911, 11912, 11913,
+	11914, 11915, 11916, 11878, 11917, 11918, 11910, 11911, 11913, 11915, 11877, 11879, 11882, 11893, 11897, 11898,
+	11902, 11910, 11911, 11913, 11915, 11908, 33740, 33742, 41414, 11919, 558, 559, 560, 11920, 561, 562,
+	563, 564, 565, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	17601, 17602, 17603, 17604, 17605, 17606, 17607, 17608, 17609, 17610, 17611, 17612, 17613, 17614, 17615, 17616,
+	17617, 17618, 17619, 17620, 17621, 17594, 17595, 17596, 17597, 17598, 17599, 17600, 17622, 17623, 17629, 17624,
+	17625, 17626, 17627, 17628, 17630, 17636, 17634, 17648, 17637, 17635, 17649, 17644, 17642, 17645, 17643, 17631,
+	17650, 17633, 17632, 17640, 17638, 17646, 17641, 17639, 17647, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11462, 11463, 11464, 11465, 11466, 11467, 11468, 11469, 11470, 32767, 11471, 11472, 11473, 11474, 11475, 11476,
+	11477, 11478, 11479, 11480, 11481, 11482, 11483, 11484, 11485, 11486, 11487, 11488, 11489, 11490, 11491, 11492,
+	11493, 11494, 11495, 11496, 11497, 11498, 11499, 11500, 11501, 11502, 11503, 11504, 11505, 11506, 11507, 11509,
+	11510, 11511, 11512, 11513, 11514, 11515, 11516, 32767, 11517, 11518, 11519, 11520, 33738, 33740, 33742, 11521,
+	11508, 199, 200, 619, 620, 621, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7583, 7584, 7585, 7267, 7268, 7269, 7270, 7271, 7272, 7273, 7274, 7275, 7276, 32767, 32767, 32767,
+	566, 567, 11921, 11923, 11925, 11927, 11929, 11931, 11933, 11935, 11937, 11939, 11941, 11943, 11945, 11947,
+	11949, 11951, 11953, 11955, 11957, 11959, 11961, 11963, 11965, 11966, 11968, 11970, 11972, 11974, 11976, 11978,
+	32767, 32767, 11922, 11924, 11926, 11928, 11930, 11932, 11934, 11936, 11938, 11940, 11942, 11944, 11946, 11948,
+	11950, 11952, 11954, 11956, 11958, 11960, 11962, 11964, 32767, 11967, 11969, 11971, 11973, 11975, 11977, 11979,
+	11980, 11981, 11982, 11983, 11984, 33740, 33738, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11191, 11192, 11193, 11194, 11195, 11196, 11197, 32767, 11198, 11199, 32767, 11200, 11201, 11202, 11203, 11204,
+	11205, 11206, 11207, 11208, 11209, 11210, 11211, 11212, 11213, 11214, 11215, 11216, 11217, 11218, 11219, 11220,
+	11221, 11222, 11223, 11224, 11225, 11226, 11227, 11228, 11229, 11230, 11231, 11232, 11233, 11234, 11235, 11236,
+	11237, 11238, 11239, 11240, 11241, 11242, 11243, 32767, 32767, 32767, 11244, 32767, 11245, 11246, 32767, 11247,
+	33740, 33742, 33753, 33738, 11248, 11249, 11227, 11227, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	11251, 11252, 11253, 11254, 11255, 11256, 32767, 11257, 11258, 32767, 11259, 11260, 11261, 11262, 11263, 11264,
+	11265, 11266, 11267, 11268, 11269, 11270, 11271, 11272, 11273, 11274, 11275, 11276, 11277, 11278, 11279, 11280,
+	11281, 11282, 11283, 11284, 11285, 11286, 11287, 11288, 11289, 11290, 11291, 11292, 11293, 11294, 11295, 32767,
+	11296, 11297, 32767, 11298, 11299, 33740, 33742, 11300, 11250, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	12252, 12253, 12254, 12255, 12256, 12257, 12258, 12259, 12260, 12261, 12262, 12263, 12264, 12265, 12266, 12267,
+	12268, 12269, 12270, 12271, 12272, 12273, 12274, 247, 248, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	17405, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7019, 7020, 7021, 7022, 7023, 7024, 7025, 7026, 7027, 7028, 7029, 7030, 7031, 7032, 7033, 7034,
+	7035, 7036, 7037, 7038, 7039, 848, 849, 850, 851, 852, 853, 854, 855, 7537, 7538, 7539,
+	7540, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870,
+	871, 872, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 678,
+	19508, 19509, 19510, 19511, 19512, 19513, 19514, 19515, 19516, 19517, 19518, 19519, 19520, 19521, 19522, 19523,
+	19524, 19525, 19526, 19527, 19528, 19529, 19530, 19531, 19532, 19533, 19534, 19535, 19536, 19537, 19538, 19539,
+	19540, 19541, 19542, 19543, 19544, 19545, 19546, 19547, 19548, 19549, 19550, 19551, 19552, 19553, 19554, 19555,
+	19556, 19557, 19558, 19559, 19560, 19561, 19562, 19563, 19564, 19565, 19566, 19567, 19568, 19569, 19570, 19571,
+	19572, 19573, 19574, 19575, 19576, 19577, 19578, 19579, 19580, 19581, 19582, 19583, 19584, 19585, 19586, 19587,
+	19588, 19589, 19590, 19591, 19592, 19593, 19594, 19595, 19596, 19597, 19598, 19599, 19600, 19601, 19602, 19603,
+	19604, 19605, 19606, 19607, 19608, 19609, 19610, 19611, 19612, 19613, 19614, 19615, 19616, 19617, 19618, 19619,
+	19620, 19621, 19622, 19623, 19624, 19625, 19626, 19627, 19628, 19629, 19630, 19631, 19632, 19633, 19634, 19635,
+	19636, 19637, 19638, 19639, 19640, 19641, 19642, 19643, 19644, 19645, 19646, 19647, 19648, 19649, 19650, 19651,
+	19652, 19653, 19654, 19655, 19656, 19657, 19658, 19659, 19660, 19661, 19662, 19663, 19664, 19665, 19666, 19667,
+	19668, 19669, 19670, 19671, 19672, 19673, 19674, 19675, 19676, 19677, 19678, 19679, 19680, 19681, 19682, 19683,
+	19684, 19685, 19686, 19687, 19688, 19689, 19690, 19691, 19692, 19693, 19694, 19695, 19696, 19697, 19698, 19699,
+	19700, 19701, 19702, 19703, 19704, 19705, 19706, 19707, 19708, 19709, 19710, 19711, 19712, 19713, 19714, 19715,
+	19716, 19717, 19718, 19719, 19720, 19721, 19722, 19723, 19724, 19725, 19726, 19727, 19728, 19729, 19730, 19731,
+	19732, 19733, 19734, 19735, 19736, 19737, 19738, 19739, 19740, 19741, 19742, 19743, 19744, 19745, 19746, 19747,
+	19748, 19749, 19750, 19751, 19752, 19753, 19754, 19755, 19756, 19757, 19758, 19759, 19760, 19761, 19762, 19763,
+	19764, 19765, 19766, 19767, 19768, 19769, 19770, 19771, 19772, 19773, 19774, 19775, 19776, 19777, 19778, 19779,
+	19780, 19781, 19782, 19783, 19784, 19785, 19786, 19787, 19788, 19789, 19790, 19791, 19792, 19793, 19794, 19795,
+	19796, 19797, 19798, 19799, 19800, 19801, 19802, 19803, 19804, 19805, 19806, 19807, 19808, 19809, 19810, 19811,
+	19812, 19813, 19814, 19815, 19816, 19817, 19818, 19819, 19820, 19821, 19822, 19823, 19824, 19825, 19826, 19827,
+	19828, 19829, 19830, 19831, 19832, 19833, 19834, 19835, 19836, 19837, 19838, 19839, 19840, 19841, 19842, 19843,
+	19844, 19845, 19846, 19847, 19848, 19849, 19850, 19851, 19852, 19853, 19854, 19855, 19856, 19857, 19858, 19859,
+	19860, 19861, 19862, 19863, 19864, 19865, 19866, 19867, 19868, 19869, 19870, 19871, 19872, 19873, 19874, 19875,
+	19876, 19877, 19878, 19879, 19880, 19881, 19882, 19883, 19884, 19885, 19886, 19887, 19888, 19889, 19890, 19891,
+	19892, 19893, 19894, 19895, 19896, 19897, 19898, 19899, 19900, 19901, 19902, 19903, 19904, 19905, 19906, 19907,
+	19908, 19909, 19910, 19911, 19912, 19913, 19914, 19915, 19916, 19917, 19918, 19919, 19920, 19921, 19922, 19923,
+	19924, 19925, 19926, 19927, 19928, 19929, 19930, 19931, 19932, 19933, 19934, 19935, 19936, 19937, 19938, 19939,
+	19940, 19941, 19942, 19943, 19944, 19945, 19946, 19947, 19948, 19949, 19950, 19951, 19952, 19953, 19954, 19955,
+	19956, 19957, 19958, 19959, 19960, 19961, 19962, 19963, 19964, 19965, 19966, 19967, 19968, 19969, 19970, 19971,
+	19972, 19973, 19974, 19975, 19976, 19977, 19978, 19979, 19980, 19981, 19982, 19983, 19984, 19985, 19986, 19987,
+	19988, 19989, 19990, 19991, 19992, 19993, 19994, 19995, 19996, 19997, 19998, 19999, 20000, 20001, 20002, 20003,
+	20004, 20005, 20006, 20007, 20008, 20009, 20010, 20011, 20012, 20013, 20014, 20015, 20016, 20017, 20018, 20019,
+	20020, 20021, 20022, 20023, 20024, 20025, 20026, 20027, 20028, 20029, 20030, 20031, 20032, 20033, 20034, 20035,
+	20036, 20037, 20038, 20039, 20040, 20041, 20042, 20043, 20044, 20045, 20046, 20047, 20048, 20049, 20050, 20051,
+	20052, 20053, 20054, 20055, 20056, 20057, 20058, 20059, 20060, 20061, 20062, 20063, 20064, 20065, 20066, 20067,
+	20068, 20069, 20070, 20071, 20072, 20073, 20074, 20075, 20076, 20077, 20078, 20079, 20080, 20081, 20082, 20083,
+	20084, 20085, 20086, 20087, 20088, 20089, 20090, 20091, 20092, 20093, 20094, 20095, 20096, 20097, 20098, 20099,
+	20100, 20101, 20102, 20103, 20104, 20105, 20106, 20107, 20108, 20109, 20110, 20111, 20112, 20113, 20114, 20115,
+	20116, 20117, 20118, 20121, 20122, 20123, 20124, 20125, 20126, 20127, 20128, 20129, 20130, 20131, 20132, 20133,
+	20134, 20135, 20136, 20137, 20138, 20139, 20140, 20141, 20142, 20143, 20144, 20145, 20146, 20147, 20148, 20149,
+	20150, 20151, 20152, 20153, 20154, 20155, 20156, 20157, 20158, 20159, 20160, 20161, 20162, 20163, 20164, 20165,
+	20166, 20167, 20168, 20169, 20170, 20171, 20172, 20173, 20174, 20175, 20176, 20177, 20178, 20179, 20180, 20181,
+	20182, 20183, 20184, 20185, 20186, 20187, 20188, 20189, 20190, 20191, 20192, 20193, 20194, 20195, 20196, 20197,
+	20198, 20199, 20200, 20201, 20202, 20203, 20204, 20205, 20206, 20207, 20208, 20209, 20210, 20211, 20212, 20213,
+	20214, 20215, 20216, 20217, 20218, 20219, 20220, 20221, 20222, 20223, 20224, 20225, 20226, 20227, 20228, 20229,
+	20230, 20231, 20232, 20233, 20119, 20120, 20234, 20235, 20236, 20237, 20238, 20239, 20240, 20241, 20242, 20243,
+	20244, 20245, 20246, 20247, 20248, 20249, 20250, 20251, 20252, 20253, 20254, 20255, 20256, 20257, 20258, 20259,
+	20260, 20261, 20262, 20263, 20264, 20265, 20266, 20267, 20268, 20269, 20270, 20271, 20272, 20273, 20274, 20275,
+	20276, 20277, 20278, 20279, 20280, 20281, 20282, 20283, 20284, 20285, 20286, 20287, 20288, 20289, 20290, 20291,
+	20292, 20293, 20294, 20295, 20296, 20297, 20298, 20299, 20300, 20301, 20302, 20303, 20304, 20305, 20306, 20307,
+	20308, 20309, 20310, 20311, 20312, 20313, 20314, 20315, 20316, 20317, 20318, 20319, 20320, 20321, 20322, 20323,
+	20324, 20325, 20326, 20327, 20328, 20329, 20330, 20331, 20332, 20333, 20334, 20335, 20336, 20337, 20338, 20339,
+	20340, 20341, 20342, 20343, 20344, 20345, 20346, 20347, 20348, 20349, 20350, 20351, 20352, 20353, 20354, 20355,
+	20356, 20357, 20358, 20359, 20360, 20361, 20362, 20363, 20364, 20365, 20366, 20367, 20368, 20369, 20370, 20371,
+	20372, 20373, 20374, 20375, 20376, 20377, 20378, 20379, 20380, 20381, 20382, 20383, 20384, 20385, 20386, 20387,
+	20388, 20389, 20390, 20391, 20392, 20393, 20394, 20395, 20396, 20397, 20398, 20399, 20400, 20401, 20402, 20403,
+	20404, 20405, 20406, 20407, 20408, 20409, 20410, 20411, 20412, 20413, 20414, 20415, 20416, 20417, 20418, 20419,
+	20420, 20421, 20422, 20423, 20424, 20425, 20426, 20427, 20428, 20429, 32767, 32767, 32767, 32767, 32767, 32767,
+	7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7580,
+	7581, 7582, 7583, 7584, 7585, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7577, 7578,
+	7579, 7580, 7581, 7578, 7579, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7577, 7578, 7579, 7579,
+	7580, 7581, 7468, 7469, 7577, 7578, 7579, 7579, 7580, 7581, 7579, 7579, 7580, 7580, 7580, 7580,
+	7582, 7583, 7583, 7583, 7584, 7584, 7585, 7585, 7585, 7585, 7578, 7579, 7580, 7581, 7582, 7577,
+	7578, 7579, 7580, 7580, 7581, 7581, 7578, 7579, 7577, 7578, 7470, 7471, 7472, 7473, 7474, 7475,
+	7476, 7477, 7478, 7479, 7480, 7481, 7482, 7483, 7484, 7580, 7581, 7582, 7583, 7584, 7585, 32767,
+	273, 274, 275, 276, 277, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	20430, 20431, 20432, 20433, 20434, 20435, 20436, 20437, 20438, 20439, 20440, 20441, 20442, 20443, 20444, 20445,
+	20446, 20447, 20448, 20449, 20450, 20451, 20452, 20453, 20454, 20455, 20456, 20457, 20458, 20459, 20460, 20461,
+	20462, 20463, 20464, 20465, 20466, 20467, 20468, 20469, 20470, 20471, 20472, 20473, 20474, 20475, 20476, 20477,
+	20478, 20479, 20480, 20481, 20482, 20483, 20484, 20485, 20486, 20487, 20488, 20489, 20490, 20491, 20492, 20493,
+	20494, 20495, 20496, 20497, 20498, 20499, 20500, 20501, 20502, 20503, 20504, 20505, 20506, 20507, 20508, 20509,
+	20510, 20511, 20512, 20513, 20514, 20515, 20516, 20517, 20518, 20519, 20520, 20521, 20522, 20523, 20524, 20525,
+	20526, 20527, 20528, 20529, 20530, 20531, 20532, 20533, 20534, 20535, 20536, 20537, 20538, 20539, 20540, 20541,
+	20542, 20543, 20544, 20545, 20546, 20547, 20548, 20549, 20550, 20551, 20552, 20553, 20554, 20555, 20556, 20557,
+	20558, 20559, 20560, 20561, 20562, 20563, 20564, 20565, 20566, 20567, 20568, 20569, 20570, 20571, 20572, 20573,
+	20574, 20575, 20576, 20577, 20578, 20579, 20580, 20581, 20582, 20583, 20584, 20585, 20586, 20587, 20588, 20589,
+	20590, 20591, 20592, 20593, 20594, 20595, 20596, 20597, 20598, 20599, 20600, 20601, 20602, 20603, 20604, 20605,
+	20606, 20607, 20608, 20609, 20610, 20611, 20612, 20613, 20614, 20615, 20616, 20617, 20618, 20619, 20620, 20621,
+	20622, 20623, 20624, 20625, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	20626, 20627, 20628, 20629, 20630, 20631, 20632, 20633, 20634, 20635, 20636, 20637, 20638, 20639, 20640, 20641,
+	20642, 20643, 20644, 20645, 20646, 20647, 20648, 20649, 20650, 20651, 20652, 20653, 20654, 20655, 20656, 20657,
+	20658, 20659, 20660, 20661, 20662, 20663, 20664, 20665, 20666, 20667, 20668, 20669, 20670, 20671, 20672, 20673,
+	20674, 20675, 20676, 20677, 20678, 20679, 20680, 20681, 20682, 20683, 20684, 20685, 20686, 20687, 20688, 20689,
+	20690, 20691, 20692, 20693, 20694, 20695, 20696, 20697, 20698, 20699, 20700, 20701, 20702, 20703, 20704, 20705,
+	20706, 20707, 20708, 20709, 20710, 20711, 20712, 20713, 20714, 20715, 20716, 20717, 20718, 20719, 20720, 20721,
+	20722, 20723, 20724, 20725, 20726, 20727, 20728, 20729, 20730, 20731, 20732, 20733, 20734, 20735, 20736, 20737,
+	20738, 20739, 20740, 20741, 20742, 20743, 20744, 20745, 20746, 20747, 20748, 20749, 20750, 20751, 20752, 20753,
+	20754, 20755, 20756, 20757, 20758, 20759, 20760, 20761, 20762, 20763, 20764, 20765, 20766, 20767, 20768, 20769,
+	20770, 20771, 20772, 20773, 20774, 20775, 20776, 20777, 20778, 20779, 20780, 20781, 20782, 20783, 20784, 20785,
+	20786, 20787, 20788, 20789, 20790, 20791, 20792, 20793, 20794, 20795, 20796, 20797, 20798, 20799, 20800, 20801,
+	20802, 20803, 20804, 20805, 20806, 20807, 20808, 20809, 20810, 20811, 20812, 20813, 20814, 20815, 20816, 20817,
+	20818, 20819, 20820, 20821, 20822, 20823, 20824, 20825, 20826, 20827, 20828, 20829, 20830, 20831, 20832, 20833,
+	20834, 20835, 20836, 20837, 20838, 20839, 20840, 20841, 20842, 20843, 20844, 20845, 20846, 20847, 20848, 20849,
+	20850, 20851, 20852, 20853, 20854, 20855, 20856, 20857, 20858, 20859, 20860, 20861, 20862, 20863, 20864, 20865,
+	20866, 20867, 20868, 20869, 20870, 20871, 20872, 20873, 20874, 20875, 20876, 20877, 20878, 20879, 20880, 20881,
+	20882, 20883, 20884, 20885, 20886, 20887, 20888, 20889, 20890, 20891, 20892, 20893, 20894, 20895, 20896, 20897,
+	20898, 20899, 20900, 20901, 20902, 20903, 20904, 20905, 20906, 20907, 20908, 20909, 20910, 20911, 20912, 20913,
+	20914, 20915, 20916, 20917, 20918, 20919, 20920, 20921, 20922, 20923, 20924, 20925, 20926, 20927, 20928, 20929,
+	20930, 20931, 20932, 20933, 20934, 20935, 20936, 20937, 20938, 20939, 20940, 20941, 20942, 20943, 20944, 20945,
+	20946, 20947, 20948, 20949, 20950, 20951, 20952, 20953, 20954, 20955, 20956, 20957, 20958, 20959, 20960, 20961,
+	20962, 20963, 20964, 20965, 20966, 20967, 20968, 20969, 20970, 20971, 20972, 20973, 20974, 20975, 20976, 20977,
+	20978, 20979, 20980, 20981, 20982, 20983, 20984, 20985, 20986, 20987, 20988, 20989, 20990, 20991, 20992, 20993,
+	20994, 20995, 20996, 20997, 20998, 20999, 21000, 21001, 21002, 21003, 21004, 21005, 21006, 21007, 21008, 21009,
+	21010, 21011, 21012, 21013, 21014, 21015, 21016, 21017, 21018, 21019, 21020, 21021, 21022, 21023, 21024, 21025,
+	21026, 21027, 21028, 21029, 21030, 21031, 21032, 21033, 21034, 21035, 21036, 21037, 21038, 21039, 21040, 21041,
+	21042, 21043, 21044, 21045, 21046, 21047, 21048, 21049, 21050, 21051, 21052, 21053, 21054, 21055, 21056, 21057,
+	21058, 21059, 21060, 21061, 21062, 21063, 21064, 21065, 21066, 21067, 21068, 21069, 21070, 21071, 21072, 21073,
+	21074, 21075, 21076, 21077, 21078, 21079, 21080, 21081, 21082, 21083, 21084, 21085, 21086, 21087, 21088, 21089,
+	21090, 21091, 21092, 21093, 21094, 21095, 21096, 21097, 21098, 21099, 21100, 21101, 21102, 21103, 21104, 21105,
+	21106, 21107, 21108, 21109, 21110, 21111, 21112, 21113, 21114, 21115, 21116, 21117, 21118, 21119, 21120, 21121,
+	21122, 21123, 21124, 21125, 21126, 21127, 21128, 21129, 21130, 21131, 21132, 21133, 21134, 21135, 21136, 21137,
+	21138, 21139, 21140, 21141, 21142, 21143, 21144, 21145, 21146, 21147, 21148, 21149, 21150, 21151, 21152, 21153,
+	21154, 21155, 21156, 21157, 21158, 21159, 21160, 21161, 21162, 21163, 21164, 21165, 21166, 21167, 21168, 21169,
+	21170, 21171, 21172, 21173, 21174, 21175, 21176, 21177, 21178, 21179, 21180, 21181, 21182, 21183, 21184, 21185,
+	21186, 21187, 21188, 21189, 21190, 21191, 21192, 21193, 21194, 21195, 21196, 21197, 21198, 21199, 21200, 21201,
+	21202, 21203, 21204, 21205, 21206, 21207, 21208, 21209, 21210, 21211, 21212, 21213, 21214, 21215, 21216, 21217,
+	21218, 21219, 21220, 21221, 21222, 21223, 21224, 21225, 21226, 21227, 21228, 21229, 21230, 21231, 21232, 21233,
+	21234, 21235, 21236, 21237, 21238, 21239, 21240, 21241, 21242, 21243, 21244, 21245, 21246, 21247, 21248, 21249,
+	21250, 21251, 21252, 21253, 21254, 21255, 21256, 21257, 21258, 21259, 21260, 21261, 21262, 21263, 21264, 21265,
+	21266, 21267, 21268, 21269, 21270, 21271, 21272, 21273, 21274, 21275, 21276, 21277, 21278, 21279, 21280, 21281,
+	21282, 21283, 21284, 21285, 21286, 21287, 21288, 21289, 21290, 21291, 21292, 21293, 21294, 21295, 21296, 21297,
+	21298, 21299, 21300, 21301, 21302, 21303, 21304, 21305, 21306, 21307, 21308, 21309, 21310, 21311, 21312, 21313,
+	21314, 21315, 21316, 21317, 21318, 21319, 21320, 21321, 21322, 21323, 21324, 21325, 21326, 21327, 21328, 21329,
+	21330, 21331, 21332, 21333, 21334, 21335, 21336, 21337, 21338, 21339, 21340, 21341, 21342, 21343, 21344, 21345,
+	21346, 21347, 21348, 21349, 21350, 21351, 21352, 21353, 21354, 21355, 21356, 21357, 21358, 21359, 21360, 21361,
+	21362, 21363, 21364, 21365, 21366, 21367, 21368, 21369, 21370, 21371, 21372, 21373, 21374, 21375, 21376, 21377,
+	21378, 21379, 21380, 21381, 21382, 21383, 21384, 21385, 21386, 21387, 21388, 21389, 21390, 21391, 21392, 21393,
+	21394, 21395, 21396, 21397, 21398, 21399, 21400, 21401, 21402, 21403, 21404, 21405, 21406, 21407, 21408, 21409,
+	21410, 21411, 21412, 21413, 21414, 21415, 21416, 21417, 21418, 21419, 21420, 21421, 21422, 21423, 21424, 21425,
+	21426, 21427, 21428, 21429, 21430, 21431, 21432, 21433, 21434, 21435, 21436, 21437, 21438, 21439, 21440, 21441,
+	21442, 21443, 21444, 21445, 21446, 21447, 21448, 21449, 21450, 21451, 21452, 21453, 21454, 21455, 21456, 21457,
+	21458, 21459, 21460, 21461, 21462, 21463, 21464, 21465, 21466, 21467, 21468, 21469, 21470, 21471, 21472, 21473,
+	21474, 21475, 21476, 21477, 21478, 21479, 21480, 21481, 21482, 21483, 21484, 21485, 21486, 21487, 21488, 21489,
+	21490, 21491, 21492, 21493, 21494, 21495, 21496, 21497, 21498, 21499, 21500, 21501, 21502, 21503, 21504, 21505,
+	21506, 21507, 21508, 21509, 21510, 21511, 21512, 21513, 21514, 21515, 21516, 21517, 21518, 21519, 21520, 21521,
+	21522, 21523, 21524, 21525, 21526, 21527, 21528, 21529, 21530, 21531, 21532, 21533, 21534, 21535, 21536, 21537,
+	21538, 21539, 21540, 21541, 21542, 21543, 21544, 21545, 21546, 21547, 21548, 21549, 21550, 21551, 21552, 21553,
+	21554, 21555, 21556, 21557, 21558, 21559, 21560, 21561, 21562, 21563, 21564, 21565, 21566, 21567, 21568, 21569,
+	21570, 21571, 21572, 21573, 21574, 21575, 21576, 21577, 21578, 21579, 21580, 21581, 21582, 21583, 21584, 21585,
+	21586, 21587, 21588, 21589, 21590, 21591, 21592, 21593, 21594, 21595, 21596, 21597, 21598, 21599, 21600, 21601,
+	21602, 21603, 21604, 21605, 21606, 21607, 21608, 21609, 21610, 21611, 21612, 21613, 21614, 21615, 21616, 21617,
+	21618, 21619, 21620, 21621, 21622, 21623, 21624, 21625, 21626, 21627, 21628, 21629, 21630, 21631, 21632, 21633,
+	21634, 21635, 21636, 21637, 21638, 21639, 21640, 21641, 21642, 21643, 21644, 21645, 21646, 21647, 21648, 21649,
+	21650, 21651, 21652, 21653, 21654, 21655, 21656, 21657, 21658, 21659, 21660, 21661, 21662, 21663, 21664, 21665,
+	21666, 21667, 21668, 21669, 21670, 21671, 21672, 21673, 21674, 21675, 21676, 21677, 21678, 21679, 21680, 21681,
+	21682, 21683, 21684, 21685, 21686, 21687, 21688, 21689, 21690, 21691, 21692, 21693, 21694, 21695, 21696, 32767,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	21724, 21725, 21726, 21727, 21728, 21729, 21730, 21731, 21732, 21733, 21734, 21735, 21736, 21737, 21738, 21739,
+	21740, 21741, 21742, 21743, 21744, 21745, 21746, 21747, 21748, 21749, 21750, 21751, 21752, 21753, 21754, 21755,
+	21756, 21757, 21758, 21759, 21760, 21761, 21762, 21763, 21764, 21765, 21766, 21767, 21768, 21769, 21770, 21771,
+	21772, 21773, 21774, 21775, 21776, 21777, 21778, 21779, 21780, 21781, 21782, 21783, 21784, 21785, 21786, 21787,
+	21788, 21789, 21790, 21791, 21792, 21793, 21794, 21795, 21796, 21797, 21798, 21799, 21800, 21801, 21802, 21803,
+	21804, 21805, 21806, 21807, 21808, 21809, 21810, 21811, 21812, 21813, 21814, 21815, 21816, 21817, 21818, 21819,
+	21820, 21821, 21822, 21823, 21824, 21825, 21826, 21827, 21828, 21829, 21830, 21831, 21832, 21833, 21834, 21835,
+	21836, 21837, 21838, 21839, 21840, 21841, 21842, 21843, 21844, 21845, 21846, 21847, 21848, 21849, 21850, 21851,
+	21852, 21853, 21854, 21855, 21856, 21857, 21858, 21859, 21860, 21861, 21862, 21863, 21864, 21865, 21866, 21867,
+	21868, 21869, 21870, 21871, 21872, 21873, 21874, 21875, 21876, 21877, 21878, 21879, 21880, 21881, 21882, 21883,
+	21884, 21885, 21886, 21887, 21888, 21889, 21890, 21891, 21892, 21893, 21894, 21895, 21896, 21897, 21898, 21899,
+	21900, 21901, 21902, 21903, 21904, 21905, 21906, 21907, 21908, 21909, 21910, 21911, 21912, 21913, 21914, 21915,
+	21916, 21917, 21918, 21919, 21920, 21921, 21922, 21923, 21924, 21925, 21926, 21927, 21928, 21929, 21930, 21931,
+	21932, 21933, 21934, 21935, 21936, 21937, 21938, 21939, 21940, 21941, 21942, 21943, 21944, 21945, 21946, 21947,
+	21948, 21949, 21950, 21951, 21952, 21953, 21954, 21955, 21956, 21957, 21958, 21959, 21960, 21961, 21962, 21963,
+	21964, 21965, 21966, 21967, 21968, 21969, 21970, 21971, 21972, 21973, 21974, 21975, 21976, 21977, 21978, 21979,
+	21980, 21981, 21982, 21983, 21984, 21985, 21986, 21987, 21988, 21989, 21990, 21991, 21992, 21993, 21994, 21995,
+	21996, 21997, 21998, 21999, 22000, 22001, 22002, 22003, 22004, 22005, 22006, 22007, 22008, 22009, 22010, 22011,
+	22012, 22013, 22014, 22015, 22016, 22017, 22018, 22019, 22020, 22021, 22022, 22023, 22024, 22025, 22026, 22027,
+	22028, 22029, 22030, 22031, 22032, 22033, 22034, 22035, 22036, 22037, 22038, 22039, 22040, 22041, 22042, 22043,
+	22044, 22045, 22046, 22047, 22048, 22049, 22050, 22051, 22052, 22053, 22054, 22055, 22056, 22057, 22058, 22059,
+	22060, 22061, 22062, 22063, 22064, 22065, 22066, 22067, 22068, 22069, 22070, 22071, 22072, 22073, 22074, 22075,
+	22076, 22077, 22078, 22079, 22080, 22081, 22082, 22083, 22084, 22085, 22086, 22087, 22088, 22089, 22090, 22091,
+	22092, 22093, 22094, 22095, 22096, 22097, 22098, 22099, 22100, 22101, 22102, 22103, 22104, 22105, 22106, 22107,
+	22108, 22109, 22110, 22111, 22112, 22113, 22114, 22115, 22116, 22117, 22118, 22119, 22120, 22121, 22122, 22123,
+	22124, 22125, 22126, 22127, 22128, 22129, 22130, 22131, 22132, 22133, 22134, 22135, 22136, 22137, 22138, 22139,
+	22140, 22141, 22142, 22143, 22144, 22145, 22146, 22147, 22148, 22149, 22150, 22151, 22152, 22153, 22154, 22155,
+	22156, 22157, 22158, 22159, 22160, 22161, 22162, 22163, 22164, 22165, 22166, 22167, 22168, 22169, 22170, 22171,
+	22172, 22173, 22174, 22175, 22176, 22177, 22178, 22179, 22180, 22181, 22182, 22183, 22184, 22185, 22186, 22187,
+	22188, 22189, 22190, 22191, 22192, 22193, 22194, 22195, 22196, 22197, 22198, 22199, 22200, 22201, 22202, 22203,
+	22204, 22205, 22206, 22207, 22208, 22209, 22210, 22211, 22212, 22213, 22214, 22215, 22216, 22217, 22218, 22219,
+	22220, 22221, 22222, 22223, 22224, 22225, 22226, 22227, 22228, 22229, 22230, 22231, 22232, 22233, 22234, 22235,
+	22236, 22237, 22238, 22239, 22240, 22241, 22242, 22243, 22244, 22245, 22246, 22247, 22248, 22249, 22250, 22251,
+	22252, 22253, 22254, 22255, 22256, 22257, 22258, 22259, 22260, 22261, 22262, 22263, 22264, 22265, 22266, 22267,
+	22268, 22269, 22270, 22271, 22272, 22273, 22274, 22275, 22276, 22277, 22278, 22279, 22280, 22281, 22282, 22283,
+	22284, 22285, 22286, 22287, 22288, 22289, 22290, 22291, 22292, 22293, 22294, 22295, 22296, 22297, 22298, 22299,
+	22300, 22301, 22302, 22303, 22304, 22305, 22306, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	14593, 14594, 14595, 14596, 14597, 14598, 14599, 14600, 14601, 14602, 14603, 14604, 14605, 14606, 14607, 14608,
+	14609, 14610, 14611, 14612, 14613, 14614, 14615, 14616, 14617, 14618, 14619, 14620, 14621, 14622, 14623, 14624,
+	14625, 14626, 14627, 14628, 14629, 14630, 14631, 14632, 14633, 14634, 14635, 14636, 14637, 14638, 14639, 14640,
+	14641, 14642, 14643, 14644, 14645, 14646, 14647, 14648, 14649, 14650, 14651, 14652, 14653, 14654, 14655, 14656,
+	14657, 14658, 14659, 14660, 14661, 14662, 14663, 14664, 14665, 14666, 14667, 14668, 14669, 14670, 14671, 14672,
+	14673, 14674, 14675, 14676, 14677, 14678, 14679, 14680, 14681, 14682, 14683, 14684, 14685, 14686, 14687, 14688,
+	14689, 14690, 14691, 14692, 14693, 14694, 14695, 14696, 14697, 14698, 14699, 14700, 14701, 14702, 14703, 14704,
+	14705, 14706, 14707, 14708, 14709, 14710, 14711, 14712, 14713, 14714, 14715, 14716, 14717, 14718, 14719, 14720,
+	14721, 14722, 14723, 14724, 14725, 14726, 14727, 14728, 14729, 14730, 14731, 14732, 14733, 14734, 14735, 14736,
+	14737, 14738, 14739, 14740, 14741, 14742, 14743, 14744, 14745, 14746, 14747, 14748, 14749, 14750, 14751, 14752,
+	14753, 14754, 14755, 14756, 14757, 14758, 14759, 14760, 14761, 14762, 14763, 14764, 14765, 14766, 14767, 14768,
+	14769, 14770, 14771, 14772, 14773, 14774, 14775, 14776, 14777, 14778, 14779, 14780, 14781, 14782, 14783, 14784,
+	14785, 14786, 14787, 14788, 14789, 14790, 14791, 14792, 14793, 14794, 14795, 14796, 14797, 14798, 14799, 14800,
+	14801, 14802, 14803, 14804, 14805, 14806, 14807, 14808, 14809, 14810, 14811, 14812, 14813, 14814, 14815, 14816,
+	14817, 14818, 14819, 14820, 14821, 14822, 14823, 14824, 14825, 14826, 14827, 14828, 14829, 14830, 14831, 14832,
+	14833, 14834, 14835, 14836, 14837, 14838, 14839, 14840, 14841, 14842, 14843, 14844, 14845, 14846, 14847, 14848,
+	14849, 14850, 14851, 14852, 14853, 14854, 14855, 14856, 14857, 14858, 14859, 14860, 14861, 14862, 14863, 14864,
+	14865, 14866, 14867, 14868, 14869, 14870, 14871, 14872, 14873, 14874, 14875, 14876, 14877, 14878, 14879, 14880,
+	14881, 14882, 14883, 14884, 14885, 14886, 14887, 14888, 14889, 14890, 14891, 14892, 14893, 14894, 14895, 14896,
+	14897, 14898, 14899, 14900, 14901, 14902, 14903, 14904, 14905, 14906, 14907, 14908, 14909, 14910, 14911, 14912,
+	14913, 14914, 14915, 14916, 14917, 14918, 14919, 14920, 14921, 14922, 14923, 14924, 14925, 14926, 14927, 14928,
+	14929, 14930, 14931, 14932, 14933, 14934, 14935, 14936, 14937, 14938, 14939, 14940, 14941, 14942, 14943, 14944,
+	14945, 14946, 14947, 14948, 14949, 14950, 14951, 14952, 14953, 14954, 14955, 14956, 14957, 14958, 14959, 14960,
+	14961, 14962, 14963, 14964, 14965, 14966, 14967, 14968, 14969, 14970, 14971, 14972, 14973, 14974, 14975, 14976,
+	14977, 14978, 14979, 14980, 14981, 14982, 14983, 14984, 14985, 14986, 14987, 14988, 14989, 14990, 14991, 14992,
+	14993, 14994, 14995, 14996, 14997, 14998, 14999, 15000, 15001, 15002, 15003, 15004, 15005, 15006, 15007, 15008,
+	15009, 15010, 15011, 15012, 15013, 15014, 15015, 15016, 15017, 15018, 15019, 15020, 15021, 15022, 15023, 15024,
+	15025, 15026, 15027, 15028, 15029, 15030, 15031, 15032, 15033, 15034, 15035, 15036, 15037, 15038, 15039, 15040,
+	15041, 15042, 15043, 15044, 15045, 15046, 15047, 15048, 15049, 15050, 15051, 15052, 15053, 15054, 15055, 15056,
+	15057, 15058, 15059, 15060, 15061, 15062, 15063, 15064, 15065, 15066, 15067, 15068, 15069, 15070, 15071, 15072,
+	15073, 15074, 15075, 15076, 15077, 15078, 15079, 15080, 15081, 15082, 15083, 15084, 15085, 15086, 15087, 15088,
+	15089, 15090, 15091, 15092, 15093, 15094, 15095, 15096, 15097, 15098, 15099, 15100, 15101, 15102, 15103, 15104,
+	15105, 15106, 15107, 15108, 15109, 15110, 15111, 15112, 15113, 15114, 15115, 15116, 15117, 15118, 15119, 15120,
+	15121, 15122, 15123, 15124, 15125, 15126, 15127, 15128, 15129, 15130, 15131, 15132, 15133, 15134, 15135, 15136,
+	15137, 15138, 15139, 15140, 15141, 15142, 15143, 15144, 15145, 15146, 15147, 15148, 15149, 15150, 15151, 15152,
+	15153, 15154, 15155, 15156, 15157, 15158, 15159, 15160, 15161, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18376, 18377, 18378, 18379, 18380, 18381, 18382, 18383, 18384, 18385, 18386, 18387, 18388, 18389, 18390, 18391,
+	18392, 18393, 18394, 18395, 18396, 18397, 18398, 18399, 18400, 18401, 18402, 18403, 18404, 18405, 18406, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 32767, 201, 202,
+	15162, 15163, 15164, 15165, 15166, 15167, 15168, 15169, 15170, 15171, 15172, 15173, 15174, 15175, 15176, 15177,
+	15178, 15179, 15180, 15181, 15182, 15183, 15184, 15185, 15186, 15187, 15188, 15189, 15190, 15191, 32767, 32767,
+	41416, 41418, 41420, 41422, 41424, 143, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	17651, 17652, 17653, 17654, 17655, 17656, 17657, 17658, 17659, 17660, 17661, 17662, 17663, 17664, 17665, 17666,
+	17667, 17668, 17669, 17670, 17671, 17672, 17673, 17674, 17675, 17676, 17677, 17678, 17679, 17680, 17681, 17682,
+	17683, 17684, 17685, 17686, 17687, 17688, 17689, 17690, 17691, 17692, 17693, 17694, 17695, 17696, 17697, 17698,
+	41426, 41428, 41430, 41432, 41434, 41436, 41438, 679, 680, 681, 682, 683, 3870, 3871, 3872, 3873,
+	17699, 17700, 7507, 7508, 684, 3874, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 7297, 7298, 7299, 7300, 7301,
+	7302, 7303, 32767, 17701, 17702, 17703, 17704, 17705, 17706, 17707, 17708, 17709, 17710, 17711, 17712, 17713,
+	17714, 17715, 17716, 17717, 17718, 17719, 17720, 17721, 32767, 32767, 32767, 32767, 32767, 17722, 17723, 17724,
+	17725, 17726, 17727, 17728, 17729, 17730, 17731, 17732, 17733, 17734, 17735, 17736, 17737, 17738, 17739, 17740,
+	15389, 15390, 15391, 15392, 15393, 15394, 15395, 15396, 15397, 15398, 15399, 15400, 15401, 15402, 15403, 15404,
+	15405, 15406, 15407, 15408, 15409, 15410, 15411, 15412, 15413, 15414, 15415, 15416, 15417, 15418, 15419, 15420,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7304, 7305, 7306, 7307, 7308, 7309,
+	7310, 7311, 7312, 7313, 41440, 41443, 41446, 53, 144, 685, 686, 32767, 32767, 32767, 32767, 32767,
+	17416, 17417, 17418, 17419, 17421, 17422, 17421, 17423, 17424, 17425, 17426, 17427, 17428, 17429, 17431, 17432,
+	17434, 17435, 17436, 17434, 17437, 17438, 17439, 17440, 17441, 17442, 17443, 17444, 17445, 17446, 17447, 17448,
+	17449, 17450, 17451, 17452, 17453, 17452, 17454, 17455, 17456, 17457, 17458, 17459, 17460, 17461, 17462, 17463,
+	17464, 17465, 17466, 17468, 17470, 17471, 17472, 17473, 17474, 17475, 17477, 17478, 17479, 17480, 17481, 17480,
+	17482, 17483, 17484, 17485, 17486, 17420, 17469, 17467, 17430, 17476, 17433, 32767, 32767, 32767, 32767, 17491,
+	17487, 17488, 17489, 17490, 17492, 17493, 17494, 17495, 17496, 17498, 17499, 17500, 17501, 17503, 17504, 17505,
+	17506, 17508, 17509, 17510, 17511, 17512, 17514, 17515, 17516, 17517, 17518, 17519, 17520, 17521, 17524, 17525,
+	17526, 17527, 17528, 17530, 17531, 17534, 17535, 17536, 17537, 17538, 17539, 17540, 17541, 17542, 17543, 17522,
+	17529, 17497, 17533, 17502, 17507, 17532, 17513, 17523, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 17544,
+	17545, 17546, 17547, 17548, 17549, 17550, 17551, 17552, 17553, 17554, 17555, 17556, 17557, 17558, 17559, 17560,
+	7513, 7514, 57, 7515, 0, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	41449, 41451, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	15816, 15875, 15862, 15863, 15864, 15865, 15866, 15867, 15868, 15869, 15870, 15871, 15872, 15873, 15874, 15876,
+	15877, 15878, 15879, 15880, 15881, 15882, 15883, 15884, 15885, 15886, 15887, 15888, 15889, 15890, 15891, 15892,
+	15893, 15894, 15895, 15896, 15897, 15898, 15899, 15900, 15901, 15902, 15903, 15904, 15905, 15906, 15907, 15908,
+	15909, 15910, 15911, 15912, 15913, 15914, 15915, 15916, 15917, 15918, 15919, 15920, 15921, 15922, 15923, 15924,
+	15925, 15926, 15927, 15928, 15929, 15930, 15931, 15932, 15933, 15934, 15935, 15936, 15937, 15938, 15939, 15940,
+	15941, 15942, 15943, 15944, 15945, 15946, 15947, 15948, 15949, 15950, 15951, 15952, 15953, 15954, 15955, 15956,
+	15957, 15958, 15959, 15960, 15961, 15962, 15963, 15964, 15965, 15966, 15967, 15968, 15969, 15970, 15971, 15972,
+	15973, 15974, 15975, 15976, 15977, 15978, 15979, 15980, 15981, 15982, 15983, 15984, 15985, 15986, 15987, 15988,
+	15989, 15990, 15991, 15992, 15993, 15994, 15995, 15996, 15997, 15998, 15999, 16000, 16001, 16002, 16003, 16004,
+	16005, 16006, 16007, 16008, 16009, 16010, 16011, 16012, 16013, 16014, 16015, 16016, 16017, 16018, 16019, 16020,
+	16021, 16022, 16023, 16024, 16025, 16026, 16027, 16028, 16029, 16030, 16031, 16032, 16033, 16034, 16035, 16036,
+	16037, 16038, 16039, 16040, 16041, 16042, 16043, 16044, 16045, 16046, 16047, 16048, 16049, 16050, 16051, 16052,
+	16053, 16054, 16055, 16056, 16057, 16058, 16059, 16060, 16061, 16062, 16063, 16064, 16065, 16066, 16067, 16068,
+	16069, 16070, 16071, 16072, 16073, 16074, 16075, 16076, 16077, 16078, 16079, 16080, 16081, 16082, 16083, 16084,
+	16085, 16086, 16087, 16088, 16089, 16090, 16091, 16092, 16093, 16094, 16095, 16096, 16097, 16098, 16099, 16100,
+	16101, 16102, 16103, 16104, 16105, 16106, 16107, 16108, 16109, 16110, 16111, 16112, 16113, 16114, 16115, 16116,
+	16117, 16118, 16119, 16120, 16121, 16122, 16123, 16124, 16125, 16126, 16127, 16128, 16129, 16130, 16131, 16132,
+	16133, 16134, 16135, 16136, 16137, 16138, 16139, 16140, 16141, 16142, 16143, 16144, 16145, 16146, 16147, 32767,
+	15858, 15859, 15860, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 15858, 15859, 15860, 15861, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18090, 18091, 18092, 18093, 18094, 18095, 18096, 18097, 18098, 18099, 18100, 18101, 18102, 18103, 18104, 18105,
+	18106, 18107, 18108, 18109, 18110, 18111, 18112, 18113, 18114, 18115, 18116, 18117, 18118, 18119, 18120, 18121,
+	18122, 18123, 18124, 18125, 18126, 18127, 18128, 18129, 18130, 18131, 18132, 18133, 18134, 18135, 18136, 18137,
+	18138, 18139, 18140, 18141, 18142, 18143, 18144, 18145, 18146, 18147, 18148, 18149, 18150, 18151, 18152, 18153,
+	18154, 18155, 18156, 18157, 18158, 18159, 18160, 18161, 18162, 18163, 18164, 18165, 18166, 18167, 18168, 18169,
+	18170, 18171, 18172, 18173, 18174, 18175, 18176, 18177, 18178, 18179, 18180, 18181, 18182, 18183, 18184, 18185,
+	18186, 18187, 18188, 18189, 18190, 18191, 18192, 18193, 18194, 18195, 18196, 32767, 32767, 32767, 32767, 32767,
+	18197, 18198, 18199, 18200, 18201, 18202, 18203, 18204, 18205, 18206, 18207, 18208, 18209, 32767, 32767, 32767,
+	18210, 18211, 18212, 18213, 18214, 18215, 18216, 18217, 18218, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	18219, 18220, 18221, 18222, 18223, 18224, 18225, 18226, 18227, 18228, 32767, 32767, 4372, 33288, 33334, 145,
+	0, 0, 0, 0, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891,
+	3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907,
+	3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922, 3923,
+	3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938, 3939,
+	3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955,
+	3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971,
+	3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987,
+	3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003,
+	4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018, 4019,
+	4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034, 4035,
+	4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051,
+	4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 4067,
+	4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083,
+	4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099,
+	4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115,
+	4116, 4117, 4118, 4119, 4120, 4121, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4122, 4123, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137,
+	4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149, 4150, 4151, 4152, 4153,
+	4154, 4155, 4156, 4157, 4158, 4159, 4160, 32767, 32767, 4180, 4164, 4165, 4166, 4167, 4168, 4169,
+	4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4179, 4181, 4182, 4183, 4184, 4185, 4186,
+	4187, 4188, 4189, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202,
+	4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214, 4215, 4216, 4210, 4211,
+	4211, 4211, 4211, 4211, 4211, 0, 0, 0, 0, 0, 4217, 4218, 4219, 0, 0, 0,
+	0, 0, 0, 4220, 4221, 0, 0, 0, 0, 0, 0, 0, 4222, 4223, 4224, 4225,
+	4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4239, 4240, 4241,
+	4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 0, 0, 0, 0, 4252, 4253,
+	4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4263, 4264, 4263, 4264, 4263,
+	4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279,
+	4280, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293, 4294, 4295,
+	4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320,
+	4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335, 4336,
+	4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 4348, 4349, 4350, 4351, 4352,
+	4353, 4354, 4355, 4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368,
+	4369, 4370, 0, 0, 0, 4371, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7314, 7315, 7316, 7317, 7318, 7319,
+	7320, 7321, 7322, 7323, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653,
+	3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669,
+	3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685,
+	3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701,
+	3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717,
+	3718, 3719, 3720, 3721, 3722, 3723, 3724, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7485, 7486, 7487, 7488, 7489, 7490, 7491,
+	7492, 7493, 7577, 7578, 7579, 7580, 7581, 7577, 7581, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600, 7611, 7620, 7633, 7656,
+	7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7762, 7791, 7803, 7810, 7840, 7856, 7867, 7891,
+	7900, 7905, 7914, 7921, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717,
+	7738, 7747, 7762, 7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600,
+	7611, 7620, 7633, 7656, 7665, 32767, 7689, 7701, 7708, 7717, 7738, 7747, 7762, 7791, 7803, 7810,
+	7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677,
+	7689, 7701, 7708, 7717, 7738, 7747, 7762, 7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905,
+	7914, 7921, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747,
+	7762, 7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7586, 32767, 7611, 7620,
+	32767, 32767, 7665, 32767, 32767, 7701, 7708, 32767, 32767, 7747, 7762, 7791, 7803, 32767, 7840, 7856,
+	7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600, 7611, 7620, 32767, 7656, 32767, 7677, 7689, 7701,
+	7708, 7717, 7738, 7747, 32767, 7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921,
+	7900, 7905, 7914, 7921, 7586, 7600, 32767, 7620, 7633, 7656, 7665, 32767, 32767, 7701, 7708, 7717,
+	7738, 7747, 7762, 7791, 7803, 32767, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 32767, 7586, 7600,
+	7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7762, 7791, 7803, 7810,
+	7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600, 32767, 7620, 7633, 7656, 7665, 32767,
+	7689, 7701, 7708, 7717, 7738, 32767, 7762, 32767, 32767, 32767, 7840, 7856, 7867, 7891, 7900, 7905,
+	7914, 32767, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747,
+	7762, 7791, 7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600, 7611, 7620,
+	7633, 7656, 7665, 7677, 7689, 7701, 7708, 7717, 7738, 7747, 7762, 7791, 7803, 7810, 7840, 7856,
+	7867, 7891, 7900, 7905, 7914, 7921, 7586, 7600, 7611, 7620, 7633, 7656, 7665, 7677, 7689, 7701,
+	7900, 7905, 7914, 7921, 7690, 7702, 32767, 32767, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995,
+	7996, 7998, 7999, 8001, 8002, 8003, 8004, 8005, 8010, 7995, 8013, 8017, 8018, 8019, 8020, 8021,
+	8023, 1116, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003,
+	8004, 8005, 8010, 8013, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 1112, 7988, 7995, 7998, 8019,
+	8010, 8005, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003,
+	8004, 8005, 8010, 7995, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 1116, 7983, 7984, 7985, 7987,
+	7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003, 8004, 8005, 8010, 8013, 8013, 8017,
+	8018, 8019, 8020, 8021, 8023, 1112, 7988, 7995, 7998, 8019, 8010, 8005, 7983, 7984, 7985, 7987,
+	7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003, 8004, 8005, 8010, 7995, 8013, 8017,
+	8018, 8019, 8020, 8021, 8023, 1116, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998,
+	7999, 8001, 8002, 8003, 8004, 8005, 8010, 8013, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 1112,
+	7988, 7995, 7998, 8019, 8010, 8005, 7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998,
+	7999, 8001, 8002, 8003, 8004, 8005, 8010, 7995, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 1116,
+	7983, 7984, 7985, 7987, 7988, 7992, 7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003, 8004, 8005,
+	8010, 8013, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 1112, 7988, 7995, 7998, 8019, 8010, 8005,
+	8010, 7995, 8013, 8017, 8018, 8019, 8020, 8021, 8023, 1116, 7983, 7984, 7985, 7987, 7988, 7992,
+	7994, 7995, 7996, 7998, 7999, 8001, 8002, 8003, 8004, 8005, 8010, 8013, 8013, 8017, 8018, 8019,
+	8020, 8021, 8023, 1112, 7988, 7995, 7998, 8019, 8010, 8005, 7989, 7989, 32767, 32767, 7576, 7577,
+	7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583,
+	7584, 7585, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7576, 7577, 7578, 7579,
+	7580, 7581, 7582, 7583, 7584, 7585, 7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	6399, 6400, 6401, 6402, 6403, 6404, 6405, 6406, 6407, 6408, 6409, 6410, 6411, 6412, 6413, 6414,
+	6415, 6416, 6417, 6418, 6419, 6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430,
+	6431, 6432, 6433, 6434, 6435, 6436, 6437, 6438, 6439, 6440, 6441, 6442, 6443, 6444, 6445, 6446,
+	6447, 6448, 6449, 6450, 6451, 6452, 6453, 6454, 6455, 6456, 6457, 6458, 6459, 6460, 6461, 6462,
+	6463, 6464, 6465, 6466, 6467, 6468, 6469, 6470, 6471, 6472, 6473, 6474, 6475, 6476, 6477, 6478,
+	6479, 6480, 6481, 6482, 6483, 6484, 6485, 6486, 6487, 6488, 6489, 6490, 6491, 6492, 6493, 6494,
+	6495, 6496, 6497, 6498, 6499, 6500, 6501, 6502, 6503, 6504, 6505, 6506, 6507, 6508, 6509, 6510,
+	6511, 6512, 6513, 6514, 6515, 6516, 6517, 6518, 6519, 6520, 6521, 6522, 6523, 6524, 6525, 6526,
+	6527, 6528, 6529, 6530, 6531, 6532, 6533, 6534, 6535, 6536, 6537, 6538, 6539, 6540, 6541, 6542,
+	6543, 6544, 6545, 6546, 6547, 6548, 6549, 6550, 6551, 6552, 6553, 6554, 6555, 6556, 6557, 6558,
+	6559, 6560, 6561, 6562, 6563, 6564, 6565, 6566, 6567, 6568, 6569, 6570, 6571, 6572, 6573, 6574,
+	6575, 6576, 6577, 6578, 6579, 6580, 6581, 6582, 6583, 6584, 6585, 6586, 6587, 6588, 6589, 6590,
+	6591, 6592, 6593, 6594, 6595, 6596, 6597, 6598, 6599, 6600, 6601, 6602, 6603, 6604, 6605, 6606,
+	6607, 6608, 6609, 6610, 6611, 6612, 6613, 6614, 6615, 6616, 6617, 6618, 6619, 6620, 6621, 6622,
+	6623, 6624, 6625, 6626, 6627, 6628, 6629, 6630, 6631, 6632, 6633, 6634, 6635, 6636, 6637, 6638,
+	6639, 6640, 6641, 6642, 6643, 6644, 6645, 6646, 6647, 6648, 6649, 6650, 6651, 6652, 6653, 6654,
+	6655, 6656, 6657, 6658, 6659, 6660, 6661, 6662, 6663, 6664, 6665, 6666, 6667, 6668, 6669, 6670,
+	6671, 6672, 6673, 6674, 6675, 6676, 6677, 6678, 6679, 6680, 6681, 6682, 6683, 6684, 6685, 6686,
+	6687, 6688, 6689, 6690, 6691, 6692, 6693, 6694, 6695, 6696, 6697, 6698, 6699, 6700, 6701, 6702,
+	6703, 6704, 6705, 6706, 6707, 6708, 6709, 6710, 6711, 6712, 6713, 6714, 6715, 6716, 6717, 6718,
+	6719, 6720, 6721, 6722, 6723, 6724, 6725, 6726, 6727, 6728, 6729, 6730, 6731, 6732, 6733, 6734,
+	6735, 6736, 6737, 6738, 6739, 6740, 6741, 6742, 6743, 6744, 6745, 6746, 6747, 6748, 6749, 6750,
+	6751, 6752, 6753, 6754, 6755, 6756, 6757, 6758, 6759, 6760, 6761, 6762, 6763, 6764, 6765, 6766,
+	6767, 6768, 6769, 6770, 6771, 6772, 6773, 6774, 6775, 6776, 6777, 6778, 6779, 6780, 6781, 6782,
+	6783, 6784, 6785, 6786, 6787, 6788, 6789, 6790, 6791, 6792, 6793, 6794, 6795, 6796, 6797, 6798,
+	6799, 6800, 6801, 6802, 6803, 6804, 6805, 6806, 6807, 6808, 6809, 6810, 6811, 6812, 6813, 6814,
+	6815, 6816, 6817, 6818, 6819, 6820, 6821, 6822, 6823, 6824, 6825, 6826, 6827, 6828, 6829, 6830,
+	6831, 6832, 6833, 6834, 6835, 6836, 6837, 6838, 6839, 6840, 6841, 6842, 6843, 6844, 6845, 6846,
+	6847, 6848, 6849, 6850, 6851, 6852, 6853, 6854, 6855, 6856, 6857, 6858, 6859, 6860, 6861, 6862,
+	6863, 6864, 6865, 6866, 6867, 6868, 6869, 6870, 6871, 6872, 6873, 6874, 6875, 6876, 6877, 6878,
+	6879, 6880, 6881, 6882, 6883, 6884, 6885, 6886, 6887, 6888, 6889, 6890, 6891, 6892, 6893, 6894,
+	6895, 6896, 6897, 6898, 6899, 6900, 6901, 6902, 6903, 6904, 6905, 6906, 6907, 6908, 6909, 6910,
+	0, 0, 0, 0, 0, 0, 0, 6911, 6912, 6913, 6914, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6915, 6916, 6917,
+	6918, 6919, 6920, 6921, 6922, 0, 6923, 6924, 6925, 6926, 6927, 6928, 6929, 6930, 6931, 6932,
+	6933, 6934, 6935, 6936, 0, 6937, 6938, 687, 688, 689, 690, 691, 32767, 32767, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 0, 0, 0, 0,
+	8245, 8246, 8247, 8248, 8249, 8250, 8251, 32767, 8253, 8254, 8255, 8256, 8257, 8258, 8259, 8260,
+	8261, 8262, 8263, 8264, 8265, 8266, 8267, 8268, 8269, 32767, 32767, 8272, 8273, 8274, 8275, 8276,
+	8277, 8278, 32767, 8280, 8281, 32767, 8283, 8284, 8285, 8286, 8287, 32767, 32767, 32767, 32767, 32767,
+	17741, 17742, 17743, 17744, 17745, 17746, 17747, 17748, 17749, 17750, 17751, 17752, 17753, 17754, 17755, 17756,
+	17757, 17758, 17759, 17760, 17761, 17762, 17763, 17764, 17765, 17766, 17767, 17768, 17769, 17770, 17771, 17772,
+	17773, 17774, 17775, 17776, 17777, 17778, 17779, 17780, 17781, 17782, 17783, 17784, 17785, 32767, 32767, 32767,
+	41434, 41426, 41430, 41432, 41436, 41438, 41428, 17786, 17787, 17788, 17789, 17790, 7509, 7510, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 32767, 17791, 3875,
+	17792, 17793, 17794, 17795, 17796, 17797, 17798, 17799, 17800, 17801, 17802, 17803, 17804, 17805, 17806, 17807,
+	17808, 17809, 17810, 17811, 17812, 17813, 17814, 17815, 17816, 17817, 17818, 17819, 17820, 17821, 17822, 17823,
+	17824, 17825, 17826, 17827, 17828, 17829, 17830, 17831, 17832, 17833, 17834, 17835, 41453, 41455, 41457, 41459,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 32767, 32767, 7543,
+	15192, 15193, 15194, 15195, 15196, 15197, 15198, 15199, 15200, 15201, 15202, 15203, 15204, 15205, 15206, 15207,
+	15208, 15209, 15210, 15211, 15212, 15213, 15214, 15215, 15216, 15217, 15218, 15219, 15220, 15221, 15222, 15223,
+	15224, 15225, 15226, 15227, 15228, 15229, 15230, 15231, 15232, 15233, 15234, 15235, 15236, 15237, 15238, 15239,
+	15240, 15241, 15242, 15243, 15244, 15245, 15246, 15247, 15248, 15249, 15250, 15251, 15252, 15253, 15254, 15255,
+	15256, 15257, 15258, 15259, 15260, 15261, 15262, 15263, 15264, 15265, 15266, 15267, 15268, 15269, 15270, 15271,
+	15272, 15273, 15274, 15275, 15276, 15277, 15278, 15279, 15280, 15281, 15282, 15283, 15284, 15285, 15286, 15287,
+	15288, 15289, 15290, 15291, 15292, 15293, 15294, 15295, 15296, 15297, 15298, 15299, 15300, 15301, 15302, 15303,
+	15304, 15305, 15306, 15307, 15308, 15309, 15310, 15311, 15312, 15313, 15314, 15315, 15316, 15317, 15318, 15319,
+	15320, 15321, 15322, 15323, 15324, 15325, 15326, 15327, 15328, 15329, 15330, 15331, 15332, 15333, 15334, 15335,
+	15336, 15337, 15338, 15339, 15340, 15341, 15342, 15343, 15344, 15345, 15346, 15347, 15348, 15349, 15350, 15351,
+	15352, 15353, 15354, 15355, 15356, 15357, 15358, 15359, 15360, 15361, 15362, 15363, 15364, 15365, 15366, 15367,
+	15368, 15369, 15370, 15371, 15372, 15373, 15374, 15375, 15376, 15377, 15378, 15379, 15380, 15381, 15382, 15383,
+	15384, 15385, 15386, 15387, 15388, 32767, 32767, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585,
+	0, 0, 0, 0, 0, 0, 0, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	15421, 15422, 15423, 15424, 15425, 15426, 15427, 15428, 15429, 15430, 15431, 15432, 15433, 15434, 15435, 15436,
+	15437, 15438, 15439, 15440, 15441, 15442, 15443, 15444, 15445, 15446, 15447, 15448, 15449, 15450, 15451, 15452,
+	15453, 15454, 15421, 15422, 15423, 15424, 15425, 15426, 15427, 15428, 15429, 15430, 15431, 15432, 15433, 15434,
+	15435, 15436, 15437, 15438, 15439, 15440, 15441, 15442, 15443, 15444, 15445, 15446, 15447, 15448, 15449, 15450,
+	15451, 15452, 15453, 15454, 41461, 41461, 41461, 41463, 41465, 41467, 41469, 15455, 32767, 32767, 32767, 32767,
+	7576, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 32767, 32767, 32767, 32767, 108, 123,
+	32767, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7324, 7325, 7326, 7327, 7328, 7329,
+	7330, 7331, 7332, 7333, 7334, 7335, 7336, 7337, 7338, 7339, 7340, 7341, 7342, 7343, 7344, 7345,
+	7346, 7347, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355, 7356, 7357, 7358, 7359, 7360, 7361,
+	7362, 7363, 7364, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 4373, 7365, 7366, 7367,
+	7569, 41440, 41443, 7368, 7369, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767, 7577, 7578, 7579, 7580, 7581, 7582, 7583, 7584, 7585, 7370, 7371, 7372, 7373, 7374, 7375,
+	7376, 7377, 7378, 7379, 7380, 7381, 7382, 7383, 7384, 7385, 7386, 7387, 7388, 7389, 7390, 7391,
+	7392, 7393, 7394, 7395, 7396, 7397, 7398, 7399, 7400, 7401, 7402, 7403, 7404, 7405, 4374, 41443,
+	41446, 41471, 41474, 41477, 41480, 41483, 41486, 7406, 7407, 7408, 7409, 7410, 7411, 7412, 32767, 32767,
+	8541, 8543, 8570, 8591, 32767, 8723, 8607, 8580, 8642, 8738, 8673, 8695, 8703, 8707, 8625, 8646,
+	8655, 8636, 8667, 8606, 8626, 8560, 8561, 8581, 8592, 8637, 8643, 8647, 8542, 8708, 8656, 8666,
+	32767, 8543, 8570, 32767, 8717, 32767, 32767, 8580, 32767, 8738, 8673, 8695, 8703, 8707, 8625, 8646,
+	8655, 8636, 8667, 32767, 8626, 8560, 8561, 8581, 32767, 8637, 32767, 8647, 32767, 32767, 32767, 32767,
+	32767, 32767, 8570, 32767, 32767, 32767, 32767, 8580, 32767, 8738, 32767, 8695, 32767, 8707, 8625, 8646,
+	32767, 8636, 8667, 32767, 8626, 32767, 32767, 8581, 32767, 8637, 32767, 8647, 32767, 8708, 32767, 8666,
+	32767, 8543, 8570, 32767, 8717, 32767, 32767, 8580, 8642, 8738, 8673, 32767, 8703, 8707, 8625, 8646,
+	8655, 8636, 8667, 32767, 8626, 8560, 8561, 8581, 32767, 8637, 8643, 8647, 8542, 32767, 8656, 32767,
+	8541, 8543, 8570, 8591, 8717, 8723, 8607, 8580, 8642, 8738, 32767, 8695, 8703, 8707, 8625, 8646,
+	8655, 8636, 8667, 8606, 8626, 8560, 8561, 8581, 8592, 8637, 8643, 8647, 32767, 32767, 32767, 32767,
+	32767, 8543, 8570, 8591, 32767, 8723, 8607, 8580, 8642, 8738, 32767, 8695, 8703, 8707, 8625, 8646,
+	815, 816, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4375, 4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4385, 4386, 4387, 4388, 4389, 4390,
+	4391, 4392, 4393, 4394, 4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406,
+	4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 32767, 32767, 32767, 32767,
+	4419, 4420, 4421, 4422, 4423, 4424, 4425, 4426, 4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434,
+	4435, 4436, 4437, 4438, 4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450,
+	4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466,
+	4467, 4468, 4469, 4470, 4471, 4472, 4473, 4474, 4475, 4476, 4477, 4478, 4479, 4480, 4481, 4482,
+	4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498,
+	4499, 4500, 4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514,
+	4515, 4516, 4517, 4518, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 4528, 4529, 4530, 4531, 4532, 4533, 32767,
+	32767, 4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548,
+	32767, 4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562, 4563,
+	32767, 4564, 4565, 4566, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578,
+	4579, 4580, 4581, 4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594,
+	4595, 4596, 4597, 4598, 4599, 4600, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	41489, 41492, 41495, 41498, 41501, 41504, 41507, 41510, 41513, 41516, 41519, 7576, 7576, 4699, 4700, 4701,
+	35576, 35580, 35584, 35588, 35592, 35596, 35600, 35604, 35608, 35612, 35616, 35620, 35624, 35628, 35632, 35636,
+	35640, 35644, 35648, 35652, 35656, 35660, 35664, 35668, 35672, 35676, 41522, 7611, 7810, 38432, 41526, 979,
+	7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 41529, 38394, 41532, 41535, 41538, 41542,
+	7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 41545, 41548, 41551, 4702, 4703, 4704,
+	7803, 7810, 7840, 7856, 7867, 7891, 7900, 7905, 7914, 7921, 7791, 41554, 38205, 41557, 41560, 41542,
+	41563, 41566, 41569, 41574, 41579, 41582, 41586, 41589, 41592, 41596, 41600, 41603, 41606, 41614, 41617, 41620,
+	41623, 41627, 41631, 41636, 41640, 7620, 41645, 41648, 41652, 41659, 41668, 41672, 41676, 981, 32767, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347,
+	2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363,
+	41680, 41683, 15824, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	36285, 41686, 41689, 36798, 36120, 41692, 41695, 36889, 41698, 41701, 41704, 39307, 41707, 41710, 41713, 41716,
+	41719, 41722, 36393, 41725, 41728, 41731, 41734, 41737, 41740, 36102, 36865, 41743, 37452, 36874, 37455, 41746,
+	36558, 41749, 41752, 41755, 41758, 41761, 37401, 36315, 41764, 41767, 41770, 41773, 32767, 32767, 32767, 32767,
+	41776, 41781, 41786, 41791, 41796, 41801, 41806, 41811, 41816, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	41821, 41824, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4705, 4706, 4707, 4708, 4709, 4710, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726,
+	4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742,
+	4743, 4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757, 4758,
+	4759, 4760, 4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774,
+	4775, 4776, 4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790,
+	4791, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4799, 4800, 4801, 4802, 4803, 4804, 4805, 4806,
+	4807, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818, 4819, 4820, 4821, 4822,
+	4823, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838,
+	4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854,
+	4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870,
+	4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885, 4886,
+	4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900, 4901, 4902,
+	4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917, 4918,
+	4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934,
+	4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950,
+	4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959, 4960, 4961, 4962, 4963, 4964, 4965, 4966,
+	4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974, 4975, 4976, 4977, 4978, 4979, 4980, 4981, 4982,
+	4983, 4984, 4985, 4986, 4987, 4988, 4989, 4990, 4991, 4992, 4993, 4994, 4995, 4996, 4997, 4998,
+	4999, 5000, 5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013, 5014,
+	5015, 5016, 5017, 5018, 5019, 5020, 5021, 5022, 5023, 5024, 5025, 5026, 5027, 5028, 5029, 5030,
+	5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045, 5046,
+	5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062,
+	5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078,
+	5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093, 5094,
+	5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109, 5110,
+	5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 5119, 5120, 5121, 5122, 5123, 5124, 5125, 5126,
+	5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139, 5140, 5141, 5142,
+	5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152, 5153, 5154, 5155, 5156, 5157, 5158,
+	5159, 5160, 5161, 5162, 5163, 5164, 5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172, 5173, 5174,
+	5175, 5176, 5177, 5178, 5179, 5180, 5181, 5182, 5183, 5184, 5185, 5186, 5187, 5188, 5189, 5190,
+	5191, 5192, 5193, 5194, 5195, 5196, 5197, 5198, 5199, 5200, 5201, 5202, 5203, 5204, 5205, 5206,
+	5207, 5208, 5209, 5210, 5211, 5212, 5213, 5214, 5215, 5216, 5217, 5218, 5219, 5220, 5221, 5222,
+	5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231, 5232, 5233, 5234, 5235, 5236, 5237, 5238,
+	5239, 5240, 5241, 5242, 5243, 5244, 5245, 5246, 5247, 5248, 5249, 5250, 5251, 5252, 5253, 5254,
+	5255, 5256, 5257, 5258, 5259, 5260, 5261, 5262, 5263, 5264, 5265, 5266, 5267, 5268, 5269, 5270,
+	5271, 5272, 5273, 5274, 5275, 5276, 5277, 5278, 5279, 5280, 5281, 5282, 5283, 5284, 5285, 5286,
+	5287, 5288, 5289, 5290, 5291, 5292, 5293, 5294, 5295, 5296, 5297, 5298, 5299, 5300, 5301, 5302,
+	5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314, 5315, 5316, 5317, 5318,
+	5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334,
+	5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344, 5345, 5346, 5347, 5348, 5349, 5350,
+	5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 5360, 5361, 5362, 5363, 5364, 5365, 5366,
+	5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5376, 5377, 5378, 5379, 5380, 5381, 5382,
+	5383, 5384, 5385, 5386, 5387, 5388, 5389, 5390, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398,
+	5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410, 5411, 5412, 5413, 5414,
+	5415, 5416, 5417, 5418, 5419, 5420, 5421, 5422, 5423, 5424, 5425, 5426, 5427, 5428, 5429, 5430,
+	5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439, 5440, 5441, 5442, 5443, 5444, 5445, 5446,
+	5447, 5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5457, 5458, 5459, 5460, 5461, 5462,
+	5463, 5464, 5465, 5466, 5467, 5468, 5469, 5470, 5471, 5472, 5473, 5474, 5475, 5476, 5477, 5478,
+	5790, 5791, 5792, 5793, 5794, 5795, 5796, 5797, 5798, 5799, 5800, 5801, 5802, 5803, 5804, 5805,
+	5806, 5807, 5808, 5809, 5810, 5811, 5812, 5813, 5814, 5815, 5816, 5817, 5818, 5819, 5820, 5821,
+	5822, 5823, 5824, 5825, 5826, 5827, 5828, 5829, 5830, 5831, 5832, 5833, 5834, 5835, 5836, 5837,
+	5838, 5839, 5840, 5841, 5842, 5843, 5844, 5845, 5846, 5847, 5848, 5849, 5850, 5851, 5852, 5853,
+	5854, 5855, 5856, 5857, 5858, 5859, 5860, 5861, 5862, 5863, 5864, 5865, 5866, 5867, 5868, 5869,
+	5870, 5871, 5872, 5873, 5874, 5875, 5876, 5877, 5878, 5879, 5880, 5881, 5882, 5883, 5884, 5885,
+	5886, 5887, 5888, 5889, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899, 5900, 5901,
+	5902, 5903, 5904, 5905, 5906, 5907, 5908, 5909, 5910, 5911, 5912, 5913, 5914, 5915, 5916, 5917,
+	5918, 5919, 5920, 5921, 5922, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933,
+	5934, 5935, 5936, 5937, 5938, 5939, 5940, 5941, 5942, 5943, 5944, 5945, 5946, 5947, 5948, 5949,
+	5950, 5951, 5952, 5953, 5954, 5955, 5956, 5957, 5958, 5959, 5960, 5961, 5962, 5963, 5964, 5965,
+	5966, 5967, 5968, 5969, 5970, 5971, 5972, 5973, 5974, 5975, 5976, 5977, 5978, 5979, 5980, 5981,
+	5982, 5983, 5984, 5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995, 5996, 5997,
+	5998, 5999, 6000, 6001, 6002, 6003, 6004, 6005, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	6006, 6007, 6008, 6009, 6010, 6011, 6012, 6013, 6014, 6015, 6016, 6017, 6018, 32767, 32767, 32767,
+	6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6027, 6028, 6029, 6030, 6031, 32767, 32767, 32767,
+	6032, 6033, 6034, 6035, 6036, 6037, 6038, 6039, 6040, 6041, 6042, 6043, 6044, 6045, 6046, 6047,
+	6048, 6049, 6050, 6051, 6052, 6053, 6054, 6055, 6056, 6057, 6058, 6059, 6060, 6061, 6062, 6063,
+	6064, 6065, 6066, 6067, 6068, 6069, 6070, 6071, 6072, 6073, 6074, 6075, 6076, 6077, 6078, 6079,
+	6080, 6081, 6082, 6083, 6084, 6085, 6086, 6087, 6088, 6089, 6090, 6091, 6092, 6093, 6094, 6095,
+	6096, 6097, 6098, 6099, 6100, 6101, 6102, 6103, 6104, 6105, 6106, 6107, 6108, 6109, 6110, 6111,
+	6112, 6113, 6114, 6115, 6116, 6117, 6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125, 6126, 6127,
+	6128, 6129, 6130, 6131, 6132, 6133, 6134, 6135, 6136, 6137, 6138, 6139, 6140, 6141, 6142, 6143,
+	6144, 6145, 6146, 6147, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	6148, 6149, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157, 6158, 6159, 6160, 6161, 6162, 6163,
+	6164, 6165, 6166, 6167, 6168, 6169, 6170, 6171, 6172, 6173, 6174, 6175, 6176, 6177, 6178, 6179,
+	6180, 6181, 6182, 6183, 6184, 6185, 6186, 6187, 6188, 6189, 6190, 6191, 6192, 6193, 6194, 6195,
+	6196, 6197, 6198, 6199, 6200, 6201, 6202, 6203, 6204, 6205, 6206, 6207, 6208, 6209, 6210, 6211,
+	6212, 6213, 6214, 6215, 6216, 6217, 6218, 6219, 6220, 6221, 6222, 6223, 6224, 6225, 6226, 6227,
+	6228, 6229, 6230, 6231, 6232, 6233, 6234, 6235, 6236, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	6237, 6238, 6239, 6240, 6241, 6242, 6243, 6244, 6245, 6246, 6247, 6248, 32767, 32767, 32767, 32767,
+	6249, 6250, 6251, 6252, 6253, 6254, 6255, 6256, 6257, 6258, 6259, 6260, 32767, 32767, 32767, 32767,
+	6261, 6262, 6263, 6264, 6265, 6266, 6267, 6268, 6269, 6270, 6271, 6272, 6273, 6274, 6275, 6276,
+	6277, 6278, 6279, 6280, 6281, 6282, 6283, 6284, 6285, 6286, 6287, 6288, 6289, 6290, 6291, 6292,
+	6293, 6294, 6295, 6296, 6297, 6298, 6299, 6300, 6301, 6302, 6303, 6304, 6305, 6306, 6307, 6308,
+	6309, 6310, 6311, 6312, 6313, 6314, 6315, 6316, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	6317, 6318, 6319, 6320, 6321, 6322, 6323, 6324, 6325, 6326, 32767, 32767, 32767, 32767, 32767, 32767,
+	6327, 6328, 6329, 6330, 6331, 6332, 6333, 6334, 6335, 6336, 6337, 6338, 6339, 6340, 6341, 6342,
+	6343, 6344, 6345, 6346, 6347, 6348, 6349, 6350, 6351, 6352, 6353, 6354, 6355, 6356, 6357, 6358,
+	6359, 6360, 6361, 6362, 6363, 6364, 6365, 6366, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	6367, 6368, 6369, 6370, 6371, 6372, 6373, 6374, 6375, 6376, 6377, 6378, 6379, 6380, 6381, 6382,
+	6383, 6384, 6385, 6386, 6387, 6388, 6389, 6390, 6391, 6392, 6393, 6394, 6395, 6396, 32767, 32767,
+	6397, 6398, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488, 5489, 5490, 5491, 5492, 5493, 5494,
+	5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502, 5503, 5504, 5505, 5506, 5507, 5508, 5509, 5510,
+	5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518, 5519, 5520, 5521, 5522, 5523, 5524, 5525, 5526,
+	5527, 5528, 5529, 5530, 5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539, 5540, 5541, 5542,
+	5543, 5544, 5545, 5546, 5547, 5548, 5549, 5550, 5551, 5552, 5553, 5554, 5555, 5556, 5557, 5558,
+	5559, 5560, 5561, 5562, 5563, 5564, 5565, 5566, 5567, 5568, 5569, 5570, 5571, 5572, 5573, 5574,
+	5575, 5576, 5577, 5578, 5579, 5580, 5581, 5582, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590,
+	5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 32767, 5600, 5601, 5602, 5603, 5604, 5605,
+	5606, 5607, 5608, 5609, 5610, 5611, 5612, 5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621,
+	5622, 5623, 5624, 5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636, 5637,
+	5638, 5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5649, 5650, 5651, 5652, 5653,
+	5654, 5655, 5656, 5657, 5658, 5659, 5660, 5661, 5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669,
+	5670, 5671, 5672, 5673, 5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681, 32767, 5682, 5683, 5684,
+	5685, 5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 5696, 5697, 5698, 5699, 5700,
+	5701, 5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709, 5710, 5711, 5712, 5713, 5714, 5715, 5716,
+	5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732,
+	4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616,
+	4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632,
+	4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648,
+	4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664,
+	4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680,
+	4681, 4682, 4683, 4684, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	4685, 4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 32767, 32767,
+	5733, 5734, 5735, 5736, 5737, 32767, 32767, 32767, 5738, 5739, 5740, 32767, 32767, 32767, 32767, 32767,
+	5741, 5742, 5743, 5744, 5745, 5746, 5747, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	5748, 5749, 5750, 5751, 5752, 5753, 5754, 5755, 5756, 5757, 5758, 5759, 5760, 5761, 5762, 5763,
+	5764, 5765, 5766, 5767, 5768, 5769, 5770, 5771, 5772, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	5773, 5774, 5775, 5776, 5777, 5778, 5779, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	5780, 5781, 5782, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	5783, 5784, 5785, 5786, 5787, 5788, 5789, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912,
+	1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928,
+	1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
+	1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960,
+	1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976,
+	1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992,
+	1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008,
+	2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024,
+	2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040,
+	2041, 2042, 2043, 32767, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
+	2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
+	2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087,
+	2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 32767, 32767, 32767, 32767, 32767,
+	41827, 41830, 41833, 41836, 41839, 39622, 41842, 41845, 41848, 41851, 39625, 41854, 41857, 41860, 39628, 41863,
+	41866, 41869, 41872, 41875, 41878, 41713, 41881, 41884, 41887, 41890, 41893, 39784, 41896, 36150, 41899, 41902,
+	41905, 41908, 41767, 41911, 41914, 39799, 39631, 39634, 39802, 41917, 41920, 39049, 41923, 39637, 41926, 41929,
+	41932, 41935, 41935, 41935, 41938, 41941, 41944, 41947, 41950, 41953, 41956, 41959, 41962, 41965, 41968, 41971,
+	41974, 41977, 41980, 41983, 41986, 41989, 41989, 39808, 41992, 41995, 41998, 42001, 39643, 42004, 42007, 42010,
+	39487, 42013, 42016, 42019, 42022, 42025, 42028, 42031, 42034, 42037, 42040, 42043, 42046, 41692, 42049, 42052,
+	42055, 42058, 42061, 42064, 42067, 42070, 42073, 42076, 42079, 42082, 42085, 42085, 42088, 42091, 42094, 39037,
+	42097, 42100, 42103, 42106, 42109, 35765, 42112, 42115, 36231, 42118, 42121, 42124, 42127, 42130, 42133, 42136,
+	42139, 42142, 42145, 42148, 42151, 42154, 42157, 42160, 42163, 42166, 42169, 42172, 42175, 42178, 38881, 42181,
+	36258, 42184, 42184, 42187, 42190, 42190, 42193, 42196, 42199, 42202, 42205, 42208, 42211, 42214, 42217, 42220,
+	42223, 42226, 42229, 39658, 42232, 42235, 42238, 42241, 39844, 42241, 42244, 39664, 42247, 42250, 42253, 42256,
+	39667, 38800, 42259, 42262, 42265, 42268, 42271, 42274, 42277, 42280, 42283, 42286, 42289, 42292, 42295, 42298,
+	42301, 42304, 42307, 42310, 42313, 42316, 42319, 42322, 39670, 42325, 42328, 42331, 42334, 42337, 42340, 39676,
+	42343, 42346, 42349, 42352, 42355, 42358, 42361, 42364, 38884, 39868, 42367, 42370, 42373, 42376, 42379, 42382,
+	42385, 42388, 39679, 42391, 42394, 42397, 42400, 39994, 42403, 42406, 42409, 42412, 42415, 42418, 42421, 42424,
+	42427, 42430, 42433, 42436, 42439, 39088, 42442, 42445, 42448, 42451, 42454, 42457, 42460, 42463, 42466, 42469,
+	42472, 39682, 39337, 42475, 42478, 42481, 42484, 42487, 42490, 42493, 42496, 39877, 42499, 42502, 42505, 42508,
+	42511, 42514, 42517, 42520, 39880, 42523, 42526, 42529, 42532, 42535, 42538, 42541, 42544, 42547, 42550, 42553,
+	42556, 39886, 42559, 42562, 42565, 42568, 42571, 42574, 42577, 42580, 42583, 42586, 42589, 42589, 42592, 42595,
+	39892, 42598, 42601, 42604, 42607, 42610, 42613, 42616, 39046, 42619, 42622, 42625, 42628, 42631, 42634, 42637,
+	39910, 42640, 42643, 42646, 42649, 42652, 42655, 42655, 39913, 40000, 42658, 42661, 42664, 42667, 42670, 38935,
+	39919, 42673, 42676, 39709, 42679, 42682, 39562, 42685, 42688, 39718, 42691, 42694, 42697, 42700, 42700, 42703,
+	42706, 42709, 42712, 42715, 42718, 42721, 42724, 42727, 42730, 42733, 42736, 42739, 42742, 42745, 42748, 42751,
+	42754, 42757, 42760, 42763, 42766, 42769, 42772, 42775, 42778, 42781, 39736, 42784, 42787, 42790, 42793, 42796,
+	42799, 42802, 42805, 42808, 42811, 42814, 42817, 42820, 42823, 42826, 42829, 42187, 42832, 42835, 42838, 42841,
+	42844, 42847, 42850, 42853, 42856, 42859, 42862, 42865, 39097, 42868, 42871, 42874, 42877, 42880, 42883, 39742,
+	42886, 42889, 42892, 42895, 42898, 42901, 42904, 42907, 42910, 42913, 42916, 42919, 42922, 42925, 42928, 42931,
+	42934, 42937, 42940, 42943, 38920, 42946, 42949, 42952, 42955, 42958, 42961, 39940, 42964, 42967, 42970, 42973,
+	42976, 42979, 42982, 42985, 36528, 42988, 42991, 42994, 42997, 43000, 43003, 43006, 43009, 43012, 43015, 43018,
+	39955, 39958, 36546, 43021, 43024, 43027, 43030, 43033, 43036, 43039, 43042, 43045, 43048, 43051, 43054, 39961,
+	43057, 43060, 43063, 43066, 43069, 43072, 43075, 43078, 43081, 43084, 43087, 43090, 43093, 43096, 43099, 43102,
+	43105, 43108, 43111, 43114, 43117, 43120, 43123, 43126, 43129, 43132, 43135, 43138, 43141, 43144, 39979, 39979,
+	43147, 43150, 43153, 43156, 43159, 43162, 43165, 43168, 43171, 43174, 39982, 43177, 43180, 43183, 43186, 43189,
+	43192, 43195, 43198, 43201, 43204, 36684, 43207, 36696, 36067, 43210, 43213, 43216, 36711, 43219, 32767, 32767,
+	32767, 0, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+};
+
+SPRT_INLINE inline uint16_t getCollationValue(char32_t c) {
+	if (c >= 0x11'0000) {
+		return CollationDefaultValue;
+	}
+	const auto chunk = s_collationChunks[c >> CollationChunkShift];
+	const auto block = s_collationBlocks[(uint32_t(chunk) << (CollationChunkShift - CollationBlockShift))
+			+ ((c >> CollationBlockShift) & ((1 << (CollationChunkShift - CollationBlockShift)) - 1))];
+	return s_collationData[(uint32_t(block) << CollationBlockShift) + (c & ((1 << CollationBlockShift) - 1))];
+}
+
+static constexpr uint32_t s_collationExpansions[10454] = {
+	0x0000003, 0x01D9901, 0x0047601, 0x01D9C01, 0x0000003, 0x01D9901, 0x0047601, 0x01D9A01,
+	0x0000003, 0x01D9B01, 0x0047601, 0x01D9C01, 0x0000002, 0x01DA201, 0x0000006, 0x0000002,
+	0x01DA201, 0x0000005, 0x0000002, 0x01DA201, 0x0000008, 0x0000002, 0x01DA201, 0x000000E,
+	0x0000002, 0x01DA201, 0x000000C, 0x0000002, 0x01DA201, 0x000000A, 0x0000003, 0x01DA201,
+	0x00000F9, 0x01DD101, 0x0000002, 0x01DBB01, 0x0000011, 0x0000002, 0x01DD101, 0x0000006,
+	0x0000002, 0x01DD101, 0x0000005, 0x0000002, 0x01DD101, 0x0000008, 0x0000002, 0x01DD101,
+	0x000000C, 0x0000002, 0x01E0901, 0x0000006, 0x0000002, 0x01E0901, 0x0000005, 0x0000002,
+	0x01E0901, 0x0000008, 0x0000002, 0x01E0901, 0x000000C, 0x0000002, 0x01DC401, 0x00000F9,
+	0x0000002, 0x01E4301, 0x000000E, 0x0000002, 0x01E5201, 0x0000006, 0x0000002, 0x01E5201,
+	0x0000005, 0x0000002, 0x01E5201, 0x0000008, 0x0000002, 0x01E5201, 0x000000E, 0x0000002,
+	0x01E5201, 0x000000C, 0x0000002, 0x01E5201, 0x0000010, 0x0000002, 0x01EBB01, 0x0000006,
+	0x0000002, 0x01EBB01, 0x0000005, 0x0000002, 0x01EBB01, 0x0000008, 0x0000002, 0x01EBB01,
+	0x000000C, 0x0000002, 0x01EEA01, 0x0000005, 0x0000003, 0x01EA001, 0x00000F9, 0x01EA001,
+	0x0000002, 0x01EEA01, 0x000000C, 0x0000002, 0x01DA201, 0x0000013, 0x0000002, 0x01DA201,
+	0x0000007, 0x0000002, 0x01DA201, 0x0000012, 0x0000002, 0x01DBB01, 0x0000005, 0x0000002,
+	0x01DBB01, 0x0000008, 0x0000002, 0x01DBB01, 0x000000F, 0x0000002, 0x01DBB01, 0x0000009,
+	0x0000002, 0x01DC401, 0x0000009, 0x0000002, 0x01DC401, 0x000001A, 0x0000002, 0x01DD101,
+	0x0000013, 0x0000002, 0x01DD101, 0x0000007, 0x0000002, 0x01DD101, 0x000000F, 0x0000002,
+	0x01DD101, 0x0000012, 0x0000002, 0x01DD101, 0x0000009, 0x0000002, 0x01DF101, 0x0000008,
+	0x0000002, 0x01DF101, 0x0000007, 0x0000002, 0x01DF101, 0x000000F, 0x0000002, 0x01DF101,
+	0x0000011, 0x0000002, 0x01DFD01, 0x0000008, 0x0000002, 0x01DFD01, 0x000001A, 0x0000002,
+	0x01E0901, 0x000000E, 0x0000002, 0x01E0901, 0x0000013, 0x0000002, 0x01E0901, 0x0000007,
+	0x0000002, 0x01E0901, 0x0000012, 0x0000002, 0x01E0901, 0x000000F, 0x0000002, 0x01E0901,
+	0x01E1501, 0x0000002, 0x01E1501, 0x0000008, 0x0000002, 0x01E1C01, 0x0000011, 0x0000002,
+	0x01E2501, 0x0000005, 0x0000002, 0x01E2501, 0x0000011, 0x0000002, 0x01E2501, 0x0000009,
+	0x0000002, 0x01E2501, 0x00000F9, 0x0000002, 0x01E2501, 0x000001A, 0x0000002, 0x01E4301,
+	0x0000005, 0x0000002, 0x01E4301, 0x0000011, 0x0000002, 0x01E4301, 0x0000009, 0x0000002,
+	0x01F1801, 0x01E4301, 0x0000002, 0x01E5201, 0x0000013, 0x0000002, 0x01E5201, 0x0000007,
+	0x0000002, 0x01E5201, 0x000000D, 0x0000003, 0x01E5201, 0x00000F9, 0x01DD101, 0x0000002,
+	0x01E8201, 0x0000005, 0x0000002, 0x01E8201, 0x0000011, 0x0000002, 0x01E8201, 0x0000009,
+	0x0000002, 0x01EA001, 0x0000005, 0x0000002, 0x01EA001, 0x0000008, 0x0000002, 0x01EA001,
+	0x0000011, 0x0000002, 0x01EA001, 0x0000009, 0x0000002, 0x01EB001, 0x0000011, 0x0000002,
+	0x01EB001, 0x0000009, 0x0000002, 0x01EBB01, 0x000000E, 0x0000002, 0x01EBB01, 0x0000013,
+	0x0000002, 0x01EBB01, 0x0000007, 0x0000002, 0x01EBB01, 0x000000A, 0x0000002, 0x01EBB01,
+	0x000000D, 0x0000002, 0x01EBB01, 0x0000012, 0x0000002, 0x01EDC01, 0x0000008, 0x0000002,
+	0x01EEA01, 0x0000008, 0x0000002, 0x01EF101, 0x0000005, 0x0000002, 0x01EF101, 0x000000F,
+	0x0000002, 0x01EF101, 0x0000009, 0x0000002, 0x01EA001, 0x00000FA, 0x0000002, 0x01EF101,
+	0x01EDC01, 0x0000002, 0x01E5201, 0x0000020, 0x0000002, 0x01EBB01, 0x0000020, 0x0000002,
+	0x01EB001, 0x01EA001, 0x0000003, 0x01DC401, 0x01EF101, 0x0000009, 0x0000002, 0x01E2501,
+	0x01E1501, 0x0000002, 0x01E4301, 0x01E1501, 0x0000002, 0x01DA201, 0x0000009, 0x0000002,
+	0x01E0901, 0x0000009, 0x0000002, 0x01E5201, 0x0000009, 0x0000002, 0x01EBB01, 0x0000009,
+	0x0000003, 0x01EBB01, 0x000000C, 0x0000013, 0x0000003, 0x01EBB01, 0x000000C, 0x0000005,
+	0x0000003, 0x01EBB01, 0x000000C, 0x0000009, 0x0000003, 0x01EBB01, 0x000000C, 0x0000006,
+	0x0000003, 0x01DA201, 0x000000C, 0x0000013, 0x0000003, 0x01DA201, 0x000000F, 0x0000013,
+	0x0000004, 0x01DA201, 0x00000F9, 0x01DD101, 0x0000013, 0x0000002, 0x01DF101, 0x0000009,
+	0x0000002, 0x01E1C01, 0x0000009, 0x0000002, 0x01E5201, 0x0000012, 0x0000003, 0x01E5201,
+	0x0000012, 0x0000013, 0x0000002, 0x01EFC01, 0x0000009, 0x0000002, 0x01E1501, 0x0000009,
+	0x0000002, 0x01DC401, 0x01EF101, 0x0000002, 0x01DF101, 0x0000005, 0x0000002, 0x01E4301,
+	0x0000006, 0x0000003, 0x01DA201, 0x000000A, 0x0000005, 0x0000004, 0x01DA201, 0x00000F9,
+	0x01DD101, 0x0000005, 0x0000003, 0x01E5201, 0x0000010, 0x0000005, 0x0000002, 0x01DA201,
+	0x000001D, 0x0000002, 0x01DA201, 0x000001F, 0x0000002, 0x01DD101, 0x000001D, 0x0000002,
+	0x01DD101, 0x000001F, 0x0000002, 0x01E0901, 0x000001D, 0x0000002, 0x01E0901, 0x000001F,
+	0x0000002, 0x01E5201, 0x000001D, 0x0000002, 0x01E5201, 0x000001F, 0x0000002, 0x01E8201,
+	0x000001D, 0x0000002, 0x01E8201, 0x000001F, 0x0000002, 0x01EBB01, 0x000001D, 0x0000002,
+	0x01EBB01, 0x000001F, 0x0000002, 0x01EA001, 0x0000026, 0x0000002, 0x01EB001, 0x0000026,
+	0x0000002, 0x01DFD01, 0x0000009, 0x0000002, 0x01DA201, 0x000000F, 0x0000002, 0x01DD101,
+	0x0000011, 0x0000003, 0x01E5201, 0x000000C, 0x0000013, 0x0000003, 0x01E5201, 0x000000E,
+	0x0000013, 0x0000002, 0x01E5201, 0x000000F, 0x0000003, 0x01E5201, 0x000000F, 0x0000013,
+	0x0000002, 0x01EEA01, 0x0000013, 0x0000002, 0x01DC401, 0x01DB001, 0x0000002, 0x01E7B01,
+	0x01E6F01, 0x0000002, 0x01DC401, 0x01EFC01, 0x0000002, 0x01DC401, 0x01EF801, 0x0000002,
+	0x01EB001, 0x01EA901, 0x0000002, 0x01EB001, 0x01DC101, 0x0000002, 0x01DE801, 0x01E5001,
+	0x0000002, 0x01E2501, 0x01EA001, 0x0000002, 0x01E2501, 0x01EF101, 0x0000001, 0x0000006,
+	0x0000001, 0x0000005, 0x0000001, 0x0000008, 0x0000001, 0x000000E, 0x0000001, 0x0000013,
+	0x0000001, 0x000001B, 0x0000001, 0x0000007, 0x0000001, 0x000000F, 0x0000001, 0x000000C,
+	0x0000001, 0x000001C, 0x0000001, 0x000000A, 0x0000001, 0x000000D, 0x0000001, 0x0000009,
+	0x0000001, 0x0000014, 0x0000001, 0x000001D, 0x0000001, 0x000001E, 0x0000001, 0x000001F,
+	0x0000001, 0x0000003, 0x0000001, 0x0000004, 0x0000001, 0x0000015, 0x0000001, 0x0000020,
+	0x0000001, 0x0000021, 0x0000001, 0x0000022, 0x0000001, 0x0000023, 0x0000001, 0x0000024,
+	0x0000001, 0x0000025, 0x0000001, 0x0000026, 0x0000001, 0x0000011, 0x0000001, 0x0000012,
+	0x0000001, 0x0000027, 0x0000001, 0x0000028, 0x0000001, 0x0000029, 0x0000001, 0x000002A,
+	0x0000001, 0x0000002, 0x0000001, 0x000002B, 0x0000001, 0x000001A, 0x0000001, 0x0000016,
+	0x0000001, 0x0000010, 0x0000001, 0x000002C, 0x0000001, 0x000000B, 0x0000002, 0x000000C,
+	0x0000005, 0x0000001, 0x000002D, 0x0000001, 0x000002E, 0x0000001, 0x000002F, 0x0000001,
+	0x0000030, 0x0000002, 0x002BB01, 0x0000005, 0x0000002, 0x01F2F01, 0x0000005, 0x0000002,
+	0x01F3401, 0x0000005, 0x0000002, 0x01F3A01, 0x0000005, 0x0000002, 0x01F3C01, 0x0000005,
+	0x0000002, 0x01F4401, 0x0000005, 0x0000002, 0x01F5201, 0x0000005, 0x0000002, 0x01F5701,
+	0x0000005, 0x0000003, 0x01F3C01, 0x000000C, 0x0000005, 0x0000002, 0x01F3C01, 0x000000C,
+	0x0000002, 0x01F5201, 0x000000C, 0x0000003, 0x01F5201, 0x000000C, 0x0000005, 0x0000003,
+	0x01F3E01, 0x01F2F01, 0x01F3C01, 0x0000002, 0x01FA901, 0x0000006, 0x0000002, 0x01FA901,
+	0x000000C, 0x0000002, 0x01F9D01, 0x0000005, 0x0000002, 0x01FBC01, 0x000000C, 0x0000002,
+	0x01FC101, 0x0000005, 0x0000002, 0x01FBA01, 0x0000006, 0x0000002, 0x01FF101, 0x0000007,
+	0x0000002, 0x0203001, 0x000001D, 0x0000001, 0x0000031, 0x0000002, 0x01F9D01, 0x00000FA,
+	0x0000002, 0x01FAB01, 0x0000007, 0x0000002, 0x01F9801, 0x0000007, 0x0000002, 0x01F9801,
+	0x000000C, 0x0000002, 0x01FA901, 0x0000007, 0x0000002, 0x01F9901, 0x000000C, 0x0000002,
+	0x01FAB01, 0x000000C, 0x0000002, 0x01FAF01, 0x000000C, 0x0000002, 0x01FBA01, 0x0000013,
+	0x0000002, 0x01FBA01, 0x000000C, 0x0000002, 0x01FDF01, 0x000000C, 0x0000002, 0x01FE001,
+	0x000000C, 0x0000002, 0x0201F01, 0x000000C, 0x0000002, 0x01FF101, 0x0000013, 0x0000002,
+	0x01FF101, 0x000000C, 0x0000002, 0x01FF101, 0x000000D, 0x0000002, 0x0200801, 0x000000C,
+	0x0000002, 0x0201A01, 0x000000C, 0x0000002, 0x020E501, 0x0210301, 0x0000001, 0x0000033,
+	0x0000001, 0x0000034, 0x0000001, 0x0000035, 0x0000001, 0x0000036, 0x0000001, 0x0000037,
+	0x0000001, 0x0000038, 0x0000001, 0x0000039, 0x0000001, 0x000003A, 0x0000001, 0x000003B,
+	0x0000001, 0x000003C, 0x0000001, 0x000003D, 0x0000001, 0x0000040, 0x0000001, 0x0000041,
+	0x0000001, 0x000003F, 0x0000001, 0x000003E, 0x0000004, 0x0211201, 0x0210D01, 0x0210E01,
+	0x0210D01, 0x0000002, 0x0210E01, 0x0210E01, 0x0000002, 0x0210E01, 0x0211201, 0x0000002,
+	0x0211201, 0x0211201, 0x0000001, 0x000004E, 0x0000001, 0x0000051, 0x0000001, 0x0000054,
+	0x0000001, 0x0000057, 0x0000001, 0x000005B, 0x0000001, 0x000005E, 0x0000001, 0x0000061,
+	0x0000001, 0x0000062, 0x0000001, 0x0000063, 0x0000001, 0x0000064, 0x0000001, 0x0000065,
+	0x0000001, 0x0000067, 0x0000001, 0x0000068, 0x0000001, 0x0000069, 0x0000001, 0x000006B,
+	0x0000001, 0x000006C, 0x0000001, 0x000006D, 0x0000001, 0x000006E, 0x0000001, 0x000006F,
+	0x0000001, 0x0000070, 0x0000001, 0x0000066, 0x0000001, 0x0000079, 0x0000002, 0x0215D01,
+	0x0214F01, 0x0000002, 0x0221301, 0x0214F01, 0x0000002, 0x0221701, 0x0214F01, 0x0000002,
+	0x0222201, 0x0214F01, 0x0000002, 0x0221201, 0x0000064, 0x0000002, 0x0220F01, 0x0000064,
+	0x0000002, 0x0223001, 0x0000064, 0x0000002, 0x0214F01, 0x00000FA, 0x0000002, 0x021FF01,
+	0x00000FA, 0x0000001, 0x000007A, 0x0000002, 0x0223501, 0x00000FA, 0x0000002, 0x0223D01,
+	0x00000FA, 0x0000002, 0x0224701, 0x00000FA, 0x0000002, 0x0223401, 0x00000FB, 0x0000002,
+	0x0223501, 0x00000FB, 0x0000002, 0x0223701, 0x00000FB, 0x0000001, 0x000007B, 0x0000001,
+	0x000007C, 0x0000001, 0x000007D, 0x0000001, 0x000007E, 0x0000001, 0x000007F, 0x0000001,
+	0x0000080, 0x0000001, 0x0000081, 0x0000001, 0x0000082, 0x0000001, 0x0000083, 0x0000001,
+	0x0000084, 0x0000001, 0x0000085, 0x0000001, 0x0000086, 0x0000001, 0x0000087, 0x0000001,
+	0x0000088, 0x0000001, 0x0000089, 0x0000001, 0x000008A, 0x0000002, 0x022B001, 0x00000F9,
+	0x0000002, 0x022B101, 0x00000F9, 0x0000002, 0x022B301, 0x00000F9, 0x0000001, 0x000008B,
+	0x0000001, 0x000008C, 0x0000001, 0x000008D, 0x0000001, 0x000008E, 0x0000001, 0x000008F,
+	0x0000001, 0x0000090, 0x0000001, 0x0000091, 0x0000001, 0x0000092, 0x0000001, 0x0000093,
+	0x0000001, 0x000004B, 0x0000001, 0x000004C, 0x0000001, 0x0000043, 0x0000001, 0x0000044,
+	0x0000001, 0x0000045, 0x0000001, 0x0000046, 0x0000001, 0x0000047, 0x0000001, 0x0000048,
+	0x0000001, 0x0000049, 0x0000001, 0x000004A, 0x0000001, 0x000004D, 0x0000001, 0x0000071,
+	0x0000001, 0x0000058, 0x0000001, 0x000005C, 0x0000001, 0x000005F, 0x0000001, 0x0000050,
+	0x0000001, 0x0000053, 0x0000001, 0x0000056, 0x0000001, 0x000004F, 0x0000001, 0x0000052,
+	0x0000001, 0x0000055, 0x0000001, 0x0000059, 0x0000001, 0x000005A, 0x0000001, 0x0000060,
+	0x0000001, 0x0000072, 0x0000001, 0x0000073, 0x0000001, 0x0000077, 0x0000001, 0x0000078,
+	0x0000001, 0x0000075, 0x0000001, 0x0000076, 0x0000001, 0x0000074, 0x0000001, 0x000005D,
+	0x0000001, 0x000006A, 0x0000001, 0x00000A4, 0x0000001, 0x00000A5, 0x0000001, 0x00000A6,
+	0x0000002, 0x024F601, 0x00000A3, 0x0000002, 0x024FF01, 0x00000A3, 0x0000002, 0x0250101,
+	0x00000A3, 0x0000001, 0x00000A3, 0x0000002, 0x024DE01, 0x00000A3, 0x0000002, 0x024DF01,
+	0x00000A3, 0x0000002, 0x024E001, 0x00000A3, 0x0000002, 0x024E601, 0x00000A3, 0x0000002,
+	0x024EE01, 0x00000A3, 0x0000002, 0x024F001, 0x00000A3, 0x0000002, 0x024F801, 0x00000A3,
+	0x0000002, 0x024FD01, 0x00000A3, 0x0000002, 0x0254601, 0x0256701, 0x0000002, 0x0254301,
+	0x00000A3, 0x0000002, 0x0254401, 0x00000A3, 0x0000002, 0x0255001, 0x00000A3, 0x0000001,
+	0x00000A7, 0x0000002, 0x0259601, 0x00000A3, 0x0000002, 0x0257701, 0x00000A3, 0x0000002,
+	0x0257B01, 0x00000A3, 0x0000002, 0x0257C01, 0x00000A3, 0x0000002, 0x0258101, 0x00000A3,
+	0x0000002, 0x0258F01, 0x00000A3, 0x0000001, 0x00000A8, 0x0000001, 0x00000A9, 0x0000002,
+	0x0260201, 0x00000A3, 0x0000002, 0x0260301, 0x00000A3, 0x0000002, 0x0271D01, 0x0273A01,
+	0x0000002, 0x0271B01, 0x0273A01, 0x0000002, 0x0271C01, 0x0273A01, 0x0000002, 0x0272501,
+	0x0273A01, 0x0000002, 0x0271001, 0x0273A01, 0x0000002, 0x0271501, 0x0273A01, 0x0000002,
+	0x0271E01, 0x0273A01, 0x0000002, 0x0272401, 0x0273A01, 0x0000002, 0x0270201, 0x0273A01,
+	0x0000001, 0x00000B5, 0x0000001, 0x00000B6, 0x0000001, 0x00000B7, 0x0000001, 0x00000B8,
+	0x0000001, 0x00000B9, 0x0000001, 0x00000BA, 0x0000001, 0x00000BB, 0x0000001, 0x00000B4,
+	0x0000001, 0x00000BC, 0x0000001, 0x00000BD, 0x0000001, 0x00000BE, 0x0000001, 0x00000BF,
+	0x0000001, 0x00000C0, 0x0000001, 0x00000C1, 0x0000002, 0x02D6901, 0x02D5A01, 0x0000002,
+	0x02D6901, 0x02D6201, 0x0000003, 0x02E0A01, 0x02E2101, 0x00000A5, 0x0000001, 0x00000C4,
+	0x0000002, 0x02DC901, 0x02E0901, 0x0000002, 0x02DD901, 0x02E0901, 0x0000002, 0x02DE101,
+	0x02E0901, 0x0000002, 0x02DE901, 0x02E0901, 0x0000002, 0x02DF101, 0x02E0901, 0x0000002,
+	0x02DC401, 0x02E0501, 0x0000002, 0x02DFD01, 0x00000FA, 0x0000002, 0x02DCA01, 0x02E0901,
+	0x0000002, 0x02DDA01, 0x02E0901, 0x0000002, 0x02DE201, 0x02E0901, 0x0000002, 0x02DEA01,
+	0x02E0901, 0x0000002, 0x02DF201, 0x02E0901, 0x0000002, 0x02DC501, 0x02E0501, 0x0000002,
+	0x02DF401, 0x00000FA, 0x0000002, 0x02DFC01, 0x00000FA, 0x0000002, 0x02DFE01, 0x00000FA,
+	0x0000001, 0x00000C8, 0x0000003, 0x030B401, 0x030ED01, 0x030B401, 0x0000001, 0x0000096,
+	0x0000001, 0x0000095, 0x0000001, 0x0000094, 0x0000002, 0x0372001, 0x00000F9, 0x0000002,
+	0x0372101, 0x00000F9, 0x0000002, 0x0372101, 0x00000FA, 0x0000002, 0x0372201, 0x00000F9,
+	0x0000002, 0x0372301, 0x00000F9, 0x0000002, 0x0372301, 0x00000FA, 0x0000002, 0x0372301,
+	0x00000FB, 0x0000002, 0x0372301, 0x00000FC, 0x0000002, 0x0372801, 0x00000F9, 0x0000002,
+	0x0372801, 0x00000FA, 0x0000002, 0x0372801, 0x00000FB, 0x0000002, 0x0372801, 0x00000FC,
+	0x0000002, 0x0372C01, 0x00000F9, 0x0000002, 0x0372C01, 0x00000FA, 0x0000002, 0x0372C01,
+	0x00000FB, 0x0000002, 0x0372D01, 0x00000F9, 0x0000002, 0x0372D01, 0x00000FA, 0x0000002,
+	0x0372E01, 0x00000F9, 0x0000002, 0x0373001, 0x00000F9, 0x0000002, 0x0373101, 0x00000F9,
+	0x0000002, 0x0373501, 0x00000F9, 0x0000002, 0x0373501, 0x00000FB, 0x0000002, 0x0373501,
+	0x00000FC, 0x0000002, 0x0373501, 0x00000FD, 0x0000002, 0x0373701, 0x00000F9, 0x0000002,
+	0x0373701, 0x00000FA, 0x0000002, 0x0373801, 0x00000F9, 0x0000002, 0x0373801, 0x00000FA,
+	0x0000002, 0x0373301, 0x00000F9, 0x0000002, 0x0373B01, 0x00000F9, 0x0000002, 0x0373B01,
+	0x00000FA, 0x0000002, 0x0373C01, 0x00000F9, 0x0000002, 0x0373D01, 0x00000F9, 0x0000002,
+	0x0374D01, 0x00000F9, 0x0000002, 0x0374D01, 0x00000FA, 0x0000002, 0x0372B01, 0x00000F9,
+	0x0000002, 0x0373501, 0x00000FA, 0x0000002, 0x0373101, 0x0373C01, 0x0000004, 0x0373B01,
+	0x00000F9, 0x0373B01, 0x00000F9, 0x0000002, 0x0372201, 0x0372201, 0x0000001, 0x00000C9,
+	0x0000001, 0x00000CA, 0x0000001, 0x00000CB, 0x0000002, 0x02F4701, 0x02F6501, 0x0000002,
+	0x02F4A01, 0x02F6601, 0x0000001, 0x00000D4, 0x0000001, 0x00000D5, 0x0000001, 0x00000D6,
+	0x0000002, 0x031E501, 0x031FB01, 0x0000003, 0x031E501, 0x031FB01, 0x0320601, 0x0000003,
+	0x0323501, 0x0325B01, 0x0323501, 0x0000001, 0x00000CC, 0x0000001, 0x00000CD, 0x0000001,
+	0x00000CE, 0x0000001, 0x00000CF, 0x0000001, 0x00000D0, 0x0000001, 0x00000D1, 0x0000001,
+	0x00000D2, 0x0000001, 0x00000D3, 0x0000001, 0x0000017, 0x0000001, 0x00000AA, 0x0000001,
+	0x00000AC, 0x0000002, 0x01DF101, 0x00000FA, 0x0000003, 0x01EB001, 0x00000F9, 0x01DFD01,
+	0x0000002, 0x01DA201, 0x00000F9, 0x0000002, 0x01DA201, 0x01E5201, 0x0000002, 0x01DA201,
+	0x01ED301, 0x0000002, 0x01DC401, 0x00000FA, 0x0000002, 0x01E5201, 0x0000015, 0x0000002,
+	0x01EBB01, 0x0000015, 0x0000002, 0x01DA201, 0x0000025, 0x0000002, 0x01DB001, 0x000000F,
+	0x0000002, 0x01DB001, 0x0000023, 0x0000002, 0x01DB001, 0x000002A, 0x0000003, 0x01DBB01,
+	0x0000011, 0x0000005, 0x0000002, 0x01DC401, 0x000000F, 0x0000002, 0x01DC401, 0x0000023,
+	0x0000002, 0x01DC401, 0x000002A, 0x0000002, 0x01DC401, 0x0000011, 0x0000002, 0x01DC401,
+	0x0000027, 0x0000003, 0x01DD101, 0x0000013, 0x0000006, 0x0000003, 0x01DD101, 0x0000013,
+	0x0000005, 0x0000002, 0x01DD101, 0x0000027, 0x0000002, 0x01DD101, 0x0000029, 0x0000003,
+	0x01DD101, 0x0000011, 0x0000007, 0x0000002, 0x01DE801, 0x000000F, 0x0000002, 0x01DF101,
+	0x0000013, 0x0000002, 0x01DFD01, 0x000000F, 0x0000002, 0x01DFD01, 0x0000023, 0x0000002,
+	0x01DFD01, 0x000000C, 0x0000002, 0x01DFD01, 0x0000011, 0x0000002, 0x01DFD01, 0x0000028,
+	0x0000002, 0x01E0901, 0x0000029, 0x0000003, 0x01E0901, 0x000000C, 0x0000005, 0x0000002,
+	0x01E1C01, 0x0000005, 0x0000002, 0x01E1C01, 0x0000023, 0x0000002, 0x01E1C01, 0x000002A,
+	0x0000002, 0x01E2501, 0x0000023, 0x0000003, 0x01E2501, 0x0000023, 0x0000013, 0x0000002,
+	0x01E2501, 0x000002A, 0x0000002, 0x01E2501, 0x0000027, 0x0000002, 0x01E3A01, 0x0000005,
+	0x0000002, 0x01E3A01, 0x000000F, 0x0000002, 0x01E3A01, 0x0000023, 0x0000002, 0x01E4301,
+	0x000000F, 0x0000002, 0x01E4301, 0x0000023, 0x0000002, 0x01E4301, 0x000002A, 0x0000002,
+	0x01E4301, 0x0000027, 0x0000003, 0x01E5201, 0x000000E, 0x0000005, 0x0000003, 0x01E5201,
+	0x000000E, 0x000000C, 0x0000003, 0x01E5201, 0x0000013, 0x0000006, 0x0000003, 0x01E5201,
+	0x0000013, 0x0000005, 0x0000002, 0x01E6F01, 0x0000005, 0x0000002, 0x01E6F01, 0x000000F,
+	0x0000002, 0x01E8201, 0x000000F, 0x0000002, 0x01E8201, 0x0000023, 0x0000003, 0x01E8201,
+	0x0000023, 0x0000013, 0x0000002, 0x01E8201, 0x000002A, 0x0000002, 0x01EA001, 0x000000F,
+	0x0000002, 0x01EA001, 0x0000023, 0x0000003, 0x01EA001, 0x0000005, 0x000000F, 0x0000003,
+	0x01EA001, 0x0000009, 0x000000F, 0x0000003, 0x01EA001, 0x0000023, 0x000000F, 0x0000002,
+	0x01EB001, 0x000000F, 0x0000002, 0x01EB001, 0x0000023, 0x0000002, 0x01EB001, 0x000002A,
+	0x0000002, 0x01EB001, 0x0000027, 0x0000002, 0x01EBB01, 0x0000024, 0x0000002, 0x01EBB01,
+	0x0000029, 0x0000002, 0x01EBB01, 0x0000027, 0x0000003, 0x01EBB01, 0x000000E, 0x0000005,
+	0x0000003, 0x01EBB01, 0x0000013, 0x000000C, 0x0000002, 0x01ED301, 0x000000E, 0x0000002,
+	0x01ED301, 0x0000023, 0x0000002, 0x01EDC01, 0x0000006, 0x0000002, 0x01EDC01, 0x0000005,
+	0x0000002, 0x01EDC01, 0x000000C, 0x0000002, 0x01EDC01, 0x000000F, 0x0000002, 0x01EDC01,
+	0x0000023, 0x0000002, 0x01EE101, 0x000000F, 0x0000002, 0x01EE101, 0x000000C, 0x0000002,
+	0x01EEA01, 0x000000F, 0x0000002, 0x01EF101, 0x0000008, 0x0000002, 0x01EF101, 0x0000023,
+	0x0000002, 0x01EF101, 0x000002A, 0x0000002, 0x01DFD01, 0x000002A, 0x0000002, 0x01EB001,
+	0x000000C, 0x0000002, 0x01EDC01, 0x000000A, 0x0000002, 0x01EEA01, 0x000000A, 0x0000002,
+	0x01DA201, 0x01F1A01, 0x0000003, 0x01EA001, 0x00000FA, 0x000000F, 0x0000002, 0x01DA201,
+	0x0000023, 0x0000002, 0x01DA201, 0x000001C, 0x0000003, 0x01DA201, 0x0000008, 0x0000005,
+	0x0000003, 0x01DA201, 0x0000008, 0x0000006, 0x0000003, 0x01DA201, 0x0000008, 0x000001C,
+	0x0000003, 0x01DA201, 0x0000008, 0x000000E, 0x0000003, 0x01DA201, 0x0000023, 0x0000008,
+	0x0000003, 0x01DA201, 0x0000007, 0x0000005, 0x0000003, 0x01DA201, 0x0000007, 0x0000006,
+	0x0000003, 0x01DA201, 0x0000007, 0x000001C, 0x0000003, 0x01DA201, 0x0000007, 0x000000E,
+	0x0000003, 0x01DA201, 0x0000023, 0x0000007, 0x0000002, 0x01DD101, 0x0000023, 0x0000002,
+	0x01DD101, 0x000001C, 0x0000002, 0x01DD101, 0x000000E, 0x0000003, 0x01DD101, 0x0000008,
+	0x0000005, 0x0000003, 0x01DD101, 0x0000008, 0x0000006, 0x0000003, 0x01DD101, 0x0000008,
+	0x000001C, 0x0000003, 0x01DD101, 0x0000008, 0x000000E, 0x0000003, 0x01DD101, 0x0000023,
+	0x0000008, 0x0000002, 0x01E0901, 0x000001C, 0x0000002, 0x01E0901, 0x0000023, 0x0000002,
+	0x01E5201, 0x0000023, 0x0000002, 0x01E5201, 0x000001C, 0x0000003, 0x01E5201, 0x0000008,
+	0x0000005, 0x0000003, 0x01E5201, 0x0000008, 0x0000006, 0x0000003, 0x01E5201, 0x0000008,
+	0x000001C, 0x0000003, 0x01E5201, 0x0000008, 0x000000E, 0x0000003, 0x01E5201, 0x0000023,
+	0x0000008, 0x0000003, 0x01E5201, 0x0000020, 0x0000005, 0x0000003, 0x01E5201, 0x0000020,
+	0x0000006, 0x0000003, 0x01E5201, 0x0000020, 0x000001C, 0x0000003, 0x01E5201, 0x0000020,
+	0x000000E, 0x0000003, 0x01E5201, 0x0000020, 0x0000023, 0x0000002, 0x01EBB01, 0x0000023,
+	0x0000002, 0x01EBB01, 0x000001C, 0x0000003, 0x01EBB01, 0x0000020, 0x0000005, 0x0000003,
+	0x01EBB01, 0x0000020, 0x0000006, 0x0000003, 0x01EBB01, 0x0000020, 0x000001C, 0x0000003,
+	0x01EBB01, 0x0000020, 0x000000E, 0x0000003, 0x01EBB01, 0x0000020, 0x0000023, 0x0000002,
+	0x01EEA01, 0x0000006, 0x0000002, 0x01EEA01, 0x0000023, 0x0000002, 0x01EEA01, 0x000001C,
+	0x0000002, 0x01EEA01, 0x000000E, 0x0000002, 0x01E2501, 0x01E2501, 0x0000002, 0x01F2F01,
+	0x0000003, 0x0000002, 0x01F2F01, 0x0000004, 0x0000003, 0x01F2F01, 0x0000003, 0x0000006,
+	0x0000003, 0x01F2F01, 0x0000004, 0x0000006, 0x0000003, 0x01F2F01, 0x0000003, 0x0000005,
+	0x0000003, 0x01F2F01, 0x0000004, 0x0000005, 0x0000003, 0x01F2F01, 0x0000003, 0x000000B,
+	0x0000003, 0x01F2F01, 0x0000004, 0x000000B, 0x0000002, 0x01F3401, 0x0000003, 0x0000002,
+	0x01F3401, 0x0000004, 0x0000003, 0x01F3401, 0x0000003, 0x0000006, 0x0000003, 0x01F3401,
+	0x0000004, 0x0000006, 0x0000003, 0x01F3401, 0x0000003, 0x0000005, 0x0000003, 0x01F3401,
+	0x0000004, 0x0000005, 0x0000002, 0x01F3A01, 0x0000003, 0x0000002, 0x01F3A01, 0x0000004,
+	0x0000003, 0x01F3A01, 0x0000003, 0x0000006, 0x0000003, 0x01F3A01, 0x0000004, 0x0000006,
+	0x0000003, 0x01F3A01, 0x0000003, 0x0000005, 0x0000003, 0x01F3A01, 0x0000004, 0x0000005,
+	0x0000003, 0x01F3A01, 0x0000003, 0x000000B, 0x0000003, 0x01F3A01, 0x0000004, 0x000000B,
+	0x0000002, 0x01F3C01, 0x0000003, 0x0000002, 0x01F3C01, 0x0000004, 0x0000003, 0x01F3C01,
+	0x0000003, 0x0000006, 0x0000003, 0x01F3C01, 0x0000004, 0x0000006, 0x0000003, 0x01F3C01,
+	0x0000003, 0x0000005, 0x0000003, 0x01F3C01, 0x0000004, 0x0000005, 0x0000003, 0x01F3C01,
+	0x0000003, 0x000000B, 0x0000003, 0x01F3C01, 0x0000004, 0x000000B, 0x0000002, 0x01F4401,
+	0x0000003, 0x0000002, 0x01F4401, 0x0000004, 0x0000003, 0x01F4401, 0x0000003, 0x0000006,
+	0x0000003, 0x01F4401, 0x0000004, 0x0000006, 0x0000003, 0x01F4401, 0x0000003, 0x0000005,
+	0x0000003, 0x01F4401, 0x0000004, 0x0000005, 0x0000002, 0x01F5201, 0x0000003, 0x0000002,
+	0x01F5201, 0x0000004, 0x0000003, 0x01F5201, 0x0000003, 0x0000006, 0x0000003, 0x01F5201,
+	0x0000004, 0x0000006, 0x0000003, 0x01F5201, 0x0000003, 0x0000005, 0x0000003, 0x01F5201,
+	0x0000004, 0x0000005, 0x0000003, 0x01F5201, 0x0000003, 0x000000B, 0x0000003, 0x01F5201,
+	0x0000004, 0x000000B, 0x0000002, 0x01F5701, 0x0000003, 0x0000002, 0x01F5701, 0x0000004,
+	0x0000003, 0x01F5701, 0x0000003, 0x0000006, 0x0000003, 0x01F5701, 0x0000004, 0x0000006,
+	0x0000003, 0x01F5701, 0x0000003, 0x0000005, 0x0000003, 0x01F5701, 0x0000004, 0x0000005,
+	0x0000003, 0x01F5701, 0x0000003, 0x000000B, 0x0000003, 0x01F5701, 0x0000004, 0x000000B,
+	0x0000002, 0x01F2F01, 0x0000006, 0x0000002, 0x01F3401, 0x0000006, 0x0000002, 0x01F3A01,
+	0x0000006, 0x0000002, 0x01F3C01, 0x0000006, 0x0000002, 0x01F4401, 0x0000006, 0x0000002,
+	0x01F5201, 0x0000006, 0x0000002, 0x01F5701, 0x0000006, 0x0000003, 0x01F2F01, 0x0000003,
+	0x000002D, 0x0000003, 0x01F2F01, 0x0000004, 0x000002D, 0x0000004, 0x01F2F01, 0x0000003,
+	0x0000006, 0x000002D, 0x0000004, 0x01F2F01, 0x0000004, 0x0000006, 0x000002D, 0x0000004,
+	0x01F2F01, 0x0000003, 0x0000005, 0x000002D, 0x0000004, 0x01F2F01, 0x0000004, 0x0000005,
+	0x000002D, 0x0000004, 0x01F2F01, 0x0000003, 0x000000B, 0x000002D, 0x0000004, 0x01F2F01,
+	0x0000004, 0x000000B, 0x000002D, 0x0000003, 0x01F3A01, 0x0000003, 0x000002D, 0x0000003,
+	0x01F3A01, 0x0000004, 0x000002D, 0x0000004, 0x01F3A01, 0x0000003, 0x0000006, 0x000002D,
+	0x0000004, 0x01F3A01, 0x0000004, 0x0000006, 0x000002D, 0x0000004, 0x01F3A01, 0x0000003,
+	0x0000005, 0x000002D, 0x0000004, 0x01F3A01, 0x0000004, 0x0000005, 0x000002D, 0x0000004,
+	0x01F3A01, 0x0000003, 0x000000B, 0x000002D, 0x0000004, 0x01F3A01, 0x0000004, 0x000000B,
+	0x000002D, 0x0000003, 0x01F5701, 0x0000003, 0x000002D, 0x0000003, 0x01F5701, 0x0000004,
+	0x000002D, 0x0000004, 0x01F5701, 0x0000003, 0x0000006, 0x000002D, 0x0000004, 0x01F5701,
+	0x0000004, 0x0000006, 0x000002D, 0x0000004, 0x01F5701, 0x0000003, 0x0000005, 0x000002D,
+	0x0000004, 0x01F5701, 0x0000004, 0x0000005, 0x000002D, 0x0000004, 0x01F5701, 0x0000003,
+	0x000000B, 0x000002D, 0x0000004, 0x01F5701, 0x0000004, 0x000000B, 0x000002D, 0x0000002,
+	0x01F2F01, 0x0000007, 0x0000002, 0x01F2F01, 0x0000013, 0x0000003, 0x01F2F01, 0x0000006,
+	0x000002D, 0x0000002, 0x01F2F01, 0x000002D, 0x0000003, 0x01F2F01, 0x0000005, 0x000002D,
+	0x0000002, 0x01F2F01, 0x000000B, 0x0000003, 0x01F2F01, 0x000000B, 0x000002D, 0x0000002,
+	0x002BB01, 0x000000B, 0x0000003, 0x01F3A01, 0x0000006, 0x000002D, 0x0000002, 0x01F3A01,
+	0x000002D, 0x0000003, 0x01F3A01, 0x0000005, 0x000002D, 0x0000002, 0x01F3A01, 0x000000B,
+	0x0000003, 0x01F3A01, 0x000000B, 0x000002D, 0x0000002, 0x002C001, 0x0000006, 0x0000002,
+	0x002C001, 0x0000005, 0x0000002, 0x002C001, 0x000000B, 0x0000002, 0x01F3C01, 0x0000007,
+	0x0000002, 0x01F3C01, 0x0000013, 0x0000003, 0x01F3C01, 0x000000C, 0x0000006, 0x0000002,
+	0x01F3C01, 0x000000B, 0x0000003, 0x01F3C01, 0x000000C, 0x000000B, 0x0000002, 0x002C101,
+	0x0000006, 0x0000002, 0x002C101, 0x0000005, 0x0000002, 0x002C101, 0x000000B, 0x0000002,
+	0x01F5201, 0x0000007, 0x0000002, 0x01F5201, 0x0000013, 0x0000003, 0x01F5201, 0x000000C,
+	0x0000006, 0x0000002, 0x01F4A01, 0x0000003, 0x0000002, 0x01F4A01, 0x0000004, 0x0000002,
+	0x01F5201, 0x000000B, 0x0000003, 0x01F5201, 0x000000C, 0x000000B, 0x0000002, 0x002BB01,
+	0x0000006, 0x0000003, 0x01F5701, 0x0000006, 0x000002D, 0x0000002, 0x01F5701, 0x000002D,
+	0x0000003, 0x01F5701, 0x0000005, 0x000002D, 0x0000002, 0x01F5701, 0x000000B, 0x0000003,
+	0x01F5701, 0x000000B, 0x000002D, 0x0000002, 0x0007E01, 0x0007E01, 0x0000003, 0x0007E01,
+	0x0007E01, 0x0007E01, 0x0000002, 0x001BF01, 0x001BF01, 0x0000003, 0x001BF01, 0x001BF01,
+	0x001BF01, 0x0000002, 0x001C001, 0x001C001, 0x0000003, 0x001C001, 0x001C001, 0x001C001,
+	0x0000002, 0x0006701, 0x0006701, 0x0000002, 0x0006D01, 0x0006D01, 0x0000002, 0x0006D01,
+	0x0006701, 0x0000002, 0x0006701, 0x0006D01, 0x0000004, 0x001BF01, 0x001BF01, 0x001BF01,
+	0x001BF01, 0x0000002, 0x01E8201, 0x01EA001, 0x0000001, 0x00000EA, 0x0000001, 0x00000EB,
+	0x0000001, 0x00000EC, 0x0000001, 0x00000ED, 0x0000001, 0x00000EE, 0x0000001, 0x00000EF,
+	0x0000001, 0x00000F0, 0x0000001, 0x00000F1, 0x0000001, 0x00000F2, 0x0000001, 0x00000F3,
+	0x0000001, 0x00000F4, 0x0000001, 0x00000F5, 0x0000001, 0x00000F6, 0x0000001, 0x00000F7,
+	0x0000003, 0x01DA201, 0x001A601, 0x01DBB01, 0x0000003, 0x01DA201, 0x001A601, 0x01EA001,
+	0x0000002, 0x0032A01, 0x01DBB01, 0x0000003, 0x01DBB01, 0x001A601, 0x01E5201, 0x0000003,
+	0x01DBB01, 0x001A601, 0x01EBB01, 0x0000002, 0x0032A01, 0x01DE801, 0x0000002, 0x01E4301,
+	0x01E5201, 0x0000002, 0x01EA001, 0x01E3A01, 0x0000003, 0x01EB001, 0x01DD101, 0x01E2501,
+	0x0000002, 0x01EB001, 0x01E3A01, 0x0000003, 0x01DE801, 0x01DA201, 0x01EE101, 0x0000003,
+	0x01D9901, 0x0047601, 0x01D9F01, 0x0000003, 0x01D9901, 0x0047601, 0x01DA101, 0x0000004,
+	0x01D9901, 0x0047601, 0x01D9901, 0x01D9801, 0x0000003, 0x01D9901, 0x0047601, 0x01D9B01,
+	0x0000003, 0x01D9A01, 0x0047601, 0x01D9B01, 0x0000003, 0x01D9901, 0x0047601, 0x01D9D01,
+	0x0000003, 0x01D9A01, 0x0047601, 0x01D9D01, 0x0000003, 0x01D9B01, 0x0047601, 0x01D9D01,
+	0x0000003, 0x01D9C01, 0x0047601, 0x01D9D01, 0x0000003, 0x01D9901, 0x0047601, 0x01D9E01,
+	0x0000003, 0x01D9D01, 0x0047601, 0x01D9E01, 0x0000003, 0x01D9901, 0x0047601, 0x01DA001,
+	0x0000003, 0x01D9B01, 0x0047601, 0x01DA001, 0x0000003, 0x01D9D01, 0x0047601, 0x01DA001,
+	0x0000003, 0x01D9F01, 0x0047601, 0x01DA001, 0x0000002, 0x01D9901, 0x0047601, 0x0000002,
+	0x01E0901, 0x01E0901, 0x0000003, 0x01E0901, 0x01E0901, 0x01E0901, 0x0000002, 0x01E0901,
+	0x01ED301, 0x0000002, 0x01ED301, 0x01E0901, 0x0000003, 0x01ED301, 0x01E0901, 0x01E0901,
+	0x0000004, 0x01ED301, 0x01E0901, 0x01E0901, 0x01E0901, 0x0000002, 0x01E0901, 0x01EE101,
+	0x0000002, 0x01EE101, 0x01E0901, 0x0000003, 0x01EE101, 0x01E0901, 0x01E0901, 0x0000003,
+	0x01D9801, 0x0047601, 0x01D9B01, 0x0000002, 0x003EC01, 0x0000010, 0x0000002, 0x003ED01,
+	0x0000010, 0x0000002, 0x003F001, 0x0000010, 0x0000002, 0x0042601, 0x0000010, 0x0000002,
+	0x0042A01, 0x0000010, 0x0000002, 0x0042801, 0x0000010, 0x0000002, 0x0045901, 0x0000010,
+	0x0000002, 0x0045D01, 0x0000010, 0x0000002, 0x0045F01, 0x0000010, 0x0000002, 0x0048601,
+	0x0000010, 0x0000002, 0x0048701, 0x0000010, 0x0000002, 0x0048C01, 0x0048C01, 0x0000003,
+	0x0048C01, 0x0048C01, 0x0048C01, 0x0000002, 0x0048D01, 0x0048D01, 0x0000003, 0x0048D01,
+	0x0048D01, 0x0048D01, 0x0000002, 0x0049901, 0x0000010, 0x0000002, 0x0049F01, 0x0000010,
+	0x0000002, 0x004A001, 0x0000010, 0x0000002, 0x004A201, 0x0000010, 0x0000002, 0x0046B01,
+	0x0000010, 0x0000002, 0x004B901, 0x0000010, 0x0000002, 0x004A601, 0x0000010, 0x0000002,
+	0x0046A01, 0x0000010, 0x0000002, 0x0046C01, 0x0000010, 0x0000002, 0x004BB01, 0x0000010,
+	0x0000002, 0x004BC01, 0x0000010, 0x0000002, 0x004C401, 0x0000010, 0x0000002, 0x004C501,
+	0x0000010, 0x0000002, 0x004C601, 0x0000010, 0x0000002, 0x004C701, 0x0000010, 0x0000002,
+	0x004C801, 0x0000010, 0x0000002, 0x004C901, 0x0000010, 0x0000002, 0x004CE01, 0x0000010,
+	0x0000002, 0x004CF01, 0x0000010, 0x0000002, 0x004D001, 0x0000010, 0x0000002, 0x004D101,
+	0x0000010, 0x0000002, 0x004EA01, 0x0000010, 0x0000002, 0x004F001, 0x0000010, 0x0000002,
+	0x004F101, 0x0000010, 0x0000002, 0x004F301, 0x0000010, 0x0000002, 0x004CA01, 0x0000010,
+	0x0000002, 0x004CB01, 0x0000010, 0x0000002, 0x004D901, 0x0000010, 0x0000002, 0x004DA01,
+	0x0000010, 0x0000002, 0x004F601, 0x0000010, 0x0000002, 0x004F701, 0x0000010, 0x0000002,
+	0x004F801, 0x0000010, 0x0000002, 0x004F901, 0x0000010, 0x0000002, 0x01D9901, 0x01D9801,
+	0x0000002, 0x01D9901, 0x01D9901, 0x0000002, 0x01D9901, 0x01D9A01, 0x0000002, 0x01D9901,
+	0x01D9B01, 0x0000002, 0x01D9901, 0x01D9C01, 0x0000002, 0x01D9901, 0x01D9D01, 0x0000002,
+	0x01D9901, 0x01D9E01, 0x0000002, 0x01D9901, 0x01D9F01, 0x0000002, 0x01D9901, 0x01DA001,
+	0x0000002, 0x01D9901, 0x01DA101, 0x0000002, 0x01D9A01, 0x01D9801, 0x0000003, 0x0012801,
+	0x01D9901, 0x0012901, 0x0000003, 0x0012801, 0x01D9A01, 0x0012901, 0x0000003, 0x0012801,
+	0x01D9B01, 0x0012901, 0x0000003, 0x0012801, 0x01D9C01, 0x0012901, 0x0000003, 0x0012801,
+	0x01D9D01, 0x0012901, 0x0000003, 0x0012801, 0x01D9E01, 0x0012901, 0x0000003, 0x0012801,
+	0x01D9F01, 0x0012901, 0x0000003, 0x0012801, 0x01DA001, 0x0012901, 0x0000003, 0x0012801,
+	0x01DA101, 0x0012901, 0x0000004, 0x0012801, 0x01D9901, 0x01D9801, 0x0012901, 0x0000004,
+	0x0012801, 0x01D9901, 0x01D9901, 0x0012901, 0x0000004, 0x0012801, 0x01D9901, 0x01D9A01,
+	0x0012901, 0x0000004, 0x0012801, 0x01D9901, 0x01D9B01, 0x0012901, 0x0000004, 0x0012801,
+	0x01D9901, 0x01D9C01, 0x0012901, 0x0000004, 0x0012801, 0x01D9901, 0x01D9D01, 0x0012901,
+	0x0000004, 0x0012801, 0x01D9901, 0x01D9E01, 0x0012901, 0x0000004, 0x0012801, 0x01D9901,
+	0x01D9F01, 0x0012901, 0x0000004, 0x0012801, 0x01D9901, 0x01DA001, 0x0012901, 0x0000004,
+	0x0012801, 0x01D9901, 0x01DA101, 0x0012901, 0x0000004, 0x0012801, 0x01D9A01, 0x01D9801,
+	0x0012901, 0x0000002, 0x01D9901, 0x0007E01, 0x0000002, 0x01D9A01, 0x0007E01, 0x0000002,
+	0x01D9B01, 0x0007E01, 0x0000002, 0x01D9C01, 0x0007E01, 0x0000002, 0x01D9D01, 0x0007E01,
+	0x0000002, 0x01D9E01, 0x0007E01, 0x0000002, 0x01D9F01, 0x0007E01, 0x0000002, 0x01DA001,
+	0x0007E01, 0x0000002, 0x01DA101, 0x0007E01, 0x0000003, 0x01D9901, 0x01D9801, 0x0007E01,
+	0x0000003, 0x01D9901, 0x01D9901, 0x0007E01, 0x0000003, 0x01D9901, 0x01D9A01, 0x0007E01,
+	0x0000003, 0x01D9901, 0x01D9B01, 0x0007E01, 0x0000003, 0x01D9901, 0x01D9C01, 0x0007E01,
+	0x0000003, 0x01D9901, 0x01D9D01, 0x0007E01, 0x0000003, 0x01D9901, 0x01D9E01, 0x0007E01,
+	0x0000003, 0x01D9901, 0x01D9F01, 0x0007E01, 0x0000003, 0x01D9901, 0x01DA001, 0x0007E01,
+	0x0000003, 0x01D9901, 0x01DA101, 0x0007E01, 0x0000003, 0x01D9A01, 0x01D9801, 0x0007E01,
+	0x0000003, 0x0012801, 0x01DA201, 0x0012901, 0x0000003, 0x0012801, 0x01DB001, 0x0012901,
+	0x0000003, 0x0012801, 0x01DBB01, 0x0012901, 0x0000003, 0x0012801, 0x01DC401, 0x0012901,
+	0x0000003, 0x0012801, 0x01DD101, 0x0012901, 0x0000003, 0x0012801, 0x01DE801, 0x0012901,
+	0x0000003, 0x0012801, 0x01DF101, 0x0012901, 0x0000003, 0x0012801, 0x01DFD01, 0x0012901,
+	0x0000003, 0x0012801, 0x01E0901, 0x0012901, 0x0000003, 0x0012801, 0x01E1501, 0x0012901,
+	0x0000003, 0x0012801, 0x01E1C01, 0x0012901, 0x0000003, 0x0012801, 0x01E2501, 0x0012901,
+	0x0000003, 0x0012801, 0x01E3A01, 0x0012901, 0x0000003, 0x0012801, 0x01E4301, 0x0012901,
+	0x0000003, 0x0012801, 0x01E5201, 0x0012901, 0x0000003, 0x0012801, 0x01E6F01, 0x0012901,
+	0x0000003, 0x0012801, 0x01E7B01, 0x0012901, 0x0000003, 0x0012801, 0x01E8201, 0x0012901,
+	0x0000003, 0x0012801, 0x01EA001, 0x0012901, 0x0000003, 0x0012801, 0x01EB001, 0x0012901,
+	0x0000003, 0x0012801, 0x01EBB01, 0x0012901, 0x0000003, 0x0012801, 0x01ED301, 0x0012901,
+	0x0000003, 0x0012801, 0x01EDC01, 0x0012901, 0x0000003, 0x0012801, 0x01EE101, 0x0012901,
+	0x0000003, 0x0012801, 0x01EEA01, 0x0012901, 0x0000003, 0x0012801, 0x01EF101, 0x0012901,
+	0x0000004, 0x0048C01, 0x0048C01, 0x0048C01, 0x0048C01, 0x0000003, 0x0004001, 0x0004001,
+	0x0046B01, 0x0000002, 0x0046B01, 0x0046B01, 0x0000003, 0x0046B01, 0x0046B01, 0x0046B01,
+	0x0000002, 0x00BC201, 0x0000010, 0x0000003, 0x01F6701, 0x01F5C01, 0x01F6601, 0x0000002,
+	0x01FE801, 0x01FEB01, 0x0000003, 0x1FB4001, 0x1CE3600, 0x00000F9, 0x0000003, 0x1FB4001,
+	0x1D38200, 0x00000F9, 0x0000002, 0x1FB4001, 0x1CE5B00, 0x0000002, 0x1FB4001, 0x1CE5A00,
+	0x0000003, 0x1FB4001, 0x1CE5900, 0x00000F9, 0x0000002, 0x1FB4001, 0x1CEBB00, 0x0000003,
+	0x1FB4001, 0x1D18200, 0x00000F9, 0x0000003, 0x1FB4001, 0x1D1E000, 0x00000F9, 0x0000003,
+	0x1FB4001, 0x1D20000, 0x00000F9, 0x0000002, 0x1FB4001, 0x1D20200, 0x0000003, 0x1FB4001,
+	0x1D35C00, 0x00000F9, 0x0000003, 0x1FB4001, 0x1D36900, 0x00000F9, 0x0000003, 0x1FB4001,
+	0x1DC0F00, 0x00000F9, 0x0000003, 0x1FB4001, 0x1DC0F00, 0x00000FA, 0x0000003, 0x1FB4001,
+	0x1DC2200, 0x00000F9, 0x0000002, 0x1FB4001, 0x1DC2300, 0x0000002, 0x1FB4001, 0x1DC2200,
+	0x0000003, 0x1FB4001, 0x1DC2300, 0x00000F9, 0x0000002, 0x1FB4001, 0x1DDF300, 0x0000002,
+	0x1FB4001, 0x1DE7A00, 0x0000002, 0x1FB4001, 0x1DF5100, 0x0000003, 0x1FB4001, 0x1DF5000,
+	0x00000F9, 0x0000002, 0x1FB4001, 0x1DFC400, 0x0000003, 0x1FB4001, 0x1DFC300, 0x00000F9,
+	0x0000002, 0x1FB4001, 0x1E24C00, 0x0000002, 0x1FB4001, 0x1E53500, 0x0000002, 0x1FB4001,
+	0x1E5E100, 0x0000003, 0x1FB4001, 0x1E5E500, 0x00000F9, 0x0000003, 0x1FB4001, 0x1E70800,
+	0x00000F9, 0x0000003, 0x1FB4001, 0x1EB7A00, 0x00000F9, 0x0000002, 0x1FB4001, 0x1EBCD00,
+	0x0000002, 0x1FB4001, 0x1EC1100, 0x0000002, 0x1FB4001, 0x1EC3500, 0x0000002, 0x1FB4001,
+	0x1EC3A00, 0x0000002, 0x1FB4001, 0x1F06C00, 0x0000002, 0x1FB4001, 0x1F22B00, 0x0000003,
+	0x1FB4001, 0x1F22B00, 0x00000F9, 0x0000002, 0x1FB4001, 0x1CE2C00, 0x0000003, 0x1FB4001,
+	0x1F25B00, 0x00000F9, 0x0000002, 0x1FB4001, 0x1F2AD00, 0x0000003, 0x1FB4001, 0x1F38B00,
+	0x00000F9, 0x0000003, 0x1FB4001, 0x1F58B00, 0x00000F9, 0x0000003, 0x1FB4001, 0x1F6EE00,
+	0x00000F9, 0x0000003, 0x1FB4001, 0x1F93A00, 0x00000F9, 0x0000002, 0x1FB4001, 0x1F93B00,
+	0x0000003, 0x1FB4001, 0x1FAF900, 0x00000F9, 0x0000002, 0x1FB4001, 0x1FCF900, 0x0000002,
+	0x1FB4001, 0x1FE9F00, 0x0000002, 0x1FB4001, 0x1FF5300, 0x0000002, 0x1FB4001, 0x1FF5200,
+	0x0000003, 0x1FB4001, 0x1FF5300, 0x00000F9, 0x0000003, 0x1FB4001, 0x1FF5300, 0x00000FA,
+	0x0000003, 0x1FB4001, 0x1FF5200, 0x00000F9, 0x0000003, 0x1FB4001, 0x1FF8A00, 0x00000F9,
+	0x0000003, 0x1FB4001, 0x1FF8A00, 0x00000FA, 0x0000002, 0x1FB4001, 0x1FF8B00, 0x0000002,
+	0x1FB4101, 0x1800200, 0x0000002, 0x1FB4101, 0x1808000, 0x0000003, 0x1FB4101, 0x1807F00,
+	0x00000F9, 0x0000003, 0x1FB4101, 0x1808900, 0x00000F9, 0x0000003, 0x1FB4101, 0x181FC00,
+	0x00000F9, 0x0000002, 0x1FB4101, 0x1827900, 0x0000003, 0x1FB4101, 0x1827900, 0x00000F9,
+	0x0000003, 0x1FB4101, 0x1827900, 0x00000FA, 0x0000002, 0x1FB4101, 0x1864E00, 0x0000002,
+	0x1FB4101, 0x1886400, 0x0000002, 0x1FB4101, 0x1898000, 0x0000002, 0x1FB4101, 0x1897F00,
+	0x0000002, 0x1FB4101, 0x189C100, 0x0000002, 0x1FB4101, 0x189D200, 0x0000003, 0x1FB4101,
+	0x189D200, 0x00000F9, 0x0000002, 0x1FB4101, 0x18BA000, 0x0000002, 0x1FB4101, 0x18D1D00,
+	0x0000003, 0x1FB4101, 0x18DB300, 0x00000F9, 0x0000002, 0x1FB4101, 0x18F6600, 0x0000002,
+	0x1FB4101, 0x18FB600, 0x0000003, 0x1FB4101, 0x18FB600, 0x00000F9, 0x0000003, 0x1FB4101,
+	0x18FB600, 0x00000FA, 0x0000003, 0x1FB4101, 0x1909100, 0x00000F9, 0x0000002, 0x1FB4101,
+	0x1948500, 0x0000002, 0x1FB4101, 0x1957700, 0x0000002, 0x1FB4101, 0x1957800, 0x0000002,
+	0x1FB4101, 0x1957F00, 0x0000002, 0x1FB4101, 0x195E800, 0x0000003, 0x1FB4101, 0x1961C00,
+	0x00000F9, 0x0000002, 0x1FB4101, 0x1961D00, 0x0000003, 0x1FB4101, 0x196E800, 0x00000F9,
+	0x0000002, 0x1FB4101, 0x1975200, 0x0000002, 0x1FB4101, 0x197E600, 0x0000002, 0x1FB4101,
+	0x1987500, 0x0000002, 0x1FB4101, 0x198CE00, 0x0000002, 0x1FB4101, 0x198DE00, 0x0000002,
+	0x1FB4101, 0x198DF00, 0x0000003, 0x1FB4101, 0x198E000, 0x00000F9, 0x0000002, 0x1FB4101,
+	0x198E000, 0x0000002, 0x1FB4101, 0x1996300, 0x0000003, 0x1FB4101, 0x1999600, 0x00000F9,
+	0x0000002, 0x1FB4101, 0x19A6C00, 0x0000003, 0x1FB4101, 0x19AA800, 0x00000F9, 0x0000003,
+	0x1FB4101, 0x19B3C00, 0x00000F9, 0x0000002, 0x1FB4101, 0x19C7C00, 0x0000002, 0x1FB4101,
+	0x19E1F00, 0x0000003, 0x1FB4101, 0x19E7500, 0x00000F9, 0x0000002, 0x1FB4101, 0x19EA600,
+	0x0000002, 0x1FB4101, 0x19EC400, 0x0000002, 0x1FB4101, 0x19EFE00, 0x0000003, 0x1FB4101,
+	0x19F4A00, 0x00000F9, 0x0000002, 0x1FB4101, 0x19F5000, 0x0000003, 0x1FB4101, 0x19F5200,
+	0x00000F9, 0x0000002, 0x1FB4101, 0x19F7F00, 0x0000003, 0x1FB4101, 0x19F8D00, 0x00000F9,
+	0x0000002, 0x1FB4101, 0x19F9900, 0x0000003, 0x1FB4101, 0x19F9C00, 0x00000F9, 0x0000003,
+	0x1FB4101, 0x19F9C00, 0x00000FA, 0x0000002, 0x1FB4101, 0x19F9F00, 0x0000002, 0x1FB4001,
+	0x1CE0000, 0x0000002, 0x1FB4001, 0x1CE2800, 0x0000002, 0x1FB4001, 0x1CE3600, 0x0000002,
+	0x1FB4001, 0x1CE3F00, 0x0000002, 0x1FB4001, 0x1CE5900, 0x0000002, 0x1FB4001, 0x1CE8500,
+	0x0000002, 0x1FB4001, 0x1CE8C00, 0x0000002, 0x1FB4001, 0x1CEA000, 0x0000002, 0x1FB4001,
+	0x1CEBA00, 0x0000002, 0x1FB4001, 0x1D13F00, 0x0000002, 0x1FB4001, 0x1D16500, 0x0000002,
+	0x1FB4001, 0x1D16B00, 0x0000002, 0x1FB4001, 0x1D18200, 0x0000002, 0x1FB4001, 0x1D19600,
+	0x0000002, 0x1FB4001, 0x1D1AB00, 0x0000002, 0x1FB4001, 0x1D1E000, 0x0000002, 0x1FB4001,
+	0x1D1F500, 0x0000002, 0x1FB4001, 0x1D20000, 0x0000002, 0x1FB4001, 0x1D29B00, 0x0000002,
+	0x1FB4001, 0x1D2F900, 0x0000002, 0x1FB4001, 0x1D31500, 0x0000002, 0x1FB4001, 0x1D31A00,
+	0x0000002, 0x1FB4001, 0x1D33800, 0x0000002, 0x1FB4001, 0x1D34100, 0x0000002, 0x1FB4001,
+	0x1D35C00, 0x0000002, 0x1FB4001, 0x1D36900, 0x0000002, 0x1FB4001, 0x1D38200, 0x0000002,
+	0x1FB4001, 0x1D3B600, 0x0000002, 0x1FB4001, 0x1D3C800, 0x0000002, 0x1FB4001, 0x1D3E300,
+	0x0000002, 0x1FB4001, 0x1D6D700, 0x0000002, 0x1FB4001, 0x1D71F00, 0x0000002, 0x1FB4001,
+	0x1D8EB00, 0x0000002, 0x1FB4001, 0x1D90200, 0x0000002, 0x1FB4001, 0x1D90A00, 0x0000002,
+	0x1FB4001, 0x1D91500, 0x0000002, 0x1FB4001, 0x1D92700, 0x0000002, 0x1FB4001, 0x1D97300,
+	0x0000002, 0x1FB4001, 0x1DB5000, 0x0000002, 0x1FB4001, 0x1DB8000, 0x0000002, 0x1FB4001,
+	0x1DBF800, 0x0000002, 0x1FB4001, 0x1DC0F00, 0x0000002, 0x1FB4001, 0x1DC3800, 0x0000002,
+	0x1FB4001, 0x1DC6E00, 0x0000002, 0x1FB4001, 0x1DC7100, 0x0000002, 0x1FB4001, 0x1DDDB00,
+	0x0000002, 0x1FB4001, 0x1DDE500, 0x0000002, 0x1FB4001, 0x1DDF100, 0x0000002, 0x1FB4001,
+	0x1DDFE00, 0x0000002, 0x1FB4001, 0x1DE7200, 0x0000002, 0x1FB4001, 0x1DE7F00, 0x0000002,
+	0x1FB4001, 0x1DEF400, 0x0000002, 0x1FB4001, 0x1DEFE00, 0x0000002, 0x1FB4001, 0x1DF0B00,
+	0x0000002, 0x1FB4001, 0x1DF1300, 0x0000002, 0x1FB4001, 0x1DF5000, 0x0000002, 0x1FB4001,
+	0x1DF6100, 0x0000002, 0x1FB4001, 0x1DF7300, 0x0000002, 0x1FB4001, 0x1DFC300, 0x0000002,
+	0x1FB4001, 0x1E20800, 0x0000002, 0x1FB4001, 0x1E23600, 0x0000002, 0x1FB4001, 0x1E24B00,
+	0x0000002, 0x1FB4001, 0x1E52F00, 0x0000002, 0x1FB4001, 0x1E53400, 0x0000002, 0x1FB4001,
+	0x1E58700, 0x0000002, 0x1FB4001, 0x1E59700, 0x0000002, 0x1FB4001, 0x1E5A400, 0x0000002,
+	0x1FB4001, 0x1E5B900, 0x0000002, 0x1FB4001, 0x1E5E000, 0x0000002, 0x1FB4001, 0x1E5E500,
+	0x0000002, 0x1FB4001, 0x1E6F000, 0x0000002, 0x1FB4001, 0x1E70800, 0x0000002, 0x1FB4001,
+	0x1E72800, 0x0000002, 0x1FB4001, 0x1EB2000, 0x0000002, 0x1FB4001, 0x1EB6200, 0x0000002,
+	0x1FB4001, 0x1EB7900, 0x0000002, 0x1FB4001, 0x1EBB300, 0x0000002, 0x1FB4001, 0x1EBCB00,
+	0x0000002, 0x1FB4001, 0x1EBD400, 0x0000002, 0x1FB4001, 0x1EBDB00, 0x0000002, 0x1FB4001,
+	0x1EC0F00, 0x0000002, 0x1FB4001, 0x1EC1400, 0x0000002, 0x1FB4001, 0x1EC3400, 0x0000002,
+	0x1FB4001, 0x1F06B00, 0x0000002, 0x1FB4001, 0x1F22A00, 0x0000002, 0x1FB4001, 0x1F23600,
+	0x0000002, 0x1FB4001, 0x1F23B00, 0x0000002, 0x1FB4001, 0x1F23F00, 0x0000002, 0x1FB4001,
+	0x1F24700, 0x0000002, 0x1FB4001, 0x1F25900, 0x0000002, 0x1FB4001, 0x1F25B00, 0x0000002,
+	0x1FB4001, 0x1F2AC00, 0x0000002, 0x1FB4001, 0x1F38400, 0x0000002, 0x1FB4001, 0x1F38900,
+	0x0000002, 0x1FB4001, 0x1F4DC00, 0x0000002, 0x1FB4001, 0x1F4E600, 0x0000002, 0x1FB4001,
+	0x1F51800, 0x0000002, 0x1FB4001, 0x1F51F00, 0x0000002, 0x1FB4001, 0x1F52800, 0x0000002,
+	0x1FB4001, 0x1F53000, 0x0000002, 0x1FB4001, 0x1F58B00, 0x0000002, 0x1FB4001, 0x1F59200,
+	0x0000002, 0x1FB4001, 0x1F67600, 0x0000002, 0x1FB4001, 0x1F67D00, 0x0000002, 0x1FB4001,
+	0x1F6AE00, 0x0000002, 0x1FB4001, 0x1F6BF00, 0x0000002, 0x1FB4001, 0x1F6EE00, 0x0000002,
+	0x1FB4001, 0x1F7DB00, 0x0000002, 0x1FB4001, 0x1F7E200, 0x0000002, 0x1FB4001, 0x1F7F300,
+	0x0000002, 0x1FB4001, 0x1F93A00, 0x0000002, 0x1FB4001, 0x1F9B800, 0x0000002, 0x1FB4001,
+	0x1F9BE00, 0x0000002, 0x1FB4001, 0x1FA7400, 0x0000002, 0x1FB4001, 0x1FACB00, 0x0000002,
+	0x1FB4001, 0x1FAF900, 0x0000002, 0x1FB4001, 0x1FC7300, 0x0000002, 0x1FB4001, 0x1FCF800,
+	0x0000002, 0x1FB4001, 0x1FF3600, 0x0000002, 0x1FB4001, 0x1FF5100, 0x0000002, 0x1FB4001,
+	0x1FF8A00, 0x0000002, 0x1FB4001, 0x1FFBD00, 0x0000002, 0x1FB4101, 0x1800100, 0x0000002,
+	0x1FB4101, 0x1800C00, 0x0000002, 0x1FB4101, 0x1801200, 0x0000002, 0x1FB4101, 0x1803300,
+	0x0000002, 0x1FB4101, 0x1807F00, 0x0000002, 0x1FB4101, 0x1808900, 0x0000002, 0x1FB4101,
+	0x181E300, 0x0000002, 0x1FB4101, 0x181EA00, 0x0000002, 0x1FB4101, 0x181F300, 0x0000002,
+	0x1FB4101, 0x181FC00, 0x0000002, 0x1FB4101, 0x1820C00, 0x0000002, 0x1FB4101, 0x1821B00,
+	0x0000002, 0x1FB4101, 0x1821F00, 0x0000002, 0x1FB4101, 0x1826E00, 0x0000002, 0x1FB4101,
+	0x1827200, 0x0000002, 0x1FB4101, 0x1827800, 0x0000002, 0x1FB4101, 0x1864D00, 0x0000002,
+	0x1FB4101, 0x1866B00, 0x0000002, 0x1FB4101, 0x1884000, 0x0000002, 0x1FB4101, 0x1884C00,
+	0x0000002, 0x1FB4101, 0x1886300, 0x0000002, 0x1FB4101, 0x1897E00, 0x0000002, 0x1FB4101,
+	0x1898B00, 0x0000002, 0x1FB4101, 0x18A0000, 0x0000002, 0x1FB4101, 0x18C3700, 0x0000002,
+	0x1FB4101, 0x18C4600, 0x0000002, 0x1FB4101, 0x18C5500, 0x0000002, 0x1FB4101, 0x18C7800,
+	0x0000002, 0x1FB4101, 0x18C9D00, 0x0000002, 0x1FB4101, 0x18D6400, 0x0000002, 0x1FB4101,
+	0x18D7000, 0x0000002, 0x1FB4101, 0x18DB300, 0x0000002, 0x1FB4101, 0x18EAB00, 0x0000002,
+	0x1FB4101, 0x18ECA00, 0x0000002, 0x1FB4101, 0x18F9B00, 0x0000002, 0x1FB4101, 0x18FB000,
+	0x0000002, 0x1FB4101, 0x18FB500, 0x0000002, 0x1FB4101, 0x1909100, 0x0000002, 0x1FB4101,
+	0x1914900, 0x0000002, 0x1FB4101, 0x191C600, 0x0000002, 0x1FB4101, 0x191CC00, 0x0000002,
+	0x1FB4101, 0x191D100, 0x0000002, 0x1FB4101, 0x1958000, 0x0000002, 0x1FB4101, 0x1961C00,
+	0x0000002, 0x1FB4101, 0x196B600, 0x0000002, 0x1FB4101, 0x196B900, 0x0000002, 0x1FB4101,
+	0x196E800, 0x0000002, 0x1FB4101, 0x1975100, 0x0000002, 0x1FB4101, 0x1975E00, 0x0000002,
+	0x1FB4101, 0x1976200, 0x0000002, 0x1FB4101, 0x1976900, 0x0000002, 0x1FB4101, 0x197CB00,
+	0x0000002, 0x1FB4101, 0x197ED00, 0x0000002, 0x1FB4101, 0x197F300, 0x0000002, 0x1FB4101,
+	0x1980100, 0x0000002, 0x1FB4101, 0x198A800, 0x0000002, 0x1FB4101, 0x198DB00, 0x0000002,
+	0x1FB4101, 0x1999600, 0x0000002, 0x1FB4101, 0x1999900, 0x0000002, 0x1FB4101, 0x199AC00,
+	0x0000002, 0x1FB4101, 0x19AA800, 0x0000002, 0x1FB4101, 0x19AD800, 0x0000002, 0x1FB4101,
+	0x19ADF00, 0x0000002, 0x1FB4101, 0x19B2500, 0x0000002, 0x1FB4101, 0x19B2F00, 0x0000002,
+	0x1FB4101, 0x19B3200, 0x0000002, 0x1FB4101, 0x19B3C00, 0x0000002, 0x1FB4101, 0x19B5A00,
+	0x0000002, 0x1FB4101, 0x19CE500, 0x0000002, 0x1FB4101, 0x19E7500, 0x0000002, 0x1FB4101,
+	0x19E7F00, 0x0000002, 0x1FB4101, 0x19EA500, 0x0000002, 0x1FB4101, 0x19EBB00, 0x0000002,
+	0x1FB4101, 0x19EC300, 0x0000002, 0x1FB4101, 0x19ECD00, 0x0000002, 0x1FB4101, 0x19ED100,
+	0x0000002, 0x1FB4101, 0x19EF900, 0x0000002, 0x1FB4101, 0x19EFD00, 0x0000002, 0x1FB4101,
+	0x19F0E00, 0x0000002, 0x1FB4101, 0x19F1300, 0x0000002, 0x1FB4101, 0x19F2000, 0x0000002,
+	0x1FB4101, 0x19F3B00, 0x0000002, 0x1FB4101, 0x19F4A00, 0x0000002, 0x1FB4101, 0x19F5200,
+	0x0000002, 0x1FB4101, 0x19F8D00, 0x0000002, 0x1FB4101, 0x19F9C00, 0x0000002, 0x1FB4101,
+	0x19FA000, 0x0000002, 0x03DD101, 0x03DE701, 0x0000001, 0x00000E2, 0x0000001, 0x00000E3,
+	0x0000001, 0x00000E4, 0x0000001, 0x00000E5, 0x0000001, 0x00000E6, 0x0000001, 0x00000E7,
+	0x0000002, 0x01D5C01, 0x0000018, 0x0000002, 0x01D5D01, 0x0000018, 0x0000002, 0x1FB4001,
+	0x1D34400, 0x0000002, 0x1FB4001, 0x1D34500, 0x0000002, 0x03DE401, 0x03DD201, 0x0000002,
+	0x03DCB01, 0x0000018, 0x0000002, 0x03DCC01, 0x0000018, 0x0000002, 0x03DCD01, 0x0000018,
+	0x0000002, 0x03DCE01, 0x0000018, 0x0000002, 0x03DCF01, 0x0000018, 0x0000002, 0x03DD001,
+	0x0000018, 0x0000002, 0x03DD101, 0x0000018, 0x0000002, 0x03DD201, 0x0000018, 0x0000002,
+	0x03DD301, 0x0000018, 0x0000002, 0x03DD401, 0x0000018, 0x0000002, 0x03DD501, 0x0000018,
+	0x0000002, 0x03DD601, 0x0000018, 0x0000002, 0x03DD701, 0x0000018, 0x0000002, 0x03DD801,
+	0x0000018, 0x0000002, 0x03DD901, 0x0000018, 0x0000002, 0x03DDF01, 0x0000018, 0x0000002,
+	0x03DDF01, 0x0000019, 0x0000002, 0x03DE001, 0x0000018, 0x0000002, 0x03DE001, 0x0000019,
+	0x0000002, 0x03DE101, 0x0000018, 0x0000002, 0x03DE101, 0x0000019, 0x0000002, 0x03DE201,
+	0x0000018, 0x0000002, 0x03DE201, 0x0000019, 0x0000002, 0x03DE301, 0x0000018, 0x0000002,
+	0x03DE301, 0x0000019, 0x0000002, 0x03DC701, 0x0000018, 0x0000001, 0x0000018, 0x0000001,
+	0x0000019, 0x0000002, 0x01D5F01, 0x0000018, 0x0000002, 0x03DEB01, 0x03DED01, 0x0000002,
+	0x03DF101, 0x0000018, 0x0000002, 0x03DF201, 0x0000018, 0x0000002, 0x03DF301, 0x0000018,
+	0x0000002, 0x03DF401, 0x0000018, 0x0000002, 0x01D6101, 0x0000018, 0x0000002, 0x03DCF01,
+	0x03DD901, 0x0000002, 0x1FB4001, 0x1CE0900, 0x0000002, 0x1FB4001, 0x1D6DB00, 0x0000002,
+	0x1FB4001, 0x1CE0A00, 0x0000002, 0x1FB4001, 0x1CE2D00, 0x0000002, 0x1FB4001, 0x1CE0B00,
+	0x0000002, 0x1FB4001, 0x1F53200, 0x0000002, 0x1FB4001, 0x1CE1900, 0x0000002, 0x1FB4001,
+	0x1CE0100, 0x0000002, 0x1FB4001, 0x1D92900, 0x0000002, 0x1FB4001, 0x1D73000, 0x0000002,
+	0x03F1401, 0x00000FA, 0x0000002, 0x03F2E01, 0x00000FA, 0x0000002, 0x03F2401, 0x00000FA,
+	0x0000002, 0x03F1F01, 0x00000FA, 0x0000002, 0x03F3901, 0x00000FA, 0x0000002, 0x03F3501,
+	0x00000FA, 0x0000002, 0x03F4701, 0x00000FB, 0x0000002, 0x03F3401, 0x00000FA, 0x0000002,
+	0x03F4601, 0x00000FA, 0x0000002, 0x03F4701, 0x00000FA, 0x0000002, 0x03F3A01, 0x00000FA,
+	0x0000002, 0x03F3C01, 0x00000FA, 0x0000003, 0x0012801, 0x03C6001, 0x0012901, 0x0000003,
+	0x0012801, 0x03C6201, 0x0012901, 0x0000003, 0x0012801, 0x03C6301, 0x0012901, 0x0000003,
+	0x0012801, 0x03C6501, 0x0012901, 0x0000003, 0x0012801, 0x03C6601, 0x0012901, 0x0000003,
+	0x0012801, 0x03C6701, 0x0012901, 0x0000003, 0x0012801, 0x03C6901, 0x0012901, 0x0000003,
+	0x0012801, 0x03C6B01, 0x0012901, 0x0000003, 0x0012801, 0x03C6C01, 0x0012901, 0x0000003,
+	0x0012801, 0x03C6E01, 0x0012901, 0x0000003, 0x0012801, 0x03C6F01, 0x0012901, 0x0000003,
+	0x0012801, 0x03C7001, 0x0012901, 0x0000003, 0x0012801, 0x03C7101, 0x0012901, 0x0000003,
+	0x0012801, 0x03C7201, 0x0012901, 0x0000004, 0x0012801, 0x03C6001, 0x03CDE01, 0x0012901,
+	0x0000004, 0x0012801, 0x03C6201, 0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C6301,
+	0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C6501, 0x03CDE01, 0x0012901, 0x0000004,
+	0x0012801, 0x03C6601, 0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C6701, 0x03CDE01,
+	0x0012901, 0x0000004, 0x0012801, 0x03C6901, 0x03CDE01, 0x0012901, 0x0000004, 0x0012801,
+	0x03C6B01, 0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C6C01, 0x03CDE01, 0x0012901,
+	0x0000004, 0x0012801, 0x03C6E01, 0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C6F01,
+	0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C7001, 0x03CDE01, 0x0012901, 0x0000004,
+	0x0012801, 0x03C7101, 0x03CDE01, 0x0012901, 0x0000004, 0x0012801, 0x03C7201, 0x03CDE01,
+	0x0012901, 0x0000004, 0x0012801, 0x03C6C01, 0x03CEB01, 0x0012901, 0x0000007, 0x0012801,
+	0x03C6B01, 0x03CE601, 0x03C6C01, 0x03CE201, 0x03D3F01, 0x0012901, 0x0000006, 0x0012801,
+	0x03C6B01, 0x03CE601, 0x03C7201, 0x03CEB01, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001,
+	0x1CE0000, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1CE8C00, 0x0012901, 0x0000004,
+	0x0012801, 0x1FB4001, 0x1CE0900, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1D6DB00,
+	0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1CE9400, 0x0012901, 0x0000004, 0x0012801,
+	0x1FB4001, 0x1D16D00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1CE0300, 0x0012901,
+	0x0000004, 0x0012801, 0x1FB4001, 0x1D16B00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001,
+	0x1CE5D00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1D34100, 0x0012901, 0x0000004,
+	0x0012801, 0x1FB4001, 0x1E70800, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1F06B00,
+	0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1EC3400, 0x0012901, 0x0000004, 0x0012801,
+	0x1FB4001, 0x1E72800, 0x0012901, 0x0000004, 0x0012801, 0x1FB4101, 0x191D100, 0x0012901,
+	0x0000004, 0x0012801, 0x1FB4001, 0x1D71F00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001,
+	0x1E5E500, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1E82A00, 0x0012901, 0x0000004,
+	0x0012801, 0x1FB4001, 0x1E70900, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1F93E00,
+	0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1D40D00, 0x0012901, 0x0000004, 0x0012801,
+	0x1FB4001, 0x1F27900, 0x0012901, 0x0000004, 0x0012801, 0x1FB4101, 0x18CA100, 0x0012901,
+	0x0000004, 0x0012801, 0x1FB4001, 0x1F95D00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001,
+	0x1D2B400, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1CEE300, 0x0012901, 0x0000004,
+	0x0012801, 0x1FB4001, 0x1D47C00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1DB6600,
+	0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1F6E300, 0x0012901, 0x0000004, 0x0012801,
+	0x1FB4001, 0x1CF0100, 0x0012901, 0x0000004, 0x0012801, 0x1FB4101, 0x18CC700, 0x0012901,
+	0x0000004, 0x0012801, 0x1FB4001, 0x1D35400, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001,
+	0x1F96D00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4001, 0x1CF1100, 0x0012901, 0x0000004,
+	0x0012801, 0x1FB4101, 0x181EA00, 0x0012901, 0x0000004, 0x0012801, 0x1FB4101, 0x181F300,
+	0x0012901, 0x0000002, 0x1FB4001, 0x1D54F00, 0x0000002, 0x1FB4001, 0x1DE7C00, 0x0000002,
+	0x1FB4001, 0x1FB8F00, 0x0000002, 0x01D9B01, 0x01D9801, 0x0000002, 0x01D9C01, 0x01D9801,
+	0x0000002, 0x01D9D01, 0x01D9801, 0x0000002, 0x01D9E01, 0x01D9801, 0x0000002, 0x01D9F01,
+	0x01D9801, 0x0000002, 0x01DA001, 0x01D9801, 0x0000003, 0x01E6F01, 0x01EB001, 0x01DD101,
+	0x0000002, 0x01D9A01, 0x01D9901, 0x0000002, 0x01D9A01, 0x01D9A01, 0x0000002, 0x01D9A01,
+	0x01D9B01, 0x0000002, 0x01D9A01, 0x01D9C01, 0x0000002, 0x01D9A01, 0x01D9D01, 0x0000002,
+	0x01D9A01, 0x01D9E01, 0x0000002, 0x01D9A01, 0x01D9F01, 0x0000002, 0x01D9A01, 0x01DA001,
+	0x0000002, 0x01D9A01, 0x01DA101, 0x0000002, 0x01D9B01, 0x01D9901, 0x0000002, 0x01D9B01,
+	0x01D9A01, 0x0000002, 0x01D9B01, 0x01D9B01, 0x0000002, 0x01D9B01, 0x01D9C01, 0x0000002,
+	0x01D9B01, 0x01D9D01, 0x0000002, 0x03C6001, 0x03CDE01, 0x0000002, 0x03C6201, 0x03CDE01,
+	0x0000002, 0x03C6301, 0x03CDE01, 0x0000002, 0x03C6501, 0x03CDE01, 0x0000002, 0x03C6601,
+	0x03CDE01, 0x0000002, 0x03C6701, 0x03CDE01, 0x0000002, 0x03C6901, 0x03CDE01, 0x0000002,
+	0x03C6B01, 0x03CDE01, 0x0000002, 0x03C6C01, 0x03CDE01, 0x0000002, 0x03C6E01, 0x03CDE01,
+	0x0000002, 0x03C6F01, 0x03CDE01, 0x0000002, 0x03C7001, 0x03CDE01, 0x0000002, 0x03C7101,
+	0x03CDE01, 0x0000002, 0x03C7201, 0x03CDE01, 0x0000005, 0x03C6E01, 0x03CDE01, 0x03D4B01,
+	0x03C6001, 0x03CE601, 0x0000004, 0x03C6C01, 0x03CEB01, 0x03C6B01, 0x03CF101, 0x0000002,
+	0x03C6B01, 0x03CEB01, 0x0000002, 0x1FB4001, 0x1CE9400, 0x0000002, 0x1FB4001, 0x1D16D00,
+	0x0000002, 0x1FB4001, 0x1CE0300, 0x0000002, 0x1FB4001, 0x1CE5D00, 0x0000002, 0x1FB4001,
+	0x1E82A00, 0x0000002, 0x1FB4001, 0x1E70900, 0x0000002, 0x1FB4001, 0x1F93E00, 0x0000002,
+	0x1FB4001, 0x1D40D00, 0x0000002, 0x1FB4001, 0x1F27900, 0x0000002, 0x1FB4101, 0x18CA100,
+	0x0000002, 0x1FB4001, 0x1F95D00, 0x0000002, 0x1FB4001, 0x1D2B400, 0x0000002, 0x1FB4001,
+	0x1F9D800, 0x0000002, 0x1FB4001, 0x1F53700, 0x0000002, 0x1FB4101, 0x1906900, 0x0000002,
+	0x1FB4001, 0x1D12A00, 0x0000002, 0x1FB4001, 0x1D37000, 0x0000002, 0x1FB4001, 0x1ECE800,
+	0x0000002, 0x1FB4101, 0x1980500, 0x0000002, 0x1FB4001, 0x1CF1100, 0x0000002, 0x1FB4001,
+	0x1D19900, 0x0000002, 0x1FB4001, 0x1EB6300, 0x0000002, 0x1FB4001, 0x1DDE600, 0x0000002,
+	0x1FB4001, 0x1D3F300, 0x0000002, 0x1FB4001, 0x1D33B00, 0x0000002, 0x1FB4001, 0x1DB9700,
+	0x0000002, 0x1FB4001, 0x1DB6600, 0x0000002, 0x1FB4001, 0x1F6E300, 0x0000002, 0x1FB4001,
+	0x1CF0100, 0x0000002, 0x1FB4101, 0x18CC700, 0x0000002, 0x1FB4001, 0x1D35400, 0x0000002,
+	0x1FB4001, 0x1D91C00, 0x0000002, 0x01D9B01, 0x01D9E01, 0x0000002, 0x01D9B01, 0x01D9F01,
+	0x0000002, 0x01D9B01, 0x01DA001, 0x0000002, 0x01D9B01, 0x01DA101, 0x0000002, 0x01D9C01,
+	0x01D9901, 0x0000002, 0x01D9C01, 0x01D9A01, 0x0000002, 0x01D9C01, 0x01D9B01, 0x0000002,
+	0x01D9C01, 0x01D9C01, 0x0000002, 0x01D9C01, 0x01D9D01, 0x0000002, 0x01D9C01, 0x01D9E01,
+	0x0000002, 0x01D9C01, 0x01D9F01, 0x0000002, 0x01D9C01, 0x01DA001, 0x0000002, 0x01D9C01,
+	0x01DA101, 0x0000003, 0x01D9901, 0x1FB4001, 0x1E70800, 0x0000003, 0x01D9A01, 0x1FB4001,
+	0x1E70800, 0x0000003, 0x01D9B01, 0x1FB4001, 0x1E70800, 0x0000003, 0x01D9C01, 0x1FB4001,
+	0x1E70800, 0x0000003, 0x01D9D01, 0x1FB4001, 0x1E70800, 0x0000003, 0x01D9E01, 0x1FB4001,
+	0x1E70800, 0x0000003, 0x01D9F01, 0x1FB4001, 0x1E70800, 0x0000003, 0x01DA001, 0x1FB4001,
+	0x1E70800, 0x0000003, 0x01DA101, 0x1FB4001, 0x1E70800, 0x0000004, 0x01D9901, 0x01D9801,
+	0x1FB4001, 0x1E70800, 0x0000004, 0x01D9901, 0x01D9901, 0x1FB4001, 0x1E70800, 0x0000004,
+	0x01D9901, 0x01D9A01, 0x1FB4001, 0x1E70800, 0x0000002, 0x01DFD01, 0x01DF101, 0x0000003,
+	0x01DD101, 0x01E8201, 0x01DF101, 0x0000002, 0x01DD101, 0x01ED301, 0x0000003, 0x01E2501,
+	0x01EB001, 0x01DC401, 0x0000004, 0x1FB4001, 0x1CEE400, 0x1FB4001, 0x1D48C00, 0x0000005,
+	0x03DC501, 0x03DDF01, 0x0000019, 0x01D6001, 0x03DD901, 0x0000004, 0x03DC501, 0x03DEE01,
+	0x03DE101, 0x03DC501, 0x0000005, 0x03DC501, 0x03DF501, 0x03DE201, 0x0000019, 0x03DC501,
+	0x0000003, 0x03DC501, 0x01D6001, 0x03DEE01, 0x0000005, 0x03DC601, 0x03DDB01, 0x03DF501,
+	0x03DCD01, 0x0000018, 0x0000003, 0x03DC601, 0x03DF501, 0x03DD601, 0x0000003, 0x03DC701,
+	0x03DCA01, 0x03DF501, 0x0000006, 0x03DC901, 0x03DD201, 0x03DCD01, 0x01D6001, 0x03DD901,
+	0x0000018, 0x0000004, 0x03DC901, 0x01D6001, 0x03DCB01, 0x01D6001, 0x0000003, 0x03DCA01,
+	0x03DF501, 0x03DD201, 0x0000003, 0x03DCA01, 0x01D6001, 0x03DE601, 0x0000003, 0x03DCB01,
+	0x03DC601, 0x03DED01, 0x0000004, 0x03DCB01, 0x03DEC01, 0x03DD701, 0x03DD901, 0x0000004,
+	0x03DCB01, 0x03DF001, 0x03DED01, 0x01D6001, 0x0000004, 0x03DCB01, 0x0000018, 0x03DF001,
+	0x03DF501, 0x0000004, 0x03DCB01, 0x0000018, 0x03DF501, 0x03DE401, 0x0000004, 0x03DCC01,
+	0x0000018, 0x03DCB01, 0x0000018, 0x0000004, 0x03DCC01, 0x0000018, 0x03DDB01, 0x01D6001,
+	0x0000004, 0x03DCC01, 0x03DEA01, 0x03DED01, 0x01D6001, 0x0000006, 0x03DCC01, 0x0000018,
+	0x03DEE01, 0x03DD501, 0x0000018, 0x01D6001, 0x0000002, 0x03DCC01, 0x03DF001, 0x0000006,
+	0x03DCC01, 0x03DF001, 0x03DCD01, 0x0000018, 0x03DEC01, 0x03DE601, 0x0000006, 0x03DCC01,
+	0x03DF001, 0x03DE701, 0x01D6001, 0x03DD901, 0x03DEE01, 0x0000005, 0x03DCC01, 0x03DF001,
+	0x03DF101, 0x03DD701, 0x03DD901, 0x0000004, 0x03DCD01, 0x0000018, 0x03DEC01, 0x03DE601,
+	0x0000006, 0x03DCD01, 0x0000018, 0x03DEC01, 0x03DE601, 0x03DD901, 0x03DF501, 0x0000006,
+	0x03DCD01, 0x03DEE01, 0x03DD301, 0x0000018, 0x03DC601, 0x03DF001, 0x0000004, 0x03DCD01,
+	0x03DF001, 0x01D6001, 0x03DDD01, 0x0000003, 0x03DCE01, 0x01D6001, 0x03DD201, 0x0000003,
+	0x03DCF01, 0x03DEE01, 0x03DDA01, 0x0000004, 0x03DCF01, 0x01D6001, 0x03DE301, 0x0000019,
+	0x0000004, 0x03DD001, 0x03DC601, 0x03DCD01, 0x03DEE01, 0x0000005, 0x03DD001, 0x03DF501,
+	0x03DD601, 0x01D6001, 0x03DE601, 0x0000005, 0x03DD101, 0x03DED01, 0x03DF501, 0x03DCD01,
+	0x0000018, 0x0000003, 0x03DD301, 0x03DF501, 0x03DD601, 0x0000003, 0x03DD301, 0x03DF501,
+	0x03DD901, 0x0000004, 0x03DD501, 0x0000018, 0x01D6001, 0x03DD201, 0x0000003, 0x03DD801,
+	0x0000018, 0x03DD101, 0x0000003, 0x03DD901, 0x0000018, 0x03DEE01, 0x0000002, 0x03DD901,
+	0x03DF501, 0x0000002, 0x03DDA01, 0x03DDE01, 0x0000003, 0x03DDE01, 0x03DD701, 0x03DD901,
+	0x0000003, 0x03DDF01, 0x03DC601, 0x03DD701, 0x0000006, 0x03DDF01, 0x0000019, 0x01D6001,
+	0x03DD301, 0x03DF501, 0x03DD901, 0x0000004, 0x03DDF01, 0x0000019, 0x01D6001, 0x03DD701,
+	0x0000005, 0x03DDF01, 0x0000018, 0x01D6001, 0x03DEF01, 0x03DEE01, 0x0000006, 0x03DE001,
+	0x0000019, 0x03DC501, 0x03DD201, 0x03DD901, 0x03DEE01, 0x0000004, 0x03DE001, 0x0000019,
+	0x03DCD01, 0x03DEE01, 0x0000003, 0x03DE001, 0x0000019, 0x03DCF01, 0x0000003, 0x03DE001,
+	0x0000018, 0x03DEE01, 0x0000006, 0x03DE101, 0x03DC501, 0x03DEC01, 0x03DD701, 0x03DD901,
+	0x0000018, 0x0000004, 0x03DE101, 0x03DC601, 0x01D6001, 0x03DD901, 0x0000006, 0x03DE101,
+	0x0000018, 0x03DD701, 0x03DD101, 0x03DC901, 0x03DEE01, 0x0000003, 0x03DE101, 0x03DEC01,
+	0x03DF501, 0x0000005, 0x03DE201, 0x03DCD01, 0x03DD501, 0x01D6001, 0x03DEE01, 0x0000003,
+	0x03DE201, 0x0000019, 0x03DD401, 0x0000004, 0x03DE201, 0x0000019, 0x03DDB01, 0x03DE001,
+	0x0000003, 0x03DE201, 0x03DEE01, 0x03DD701, 0x0000004, 0x03DE201, 0x0000019, 0x03DF501,
+	0x03DD201, 0x0000005, 0x03DE201, 0x0000019, 0x01D6001, 0x03DD101, 0x0000018, 0x0000004,
+	0x03DE201, 0x0000018, 0x01D6001, 0x03DD501, 0x0000005, 0x03DE301, 0x0000019, 0x03DC601,
+	0x03DF501, 0x03DD901, 0x0000004, 0x03DE301, 0x0000018, 0x03DEE01, 0x03DD901, 0x0000002,
+	0x03DE301, 0x03DF501, 0x0000005, 0x03DE301, 0x0000019, 0x03DF501, 0x03DD901, 0x0000018,
+	0x0000003, 0x03DE301, 0x01D6001, 0x03DEE01, 0x0000003, 0x03DE301, 0x01D6001, 0x03DF501,
+	0x0000004, 0x03DE401, 0x03DC601, 0x03DCD01, 0x03DF001, 0x0000003, 0x03DE401, 0x03DC601,
+	0x03DEE01, 0x0000003, 0x03DE401, 0x03DD701, 0x03DDF01, 0x0000003, 0x03DE401, 0x03DEE01,
+	0x03DCD01, 0x0000005, 0x03DE401, 0x03DF501, 0x03DD101, 0x03DEB01, 0x03DF501, 0x0000004,
+	0x03DE501, 0x03DCD01, 0x03DF001, 0x03DF501, 0x0000002, 0x03DE501, 0x03DED01, 0x0000006,
+	0x03DE501, 0x03DED01, 0x03DDF01, 0x0000018, 0x01D6001, 0x03DEE01, 0x0000003, 0x03DE701,
+	0x03DCB01, 0x0000018, 0x0000005, 0x03DE701, 0x03DCB01, 0x0000018, 0x03DD901, 0x03DF501,
+	0x0000004, 0x03DE701, 0x01D6001, 0x03DD901, 0x03DEE01, 0x0000004, 0x03DE901, 0x01D6001,
+	0x03DD901, 0x0000018, 0x0000003, 0x03DE901, 0x01D6001, 0x03DEE01, 0x0000003, 0x03DEA01,
+	0x03DC501, 0x03DF501, 0x0000004, 0x03DED01, 0x03DD701, 0x03DD901, 0x03DEE01, 0x0000002,
+	0x03DED01, 0x03DEC01, 0x0000004, 0x03DEE01, 0x03DE001, 0x0000019, 0x01D6001, 0x0000005,
+	0x03DEE01, 0x01D6001, 0x03DE101, 0x0000018, 0x03DEE01, 0x0000002, 0x03DEF01, 0x03DE601,
+	0x0000006, 0x03DEF01, 0x03DF501, 0x03DD901, 0x03DCE01, 0x0000018, 0x03DF501, 0x0000003,
+	0x03DF101, 0x03DD701, 0x03DD901, 0x0000003, 0x01D9801, 0x1FB4001, 0x1F0B900, 0x0000003,
+	0x01D9901, 0x1FB4001, 0x1F0B900, 0x0000003, 0x01D9A01, 0x1FB4001, 0x1F0B900, 0x0000003,
+	0x01D9B01, 0x1FB4001, 0x1F0B900, 0x0000003, 0x01D9C01, 0x1FB4001, 0x1F0B900, 0x0000003,
+	0x01D9D01, 0x1FB4001, 0x1F0B900, 0x0000003, 0x01D9E01, 0x1FB4001, 0x1F0B900, 0x0000003,
+	0x01D9F01, 0x1FB4001, 0x1F0B900, 0x0000003, 0x01DA001, 0x1FB4001, 0x1F0B900, 0x0000003,
+	0x01DA101, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9901, 0x01D9801, 0x1FB4001, 0x1F0B900,
+	0x0000004, 0x01D9901, 0x01D9901, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9901, 0x01D9A01,
+	0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9901, 0x01D9B01, 0x1FB4001, 0x1F0B900, 0x0000004,
+	0x01D9901, 0x01D9C01, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9901, 0x01D9D01, 0x1FB4001,
+	0x1F0B900, 0x0000004, 0x01D9901, 0x01D9E01, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9901,
+	0x01D9F01, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9901, 0x01DA001, 0x1FB4001, 0x1F0B900,
+	0x0000004, 0x01D9901, 0x01DA101, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9A01, 0x01D9801,
+	0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9A01, 0x01D9901, 0x1FB4001, 0x1F0B900, 0x0000004,
+	0x01D9A01, 0x01D9A01, 0x1FB4001, 0x1F0B900, 0x0000004, 0x01D9A01, 0x01D9B01, 0x1FB4001,
+	0x1F0B900, 0x0000004, 0x01D9A01, 0x01D9C01, 0x1FB4001, 0x1F0B900, 0x0000003, 0x01DFD01,
+	0x01E6F01, 0x01DA201, 0x0000002, 0x01DC401, 0x01DA201, 0x0000002, 0x01DA201, 0x01EBB01,
+	0x0000003, 0x01DB001, 0x01DA201, 0x01E8201, 0x0000002, 0x01E5201, 0x01ED301, 0x0000002,
+	0x01E6F01, 0x01DBB01, 0x0000002, 0x01DC401, 0x01E3A01, 0x0000003, 0x01DC401, 0x01E3A01,
+	0x01D9A01, 0x0000003, 0x01DC401, 0x01E3A01, 0x01D9B01, 0x0000002, 0x01E0901, 0x01EBB01,
+	0x0000004, 0x1FB4001, 0x1DE7300, 0x1FB4001, 0x1E21000, 0x0000004, 0x1FB4001, 0x1E62D00,
+	0x1FB4001, 0x1D48C00, 0x0000004, 0x1FB4001, 0x1D92700, 0x1FB4001, 0x1EB6300, 0x0000004,
+	0x1FB4001, 0x1E60E00, 0x1FB4001, 0x1ECBB00, 0x0000008, 0x1FB4001, 0x1E82A00, 0x1FB4001,
+	0x1DF0F00, 0x1FB4001, 0x1CF1A00, 0x1FB4001, 0x1F93E00, 0x0000002, 0x01E6F01, 0x01DA201,
+	0x0000002, 0x01E4301, 0x01DA201, 0x0000002, 0x01F4101, 0x01DA201, 0x0000002, 0x01E3A01,
+	0x01DA201, 0x0000002, 0x01E1C01, 0x01DA201, 0x0000002, 0x01E1C01, 0x01DB001, 0x0000002,
+	0x01E3A01, 0x01DB001, 0x0000002, 0x01DF101, 0x01DB001, 0x0000003, 0x01DBB01, 0x01DA201,
+	0x01E2501, 0x0000004, 0x01E1C01, 0x01DBB01, 0x01DA201, 0x01E2501, 0x0000002, 0x01E6F01,
+	0x01DE801, 0x0000002, 0x01E4301, 0x01DE801, 0x0000002, 0x01F4101, 0x01DE801, 0x0000002,
+	0x01F4101, 0x01DF101, 0x0000002, 0x01E3A01, 0x01DF101, 0x0000002, 0x01E1C01, 0x01DF101,
+	0x0000002, 0x01DFD01, 0x01EF101, 0x0000003, 0x01E1C01, 0x01DFD01, 0x01EF101, 0x0000003,
+	0x01E3A01, 0x01DFD01, 0x01EF101, 0x0000003, 0x01DF101, 0x01DFD01, 0x01EF101, 0x0000003,
+	0x01EB001, 0x01DFD01, 0x01EF101, 0x0000002, 0x01F4101, 0x01E2501, 0x0000002, 0x01E3A01,
+	0x01E2501, 0x0000002, 0x01DC401, 0x01E2501, 0x0000002, 0x01E1C01, 0x01E2501, 0x0000002,
+	0x01DE801, 0x01E3A01, 0x0000002, 0x01E4301, 0x01E3A01, 0x0000002, 0x01F4101, 0x01E3A01,
+	0x0000002, 0x01E3A01, 0x01E3A01, 0x0000002, 0x01DBB01, 0x01E3A01, 0x0000002, 0x01E1C01,
+	0x01E3A01, 0x0000003, 0x01E3A01, 0x01E3A01, 0x01D9A01, 0x0000003, 0x01DBB01, 0x01E3A01,
+	0x01D9A01, 0x0000002, 0x01E3A01, 0x01D9A01, 0x0000003, 0x01E1C01, 0x01E3A01, 0x01D9A01,
+	0x0000003, 0x01E3A01, 0x01E3A01, 0x01D9B01, 0x0000003, 0x01DBB01, 0x01E3A01, 0x01D9B01,
+	0x0000002, 0x01E3A01, 0x01D9B01, 0x0000003, 0x01E1C01, 0x01E3A01, 0x01D9B01, 0x0000003,
+	0x01E3A01, 0x0047501, 0x01EA001, 0x0000004, 0x01E3A01, 0x0047501, 0x01EA001, 0x01D9A01,
+	0x0000003, 0x01E1C01, 0x01E6F01, 0x01DA201, 0x0000003, 0x01E3A01, 0x01E6F01, 0x01DA201,
+	0x0000003, 0x01DF101, 0x01E6F01, 0x01DA201, 0x0000003, 0x01E8201, 0x01DA201, 0x01DC401,
+	0x0000005, 0x01E8201, 0x01DA201, 0x01DC401, 0x0047501, 0x01EA001, 0x0000006, 0x01E8201,
+	0x01DA201, 0x01DC401, 0x0047501, 0x01EA001, 0x01D9A01, 0x0000002, 0x01E6F01, 0x01EA001,
+	0x0000002, 0x01E4301, 0x01EA001, 0x0000002, 0x01F4101, 0x01EA001, 0x0000002, 0x01E3A01,
+	0x01EA001, 0x0000002, 0x01E6F01, 0x01ED301, 0x0000002, 0x01E4301, 0x01ED301, 0x0000002,
+	0x01F4101, 0x01ED301, 0x0000002, 0x01E3A01, 0x01ED301, 0x0000002, 0x01E1C01, 0x01ED301,
+	0x0000002, 0x01E6F01, 0x01EDC01, 0x0000002, 0x01E4301, 0x01EDC01, 0x0000002, 0x01F4101,
+	0x01EDC01, 0x0000002, 0x01E3A01, 0x01EDC01, 0x0000002, 0x01E1C01, 0x01EDC01, 0x0000002,
+	0x01E1C01, 0x01F5701, 0x0000002, 0x01E3A01, 0x01F5701, 0x0000004, 0x01DA201, 0x0007E01,
+	0x01E3A01, 0x0007E01, 0x0000002, 0x01DB001, 0x01E7B01, 0x0000002, 0x01DBB01, 0x01DBB01,
+	0x0000002, 0x01DBB01, 0x01DC401, 0x0000004, 0x01DBB01, 0x0047501, 0x01E1C01, 0x01DF101,
+	0x0000003, 0x01DBB01, 0x01E5201, 0x0007E01, 0x0000002, 0x01DF101, 0x01EEA01, 0x0000002,
+	0x01DFD01, 0x01DA201, 0x0000002, 0x01DFD01, 0x01E6F01, 0x0000002, 0x01E0901, 0x01E4301,
+	0x0000002, 0x01E1C01, 0x01E1C01, 0x0000002, 0x01E1C01, 0x01EB001, 0x0000002, 0x01E2501,
+	0x01E3A01, 0x0000002, 0x01E2501, 0x01E4301, 0x0000003, 0x01E2501, 0x01E5201, 0x01DF101,
+	0x0000002, 0x01E2501, 0x01EE101, 0x0000003, 0x01E3A01, 0x01E0901, 0x01E2501, 0x0000003,
+	0x01E3A01, 0x01E5201, 0x01E2501, 0x0000002, 0x01E6F01, 0x01DFD01, 0x0000004, 0x01E6F01,
+	0x0007E01, 0x01E3A01, 0x0007E01, 0x0000003, 0x01E6F01, 0x01E6F01, 0x01E3A01, 0x0000002,
+	0x01E6F01, 0x01E8201, 0x0000002, 0x01EA001, 0x01E8201, 0x0000002, 0x01EA001, 0x01ED301,
+	0x0000002, 0x01EDC01, 0x01DB001, 0x0000003, 0x01ED301, 0x0047501, 0x01E3A01, 0x0000003,
+	0x01DA201, 0x0047501, 0x01E3A01, 0x0000003, 0x01D9901, 0x1FB4001, 0x1E5E500, 0x0000003,
+	0x01D9A01, 0x1FB4001, 0x1E5E500, 0x0000003, 0x01D9B01, 0x1FB4001, 0x1E5E500, 0x0000003,
+	0x01D9C01, 0x1FB4001, 0x1E5E500, 0x0000003, 0x01D9D01, 0x1FB4001, 0x1E5E500, 0x0000003,
+	0x01D9E01, 0x1FB4001, 0x1E5E500, 0x0000003, 0x01D9F01, 0x1FB4001, 0x1E5E500, 0x0000003,
+	0x01DA001, 0x1FB4001, 0x1E5E500, 0x0000003, 0x01DA101, 0x1FB4001, 0x1E5E500, 0x0000004,
+	0x01D9901, 0x01D9801, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9901, 0x01D9901, 0x1FB4001,
+	0x1E5E500, 0x0000004, 0x01D9901, 0x01D9A01, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9901,
+	0x01D9B01, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9901, 0x01D9C01, 0x1FB4001, 0x1E5E500,
+	0x0000004, 0x01D9901, 0x01D9D01, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9901, 0x01D9E01,
+	0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9901, 0x01D9F01, 0x1FB4001, 0x1E5E500, 0x0000004,
+	0x01D9901, 0x01DA001, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9901, 0x01DA101, 0x1FB4001,
+	0x1E5E500, 0x0000004, 0x01D9A01, 0x01D9801, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9A01,
+	0x01D9901, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9A01, 0x01D9A01, 0x1FB4001, 0x1E5E500,
+	0x0000004, 0x01D9A01, 0x01D9B01, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9A01, 0x01D9C01,
+	0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9A01, 0x01D9D01, 0x1FB4001, 0x1E5E500, 0x0000004,
+	0x01D9A01, 0x01D9E01, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9A01, 0x01D9F01, 0x1FB4001,
+	0x1E5E500, 0x0000004, 0x01D9A01, 0x01DA001, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9A01,
+	0x01DA101, 0x1FB4001, 0x1E5E500, 0x0000004, 0x01D9B01, 0x01D9801, 0x1FB4001, 0x1E5E500,
+	0x0000004, 0x01D9B01, 0x01D9901, 0x1FB4001, 0x1E5E500, 0x0000003, 0x01DF101, 0x01DA201,
+	0x01E2501, 0x0000002, 0x037B001, 0x038AF01, 0x0000002, 0x037C201, 0x038AF01, 0x0000002,
+	0x037D701, 0x038AF01, 0x0000002, 0x037EB01, 0x038B001, 0x0000002, 0x037F601, 0x038AF01,
+	0x0000002, 0x037FC01, 0x038B001, 0x0000002, 0x037FE01, 0x038B001, 0x0000002, 0x0380401,
+	0x038AF01, 0x0000002, 0x0382901, 0x038AF01, 0x0000002, 0x0385801, 0x038AF01, 0x0000002,
+	0x0386F01, 0x038AF01, 0x0000002, 0x0387501, 0x038B001, 0x0000002, 0x0387C01, 0x038AF01,
+	0x0000001, 0x0000032, 0x0000001, 0x0000097, 0x0000001, 0x0000098, 0x0000002, 0x01EB001,
+	0x01EF101, 0x0000002, 0x01DA201, 0x01DA201, 0x0000003, 0x01DA201, 0x00000F9, 0x01ED301,
+	0x0000002, 0x01DA201, 0x01EEA01, 0x0000002, 0x01E5201, 0x01E5201, 0x0000002, 0x01ED301,
+	0x01EEA01, 0x0000002, 0x01DE801, 0x00000FA, 0x0000002, 0x01E8201, 0x00000FA, 0x0000002,
+	0x01EB001, 0x00000FA, 0x0000002, 0x01DF101, 0x0000016, 0x0000002, 0x01E1C01, 0x0000016,
+	0x0000002, 0x01E4301, 0x0000016, 0x0000002, 0x01E8201, 0x0000016, 0x0000002, 0x01EA001,
+	0x0000016, 0x0000001, 0x00000C5, 0x0000001, 0x00000C6, 0x0000001, 0x00000C7, 0x0000001,
+	0x00000AB, 0x0000001, 0x00000C2, 0x0000001, 0x00000C3, 0x0000002, 0x01DC401, 0x01EF701,
+	0x0000002, 0x01EB001, 0x01EA501, 0x0000001, 0x00000AD, 0x0000002, 0x1FB4101, 0x18C4800,
+	0x0000002, 0x1FB4001, 0x1E6F400, 0x0000002, 0x1FB4101, 0x18CC800, 0x0000002, 0x1FB4001,
+	0x1EED100, 0x0000002, 0x1FB4001, 0x1CE3200, 0x0000002, 0x1FB4001, 0x1D3E500, 0x0000002,
+	0x1FB4001, 0x1D95100, 0x0000002, 0x1FB4001, 0x1D58700, 0x0000002, 0x1FB4001, 0x1D94800,
+	0x0000002, 0x1FB4001, 0x1E1F600, 0x0000002, 0x1FB4001, 0x1F66900, 0x0000002, 0x1FB4001,
+	0x1FF8500, 0x0000002, 0x1FB4101, 0x1863F00, 0x0000002, 0x1FB4101, 0x187BA00, 0x0000002,
+	0x1FB4101, 0x188F800, 0x0000002, 0x1FB4101, 0x1908F00, 0x0000002, 0x1FB4001, 0x1EA0200,
+	0x0000002, 0x1FB4001, 0x1ED1B00, 0x0000002, 0x1FB4001, 0x1F0D900, 0x0000002, 0x1FB4001,
+	0x1F3DE00, 0x0000002, 0x1FB4101, 0x1843D00, 0x0000002, 0x1FB4101, 0x1916A00, 0x0000002,
+	0x1FB4101, 0x199F100, 0x0000002, 0x1FB4001, 0x1CE8200, 0x0000002, 0x1FB4001, 0x1D37500,
+	0x0000002, 0x1FB4001, 0x1EB0400, 0x0000002, 0x1FB4001, 0x1F21B00, 0x0000002, 0x1FB4101,
+	0x1862D00, 0x0000002, 0x1FB4101, 0x19E1E00, 0x0000002, 0x1FB4001, 0x1DD5000, 0x0000002,
+	0x1FB4001, 0x1EFEB00, 0x0000002, 0x1FB4101, 0x185CD00, 0x0000002, 0x1FB4101, 0x1896400,
+	0x0000002, 0x1FB4001, 0x1E2C900, 0x0000002, 0x1FB4101, 0x181D800, 0x0000002, 0x1FB4101,
+	0x1881F00, 0x0000002, 0x1FB4001, 0x1DECA00, 0x0000002, 0x1FB4001, 0x1E71700, 0x0000002,
+	0x1FB4001, 0x1ED6A00, 0x0000002, 0x1FB4001, 0x1F2FC00, 0x0000002, 0x1FB4101, 0x190CE00,
+	0x0000002, 0x1FB4001, 0x1CF8600, 0x0000002, 0x1FB4001, 0x1D1B700, 0x0000002, 0x1FB4001,
+	0x1D2DE00, 0x0000002, 0x1FB4001, 0x1E4C400, 0x0000002, 0x1FB4001, 0x1EAD300, 0x0000002,
+	0x1FB4001, 0x1F21000, 0x0000002, 0x1FB4001, 0x1F6E700, 0x0000002, 0x1FB4101, 0x1860600,
+	0x0000002, 0x1FB4101, 0x1865C00, 0x0000002, 0x1FB4101, 0x18DEF00, 0x0000002, 0x1FB4101,
+	0x1973200, 0x0000002, 0x1FB4101, 0x19B6F00, 0x0000002, 0x1FB4101, 0x19DFA00, 0x0000002,
+	0x1FB4001, 0x1F88C00, 0x0000002, 0x1FB4001, 0x1F97F00, 0x0000002, 0x1FB4001, 0x1FDA000,
+	0x0000002, 0x1FB4101, 0x183C900, 0x0000002, 0x1FB4101, 0x1930400, 0x0000002, 0x1FB4101,
+	0x18AD600, 0x0000002, 0x1FB4001, 0x1D8DF00, 0x0000002, 0x1FB4001, 0x1DF0400, 0x0000002,
+	0x1FB4001, 0x1FC6000, 0x0000002, 0x1FB4101, 0x1807E00, 0x0000002, 0x1FB4001, 0x1F26200,
+	0x0000002, 0x1FB4001, 0x1F8CA00, 0x0000002, 0x1FB4101, 0x18CC200, 0x0000002, 0x1FB4101,
+	0x196F700, 0x0000002, 0x1FB4001, 0x1D8D800, 0x0000002, 0x1FB4001, 0x1DC6200, 0x0000002,
+	0x1FB4001, 0x1EA1300, 0x0000002, 0x1FB4001, 0x1EDDA00, 0x0000002, 0x1FB4001, 0x1EF0F00,
+	0x0000002, 0x1FB4001, 0x1FD2F00, 0x0000002, 0x1FB4001, 0x1FE3700, 0x0000002, 0x1FB4101,
+	0x1964B00, 0x0000002, 0x1FB4001, 0x1D2D200, 0x0000002, 0x1FB4101, 0x1808B00, 0x0000002,
+	0x1FB4001, 0x1D1DC00, 0x0000002, 0x1FB4001, 0x1D1CC00, 0x0000002, 0x1FB4001, 0x1FA1C00,
+	0x0000002, 0x1FB4001, 0x1FDBE00, 0x0000002, 0x1FB4101, 0x183F100, 0x0000002, 0x1FB4101,
+	0x1967500, 0x0000002, 0x1FB4101, 0x18B8000, 0x0000002, 0x1FB4001, 0x1E2CF00, 0x0000002,
+	0x1FB4101, 0x18AFE00, 0x0000002, 0x1FB4001, 0x1CE3900, 0x0000002, 0x1FB4001, 0x1DBE700,
+	0x0000002, 0x1FB4001, 0x1E01200, 0x0000002, 0x1FB4001, 0x1F38700, 0x0000002, 0x1FB4001,
+	0x1F57000, 0x0000002, 0x1FB4001, 0x1D31700, 0x0000002, 0x1FB4001, 0x1F8FB00, 0x0000002,
+	0x1FB4001, 0x1CFBF00, 0x0000002, 0x1FB4001, 0x1DFA900, 0x0000002, 0x1FB4001, 0x1CE0D00,
+	0x0000002, 0x1FB4001, 0x1ECCC00, 0x0000002, 0x1FB4001, 0x1E57800, 0x0000002, 0x1FB4001,
+	0x1FD2200, 0x0000002, 0x1FB4001, 0x1D3C300, 0x0000002, 0x1FB4001, 0x1D85E00, 0x0000002,
+	0x1FB4001, 0x1F70100, 0x0000002, 0x1FB4101, 0x1844900, 0x0000002, 0x1FB4101, 0x18AAA00,
+	0x0000002, 0x1FB4001, 0x1EBBA00, 0x0000002, 0x1FB4001, 0x1EC8800, 0x0000002, 0x1FB4001,
+	0x1E2FE00, 0x0000002, 0x1FB4101, 0x182E500, 0x0000002, 0x1FB4001, 0x1E3A000, 0x0000002,
+	0x1FB4001, 0x1F56500, 0x0000002, 0x1FB4001, 0x1CEAE00, 0x0000002, 0x1FB4001, 0x1D16900,
+	0x0000002, 0x1FB4001, 0x1D1C900, 0x0000002, 0x1FB4001, 0x1E88100, 0x0000002, 0x1FB4001,
+	0x1FCE700, 0x0000002, 0x1FB4101, 0x1826F00, 0x0000002, 0x1FB4101, 0x18AD200, 0x0000002,
+	0x1FB4101, 0x191CF00, 0x0000002, 0x1FB4001, 0x1D2F500, 0x0000002, 0x1FB4001, 0x1D44200,
+	0x0000002, 0x1FB4001, 0x1DEEC00, 0x0000002, 0x1FB4001, 0x1E5C500, 0x0000002, 0x1FB4001,
+	0x1EFFE00, 0x0000002, 0x1FB4001, 0x1F92A00, 0x0000002, 0x1FB4101, 0x195AD00, 0x0000002,
+	0x1FB4101, 0x19A6A00, 0x0000002, 0x1FB4101, 0x19E9700, 0x0000002, 0x1FB4101, 0x19ECE00,
+	0x0000002, 0x1FB4001, 0x1E6C600, 0x0000002, 0x1FB4001, 0x1EB7700, 0x0000002, 0x1FB4101,
+	0x18F6200, 0x0000002, 0x1FB4001, 0x1DE7400, 0x0000002, 0x1FB4001, 0x1E19000, 0x0000002,
+	0x1FB4001, 0x1E20000, 0x0000002, 0x1FB4001, 0x1E49A00, 0x0000002, 0x1FB4001, 0x1EF2300,
+	0x0000002, 0x1FB4001, 0x1F14900, 0x0000002, 0x1FB4001, 0x1F48900, 0x0000002, 0x1FB4001,
+	0x1F9CA00, 0x0000002, 0x1FB4001, 0x1FDF400, 0x0000002, 0x1FB4101, 0x1806F00, 0x0000002,
+	0x1FB4101, 0x18F2600, 0x0000002, 0x1FB4101, 0x184EE00, 0x0000002, 0x1FB4101, 0x1902300,
+	0x0000002, 0x1FB4101, 0x1934A00, 0x0000002, 0x1FB4001, 0x1D21700, 0x0000002, 0x1FB4001,
+	0x1D2A300, 0x0000002, 0x1FB4001, 0x1D4BD00, 0x0000002, 0x1FB4001, 0x1F0C800, 0x0000002,
+	0x1FB4101, 0x188C200, 0x0000002, 0x1FB4001, 0x1DEC900, 0x0000002, 0x1FB4001, 0x1DFF500,
+	0x0000002, 0x1FB4001, 0x1E37B00, 0x0000002, 0x1FB4001, 0x1EBAE00, 0x0000002, 0x1FB4001,
+	0x1FC3E00, 0x0000002, 0x1FB4001, 0x1F37500, 0x0000002, 0x1FB4001, 0x1CEE400, 0x0000002,
+	0x1FB4001, 0x1D6F900, 0x0000002, 0x1FB4001, 0x1DDBA00, 0x0000002, 0x1FB4001, 0x1E01C00,
+	0x0000002, 0x1FB4001, 0x1F3B200, 0x0000002, 0x1FB4001, 0x1F46900, 0x0000002, 0x1FB4001,
+	0x1FF9A00, 0x0000002, 0x1FB4101, 0x1804600, 0x0000002, 0x1FB4101, 0x1923400, 0x0000002,
+	0x1FB4101, 0x196F600, 0x0000002, 0x1FB4101, 0x1974800, 0x0000002, 0x1FB4101, 0x1981800,
+	0x0000002, 0x1FB4001, 0x1CF8B00, 0x0000002, 0x1FB4001, 0x1F9AE00, 0x0000002, 0x1FB4101,
+	0x191B400, 0x0000002, 0x1FB4101, 0x196B800, 0x0000002, 0x1FB4001, 0x1E0E100, 0x0000002,
+	0x1FB4001, 0x1CE8600, 0x0000002, 0x1FB4001, 0x1D0DA00, 0x0000002, 0x1FB4001, 0x1DBEE00,
+	0x0000002, 0x1FB4001, 0x1DC3F00, 0x0000002, 0x1FB4001, 0x1E59900, 0x0000002, 0x1FB4001,
+	0x1F1CE00, 0x0000002, 0x1FB4001, 0x1F64200, 0x0000002, 0x1FB4101, 0x184FC00, 0x0000002,
+	0x1FB4101, 0x1907C00, 0x0000002, 0x1FB4001, 0x1E68800, 0x0000002, 0x1FB4101, 0x1962E00,
+	0x0000002, 0x1FB4001, 0x1D28900, 0x0000002, 0x1FB4001, 0x1E77B00, 0x0000002, 0x1FB4001,
+	0x1E7F300, 0x0000002, 0x1FB4001, 0x1ED4100, 0x0000002, 0x1FB4001, 0x1EE9C00, 0x0000002,
+	0x1FB4001, 0x1F40900, 0x0000002, 0x1FB4001, 0x1F55900, 0x0000002, 0x1FB4001, 0x1F86B00,
+	0x0000002, 0x1FB4001, 0x1FD1000, 0x0000002, 0x1FB4101, 0x1985E00, 0x0000002, 0x1FB4001,
+	0x1E22E00, 0x0000002, 0x1FB4101, 0x1967800, 0x0000002, 0x1FB4001, 0x1D02B00, 0x0000002,
+	0x1FB4001, 0x1DD1900, 0x0000002, 0x1FB4001, 0x1EDEA00, 0x0000002, 0x1FB4101, 0x18F2A00,
+	0x0000002, 0x1FB4001, 0x1DF8B00, 0x0000002, 0x1FB4001, 0x1E14400, 0x0000002, 0x1FB4001,
+	0x1E81700, 0x0000002, 0x1FB4101, 0x1968600, 0x0000002, 0x1FB4001, 0x1D22900, 0x0000002,
+	0x1FB4001, 0x1D40F00, 0x0000002, 0x1FB4001, 0x1DC6500, 0x0000002, 0x1FB4001, 0x1E61300,
+	0x0000002, 0x1FB4001, 0x1E74E00, 0x0000002, 0x1FB4001, 0x1E8A800, 0x0000002, 0x1FB4001,
+	0x1ECE500, 0x0000002, 0x1FB4001, 0x1F40600, 0x0000002, 0x1FB4001, 0x1F5E200, 0x0000002,
+	0x1FB4001, 0x1FF7900, 0x0000002, 0x1FB4101, 0x188CF00, 0x0000002, 0x1FB4101, 0x188E100,
+	0x0000002, 0x1FB4101, 0x196E200, 0x0000002, 0x1FB4001, 0x1D33F00, 0x0000002, 0x1FB4001,
+	0x1EEBA00, 0x0000002, 0x1FB4001, 0x1D41D00, 0x0000002, 0x1FB4001, 0x1F1D000, 0x0000002,
+	0x1FB4001, 0x1F49800, 0x0000002, 0x1FB4101, 0x185FA00, 0x0000002, 0x1FB4101, 0x196A300,
+	0x0000002, 0x1FB4101, 0x19C5700, 0x0000002, 0x1FB4101, 0x19E9F00, 0x0000002, 0x1FB4001,
+	0x1E79700, 0x0000002, 0x1FB4001, 0x1EDCB00, 0x0000002, 0x1FB4101, 0x181E800, 0x0000002,
+	0x1FB4001, 0x1FB2000, 0x0000002, 0x1FB4001, 0x1FC9200, 0x0000002, 0x1FB4001, 0x1F2C000,
+	0x0000002, 0x1FB4001, 0x1F09900, 0x0000002, 0x1FB4101, 0x18B5800, 0x0000002, 0x1FB4001,
+	0x1CEC000, 0x0000002, 0x1FB4101, 0x1833600, 0x0000002, 0x1FB4001, 0x1D23A00, 0x0000002,
+	0x1FB4001, 0x1D20700, 0x0000002, 0x1FB4001, 0x1DEA600, 0x0000002, 0x1FB4001, 0x1E2D300,
+	0x0000002, 0x1FB4001, 0x1FCD600, 0x0000002, 0x1FB4001, 0x1DB8500, 0x0000002, 0x1FB4001,
+	0x1ED1E00, 0x0000002, 0x1FB4001, 0x1E6B400, 0x0000002, 0x1FB4101, 0x18F3B00, 0x0000002,
+	0x1FB4101, 0x1964D00, 0x0000002, 0x1FB4001, 0x1DED300, 0x0000002, 0x1FB4001, 0x1D14000,
+	0x0000002, 0x1FB4001, 0x1D5C000, 0x0000002, 0x1FB4101, 0x1FA0E00, 0x0000002, 0x1FB4101,
+	0x1FA0F00, 0x0000002, 0x1FB4001, 0x1D85A00, 0x0000002, 0x1FB4101, 0x1FA1100, 0x0000002,
+	0x1FB4001, 0x1E67400, 0x0000002, 0x1FB4101, 0x1FA1300, 0x0000002, 0x1FB4101, 0x1FA1400,
+	0x0000002, 0x1FB4001, 0x1D1DE00, 0x0000002, 0x1FB4001, 0x1F32A00, 0x0000002, 0x1FB4001,
+	0x1F6CA00, 0x0000002, 0x1FB4001, 0x1F93C00, 0x0000002, 0x1FB4001, 0x1F95E00, 0x0000002,
+	0x1FB4001, 0x1F96500, 0x0000002, 0x1FB4001, 0x1F98F00, 0x0000002, 0x1FB4101, 0x1975600,
+	0x0000002, 0x1FB4001, 0x1FCBE00, 0x0000002, 0x1FB4101, 0x1FA1F00, 0x0000002, 0x1FB4101,
+	0x1861200, 0x0000002, 0x1FB4101, 0x1FA2100, 0x0000002, 0x1FB4101, 0x18AF800, 0x0000002,
+	0x1FB4101, 0x1FA2300, 0x0000002, 0x1FB4101, 0x1FA2400, 0x0000002, 0x1FB4101, 0x1903800,
+	0x0000002, 0x1FB4101, 0x190FD00, 0x0000002, 0x1FB4101, 0x1FA2700, 0x0000002, 0x1FB4101,
+	0x1FA2800, 0x0000002, 0x1FB4101, 0x1FA2900, 0x0000002, 0x1FB4101, 0x198EF00, 0x0000002,
+	0x1FB4101, 0x198FC00, 0x0000002, 0x1FB4101, 0x1992800, 0x0000002, 0x1FB4101, 0x19DB400,
+	0x0000002, 0x1FB4101, 0x190DE00, 0x0000002, 0x1FB4101, 0x196B700, 0x0000002, 0x1FB4001,
+	0x1CFAE00, 0x0000002, 0x1FB4001, 0x1D0E700, 0x0000002, 0x1FB4001, 0x1D14D00, 0x0000002,
+	0x1FB4001, 0x1D2C900, 0x0000002, 0x1FB4001, 0x1D2E400, 0x0000002, 0x1FB4001, 0x1D35100,
+	0x0000002, 0x1FB4001, 0x1D59D00, 0x0000002, 0x1FB4001, 0x1D60600, 0x0000002, 0x1FB4001,
+	0x1D66800, 0x0000002, 0x1FB4001, 0x1D84000, 0x0000002, 0x1FB4001, 0x1D8A800, 0x0000002,
+	0x1FB4001, 0x1DC6400, 0x0000002, 0x1FB4001, 0x1E09400, 0x0000002, 0x1FB4001, 0x1E16800,
+	0x0000002, 0x1FB4001, 0x1E18E00, 0x0000002, 0x1FB4001, 0x1E1F200, 0x0000002, 0x1FB4001,
+	0x1E54F00, 0x0000002, 0x1FB4001, 0x1E5E200, 0x0000002, 0x1FB4001, 0x1E69100, 0x0000002,
+	0x1FB4001, 0x1E88500, 0x0000002, 0x1FB4001, 0x1ED7700, 0x0000002, 0x1FB4001, 0x1EE1A00,
+	0x0000002, 0x1FB4001, 0x1EF2200, 0x0000002, 0x1FB4001, 0x1F16E00, 0x0000002, 0x1FB4001,
+	0x1F42200, 0x0000002, 0x1FB4001, 0x1F89100, 0x0000002, 0x1FB4001, 0x1F94900, 0x0000002,
+	0x1FB4001, 0x1F94800, 0x0000002, 0x1FB4001, 0x1F95000, 0x0000002, 0x1FB4001, 0x1F95600,
+	0x0000002, 0x1FB4001, 0x1F98D00, 0x0000002, 0x1FB4001, 0x1F98E00, 0x0000002, 0x1FB4001,
+	0x1FA4000, 0x0000002, 0x1FB4001, 0x1FA8100, 0x0000002, 0x1FB4001, 0x1FBC000, 0x0000002,
+	0x1FB4001, 0x1FE0900, 0x0000002, 0x1FB4001, 0x1FE4100, 0x0000002, 0x1FB4001, 0x1FF7200,
+	0x0000002, 0x1FB4101, 0x1800500, 0x0000002, 0x1FB4101, 0x181ED00, 0x0000002, 0x1FB4101,
+	0x1845700, 0x0000002, 0x1FB4101, 0x1891000, 0x0000002, 0x1FB4101, 0x1899600, 0x0000002,
+	0x1FB4101, 0x18B0100, 0x0000002, 0x1FB4101, 0x18B3900, 0x0000002, 0x1FB4101, 0x18CD300,
+	0x0000002, 0x1FB4101, 0x18D0800, 0x0000002, 0x1FB4101, 0x196E300, 0x0000002, 0x1FB4101,
+	0x197FF00, 0x0000002, 0x1FB4101, 0x1983B00, 0x0000002, 0x1FB4001, 0x1E07500, 0x0000002,
+	0x1FB8401, 0x1C2EE00, 0x0000002, 0x1FB4101, 0x1821800, 0x0000002, 0x1FB4001, 0x1CE2600,
+	0x0000002, 0x1FB4001, 0x1D1B500, 0x0000002, 0x1FB4001, 0x1D16800, 0x0000002, 0x1FB4001,
+	0x1CF8000, 0x0000002, 0x1FB4001, 0x1D14500, 0x0000002, 0x1FB4001, 0x1D18000, 0x0000002,
+	0x1FB4001, 0x1D2C700, 0x0000002, 0x1FB4001, 0x1D2FA00, 0x0000002, 0x1FB4001, 0x1D55500,
+	0x0000002, 0x1FB4001, 0x1D59900, 0x0000002, 0x1FB4001, 0x1D5E200, 0x0000002, 0x1FB4001,
+	0x1D8B300, 0x0000002, 0x1FB4001, 0x1D94400, 0x0000002, 0x1FB4001, 0x1D95400, 0x0000002,
+	0x1FB4001, 0x1DA6200, 0x0000002, 0x1FB4001, 0x1DB2800, 0x0000002, 0x1FB4001, 0x1DED200,
+	0x0000002, 0x1FB4001, 0x1DED900, 0x0000002, 0x1FB4001, 0x1DF6900, 0x0000002, 0x1FB4001,
+	0x1DFAD00, 0x0000002, 0x1FB4001, 0x1E0D800, 0x0000002, 0x1FB4001, 0x1E14E00, 0x0000002,
+	0x1FB4001, 0x1E10800, 0x0000002, 0x1FB4001, 0x1E16000, 0x0000002, 0x1FB4001, 0x1E23400,
+	0x0000002, 0x1FB4001, 0x1E3C400, 0x0000002, 0x1FB4001, 0x1E41C00, 0x0000002, 0x1FB4001,
+	0x1E45200, 0x0000002, 0x1FB4001, 0x1E55600, 0x0000002, 0x1FB4001, 0x1E71B00, 0x0000002,
+	0x1FB4001, 0x1E75600, 0x0000002, 0x1FB4001, 0x1EEDB00, 0x0000002, 0x1FB4001, 0x1EECB00,
+	0x0000002, 0x1FB4001, 0x1F01E00, 0x0000002, 0x1FB4001, 0x1F7A700, 0x0000002, 0x1FB4001,
+	0x1F23500, 0x0000002, 0x1FB4001, 0x1F2AF00, 0x0000002, 0x1FB4001, 0x1F47100, 0x0000002,
+	0x1FB4001, 0x1F50600, 0x0000002, 0x1FB4001, 0x1F53B00, 0x0000002, 0x1FB4001, 0x1F61D00,
+	0x0000002, 0x1FB4001, 0x1F61F00, 0x0000002, 0x1FB4001, 0x1F6DB00, 0x0000002, 0x1FB4001,
+	0x1F6F400, 0x0000002, 0x1FB4001, 0x1F74A00, 0x0000002, 0x1FB4001, 0x1F74000, 0x0000002,
+	0x1FB4001, 0x1F8CC00, 0x0000002, 0x1FB4001, 0x1FAB100, 0x0000002, 0x1FB4001, 0x1FC7B00,
+	0x0000002, 0x1FB4001, 0x1FD5B00, 0x0000002, 0x1FB4001, 0x1FF3E00, 0x0000002, 0x1FB4101,
+	0x1835200, 0x0000002, 0x1FB4101, 0x183EF00, 0x0000002, 0x1FB4101, 0x1877900, 0x0000002,
+	0x1FB4101, 0x1894100, 0x0000002, 0x1FB4101, 0x1898600, 0x0000002, 0x1FB4101, 0x18ABF00,
+	0x0000002, 0x1FB4101, 0x18ACB00, 0x0000002, 0x1FB4101, 0x18AED00, 0x0000002, 0x1FB4101,
+	0x18B8A00, 0x0000002, 0x1FB4101, 0x18F3800, 0x0000002, 0x1FB4101, 0x1907200, 0x0000002,
+	0x1FB4101, 0x1919900, 0x0000002, 0x1FB4101, 0x1927600, 0x0000002, 0x1FB4101, 0x1967C00,
+	0x0000002, 0x1FB4101, 0x197DB00, 0x0000002, 0x1FB4101, 0x1980B00, 0x0000002, 0x1FB4101,
+	0x19B1200, 0x0000002, 0x1FB8401, 0x1A84A00, 0x0000002, 0x1FB8401, 0x1A84400, 0x0000002,
+	0x1FB8401, 0x1B3D500, 0x0000002, 0x1FB8001, 0x1BB9D00, 0x0000002, 0x1FB8001, 0x1C01800,
+	0x0000002, 0x1FB8001, 0x1C03900, 0x0000002, 0x1FB8401, 0x1D24900, 0x0000002, 0x1FB8401,
+	0x1DCD000, 0x0000002, 0x1FB8401, 0x1FED300, 0x0000002, 0x1FB4101, 0x19F4300, 0x0000002,
+	0x1FB4101, 0x19F8E00, 0x0000002, 0x01DE801, 0x01DE801, 0x0000002, 0x01DE801, 0x01E0901,
+	0x0000002, 0x01DE801, 0x01E2501, 0x0000003, 0x01DE801, 0x01DE801, 0x01E0901, 0x0000003,
+	0x01DE801, 0x01DE801, 0x01E2501, 0x0000003, 0x01EA001, 0x00000FA, 0x01EB001, 0x0000002,
+	0x01EA001, 0x01EB001, 0x0000002, 0x020F401, 0x020F701, 0x0000002, 0x020F401, 0x020E501,
+	0x0000002, 0x020F401, 0x020EB01, 0x0000002, 0x020FF01, 0x020F701, 0x0000002, 0x020F401,
+	0x020ED01, 0x0000002, 0x0211201, 0x0000037, 0x0000001, 0x0000042, 0x0000003, 0x0211201,
+	0x0211201, 0x000003A, 0x0000002, 0x0211D01, 0x000003F, 0x0000002, 0x0211D01, 0x000003E,
+	0x0000003, 0x0211D01, 0x0000040, 0x000003F, 0x0000003, 0x0211D01, 0x0000040, 0x000003E,
+	0x0000002, 0x0210901, 0x000003A, 0x0000002, 0x0210901, 0x000003B, 0x0000002, 0x0210901,
+	0x0000040, 0x0000002, 0x0210A01, 0x0000040, 0x0000002, 0x0210B01, 0x0000040, 0x0000002,
+	0x0210C01, 0x0000040, 0x0000002, 0x0210D01, 0x0000040, 0x0000002, 0x0210E01, 0x0000040,
+	0x0000002, 0x0210F01, 0x0000040, 0x0000002, 0x0211101, 0x0000040, 0x0000002, 0x0211201,
+	0x0000040, 0x0000002, 0x0211301, 0x0000040, 0x0000002, 0x0211401, 0x0000040, 0x0000002,
+	0x0211501, 0x0000040, 0x0000002, 0x0211601, 0x0000040, 0x0000002, 0x0211701, 0x0000040,
+	0x0000002, 0x0211901, 0x0000040, 0x0000002, 0x0211A01, 0x0000040, 0x0000002, 0x0211B01,
+	0x0000040, 0x0000002, 0x0211C01, 0x0000040, 0x0000002, 0x0211D01, 0x0000040, 0x0000002,
+	0x0211E01, 0x0000040, 0x0000002, 0x0210E01, 0x000003C, 0x0000002, 0x0210A01, 0x0000041,
+	0x0000002, 0x0211301, 0x0000041, 0x0000002, 0x0211901, 0x0000041, 0x0000002, 0x0210901,
+	0x0211401, 0x0000002, 0x0215901, 0x0215D01, 0x0000002, 0x0215901, 0x0221201, 0x0000002,
+	0x0215901, 0x0221301, 0x0000002, 0x0215901, 0x0221701, 0x0000002, 0x0215901, 0x0221601,
+	0x0000002, 0x0215901, 0x0221801, 0x0000002, 0x0215901, 0x0222601, 0x0000002, 0x0215901,
+	0x0222101, 0x0000002, 0x0215901, 0x0217A01, 0x0000002, 0x0215901, 0x0218401, 0x0000002,
+	0x0215901, 0x021FF01, 0x0000002, 0x0215901, 0x0222201, 0x0000002, 0x0215F01, 0x0217A01,
+	0x0000002, 0x0215F01, 0x0218401, 0x0000002, 0x0215F01, 0x0218501, 0x0000002, 0x0215F01,
+	0x021FF01, 0x0000002, 0x0215F01, 0x0222101, 0x0000002, 0x0215F01, 0x0222201, 0x0000002,
+	0x0217001, 0x0217A01, 0x0000002, 0x0217001, 0x0218401, 0x0000002, 0x0217001, 0x0218501,
+	0x0000002, 0x0217001, 0x021FF01, 0x0000002, 0x0217001, 0x0222101, 0x0000002, 0x0217001,
+	0x0222201, 0x0000002, 0x0217101, 0x0217A01, 0x0000002, 0x0217101, 0x021FF01, 0x0000002,
+	0x0217101, 0x0222101, 0x0000002, 0x0217101, 0x0222201, 0x0000002, 0x0217A01, 0x0218401,
+	0x0000002, 0x0217A01, 0x021FF01, 0x0000002, 0x0218401, 0x0217A01, 0x0000002, 0x0218401,
+	0x021FF01, 0x0000002, 0x0218501, 0x0217A01, 0x0000002, 0x0218501, 0x0218401, 0x0000002,
+	0x0218501, 0x021FF01, 0x0000002, 0x021B101, 0x0217A01, 0x0000002, 0x021B101, 0x0218401,
+	0x0000002, 0x021B101, 0x0218501, 0x0000002, 0x021B101, 0x021FF01, 0x0000002, 0x021BC01,
+	0x0218401, 0x0000002, 0x021BC01, 0x021FF01, 0x0000002, 0x021BD01, 0x0217A01, 0x0000002,
+	0x021BD01, 0x0218401, 0x0000002, 0x021BD01, 0x0218501, 0x0000002, 0x021BD01, 0x021FF01,
+	0x0000002, 0x021C201, 0x0218401, 0x0000002, 0x021C201, 0x021FF01, 0x0000002, 0x021C301,
+	0x021FF01, 0x0000002, 0x021C601, 0x0217A01, 0x0000002, 0x021C601, 0x021FF01, 0x0000002,
+	0x021C701, 0x0217A01, 0x0000002, 0x021C701, 0x021FF01, 0x0000002, 0x021CF01, 0x0217A01,
+	0x0000002, 0x021CF01, 0x0218401, 0x0000002, 0x021CF01, 0x0218501, 0x0000002, 0x021CF01,
+	0x021FF01, 0x0000002, 0x021CF01, 0x0222101, 0x0000002, 0x021CF01, 0x0222201, 0x0000002,
+	0x021DB01, 0x0218401, 0x0000002, 0x021DB01, 0x021FF01, 0x0000002, 0x021DB01, 0x0222101,
+	0x0000002, 0x021DB01, 0x0222201, 0x0000002, 0x021E101, 0x0215D01, 0x0000002, 0x021E101,
+	0x0217A01, 0x0000002, 0x021E101, 0x0218401, 0x0000002, 0x021E101, 0x0218501, 0x0000002,
+	0x021E101, 0x021F701, 0x0000002, 0x021E101, 0x021FF01, 0x0000002, 0x021E101, 0x0222101,
+	0x0000002, 0x021E101, 0x0222201, 0x0000002, 0x021F701, 0x0217A01, 0x0000002, 0x021F701,
+	0x0218401, 0x0000002, 0x021F701, 0x0218501, 0x0000002, 0x021F701, 0x021FF01, 0x0000002,
+	0x021F701, 0x0222101, 0x0000002, 0x021F701, 0x0222201, 0x0000002, 0x021FF01, 0x0217A01,
+	0x0000002, 0x021FF01, 0x0218401, 0x0000002, 0x021FF01, 0x0218501, 0x0000002, 0x021FF01,
+	0x021FF01, 0x0000002, 0x021FF01, 0x0222101, 0x0000002, 0x021FF01, 0x0222201, 0x0000002,
+	0x0220301, 0x0217A01, 0x0000002, 0x0220301, 0x0218401, 0x0000002, 0x0220301, 0x0218501,
+	0x0000002, 0x0220301, 0x021FF01, 0x0000002, 0x0220301, 0x0222101, 0x0000002, 0x0220301,
+	0x0222201, 0x0000002, 0x0220D01, 0x0217A01, 0x0000002, 0x0220D01, 0x021FF01, 0x0000002,
+	0x0220D01, 0x0222101, 0x0000002, 0x0220D01, 0x0222201, 0x0000002, 0x0222201, 0x0217A01,
+	0x0000002, 0x0222201, 0x0218401, 0x0000002, 0x0222201, 0x0218501, 0x0000002, 0x0222201,
+	0x021FF01, 0x0000002, 0x0222201, 0x0222101, 0x0000002, 0x0222201, 0x0222201, 0x0000002,
+	0x0219001, 0x0000079, 0x0000002, 0x0219E01, 0x0000079, 0x0000002, 0x0222101, 0x0000079,
+	0x0000002, 0x0000051, 0x0000061, 0x0000002, 0x0000054, 0x0000061, 0x0000002, 0x0000057,
+	0x0000061, 0x0000002, 0x000005B, 0x0000061, 0x0000002, 0x000005E, 0x0000061, 0x0000002,
+	0x0000061, 0x0000079, 0x0000002, 0x0215901, 0x0219E01, 0x0000002, 0x0215901, 0x0219F01,
+	0x0000002, 0x0215901, 0x0220301, 0x0000002, 0x0215F01, 0x0219E01, 0x0000002, 0x0215F01,
+	0x0219F01, 0x0000002, 0x0215F01, 0x0220301, 0x0000002, 0x0217001, 0x0219E01, 0x0000002,
+	0x0217001, 0x0219F01, 0x0000002, 0x0217001, 0x0220301, 0x0000002, 0x0217101, 0x0219E01,
+	0x0000002, 0x0217101, 0x0219F01, 0x0000002, 0x0217101, 0x0220301, 0x0000002, 0x021FF01,
+	0x0215D01, 0x0000002, 0x0220301, 0x0219E01, 0x0000002, 0x0220301, 0x0219F01, 0x0000002,
+	0x0220301, 0x0220301, 0x0000002, 0x0222201, 0x0219E01, 0x0000002, 0x0222201, 0x0219F01,
+	0x0000002, 0x0222201, 0x0220301, 0x0000002, 0x0215901, 0x0218501, 0x0000002, 0x0215901,
+	0x0220D01, 0x0000002, 0x0215F01, 0x0220D01, 0x0000002, 0x0217001, 0x0220D01, 0x0000002,
+	0x021BC01, 0x0218501, 0x0000002, 0x021F701, 0x0220D01, 0x0000002, 0x0220301, 0x0220D01,
+	0x0000002, 0x0220D01, 0x0000079, 0x0000002, 0x0222201, 0x0220D01, 0x0000002, 0x0217101,
+	0x0220D01, 0x0000002, 0x021B101, 0x0220D01, 0x0000002, 0x021B201, 0x021FF01, 0x0000002,
+	0x021B201, 0x0220D01, 0x0000002, 0x021C201, 0x0222101, 0x0000002, 0x021C201, 0x0222201,
+	0x0000002, 0x021C601, 0x0222101, 0x0000002, 0x021C601, 0x0222201, 0x0000002, 0x021C701,
+	0x0222101, 0x0000002, 0x021C701, 0x0222201, 0x0000002, 0x021B101, 0x0222101, 0x0000002,
+	0x021B101, 0x0222201, 0x0000002, 0x021B201, 0x0222101, 0x0000002, 0x021B201, 0x0222201,
+	0x0000002, 0x0218401, 0x0222101, 0x0000002, 0x0218401, 0x0222201, 0x0000002, 0x0217A01,
+	0x0222101, 0x0000002, 0x0217A01, 0x0222201, 0x0000002, 0x0218501, 0x0222101, 0x0000002,
+	0x0218501, 0x0222201, 0x0000002, 0x021BC01, 0x0222101, 0x0000002, 0x021BC01, 0x0222201,
+	0x0000002, 0x021BD01, 0x0222101, 0x0000002, 0x021BD01, 0x0222201, 0x0000002, 0x021B201,
+	0x0217A01, 0x0000002, 0x021B201, 0x0218401, 0x0000002, 0x021B201, 0x0218501, 0x0000002,
+	0x021B201, 0x0219E01, 0x0000002, 0x021B101, 0x0219E01, 0x0000002, 0x021BC01, 0x0219E01,
+	0x0000002, 0x021BD01, 0x0219E01, 0x0000002, 0x0215D01, 0x000004E, 0x0000003, 0x0217001,
+	0x0217A01, 0x021FF01, 0x0000003, 0x0217001, 0x0218401, 0x0217A01, 0x0000003, 0x0217001,
+	0x0218401, 0x021FF01, 0x0000003, 0x0217001, 0x0218501, 0x021FF01, 0x0000003, 0x0217001,
+	0x021FF01, 0x0217A01, 0x0000003, 0x0217001, 0x021FF01, 0x0218401, 0x0000003, 0x0217001,
+	0x021FF01, 0x0218501, 0x0000003, 0x0217A01, 0x021FF01, 0x0218401, 0x0000003, 0x0218401,
+	0x021FF01, 0x0222201, 0x0000003, 0x0218401, 0x021FF01, 0x0222101, 0x0000003, 0x021B101,
+	0x0218401, 0x0217A01, 0x0000003, 0x021B101, 0x0217A01, 0x0218401, 0x0000003, 0x021B101,
+	0x0217A01, 0x0222101, 0x0000003, 0x021B101, 0x021FF01, 0x0218401, 0x0000003, 0x021B101,
+	0x021FF01, 0x0217A01, 0x0000003, 0x021B101, 0x021FF01, 0x021FF01, 0x0000003, 0x021BC01,
+	0x0218401, 0x0218401, 0x0000003, 0x021BC01, 0x021FF01, 0x021FF01, 0x0000003, 0x021B201,
+	0x0218401, 0x021FF01, 0x0000003, 0x021B201, 0x0217A01, 0x0222201, 0x0000003, 0x021B201,
+	0x021FF01, 0x0218501, 0x0000003, 0x021B201, 0x021FF01, 0x021FF01, 0x0000003, 0x021BD01,
+	0x0218401, 0x0222101, 0x0000003, 0x021BD01, 0x0218501, 0x021FF01, 0x0000003, 0x021C201,
+	0x021FF01, 0x0218401, 0x0000003, 0x021C201, 0x021FF01, 0x021FF01, 0x0000003, 0x021C201,
+	0x021FF01, 0x0222201, 0x0000003, 0x021C601, 0x0217A01, 0x021FF01, 0x0000003, 0x021C601,
+	0x021FF01, 0x021FF01, 0x0000003, 0x021C601, 0x021FF01, 0x0222101, 0x0000003, 0x021C701,
+	0x021FF01, 0x021FF01, 0x0000003, 0x021C701, 0x021FF01, 0x0222201, 0x0000003, 0x021C701,
+	0x021FF01, 0x0222101, 0x0000003, 0x021CF01, 0x0218501, 0x021FF01, 0x0000003, 0x021DB01,
+	0x021FF01, 0x0218401, 0x0000003, 0x021DB01, 0x021FF01, 0x021FF01, 0x0000003, 0x021F701,
+	0x0218401, 0x021FF01, 0x0000003, 0x021F701, 0x0218401, 0x0222201, 0x0000003, 0x021F701,
+	0x0218401, 0x0222101, 0x0000003, 0x021F701, 0x0217A01, 0x0217A01, 0x0000003, 0x021F701,
+	0x0218501, 0x021FF01, 0x0000003, 0x021F701, 0x021FF01, 0x0218401, 0x0000003, 0x021FF01,
+	0x0218401, 0x0217A01, 0x0000003, 0x021FF01, 0x0218401, 0x021FF01, 0x0000003, 0x021FF01,
+	0x0218401, 0x0222201, 0x0000003, 0x021FF01, 0x0217A01, 0x0218401, 0x0000003, 0x021FF01,
+	0x0217A01, 0x021FF01, 0x0000003, 0x021FF01, 0x0218501, 0x0217A01, 0x0000003, 0x021FF01,
+	0x0218501, 0x021FF01, 0x0000003, 0x021FF01, 0x0217A01, 0x0218501, 0x0000003, 0x0220D01,
+	0x021FF01, 0x0217A01, 0x0000003, 0x0220D01, 0x021FF01, 0x021FF01, 0x0000003, 0x0220301,
+	0x0218401, 0x021FF01, 0x0000003, 0x0220301, 0x0218401, 0x0222101, 0x0000003, 0x0220301,
+	0x0217A01, 0x021FF01, 0x0000003, 0x0220301, 0x0217A01, 0x0222101, 0x0000003, 0x0220301,
+	0x021FF01, 0x0222201, 0x0000003, 0x0220301, 0x021FF01, 0x0222101, 0x0000003, 0x0222201,
+	0x021FF01, 0x021FF01, 0x0000003, 0x0215F01, 0x0218501, 0x0222201, 0x0000003, 0x0217001,
+	0x0217A01, 0x0222201, 0x0000003, 0x0217001, 0x0217A01, 0x0222101, 0x0000003, 0x0217001,
+	0x0218501, 0x0222201, 0x0000003, 0x0217001, 0x0218501, 0x0222101, 0x0000003, 0x0217001,
+	0x021FF01, 0x0222201, 0x0000003, 0x0217001, 0x021FF01, 0x0222101, 0x0000003, 0x0217A01,
+	0x021FF01, 0x0222201, 0x0000003, 0x0217A01, 0x0218401, 0x0222101, 0x0000003, 0x0217A01,
+	0x021FF01, 0x0222101, 0x0000003, 0x021B101, 0x0218501, 0x0222101, 0x0000003, 0x021BC01,
+	0x0218401, 0x0222201, 0x0000003, 0x021B201, 0x0218401, 0x0222201, 0x0000003, 0x021BD01,
+	0x0218401, 0x0222201, 0x0000003, 0x021F701, 0x0217A01, 0x0222201, 0x0000003, 0x021F701,
+	0x021FF01, 0x0222201, 0x0000003, 0x0222201, 0x0218401, 0x0222201, 0x0000003, 0x0222201,
+	0x0217A01, 0x0222201, 0x0000003, 0x0222201, 0x021FF01, 0x0222201, 0x0000003, 0x021FF01,
+	0x021FF01, 0x0222201, 0x0000003, 0x021DB01, 0x021FF01, 0x0222201, 0x0000003, 0x0220301,
+	0x0218401, 0x0222201, 0x0000003, 0x021C601, 0x021FF01, 0x0222201, 0x0000003, 0x021E101,
+	0x021FF01, 0x0222201, 0x0000003, 0x0220301, 0x0217A01, 0x0218401, 0x0000003, 0x021FF01,
+	0x0218501, 0x0222201, 0x0000003, 0x021F701, 0x0217A01, 0x021FF01, 0x0000003, 0x021E101,
+	0x021FF01, 0x021FF01, 0x0000003, 0x0217A01, 0x0218401, 0x0222201, 0x0000003, 0x0218401,
+	0x0217A01, 0x0222201, 0x0000003, 0x021FF01, 0x0217A01, 0x0222201, 0x0000003, 0x021CF01,
+	0x021FF01, 0x0222201, 0x0000003, 0x0215F01, 0x0218401, 0x0222201, 0x0000003, 0x021B101,
+	0x0218501, 0x0222201, 0x0000003, 0x0220301, 0x0217A01, 0x0222201, 0x0000003, 0x021BC01,
+	0x021F701, 0x0223001, 0x0000003, 0x021DB01, 0x021F701, 0x0223001, 0x0000004, 0x0215D01,
+	0x021F701, 0x021F701, 0x0220D01, 0x0000004, 0x0215D01, 0x021E101, 0x0215F01, 0x0219E01,
+	0x0000004, 0x021FF01, 0x0218401, 0x021FF01, 0x0218F01, 0x0000004, 0x021BC01, 0x021F701,
+	0x021C601, 0x021FF01, 0x0000004, 0x0219E01, 0x021B101, 0x0221301, 0x021F701, 0x0000004,
+	0x021C601, 0x021F701, 0x0222201, 0x0220D01, 0x0000004, 0x0221301, 0x021B101, 0x021F701,
+	0x021FF01, 0x0000003, 0x021BC01, 0x021F701, 0x0222101, 0x0000012, 0x021BC01, 0x021F701,
+	0x0222101, 0x0000901, 0x0215D01, 0x021F701, 0x021F701, 0x0220D01, 0x0000901, 0x021C601,
+	0x021F701, 0x0222201, 0x0220D01, 0x0000901, 0x0221301, 0x021B101, 0x021F701, 0x021FF01,
+	0x0000008, 0x0217A01, 0x021F701, 0x0000901, 0x0217A01, 0x021F701, 0x0215D01, 0x021F701,
+	0x0220D01, 0x0000004, 0x0219E01, 0x0222301, 0x0215D01, 0x021F701, 0x0000002, 0x021F701,
+	0x0215001, 0x0000002, 0x021F701, 0x0215101, 0x0000002, 0x021F701, 0x0215501, 0x0000002,
+	0x021F701, 0x0215D01, 0x0000001, 0x1FFFD01, 0x0000001, 0x00000F8, 0x0000002, 0x054C101,
+	0x00000F9, 0x0000002, 0x054C201, 0x00000F9, 0x0000002, 0x054C301, 0x00000F9, 0x0000002,
+	0x054C401, 0x00000F9, 0x0000002, 0x054C501, 0x00000F9, 0x0000002, 0x054C601, 0x00000F9,
+	0x0000002, 0x054C701, 0x00000F9, 0x0000002, 0x054C701, 0x00000FA, 0x0000002, 0x054C801,
+	0x00000F9, 0x0000002, 0x054C901, 0x00000F9, 0x0000002, 0x054CA01, 0x00000F9, 0x0000002,
+	0x054CA01, 0x00000FA, 0x0000002, 0x054CB01, 0x00000F9, 0x0000002, 0x054CB01, 0x00000FA,
+	0x0000002, 0x054CC01, 0x00000F9, 0x0000002, 0x054CC01, 0x00000FA, 0x0000002, 0x054CD01,
+	0x00000F9, 0x0000002, 0x054CE01, 0x00000F9, 0x0000002, 0x054CF01, 0x00000F9, 0x0000002,
+	0x054D001, 0x00000FA, 0x0000002, 0x054D001, 0x00000FB, 0x0000002, 0x054D101, 0x00000F9,
+	0x0000002, 0x054D201, 0x00000F9, 0x0000002, 0x054D301, 0x00000F9, 0x0000002, 0x054D401,
+	0x00000F9, 0x0000002, 0x054D401, 0x00000FA, 0x0000002, 0x054D501, 0x00000F9, 0x0000002,
+	0x054D501, 0x00000FA, 0x0000002, 0x054D601, 0x00000F9, 0x0000002, 0x054D701, 0x00000F9,
+	0x0000002, 0x054D001, 0x00000F9, 0x0000001, 0x00000AE, 0x0000001, 0x00000AF, 0x0000001,
+	0x00000B0, 0x0000002, 0x04B6401, 0x00000FA, 0x0000002, 0x04AAD01, 0x00000F9, 0x0000002,
+	0x0377701, 0x00000F9, 0x0000002, 0x0377901, 0x00000F9, 0x0000002, 0x0377C01, 0x00000F9,
+	0x0000002, 0x0377D01, 0x00000F9, 0x0000002, 0x0377E01, 0x00000F9, 0x0000002, 0x0377F01,
+	0x00000F9, 0x0000002, 0x0378001, 0x00000F9, 0x0000002, 0x0378101, 0x00000F9, 0x0000002,
+	0x0378301, 0x00000F9, 0x0000002, 0x0378401, 0x00000F9, 0x0000002, 0x0378501, 0x00000F9,
+	0x0000002, 0x0378601, 0x00000F9, 0x0000002, 0x0378701, 0x00000F9, 0x0000002, 0x0378801,
+	0x00000F9, 0x0000002, 0x0378D01, 0x00000F9, 0x0000002, 0x0378E01, 0x00000F9, 0x0000002,
+	0x0378F01, 0x00000F9, 0x0000002, 0x0379001, 0x00000F9, 0x0000002, 0x0379201, 0x00000F9,
+	0x0000002, 0x0379601, 0x00000F9, 0x0000002, 0x0379701, 0x00000F9, 0x0000002, 0x0379801,
+	0x00000F9, 0x0000002, 0x0379901, 0x00000F9, 0x0000002, 0x0379A01, 0x00000F9, 0x0000002,
+	0x0379E01, 0x00000F9, 0x0000002, 0x0379F01, 0x00000F9, 0x0000002, 0x037A001, 0x00000F9,
+	0x0000002, 0x037A101, 0x00000F9, 0x0000002, 0x0374E01, 0x00000F9, 0x0000002, 0x0375601,
+	0x00000F9, 0x0000002, 0x0375601, 0x00000FA, 0x0000002, 0x0375B01, 0x00000F9, 0x0000002,
+	0x0376501, 0x00000F9, 0x0000002, 0x0376601, 0x00000F9, 0x0000002, 0x0376601, 0x00000FA,
+	0x0000002, 0x0376901, 0x00000F9, 0x0000002, 0x0377001, 0x00000F9, 0x0000002, 0x0377101,
+	0x00000F9, 0x0000002, 0x04B8C01, 0x00000FA, 0x0000002, 0x04B8E01, 0x00000FA, 0x0000002,
+	0x04B9001, 0x00000FA, 0x0000002, 0x04B9301, 0x00000FA, 0x0000002, 0x04B8E01, 0x04B9101,
+	0x0000002, 0x04BA501, 0x00000FA, 0x0000002, 0x04B4D01, 0x04B5001, 0x0000002, 0x0284801,
+	0x00000A3, 0x0000002, 0x0284901, 0x00000A3, 0x0000002, 0x0285201, 0x00000A3, 0x0000001,
+	0x00000B1, 0x0000001, 0x00000B2, 0x0000002, 0x02A3401, 0x00000F9, 0x0000002, 0x02A3401,
+	0x00000FA, 0x0000002, 0x02A3501, 0x00000F9, 0x0000002, 0x02A3601, 0x00000F9, 0x0000002,
+	0x02A6401, 0x00000F9, 0x0000002, 0x02A6501, 0x00000F9, 0x0000002, 0x02B9401, 0x00000F9,
+	0x0000002, 0x02BA401, 0x00000F9, 0x0000002, 0x02B9701, 0x00000F9, 0x0000001, 0x00000B3,
+	0x0000001, 0x0000099, 0x0000001, 0x000009A, 0x0000001, 0x000009B, 0x0000001, 0x000009C,
+	0x0000001, 0x000009D, 0x0000001, 0x00000D7, 0x0000001, 0x00000D8, 0x0000001, 0x00000D9,
+	0x0000001, 0x00000DA, 0x0000001, 0x00000DB, 0x0000001, 0x00000DC, 0x0000001, 0x00000DD,
+	0x0000002, 0x01D9901, 0x00000F9, 0x0000002, 0x01D9A01, 0x00000F9, 0x0000002, 0x01D9B01,
+	0x00000F9, 0x0000001, 0x00000E8, 0x0000001, 0x00000E9, 0x0000001, 0x00000DE, 0x0000001,
+	0x00000DF, 0x0000001, 0x00000E0, 0x0000001, 0x00000E1, 0x0000001, 0x000009E, 0x0000001,
+	0x00000A0, 0x0000001, 0x00000A1, 0x0000001, 0x00000A2, 0x0000001, 0x000009F, 0x0000002,
+	0x01D9C01, 0x00000F9, 0x0000002, 0x01D9D01, 0x00000F9, 0x0000002, 0x01D9E01, 0x00000F9,
+	0x0000002, 0x01D9F01, 0x00000F9, 0x0000002, 0x01DA001, 0x00000F9, 0x0000002, 0x01DA101,
+	0x00000F9, 0x0000002, 0x01D9801, 0x0007E01, 0x0000002, 0x01D9801, 0x0002301, 0x0000002,
+	0x01D9901, 0x0002301, 0x0000002, 0x01D9A01, 0x0002301, 0x0000002, 0x01D9B01, 0x0002301,
+	0x0000002, 0x01D9C01, 0x0002301, 0x0000002, 0x01D9D01, 0x0002301, 0x0000002, 0x01D9E01,
+	0x0002301, 0x0000002, 0x01D9F01, 0x0002301, 0x0000002, 0x01DA001, 0x0002301, 0x0000002,
+	0x01DA101, 0x0002301, 0x0000003, 0x0018A01, 0x01EA001, 0x0018B01, 0x0000002, 0x01EDC01,
+	0x01EF101, 0x0000002, 0x01DFD01, 0x01ED301, 0x0000002, 0x01EA001, 0x01DC401, 0x0000002,
+	0x01EA001, 0x01EA001, 0x0000003, 0x01E6F01, 0x01E6F01, 0x01ED301, 0x0000002, 0x01EDC01,
+	0x01DBB01, 0x0000002, 0x01E3A01, 0x01DBB01, 0x0000002, 0x01E3A01, 0x01DC401, 0x0000002,
+	0x01E3A01, 0x01E8201, 0x0000002, 0x01E0901, 0x01DBB01, 0x0000002, 0x01EA001, 0x01DA201,
+	0x0000002, 0x01DA201, 0x01DB001, 0x0000002, 0x01DC401, 0x01E1501, 0x0000002, 0x01DBB01,
+	0x01E2501, 0x0000004, 0x01DBB01, 0x01E5201, 0x01E5201, 0x01E2501, 0x0000004, 0x01DE801,
+	0x01E8201, 0x01DD101, 0x01DD101, 0x0000002, 0x01E0901, 0x01DC401, 0x0000003, 0x01E4301,
+	0x01DD101, 0x01EDC01, 0x0000002, 0x01E4301, 0x01DF101, 0x0000002, 0x01E5201, 0x01E1C01,
+	0x0000003, 0x01EA001, 0x01E5201, 0x01EA001, 0x0000003, 0x01EBB01, 0x01E6F01, 0x0006701,
+	0x0000002, 0x01ED301, 0x01EA001, 0x0000002, 0x01D9B01, 0x01DC401, 0x0000007, 0x01D9A01,
+	0x01E4301, 0x01DC401, 0x0000901, 0x01EA001, 0x01DBB01, 0x01E8201, 0x0000002, 0x01D9A01,
+	0x01E1C01, 0x0000002, 0x01D9C01, 0x01E1C01, 0x0000002, 0x01DA001, 0x01E1C01, 0x0000003,
+	0x01D9D01, 0x0007E01, 0x01D9901, 0x0000003, 0x01D9F01, 0x0007E01, 0x01D9901, 0x0000004,
+	0x01D9A01, 0x01D9A01, 0x0007E01, 0x01D9A01, 0x0000003, 0x01D9E01, 0x01D9801, 0x01E6F01,
+	0x0000004, 0x01D9901, 0x01D9A01, 0x01D9801, 0x01E6F01, 0x0000002, 0x01DFD01, 0x01DBB01,
+	0x0000003, 0x01DFD01, 0x01DC401, 0x01E8201, 0x0000006, 0x01DFD01, 0x01E0901, 0x0000901,
+	0x01E8201, 0x01DD101, 0x01EA001, 0x0000008, 0x01E2501, 0x01E5201, 0x01EA001, 0x01EA001,
+	0x01E2501, 0x01DD101, 0x01EA001, 0x01EA001, 0x0000003, 0x01EA001, 0x01DFD01, 0x01ED301,
+	0x0000003, 0x01EBB01, 0x01DFD01, 0x01DC401, 0x0000003, 0x01ED301, 0x01E5201, 0x01DC401,
+	0x0000002, 0x03DE301, 0x03DCB01, 0x0000002, 0x03DCF01, 0x03DCF01, 0x0000002, 0x1FB4001,
+	0x1DB5700, 0x0000002, 0x1FB4001, 0x1D3CC00, 0x0000002, 0x1FB4001, 0x1D91A00, 0x0000002,
+	0x1FB4101, 0x189E300, 0x0000002, 0x1FB4001, 0x1CEA400, 0x0000002, 0x1FB4001, 0x1E62000,
+	0x0000002, 0x1FB4001, 0x1F12100, 0x0000002, 0x1FB4001, 0x1D24D00, 0x0000002, 0x1FB4001,
+	0x1DF8C00, 0x0000002, 0x1FB4001, 0x1D18D00, 0x0000002, 0x1FB4001, 0x1E5B000, 0x0000002,
+	0x1FB4001, 0x1D21D00, 0x0000002, 0x1FB4001, 0x1FD4200, 0x0000002, 0x1FB4101, 0x18CA900,
+	0x0000002, 0x1FB4001, 0x1D8F000, 0x0000002, 0x1FB4001, 0x1D43900, 0x0000002, 0x1FB4001,
+	0x1EF1400, 0x0000002, 0x1FB4001, 0x1E29500, 0x0000002, 0x1FB4001, 0x1E35500, 0x0000002,
+	0x1FB4101, 0x1904A00, 0x0000002, 0x1FB4001, 0x1E30700, 0x0000002, 0x1FB4001, 0x1E25300,
+	0x0000002, 0x1FB4001, 0x1F98100, 0x0000002, 0x1FB4001, 0x1FA7A00, 0x0000002, 0x1FB4001,
+	0x1D40800, 0x0000002, 0x1FB4001, 0x1EE8000, 0x0000002, 0x1FB4001, 0x1F53300, 0x0000002,
+	0x1FB4001, 0x1D27200, 0x0000002, 0x1FB4001, 0x1D5B600, 0x0000002, 0x1FB4101, 0x1914D00,
+	0x0000004, 0x0018A01, 0x1FB4001, 0x1E72C00, 0x0018B01, 0x0000004, 0x0018A01, 0x1FB4001,
+	0x1CE0900, 0x0018B01, 0x0000004, 0x0018A01, 0x1FB4001, 0x1CE8C00, 0x0018B01, 0x0000004,
+	0x0018A01, 0x1FB4001, 0x1DB8900, 0x0018B01, 0x0000004, 0x0018A01, 0x1FB4001, 0x1F0B900,
+	0x0018B01, 0x0000004, 0x0018A01, 0x1FB4001, 0x1E25300, 0x0018B01, 0x0000004, 0x0018A01,
+	0x1FB4001, 0x1F6D700, 0x0018B01, 0x0000004, 0x0018A01, 0x1FB4001, 0x1D2DD00, 0x0018B01,
+	0x0000004, 0x0018A01, 0x1FB4001, 0x1E55700, 0x0018B01, 0x0000002, 0x1FB4001, 0x1DF9700,
+	0x0000002, 0x1FB4001, 0x1D3EF00, 0x0000002, 0x1FB4001, 0x1CE3D00, 0x0000002, 0x1FB4001,
+	0x1CE3800, 0x0000002, 0x1FB4001, 0x1CE4100, 0x0000002, 0x1FB8401, 0x1812200, 0x0000002,
+	0x1FB4001, 0x1CF6000, 0x0000002, 0x1FB4001, 0x1CFBB00, 0x0000002, 0x1FB4001, 0x1D00200,
+	0x0000002, 0x1FB4001, 0x1D07A00, 0x0000002, 0x1FB4001, 0x1D09900, 0x0000002, 0x1FB4001,
+	0x1D0CF00, 0x0000002, 0x1FB8001, 0x1B49E00, 0x0000002, 0x1FB8401, 0x1863A00, 0x0000002,
+	0x1FB4001, 0x1D15400, 0x0000002, 0x1FB4001, 0x1D16400, 0x0000002, 0x1FB4001, 0x1D17700,
+	0x0000002, 0x1FB8401, 0x1851C00, 0x0000002, 0x1FB8001, 0x1B4B900, 0x0000002, 0x1FB4001,
+	0x1D16700, 0x0000002, 0x1FB8401, 0x1854B00, 0x0000002, 0x1FB4001, 0x1D19700, 0x0000002,
+	0x1FB4001, 0x1D1A400, 0x0000002, 0x1FB4001, 0x1CECC00, 0x0000002, 0x1FB4001, 0x1D1AC00,
+	0x0000002, 0x1FB8501, 0x191DF00, 0x0000002, 0x1FB4001, 0x1D20300, 0x0000002, 0x1FB8001,
+	0x1B4DF00, 0x0000002, 0x1FB4001, 0x1D23B00, 0x0000002, 0x1FB4001, 0x1D24600, 0x0000002,
+	0x1FB4001, 0x1D27700, 0x0000002, 0x1FB8001, 0x1B51500, 0x0000002, 0x1FB4001, 0x1D30500,
+	0x0000002, 0x1FB4001, 0x1D30600, 0x0000002, 0x1FB4001, 0x1D34900, 0x0000002, 0x1FB4001,
+	0x1D35A00, 0x0000002, 0x1FB4001, 0x1D37300, 0x0000002, 0x1FB4001, 0x1D37D00, 0x0000002,
+	0x1FB4001, 0x1D37F00, 0x0000002, 0x1FB8401, 0x18A2C00, 0x0000002, 0x1FB4001, 0x1F07000,
+	0x0000002, 0x1FB4001, 0x1D3CA00, 0x0000002, 0x1FB4001, 0x1D3DF00, 0x0000002, 0x1FB8401,
+	0x18B6300, 0x0000002, 0x1FB4001, 0x1D3EB00, 0x0000002, 0x1FB4001, 0x1D3F100, 0x0000002,
+	0x1FB4001, 0x1D40600, 0x0000002, 0x1FB4001, 0x1D49E00, 0x0000002, 0x1FB4001, 0x1D43800,
+	0x0000002, 0x1FB4001, 0x1D44800, 0x0000002, 0x1FB4001, 0x1D46800, 0x0000002, 0x1FB4001,
+	0x1D4A200, 0x0000002, 0x1FB4001, 0x1D4F600, 0x0000002, 0x1FB4001, 0x1D51000, 0x0000002,
+	0x1FB4001, 0x1D55300, 0x0000002, 0x1FB4001, 0x1D56300, 0x0000002, 0x1FB4001, 0x1D58400,
+	0x0000002, 0x1FB4001, 0x1D5AB00, 0x0000002, 0x1FB4001, 0x1D5B300, 0x0000002, 0x1FB4001,
+	0x1D5C200, 0x0000002, 0x1FB4001, 0x1D71600, 0x0000002, 0x1FB4001, 0x1D71700, 0x0000002,
+	0x1FB4001, 0x1D65100, 0x0000002, 0x1FB4001, 0x1D67400, 0x0000002, 0x1FB4001, 0x1D8EE00,
+	0x0000002, 0x1FB4001, 0x1D7CE00, 0x0000002, 0x1FB4001, 0x1D7F400, 0x0000002, 0x1FB4001,
+	0x1D80D00, 0x0000002, 0x1FB4001, 0x1D78B00, 0x0000002, 0x1FB4001, 0x1D83200, 0x0000002,
+	0x1FB4001, 0x1D83100, 0x0000002, 0x1FB4001, 0x1D8AC00, 0x0000002, 0x1FB8401, 0x194E400,
+	0x0000002, 0x1FB4001, 0x1D8F200, 0x0000002, 0x1FB4001, 0x1D8F700, 0x0000002, 0x1FB4001,
+	0x1D90600, 0x0000002, 0x1FB4001, 0x1D92200, 0x0000002, 0x1FB4001, 0x1D96200, 0x0000002,
+	0x1FB8401, 0x196A800, 0x0000002, 0x1FB8401, 0x196EA00, 0x0000002, 0x1FB4001, 0x1D9EC00,
+	0x0000002, 0x1FB4001, 0x1DA1B00, 0x0000002, 0x1FB4001, 0x1DA2700, 0x0000002, 0x1FB4001,
+	0x1D9D800, 0x0000002, 0x1FB4001, 0x1DA6600, 0x0000002, 0x1FB8001, 0x1B6EE00, 0x0000002,
+	0x1FB8001, 0x1B6FC00, 0x0000002, 0x1FB4001, 0x1DB0800, 0x0000002, 0x1FB4001, 0x1DB3E00,
+	0x0000002, 0x1FB8401, 0x199C800, 0x0000002, 0x1FB4001, 0x1DBC300, 0x0000002, 0x1FB4001,
+	0x1DBD800, 0x0000002, 0x1FB4001, 0x1DBF300, 0x0000002, 0x1FB8401, 0x19B1800, 0x0000002,
+	0x1FB4001, 0x1DBFF00, 0x0000002, 0x1FB4001, 0x1DC0600, 0x0000002, 0x1FB4001, 0x1DF5300,
+	0x0000002, 0x1FB8001, 0x1B78100, 0x0000002, 0x1FB4001, 0x1DC6000, 0x0000002, 0x1FB4001,
+	0x1DCC000, 0x0000002, 0x1FB4001, 0x1DC8D00, 0x0000002, 0x1FB8401, 0x19DE400, 0x0000002,
+	0x1FB4001, 0x1DD4300, 0x0000002, 0x1FB8401, 0x19DE600, 0x0000002, 0x1FB4001, 0x1DD6E00,
+	0x0000002, 0x1FB4001, 0x1DD6B00, 0x0000002, 0x1FB4001, 0x1DD7C00, 0x0000002, 0x1FB4001,
+	0x1DDE100, 0x0000002, 0x1FB4001, 0x1DDE200, 0x0000002, 0x1FB8001, 0x1B82F00, 0x0000002,
+	0x1FB4001, 0x1DDFD00, 0x0000002, 0x1FB4001, 0x1DE2800, 0x0000002, 0x1FB4001, 0x1DE3D00,
+	0x0000002, 0x1FB4001, 0x1DE6900, 0x0000002, 0x1FB8001, 0x1B86200, 0x0000002, 0x1FB8401,
+	0x1A18300, 0x0000002, 0x1FB8001, 0x1B87C00, 0x0000002, 0x1FB4001, 0x1DEB000, 0x0000002,
+	0x1FB4001, 0x1DEB300, 0x0000002, 0x1FB4001, 0x1DEB600, 0x0000002, 0x1FB8501, 0x1A39200,
+	0x0000002, 0x1FB8401, 0x1A33100, 0x0000002, 0x1FB4101, 0x1820100, 0x0000002, 0x1FB4001,
+	0x1DF2200, 0x0000002, 0x1FB8001, 0x1B8C700, 0x0000002, 0x1FB8401, 0x1B2B800, 0x0000002,
+	0x1FB8401, 0x1E1DA00, 0x0000002, 0x1FB4001, 0x1DF6200, 0x0000002, 0x1FB4001, 0x1DF6B00,
+	0x0000002, 0x1FB8001, 0x1B8E300, 0x0000002, 0x1FB4001, 0x1DF9A00, 0x0000002, 0x1FB4001,
+	0x1DFCD00, 0x0000002, 0x1FB4001, 0x1DFD700, 0x0000002, 0x1FB4001, 0x1DFF900, 0x0000002,
+	0x1FB4001, 0x1E08100, 0x0000002, 0x1FB8001, 0x1B93A00, 0x0000002, 0x1FB8001, 0x1B91C00,
+	0x0000002, 0x1FB8401, 0x1A6D400, 0x0000002, 0x1FB4001, 0x1E0C700, 0x0000002, 0x1FB4001,
+	0x1E14800, 0x0000002, 0x1FB4001, 0x1E14C00, 0x0000002, 0x1FB4001, 0x1E17A00, 0x0000002,
+	0x1FB4001, 0x1E1B200, 0x0000002, 0x1FB4001, 0x1E1A400, 0x0000002, 0x1FB4001, 0x1E1AF00,
+	0x0000002, 0x1FB4001, 0x1E1DE00, 0x0000002, 0x1FB4001, 0x1E21000, 0x0000002, 0x1FB4001,
+	0x1E21B00, 0x0000002, 0x1FB4001, 0x1E25D00, 0x0000002, 0x1FB4001, 0x1E2B100, 0x0000002,
+	0x1FB4001, 0x1E2D400, 0x0000002, 0x1FB4001, 0x1E35000, 0x0000002, 0x1FB8401, 0x1AB0C00,
+	0x0000002, 0x1FB4001, 0x1E33D00, 0x0000002, 0x1FB4001, 0x1E2FC00, 0x0000002, 0x1FB4001,
+	0x1E36800, 0x0000002, 0x1FB4001, 0x1E38300, 0x0000002, 0x1FB4001, 0x1E3E400, 0x0000002,
+	0x1FB8401, 0x1ABF100, 0x0000002, 0x1FB4001, 0x1E42200, 0x0000002, 0x1FB4001, 0x1E3C500,
+	0x0000002, 0x1FB4001, 0x1E3A900, 0x0000002, 0x1FB8001, 0x1BA2E00, 0x0000002, 0x1FB4001,
+	0x1E46900, 0x0000002, 0x1FB4001, 0x1E47E00, 0x0000002, 0x1FB4001, 0x1E49D00, 0x0000002,
+	0x1FB4001, 0x1E47700, 0x0000002, 0x1FB8001, 0x1BA6C00, 0x0000002, 0x1FB4001, 0x1E56C00,
+	0x0000002, 0x1FB8401, 0x1B00A00, 0x0000002, 0x1FB4001, 0x1E5E300, 0x0000002, 0x1FB4001,
+	0x1E6F800, 0x0000002, 0x1FB4001, 0x1E64900, 0x0000002, 0x1FB8001, 0x1BB1900, 0x0000002,
+	0x1FB8001, 0x1BB0800, 0x0000002, 0x1FB8001, 0x1BAE400, 0x0000002, 0x1FB4001, 0x1D19200,
+	0x0000002, 0x1FB4001, 0x1D19500, 0x0000002, 0x1FB4001, 0x1E70000, 0x0000002, 0x1FB4001,
+	0x1E69C00, 0x0000002, 0x1FB4101, 0x180AD00, 0x0000002, 0x1FB8001, 0x1C3D900, 0x0000002,
+	0x1FB4001, 0x1E72100, 0x0000002, 0x1FB4001, 0x1E75E00, 0x0000002, 0x1FB4001, 0x1E75300,
+	0x0000002, 0x1FB8401, 0x1B3C300, 0x0000002, 0x1FB8001, 0x1BB4900, 0x0000002, 0x1FB4001,
+	0x1E7FA00, 0x0000002, 0x1FB4001, 0x1E78500, 0x0000002, 0x1FB4001, 0x1E85200, 0x0000002,
+	0x1FB8401, 0x1B46D00, 0x0000002, 0x1FB4001, 0x1E88E00, 0x0000002, 0x1FB4001, 0x1E81F00,
+	0x0000002, 0x1FB4001, 0x1E91400, 0x0000002, 0x1FB4001, 0x1E94200, 0x0000002, 0x1FB4001,
+	0x1E9A300, 0x0000002, 0x1FB4001, 0x1E9EA00, 0x0000002, 0x1FB4001, 0x1EAA800, 0x0000002,
+	0x1FB8401, 0x1B6A300, 0x0000002, 0x1FB4001, 0x1EADB00, 0x0000002, 0x1FB8001, 0x1BC1800,
+	0x0000002, 0x1FB4001, 0x1EB2100, 0x0000002, 0x1FB8401, 0x1B8A700, 0x0000002, 0x1FB4001,
+	0x1EB5400, 0x0000002, 0x1FB8001, 0x1BC4E00, 0x0000002, 0x1FB4001, 0x1EB7200, 0x0000002,
+	0x1FB4001, 0x1EB9F00, 0x0000002, 0x1FB4001, 0x1EBBB00, 0x0000002, 0x1FB8401, 0x1BA8D00,
+	0x0000002, 0x1FB8401, 0x19D0B00, 0x0000002, 0x1FB8401, 0x1BAFA00, 0x0000002, 0x1FB4001,
+	0x1EC4E00, 0x0000002, 0x1FB8401, 0x1BCBC00, 0x0000002, 0x1FB4001, 0x1ECBF00, 0x0000002,
+	0x1FB4001, 0x1ECCD00, 0x0000002, 0x1FB4001, 0x1EC6700, 0x0000002, 0x1FB4001, 0x1ED1600,
+	0x0000002, 0x1FB4001, 0x1ED3E00, 0x0000002, 0x1FB4001, 0x1ED6900, 0x0000002, 0x1FB4001,
+	0x1ED7800, 0x0000002, 0x1FB4001, 0x1ED8500, 0x0000002, 0x1FB8401, 0x1BD1E00, 0x0000002,
+	0x1FB4001, 0x1ED3400, 0x0000002, 0x1FB4001, 0x1EE2F00, 0x0000002, 0x1FB4001, 0x1EE6E00,
+	0x0000002, 0x1FB8001, 0x1BD3300, 0x0000002, 0x1FB4001, 0x1EEC700, 0x0000002, 0x1FB8401,
+	0x1BED100, 0x0000002, 0x1FB4001, 0x1EDF900, 0x0000002, 0x1FB4001, 0x1EF6E00, 0x0000002,
+	0x1FB8401, 0x1BF5E00, 0x0000002, 0x1FB8401, 0x1BF8E00, 0x0000002, 0x1FB4001, 0x1EFC600,
+	0x0000002, 0x1FB4001, 0x1F03900, 0x0000002, 0x1FB4001, 0x1F01B00, 0x0000002, 0x1FB8001,
+	0x1BD9600, 0x0000002, 0x1FB4001, 0x1F04A00, 0x0000002, 0x1FB4001, 0x1F07D00, 0x0000002,
+	0x1FB4001, 0x1F07700, 0x0000002, 0x1FB4001, 0x1F0AD00, 0x0000002, 0x1FB8401, 0x1852500,
+	0x0000002, 0x1FB4001, 0x1F14500, 0x0000002, 0x1FB8401, 0x1C26300, 0x0000002, 0x1FB4001,
+	0x1F19C00, 0x0000002, 0x1FB8401, 0x1C3AB00, 0x0000002, 0x1FB4001, 0x1F22800, 0x0000002,
+	0x1FB4001, 0x1F25000, 0x0000002, 0x1FB8401, 0x1C60800, 0x0000002, 0x1FB4001, 0x1F28000,
+	0x0000002, 0x1FB4001, 0x1F29500, 0x0000002, 0x1FB8401, 0x1C73500, 0x0000002, 0x1FB8401,
+	0x1C81400, 0x0000002, 0x1FB4001, 0x1F37A00, 0x0000002, 0x1FB4001, 0x1F38B00, 0x0000002,
+	0x1FB8001, 0x1BEAC00, 0x0000002, 0x1FB4001, 0x1F3A500, 0x0000002, 0x1FB8001, 0x1BEB800,
+	0x0000002, 0x1FB4001, 0x1F44700, 0x0000002, 0x1FB4001, 0x1F45C00, 0x0000002, 0x1FB4001,
+	0x1F48500, 0x0000002, 0x1FB4001, 0x1F4CA00, 0x0000002, 0x1FB8001, 0x1BF1B00, 0x0000002,
+	0x1FB4001, 0x1F52400, 0x0000002, 0x1FB8401, 0x1CC3600, 0x0000002, 0x1FB4001, 0x1F53E00,
+	0x0000002, 0x1FB8401, 0x1CC9200, 0x0000002, 0x1FB8401, 0x1A19F00, 0x0000002, 0x1FB4001,
+	0x1F61000, 0x0000002, 0x1FB8401, 0x1CFA100, 0x0000002, 0x1FB8401, 0x1CFB800, 0x0000002,
+	0x1FB8401, 0x1D04400, 0x0000002, 0x1FB8001, 0x1BFFC00, 0x0000002, 0x1FB8001, 0x1C00800,
+	0x0000002, 0x1FB8401, 0x1D0F300, 0x0000002, 0x1FB8401, 0x1D0F200, 0x0000002, 0x1FB8401,
+	0x1D11900, 0x0000002, 0x1FB8401, 0x1D13300, 0x0000002, 0x1FB4001, 0x1F71E00, 0x0000002,
+	0x1FB4001, 0x1F71F00, 0x0000002, 0x1FB4001, 0x1F78B00, 0x0000002, 0x1FB8001, 0x1C04600,
+	0x0000002, 0x1FB8001, 0x1C09600, 0x0000002, 0x1FB8401, 0x1D41D00, 0x0000002, 0x1FB4001,
+	0x1F84E00, 0x0000002, 0x1FB8001, 0x1C0E300, 0x0000002, 0x1FB8401, 0x1D62600, 0x0000002,
+	0x1FB8401, 0x1D69A00, 0x0000002, 0x1FB8401, 0x1D6C500, 0x0000002, 0x1FB4001, 0x1F9EB00,
+	0x0000002, 0x1FB8001, 0x1C12F00, 0x0000002, 0x1FB4001, 0x1FA4A00, 0x0000002, 0x1FB4001,
+	0x1FA4F00, 0x0000002, 0x1FB8401, 0x1D97C00, 0x0000002, 0x1FB8401, 0x1DAA700, 0x0000002,
+	0x1FB4001, 0x1FAEE00, 0x0000002, 0x1FB8001, 0x1C20200, 0x0000002, 0x1FB8401, 0x1DBAB00,
+	0x0000002, 0x1FB4001, 0x1FBC600, 0x0000002, 0x1FB4001, 0x1FBC900, 0x0000002, 0x1FB8001,
+	0x1C22700, 0x0000002, 0x1FB8401, 0x1DC8000, 0x0000002, 0x1FB4001, 0x1FCD200, 0x0000002,
+	0x1FB8001, 0x1C2A000, 0x0000002, 0x1FB4001, 0x1FCE800, 0x0000002, 0x1FB4001, 0x1FCE300,
+	0x0000002, 0x1FB4001, 0x1FD0000, 0x0000002, 0x1FB8401, 0x1DF8600, 0x0000002, 0x1FB4001,
+	0x1FD6300, 0x0000002, 0x1FB8001, 0x1C30100, 0x0000002, 0x1FB4001, 0x1FDC700, 0x0000002,
+	0x1FB4001, 0x1FE0200, 0x0000002, 0x1FB4001, 0x1FE4500, 0x0000002, 0x1FB8001, 0x1C33400,
+	0x0000002, 0x1FB8401, 0x1E22800, 0x0000002, 0x1FB8401, 0x1E24700, 0x0000002, 0x1FB8001,
+	0x1C35900, 0x0000002, 0x1FB8401, 0x1E2D900, 0x0000002, 0x1FB4001, 0x1FF7A00, 0x0000002,
+	0x1FB8401, 0x1E33E00, 0x0000002, 0x1FB4001, 0x1FF9500, 0x0000002, 0x1FB4001, 0x1FFFA00,
+	0x0000002, 0x1FB8401, 0x1E4DA00, 0x0000002, 0x1FB8401, 0x1E52300, 0x0000002, 0x1FB4101,
+	0x1806000, 0x0000002, 0x1FB8401, 0x1E5A800, 0x0000002, 0x1FB4101, 0x1807000, 0x0000002,
+	0x1FB8401, 0x1B35F00, 0x0000002, 0x1FB8001, 0x1C3D500, 0x0000002, 0x1FB4101, 0x180B200,
+	0x0000002, 0x1FB4101, 0x1810300, 0x0000002, 0x1FB8001, 0x1C40B00, 0x0000002, 0x1FB4101,
+	0x1813E00, 0x0000002, 0x1FB4001, 0x1DAB500, 0x0000002, 0x1FB8401, 0x1E7A700, 0x0000002,
+	0x1FB8401, 0x1E7B500, 0x0000002, 0x1FB8401, 0x1B39300, 0x0000002, 0x1FB8401, 0x1B39C00,
+	0x0000002, 0x1FB4101, 0x1820400, 0x0000002, 0x1FB4101, 0x18F9E00, 0x0000002, 0x1FB8001,
+	0x1C46B00, 0x0000002, 0x1FB4101, 0x1829100, 0x0000002, 0x1FB4101, 0x1828B00, 0x0000002,
+	0x1FB4101, 0x1829D00, 0x0000002, 0x1FB4001, 0x1D2B300, 0x0000002, 0x1FB4101, 0x182B100,
+	0x0000002, 0x1FB4101, 0x182B300, 0x0000002, 0x1FB4101, 0x182BD00, 0x0000002, 0x1FB4101,
+	0x182E600, 0x0000002, 0x1FB8401, 0x1EB3C00, 0x0000002, 0x1FB4101, 0x1831D00, 0x0000002,
+	0x1FB4101, 0x1836300, 0x0000002, 0x1FB4101, 0x183AD00, 0x0000002, 0x1FB4101, 0x1832300,
+	0x0000002, 0x1FB4101, 0x183BD00, 0x0000002, 0x1FB4101, 0x183E700, 0x0000002, 0x1FB4101,
+	0x1835300, 0x0000002, 0x1FB4101, 0x183CA00, 0x0000002, 0x1FB4101, 0x183CC00, 0x0000002,
+	0x1FB4101, 0x183DC00, 0x0000002, 0x1FB8401, 0x1EC3600, 0x0000002, 0x1FB8401, 0x1ED6B00,
+	0x0000002, 0x1FB8401, 0x1ECD500, 0x0000002, 0x1FB8001, 0x1C52B00, 0x0000002, 0x1FB4101,
+	0x184F100, 0x0000002, 0x1FB4101, 0x184F300, 0x0000002, 0x1FB4101, 0x1851600, 0x0000002,
+	0x1FB8401, 0x1F3CA00, 0x0000002, 0x1FB4101, 0x1856400, 0x0000002, 0x1FB8401, 0x1EF2C00,
+	0x0000002, 0x1FB8001, 0x1C55D00, 0x0000002, 0x1FB8001, 0x1C56100, 0x0000002, 0x1FB8401,
+	0x1EFB100, 0x0000002, 0x1FB8401, 0x1F0D200, 0x0000002, 0x1FB8001, 0x1C56B00, 0x0000002,
+	0x1FB4101, 0x1865000, 0x0000002, 0x1FB4101, 0x1866700, 0x0000002, 0x1FB4101, 0x1866900,
+	0x0000002, 0x1FB4101, 0x186A900, 0x0000002, 0x1FB4101, 0x1868800, 0x0000002, 0x1FB4101,
+	0x1870E00, 0x0000002, 0x1FB4101, 0x186E200, 0x0000002, 0x1FB4101, 0x1872800, 0x0000002,
+	0x1FB4101, 0x1876B00, 0x0000002, 0x1FB4101, 0x1878600, 0x0000002, 0x1FB8001, 0x1C5D700,
+	0x0000002, 0x1FB4101, 0x187E100, 0x0000002, 0x1FB4101, 0x1880100, 0x0000002, 0x1FB8001,
+	0x1C5F900, 0x0000002, 0x1FB4101, 0x1886000, 0x0000002, 0x1FB8401, 0x1F66700, 0x0000002,
+	0x1FB4101, 0x188D700, 0x0000002, 0x1FB4101, 0x188DE00, 0x0000002, 0x1FB8001, 0x1C63500,
+	0x0000002, 0x1FB4101, 0x188FA00, 0x0000002, 0x1FB8001, 0x1B4BB00, 0x0000002, 0x1FB8401,
+	0x1F8AE00, 0x0000002, 0x1FB8401, 0x1F96600, 0x0000002, 0x1FB8001, 0x1C6BE00, 0x0000002,
+	0x1FB8001, 0x1C6C700, 0x0000002, 0x1FB4101, 0x18AA000, 0x0000002, 0x1FB8401, 0x1FCA800,
+	0x0000002, 0x1FB4101, 0x18CAB00, 0x0000002, 0x1FB4101, 0x18CC100, 0x0000002, 0x1FB4101,
+	0x18D1B00, 0x0000002, 0x1FB4101, 0x18D7700, 0x0000002, 0x1FB8401, 0x1FF2F00, 0x0000002,
+	0x1FB8401, 0x1880400, 0x0000002, 0x1FB4101, 0x18DCB00, 0x0000002, 0x1FB4101, 0x18DBC00,
+	0x0000002, 0x1FB4101, 0x18DF000, 0x0000002, 0x1FB8401, 0x188DE00, 0x0000002, 0x1FB4101,
+	0x18ED400, 0x0000002, 0x1FB8501, 0x185D200, 0x0000002, 0x1FB8501, 0x185ED00, 0x0000002,
+	0x1FB4101, 0x1909400, 0x0000002, 0x1FB4101, 0x190F100, 0x0000002, 0x1FB4101, 0x1911100,
+	0x0000002, 0x1FB8501, 0x1872E00, 0x0000002, 0x1FB4101, 0x1911B00, 0x0000002, 0x1FB4101,
+	0x1923800, 0x0000002, 0x1FB4101, 0x192D700, 0x0000002, 0x1FB4101, 0x192D800, 0x0000002,
+	0x1FB4101, 0x1927C00, 0x0000002, 0x1FB4101, 0x193F900, 0x0000002, 0x1FB4101, 0x1941500,
+	0x0000002, 0x1FB8501, 0x18BFA00, 0x0000002, 0x1FB4101, 0x1958B00, 0x0000002, 0x1FB8001,
+	0x1C99500, 0x0000002, 0x1FB4101, 0x195B700, 0x0000002, 0x1FB8501, 0x18D7700, 0x0000002,
+	0x1FB8001, 0x1C9E600, 0x0000002, 0x1FB4101, 0x196C300, 0x0000002, 0x1FB4001, 0x1DDB200,
+	0x0000002, 0x1FB4101, 0x1972300, 0x0000002, 0x1FB8501, 0x1914500, 0x0000002, 0x1FB8501,
+	0x1921A00, 0x0000002, 0x1FB8001, 0x1CA6E00, 0x0000002, 0x1FB8001, 0x1CA7600, 0x0000002,
+	0x1FB4101, 0x197E000, 0x0000002, 0x1FB8501, 0x1940A00, 0x0000002, 0x1FB8001, 0x1CAB200,
+	0x0000002, 0x1FB8501, 0x1949600, 0x0000002, 0x1FB4101, 0x1982900, 0x0000002, 0x1FB8501,
+	0x195B600, 0x0000002, 0x1FB4101, 0x198E200, 0x0000002, 0x1FB8001, 0x1CB3300, 0x0000002,
+	0x1FB4101, 0x1992900, 0x0000002, 0x1FB4101, 0x199A700, 0x0000002, 0x1FB4101, 0x199C200,
+	0x0000002, 0x1FB4101, 0x199FE00, 0x0000002, 0x1FB8001, 0x1CBCE00, 0x0000002, 0x1FB8501,
+	0x19B3000, 0x0000002, 0x1FB4101, 0x19C4000, 0x0000002, 0x1FB4101, 0x19CFD00, 0x0000002,
+	0x1FB8001, 0x1CCCE00, 0x0000002, 0x1FB8001, 0x1CCED00, 0x0000002, 0x1FB4101, 0x19D6700,
+	0x0000002, 0x1FB8501, 0x1A0CE00, 0x0000002, 0x1FB8001, 0x1CCF800, 0x0000002, 0x1FB8501,
+	0x1A10500, 0x0000002, 0x1FB8501, 0x1A20E00, 0x0000002, 0x1FB8501, 0x1A29100, 0x0000002,
+	0x1FB8001, 0x1CD5600, 0x0000002, 0x1FB4101, 0x19F0500, 0x0000002, 0x1FB4101, 0x19F0F00,
+	0x0000002, 0x1FB4101, 0x19F1600, 0x0000002, 0x1FB8501, 0x1A60000,
+};
+
+struct CollationRange {
+	char32_t first;
+	char32_t last;
+	uint32_t base;
+};
+
+// @implicitweights from allkeys.txt
+static constexpr CollationRange s_collationImplicitRanges[4] = {
+	{0x17000, 0x18AFF, 0xFB00},
+	{0x18D00, 0x18D8F, 0xFB00},
+	{0x1B170, 0x1B2FF, 0xFB01},
+	{0x18B00, 0x18CFF, 0xFB02},
+};
+
+// Unified_Ideograph property
+static constexpr CollationRange s_collationIdeographs[15] = {
+	{0x03400, 0x04DBF, 0},
+	{0x04E00, 0x09FFF, 0},
+	{0x0FA0E, 0x0FA0F, 0},
+	{0x0FA11, 0x0FA11, 0},
+	{0x0FA13, 0x0FA14, 0},
+	{0x0FA1F, 0x0FA1F, 0},
+	{0x0FA21, 0x0FA21, 0},
+	{0x0FA23, 0x0FA24, 0},
+	{0x0FA27, 0x0FA29, 0},
+	{0x20000, 0x2A6DF, 0},
+	{0x2A700, 0x2B738, 0},
+	{0x2B740, 0x2B81D, 0},
+	{0x2B820, 0x2CEA1, 0},
+	{0x2CEB0, 0x2EBE0, 0},
+	{0x30000, 0x3134A, 0},
+};
+
+// clang-format on
+
+} // namespace sprt::unicode::detail
+
+#endif // RUNTIME_CORE_INCLUDE___UNICODE_TABLES_H_
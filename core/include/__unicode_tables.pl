@@ -0,0 +1,606 @@
+#!/usr/bin/env perl
+
+# Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+# Generates __unicode_tables.h - case mapping and collation tables for runtime_core_unicode_case.cpp
+#
+# Case data is taken from the Unicode Character Database bundled with Perl (Unicode::UCD),
+# collation weights - from DUCET allkeys.txt, bundled with Unicode::Collate.
+#
+# Perl releases often bundle DUCET one version behind the UCD (e.g. Unicode 14.0 with
+# DUCET 13.0). Pass allkeys.txt of the UCD version to get aligned tables. With older DUCET,
+# characters, added in the newer UCD, are still case mapped and folded, but have no weights:
+# they get unassigned implicit weights (FBC0+) and are sorted after all assigned characters
+# in code point order. Case-insensitive equality is not affected, only their relative order.
+# Unified ideographs are not affected, their implicit weights are based on the UCD property.
+#
+# Usage: perl __unicode_tables.pl [allkeys.txt] > __unicode_tables.h
+
+use strict;
+use warnings;
+
+use Unicode::UCD qw(prop_invmap prop_invlist);
+
+my $MaxCp = 0x11_0000;
+
+my $allkeys = shift @ARGV;
+if (!defined $allkeys) {
+	for my $dir (@INC) {
+		if (-f "$dir/Unicode/Collate/allkeys.txt") {
+			$allkeys = "$dir/Unicode/Collate/allkeys.txt";
+			last;
+		}
+	}
+}
+die "allkeys.txt not found\n" unless defined $allkeys;
+
+# Returns hash of code point => [mapped code points] for the code points, that not mapped to itself
+sub load_map {
+	my ($prop) = @_;
+	my ($list, $map, $format, $default) = prop_invmap($prop);
+	die "Unexpected format $format for $prop\n" unless $format =~ /^al?$/ && $default eq '0';
+
+	my %ret;
+	for my $i (0 .. $#$list) {
+		my $start = $list->[$i];
+		my $end = $i < $#$list ? $list->[$i + 1] : $MaxCp;
+		my $value = $map->[$i];
+		if (ref $value) {
+			die "Multi-char range in $prop\n" unless $end == $start + 1;
+			$ret{$start} = [@$value];
+		} elsif ($value ne '0') {
+			for my $cp ($start .. $end - 1) {
+				$ret{$cp} = [$value + $cp - $start];
+			}
+		}
+	}
+	return \%ret;
+}
+
+sub load_set {
+	my @list = prop_invlist($_[0]);
+	my %ret;
+	for (my $i = 0; $i < @list; $i += 2) {
+		my $end = $i + 1 < @list ? $list[$i + 1] : $MaxCp;
+		$ret{$_} = 1 for $list[$i] .. $end - 1;
+	}
+	return \%ret;
+}
+
+sub load_ranges {
+	my @list = prop_invlist($_[0]);
+	my @ret;
+	for (my $i = 0; $i < @list; $i += 2) {
+		push @ret, [$list[$i], $list[$i + 1] - 1];
+	}
+	return @ret;
+}
+
+my $version = Unicode::UCD::UnicodeVersion();
+
+#
+# Case mapping
+#
+
+my %simple = (
+	lower => load_map('Simple_Lowercase_Mapping'),
+	upper => load_map('Simple_Uppercase_Mapping'),
+	title => load_map('Simple_Titlecase_Mapping'),
+	fold => load_map('Simple_Case_Folding'),
+);
+
+my %full = (
+	lower => load_map('Lowercase_Mapping'),
+	upper => load_map('Uppercase_Mapping'),
+	title => load_map('Titlecase_Mapping'),
+	fold => load_map('Case_Folding'),
+);
+
+my $cased = load_set('Cased');
+my $ignorable = load_set('Case_Ignorable');
+my $alpha = load_set('Alphabetic');
+my $digit = load_set('Nd');
+my $ideographic = load_set('Ideographic');
+
+my @kinds = qw(lower upper title fold);
+
+my %flagValues = (
+	Cased => 1,
+	CaseIgnorable => 2,
+	Word => 4,
+);
+
+my @specialChars = (0); # offset 0 is reserved for 'no mapping'
+my %specialOffsets;
+my @specials = ([0, 0, 0, 0]);
+my %specialIndexes;
+
+sub special_string {
+	my ($chars) = @_;
+	my $key = join(',', @$chars);
+	return $specialOffsets{$key} if exists $specialOffsets{$key};
+	for (@$chars) {
+		die "Special mapping outside of BMP\n" if $_ >= 0x1_0000;
+	}
+	my $offset = scalar @specialChars;
+	push @specialChars, scalar(@$chars), @$chars;
+	$specialOffsets{$key} = $offset;
+	return $offset;
+}
+
+my @records;
+my %recordIndexes;
+
+sub record_index {
+	my ($rec) = @_;
+	my $key = join(',', @$rec);
+	return $recordIndexes{$key} if exists $recordIndexes{$key};
+	push @records, $rec;
+	return $recordIndexes{$key} = $#records;
+}
+
+record_index([0, 0, 0, 0, 0, 0]);
+
+my @caseValues;
+for my $cp (0 .. $MaxCp - 1) {
+	my @rec;
+	for my $kind (@kinds) {
+		my $m = $simple{$kind}{$cp};
+		push @rec, $m ? $m->[0] - $cp : 0;
+	}
+
+	my $flags = 0;
+	$flags |= $flagValues{Cased} if $cased->{$cp};
+	$flags |= $flagValues{CaseIgnorable} if $ignorable->{$cp};
+	$flags |= $flagValues{Word}
+			if ($alpha->{$cp} || $digit->{$cp}) && !$ideographic->{$cp};
+	push @rec, $flags;
+
+	my $special = 0;
+	for my $i (0 .. $#kinds) {
+		my $m = $full{$kinds[$i]}{$cp};
+		if ($m && (@$m != 1 || $m->[0] != $cp + $rec[$i])) {
+			$special = 1;
+		}
+	}
+
+	if ($special) {
+		my @strings = map {
+			special_string($full{$_}{$cp} // [$cp])
+		} @kinds;
+		my $key = join(',', @strings);
+		if (!exists $specialIndexes{$key}) {
+			push @specials, \@strings;
+			$specialIndexes{$key} = $#specials;
+		}
+		$special = $specialIndexes{$key};
+	}
+	push @rec, $special;
+
+	$caseValues[$cp] = record_index(\@rec);
+}
+
+sub utf8_length {
+	my $ret = 0;
+	$ret += $_ < 0x80 ? 1 : $_ < 0x800 ? 2 : $_ < 0x1_0000 ? 3 : 4 for @_;
+	return $ret;
+}
+
+sub utf16_length {
+	my $ret = 0;
+	$ret += $_ < 0x1_0000 ? 1 : 2 for @_;
+	return $ret;
+}
+
+# Output buffer for the string mapping should be at least input length * growth
+my $maxChars = 1;
+my $utf8Growth = 1;
+my $utf16Growth = 1;
+for my $kind (@kinds) {
+	for my $cp (keys %{$full{$kind}}) {
+		my $m = $full{$kind}{$cp};
+		$maxChars = @$m if @$m > $maxChars;
+		my $g8 = int((utf8_length(@$m) + utf8_length($cp) - 1) / utf8_length($cp));
+		my $g16 = int((utf16_length(@$m) + utf16_length($cp) - 1) / utf16_length($cp));
+		$utf8Growth = $g8 if $g8 > $utf8Growth;
+		$utf16Growth = $g16 if $g16 > $utf16Growth;
+	}
+}
+
+die "Too many case records\n" if @records > 0xFFFF;
+die "Too many special mappings\n" if @specials > 0xFFFF || @specialChars > 0xFFFF;
+
+#
+# Collation (DUCET without contractions and tertiary weights)
+#
+
+my %ducet;
+my @implicitRanges;
+
+open my $keys, '<', $allkeys or die "Fail to open $allkeys: $!\n";
+my $ducetVersion = '';
+while (my $line = <$keys>) {
+	if ($line =~ /^\@version\s+(\S+)/) {
+		$ducetVersion = $1;
+		next;
+	}
+	if ($line =~ /^\@implicitweights\s+([0-9A-F]+)\.\.([0-9A-F]+);\s*([0-9A-F]+)/) {
+		push @implicitRanges, [hex($1), hex($2), hex($3)];
+		next;
+	}
+	$line =~ s/#.*//;
+	next unless $line =~ /^([0-9A-F ]+);\s*(.*)$/;
+	my ($chars, $weights) = ($1, $2);
+	my @cps = map { hex } split ' ', $chars;
+	next if @cps != 1; # contractions are not supported
+
+	my @ces;
+	while ($weights =~ /\[[.*]([0-9A-F]+)\.([0-9A-F]+)\.([0-9A-F]+)\]/g) {
+		push @ces, [hex($1), hex($2)];
+	}
+	$ducet{$cps[0]} = \@ces;
+}
+close $keys;
+
+# Only major and minor versions are compared
+my $versionNote = '';
+my $ucdMinor = join '.', (split /\./, $version)[0, 1];
+my $ducetMinor = join '.', (split /\./, $ducetVersion)[0, 1];
+if ($ucdMinor ne $ducetMinor) {
+	warn "UCD $version does not match DUCET $ducetVersion, see the note in the header\n";
+	$versionNote = "//\n// Characters, added after DUCET $ducetVersion, have no collation weights "
+		. "and are\n// ordered after all assigned characters by code point "
+		. "(see __unicode_tables.pl)\n";
+}
+
+# Implicit weights from allkeys.txt (AAAA in FB00..FBFF, followed by BBBB) and U+FFFD are kept
+# with their DUCET values above 0x10000, other primaries are replaced with their rank,
+# so they fit in 15 bits
+my $ImplicitBase = 0x1_0000;
+
+my %primaries;
+my %secondaries = (0 => 1);
+for my $ces (values %ducet) {
+	my $prev = 0;
+	for my $ce (@$ces) {
+		my ($p, $s) = @$ce;
+		$secondaries{$s} = 1;
+		next if $p == 0;
+		$primaries{$p} = 1 unless $p >= 0xFB00 || ($prev >= 0xFB00 && $prev <= 0xFBFF);
+		$prev = $p;
+	}
+}
+
+my %primaryRanks;
+my $rank = 0;
+$primaryRanks{$_} = ++$rank for sort { $a <=> $b } keys %primaries;
+
+my %secondaryRanks;
+$rank = 0;
+$secondaryRanks{$_} = $rank++ for sort { $a <=> $b } keys %secondaries;
+
+my $CommonSecondary = $secondaryRanks{0x20};
+my $ImplicitValue = 0x7FFF;
+my $ExpansionFlag = 0x8000;
+
+die "Too many primaries\n" if scalar(keys %primaryRanks) >= $ImplicitValue;
+die "Too many secondaries\n" if scalar(keys %secondaryRanks) > 0xFF;
+
+my @expansions;
+my %expansionOffsets;
+
+sub collation_value {
+	my ($ces) = @_;
+	my @elements;
+	my $prev = 0;
+	for my $ce (@$ces) {
+		my ($p, $s) = @$ce;
+		next if $p == 0 && $s == 0;
+		my $key = 0;
+		if ($p != 0) {
+			if ($p >= 0xFB00 || ($prev >= 0xFB00 && $prev <= 0xFBFF)) {
+				$key = $ImplicitBase + $p;
+			} else {
+				$key = $primaryRanks{$p};
+			}
+			$prev = $p;
+		}
+		push @elements, ($key << 8) | $secondaryRanks{$s};
+	}
+
+	return 0 if !@elements;
+	if (@elements == 1 && ($elements[0] & 0xFF) == $CommonSecondary
+			&& ($elements[0] >> 8) < $ImplicitValue) {
+		return $elements[0] >> 8;
+	}
+
+	my $key = join(',', @elements);
+	if (!exists $expansionOffsets{$key}) {
+		$expansionOffsets{$key} = scalar @expansions;
+		push @expansions, scalar(@elements), @elements;
+	}
+	die "Expansion pool overflow\n" if $expansionOffsets{$key} >= $ImplicitValue;
+	return $ExpansionFlag | $expansionOffsets{$key};
+}
+
+my @collationValues;
+for my $cp (0 .. $MaxCp - 1) {
+	$collationValues[$cp] = exists $ducet{$cp} ? collation_value($ducet{$cp}) : $ImplicitValue;
+}
+
+my @ideographs = load_ranges('Unified_Ideograph');
+
+# Hangul syllables are decomposed into jamo, that should have single collation element
+for my $cp (0x1100 .. 0x1112, 0x1161 .. 0x1175, 0x11A8 .. 0x11C2) {
+	die "Unexpected collation value for jamo\n"
+			if $collationValues[$cp] == 0 || $collationValues[$cp] >= $ImplicitValue;
+}
+
+#
+# Output
+#
+
+# Three-stage lookup: (c >> chunkShift) -> chunk of block indexes -> block of values.
+# Chunks and blocks are deduplicated, shifts are selected to produce the smallest table.
+sub type_size {
+	for (@_) {
+		return 2 if $_ > 0xFF;
+	}
+	return 1;
+}
+
+sub build_trie {
+	my ($values) = @_;
+	my $best;
+	for my $blockShift (3 .. 8) {
+		my $blockSize = 1 << $blockShift;
+		my @blockOffsets;
+		my @data;
+		my %blockKeys;
+		for (my $start = 0; $start < $MaxCp; $start += $blockSize) {
+			my $key = join(',', @{$values}[$start .. $start + $blockSize - 1]);
+			if (!exists $blockKeys{$key}) {
+				$blockKeys{$key} = @data >> $blockShift;
+				push @data, @{$values}[$start .. $start + $blockSize - 1];
+			}
+			push @blockOffsets, $blockKeys{$key};
+		}
+		next if (@data >> $blockShift) > 0xFFFF;
+		my $dataSize = type_size(@data);
+		my $blockTypeSize = type_size(@blockOffsets);
+
+		for my $chunkShift ($blockShift + 2 .. 14) {
+			my $chunkSize = 1 << ($chunkShift - $blockShift);
+			my @chunks;
+			my @blocks;
+			my %chunkKeys;
+			for (my $i = 0; $i < @blockOffsets; $i += $chunkSize) {
+				my $key = join(',', @blockOffsets[$i .. $i + $chunkSize - 1]);
+				if (!exists $chunkKeys{$key}) {
+					$chunkKeys{$key} = @blocks >> ($chunkShift - $blockShift);
+					push @blocks, @blockOffsets[$i .. $i + $chunkSize - 1];
+				}
+				push @chunks, $chunkKeys{$key};
+			}
+			next if (@blocks >> ($chunkShift - $blockShift)) > 0xFFFF;
+
+			my $size = @chunks * type_size(@chunks) + @blocks * $blockTypeSize + @data * $dataSize;
+			if (!$best || $size < $best->{size}) {
+				$best = {
+					blockShift => $blockShift,
+					chunkShift => $chunkShift,
+					chunks => \@chunks,
+					blocks => \@blocks,
+					data => \@data,
+					chunkType => type_size(@chunks) == 2 ? 'uint16_t' : 'uint8_t',
+					blockType => $blockTypeSize == 2 ? 'uint16_t' : 'uint8_t',
+					dataType => $dataSize == 2 ? 'uint16_t' : 'uint8_t',
+					size => $size,
+				};
+			}
+		}
+	}
+	return $best;
+}
+
+sub format_list {
+	my ($fmt, $perLine, @values) = @_;
+	my $ret = '';
+	for (my $i = 0; $i < @values; $i += $perLine) {
+		my $end = $i + $perLine - 1;
+		$end = $#values if $end > $#values;
+		$ret .= "\t" . join(', ', map { sprintf($fmt, $_) } @values[$i .. $end]) . ",\n";
+	}
+	return $ret;
+}
+
+sub print_trie {
+	my ($name, $trie) = @_;
+	my $Name = ucfirst $name;
+	my $chunks = scalar @{$trie->{chunks}};
+	my $blocks = scalar @{$trie->{blocks}};
+	my $data = scalar @{$trie->{data}};
+	print "static constexpr uint32_t ${Name}ChunkShift = $trie->{chunkShift};\n";
+	print "static constexpr uint32_t ${Name}BlockShift = $trie->{blockShift};\n\n";
+	print "static constexpr $trie->{chunkType} s_${name}Chunks[$chunks] = {\n";
+	print format_list('%d', 16, @{$trie->{chunks}});
+	print "};\n\n";
+	print "static constexpr $trie->{blockType} s_${name}Blocks[$blocks] = {\n";
+	print format_list('%d', 16, @{$trie->{blocks}});
+	print "};\n\n";
+	print "static constexpr $trie->{dataType} s_${name}Data[$data] = {\n";
+	print format_list('%d', 16, @{$trie->{data}});
+	print "};\n\n";
+	print "SPRT_INLINE inline $trie->{dataType} get${Name}Value(char32_t c) {\n";
+	print "\tif (c >= 0x11'0000) {\n";
+	print "\t\treturn ${Name}DefaultValue;\n";
+	print "\t}\n";
+	print "\tconst auto chunk = s_${name}Chunks[c >> ${Name}ChunkShift];\n";
+	print "\tconst auto block = s_${name}Blocks[(uint32_t(chunk) << (${Name}ChunkShift - ${Name}BlockShift))\n";
+	print "\t\t\t+ ((c >> ${Name}BlockShift) & ((1 << (${Name}ChunkShift - ${Name}BlockShift)) - 1))];\n";
+	print "\treturn s_${name}Data[(uint32_t(block) << ${Name}BlockShift) + (c & ((1 << ${Name}BlockShift) - 1))];\n";
+	print "}\n\n";
+}
+
+my $caseTrie = build_trie(\@caseValues);
+my $collationTrie = build_trie(\@collationValues);
+
+my $recordCount = scalar @records;
+my $specialCount = scalar @specials;
+my $specialCharCount = scalar @specialChars;
+my $expansionCount = scalar @expansions;
+my $ideographCount = scalar @ideographs;
+my $implicitCount = scalar @implicitRanges;
+
+print <<"EOF";
+/**
+ Copyright (c) 2026 Xenolith Team <admin\@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+// Generated by __unicode_tables.pl from Unicode $version character database and
+// DUCET $ducetVersion (allkeys.txt), do not edit
+$versionNote
+#ifndef RUNTIME_CORE_INCLUDE___UNICODE_TABLES_H_
+#define RUNTIME_CORE_INCLUDE___UNICODE_TABLES_H_
+
+#include <sprt/runtime/init.h>
+
+namespace sprt::unicode::detail {
+
+// clang-format off
+
+enum CaseFlags : uint16_t {
+	CaseFlagCased = $flagValues{Cased},
+	CaseFlagIgnorable = $flagValues{CaseIgnorable},
+	CaseFlagWord = $flagValues{Word}, // non-ideographic Alphabetic or decimal digit
+};
+
+// Simple mappings as a difference with the code point
+struct CaseRecord {
+	int32_t lower;
+	int32_t upper;
+	int32_t title;
+	int32_t fold;
+	uint16_t flags;
+	uint16_t special; // index in s_caseSpecials for characters with multi-char full mappings
+};
+
+// Offsets of full mappings in s_caseSpecialChars: length, then UTF-16 units
+struct CaseSpecial {
+	uint16_t lower;
+	uint16_t upper;
+	uint16_t title;
+	uint16_t fold;
+};
+
+static constexpr uint16_t CaseDefaultValue = 0;
+
+// Max length of the full mapping for a single code point
+static constexpr uint32_t CaseMaxChars = $maxChars;
+
+// Max growth of the string length after the full mapping
+static constexpr uint32_t CaseMaxUtf8Growth = $utf8Growth;
+static constexpr uint32_t CaseMaxUtf16Growth = $utf16Growth;
+
+EOF
+
+print_trie('case', $caseTrie);
+
+print "static constexpr CaseRecord s_caseRecords[$recordCount] = {\n";
+for my $rec (@records) {
+	print "\t{" . join(', ', @$rec) . "},\n";
+}
+print "};\n\n";
+
+print "static constexpr CaseSpecial s_caseSpecials[$specialCount] = {\n";
+for my $rec (@specials) {
+	print "\t{" . join(', ', @$rec) . "},\n";
+}
+print "};\n\n";
+
+print "static constexpr char16_t s_caseSpecialChars[$specialCharCount] = {\n";
+print format_list('0x%04X', 12, @specialChars);
+print "};\n\n";
+
+print <<"EOF";
+// Collation value for the code point:
+//   0 - fully ignorable
+//   1 .. CollationImplicitValue - 1 - single element with primary key and common secondary
+//   CollationImplicitValue - no value in DUCET, implicit weights should be computed
+//   CollationExpansionFlag | offset - offset in s_collationExpansions: length, then elements
+//
+// Collation element is (primaryKey << 8) | secondaryRank, primary key is a rank of the DUCET
+// primary weight, or CollationImplicitBase + weight for implicit weights and U+FFFD
+static constexpr uint16_t CollationImplicitValue = $ImplicitValue;
+static constexpr uint16_t CollationExpansionFlag = $ExpansionFlag;
+static constexpr uint16_t CollationDefaultValue = CollationImplicitValue;
+static constexpr uint32_t CollationImplicitBase = $ImplicitBase;
+static constexpr uint32_t CollationCommonSecondary = $CommonSecondary;
+
+EOF
+
+print_trie('collation', $collationTrie);
+
+print "static constexpr uint32_t s_collationExpansions[$expansionCount] = {\n";
+print format_list('0x%07X', 8, @expansions);
+print "};\n\n";
+
+print "struct CollationRange {\n\tchar32_t first;\n\tchar32_t last;\n\tuint32_t base;\n};\n\n";
+
+print "// \@implicitweights from allkeys.txt\n";
+print "static constexpr CollationRange s_collationImplicitRanges[$implicitCount] = {\n";
+for my $r (@implicitRanges) {
+	printf "\t{0x%05X, 0x%05X, 0x%04X},\n", @$r;
+}
+print "};\n\n";
+
+print "// Unified_Ideograph property\n";
+print "static constexpr CollationRange s_collationIdeographs[$ideographCount] = {\n";
+for my $r (@ideographs) {
+	printf "\t{0x%05X, 0x%05X, 0},\n", @$r;
+}
+print "};\n\n";
+
+print <<"EOF";
+// clang-format on
+
+} // namespace sprt::unicode::detail
+
+#endif // RUNTIME_CORE_INCLUDE___UNICODE_TABLES_H_
+EOF
@@ -40,6 +40,14 @@ static bool isAbove5_14() {
 	return s_isAbove5_14Value;
 }
 
+static __SPRT_ID(clockid_t) sprt_qlock_getclock(__SPRT_ID(sprt_lock_flags_t) flags) {
+	if (hasFlag(flags, __SPRT_ID(sprt_lock_flags_t)(__SPRT_SPRT_LOCK_FLAG_CLOCK_REALTIME))) {
+		return __SPRT_CLOCK_REALTIME;
+	} else {
+		return __SPRT_CLOCK_MONOTONIC;
+	}
+}
+
 static int sprt_qlock_supports(__SPRT_ID(sprt_lock_flags_t) flags) {
 	// SPRT supports 5.10+ kernels, __SPRT_FUTEX_CLOCK_REALTIME requires 5.4 for FUTEX_WAIT
 	if ((flags & ~(__SPRT_SPRT_LOCK_FLAG_SHARED | __SPRT_SPRT_LOCK_FLAG_CLOCK_REALTIME)) == 0) {
@@ -103,6 +111,45 @@ static int sprt_qlock_wake_all(__SPRT_ID(sprt_qlock_t) * value,
 	return result;
 }
 
+static int sprt_qlock_wait_any(__SPRT_ID(sprt_qlock_t) * const *values,
+		const __SPRT_ID(sprt_qlock_t) * expected, __SPRT_ID(uint32_t) count,
+		__SPRT_ID(sprt_timeout_t) timeout, __SPRT_ID(sprt_lock_flags_t) flags) {
+	// FUTEX_WAITV(2): https://docs.kernel.org/userspace-api/futex2.html
+	// waiters with FUTEX2_SIZE_U32 are compatible with FUTEX_WAKE from sprt_qlock_wake_*
+	if (count == 0 || count > __SPRT_FUTEX_WAITV_MAX) {
+		__sprt_errno = EINVAL;
+		return -1;
+	}
+
+	uint32_t _flags = __SPRT_FUTEX2_SIZE_U32 | __SPRT_FUTEX2_PRIVATE;
+	if (hasFlag(flags, __SPRT_ID(sprt_lock_flags_t)(__SPRT_SPRT_LOCK_FLAG_SHARED))) {
+		_flags &= ~__SPRT_FUTEX2_PRIVATE;
+	}
+
+	struct __SPRT_ID(futex_waitv) waiters[__SPRT_FUTEX_WAITV_MAX];
+	for (uint32_t i = 0; i < count; ++i) {
+		waiters[i].val = expected[i];
+		waiters[i].uaddr = reinterpret_cast<uintptr_t>(values[i]);
+		waiters[i].flags = _flags;
+		waiters[i].__reserved = 0;
+	}
+
+	if (timeout == __SPRT_SPRT_TIMEOUT_INFINITE) {
+		return ::syscall(__SPRT_SYSCALL_futex_waitv, waiters, count, 0, nullptr, 0);
+	} else {
+		// futex_waitv uses absolute timeout
+		auto clock = sprt_qlock_getclock(flags);
+		timeout += __sprt_sprt_qlock_now(flags);
+		struct timespec ts{
+			static_cast<decltype(sprt::declval<struct timespec>().tv_sec)>(
+					timeout / 1'000'000'000),
+			static_cast<decltype(sprt::declval<struct timespec>().tv_nsec)>(
+					timeout % 1'000'000'000),
+		};
+		return ::syscall(__SPRT_SYSCALL_futex_waitv, waiters, count, 0, &ts, clock);
+	}
+}
+
 static int sprt_rlock_supports(__SPRT_ID(sprt_lock_flags_t) flags) {
 	// SPRT supports 5.10+ kernels, __SPRT_FUTEX_CLOCK_REALTIME requires 5.14 for __SPRT_FUTEX_LOCK_PI2
 	if (isAbove5_14()) {
@@ -205,14 +252,6 @@ static int sprt_rlock_wake(__SPRT_ID(sprt_rlock_t) * value, __SPRT_ID(sprt_lock_
 	return result;
 }
 
-static __SPRT_ID(clockid_t) sprt_qlock_getclock(__SPRT_ID(sprt_lock_flags_t) flags) {
-	if (hasFlag(flags, __SPRT_ID(sprt_lock_flags_t)(__SPRT_SPRT_LOCK_FLAG_CLOCK_REALTIME))) {
-		return __SPRT_CLOCK_REALTIME;
-	} else {
-		return __SPRT_CLOCK_MONOTONIC;
-	}
-}
-
 static __SPRT_ID(clockid_t) sprt_rlock_getclock(__SPRT_ID(sprt_lock_flags_t) flags) {
 	if (!hasFlag(flags, __SPRT_ID(sprt_lock_flags_t)(__SPRT_SPRT_LOCK_FLAG_PI))) {
 		// same as qlock
@@ -180,9 +180,17 @@ struct SPRT_LOCAL Cleanup {
 	static void run(Cleanup **cref, bool plain);
 };
 
+struct ThreadCacheSlot;
+
 struct SPRT_LOCAL Allocator {
 	using AllocMutex = sprt::rmutex;
 
+	// Small nodes are cached per thread (magazine for every size index below ThreadCacheIndexes)
+	// Only allocators without owner pool and without max_free limit use thread cache
+	static constexpr uint32_t ThreadCacheIndexes = 4;
+	static constexpr uint32_t ThreadCacheDepth = 8;
+	static constexpr uint32_t ThreadCacheBatch = ThreadCacheDepth / 2;
+
 	// used to detect stappler allocators vs. APR allocators
 	uintptr_t magic = static_cast<uintptr_t>(config::POOL_MAGIC);
 	uint32_t last = 0; // largest used index into free
@@ -193,7 +201,7 @@ struct SPRT_LOCAL Allocator {
 	AllocMutex mutex;
 	array<MemNode *, config::MAX_INDEX> buf;
 	atomic<size_t> allocated;
-	uint64_t padding = 0;
+	ThreadCacheSlot *caches = nullptr; // thread cache slots, bound to this allocator
 
 	static size_t getAllocatorsCount();
 
@@ -202,9 +210,18 @@ struct SPRT_LOCAL Allocator {
 
 	void set_max(size_t);
 
+	bool is_thread_cached() const {
+		return owner == nullptr && max == config::ALLOCATOR_MAX_FREE_UNLIMITED;
+	}
+
 	MemNode *alloc(size_t);
 	void free(MemNode *);
 
+	// shared free lists, bypassing thread cache
+	MemNode *alloc_node(size_t size, uint32_t index);
+	uint32_t alloc_bulk(uint32_t index, MemNode **, uint32_t count);
+	void free_nodes(MemNode *);
+
 	void lock();
 	void unlock();
 };
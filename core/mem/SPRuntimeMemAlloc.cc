@@ -103,12 +103,320 @@ static void Allocator_free(MemNode *ptr) {
 	}
 }
 
+// Thread cache: every thread holds a few slots, each slot is bound to a single allocator
+// and contains magazines of free nodes for small size indexes. Slot is used only by its thread,
+// so alloc/free within magazine capacity requires no locking. Full magazine returns a batch
+// of nodes to the allocator with a single lock, empty magazine is refilled the same way.
+//
+// Binding and unbinding is protected by global cache mutex: slot can be unbound by the
+// allocator's destructor, or evicted by its thread, when it needs a slot for other allocator.
+// Cache mutex is never held together with allocator's mutex, nodes from detached slots
+// are freed directly.
+//
+// Magazines are never touched by other threads: allocator's destructor only unlinks slots
+// of other threads and marks them as orphaned, owner thread frees the nodes on its next
+// bind or on exit. Orphaned slot is not matched with a new allocator at the same address.
+struct SPRT_LOCAL ThreadCacheSlot {
+	struct Magazine {
+		MemNode *nodes = nullptr;
+		uint32_t count = 0;
+	};
+
+	atomic<Allocator *> allocator = nullptr;
+	atomic<bool> orphaned = false; // set with cache mutex by the allocator's destructor
+	ThreadCacheSlot *next = nullptr; // next slot, bound to the same allocator
+	ThreadCacheSlot **ref = nullptr;
+	uint64_t tick = 0; // last use, for eviction
+	array<Magazine, Allocator::ThreadCacheIndexes> magazines;
+
+	// owner thread only, returns cached nodes
+	MemNode *take();
+
+	// requires cache mutex, removes slot from the allocator's list
+	void unlink();
+
+	// requires cache mutex, owner thread only, returns cached nodes
+	MemNode *detach();
+};
+
+struct SPRT_LOCAL ThreadCache {
+	static constexpr uint32_t Slots = 4;
+
+	array<ThreadCacheSlot, Slots> slots;
+	uint64_t tick = 0;
+
+	static ThreadCache *get();
+
+	bool contains(const ThreadCacheSlot *) const;
+
+	ThreadCacheSlot *find(Allocator *);
+	ThreadCacheSlot *bind(Allocator *);
+
+	MemNode *pop(Allocator *, uint32_t index);
+
+	// returns nodes, that was not cached
+	MemNode *push(Allocator *, MemNode *);
+
+	~ThreadCache();
+};
+
+static qmutex &getThreadCacheMutex() {
+	static qmutex s_mutex;
+	return s_mutex;
+}
+
+// Allocator can be used by other thread-local destructors after cache destruction
+static thread_local bool tl_threadCacheFinalized = false;
+
+static void ThreadCache_freeDetached(MemNode *node) {
+	while (node) {
+		auto next = node->next;
+		Allocator_free(node);
+		node = next;
+	}
+}
+
+static size_t ThreadCache_getSize(MemNode *node) {
+	size_t ret = 0;
+	while (node) {
+		ret += node->endp - (uint8_t *)node;
+		node = node->next;
+	}
+	return ret;
+}
+
+MemNode *ThreadCacheSlot::take() {
+	MemNode *list = nullptr;
+	for (auto &it : magazines) {
+		while (it.nodes) {
+			auto node = it.nodes;
+			it.nodes = node->next;
+			node->next = list;
+			list = node;
+		}
+		it.count = 0;
+	}
+	return list;
+}
+
+void ThreadCacheSlot::unlink() {
+	*ref = next;
+	if (next) {
+		next->ref = ref;
+	}
+	next = nullptr;
+	ref = nullptr;
+}
+
+MemNode *ThreadCacheSlot::detach() {
+	auto list = take();
+	if (orphaned.load(memory_order::relaxed)) {
+		// already unlinked by the allocator's destructor
+		orphaned.store(false, memory_order::relaxed);
+	} else {
+		unlink();
+	}
+	allocator.store(nullptr, memory_order::relaxed);
+	return list;
+}
+
+ThreadCache *ThreadCache::get() {
+	if (tl_threadCacheFinalized) {
+		return nullptr;
+	}
+
+	static thread_local ThreadCache tl_cache;
+	return &tl_cache;
+}
+
+bool ThreadCache::contains(const ThreadCacheSlot *slot) const {
+	return slot >= slots.data() && slot < slots.data() + Slots;
+}
+
+ThreadCacheSlot *ThreadCache::find(Allocator *a) {
+	for (auto &it : slots) {
+		if (it.allocator.load(memory_order::relaxed) == a
+				&& !it.orphaned.load(memory_order::acquire)) {
+			it.tick = ++tick;
+			return &it;
+		}
+	}
+	return nullptr;
+}
+
+ThreadCacheSlot *ThreadCache::bind(Allocator *a) {
+	// use empty, orphaned or least recently used slot
+	ThreadCacheSlot *target = &slots[0];
+	for (auto &it : slots) {
+		if (it.allocator.load(memory_order::relaxed) == nullptr
+				|| it.orphaned.load(memory_order::acquire)) {
+			target = &it;
+			break;
+		}
+		if (it.tick < target->tick) {
+			target = &it;
+		}
+	}
+
+	MemNode *evicted = nullptr;
+
+	getThreadCacheMutex().lock();
+	if (auto prev = target->allocator.load(memory_order::relaxed)) {
+		auto orphaned = target->orphaned.load(memory_order::relaxed);
+		evicted = target->detach();
+		if (!orphaned) {
+			prev->allocated -= ThreadCache_getSize(evicted);
+		}
+	}
+
+	target->allocator.store(a, memory_order::relaxed);
+	target->next = a->caches;
+	if (target->next) {
+		target->next->ref = &target->next;
+	}
+	a->caches = target;
+	target->ref = &a->caches;
+	target->tick = ++tick;
+	getThreadCacheMutex().unlock();
+
+	ThreadCache_freeDetached(evicted);
+	return target;
+}
+
+MemNode *ThreadCache::pop(Allocator *a, uint32_t index) {
+	auto slot = find(a);
+	if (!slot) {
+		return nullptr;
+	}
+
+	auto &mag = slot->magazines[index];
+	if (!mag.nodes) {
+		MemNode *nodes[Allocator::ThreadCacheBatch];
+		auto count = a->alloc_bulk(index, nodes, Allocator::ThreadCacheBatch);
+		if (count == 0) {
+			return nullptr;
+		}
+
+		for (uint32_t i = 1; i < count; ++i) {
+			nodes[i]->next = mag.nodes;
+			mag.nodes = nodes[i];
+		}
+		mag.count = count - 1;
+		return nodes[0];
+	}
+
+	auto node = mag.nodes;
+	mag.nodes = node->next;
+	--mag.count;
+
+	node->next = nullptr;
+	node->first_avail = (uint8_t *)node + SIZEOF_MEMNODE;
+	return node;
+}
+
+MemNode *ThreadCache::push(Allocator *a, MemNode *node) {
+	auto slot = find(a);
+	if (!slot) {
+		slot = bind(a);
+	}
+
+	MemNode *ret = nullptr;
+	while (node) {
+		auto next = node->next;
+		auto index = node->index;
+		if (index < Allocator::ThreadCacheIndexes) {
+			auto &mag = slot->magazines[index];
+			if (mag.count == Allocator::ThreadCacheDepth) {
+				// return batch of the oldest nodes to the allocator
+				auto tail = mag.nodes;
+				for (uint32_t i = 1; i < Allocator::ThreadCacheDepth - Allocator::ThreadCacheBatch;
+						++i) {
+					tail = tail->next;
+				}
+
+				auto batch = tail->next;
+				tail->next = nullptr;
+				mag.count -= Allocator::ThreadCacheBatch;
+
+				tail = batch;
+				while (tail->next) { tail = tail->next; }
+				tail->next = ret;
+				ret = batch;
+			}
+
+			node->next = mag.nodes;
+			mag.nodes = node;
+			++mag.count;
+		} else {
+			node->next = ret;
+			ret = node;
+		}
+		node = next;
+	}
+	return ret;
+}
+
+ThreadCache::~ThreadCache() {
+	tl_threadCacheFinalized = true;
+
+	MemNode *nodes = nullptr;
+
+	getThreadCacheMutex().lock();
+	for (auto &it : slots) {
+		if (auto a = it.allocator.load(memory_order::relaxed)) {
+			auto orphaned = it.orphaned.load(memory_order::relaxed);
+			auto list = it.detach();
+			if (!orphaned) {
+				a->allocated -= ThreadCache_getSize(list);
+			}
+			while (list) {
+				auto next = list->next;
+				list->next = nodes;
+				nodes = list;
+				list = next;
+			}
+		}
+	}
+	getThreadCacheMutex().unlock();
+
+	ThreadCache_freeDetached(nodes);
+}
+
 Allocator::Allocator() {
 	++s_nAllocators;
 	buf.fill(nullptr);
 }
 
 Allocator::~Allocator() {
+	if (caches) {
+		MemNode *nodes = nullptr;
+
+		// slots of the current thread are released now, other threads are notified to release
+		// their slots: magazines can be in use by the owner thread without any lock
+		auto current = ThreadCache::get();
+
+		getThreadCacheMutex().lock();
+		while (caches) {
+			auto slot = caches;
+			if (current && current->contains(slot)) {
+				auto list = slot->detach();
+				while (list) {
+					auto next = list->next;
+					list->next = nodes;
+					nodes = list;
+					list = next;
+				}
+			} else {
+				slot->unlink();
+				slot->orphaned.store(true, memory_order::release);
+			}
+		}
+		getThreadCacheMutex().unlock();
+
+		allocated -= ThreadCache_getSize(nodes);
+		ThreadCache_freeDetached(nodes);
+	}
+
 	unique_lock lock(mutex);
 	for (uint32_t index = 0; index < config::MAX_INDEX; index++) {
 		auto node = buf[index];
@@ -145,8 +453,6 @@ void Allocator::set_max(size_t size) {
 }
 
 MemNode *Allocator::alloc(size_t in_size) {
-	unique_lock<Allocator> lock;
-
 	size_t size = uint32_t(math::align(in_size + SIZEOF_MEMNODE, size_t(config::BOUNDARY_SIZE)));
 	if (size < in_size) {
 		return nullptr;
@@ -160,6 +466,20 @@ MemNode *Allocator::alloc(size_t in_size) {
 		return nullptr;
 	}
 
+	if (index < ThreadCacheIndexes && is_thread_cached()) {
+		if (auto cache = ThreadCache::get()) {
+			if (auto node = cache->pop(this, index)) {
+				return node;
+			}
+		}
+	}
+
+	return alloc_node(size, index);
+}
+
+MemNode *Allocator::alloc_node(size_t size, uint32_t index) {
+	unique_lock<Allocator> lock;
+
 	MemNode *node = nullptr;
 	MemNode **ref = nullptr;
 
@@ -248,7 +568,49 @@ MemNode *Allocator::alloc(size_t in_size) {
 	return node;
 }
 
+uint32_t Allocator::alloc_bulk(uint32_t index, MemNode **nodes, uint32_t count) {
+	unique_lock<Allocator> lock(*this);
+
+	if (index > last) {
+		return 0;
+	}
+
+	uint32_t n = 0;
+	while (n < count && buf[index] != nullptr) {
+		auto node = buf[index];
+		buf[index] = node->next;
+
+		current += node->index + 1;
+		if (current > max) {
+			current = max;
+		}
+
+		node->next = nullptr;
+		node->first_avail = (uint8_t *)node + SIZEOF_MEMNODE;
+		nodes[n++] = node;
+	}
+
+	if (buf[index] == nullptr && index == last) {
+		while (last > 0 && buf[last] == nullptr) { --last; }
+	}
+
+	return n;
+}
+
 void Allocator::free(MemNode *node) {
+	if (is_thread_cached()) {
+		if (auto cache = ThreadCache::get()) {
+			node = cache->push(this, node);
+			if (!node) {
+				return;
+			}
+		}
+	}
+
+	free_nodes(node);
+}
+
+void Allocator::free_nodes(MemNode *node) {
 	MemNode *next, *freelist = nullptr;
 
 	unique_lock<Allocator> lock(*this);
@@ -25,6 +25,18 @@
 #include <sprt/runtime/stringview.h>
 #include <sprt/c/__sprt_stdlib.h>
 
+// SSE2 and NEON are baseline for base16; base64 on x86 requires SSSE3 (pshufb),
+// so its kernels are compiled with target attributes and selected with cpuid
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SPRT_BASE64_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define SPRT_BASE64_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace sprt::base64 {
 
 // Mapping from 6 bit pattern to ASCII character.
@@ -59,81 +71,628 @@ static unsigned char base64DecodeLookup[256] = {
 constexpr int BinaryUnit = 3;
 constexpr int Base64Unit = 4;
 
-template <typename Callback>
-static void make_encode(BytesView inputBuffer, const Callback &cb) {
-	auto length = inputBuffer.size();
+// Mapping for the URL-safe alphabet
+static const char *base64UrlEncodeLookup =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+struct DecodeTable {
+	uint8_t data[256];
+};
+
+static constexpr DecodeTable makeDecodeTable(const char *alphabet) {
+	DecodeTable ret = {{0}};
+	for (auto &it : ret.data) { it = xx; }
+	for (uint8_t i = 0; i < 64; ++i) { ret.data[uint8_t(alphabet[i])] = i; }
+	return ret;
+}
+
+// Strict decoding accepts only one alphabet
+static constexpr DecodeTable s_decodeStandard =
+		makeDecodeTable("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+static constexpr DecodeTable s_decodeUrl =
+		makeDecodeTable("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+
+// Alphabets for decode kernels: '+' and '/' for standard, '-' and '_' for URL-safe
+static constexpr uint32_t AlphabetStandard = 1 << 0;
+static constexpr uint32_t AlphabetUrl = 1 << 1;
+
+// Kernels process whole blocks and return number of consumed input bytes. Encoder
+// consumes multiple of BinaryUnit bytes, decoder stops on the first block with
+// characters out of the alphabets or without enough space in the output
+using EncodeKernel = size_t (*)(const uint8_t *in, size_t len, char *out, bool url);
+using DecodeKernel = size_t (*)(const char *in, size_t len, uint8_t *out, size_t outsize,
+		uint32_t alphabets);
+
+struct Kernels {
+	EncodeKernel encode = nullptr;
+	DecodeKernel decode = nullptr;
+};
+
+#if SPRT_BASE64_X86
+
+// Encoding and decoding follows W. Mula and D. Lemire, "Faster Base64 Encoding and Decoding
+// using AVX2 Instructions". Decode lookup uses range checks instead of nibble tables,
+// so both alphabets can be accepted in the lenient mode.
+
+__attribute__((target("ssse3"))) static inline __m128i enc_reshuffle_ssse3(__m128i in) {
+	// 3 bytes of every 32-bit lane as [b1, b0, b2, b1]
+	in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0'FC00));
+	const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x0400'0040));
+	const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F'03F0));
+	const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x0100'0010));
+	return _mm_or_si128(t1, t3);
+}
+
+__attribute__((target("ssse3"))) static inline __m128i enc_shift_lut_ssse3(bool url) {
+	return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, '0' - 52, url ? '-' - 62 : '+' - 62,
+			url ? '_' - 63 : '/' - 63, 'A', 0, 0);
+}
+
+__attribute__((target("ssse3"))) static inline __m128i enc_translate_ssse3(__m128i indices,
+		__m128i shiftLut) {
+	// 0 for a-z, 1-12 for digits and two last chars, 13 for A-Z
+	__m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+	const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+	result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+	return _mm_add_epi8(_mm_shuffle_epi8(shiftLut, result), indices);
+}
+
+__attribute__((target("ssse3"))) static size_t encode_ssse3(const uint8_t *in, size_t len,
+		char *out, bool url) {
+	const auto lut = enc_shift_lut_ssse3(url);
+
+	// 16 bytes are loaded for every 12 bytes of input
+	size_t i = 0;
+	for (; len - i >= 16; i += 12, out += 16) {
+		auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+		v = enc_translate_ssse3(enc_reshuffle_ssse3(v), lut);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out), v);
+	}
+	return i;
+}
+
+// signed compare, bytes above 0x7F never match
+__attribute__((target("ssse3"))) static inline __m128i dec_range_ssse3(__m128i v, char lo,
+		char hi) {
+	return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+			_mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), v));
+}
+
+__attribute__((target("ssse3"))) static inline bool dec_translate_ssse3(__m128i v, __m128i &out,
+		uint32_t alphabets) {
+	const auto upper = dec_range_ssse3(v, 'A', 'Z');
+	const auto lower = dec_range_ssse3(v, 'a', 'z');
+	const auto digit = dec_range_ssse3(v, '0', '9');
+
+	auto valid = _mm_or_si128(_mm_or_si128(upper, lower), digit);
+	auto roll = _mm_or_si128(_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-65)),
+									 _mm_and_si128(lower, _mm_set1_epi8(-71))),
+			_mm_and_si128(digit, _mm_set1_epi8(4)));
+
+	if (alphabets & AlphabetStandard) {
+		const auto plus = _mm_cmpeq_epi8(v, _mm_set1_epi8('+'));
+		const auto slash = _mm_cmpeq_epi8(v, _mm_set1_epi8('/'));
+		valid = _mm_or_si128(valid, _mm_or_si128(plus, slash));
+		roll = _mm_or_si128(roll,
+				_mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62 - '+')),
+						_mm_and_si128(slash, _mm_set1_epi8(63 - '/'))));
+	}
+	if (alphabets & AlphabetUrl) {
+		const auto minus = _mm_cmpeq_epi8(v, _mm_set1_epi8('-'));
+		const auto underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+		valid = _mm_or_si128(valid, _mm_or_si128(minus, underscore));
+		roll = _mm_or_si128(roll,
+				_mm_or_si128(_mm_and_si128(minus, _mm_set1_epi8(62 - '-')),
+						_mm_and_si128(underscore, _mm_set1_epi8(63 - '_'))));
+	}
+
+	if (_mm_movemask_epi8(valid) != 0xFFFF) {
+		return false;
+	}
+	out = _mm_add_epi8(v, roll);
+	return true;
+}
+
+// Packs four 6-bit indices of every 32-bit lane into 3 bytes
+__attribute__((target("ssse3"))) static inline __m128i dec_pack_ssse3(__m128i indices) {
+	auto merged = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x0140'0140));
+	merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x0001'1000));
+	return _mm_shuffle_epi8(merged,
+			_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+__attribute__((target("ssse3"))) static size_t decode_ssse3(const char *in, size_t len,
+		uint8_t *out, size_t outsize, uint32_t alphabets) {
+	// only 12 decoded bytes are stored, nothing is written past the decoded data
+	size_t i = 0;
+	for (; len - i >= 16 && outsize >= 12; i += 16, out += 12, outsize -= 12) {
+		__m128i indices;
+		if (!dec_translate_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i)),
+					indices, alphabets)) {
+			break;
+		}
+		const auto packed = dec_pack_ssse3(indices);
+		const auto high = uint32_t(_mm_cvtsi128_si32(_mm_srli_si128(packed, 8)));
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(out), packed);
+		__builtin_memcpy(out + 8, &high, sizeof(uint32_t));
+	}
+	return i;
+}
+
+__attribute__((target("avx2"))) static inline __m256i enc_reshuffle_avx2(__m256i in) {
+	in = _mm256_shuffle_epi8(in,
+			_mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7, 8,
+					6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+	const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0'FC00));
+	const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x0400'0040));
+	const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F'03F0));
+	const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x0100'0010));
+	return _mm256_or_si256(t1, t3);
+}
+
+__attribute__((target("avx2"))) static inline __m256i enc_translate_avx2(__m256i indices,
+		__m256i shiftLut) {
+	__m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+	const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+	result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+	return _mm256_add_epi8(_mm256_shuffle_epi8(shiftLut, result), indices);
+}
+
+__attribute__((target("avx2"))) static size_t encode_avx2(const uint8_t *in, size_t len,
+		char *out, bool url) {
+	const auto lut128 = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, url ? '-' - 62 : '+' - 62,
+			url ? '_' - 63 : '/' - 63, 'A', 0, 0);
+	const auto lut = _mm256_broadcastsi128_si256(lut128);
+
+	// every lane gets 12 bytes, second lane is loaded from in + 12
+	size_t i = 0;
+	for (; len - i >= 28; i += 24, out += 32) {
+		auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+		auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i + 12));
+		auto v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+		v = enc_translate_avx2(enc_reshuffle_avx2(v), lut);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(out), v);
+	}
+
+	return i + encode_ssse3(in + i, len - i, out, url);
+}
+
+__attribute__((target("avx2"))) static inline __m256i dec_range_avx2(__m256i v, char lo,
+		char hi) {
+	return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(lo - 1)),
+			_mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), v));
+}
+
+__attribute__((target("avx2"))) static inline bool dec_translate_avx2(__m256i v, __m256i &out,
+		uint32_t alphabets) {
+	const auto upper = dec_range_avx2(v, 'A', 'Z');
+	const auto lower = dec_range_avx2(v, 'a', 'z');
+	const auto digit = dec_range_avx2(v, '0', '9');
+
+	auto valid = _mm256_or_si256(_mm256_or_si256(upper, lower), digit);
+	auto roll = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-65)),
+										_mm256_and_si256(lower, _mm256_set1_epi8(-71))),
+			_mm256_and_si256(digit, _mm256_set1_epi8(4)));
+
+	if (alphabets & AlphabetStandard) {
+		const auto plus = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('+'));
+		const auto slash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'));
+		valid = _mm256_or_si256(valid, _mm256_or_si256(plus, slash));
+		roll = _mm256_or_si256(roll,
+				_mm256_or_si256(_mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')),
+						_mm256_and_si256(slash, _mm256_set1_epi8(63 - '/'))));
+	}
+	if (alphabets & AlphabetUrl) {
+		const auto minus = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('-'));
+		const auto underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+		valid = _mm256_or_si256(valid, _mm256_or_si256(minus, underscore));
+		roll = _mm256_or_si256(roll,
+				_mm256_or_si256(_mm256_and_si256(minus, _mm256_set1_epi8(62 - '-')),
+						_mm256_and_si256(underscore, _mm256_set1_epi8(63 - '_'))));
+	}
+
+	if (uint32_t(_mm256_movemask_epi8(valid)) != 0xFFFF'FFFF) {
+		return false;
+	}
+	out = _mm256_add_epi8(v, roll);
+	return true;
+}
+
+__attribute__((target("avx2"))) static size_t decode_avx2(const char *in, size_t len,
+		uint8_t *out, size_t outsize, uint32_t alphabets) {
+	size_t i = 0;
+	for (; len - i >= 32 && outsize >= 24; i += 32, out += 24, outsize -= 24) {
+		__m256i indices;
+		if (!dec_translate_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i)),
+					indices, alphabets)) {
+			break;
+		}
+		auto merged = _mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x0140'0140));
+		merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x0001'1000));
+		merged = _mm256_shuffle_epi8(merged,
+				_mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6,
+						5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		// 12 bytes of every lane into the first 24 bytes
+		merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(merged));
+		_mm_storel_epi64(reinterpret_cast<__m128i *>(out + 16),
+				_mm256_extracti128_si256(merged, 1));
+	}
+
+	// tail, or not enough space for the full block
+	return i + decode_ssse3(in + i, len - i, out, outsize, alphabets);
+}
+
+static Kernels detectKernels() {
+	Kernels ret;
+	unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_SSSE3) == 0) {
+		return ret;
+	}
+
+	ret.encode = &encode_ssse3;
+	ret.decode = &decode_ssse3;
+
+	if ((ecx & bit_AVX) == 0 || (ecx & bit_OSXSAVE) == 0) {
+		return ret;
+	}
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || (ebx & bit_AVX2) == 0) {
+		return ret;
+	}
+
+	// OS should save YMM state on context switch
+	uint32_t xcr0lo = 0, xcr0hi = 0;
+	__asm__ volatile("xgetbv" : "=a"(xcr0lo), "=d"(xcr0hi) : "c"(0));
+	if ((xcr0lo & 0x6) == 0x6) {
+		ret.encode = &encode_avx2;
+		ret.decode = &decode_avx2;
+	}
+	return ret;
+}
+
+#elif SPRT_BASE64_NEON
+
+static size_t encode_neon(const uint8_t *in, size_t len, char *out, bool url) {
+	const auto lookup = reinterpret_cast<const uint8_t *>(
+			url ? base64UrlEncodeLookup : base64EncodeLookup);
+	uint8x16x4_t table;
+	table.val[0] = vld1q_u8(lookup);
+	table.val[1] = vld1q_u8(lookup + 16);
+	table.val[2] = vld1q_u8(lookup + 32);
+	table.val[3] = vld1q_u8(lookup + 48);
+
+	const auto mask = vdupq_n_u8(0x3F);
 
 	size_t i = 0;
-	for (; i + BinaryUnit - 1 < length; i += BinaryUnit) {
-		// Inner loop: turn 48 bytes into 64 base64 characters
-		cb(base64EncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
-		cb(base64EncodeLookup[((inputBuffer[i] & 0x03) << 4) | ((inputBuffer[i + 1] & 0xF0) >> 4)]);
-		cb(base64EncodeLookup[((inputBuffer[i + 1] & 0x0F) << 2)
-				| ((inputBuffer[i + 2] & 0xC0) >> 6)]);
-		cb(base64EncodeLookup[inputBuffer[i + 2] & 0x3F]);
-	}
-
-	if (i + 1 < length) {
-		// Handle the single '=' case
-		cb(base64EncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
-		cb(base64EncodeLookup[((inputBuffer[i] & 0x03) << 4) | ((inputBuffer[i + 1] & 0xF0) >> 4)]);
-		cb(base64EncodeLookup[(inputBuffer[i + 1] & 0x0F) << 2]);
-		cb('=');
-	} else if (i < length) {
-		// Handle the double '=' case
-		cb(base64EncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
-		cb(base64EncodeLookup[(inputBuffer[i] & 0x03) << 4]);
-		cb('=');
-		cb('=');
-	}
-}
-
-template <typename Callback>
-static void make_decode(StringView inputBuffer, const Callback &cb) {
-	auto length = inputBuffer.size();
+	for (; len - i >= 48; i += 48, out += 64) {
+		// bytes are deinterleaved, so lane N of every vector is the group N
+		const auto bytes = vld3q_u8(in + i);
+
+		uint8x16x4_t indices;
+		indices.val[0] = vshrq_n_u8(bytes.val[0], 2);
+		indices.val[1] =
+				vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask);
+		indices.val[2] =
+				vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask);
+		indices.val[3] = vandq_u8(bytes.val[2], mask);
+
+		uint8x16x4_t chars;
+		chars.val[0] = vqtbl4q_u8(table, indices.val[0]);
+		chars.val[1] = vqtbl4q_u8(table, indices.val[1]);
+		chars.val[2] = vqtbl4q_u8(table, indices.val[2]);
+		chars.val[3] = vqtbl4q_u8(table, indices.val[3]);
+		vst4q_u8(reinterpret_cast<uint8_t *>(out), chars);
+	}
+	return i;
+}
+
+static inline uint8x16_t dec_range_neon(uint8x16_t v, uint8_t lo, uint8_t hi) {
+	return vandq_u8(vcgeq_u8(v, vdupq_n_u8(lo)), vcleq_u8(v, vdupq_n_u8(hi)));
+}
+
+static inline bool dec_translate_neon(uint8x16_t v, uint8x16_t &out, uint32_t alphabets) {
+	const auto upper = dec_range_neon(v, 'A', 'Z');
+	const auto lower = dec_range_neon(v, 'a', 'z');
+	const auto digit = dec_range_neon(v, '0', '9');
+
+	auto valid = vorrq_u8(vorrq_u8(upper, lower), digit);
+	auto roll = vorrq_u8(vorrq_u8(vandq_u8(upper, vdupq_n_u8(uint8_t(-65))),
+								 vandq_u8(lower, vdupq_n_u8(uint8_t(-71)))),
+			vandq_u8(digit, vdupq_n_u8(4)));
+
+	if (alphabets & AlphabetStandard) {
+		const auto plus = vceqq_u8(v, vdupq_n_u8('+'));
+		const auto slash = vceqq_u8(v, vdupq_n_u8('/'));
+		valid = vorrq_u8(valid, vorrq_u8(plus, slash));
+		roll = vorrq_u8(roll,
+				vorrq_u8(vandq_u8(plus, vdupq_n_u8(uint8_t(62 - '+'))),
+						vandq_u8(slash, vdupq_n_u8(uint8_t(63 - '/')))));
+	}
+	if (alphabets & AlphabetUrl) {
+		const auto minus = vceqq_u8(v, vdupq_n_u8('-'));
+		const auto underscore = vceqq_u8(v, vdupq_n_u8('_'));
+		valid = vorrq_u8(valid, vorrq_u8(minus, underscore));
+		roll = vorrq_u8(roll,
+				vorrq_u8(vandq_u8(minus, vdupq_n_u8(uint8_t(62 - '-'))),
+						vandq_u8(underscore, vdupq_n_u8(uint8_t(63 - '_')))));
+	}
+
+	if (vminvq_u8(valid) == 0) {
+		return false;
+	}
+	out = vaddq_u8(v, roll);
+	return true;
+}
+
+static size_t decode_neon(const char *in, size_t len, uint8_t *out, size_t outsize,
+		uint32_t alphabets) {
+	size_t i = 0;
+	for (; len - i >= 64 && outsize >= 48; i += 64, out += 48, outsize -= 48) {
+		const auto chars = vld4q_u8(reinterpret_cast<const uint8_t *>(in + i));
+
+		uint8x16_t a, b, c, d;
+		if (!dec_translate_neon(chars.val[0], a, alphabets)
+				|| !dec_translate_neon(chars.val[1], b, alphabets)
+				|| !dec_translate_neon(chars.val[2], c, alphabets)
+				|| !dec_translate_neon(chars.val[3], d, alphabets)) {
+			break;
+		}
+
+		uint8x16x3_t bytes;
+		bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+		bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+		bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+		vst3q_u8(out, bytes);
+	}
+	return i;
+}
+
+static Kernels detectKernels() {
+	Kernels ret;
+	ret.encode = &encode_neon;
+	ret.decode = &decode_neon;
+	return ret;
+}
+
+#else
+
+static Kernels detectKernels() { return Kernels(); }
+
+#endif
+
+static const Kernels &getKernels() {
+	static Kernels kernels = detectKernels();
+	return kernels;
+}
+
+static inline void encodeGroup(const uint8_t *in, char *out, const char *lookup) {
+	const uint32_t v = (uint32_t(in[0]) << 16) | (uint32_t(in[1]) << 8) | uint32_t(in[2]);
+	out[0] = lookup[v >> 18];
+	out[1] = lookup[(v >> 12) & 0x3F];
+	out[2] = lookup[(v >> 6) & 0x3F];
+	out[3] = lookup[v & 0x3F];
+}
+
+// Encodes last 1 or 2 bytes, returns number of chars written
+static inline size_t encodeTail(const uint8_t *in, size_t len, char *out, const char *lookup,
+		bool padding) {
+	if (len == 1) {
+		out[0] = lookup[(in[0] & 0xFC) >> 2];
+		out[1] = lookup[(in[0] & 0x03) << 4];
+		if (padding) {
+			out[2] = '=';
+			out[3] = '=';
+			return 4;
+		}
+		return 2;
+	} else {
+		out[0] = lookup[(in[0] & 0xFC) >> 2];
+		out[1] = lookup[((in[0] & 0x03) << 4) | ((in[1] & 0xF0) >> 4)];
+		out[2] = lookup[(in[1] & 0x0F) << 2];
+		if (padding) {
+			out[3] = '=';
+			return 4;
+		}
+		return 3;
+	}
+}
+
+// Encodes complete groups, returns number of chars written
+static size_t encodeGroups(const uint8_t *in, size_t groups, char *out, bool url) {
+	const auto lookup = url ? base64UrlEncodeLookup : base64EncodeLookup;
+	const auto len = groups * BinaryUnit;
 
 	size_t i = 0;
-	while (i < length) {
-		// Accumulate 4 valid characters (ignore everything else)
-		unsigned char accumulated[Base64Unit];
-		size_t accumulateIndex = 0;
-		while (i < length) {
-			unsigned char decode = base64DecodeLookup[(unsigned char)inputBuffer[i++]];
-			if (decode != xx) {
-				accumulated[accumulateIndex] = decode;
-				accumulateIndex++;
-				if (accumulateIndex == Base64Unit) {
-					break;
+	if (auto kernel = getKernels().encode) {
+		i = kernel(in, len, out, url);
+	}
+
+	auto target = out + (i / BinaryUnit) * Base64Unit;
+	for (; i < len; i += BinaryUnit, target += Base64Unit) { encodeGroup(in + i, target, lookup); }
+	return groups * Base64Unit;
+}
+
+static size_t encodeBuffer(const uint8_t *in, size_t insize, char *out, size_t outsize,
+		bool url) {
+	// output is truncated, when buffer is too small
+	const auto groups = sprt::min(insize / BinaryUnit, outsize / Base64Unit);
+
+	size_t accum = encodeGroups(in, groups, out, url);
+
+	auto remains = insize - groups * BinaryUnit;
+	if (remains > 0 && accum < outsize) {
+		char buf[Base64Unit];
+		size_t len = 0;
+		if (remains >= BinaryUnit) {
+			encodeGroup(in + groups * BinaryUnit, buf, url ? base64UrlEncodeLookup : base64EncodeLookup);
+			len = Base64Unit;
+		} else {
+			len = encodeTail(in + groups * BinaryUnit, remains, buf,
+					url ? base64UrlEncodeLookup : base64EncodeLookup, !url);
+		}
+		len = sprt::min(len, outsize - accum);
+		__builtin_memcpy(out + accum, buf, len);
+		accum += len;
+	}
+	return accum;
+}
+
+struct DecodeState {
+	uint32_t accum = 0;
+	uint8_t count = 0;
+	uint8_t padding = 0;
+	bool finished = false;
+};
+
+struct DecodeOutput {
+	uint8_t *target;
+	uint8_t *end;
+
+	bool put(uint8_t c) {
+		if (target == end) {
+			return false;
+		}
+		*target++ = c;
+		return true;
+	}
+};
+
+// Writes incomplete group of 2 or 3 chars
+static Status decodePartial(DecodeState &st, DecodeOutput &out, DecodeMode mode) {
+	if (st.count == 2) {
+		if (mode == DecodeMode::Strict && (st.accum & 0xF) != 0) {
+			return Status::ErrorInvalidArguemnt;
+		}
+		if (!out.put(uint8_t(st.accum >> 4))) {
+			return Status::ErrorBufferOverflow;
+		}
+	} else if (st.count == 3) {
+		if (mode == DecodeMode::Strict && (st.accum & 0x3) != 0) {
+			return Status::ErrorInvalidArguemnt;
+		}
+		if (!out.put(uint8_t(st.accum >> 10)) || !out.put(uint8_t(st.accum >> 2))) {
+			return Status::ErrorBufferOverflow;
+		}
+	}
+	st.accum = 0;
+	st.count = 0;
+	return Status::Ok;
+}
+
+static Status decodeBuffer(DecodeState &st, const char *in, size_t insize, DecodeOutput &out,
+		DecodeMode mode, bool url) {
+	const uint8_t *table = nullptr;
+	uint32_t alphabets = 0;
+	if (mode == DecodeMode::Lenient) {
+		table = base64DecodeLookup;
+		alphabets = AlphabetStandard | AlphabetUrl;
+	} else if (url) {
+		table = s_decodeUrl.data;
+		alphabets = AlphabetUrl;
+	} else {
+		table = s_decodeStandard.data;
+		alphabets = AlphabetStandard;
+	}
+
+	auto kernel = getKernels().decode;
+
+	auto ptr = in;
+	const auto end = in + insize;
+	auto slow = kernel ? ptr : end;
+
+	while (ptr < end) {
+		// kernels work only from the group boundary
+		if (ptr >= slow && st.count == 0 && !st.finished) {
+			auto consumed = kernel(ptr, end - ptr, out.target, out.end - out.target, alphabets);
+			ptr += consumed;
+			out.target += (consumed / Base64Unit) * BinaryUnit;
+
+			// next block is not usable for kernel, decode it with the scalar loop
+			slow = ptr + 64;
+			if (ptr == end) {
+				break;
+			}
+		}
+
+		const auto c = uint8_t(*ptr++);
+		const auto value = table[c];
+		if (value == xx) {
+			if (mode == DecodeMode::Lenient) {
+				continue;
+			}
+
+			// padding completes the group of 2 or 3 chars
+			if (c != '=' || st.finished || st.count < 2) {
+				return Status::ErrorInvalidArguemnt;
+			}
+			if (st.count + ++st.padding == Base64Unit) {
+				auto status = decodePartial(st, out, mode);
+				if (status != Status::Ok) {
+					return status;
 				}
+				st.padding = 0;
+				st.finished = true;
 			}
+			continue;
 		}
 
-		if (accumulateIndex >= 2) {
-			cb((accumulated[0] << 2) | (accumulated[1] >> 4));
+		if (st.padding > 0 || st.finished) {
+			// data after padding
+			return Status::ErrorInvalidArguemnt;
 		}
-		if (accumulateIndex >= 3) {
-			cb((accumulated[1] << 4) | (accumulated[2] >> 2));
+
+		st.accum = (st.accum << 6) | value;
+		if (++st.count == Base64Unit) {
+			if (!out.put(uint8_t(st.accum >> 16)) || !out.put(uint8_t(st.accum >> 8))
+					|| !out.put(uint8_t(st.accum))) {
+				return Status::ErrorBufferOverflow;
+			}
+			st.accum = 0;
+			st.count = 0;
 		}
-		if (accumulateIndex >= 4) {
-			cb((accumulated[2] << 6) | accumulated[3]);
+	}
+	return Status::Ok;
+}
+
+static Status decodeFinalize(DecodeState &st, DecodeOutput &out, DecodeMode mode, bool url) {
+	if (mode == DecodeMode::Strict) {
+		if (st.padding > 0 || st.count == 1 || (st.count > 0 && !url)) {
+			// incomplete padding, or required padding is missing
+			return Status::ErrorInvalidArguemnt;
 		}
+	} else if (st.count == 1) {
+		st.count = 0;
+		st.accum = 0;
+	}
+	return decodePartial(st, out, mode);
+}
+
+static Status decodeStrict(const char *in, size_t insize, uint8_t *out, size_t outsize,
+		size_t *ret, DecodeMode mode, bool url) {
+	if (!out && outsize > 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	DecodeState st;
+	DecodeOutput output{out, out + outsize};
+	auto status = decodeBuffer(st, in, insize, output, mode, url);
+	if (status == Status::Ok) {
+		status = decodeFinalize(st, output, mode, url);
 	}
+	if (ret) {
+		*ret = output.target - out;
+	}
+	return status;
 }
 
 #undef xx
 
 size_t encode(const uint8_t *in, size_t insize, char *out, size_t outsize) {
-	size_t accum = 0;
-	if (outsize < getEncodeSize(insize)) {
-		make_encode(BytesView(in, insize), [&](const char &c) {
-			if (accum < outsize) {
-				out[accum++] = c;
-			}
-		});
-	} else {
-		make_encode(BytesView(in, insize), [&](const char &c) { out[accum++] = c; });
-	}
-	return accum;
+	return encodeBuffer(in, insize, out, outsize, false);
 }
 
 size_t encode(const uint8_t *in, size_t insize, const callback<void(const char *, size_t)> &cb) {
@@ -152,17 +711,10 @@ size_t encode(const uint8_t *in, size_t insize, const callback<void(const char *
 }
 
 size_t decode(const char *in, size_t insize, uint8_t *out, size_t outsize) {
-	size_t accum = 0;
-	if (outsize < getDecodeSize(insize)) {
-		make_decode(StringView(in, insize), [&](const uint8_t &c) {
-			if (accum < outsize) {
-				out[accum++] = c;
-			}
-		});
-	} else {
-		make_decode(StringView(in, insize), [&](const uint8_t &c) { out[accum++] = c; });
-	}
-	return accum;
+	// output is truncated, when buffer is too small
+	size_t ret = 0;
+	decodeStrict(in, insize, out, outsize, &ret, DecodeMode::Lenient, false);
+	return ret;
 }
 
 size_t decode(const char *in, size_t insize, const callback<void(const uint8_t *, size_t)> &cb) {
@@ -178,55 +730,120 @@ size_t decode(const char *in, size_t insize, const callback<void(const uint8_t *
 	return ret;
 }
 
-} // namespace sprt::base64
+Status decode(const char *in, size_t insize, uint8_t *out, size_t outsize, size_t *ret,
+		DecodeMode mode) {
+	return decodeStrict(in, insize, out, outsize, ret, mode, false);
+}
 
-namespace sprt::base64url {
+Status Encoder::update(const uint8_t *in, size_t size, char *out, size_t outsize, size_t *ret) {
+	if (outsize < ((_tailSize + size) / BinaryUnit) * Base64Unit) {
+		return Status::ErrorBufferOverflow;
+	}
 
-// Mapping from 6 bit pattern to ASCII character.
-static const char *base64EncodeLookup =
-		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+	size_t written = 0;
+	if (_tailSize > 0) {
+		if (_tailSize + size < BinaryUnit) {
+			__builtin_memcpy(_tail + _tailSize, in, size);
+			_tailSize += size;
+			if (ret) {
+				*ret = 0;
+			}
+			return Status::Ok;
+		}
 
-constexpr int BinaryUnit = 3;
+		uint8_t group[BinaryUnit];
+		const size_t fill = BinaryUnit - _tailSize;
+		__builtin_memcpy(group, _tail, _tailSize);
+		__builtin_memcpy(group + _tailSize, in, fill);
+		encodeGroup(group, out, _url ? base64UrlEncodeLookup : base64EncodeLookup);
 
-template <typename Callback>
-static void make_encode(BytesView inputBuffer, const Callback &cb) {
-	auto length = inputBuffer.size();
+		written = Base64Unit;
+		in += fill;
+		size -= fill;
+		_tailSize = 0;
+	}
 
-	size_t i = 0;
-	for (; i + BinaryUnit - 1 < length; i += BinaryUnit) {
-		// Inner loop: turn 48 bytes into 64 base64 characters
-		cb(base64EncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
-		cb(base64EncodeLookup[((inputBuffer[i] & 0x03) << 4) | ((inputBuffer[i + 1] & 0xF0) >> 4)]);
-		cb(base64EncodeLookup[((inputBuffer[i + 1] & 0x0F) << 2)
-				| ((inputBuffer[i + 2] & 0xC0) >> 6)]);
-		cb(base64EncodeLookup[inputBuffer[i + 2] & 0x3F]);
+	const auto groups = size / BinaryUnit;
+	written += encodeGroups(in, groups, out + written, _url);
+
+	_tailSize = size - groups * BinaryUnit;
+	__builtin_memcpy(_tail, in + groups * BinaryUnit, _tailSize);
+
+	if (ret) {
+		*ret = written;
+	}
+	return Status::Ok;
+}
+
+Status Encoder::finalize(char *out, size_t outsize, size_t *ret) {
+	size_t written = 0;
+	if (_tailSize > 0) {
+		char buf[Base64Unit];
+		auto len = encodeTail(_tail, _tailSize, buf, _url ? base64UrlEncodeLookup : base64EncodeLookup,
+				!_url);
+		if (outsize < len) {
+			return Status::ErrorBufferOverflow;
+		}
+		__builtin_memcpy(out, buf, len);
+		written = len;
+		_tailSize = 0;
+	}
+	if (ret) {
+		*ret = written;
+	}
+	return Status::Ok;
+}
+
+Status Decoder::update(const char *in, size_t size, uint8_t *out, size_t outsize, size_t *ret) {
+	if (_failed) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	if (outsize < ((_count + _padding + size) / Base64Unit) * BinaryUnit) {
+		return Status::ErrorBufferOverflow;
 	}
 
-	if (i + 1 < length) {
-		// Handle the single '=' case
-		cb(base64EncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
-		cb(base64EncodeLookup[((inputBuffer[i] & 0x03) << 4) | ((inputBuffer[i + 1] & 0xF0) >> 4)]);
-		cb(base64EncodeLookup[(inputBuffer[i + 1] & 0x0F) << 2]);
-	} else if (i < length) {
-		// Handle the double '=' case
-		cb(base64EncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
-		cb(base64EncodeLookup[(inputBuffer[i] & 0x03) << 4]);
+	DecodeState st{_accum, _count, _padding, _finished};
+	DecodeOutput output{out, out + outsize};
+
+	auto status = decodeBuffer(st, in, size, output, _mode, _url);
+
+	_accum = st.accum;
+	_count = st.count;
+	_padding = st.padding;
+	_finished = st.finished;
+	_failed = (status != Status::Ok);
+
+	if (ret) {
+		*ret = output.target - out;
 	}
+	return status;
 }
 
+Status Decoder::finalize(uint8_t *out, size_t outsize, size_t *ret) {
+	DecodeState st{_accum, _count, _padding, _finished};
+	DecodeOutput output{out, out + outsize};
 
-size_t encode(const uint8_t *in, size_t insize, char *out, size_t outsize) {
-	size_t accum = 0;
-	if (outsize < getEncodeSize(insize)) {
-		make_encode(BytesView(in, insize), [&](const char &c) {
-			if (accum < outsize) {
-				out[accum++] = c;
-			}
-		});
-	} else {
-		make_encode(BytesView(in, insize), [&](const char &c) { out[accum++] = c; });
+	auto status = _failed ? Status::ErrorInvalidArguemnt : decodeFinalize(st, output, _mode, _url);
+
+	_accum = 0;
+	_count = 0;
+	_padding = 0;
+	_finished = false;
+	_failed = false;
+
+	if (ret) {
+		*ret = output.target - out;
 	}
-	return accum;
+	return status;
+}
+
+} // namespace sprt::base64
+
+namespace sprt::base64url {
+
+size_t encode(const uint8_t *in, size_t insize, char *out, size_t outsize) {
+	return base64::encodeBuffer(in, insize, out, outsize, true);
 }
 
 size_t encode(const uint8_t *in, size_t insize, const callback<void(const char *, size_t)> &cb) {
@@ -244,8 +861,14 @@ size_t encode(const uint8_t *in, size_t insize, const callback<void(const char *
 	return ret;
 }
 
+Status decode(const char *in, size_t insize, uint8_t *out, size_t outsize, size_t *ret,
+		base64::DecodeMode mode) {
+	return base64::decodeStrict(in, insize, out, outsize, ret, mode, true);
+}
+
 } // namespace sprt::base64url
 
+
 namespace sprt::base16 {
 
 // clang-format off
@@ -316,22 +939,113 @@ uint8_t toChar(const char &c) { return s_decTable[reinterpret_cast<const uint8_t
 
 uint8_t toChar(const char &c, const char &d) { return (toChar(c) << 4) | toChar(d); }
 
-size_t encode(const uint8_t *in, size_t insize, char *out, size_t outsize, bool upper) {
-	BytesView inputBuffer(in, insize);
+#if __SSE2__
 
-	const auto length = inputBuffer.size();
+static inline __m128i hex_chars_sse2(__m128i nibbles, bool upper) {
+	const auto letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+	const auto shift = _mm_and_si128(letters, _mm_set1_epi8(upper ? 'A' - '0' - 10 : 'a' - '0' - 10));
+	return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), shift);
+}
 
-	size_t bytes = 0;
-	for (size_t i = 0; i < length; ++i) {
-		if (bytes + 2 <= outsize) {
-			__builtin_memcpy(out + i * 2,
-					upper ? s_hexTable_upper[inputBuffer[i]] : s_hexTable_lower[inputBuffer[i]], 2);
-			bytes += 2;
-		} else {
-			break;
-		}
+// Encodes blocks of 16 bytes, returns number of consumed bytes
+static size_t encode_sse2(const uint8_t *in, size_t len, char *out, bool upper) {
+	const auto mask = _mm_set1_epi8(0x0F);
+
+	size_t i = 0;
+	for (; len - i >= 16; i += 16, out += 32) {
+		const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+		const auto hi = hex_chars_sse2(_mm_and_si128(_mm_srli_epi16(v, 4), mask), upper);
+		const auto lo = hex_chars_sse2(_mm_and_si128(v, mask), upper);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), _mm_unpackhi_epi8(hi, lo));
+	}
+	return i;
+}
+
+// Same as s_decTable: digits and a-f/A-F, 0 for other chars
+static inline __m128i hex_nibbles_sse2(__m128i v) {
+	// signed compare, bytes above 0x7F never match
+	const auto lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+	const auto digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+			_mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), v));
+	const auto letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+			_mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+	return _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(v, _mm_set1_epi8('0'))),
+			_mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+// Decodes blocks of 32 chars, returns number of produced bytes
+static size_t decode_sse2(const char *in, size_t bytes, uint8_t *out) {
+	size_t i = 0;
+	for (; bytes - i >= 16; i += 16) {
+		auto n0 = hex_nibbles_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 2)));
+		auto n1 = hex_nibbles_sse2(
+				_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 2 + 16)));
+
+		// every 16-bit lane is [high nibble, low nibble]
+		n0 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(n0, _mm_set1_epi16(0xFF)), 4),
+				_mm_srli_epi16(n0, 8));
+		n1 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(n1, _mm_set1_epi16(0xFF)), 4),
+				_mm_srli_epi16(n1, 8));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(n0, n1));
 	}
-	return bytes;
+	return i;
+}
+
+#elif SPRT_BASE64_NEON
+
+static size_t encode_neon(const uint8_t *in, size_t len, char *out, bool upper) {
+	const auto table = vld1q_u8(
+			reinterpret_cast<const uint8_t *>(upper ? "0123456789ABCDEF" : "0123456789abcdef"));
+
+	size_t i = 0;
+	for (; len - i >= 16; i += 16, out += 32) {
+		const auto v = vld1q_u8(in + i);
+		uint8x16x2_t chars;
+		chars.val[0] = vqtbl1q_u8(table, vshrq_n_u8(v, 4));
+		chars.val[1] = vqtbl1q_u8(table, vandq_u8(v, vdupq_n_u8(0x0F)));
+		vst2q_u8(reinterpret_cast<uint8_t *>(out), chars);
+	}
+	return i;
+}
+
+// Same as s_decTable: digits and a-f/A-F, 0 for other chars
+static inline uint8x16_t hex_nibbles_neon(uint8x16_t v) {
+	const auto lower = vorrq_u8(v, vdupq_n_u8(0x20));
+	const auto digit = vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9')));
+	const auto letter =
+			vandq_u8(vcgeq_u8(lower, vdupq_n_u8('a')), vcleq_u8(lower, vdupq_n_u8('f')));
+	return vorrq_u8(vandq_u8(digit, vsubq_u8(v, vdupq_n_u8('0'))),
+			vandq_u8(letter, vsubq_u8(lower, vdupq_n_u8('a' - 10))));
+}
+
+static size_t decode_neon(const char *in, size_t bytes, uint8_t *out) {
+	size_t i = 0;
+	for (; bytes - i >= 16; i += 16) {
+		const auto chars = vld2q_u8(reinterpret_cast<const uint8_t *>(in + i * 2));
+		const auto hi = hex_nibbles_neon(chars.val[0]);
+		const auto lo = hex_nibbles_neon(chars.val[1]);
+		vst1q_u8(out + i, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+	}
+	return i;
+}
+
+#endif
+
+size_t encode(const uint8_t *in, size_t insize, char *out, size_t outsize, bool upper) {
+	// output is truncated to the whole bytes, when buffer is too small
+	const auto length = sprt::min(insize, outsize / 2);
+
+	size_t i = 0;
+#if __SSE2__
+	i = encode_sse2(in, length, out, upper);
+#elif SPRT_BASE64_NEON
+	i = encode_neon(in, length, out, upper);
+#endif
+
+	const auto table = upper ? s_hexTable_upper : s_hexTable_lower;
+	for (; i < length; ++i) { __builtin_memcpy(out + i * 2, table[in[i]], 2); }
+	return length * 2;
 }
 
 size_t encode(const uint8_t *in, size_t insize, const callback<void(const char *, size_t)> &cb,
@@ -351,19 +1065,21 @@ size_t encode(const uint8_t *in, size_t insize, const callback<void(const char *
 }
 
 size_t decode(const char *in, size_t insize, uint8_t *out, size_t outsize) {
-	const auto length = insize;
-
-	size_t bytes = 0;
-	for (size_t i = 0; i < length; i += 2) {
-		if (bytes + 1 <= outsize) {
-			out[bytes] = uint8_t((s_decTable[static_cast<uint8_t>(in[i])] << 4)
-					| s_decTable[static_cast<uint8_t>(in[i + 1])]);
-			++bytes;
-		} else {
-			break;
-		}
+	// odd trailing char is ignored
+	const auto length = sprt::min(insize / 2, outsize);
+
+	size_t i = 0;
+#if __SSE2__
+	i = decode_sse2(in, length, out);
+#elif SPRT_BASE64_NEON
+	i = decode_neon(in, length, out);
+#endif
+
+	for (; i < length; ++i) {
+		out[i] = uint8_t((s_decTable[static_cast<uint8_t>(in[i * 2])] << 4)
+				| s_decTable[static_cast<uint8_t>(in[i * 2 + 1])]);
 	}
-	return bytes;
+	return length;
 }
 
 size_t decode(const char *in, size_t insize, const callback<void(const uint8_t *, size_t)> &cb) {
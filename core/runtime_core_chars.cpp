@@ -22,6 +22,18 @@ THE SOFTWARE.
 
 #include <sprt/runtime/chargroup.h>
 
+#if __AVX2__
+#include <simde/x86/avx2.h>
+#define SPRT_CHARS_SIMD_AVX2 1
+#elif __SSSE3__ || __ARM_NEON
+// on ARM, SIMDe maps byte shuffles to vqtbl1q_u8
+#include <simde/x86/ssse3.h>
+#define SPRT_CHARS_SIMD_SHUFFLE 1
+#elif __SSE2__
+#include <simde/x86/sse2.h>
+#define SPRT_CHARS_SIMD_SSE2 1
+#endif
+
 namespace sprt {
 
 bool inCharGroup(CharGroupId mask, char16_t c) {
@@ -188,6 +200,139 @@ bool CharGroup<char, GroupId::TextPunctuation>::match(char c) {
 	return smart_lookup_table[((const uint8_t *)&c)[0]] & toInt(SmartType::TextPunctuation);
 }
 
+static size_t scanCharTable_scalar(const CharTable &t, const char *ptr, size_t len, bool value) {
+	size_t offset = 0;
+	while (offset < len && t.test(ptr[offset]) == value) { ++offset; }
+	return offset;
+}
+
+#if SPRT_CHARS_SIMD_AVX2 || SPRT_CHARS_SIMD_SHUFFLE
+
+// Shuffle-based classification (W. Mula): low nibble selects a row of membership bits,
+// high nibble selects a bit within it; rows for high nibble >= 8 are in a separate table,
+// shuffle with the sign bit set produces zero, so both tables can be applied with OR
+
+#if SPRT_CHARS_SIMD_AVX2
+static size_t scanCharTable_simd(const CharTable &t, const char *ptr, size_t len, bool value) {
+	auto low = simde_mm256_broadcastsi128_si256(
+			simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(t.low)));
+	auto high = simde_mm256_broadcastsi128_si256(
+			simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(t.high)));
+	auto bitLut = simde_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+			1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	auto indexMask = simde_mm256_set1_epi8(int8_t(0x8F));
+	auto signBit = simde_mm256_set1_epi8(int8_t(0x80));
+	auto nibbleMask = simde_mm256_set1_epi8(0x0F);
+	auto zero = simde_mm256_setzero_si256();
+
+	uint32_t expected = value ? 0xFFFF'FFFF : 0;
+
+	size_t offset = 0;
+	while (offset + 32 <= len) {
+		auto v = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i *>(ptr + offset));
+		auto idx = simde_mm256_and_si256(v, indexMask);
+		auto rows = simde_mm256_or_si256(simde_mm256_shuffle_epi8(low, idx),
+				simde_mm256_shuffle_epi8(high, simde_mm256_xor_si256(idx, signBit)));
+		auto bits = simde_mm256_shuffle_epi8(bitLut,
+				simde_mm256_and_si256(simde_mm256_srli_epi16(v, 4), nibbleMask));
+		auto nonMatched = simde_mm256_cmpeq_epi8(simde_mm256_and_si256(rows, bits), zero);
+
+		auto diff = ~uint32_t(simde_mm256_movemask_epi8(nonMatched)) ^ expected;
+		if (diff) {
+			return offset + sprt::countr_zero(diff);
+		}
+		offset += 32;
+	}
+
+	return offset + scanCharTable_scalar(t, ptr + offset, len - offset, value);
+}
+#else
+static size_t scanCharTable_simd(const CharTable &t, const char *ptr, size_t len, bool value) {
+	auto low = simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(t.low));
+	auto high = simde_mm_load_si128(reinterpret_cast<const simde__m128i *>(t.high));
+	auto bitLut = simde_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	auto indexMask = simde_mm_set1_epi8(int8_t(0x8F));
+	auto signBit = simde_mm_set1_epi8(int8_t(0x80));
+	auto nibbleMask = simde_mm_set1_epi8(0x0F);
+	auto zero = simde_mm_setzero_si128();
+
+	uint32_t expected = value ? 0xFFFF : 0;
+
+	size_t offset = 0;
+	while (offset + 16 <= len) {
+		auto v = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i *>(ptr + offset));
+		auto idx = simde_mm_and_si128(v, indexMask);
+		auto rows = simde_mm_or_si128(simde_mm_shuffle_epi8(low, idx),
+				simde_mm_shuffle_epi8(high, simde_mm_xor_si128(idx, signBit)));
+		auto bits = simde_mm_shuffle_epi8(bitLut,
+				simde_mm_and_si128(simde_mm_srli_epi16(v, 4), nibbleMask));
+		auto nonMatched = simde_mm_cmpeq_epi8(simde_mm_and_si128(rows, bits), zero);
+
+		auto diff = (~uint32_t(simde_mm_movemask_epi8(nonMatched)) & 0xFFFF) ^ expected;
+		if (diff) {
+			return offset + sprt::countr_zero(diff);
+		}
+		offset += 16;
+	}
+
+	return offset + scanCharTable_scalar(t, ptr + offset, len - offset, value);
+}
+#endif
+
+#elif SPRT_CHARS_SIMD_SSE2
+
+// SSE2 has no byte shuffle, compare with the table's runs instead (for tables with few runs)
+static size_t scanCharTable_simd(const CharTable &t, const char *ptr, size_t len, bool value) {
+	if (t.nranges > CharTable::MaxRanges) {
+		return scanCharTable_scalar(t, ptr, len, value);
+	}
+
+	// unsigned bytes are compared as signed after flipping the sign bit
+	auto signBit = simde_mm_set1_epi8(int8_t(0x80));
+	auto ones = simde_mm_set1_epi8(int8_t(0xFF));
+
+	simde__m128i first[CharTable::MaxRanges];
+	simde__m128i last[CharTable::MaxRanges];
+	for (uint32_t i = 0; i < t.nranges; ++i) {
+		first[i] = simde_mm_set1_epi8(int8_t(t.ranges[i][0] ^ 0x80));
+		last[i] = simde_mm_set1_epi8(int8_t(t.ranges[i][1] ^ 0x80));
+	}
+
+	uint32_t expected = value ? 0xFFFF : 0;
+
+	size_t offset = 0;
+	while (offset + 16 <= len) {
+		auto v = simde_mm_xor_si128(
+				simde_mm_loadu_si128(reinterpret_cast<const simde__m128i *>(ptr + offset)),
+				signBit);
+
+		auto matched = simde_mm_setzero_si128();
+		for (uint32_t i = 0; i < t.nranges; ++i) {
+			auto outside = simde_mm_or_si128(simde_mm_cmplt_epi8(v, first[i]),
+					simde_mm_cmpgt_epi8(v, last[i]));
+			matched = simde_mm_or_si128(matched, simde_mm_andnot_si128(outside, ones));
+		}
+
+		auto diff = uint32_t(simde_mm_movemask_epi8(matched)) ^ expected;
+		if (diff) {
+			return offset + sprt::countr_zero(diff);
+		}
+		offset += 16;
+	}
+
+	return offset + scanCharTable_scalar(t, ptr + offset, len - offset, value);
+}
+
+#endif
+
+size_t scanCharTable(const CharTable &t, const char *ptr, size_t len, bool value) {
+#if SPRT_CHARS_SIMD_AVX2 || SPRT_CHARS_SIMD_SHUFFLE || SPRT_CHARS_SIMD_SSE2
+	return scanCharTable_simd(t, ptr, len, value);
+#else
+	return scanCharTable_scalar(t, ptr, len, value);
+#endif
+}
+
 } // namespace chars
 
 } // namespace sprt
@@ -25,6 +25,14 @@
 #include <sprt/runtime/log.h>
 #include <sprt/c/__sprt_stdlib.h>
 #include <sprt/c/__sprt_stdio.h>
+#include <sprt/c/__sprt_unistd.h>
+#include <sprt/c/__sprt_pthread.h>
+#include <sprt/c/__sprt_sched.h>
+#include <sprt/c/__sprt_string.h>
+#include <sprt/c/__sprt_errno.h>
+#include <sprt/runtime/platform.h>
+#include <sprt/cxx/atomic>
+#include <sprt/cxx/algorithm>
 
 #if SPRT_ANDROID
 #include <sprt/c/sys/__sprt_alog.h>
@@ -414,7 +422,730 @@ static void checkLogFeaturesSupport(LogFeaturesInit &ret) { }
 
 static LogFeaturesInit s_logInit;
 
+// Binary log stream is a sequence of records, every record starts with LogRecordHeader
+// - Stream record starts a new stream (so, streams can be concatenated), `site` is LogStreamMagic
+// - Site record binds format-site id with the source file name (follows the header)
+// - Message record contains tag and encoded arguments (see LogArgType)
+// Site record is written once for a site, but it can be written after the message from
+// the other thread in async mode, so, decoder resolves sites before messages
+enum class LogRecordKind : uint8_t {
+	Stream = 1,
+	Site,
+	Message,
+};
+
+struct LogRecordHeader {
+	uint32_t size; // full record size, including header
+	LogRecordKind kind;
+	uint8_t type;
+	uint16_t tagSize;
+	uint32_t line;
+	uint32_t reserved;
+	uint64_t site;
+	uint64_t time;
+};
+
+static_assert(sizeof(LogRecordHeader) == 32);
+
+static constexpr uint64_t LogStreamMagic = 0x3147'4F4C'5452'5053; // "SPRTLOG1" in little endian
+static constexpr uint32_t LogStreamVersion = 1;
+
+struct LogBinaryState {
+	static constexpr size_t SiteTableSize = 1'024;
+
+	atomic<int> fd = -1;
+
+	// known format sites, addresses of the source_location::file_name
+	atomic<const char *> sites[SiteTableSize];
+};
+
+static LogBinaryState s_logBinary;
+
+// Returns true if site was not known, and Site record should be written
+static bool registerLogSite(const char *file) {
+	auto hash = (uint64_t(uintptr_t(file)) * 0x9E37'79B9'7F4A'7C15ULL) >> 32;
+	for (size_t i = 0; i < LogBinaryState::SiteTableSize; ++i) {
+		auto &slot = s_logBinary.sites[(hash + i) & (LogBinaryState::SiteTableSize - 1)];
+		auto value = slot.load(memory_order::acquire);
+		if (value == file) {
+			return false;
+		} else if (!value) {
+			if (slot.compare_exchange_strong(value, file, memory_order::acq_rel)
+					|| value == file) {
+				return value == nullptr;
+			}
+		}
+	}
+
+	// table is full, write Site record with every message
+	return true;
+}
+
+static uint8_t *writeLogRecordHeader(uint8_t *target, size_t size, LogRecordKind kind,
+		LogType type, uint16_t tagSize, uint32_t line, uint64_t site) {
+	LogRecordHeader header{uint32_t(size), kind, uint8_t(type), tagSize, line, 0, site,
+		platform::clock(platform::ClockType::Realtime)};
+	__sprt_memcpy(target, &header, sizeof(LogRecordHeader));
+	return target + sizeof(LogRecordHeader);
+}
+
+static uint8_t *writeLogTextArg(uint8_t *target, StringView text) {
+	auto size = uint32_t(text.size());
+	*target++ = uint8_t(LogArgType::Text);
+	__sprt_memcpy(target, &size, sizeof(uint32_t));
+	target += sizeof(uint32_t);
+	__sprt_memcpy(target, text.data(), text.size());
+	return target + text.size();
+}
+
+static constexpr size_t getLogTextRecordSize(StringView tag, StringView text) {
+	return sizeof(LogRecordHeader) + tag.size() + 1 + sizeof(uint32_t) + text.size();
+}
+
+static size_t writeLogTextRecord(uint8_t *buf, LogType type, StringView tag, StringView text) {
+	auto size = getLogTextRecordSize(tag, text);
+	auto target = writeLogRecordHeader(buf, size, LogRecordKind::Message, type,
+			uint16_t(tag.size()), 0, 0);
+	__sprt_memcpy(target, tag.data(), tag.size());
+	writeLogTextArg(target + tag.size(), text);
+	return size;
+}
+
+static int getLogOutputFd() {
+	auto fd = s_logBinary.fd.load(memory_order::acquire);
+	return fd >= 0 ? fd : 2;
+}
+
+#if !SPRT_ANDROID
+
+// Asynchronous log: every producer thread owns SPSC ring buffer, drain thread is the only
+// consumer. Record is [uint32_t length][message], aligned to 8 bytes. When record does not fit
+// into the end of the buffer, SkipMarker is written and record starts from the beginning.
+//
+// Rings are never freed while process is running: ring of the finished thread is released
+// and can be claimed by a new thread, so number of rings is bounded by number of concurrent
+// threads, that used log.
+struct LogRing {
+	static constexpr uint32_t SkipMarker = Max<uint32_t>;
+
+	LogRing *next = nullptr; // registry, push-only
+	atomic<bool> owned = true;
+
+	uint8_t *data = nullptr;
+	size_t capacity = 0;
+
+	alignas(64) atomic<uint64_t> head = 0; // producer position
+	alignas(64) atomic<uint64_t> tail = 0; // consumer position
+	atomic<uint64_t> dropped = 0;
+
+	static constexpr size_t getRecordSize(size_t size) {
+		return (sizeof(uint32_t) + size + 7) & ~size_t(7);
+	}
+
+	bool push(const char *, size_t);
+};
+
+struct LogThreadSlot {
+	LogRing *ring = nullptr;
+
+	~LogThreadSlot();
+};
+
+struct LogAsyncState {
+	atomic<bool> enabled = false;
+	atomic<bool> pending = false;
+	atomic<LogRing *> rings = nullptr;
+
+	bool running = false;
+	size_t bufferSize = 0;
+	LogOverflow overflow = LogOverflow::Count;
+
+	__sprt_pthread_t thread;
+	__sprt_pthread_mutex_t mutex = __SPRT_PTHREAD_MUTEX_INITIALIZER; // drain thread wakeup
+	__sprt_pthread_cond_t cond = __SPRT_PTHREAD_COND_INITIALIZER;
+	__sprt_pthread_mutex_t drainMutex = __SPRT_PTHREAD_MUTEX_INITIALIZER; // single consumer
+
+	~LogAsyncState() { disableAsync(); }
+};
+
+static LogAsyncState s_logAsync;
+
+static thread_local bool tl_logSlotFinalized = false;
+
+static LogThreadSlot *getLogThreadSlot() {
+	if (tl_logSlotFinalized) {
+		return nullptr;
+	}
+
+	static thread_local LogThreadSlot tl_slot;
+	return &tl_slot;
+}
+
+LogThreadSlot::~LogThreadSlot() {
+	tl_logSlotFinalized = true;
+	if (ring) {
+		ring->owned.store(false, memory_order::release);
+		ring = nullptr;
+	}
+}
+
+bool LogRing::push(const char *buf, size_t size) {
+	auto recordSize = getRecordSize(size);
+	if (recordSize > capacity / 2) {
+		return false;
+	}
+
+	auto h = head.load(memory_order::relaxed);
+	auto t = tail.load(memory_order::acquire);
+
+	auto offset = h & (capacity - 1);
+	auto contiguous = capacity - offset;
+	auto required = (contiguous < recordSize) ? contiguous + recordSize : recordSize;
+
+	if (capacity - (h - t) < required) {
+		return false;
+	}
+
+	if (contiguous < recordSize) {
+		// offset is always aligned to 8, so there is a space for a marker
+		*reinterpret_cast<uint32_t *>(data + offset) = SkipMarker;
+		h += contiguous;
+		offset = 0;
+	}
+
+	*reinterpret_cast<uint32_t *>(data + offset) = uint32_t(size);
+	__sprt_memcpy(data + offset + sizeof(uint32_t), buf, size);
+
+	head.store(h + recordSize, memory_order::release);
+	return true;
+}
+
+static LogRing *acquireLogRing(size_t bufferSize) {
+	auto ring = s_logAsync.rings.load(memory_order::acquire);
+	while (ring) {
+		bool expected = false;
+		if (ring->capacity == bufferSize
+				&& ring->owned.compare_exchange_strong(expected, true, memory_order::acquire)) {
+			return ring;
+		}
+		ring = ring->next;
+	}
+
+	auto data = (uint8_t *)__sprt_malloc(bufferSize);
+	if (!data) {
+		return nullptr;
+	}
+
+	auto mem = __sprt_malloc(sizeof(LogRing));
+	if (!mem) {
+		__sprt_free(data);
+		return nullptr;
+	}
+
+	ring = new (mem) LogRing;
+
+	ring->data = data;
+	ring->capacity = bufferSize;
+
+	auto head = s_logAsync.rings.load(memory_order::relaxed);
+	do {
+		ring->next = head;
+	} while (!s_logAsync.rings.compare_exchange_weak(head, ring, memory_order::release,
+			memory_order::relaxed));
+	return ring;
+}
+
+static void writeLogBuffers(struct __SPRT_IOVEC_NAME *iov, int count) {
+	while (count > 0) {
+		auto ret = __sprt_writev(getLogOutputFd(), iov, count);
+		if (ret < 0) {
+			if (__sprt_errno == EINTR) {
+				continue;
+			}
+			return;
+		}
+
+		auto written = size_t(ret);
+		while (count > 0 && written >= iov->iov_len) {
+			written -= iov->iov_len;
+			++iov;
+			--count;
+		}
+		if (count > 0) {
+			iov->iov_base = (uint8_t *)iov->iov_base + written;
+			iov->iov_len -= written;
+		}
+	}
+}
+
+// requires drainMutex
+static void drainLogRing(LogRing *ring) {
+	static constexpr int MaxBuffers = 64;
+
+	struct __SPRT_IOVEC_NAME iov[MaxBuffers + 1];
+	char droppedBuf[64];
+	uint8_t droppedRecord[sizeof(LogRecordHeader) + 3 + 1 + sizeof(uint32_t) + sizeof(droppedBuf)];
+
+	auto t = ring->tail.load(memory_order::relaxed);
+	auto h = ring->head.load(memory_order::acquire);
+
+	while (t < h) {
+		int count = 0;
+		auto next = t;
+		while (next < h && count < MaxBuffers) {
+			auto offset = next & (ring->capacity - 1);
+			auto size = *reinterpret_cast<uint32_t *>(ring->data + offset);
+			if (size == LogRing::SkipMarker) {
+				next += ring->capacity - offset;
+				continue;
+			}
+
+			iov[count].iov_base = ring->data + offset + sizeof(uint32_t);
+			iov[count].iov_len = size;
+			++count;
+			next += LogRing::getRecordSize(size);
+		}
+
+		if (next == h) {
+			if (auto dropped = ring->dropped.exchange(0)) {
+				auto len = __sprt_snprintf(droppedBuf, sizeof(droppedBuf),
+						"[log] %llu messages dropped\n", (unsigned long long)dropped);
+				if (isBinary()) {
+					iov[count].iov_base = droppedRecord;
+					iov[count].iov_len = writeLogTextRecord(droppedRecord, LogType::Warn, "log",
+							StringView(droppedBuf, size_t(len)));
+				} else {
+					iov[count].iov_base = droppedBuf;
+					iov[count].iov_len = size_t(len);
+				}
+				++count;
+			}
+		}
+
+		writeLogBuffers(iov, count);
+
+		t = next;
+		ring->tail.store(t, memory_order::release);
+	}
+}
+
+static void drainLogRings() {
+	__sprt_pthread_mutex_lock(&s_logAsync.drainMutex);
+	auto ring = s_logAsync.rings.load(memory_order::acquire);
+	while (ring) {
+		drainLogRing(ring);
+		ring = ring->next;
+	}
+	__sprt_pthread_mutex_unlock(&s_logAsync.drainMutex);
+}
+
+static void *runLogDrainThread(void *) {
+	__sprt_pthread_mutex_lock(&s_logAsync.mutex);
+	while (s_logAsync.running) {
+		__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+
+		s_logAsync.pending.store(false);
+		drainLogRings();
+
+		__sprt_pthread_mutex_lock(&s_logAsync.mutex);
+		while (!s_logAsync.pending.load() && s_logAsync.running) {
+			__sprt_pthread_cond_wait(&s_logAsync.cond, &s_logAsync.mutex);
+		}
+	}
+	__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+	return nullptr;
+}
+
+static void wakeupLogDrainThread() {
+	// only the first message after drain performs wakeup
+	if (!s_logAsync.pending.exchange(true)) {
+		__sprt_pthread_mutex_lock(&s_logAsync.mutex);
+		__sprt_pthread_cond_signal(&s_logAsync.cond);
+		__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+	}
+}
+
+// returns false, if message should be written synchronously
+static bool pushLogAsync(LogType type, const char *buf, size_t size) {
+	if (!s_logAsync.enabled.load(memory_order::acquire)) {
+		return false;
+	}
+
+	if (type == LogType::Fatal) {
+		flush();
+		return false;
+	}
+
+	auto slot = getLogThreadSlot();
+	if (!slot) {
+		flush();
+		return false;
+	}
+
+	if (!slot->ring) {
+		slot->ring = acquireLogRing(s_logAsync.bufferSize);
+		if (!slot->ring) {
+			return false;
+		}
+	}
+
+	auto ring = slot->ring;
+	if (LogRing::getRecordSize(size) > ring->capacity / 2) {
+		// keep order of messages from this thread
+		flush();
+		return false;
+	}
+
+	while (!ring->push(buf, size)) {
+		switch (s_logAsync.overflow) {
+		case LogOverflow::Drop: return true;
+		case LogOverflow::Count: ring->dropped.fetch_add(1); return true;
+		case LogOverflow::Block:
+			wakeupLogDrainThread();
+			__sprt_sched_yield();
+			if (!s_logAsync.enabled.load(memory_order::acquire)) {
+				flush();
+				return false;
+			}
+			break;
+		}
+	}
+
+	wakeupLogDrainThread();
+	return true;
+}
+
+bool enableAsync(const LogAsyncInfo &info) {
+	__sprt_pthread_mutex_lock(&s_logAsync.mutex);
+	if (s_logAsync.running) {
+		__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+		return false;
+	}
+
+	size_t bufferSize = 4'096;
+	while (bufferSize < info.bufferSize) { bufferSize *= 2; }
+
+	s_logAsync.bufferSize = bufferSize;
+	s_logAsync.overflow = info.overflow;
+	s_logAsync.running = true;
+
+	if (__sprt_pthread_create(&s_logAsync.thread, nullptr, &runLogDrainThread, nullptr) != 0) {
+		s_logAsync.running = false;
+		__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+		return false;
+	}
+
+	s_logAsync.enabled.store(true, memory_order::release);
+	__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+	return true;
+}
+
+void disableAsync() {
+	__sprt_pthread_mutex_lock(&s_logAsync.mutex);
+	if (!s_logAsync.running) {
+		__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+		return;
+	}
+
+	s_logAsync.enabled.store(false, memory_order::release);
+	s_logAsync.running = false;
+	__sprt_pthread_cond_signal(&s_logAsync.cond);
+	__sprt_pthread_mutex_unlock(&s_logAsync.mutex);
+
+	__sprt_pthread_join(s_logAsync.thread, nullptr);
+
+	// write messages, pushed before producers observed disabled state
+	drainLogRings();
+}
+
+void flush() { drainLogRings(); }
+
+#else
+
+bool enableAsync(const LogAsyncInfo &info) { return false; }
+
+void disableAsync() { }
+
+void flush() { }
+
+#endif
+
+static void writeLogRecord(LogType type, const uint8_t *buf, size_t size) {
+#if !SPRT_ANDROID
+	if (pushLogAsync(type, (const char *)buf, size)) {
+		return;
+	}
+#endif
+
+	auto fd = s_logBinary.fd.load(memory_order::acquire);
+	while (fd >= 0 && size > 0) {
+		auto ret = __sprt_write(fd, buf, size);
+		if (ret < 0) {
+			if (__sprt_errno == EINTR) {
+				continue;
+			}
+			return;
+		}
+		buf += ret;
+		size -= size_t(ret);
+	}
+}
+
+bool enableBinary(int fd) {
+	if (fd < 0) {
+		return false;
+	}
+
+	// text messages should not be written into the binary stream
+	flush();
+
+	for (auto &it : s_logBinary.sites) { it.store(nullptr, memory_order::relaxed); }
+
+	int expected = -1;
+	if (!s_logBinary.fd.compare_exchange_strong(expected, fd, memory_order::acq_rel)) {
+		return false;
+	}
+
+	uint8_t buf[sizeof(LogRecordHeader)];
+	writeLogRecordHeader(buf, sizeof(LogRecordHeader), LogRecordKind::Stream, LogType::Info, 0,
+			LogStreamVersion, LogStreamMagic);
+	writeLogRecord(LogType::Info, buf, sizeof(LogRecordHeader));
+	return true;
+}
+
+void disableBinary() {
+	flush();
+	s_logBinary.fd.store(-1, memory_order::release);
+}
+
+bool isBinary() { return s_logBinary.fd.load(memory_order::relaxed) >= 0; }
+
+void printBinary(LogType type, const source_location &loc, StringView tag, BytesView args) {
+	tag = tag.sub(0, Max<uint16_t>);
+
+	auto file = loc.file_name();
+	auto site = uint64_t(uintptr_t(file));
+	if (file && registerLogSite(file)) {
+		auto fileLen = __builtin_strlen(file);
+		auto siteSize = sizeof(LogRecordHeader) + fileLen;
+		auto buf = __sprt_typed_malloca(uint8_t, siteSize);
+		auto target = writeLogRecordHeader(buf, siteSize, LogRecordKind::Site, type, 0, 0, site);
+		__sprt_memcpy(target, file, fileLen);
+		writeLogRecord(type, buf, siteSize);
+		__sprt_freea(buf);
+	}
+
+	auto size = sizeof(LogRecordHeader) + tag.size() + args.size();
+	auto buf = __sprt_typed_malloca(uint8_t, size);
+	auto target = writeLogRecordHeader(buf, size, LogRecordKind::Message, type,
+			uint16_t(tag.size()), loc.line(), site);
+	__sprt_memcpy(target, tag.data(), tag.size());
+	__sprt_memcpy(target + tag.size(), args.data(), args.size());
+	writeLogRecord(type, buf, size);
+	__sprt_freea(buf);
+}
+
+static void printBinaryText(LogType type, StringView prefix, StringView tag, StringView text) {
+	tag = tag.sub(0, Max<uint16_t>);
+
+	auto size = getLogTextRecordSize(tag, text);
+	if (!prefix.empty()) {
+		size += 1 + sizeof(uint32_t) + prefix.size() + 1 + sizeof(uint32_t) + 1;
+	}
+
+	auto buf = __sprt_typed_malloca(uint8_t, size);
+	auto target =
+			writeLogRecordHeader(buf, size, LogRecordKind::Message, type, uint16_t(tag.size()), 0, 0);
+	__sprt_memcpy(target, tag.data(), tag.size());
+	target += tag.size();
+	if (!prefix.empty()) {
+		target = writeLogTextArg(target, prefix);
+		target = writeLogTextArg(target, " ");
+	}
+	writeLogTextArg(target, text);
+	writeLogRecord(type, buf, size);
+	__sprt_freea(buf);
+}
+
+struct LogSiteInfo {
+	uint64_t site;
+	StringView file;
+};
+
+// Calls `cb` for every complete record, returns false if data is malformed
+static bool readLogRecords(BytesView data,
+		const callback<void(const LogRecordHeader &, BytesView)> &cb) {
+	while (data.size() >= sizeof(LogRecordHeader)) {
+		LogRecordHeader header;
+		__sprt_memcpy(&header, data.data(), sizeof(LogRecordHeader));
+
+		if (header.size < sizeof(LogRecordHeader)
+				|| (header.kind == LogRecordKind::Stream && header.site != LogStreamMagic)) {
+			return false;
+		}
+
+		if (header.size > data.size()) {
+			break; // incomplete record
+		}
+
+		cb(header, BytesView(data.data() + sizeof(LogRecordHeader),
+						   header.size - sizeof(LogRecordHeader)));
+		data += header.size;
+	}
+	return true;
+}
+
+// Renders encoded arguments into `buf` (or calculates required size with nullptr buffer)
+static bool renderLogArgs(BytesView args, char *buf, size_t &size) {
+	size = 0;
+	auto append = [&](StringView str) {
+		if (buf) {
+			__sprt_memcpy(buf + size, str.data(), str.size());
+		}
+		size += str.size();
+	};
+
+	while (!args.empty()) {
+		auto type = LogArgType(args.readUnsigned());
+		if (type == LogArgType::Text) {
+			if (args.size() < sizeof(uint32_t)) {
+				return false;
+			}
+			uint32_t len = 0;
+			__sprt_memcpy(&len, args.data(), sizeof(uint32_t));
+			args += sizeof(uint32_t);
+			if (args.size() < len) {
+				return false;
+			}
+			append(StringView((const char *)args.data(), len));
+			args += len;
+			continue;
+		}
+
+		if (args.size() < sizeof(uint64_t)) {
+			return false;
+		}
+
+		uint64_t bits = 0;
+		__sprt_memcpy(&bits, args.data(), sizeof(uint64_t));
+		args += sizeof(uint64_t);
+
+		switch (type) {
+		case LogArgType::Signed: io_traits<int64_t>::encode<char>(append, int64_t(bits)); break;
+		case LogArgType::Unsigned: io_traits<uint64_t>::encode<char>(append, bits); break;
+		case LogArgType::Float: {
+			double value = 0.0;
+			__sprt_memcpy(&value, &bits, sizeof(double));
+			io_traits<double>::encode<char>(append, value);
+			break;
+		}
+		case LogArgType::Float32: {
+			float value = 0.0f;
+			__sprt_memcpy(&value, &bits, sizeof(float));
+			io_traits<float>::encode<char>(append, value);
+			break;
+		}
+		default: return false; break;
+		}
+	}
+	return true;
+}
+
+Status decodeBinary(BytesView data, const callback<void(const LogRecord &)> &cb) {
+	// resolve sites first
+	size_t nsites = 0;
+	if (!readLogRecords(data, [&](const LogRecordHeader &header, BytesView) {
+		if (header.kind == LogRecordKind::Site) {
+			++nsites;
+		}
+	})) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto sites = (LogSiteInfo *)__sprt_malloc(sizeof(LogSiteInfo) * (nsites + 1));
+	if (!sites) {
+		return Status::ErrorOutOfHostMemory;
+	}
+
+	nsites = 0;
+	readLogRecords(data, [&](const LogRecordHeader &header, BytesView payload) {
+		if (header.kind == LogRecordKind::Site) {
+			sites[nsites++] =
+					LogSiteInfo{header.site, StringView((const char *)payload.data(), payload.size())};
+		}
+	});
+
+	sprt::sort(sites, sites + nsites,
+			[](const LogSiteInfo &l, const LogSiteInfo &r) { return l.site < r.site; });
+
+	auto findSite = [&](uint64_t site) -> StringView {
+		auto it = sprt::lower_bound(sites, sites + nsites, site,
+				[](const LogSiteInfo &l, uint64_t r) { return l.site < r; });
+		if (it != sites + nsites && it->site == site) {
+			return it->file;
+		}
+		return StringView();
+	};
+
+	auto status = Status::Ok;
+	char *textBuf = nullptr;
+	size_t textCapacity = 0;
+
+	readLogRecords(data, [&](const LogRecordHeader &header, BytesView payload) {
+		if (header.kind != LogRecordKind::Message || status != Status::Ok) {
+			return;
+		}
+
+		if (payload.size() < header.tagSize || header.type > uint8_t(LogType::Fatal)) {
+			status = Status::ErrorInvalidArguemnt;
+			return;
+		}
+
+		LogRecord record;
+		record.type = LogType(header.type);
+		record.time = header.time;
+		record.line = header.line;
+		record.tag = StringView((const char *)payload.data(), header.tagSize);
+		if (header.site) {
+			record.file = findSite(header.site);
+		}
+
+		auto args = BytesView(payload.data() + header.tagSize, payload.size() - header.tagSize);
+
+		size_t textSize = 0;
+		if (!renderLogArgs(args, nullptr, textSize)) {
+			status = Status::ErrorInvalidArguemnt;
+			return;
+		}
+
+		if (textSize > textCapacity) {
+			textCapacity = max(textSize, textCapacity * 2);
+			__sprt_free(textBuf);
+			textBuf = (char *)__sprt_malloc(textCapacity);
+			if (!textBuf) {
+				textCapacity = 0;
+				status = Status::ErrorOutOfHostMemory;
+				return;
+			}
+		}
+
+		renderLogArgs(args, textBuf, textSize);
+		record.text = StringView(textBuf, textSize);
+		cb(record);
+	});
+
+	__sprt_free(textBuf);
+	__sprt_free(sites);
+	return status;
+}
+
+
 void print(LogType type, StringView prefix, StringView tag, StringView text) {
+	if (isBinary()) {
+		printBinaryText(type, prefix, tag, text);
+		return;
+	}
+
 #if defined(SPRT_ANDROID)
 	tag.performWithTerminated([&](const char *tagBuf, size_t len) {
 		switch (type) {
@@ -509,8 +1240,10 @@ void print(LogType type, StringView prefix, StringView tag, StringView text) {
 	target = strappend(target, &freeSize, "\n", 1);
 #endif
 
-	::__sprt_fwrite(buffer, target - buffer, 1, __sprt_stderr_impl());
-	::__sprt_fflush(__sprt_stderr_impl());
+	if (!pushLogAsync(type, buffer, target - buffer)) {
+		::__sprt_fwrite(buffer, target - buffer, 1, __sprt_stderr_impl());
+		::__sprt_fflush(__sprt_stderr_impl());
+	}
 
 	if (buffer != staticBuffer) {
 		__sprt_freea(buffer);
@@ -536,4 +1269,6 @@ LogFeatures LogFeatures::acquire() {
 	return ret;
 }
 
+const LogFeatures &LogFeatures::get() { return s_logInit; }
+
 } // namespace sprt::oslog
@@ -83,6 +83,21 @@ __SPRT_C_FUNC int __SPRT_ID(sprt_qlock_wait)(__SPRT_ID(sprt_qlock_t) * value,
 	return result;
 }
 
+__SPRT_C_FUNC int __SPRT_ID(sprt_qlock_wait_any)(__SPRT_ID(sprt_qlock_t) * const *values,
+		const __SPRT_ID(sprt_qlock_t) * expected, __SPRT_ID(uint32_t) count,
+		__SPRT_ID(sprt_timeout_t) timeout, __SPRT_ID(sprt_lock_flags_t) flags) {
+	int result = sprt_qlock_wait_any(values, expected, count, timeout, flags);
+#if DEBUG
+	if (result < 0) {
+		auto err = __sprt_errno;
+		if (err != EAGAIN && err != ETIMEDOUT && err != ENOSYS) {
+			__sprt_perror("sprt_qlock_wait_any error: ");
+		}
+	}
+#endif
+	return result;
+}
+
 __SPRT_C_FUNC int __SPRT_ID(
 		sprt_qlock_wake_one)(__SPRT_ID(sprt_qlock_t) * value, __SPRT_ID(sprt_lock_flags_t) flags) {
 	int result = sprt_qlock_wake_one(value, flags);
@@ -410,6 +425,18 @@ qmutex::~qmutex() {
 	}
 }
 
+int qmutex::lock_any(qmutex *const *mutexes, uint32_t count) {
+	if (count == 0 || count > LOCK_ANY_MAX) {
+		__sprt_errno = EINVAL;
+		return -1;
+	}
+
+	value_type *values[LOCK_ANY_MAX];
+	for (uint32_t i = 0; i < count; ++i) { values[i] = &mutexes[i]->_data; }
+
+	return _lock_any<__sprt_sprt_qlock_wait_any>(values, count, 0);
+}
+
 rmutex::~rmutex() {
 	if (_data.value.u64 != Max<uint64_t>) {
 		value_type zero = {0};
@@ -433,7 +460,7 @@ void rmutex::lock() {
 
 	auto res = _lock<__sprt_sprt_rlock_wait, nullptr,
 			bool(__SPRT_SPRT_RLOCK_PI_REQUIRES_EXTENDED_CALL)>(_data.value, tid, 0,
-			__SPRT_SPRT_LOCK_FLAG_PI);
+			__SPRT_SPRT_LOCK_FLAG_PI, nullptr, &_data.spins);
 	switch (res) {
 	case Status::Ok:
 	case Status::Propagate: ++_data.counter; break;
@@ -505,7 +532,8 @@ void recursive_timed_mutex::lock() {
 	*rmutex_base::getNativeValue(tid) = __sprt_gettid();
 
 	auto res = rmutex_base::_lock<__sprt_sprt_rlock_wait, nullptr,
-			bool(__SPRT_SPRT_RLOCK_PI_REQUIRES_EXTENDED_CALL)>(_mutex.value, tid, 0, 0);
+			bool(__SPRT_SPRT_RLOCK_PI_REQUIRES_EXTENDED_CALL)>(_mutex.value, tid, 0, 0, nullptr,
+			&_mutex.spins);
 	switch (res) {
 	case Status::Ok:
 	case Status::Propagate: ++_mutex.counter; break;
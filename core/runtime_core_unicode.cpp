@@ -22,6 +22,19 @@
 
 #include <sprt/runtime/stringview.h>
 #include <sprt/runtime/unicode.h>
+#include <sprt/cxx/bit>
+
+// SSE2 and NEON are baseline for x86_64 and arm64, AVX2 classifier is compiled with
+// target attribute and selected with cpuid
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SPRT_UNICODE_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define SPRT_UNICODE_NEON 1
+#include <arm_neon.h>
+#endif
 
 namespace sprt::unicode {
 
@@ -87,38 +100,372 @@ static inline T Utf8NextChar(T p, size_t &counter) {
 	return (p + l);
 }
 
+/*
+	Bulk UTF processing works on fixed-size blocks. Platform kernels only classify bytes of
+	UTF-8 block into bitmasks, then block is accepted if it's well-formed (or strictly valid),
+	and processed with popcounts and unchecked decoding. Rejected blocks fall back to the
+	scalar loops below, so results for malformed input are the same as without SIMD.
+
+	UTF-16/UTF-32 blocks use branch-free fixed-width loops, that are vectorized by compiler
+	with the baseline ISA.
+*/
+
+static constexpr size_t Utf8Block = 64;
+static constexpr size_t Utf16Block = 32;
+static constexpr size_t Utf32Block = 16;
+
+struct Utf8Masks {
+	uint64_t nonAscii; // >= 0x80
+	uint64_t zero;
+
+	// only filled when nonAscii is not 0
+	uint64_t lead2; // >= 0xC0
+	uint64_t lead3; // >= 0xE0
+	uint64_t lead4; // >= 0xF0
+	uint64_t lead5; // >= 0xF8, never valid
+	uint64_t ge90;
+	uint64_t geA0;
+	uint64_t geC2;
+	uint64_t geF5;
+	uint64_t e0;
+	uint64_t ed;
+	uint64_t f0;
+	uint64_t f4;
+};
+
+using Utf8ClassifyFn = void (*)(const uint8_t *, Utf8Masks &);
+
+#if SPRT_UNICODE_X86
+
+#if __SSE2__
+
+static inline uint64_t utf8_mask_sse2(__m128i a, __m128i b, __m128i c, __m128i d) {
+	return uint64_t(uint16_t(_mm_movemask_epi8(a)))
+			| (uint64_t(uint16_t(_mm_movemask_epi8(b))) << 16)
+			| (uint64_t(uint16_t(_mm_movemask_epi8(c))) << 32)
+			| (uint64_t(uint16_t(_mm_movemask_epi8(d))) << 48);
+}
+
+// unsigned v >= b
+static inline __m128i utf8_ge_sse2(__m128i v, uint8_t b) {
+	return _mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(char(b))), v);
+}
+
+static inline __m128i utf8_eq_sse2(__m128i v, uint8_t b) {
+	return _mm_cmpeq_epi8(v, _mm_set1_epi8(char(b)));
+}
+
+#define SPRT_UTF8_MASK_SSE2(Fn, Arg) \
+	utf8_mask_sse2(Fn(v0, Arg), Fn(v1, Arg), Fn(v2, Arg), Fn(v3, Arg))
+
+static void utf8_classify_sse2(const uint8_t *ptr, Utf8Masks &m) {
+	auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+	auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 16));
+	auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 32));
+	auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr + 48));
+
+	m.zero = SPRT_UTF8_MASK_SSE2(utf8_eq_sse2, 0);
+	m.nonAscii = utf8_mask_sse2(v0, v1, v2, v3);
+	if (!m.nonAscii) {
+		return;
+	}
+
+	m.lead2 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xC0);
+	m.lead3 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xE0);
+	m.lead4 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xF0);
+	m.lead5 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xF8);
+	m.ge90 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0x90);
+	m.geA0 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xA0);
+	m.geC2 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xC2);
+	m.geF5 = SPRT_UTF8_MASK_SSE2(utf8_ge_sse2, 0xF5);
+	m.e0 = SPRT_UTF8_MASK_SSE2(utf8_eq_sse2, 0xE0);
+	m.ed = SPRT_UTF8_MASK_SSE2(utf8_eq_sse2, 0xED);
+	m.f0 = SPRT_UTF8_MASK_SSE2(utf8_eq_sse2, 0xF0);
+	m.f4 = SPRT_UTF8_MASK_SSE2(utf8_eq_sse2, 0xF4);
+}
+
+#undef SPRT_UTF8_MASK_SSE2
+
+#endif
+
+__attribute__((target("avx2"))) static inline uint64_t utf8_mask_avx2(__m256i a, __m256i b) {
+	return uint64_t(uint32_t(_mm256_movemask_epi8(a)))
+			| (uint64_t(uint32_t(_mm256_movemask_epi8(b))) << 32);
+}
+
+__attribute__((target("avx2"))) static inline __m256i utf8_ge_avx2(__m256i v, uint8_t b) {
+	return _mm256_cmpeq_epi8(_mm256_max_epu8(v, _mm256_set1_epi8(char(b))), v);
+}
+
+__attribute__((target("avx2"))) static inline __m256i utf8_eq_avx2(__m256i v, uint8_t b) {
+	return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(char(b)));
+}
+
+#define SPRT_UTF8_MASK_AVX2(Fn, Arg) utf8_mask_avx2(Fn(v0, Arg), Fn(v1, Arg))
+
+__attribute__((target("avx2"))) static void utf8_classify_avx2(const uint8_t *ptr,
+		Utf8Masks &m) {
+	auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+	auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr + 32));
+
+	m.zero = SPRT_UTF8_MASK_AVX2(utf8_eq_avx2, 0);
+	m.nonAscii = utf8_mask_avx2(v0, v1);
+	if (!m.nonAscii) {
+		return;
+	}
+
+	m.lead2 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xC0);
+	m.lead3 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xE0);
+	m.lead4 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xF0);
+	m.lead5 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xF8);
+	m.ge90 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0x90);
+	m.geA0 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xA0);
+	m.geC2 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xC2);
+	m.geF5 = SPRT_UTF8_MASK_AVX2(utf8_ge_avx2, 0xF5);
+	m.e0 = SPRT_UTF8_MASK_AVX2(utf8_eq_avx2, 0xE0);
+	m.ed = SPRT_UTF8_MASK_AVX2(utf8_eq_avx2, 0xED);
+	m.f0 = SPRT_UTF8_MASK_AVX2(utf8_eq_avx2, 0xF0);
+	m.f4 = SPRT_UTF8_MASK_AVX2(utf8_eq_avx2, 0xF4);
+}
+
+#undef SPRT_UTF8_MASK_AVX2
+
+static bool hasAvx2() {
+	unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return false;
+	}
+
+	if ((ecx & bit_AVX) == 0 || (ecx & bit_OSXSAVE) == 0) {
+		return false;
+	}
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || (ebx & bit_AVX2) == 0) {
+		return false;
+	}
+
+	// OS should save YMM state on context switch
+	uint32_t xcr0lo = 0, xcr0hi = 0;
+	__asm__ volatile("xgetbv" : "=a"(xcr0lo), "=d"(xcr0hi) : "c"(0));
+	return (xcr0lo & 0x6) == 0x6;
+}
+
+static Utf8ClassifyFn detectUtf8Classifier() {
+	if (hasAvx2()) {
+		return &utf8_classify_avx2;
+	}
+#if __SSE2__
+	return &utf8_classify_sse2;
+#else
+	return nullptr;
+#endif
+}
+
+#elif SPRT_UNICODE_NEON
+
+// NEON has no movemask, so bits are weighted and combined with pairwise adds
+static inline uint64_t utf8_mask_neon(uint8x16_t a, uint8x16_t b, uint8x16_t c, uint8x16_t d) {
+	const uint8x16_t bits = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04,
+		0x08, 0x10, 0x20, 0x40, 0x80};
+	auto s0 = vpaddq_u8(vandq_u8(a, bits), vandq_u8(b, bits));
+	auto s1 = vpaddq_u8(vandq_u8(c, bits), vandq_u8(d, bits));
+	s0 = vpaddq_u8(s0, s1);
+	s0 = vpaddq_u8(s0, s0);
+	return vgetq_lane_u64(vreinterpretq_u64_u8(s0), 0);
+}
+
+static inline uint8x16_t utf8_ge_neon(uint8x16_t v, uint8_t b) {
+	return vcgeq_u8(v, vdupq_n_u8(b));
+}
+
+static inline uint8x16_t utf8_eq_neon(uint8x16_t v, uint8_t b) {
+	return vceqq_u8(v, vdupq_n_u8(b));
+}
+
+#define SPRT_UTF8_MASK_NEON(Fn, Arg) \
+	utf8_mask_neon(Fn(v0, Arg), Fn(v1, Arg), Fn(v2, Arg), Fn(v3, Arg))
+
+static void utf8_classify_neon(const uint8_t *ptr, Utf8Masks &m) {
+	auto v0 = vld1q_u8(ptr);
+	auto v1 = vld1q_u8(ptr + 16);
+	auto v2 = vld1q_u8(ptr + 32);
+	auto v3 = vld1q_u8(ptr + 48);
+
+	m.zero = SPRT_UTF8_MASK_NEON(utf8_eq_neon, 0);
+	if (vmaxvq_u8(vorrq_u8(vorrq_u8(v0, v1), vorrq_u8(v2, v3))) < 0x80) {
+		m.nonAscii = 0;
+		return;
+	}
+
+	m.nonAscii = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0x80);
+	m.lead2 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xC0);
+	m.lead3 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xE0);
+	m.lead4 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xF0);
+	m.lead5 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xF8);
+	m.ge90 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0x90);
+	m.geA0 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xA0);
+	m.geC2 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xC2);
+	m.geF5 = SPRT_UTF8_MASK_NEON(utf8_ge_neon, 0xF5);
+	m.e0 = SPRT_UTF8_MASK_NEON(utf8_eq_neon, 0xE0);
+	m.ed = SPRT_UTF8_MASK_NEON(utf8_eq_neon, 0xED);
+	m.f0 = SPRT_UTF8_MASK_NEON(utf8_eq_neon, 0xF0);
+	m.f4 = SPRT_UTF8_MASK_NEON(utf8_eq_neon, 0xF4);
+}
+
+#undef SPRT_UTF8_MASK_NEON
+
+static Utf8ClassifyFn detectUtf8Classifier() { return &utf8_classify_neon; }
+
+#else
+
+static Utf8ClassifyFn detectUtf8Classifier() { return nullptr; }
+
+#endif
+
+static Utf8ClassifyFn getUtf8Classifier() {
+	static Utf8ClassifyFn fn = detectUtf8Classifier();
+	return fn;
+}
+
+// Returns size of the well-formed block prefix, that ends on a character boundary, or 0 if
+// block has malformed sequences. Sequence, that is not fully within the block, is left
+// for the next block.
+static inline uint32_t utf8_block_size(const Utf8Masks &m, uint64_t &valid) {
+	const uint64_t tail = (m.lead2 & (uint64_t(1) << 63)) | (m.lead3 & (uint64_t(3) << 62))
+			| (m.lead4 & (uint64_t(7) << 61));
+	const uint32_t size = tail ? sprt::countr_zero(tail) : 64;
+	valid = (size == 64) ? ~uint64_t(0) : ((uint64_t(1) << size) - 1);
+
+	// every lead should be followed by exactly the required number of continuation bytes
+	const uint64_t cont = m.nonAscii & ~m.lead2 & valid;
+	const uint64_t expected =
+			((m.lead2 & valid) << 1) | ((m.lead3 & valid) << 2) | ((m.lead4 & valid) << 3);
+	if (cont != expected || (m.lead5 & valid) != 0) {
+		return 0;
+	}
+	return size;
+}
+
+// Checks well-formed block for overlongs, surrogates and code points above U+10FFFF
+static inline bool utf8_block_strict(const Utf8Masks &m, uint64_t valid) {
+	const uint64_t errors = (m.lead2 & ~m.geC2) | m.geF5 | ((m.e0 << 1) & ~m.geA0)
+			| ((m.ed << 1) & m.geA0) | ((m.f0 << 1) & ~m.ge90) | ((m.f4 << 1) & m.ge90);
+	return (errors & valid) == 0;
+}
+
+// Decodes well-formed sequences without checks
+template <typename Emit>
+static inline void utf8_decode_unchecked(const uint8_t *ptr, const uint8_t *end, const Emit &emit) {
+	while (ptr < end) {
+		const uint8_t c = ptr[0];
+		if (c < 0x80) {
+			emit(char32_t(c));
+			ptr += 1;
+		} else if (c < 0xE0) {
+			emit((char32_t(c & 0x1F) << 6) | char32_t(ptr[1] & 0x3F));
+			ptr += 2;
+		} else if (c < 0xF0) {
+			emit((char32_t(c & 0x0F) << 12) | (char32_t(ptr[1] & 0x3F) << 6)
+					| char32_t(ptr[2] & 0x3F));
+			ptr += 3;
+		} else {
+			emit((char32_t(c & 0x07) << 18) | (char32_t(ptr[1] & 0x3F) << 12)
+					| (char32_t(ptr[2] & 0x3F) << 6) | char32_t(ptr[3] & 0x3F));
+			ptr += 4;
+		}
+	}
+}
+
+static inline bool utf8_in_range(uint8_t c, uint8_t lo = 0x80, uint8_t hi = 0xBF) {
+	return c >= lo && c <= hi;
+}
+
+// Strictly validates single sequence, returns its length or 0
+static inline uint32_t utf8_valid_sequence(const uint8_t *ptr, const uint8_t *end) {
+	const uint8_t c = ptr[0];
+	const size_t avail = end - ptr;
+
+	if (c < 0x80) {
+		return 1;
+	} else if (c < 0xC2) {
+		// continuation or overlong 2-byte lead
+		return 0;
+	} else if (c < 0xE0) {
+		if (avail < 2 || !utf8_in_range(ptr[1])) {
+			return 0;
+		}
+		return 2;
+	} else if (c < 0xF0) {
+		const uint8_t lo = (c == 0xE0) ? 0xA0 : 0x80; // overlong
+		const uint8_t hi = (c == 0xED) ? 0x9F : 0xBF; // surrogates
+		if (avail < 3 || !utf8_in_range(ptr[1], lo, hi) || !utf8_in_range(ptr[2])) {
+			return 0;
+		}
+		return 3;
+	} else if (c < 0xF5) {
+		const uint8_t lo = (c == 0xF0) ? 0x90 : 0x80; // overlong
+		const uint8_t hi = (c == 0xF4) ? 0x8F : 0xBF; // above U+10FFFF
+		if (avail < 4 || !utf8_in_range(ptr[1], lo, hi) || !utf8_in_range(ptr[2])
+				|| !utf8_in_range(ptr[3])) {
+			return 0;
+		}
+		return 4;
+	}
+	return 0;
+}
+
+struct Utf16BlockInfo {
+	uint32_t surrogates = 0;
+	uint32_t zeros = 0;
+	uint32_t ge80 = 0;
+	uint32_t ge800 = 0;
+};
+
+static inline Utf16BlockInfo utf16_block_info(const char16_t *ptr) {
+	Utf16BlockInfo ret;
+	for (size_t i = 0; i < Utf16Block; ++i) {
+		const uint16_t c = ptr[i];
+		ret.surrogates += uint32_t((c & 0xF800) == 0xD800);
+		ret.zeros += uint32_t(c == 0);
+		ret.ge80 += uint32_t(c >= 0x80);
+		ret.ge800 += uint32_t(c >= 0x800);
+	}
+	return ret;
+}
+
 bool isValidUtf8(StringView r) {
-	static const uint8_t utf8_valid_data[256] = {
-		//	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, a, b, c, d, e, f, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, a, b, c, d, e, f
-		0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-		1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-		2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
-		5, 5, 5, 5, 6, 6, 0, 0};
-
-	auto ptr = r.data();
+	auto ptr = reinterpret_cast<const uint8_t *>(r.data());
 	const auto end = ptr + r.size();
-	while (ptr < end && *ptr != 0) {
-		auto l = utf8_valid_data[((const uint8_t *)ptr)[0]];
-		if (l == 0) {
-			return false;
-		} else if (l == 1) {
-			++ptr;
-		} else {
-			while (l > 1) {
-				--l;
-				++ptr;
 
-				if ((((const uint8_t *)ptr)[0] & 0b1100'0000) != 0b1000'0000) {
+	auto classify = getUtf8Classifier();
+	auto slow = classify ? ptr : end;
+
+	Utf8Masks m;
+	uint64_t valid = 0;
+	while (ptr < end && *ptr != 0) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf8Block) {
+			classify(ptr, m);
+			if (m.zero == 0) {
+				if (!m.nonAscii) {
+					ptr += Utf8Block;
+					continue;
+				}
+				// block always starts on a character boundary here
+				auto size = utf8_block_size(m, valid);
+				if (size == 0 || !utf8_block_strict(m, valid)) {
 					return false;
 				}
+				ptr += size;
+				continue;
 			}
-			++ptr;
+			slow = ptr + Utf8Block;
 		}
+
+		auto len = utf8_valid_sequence(ptr, end);
+		if (len == 0) {
+			return false;
+		}
+		ptr += len;
 	};
 	return true;
 }
@@ -127,7 +474,30 @@ size_t getUtf32Length(const StringView &input) {
 	size_t counter = 0;
 	auto ptr = input.data();
 	const auto end = ptr + input.size();
+
+	auto classify = getUtf8Classifier();
+	auto slow = classify ? ptr : end;
+
+	Utf8Masks m;
+	uint64_t valid = 0;
 	while (ptr < end && *ptr != 0) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf8Block) {
+			classify(reinterpret_cast<const uint8_t *>(ptr), m);
+			if (m.zero == 0) {
+				if (!m.nonAscii) {
+					counter += Utf8Block;
+					ptr += Utf8Block;
+					continue;
+				}
+				if (auto size = utf8_block_size(m, valid)) {
+					counter += size - sprt::popcount(m.nonAscii & ~m.lead2 & valid);
+					ptr += size;
+					continue;
+				}
+			}
+			slow = ptr + Utf8Block;
+		}
+
 		++counter;
 		ptr += utf8_length_data[uint8_t(*ptr)];
 	};
@@ -138,7 +508,18 @@ size_t getUtf32Length(const WideStringView &input) {
 	size_t counter = 0;
 	auto ptr = input.data();
 	const auto end = ptr + input.size();
+	auto slow = ptr;
 	while (ptr < end && *ptr != 0) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf16Block) {
+			auto info = utf16_block_info(ptr);
+			if (info.surrogates == 0 && info.zeros == 0) {
+				counter += Utf16Block;
+				ptr += Utf16Block;
+				continue;
+			}
+			slow = ptr + Utf16Block;
+		}
+
 		++counter;
 		if (isUtf16Surrogate(*ptr)) {
 			ptr += 2;
@@ -153,7 +534,32 @@ size_t getUtf16Length(const StringView &input) {
 	size_t counter = 0;
 	auto ptr = input.data();
 	const auto end = ptr + input.size();
+
+	auto classify = getUtf8Classifier();
+	auto slow = classify ? ptr : end;
+
+	Utf8Masks m;
+	uint64_t valid = 0;
 	while (ptr < end && *ptr != 0) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf8Block) {
+			classify(reinterpret_cast<const uint8_t *>(ptr), m);
+			if (m.zero == 0) {
+				if (!m.nonAscii) {
+					counter += Utf8Block;
+					ptr += Utf8Block;
+					continue;
+				}
+				if (auto size = utf8_block_size(m, valid)) {
+					// 4-byte sequences are encoded as surrogate pairs
+					counter += size - sprt::popcount(m.nonAscii & ~m.lead2 & valid)
+							+ sprt::popcount(m.lead4 & valid);
+					ptr += size;
+					continue;
+				}
+			}
+			slow = ptr + Utf8Block;
+		}
+
 		counter += utf16_length_data[uint8_t(*ptr)];
 		ptr += utf8_length_data[uint8_t(*ptr)];
 	};
@@ -165,6 +571,15 @@ size_t getUtf16Length(const StringViewBase<char32_t> &str) {
 	auto source = str.data();
 	auto end = source + str.size();
 
+	while (size_t(end - source) >= Utf32Block) {
+		// same as utf16EncodeLength: surrogates are skipped, non-BMP takes two units
+		for (size_t i = 0; i < Utf32Block; ++i) {
+			const uint32_t c = source[i];
+			counter += 1 + uint32_t(c >= 0x1'0000) - uint32_t(c - 0xD800 < 0x800);
+		}
+		source += Utf32Block;
+	}
+
 	while (source != end) { counter += utf16EncodeLength(*source++); }
 
 	return counter;
@@ -226,8 +641,19 @@ size_t getUtf8HtmlLength(const StringView &input) {
 size_t getUtf8Length(const WideStringView &str) {
 	const char16_t *ptr = str.data();
 	const char16_t *end = ptr + str.size();
+	auto slow = ptr;
 	size_t ret = 0;
 	while (ptr < end) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf16Block) {
+			auto info = utf16_block_info(ptr);
+			if (info.surrogates == 0) {
+				ret += Utf16Block + info.ge80 + info.ge800;
+				ptr += Utf16Block;
+				continue;
+			}
+			slow = ptr + Utf16Block;
+		}
+
 		auto c = *ptr++;
 		if (c >= 0xD800 && c <= 0xDFFF) {
 			// surrogates is 4-byte
@@ -242,7 +668,20 @@ size_t getUtf8Length(const WideStringView &str) {
 
 size_t getUtf8Length(const StringViewBase<char32_t> &str) {
 	size_t ret = 0;
-	for (auto &c : str) { ret += utf8EncodeLength(c); }
+	auto ptr = str.data();
+	auto end = ptr + str.size();
+
+	while (size_t(end - ptr) >= Utf32Block) {
+		// same as utf8EncodeLength
+		for (size_t i = 0; i < Utf32Block; ++i) {
+			const uint32_t c = ptr[i];
+			ret += 1 + uint32_t(c >= 0x80) + uint32_t(c >= 0x800) + uint32_t(c >= 0x1'0000)
+					+ uint32_t(c >= 0x11'0000);
+		}
+		ptr += Utf32Block;
+	}
+
+	while (ptr != end) { ret += utf8EncodeLength(*ptr++); }
 	return ret;
 }
 
@@ -251,10 +690,42 @@ Status toUtf32(char32_t *ibuf, size_t bufSize, const StringView &utf8_str, size_
 	if (!buf) {
 		return Status::ErrorInvalidArguemnt;
 	}
+
+	auto classify = getUtf8Classifier();
+
 	uint8_t offset = 0;
 	auto ptr = utf8_str.data();
 	auto end = ptr + utf8_str.size();
+	auto slow = classify ? ptr : end;
+
+	Utf8Masks m;
+	uint64_t valid = 0;
 	while (ptr < end) {
+		// block produces at most one char per byte
+		if (ptr >= slow && size_t(end - ptr) >= Utf8Block && bufSize >= Utf8Block) {
+			auto block = reinterpret_cast<const uint8_t *>(ptr);
+			classify(block, m);
+			// NUL is decoded by utf8Decode32 as zero-length sequence, so it's left for scalar loop
+			if (m.zero == 0) {
+				if (!m.nonAscii) {
+					for (size_t i = 0; i < Utf8Block; ++i) { buf[i] = char32_t(block[i]); }
+					buf += Utf8Block;
+					bufSize -= Utf8Block;
+					ptr += Utf8Block;
+					continue;
+				}
+				if (auto size = utf8_block_size(m, valid)) {
+					auto target = buf;
+					utf8_decode_unchecked(block, block + size, [&](char32_t c) { *target++ = c; });
+					bufSize -= target - buf;
+					buf = target;
+					ptr += size;
+					continue;
+				}
+			}
+			slow = ptr + Utf8Block;
+		}
+
 		if (bufSize < 1) {
 			return Status::ErrorBufferOverflow;
 		}
@@ -276,7 +747,19 @@ Status toUtf32(char32_t *ibuf, size_t bufSize, const WideStringView &utf16_str,
 	uint8_t offset = 0;
 	auto ptr = utf16_str.data();
 	auto end = ptr + utf16_str.size();
+	auto slow = ptr;
 	while (ptr < end) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf16Block && bufSize >= Utf16Block) {
+			if (utf16_block_info(ptr).surrogates == 0) {
+				for (size_t i = 0; i < Utf16Block; ++i) { buf[i] = char32_t(ptr[i]); }
+				buf += Utf16Block;
+				bufSize -= Utf16Block;
+				ptr += Utf16Block;
+				continue;
+			}
+			slow = ptr + Utf16Block;
+		}
+
 		if (bufSize < 1) {
 			return Status::ErrorBufferOverflow;
 		}
@@ -325,10 +808,48 @@ Status toUtf16(char16_t *ibuf, size_t bufSize, const StringView &utf8_str, size_
 	if (!buf) {
 		return Status::ErrorInvalidArguemnt;
 	}
+
+	auto classify = getUtf8Classifier();
+
 	uint8_t offset = 0;
 	auto ptr = utf8_str.data();
 	auto end = ptr + utf8_str.size();
+	auto slow = classify ? ptr : end;
+
+	Utf8Masks m;
+	uint64_t valid = 0;
 	while (ptr < end) {
+		// block produces at most one unit per byte
+		if (ptr >= slow && size_t(end - ptr) >= Utf8Block && bufSize >= Utf8Block) {
+			auto block = reinterpret_cast<const uint8_t *>(ptr);
+			classify(block, m);
+			// NUL is decoded by utf8Decode32 as zero-length sequence, so it's left for scalar loop
+			if (m.zero == 0) {
+				if (!m.nonAscii) {
+					for (size_t i = 0; i < Utf8Block; ++i) { buf[i] = char16_t(block[i]); }
+					buf += Utf8Block;
+					bufSize -= Utf8Block;
+					ptr += Utf8Block;
+					continue;
+				}
+				if (auto size = utf8_block_size(m, valid)) {
+					auto target = buf;
+					utf8_decode_unchecked(block, block + size, [&](char32_t c) {
+						if (c < 0xD800) {
+							*target++ = char16_t(c);
+						} else {
+							target += utf16EncodeBuf(target, 2, c);
+						}
+					});
+					bufSize -= target - buf;
+					buf = target;
+					ptr += size;
+					continue;
+				}
+			}
+			slow = ptr + Utf8Block;
+		}
+
 		auto ch = utf8Decode32(ptr, end - ptr, offset);
 		if (bufSize < utf16EncodeLength(ch)) {
 			return Status::ErrorBufferOverflow;
@@ -352,7 +873,25 @@ SPRT_API Status toUtf16(char16_t *ibuf, size_t bufSize, const StringViewBase<cha
 	}
 	auto ptr = str.data();
 	auto end = ptr + str.size();
+	auto slow = ptr;
 	while (ptr < end) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf32Block && bufSize >= Utf32Block) {
+			// BMP without surrogates is stored as is
+			uint32_t special = 0;
+			for (size_t i = 0; i < Utf32Block; ++i) {
+				const uint32_t c = ptr[i];
+				special += uint32_t(c >= 0x1'0000) + uint32_t(c - 0xD800 < 0x800);
+			}
+			if (special == 0) {
+				for (size_t i = 0; i < Utf32Block; ++i) { buf[i] = char16_t(ptr[i]); }
+				buf += Utf32Block;
+				bufSize -= Utf32Block;
+				ptr += Utf32Block;
+				continue;
+			}
+			slow = ptr + Utf32Block;
+		}
+
 		auto ch = *ptr++;
 		if (bufSize < utf16EncodeLength(ch)) {
 			return Status::ErrorBufferOverflow;
@@ -460,7 +999,28 @@ Status toUtf8(char *ibuf, size_t bufSize, const WideStringView &str, size_t *ret
 	uint8_t offset;
 	auto ptr = str.data();
 	auto end = ptr + str.size();
+	auto slow = ptr;
 	while (ptr < end) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf16Block) {
+			auto info = utf16_block_info(ptr);
+			const size_t required = Utf16Block + info.ge80 + info.ge800;
+			if (info.surrogates == 0 && bufSize >= required) {
+				if (info.ge80 == 0) {
+					for (size_t i = 0; i < Utf16Block; ++i) { buf[i] = char(ptr[i]); }
+				} else {
+					auto target = buf;
+					for (size_t i = 0; i < Utf16Block; ++i) {
+						target += utf8EncodeBuf(target, 3, ptr[i]);
+					}
+				}
+				buf += required;
+				bufSize -= required;
+				ptr += Utf16Block;
+				continue;
+			}
+			slow = ptr + Utf16Block;
+		}
+
 		auto ch = utf16Decode32(ptr, end - ptr, offset);
 		if (bufSize < utf8EncodeLength(ch)) {
 			return Status::ErrorBufferOverflow;
@@ -483,7 +1043,21 @@ Status toUtf8(char *ibuf, size_t bufSize, const StringViewBase<char32_t> &str, s
 	}
 	auto ptr = str.data();
 	auto end = ptr + str.size();
+	auto slow = ptr;
 	while (ptr < end) {
+		if (ptr >= slow && size_t(end - ptr) >= Utf32Block && bufSize >= Utf32Block) {
+			uint32_t nonAscii = 0;
+			for (size_t i = 0; i < Utf32Block; ++i) { nonAscii += uint32_t(ptr[i] >= 0x80); }
+			if (nonAscii == 0) {
+				for (size_t i = 0; i < Utf32Block; ++i) { buf[i] = char(ptr[i]); }
+				buf += Utf32Block;
+				bufSize -= Utf32Block;
+				ptr += Utf32Block;
+				continue;
+			}
+			slow = ptr + Utf32Block;
+		}
+
 		auto ch = *ptr++;
 		if (bufSize < utf8EncodeLength(ch)) {
 			return Status::ErrorBufferOverflow;
@@ -0,0 +1,599 @@
+/**
+ Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include <sprt/runtime/stringview.h>
+#include <sprt/runtime/unicode.h>
+
+#include "include/__unicode_tables.h"
+
+// Locale-independent case mapping and case-insensitive collation with the built-in tables
+// (see include/__unicode_tables.pl), so results are the same on all platforms.
+//
+// Character functions use simple mappings, string functions - full mappings from
+// SpecialCasing with Final_Sigma context. Title case starts the word on the first letter
+// or digit, the rest of the word is lowercased.
+//
+// caseCompare compares full case folded strings with DUCET primary, then secondary
+// weights (contractions are not supported), then in code point order.
+
+namespace sprt::unicode {
+
+enum class CaseMapping {
+	Lower,
+	Upper,
+	Title,
+	Fold,
+};
+
+// Marks invalid input sequence, that should be copied as is
+static constexpr char32_t InvalidChar = 0xFFFF'FFFF;
+
+static constexpr char32_t CapitalSigma = 0x03A3;
+static constexpr char32_t FinalSigma = 0x03C2;
+
+SPRT_INLINE static inline const detail::CaseRecord &getCaseRecord(char32_t c) {
+	return detail::s_caseRecords[detail::getCaseValue(c)];
+}
+
+SPRT_INLINE static inline char32_t applySimpleMapping(char32_t c, const detail::CaseRecord &rec,
+		CaseMapping mapping) {
+	switch (mapping) {
+	case CaseMapping::Lower: return char32_t(int32_t(c) + rec.lower); break;
+	case CaseMapping::Upper: return char32_t(int32_t(c) + rec.upper); break;
+	case CaseMapping::Title: return char32_t(int32_t(c) + rec.title); break;
+	case CaseMapping::Fold: return char32_t(int32_t(c) + rec.fold); break;
+	}
+	return c;
+}
+
+// Writes full mapping into `out`, that should have space for detail::CaseMaxChars
+static uint32_t applyFullMapping(char32_t c, const detail::CaseRecord &rec, CaseMapping mapping,
+		char32_t *out) {
+	if (!rec.special) {
+		out[0] = applySimpleMapping(c, rec, mapping);
+		return 1;
+	}
+
+	auto &special = detail::s_caseSpecials[rec.special];
+	uint16_t offset = 0;
+	switch (mapping) {
+	case CaseMapping::Lower: offset = special.lower; break;
+	case CaseMapping::Upper: offset = special.upper; break;
+	case CaseMapping::Title: offset = special.title; break;
+	case CaseMapping::Fold: offset = special.fold; break;
+	}
+
+	const uint32_t len = detail::s_caseSpecialChars[offset];
+	for (uint32_t i = 0; i < len; ++i) { out[i] = detail::s_caseSpecialChars[offset + 1 + i]; }
+	return len;
+}
+
+SPRT_INLINE static inline bool isAsciiUnit(char c) { return uint8_t(c) < 0x80; }
+
+SPRT_INLINE static inline bool isAsciiUnit(char16_t c) { return c < 0x80; }
+
+SPRT_INLINE static inline char asciiToLower(char c) {
+	return (c >= 'A' && c <= 'Z') ? char(c + ('a' - 'A')) : c;
+}
+
+SPRT_INLINE static inline char asciiToUpper(char c) {
+	return (c >= 'a' && c <= 'z') ? char(c - ('a' - 'A')) : c;
+}
+
+// Unlike utf8Decode32, decodes only well-formed sequences, a broken sequence is consumed
+// byte by byte as InvalidChar
+static char32_t decodeCaseChar(const char *ptr, size_t len, uint8_t &offset) {
+	const auto b = uint8_t(*ptr);
+	if (b < 0x80) {
+		offset = 1;
+		return char32_t(b);
+	}
+
+	offset = utf8_length_data[b];
+	if (b < 0xC0 || offset > 4 || offset > len) {
+		offset = 1;
+		return InvalidChar;
+	}
+
+	char32_t c = b & utf8_length_mask[b];
+	for (uint8_t i = 1; i < offset; ++i) {
+		if (!isUtf8Surrogate(ptr[i])) {
+			offset = 1;
+			return InvalidChar;
+		}
+		c = (c << 6) | (ptr[i] & 0x3F);
+	}
+
+	if (c >= 0x11'0000) {
+		offset = 1;
+		return InvalidChar;
+	}
+	return c;
+}
+
+static char32_t decodeCaseChar(const char16_t *ptr, size_t len, uint8_t &offset) {
+	if (!isUtf16Surrogate(ptr[0])) {
+		offset = 1;
+		return char32_t(ptr[0]);
+	}
+	if (len > 1 && isUtf16HighSurrogate(ptr[0]) && isUtf16LowSurrogate(ptr[1])) {
+		offset = 2;
+		return utf16CombineSurrogates(ptr[0], ptr[1]);
+	}
+	offset = 1;
+	return InvalidChar;
+}
+
+SPRT_INLINE static inline size_t encodeCaseChar(char *ptr, char32_t c) {
+	return utf8EncodeBuf(ptr, 4, c);
+}
+
+SPRT_INLINE static inline size_t encodeCaseChar(char16_t *ptr, char32_t c) {
+	return utf16EncodeBuf(ptr, 2, c);
+}
+
+template <typename Char>
+static constexpr uint32_t CaseMaxGrowth =
+		sizeof(Char) == 1 ? detail::CaseMaxUtf8Growth : detail::CaseMaxUtf16Growth;
+
+// Final_Sigma: sigma is preceded by cased letter (checked by caller), and not followed by
+// cased letter, case-ignorable characters are skipped
+template <typename Char>
+static bool isFinalSigma(const Char *ptr, const Char *end) {
+	while (ptr < end) {
+		uint8_t offset = 0;
+		auto c = decodeCaseChar(ptr, end - ptr, offset);
+		if (c == InvalidChar) {
+			return true;
+		}
+
+		auto &rec = getCaseRecord(c);
+		if (rec.flags & detail::CaseFlagCased) {
+			return false;
+		} else if (!(rec.flags & detail::CaseFlagIgnorable)) {
+			return true;
+		}
+		ptr += offset;
+	}
+	return true;
+}
+
+// Updates state for Final_Sigma context with the processed character
+SPRT_INLINE static inline void updateCasedBefore(bool &casedBefore, const detail::CaseRecord &rec) {
+	if (rec.flags & detail::CaseFlagCased) {
+		casedBefore = true;
+	} else if (!(rec.flags & detail::CaseFlagIgnorable)) {
+		casedBefore = false;
+	}
+}
+
+// Updates Final_Sigma context after ASCII characters, only the tail of ignorable characters
+// should be checked
+template <typename Char>
+static void updateCasedBeforeAscii(bool &casedBefore, const Char *begin, const Char *end) {
+	while (end != begin) {
+		--end;
+		auto &rec = getCaseRecord(char32_t(*end));
+		if (!(rec.flags & detail::CaseFlagIgnorable) || (rec.flags & detail::CaseFlagCased)) {
+			casedBefore = (rec.flags & detail::CaseFlagCased);
+			return;
+		}
+	}
+}
+
+template <typename Char>
+static bool mapString(const callback<void(StringViewBase<Char>)> &cb, StringViewBase<Char> data,
+		CaseMapping mapping) {
+	auto ptr = data.data();
+	const auto end = data.data() + data.size();
+
+	// Strings that start with unchanged ASCII are common for lower and upper case mapping,
+	// string without changes is returned as is
+	if (mapping == CaseMapping::Lower || mapping == CaseMapping::Upper) {
+		if (mapping == CaseMapping::Lower) {
+			while (ptr < end && isAsciiUnit(*ptr) && !(*ptr >= 'A' && *ptr <= 'Z')) { ++ptr; }
+		} else {
+			while (ptr < end && isAsciiUnit(*ptr) && !(*ptr >= 'a' && *ptr <= 'z')) { ++ptr; }
+		}
+		if (ptr == end) {
+			cb(data);
+			return true;
+		}
+	}
+
+	auto buf = __sprt_typed_malloca(Char, data.size() * CaseMaxGrowth<Char> + 1);
+	auto out = buf;
+
+	bool casedBefore = false;
+	if (ptr != data.data()) {
+		__sprt_memcpy(out, data.data(), (ptr - data.data()) * sizeof(Char));
+		out += ptr - data.data();
+		updateCasedBeforeAscii(casedBefore, data.data(), ptr);
+	}
+
+	bool wordStart = true;
+	char32_t mapped[detail::CaseMaxChars];
+
+	while (ptr < end) {
+		if (isAsciiUnit(*ptr) && mapping != CaseMapping::Title) {
+			auto runStart = ptr;
+			do { ++ptr; } while (ptr < end && isAsciiUnit(*ptr));
+
+			if (mapping == CaseMapping::Upper) {
+				for (auto it = runStart; it != ptr; ++it) { *out++ = Char(asciiToUpper(char(*it))); }
+			} else {
+				for (auto it = runStart; it != ptr; ++it) { *out++ = Char(asciiToLower(char(*it))); }
+			}
+			updateCasedBeforeAscii(casedBefore, runStart, ptr);
+			continue;
+		}
+
+		uint8_t offset = 0;
+		auto c = decodeCaseChar(ptr, end - ptr, offset);
+		if (c == InvalidChar) {
+			*out++ = *ptr++;
+			casedBefore = false;
+			wordStart = true;
+			continue;
+		}
+
+		auto &rec = getCaseRecord(c);
+		auto charMapping = mapping;
+		if (mapping == CaseMapping::Title) {
+			// case-ignorable characters (like apostrophe) do not break the word
+			charMapping = CaseMapping::Lower;
+			if (rec.flags & (detail::CaseFlagCased | detail::CaseFlagWord)) {
+				if (wordStart) {
+					charMapping = CaseMapping::Title;
+				}
+				wordStart = false;
+			} else if (!(rec.flags & detail::CaseFlagIgnorable)) {
+				wordStart = true;
+			}
+		}
+
+		if (c == CapitalSigma && charMapping == CaseMapping::Lower && casedBefore
+				&& isFinalSigma(ptr + offset, end)) {
+			out += encodeCaseChar(out, FinalSigma);
+		} else {
+			auto len = applyFullMapping(c, rec, charMapping, mapped);
+			for (uint32_t i = 0; i < len; ++i) { out += encodeCaseChar(out, mapped[i]); }
+		}
+
+		updateCasedBefore(casedBefore, rec);
+		ptr += offset;
+	}
+
+	cb(StringViewBase<Char>(buf, out - buf));
+	__sprt_freea(buf);
+	return true;
+}
+
+char32_t tolower(char32_t c) {
+	if (c < 0x80) {
+		return char32_t(asciiToLower(char(c)));
+	}
+	return applySimpleMapping(c, getCaseRecord(c), CaseMapping::Lower);
+}
+
+char32_t toupper(char32_t c) {
+	if (c < 0x80) {
+		return char32_t(asciiToUpper(char(c)));
+	}
+	return applySimpleMapping(c, getCaseRecord(c), CaseMapping::Upper);
+}
+
+char32_t totitle(char32_t c) {
+	if (c < 0x80) {
+		return char32_t(asciiToUpper(char(c)));
+	}
+	return applySimpleMapping(c, getCaseRecord(c), CaseMapping::Title);
+}
+
+bool toupper(const callback<void(StringView)> &cb, StringView data) {
+	return mapString(cb, data, CaseMapping::Upper);
+}
+
+bool totitle(const callback<void(StringView)> &cb, StringView data) {
+	return mapString(cb, data, CaseMapping::Title);
+}
+
+bool tolower(const callback<void(StringView)> &cb, StringView data) {
+	return mapString(cb, data, CaseMapping::Lower);
+}
+
+bool toupper(const callback<void(WideStringView)> &cb, WideStringView data) {
+	return mapString(cb, data, CaseMapping::Upper);
+}
+
+bool totitle(const callback<void(WideStringView)> &cb, WideStringView data) {
+	return mapString(cb, data, CaseMapping::Title);
+}
+
+bool tolower(const callback<void(WideStringView)> &cb, WideStringView data) {
+	return mapString(cb, data, CaseMapping::Lower);
+}
+
+bool compare(StringView l, StringView r, int *result) {
+	if (!result) {
+		return false;
+	}
+
+	// byte order of UTF-8 is the code point order
+	auto ret = __sprt_memcmp(l.data(), r.data(), sprt::min(l.size(), r.size()));
+	if (ret == 0) {
+		ret = l.size() < r.size() ? -1 : (l.size() > r.size() ? 1 : 0);
+	}
+	*result = ret < 0 ? -1 : (ret > 0 ? 1 : 0);
+	return true;
+}
+
+bool compare(WideStringView l, WideStringView r, int *result) {
+	if (!result) {
+		return false;
+	}
+
+	const auto size = sprt::min(l.size(), r.size());
+	for (size_t i = 0; i < size; ++i) {
+		auto a = l[i];
+		auto b = r[i];
+		if (a != b) {
+			// Surrogates should be ordered after U+E000..U+FFFF for the code point order
+			if (a >= 0xD800 && b >= 0xD800) {
+				a = (a >= 0xE000) ? char16_t(a - 0x800) : char16_t(a + 0x2000);
+				b = (b >= 0xE000) ? char16_t(b - 0x800) : char16_t(b + 0x2000);
+			}
+			*result = a < b ? -1 : 1;
+			return true;
+		}
+	}
+
+	*result = l.size() < r.size() ? -1 : (l.size() > r.size() ? 1 : 0);
+	return true;
+}
+
+// Full case folding into UTF-32, output should have space for size * detail::CaseMaxChars;
+// invalid sequences are preserved as U+FFFD
+template <typename Char>
+static size_t foldString(const Char *ptr, size_t size, char32_t *out) {
+	const auto end = ptr + size;
+	const auto start = out;
+	while (ptr < end) {
+		if (isAsciiUnit(*ptr)) {
+			*out++ = char32_t(asciiToLower(char(*ptr++)));
+			continue;
+		}
+
+		uint8_t offset = 0;
+		auto c = decodeCaseChar(ptr, end - ptr, offset);
+		if (c == InvalidChar) {
+			*out++ = 0xFFFD;
+		} else {
+			out += applyFullMapping(c, getCaseRecord(c), CaseMapping::Fold, out);
+		}
+		ptr += offset;
+	}
+	return out - start;
+}
+
+// Iterates over DUCET collation elements of the string: (primaryKey << 8) | secondaryRank
+class CollationIterator {
+public:
+	CollationIterator(const char32_t *ptr, size_t size) : _ptr(ptr), _end(ptr + size) { }
+
+	bool nextPrimary(uint32_t &value) {
+		uint32_t element = 0;
+		while (next(element)) {
+			if (element >> 8) {
+				value = element >> 8;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool nextSecondary(uint32_t &value) {
+		uint32_t element = 0;
+		while (next(element)) {
+			if (element & 0xFF) {
+				value = element & 0xFF;
+				return true;
+			}
+		}
+		return false;
+	}
+
+protected:
+	static constexpr char32_t HangulBase = 0xAC00;
+	static constexpr char32_t HangulLast = 0xD7A3;
+	static constexpr char32_t HangulLBase = 0x1100;
+	static constexpr char32_t HangulVBase = 0x1161;
+	static constexpr char32_t HangulTBase = 0x11A7;
+	static constexpr uint32_t HangulTCount = 28;
+	static constexpr uint32_t HangulNCount = 21 * HangulTCount;
+
+	bool next(uint32_t &element) {
+		while (_count == 0) {
+			if (_ptr == _end) {
+				return false;
+			}
+			load(*_ptr++);
+		}
+		--_count;
+		element = *_elements++;
+		return true;
+	}
+
+	static uint32_t makeElement(uint32_t primary, uint32_t secondary) {
+		return (primary << 8) | secondary;
+	}
+
+	void load(char32_t c) {
+		const auto value = detail::getCollationValue(c);
+		if (value == 0) {
+			_count = 0;
+		} else if (value & detail::CollationExpansionFlag) {
+			const auto offset = value & ~detail::CollationExpansionFlag;
+			_count = detail::s_collationExpansions[offset];
+			_elements = &detail::s_collationExpansions[offset + 1];
+		} else if (value != detail::CollationImplicitValue) {
+			_buffer[0] = makeElement(value, detail::CollationCommonSecondary);
+			_elements = _buffer;
+			_count = 1;
+		} else if (c >= HangulBase && c <= HangulLast) {
+			// Hangul syllables are not listed in DUCET, jamo have single element
+			const auto index = c - HangulBase;
+			_buffer[0] = makeElement(detail::getCollationValue(HangulLBase + index / HangulNCount),
+					detail::CollationCommonSecondary);
+			_buffer[1] = makeElement(
+					detail::getCollationValue(
+							HangulVBase + (index % HangulNCount) / HangulTCount),
+					detail::CollationCommonSecondary);
+			_elements = _buffer;
+			_count = 2;
+			if (index % HangulTCount) {
+				_buffer[2] = makeElement(
+						detail::getCollationValue(HangulTBase + index % HangulTCount),
+						detail::CollationCommonSecondary);
+				_count = 3;
+			}
+		} else {
+			loadImplicit(c);
+		}
+	}
+
+	void loadImplicit(char32_t c) {
+		uint32_t aaaa = 0;
+		uint32_t bbbb = 0;
+		for (auto &it : detail::s_collationImplicitRanges) {
+			if (c >= it.first && c <= it.last) {
+				aaaa = it.base;
+				bbbb = (c - it.first) | 0x8000;
+				break;
+			}
+		}
+
+		if (!aaaa) {
+			aaaa = 0xFBC0;
+			for (auto &it : detail::s_collationIdeographs) {
+				if (c >= it.first && c <= it.last) {
+					aaaa = ((c >= 0x4E00 && c <= 0x9FFF) || (c >= 0xF900 && c <= 0xFAFF)) ? 0xFB40
+																						  : 0xFB80;
+					break;
+				}
+			}
+			aaaa += c >> 15;
+			bbbb = (c & 0x7FFF) | 0x8000;
+		}
+
+		_buffer[0] = makeElement(detail::CollationImplicitBase + aaaa,
+				detail::CollationCommonSecondary);
+		_buffer[1] = makeElement(detail::CollationImplicitBase + bbbb, 0);
+		_elements = _buffer;
+		_count = 2;
+	}
+
+	const char32_t *_ptr = nullptr;
+	const char32_t *_end = nullptr;
+	const uint32_t *_elements = nullptr;
+	uint32_t _count = 0;
+	uint32_t _buffer[3];
+};
+
+static int compareFolded(const char32_t *l, size_t lSize, const char32_t *r, size_t rSize) {
+	if (lSize == rSize && __sprt_memcmp(l, r, lSize * sizeof(char32_t)) == 0) {
+		return 0;
+	}
+
+	uint32_t a = 0;
+	uint32_t b = 0;
+
+	CollationIterator lPrimary(l, lSize);
+	CollationIterator rPrimary(r, rSize);
+	while (true) {
+		auto hasL = lPrimary.nextPrimary(a);
+		auto hasR = rPrimary.nextPrimary(b);
+		if (!hasL || !hasR) {
+			if (hasL != hasR) {
+				return hasL ? 1 : -1;
+			}
+			break;
+		}
+		if (a != b) {
+			return a < b ? -1 : 1;
+		}
+	}
+
+	CollationIterator lSecondary(l, lSize);
+	CollationIterator rSecondary(r, rSize);
+	while (true) {
+		auto hasL = lSecondary.nextSecondary(a);
+		auto hasR = rSecondary.nextSecondary(b);
+		if (!hasL || !hasR) {
+			if (hasL != hasR) {
+				return hasL ? 1 : -1;
+			}
+			break;
+		}
+		if (a != b) {
+			return a < b ? -1 : 1;
+		}
+	}
+
+	// collation-equal strings are ordered by code points
+	const auto size = sprt::min(lSize, rSize);
+	for (size_t i = 0; i < size; ++i) {
+		if (l[i] != r[i]) {
+			return l[i] < r[i] ? -1 : 1;
+		}
+	}
+	return lSize < rSize ? -1 : (lSize > rSize ? 1 : 0);
+}
+
+template <typename Char>
+static bool caseCompareString(StringViewBase<Char> l, StringViewBase<Char> r, int *result) {
+	if (!result) {
+		return false;
+	}
+
+	auto lBuf = __sprt_typed_malloca(char32_t, l.size() * detail::CaseMaxChars + 1);
+	auto rBuf = __sprt_typed_malloca(char32_t, r.size() * detail::CaseMaxChars + 1);
+
+	auto lSize = foldString(l.data(), l.size(), lBuf);
+	auto rSize = foldString(r.data(), r.size(), rBuf);
+
+	*result = compareFolded(lBuf, lSize, rBuf, rSize);
+
+	__sprt_freea(rBuf);
+	__sprt_freea(lBuf);
+	return true;
+}
+
+bool caseCompare(StringView l, StringView r, int *result) {
+	return caseCompareString(l, r, result);
+}
+
+bool caseCompare(WideStringView l, WideStringView r, int *result) {
+	return caseCompareString(l, r, result);
+}
+
+} // namespace sprt::unicode
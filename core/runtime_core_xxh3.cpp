@@ -0,0 +1,644 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include <sprt/runtime/hash.h>
+#include <sprt/cxx/bit>
+
+#if __AVX2__
+#include <simde/x86/avx2.h>
+#define SPRT_XXH3_SIMD_AVX2 1
+#elif __ARM_NEON
+#include <simde/arm/neon.h>
+#define SPRT_XXH3_SIMD_NEON 1
+#elif __SSE2__
+#include <simde/x86/sse2.h>
+#define SPRT_XXH3_SIMD_SSE2 1
+#endif
+
+// XXH3 (xxHash 0.8), output is compatible with the reference XXH3_64bits/XXH3_128bits
+// with default secret and seed variants
+
+namespace sprt::xxh3 {
+
+static constexpr uint32_t PRIME32_1 = 0x9E37'79B1U;
+static constexpr uint32_t PRIME32_2 = 0x85EB'CA77U;
+static constexpr uint32_t PRIME32_3 = 0xC2B2'AE3DU;
+
+static constexpr uint64_t PRIME64_1 = 0x9E37'79B1'85EB'CA87ULL;
+static constexpr uint64_t PRIME64_2 = 0xC2B2'AE3D'27D4'EB4FULL;
+static constexpr uint64_t PRIME64_3 = 0x1656'67B1'9E37'79F9ULL;
+static constexpr uint64_t PRIME64_4 = 0x85EB'CA77'C2B2'AE63ULL;
+static constexpr uint64_t PRIME64_5 = 0x27D4'EB2F'1656'67C5ULL;
+
+static constexpr uint64_t PRIME_MX1 = 0x1656'6791'9E37'79F9ULL;
+static constexpr uint64_t PRIME_MX2 = 0x9FB2'1C65'1E98'DF25ULL;
+
+static constexpr size_t StripeLen = 64;
+static constexpr size_t SecretConsumeRate = 8;
+static constexpr size_t AccCount = StripeLen / sizeof(uint64_t);
+static constexpr size_t SecretSizeMin = 136;
+static constexpr size_t MidSizeMax = 240;
+static constexpr size_t MidSizeStartOffset = 3;
+static constexpr size_t MidSizeLastOffset = 17;
+static constexpr size_t SecretLastAccStart = 7;
+static constexpr size_t SecretMergeAccsStart = 11;
+
+static constexpr size_t StripesPerBlock = (SecretSize - StripeLen) / SecretConsumeRate;
+static constexpr size_t BufferStripes = sizeof(Ctx::buffer) / StripeLen;
+
+static inline uint32_t readLE32(const uint8_t *ptr) {
+	uint32_t val;
+	__builtin_memcpy(&val, ptr, sizeof(val));
+	if constexpr (endian::native == endian::big) {
+		return __builtin_bswap32(val);
+	}
+	return val;
+}
+
+static inline uint64_t readLE64(const uint8_t *ptr) {
+	uint64_t val;
+	__builtin_memcpy(&val, ptr, sizeof(val));
+	if constexpr (endian::native == endian::big) {
+		return __builtin_bswap64(val);
+	}
+	return val;
+}
+
+static inline void writeLE64(uint8_t *ptr, uint64_t val) {
+	if constexpr (endian::native == endian::big) {
+		val = __builtin_bswap64(val);
+	}
+	__builtin_memcpy(ptr, &val, sizeof(val));
+}
+
+static inline uint64_t rotl64(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+static inline uint32_t rotl32(uint32_t x, int r) { return (x << r) | (x >> (32 - r)); }
+
+static inline uint64_t xorshift64(uint64_t v, int shift) { return v ^ (v >> shift); }
+
+static inline uint64_t mult32to64(uint64_t a, uint64_t b) {
+	return uint64_t(uint32_t(a)) * uint64_t(uint32_t(b));
+}
+
+static inline Hash128 mult64to128(uint64_t lhs, uint64_t rhs) {
+#if __SIZEOF_INT128__
+	auto product = static_cast<unsigned __int128>(lhs) * rhs;
+	return Hash128{uint64_t(product), uint64_t(product >> 64)};
+#else
+	auto lo_lo = mult32to64(lhs & 0xFFFF'FFFF, rhs & 0xFFFF'FFFF);
+	auto hi_lo = mult32to64(lhs >> 32, rhs & 0xFFFF'FFFF);
+	auto lo_hi = mult32to64(lhs & 0xFFFF'FFFF, rhs >> 32);
+	auto hi_hi = mult32to64(lhs >> 32, rhs >> 32);
+
+	auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFF) + lo_hi;
+	auto upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+	auto lower = (cross << 32) | (lo_lo & 0xFFFF'FFFF);
+	return Hash128{lower, upper};
+#endif
+}
+
+static inline uint64_t mul128_fold64(uint64_t lhs, uint64_t rhs) {
+	auto product = mult64to128(lhs, rhs);
+	return product.low ^ product.high;
+}
+
+static inline uint64_t xxh64_avalanche(uint64_t h) {
+	h ^= h >> 33;
+	h *= PRIME64_2;
+	h ^= h >> 29;
+	h *= PRIME64_3;
+	h ^= h >> 32;
+	return h;
+}
+
+static inline uint64_t avalanche(uint64_t h) {
+	h = xorshift64(h, 37);
+	h *= PRIME_MX1;
+	return xorshift64(h, 32);
+}
+
+static inline uint64_t rrmxmx(uint64_t h, uint64_t len) {
+	h ^= rotl64(h, 49) ^ rotl64(h, 24);
+	h *= PRIME_MX2;
+	h ^= (h >> 35) + len;
+	h *= PRIME_MX2;
+	return xorshift64(h, 28);
+}
+
+static inline uint64_t mix16B(const uint8_t *input, const uint8_t *secret, uint64_t seed) {
+	return mul128_fold64(readLE64(input) ^ (readLE64(secret) + seed),
+			readLE64(input + 8) ^ (readLE64(secret + 8) - seed));
+}
+
+/*
+	Long input kernels: 64-byte stripes over 8 64-bit accumulators
+*/
+
+#if SPRT_XXH3_SIMD_AVX2
+
+static inline void accumulate512(uint64_t *acc, const uint8_t *input, const uint8_t *secret) {
+	auto xacc = reinterpret_cast<simde__m256i *>(acc);
+	for (size_t i = 0; i < StripeLen / sizeof(simde__m256i); ++i) {
+		auto accVec = simde_mm256_load_si256(xacc + i);
+		auto data = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i *>(input) + i);
+		auto key = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i *>(secret) + i);
+		auto dataKey = simde_mm256_xor_si256(data, key);
+		auto product = simde_mm256_mul_epu32(dataKey, simde_mm256_srli_epi64(dataKey, 32));
+		auto swapped = simde_mm256_shuffle_epi32(data, SIMDE_MM_SHUFFLE(1, 0, 3, 2));
+		simde_mm256_store_si256(xacc + i,
+				simde_mm256_add_epi64(product, simde_mm256_add_epi64(accVec, swapped)));
+	}
+}
+
+static inline void scramble(uint64_t *acc, const uint8_t *secret) {
+	auto xacc = reinterpret_cast<simde__m256i *>(acc);
+	auto prime = simde_mm256_set1_epi32(int(PRIME32_1));
+	for (size_t i = 0; i < StripeLen / sizeof(simde__m256i); ++i) {
+		auto accVec = simde_mm256_load_si256(xacc + i);
+		auto data = simde_mm256_xor_si256(accVec, simde_mm256_srli_epi64(accVec, 47));
+		auto key = simde_mm256_loadu_si256(reinterpret_cast<const simde__m256i *>(secret) + i);
+		auto dataKey = simde_mm256_xor_si256(data, key);
+		auto lo = simde_mm256_mul_epu32(dataKey, prime);
+		auto hi = simde_mm256_mul_epu32(simde_mm256_srli_epi64(dataKey, 32), prime);
+		simde_mm256_store_si256(xacc + i, simde_mm256_add_epi64(lo, simde_mm256_slli_epi64(hi, 32)));
+	}
+}
+
+#elif SPRT_XXH3_SIMD_NEON
+
+static inline void accumulate512(uint64_t *acc, const uint8_t *input, const uint8_t *secret) {
+	for (size_t i = 0; i < AccCount; i += 2) {
+		auto data = simde_vld1q_u8(input + i * 8);
+		auto key = simde_vld1q_u8(secret + i * 8);
+		auto dataVec = simde_vreinterpretq_u64_u8(data);
+		auto dataKey = simde_vreinterpretq_u64_u8(simde_veorq_u8(data, key));
+
+		// acc[lane ^ 1] += data[lane], acc[lane] += lo32(dataKey) * hi32(dataKey)
+		auto sum = simde_vaddq_u64(simde_vld1q_u64(acc + i), simde_vextq_u64(dataVec, dataVec, 1));
+		sum = simde_vmlal_u32(sum, simde_vmovn_u64(dataKey), simde_vshrn_n_u64(dataKey, 32));
+		simde_vst1q_u64(acc + i, sum);
+	}
+}
+
+static inline void scramble(uint64_t *acc, const uint8_t *secret) {
+	auto prime = simde_vdup_n_u32(PRIME32_1);
+	for (size_t i = 0; i < AccCount; i += 2) {
+		auto accVec = simde_vld1q_u64(acc + i);
+		auto key = simde_vreinterpretq_u64_u8(simde_vld1q_u8(secret + i * 8));
+		auto dataKey =
+				simde_veorq_u64(simde_veorq_u64(accVec, simde_vshrq_n_u64(accVec, 47)), key);
+
+		// 64x32 multiply from two 32x32 halves
+		auto hi = simde_vshlq_n_u64(simde_vmull_u32(simde_vshrn_n_u64(dataKey, 32), prime), 32);
+		simde_vst1q_u64(acc + i, simde_vmlal_u32(hi, simde_vmovn_u64(dataKey), prime));
+	}
+}
+
+#elif SPRT_XXH3_SIMD_SSE2
+
+static inline void accumulate512(uint64_t *acc, const uint8_t *input, const uint8_t *secret) {
+	auto xacc = reinterpret_cast<simde__m128i *>(acc);
+	for (size_t i = 0; i < StripeLen / sizeof(simde__m128i); ++i) {
+		auto accVec = simde_mm_load_si128(xacc + i);
+		auto data = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i *>(input) + i);
+		auto key = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i *>(secret) + i);
+		auto dataKey = simde_mm_xor_si128(data, key);
+		auto product = simde_mm_mul_epu32(dataKey,
+				simde_mm_shuffle_epi32(dataKey, SIMDE_MM_SHUFFLE(0, 3, 0, 1)));
+		auto swapped = simde_mm_shuffle_epi32(data, SIMDE_MM_SHUFFLE(1, 0, 3, 2));
+		simde_mm_store_si128(xacc + i, simde_mm_add_epi64(product, simde_mm_add_epi64(accVec, swapped)));
+	}
+}
+
+static inline void scramble(uint64_t *acc, const uint8_t *secret) {
+	auto xacc = reinterpret_cast<simde__m128i *>(acc);
+	auto prime = simde_mm_set1_epi32(int(PRIME32_1));
+	for (size_t i = 0; i < StripeLen / sizeof(simde__m128i); ++i) {
+		auto accVec = simde_mm_load_si128(xacc + i);
+		auto data = simde_mm_xor_si128(accVec, simde_mm_srli_epi64(accVec, 47));
+		auto key = simde_mm_loadu_si128(reinterpret_cast<const simde__m128i *>(secret) + i);
+		auto dataKey = simde_mm_xor_si128(data, key);
+		auto lo = simde_mm_mul_epu32(dataKey, prime);
+		auto hi = simde_mm_mul_epu32(simde_mm_shuffle_epi32(dataKey, SIMDE_MM_SHUFFLE(0, 3, 0, 1)),
+				prime);
+		simde_mm_store_si128(xacc + i, simde_mm_add_epi64(lo, simde_mm_slli_epi64(hi, 32)));
+	}
+}
+
+#else
+
+static inline void accumulate512(uint64_t *acc, const uint8_t *input, const uint8_t *secret) {
+	for (size_t i = 0; i < AccCount; ++i) {
+		auto data = readLE64(input + i * 8);
+		auto dataKey = data ^ readLE64(secret + i * 8);
+		acc[i ^ 1] += data;
+		acc[i] += mult32to64(dataKey, dataKey >> 32);
+	}
+}
+
+static inline void scramble(uint64_t *acc, const uint8_t *secret) {
+	for (size_t i = 0; i < AccCount; ++i) {
+		auto val = xorshift64(acc[i], 47) ^ readLE64(secret + i * 8);
+		acc[i] = val * PRIME32_1;
+	}
+}
+
+#endif
+
+static inline void accumulate(uint64_t *acc, const uint8_t *input, const uint8_t *secret,
+		size_t nStripes) {
+	for (size_t n = 0; n < nStripes; ++n) {
+		accumulate512(acc, input + n * StripeLen, secret + n * SecretConsumeRate);
+	}
+}
+
+static inline void initAcc(uint64_t *acc) {
+	acc[0] = PRIME32_3;
+	acc[1] = PRIME64_1;
+	acc[2] = PRIME64_2;
+	acc[3] = PRIME64_3;
+	acc[4] = PRIME64_4;
+	acc[5] = PRIME32_2;
+	acc[6] = PRIME64_5;
+	acc[7] = PRIME32_1;
+}
+
+static void initSecret(uint8_t *secret, uint64_t seed) {
+	for (size_t i = 0; i < SecretSize / 16; ++i) {
+		writeLE64(secret + 16 * i, readLE64(DefaultSecret + 16 * i) + seed);
+		writeLE64(secret + 16 * i + 8, readLE64(DefaultSecret + 16 * i + 8) - seed);
+	}
+}
+
+static void hashLongLoop(uint64_t *acc, const uint8_t *input, size_t len, const uint8_t *secret) {
+	static constexpr size_t BlockLen = StripeLen * StripesPerBlock;
+
+	auto nBlocks = (len - 1) / BlockLen;
+	for (size_t n = 0; n < nBlocks; ++n) {
+		accumulate(acc, input + n * BlockLen, secret, StripesPerBlock);
+		scramble(acc, secret + SecretSize - StripeLen);
+	}
+
+	auto nStripes = ((len - 1) - (BlockLen * nBlocks)) / StripeLen;
+	accumulate(acc, input + nBlocks * BlockLen, secret, nStripes);
+
+	// last stripe
+	accumulate512(acc, input + len - StripeLen, secret + SecretSize - StripeLen - SecretLastAccStart);
+}
+
+static uint64_t mergeAccs(const uint64_t *acc, const uint8_t *secret, uint64_t start) {
+	auto result = start;
+	for (size_t i = 0; i < 4; ++i) {
+		result += mul128_fold64(acc[2 * i] ^ readLE64(secret + 16 * i),
+				acc[2 * i + 1] ^ readLE64(secret + 16 * i + 8));
+	}
+	return avalanche(result);
+}
+
+/*
+	64-bit variant
+*/
+
+static uint64_t len0to16_64(const uint8_t *input, size_t len, const uint8_t *secret, uint64_t seed) {
+	if (len > 8) {
+		auto bitflip1 = (readLE64(secret + 24) ^ readLE64(secret + 32)) + seed;
+		auto bitflip2 = (readLE64(secret + 40) ^ readLE64(secret + 48)) - seed;
+		auto lo = readLE64(input) ^ bitflip1;
+		auto hi = readLE64(input + len - 8) ^ bitflip2;
+		return avalanche(len + __builtin_bswap64(lo) + hi + mul128_fold64(lo, hi));
+	} else if (len >= 4) {
+		seed ^= uint64_t(__builtin_bswap32(uint32_t(seed))) << 32;
+		auto input1 = readLE32(input);
+		auto input2 = readLE32(input + len - 4);
+		auto bitflip = (readLE64(secret + 8) ^ readLE64(secret + 16)) - seed;
+		return rrmxmx((input2 + (uint64_t(input1) << 32)) ^ bitflip, len);
+	} else if (len > 0) {
+		uint32_t combined = (uint32_t(input[0]) << 16) | (uint32_t(input[len >> 1]) << 24)
+				| uint32_t(input[len - 1]) | (uint32_t(len) << 8);
+		auto bitflip = (readLE32(secret) ^ readLE32(secret + 4)) + seed;
+		return xxh64_avalanche(uint64_t(combined) ^ bitflip);
+	}
+	return xxh64_avalanche(seed ^ (readLE64(secret + 56) ^ readLE64(secret + 64)));
+}
+
+static uint64_t len17to128_64(const uint8_t *input, size_t len, const uint8_t *secret,
+		uint64_t seed) {
+	uint64_t acc = len * PRIME64_1;
+	if (len > 32) {
+		if (len > 64) {
+			if (len > 96) {
+				acc += mix16B(input + 48, secret + 96, seed);
+				acc += mix16B(input + len - 64, secret + 112, seed);
+			}
+			acc += mix16B(input + 32, secret + 64, seed);
+			acc += mix16B(input + len - 48, secret + 80, seed);
+		}
+		acc += mix16B(input + 16, secret + 32, seed);
+		acc += mix16B(input + len - 32, secret + 48, seed);
+	}
+	acc += mix16B(input, secret, seed);
+	acc += mix16B(input + len - 16, secret + 16, seed);
+	return avalanche(acc);
+}
+
+static uint64_t len129to240_64(const uint8_t *input, size_t len, const uint8_t *secret,
+		uint64_t seed) {
+	uint64_t acc = len * PRIME64_1;
+	auto nRounds = len / 16;
+	for (size_t i = 0; i < 8; ++i) { acc += mix16B(input + 16 * i, secret + 16 * i, seed); }
+	acc = avalanche(acc);
+
+	auto accEnd = mix16B(input + len - 16, secret + SecretSizeMin - MidSizeLastOffset, seed);
+	for (size_t i = 8; i < nRounds; ++i) {
+		accEnd += mix16B(input + 16 * i, secret + 16 * (i - 8) + MidSizeStartOffset, seed);
+	}
+	return avalanche(acc + accEnd);
+}
+
+static uint64_t hashLong64(const uint8_t *input, size_t len, const uint8_t *secret) {
+	alignas(64) uint64_t acc[AccCount];
+	initAcc(acc);
+	hashLongLoop(acc, input, len, secret);
+	return mergeAccs(acc, secret + SecretMergeAccsStart, uint64_t(len) * PRIME64_1);
+}
+
+uint64_t hash64(const void *data, size_t len, uint64_t seed) {
+	auto input = static_cast<const uint8_t *>(data);
+	if (len <= 16) {
+		return len0to16_64(input, len, DefaultSecret, seed);
+	} else if (len <= 128) {
+		return len17to128_64(input, len, DefaultSecret, seed);
+	} else if (len <= MidSizeMax) {
+		return len129to240_64(input, len, DefaultSecret, seed);
+	} else if (seed == 0) {
+		return hashLong64(input, len, DefaultSecret);
+	}
+
+	alignas(64) uint8_t secret[SecretSize];
+	initSecret(secret, seed);
+	return hashLong64(input, len, secret);
+}
+
+/*
+	128-bit variant
+*/
+
+static Hash128 len0to16_128(const uint8_t *input, size_t len, const uint8_t *secret,
+		uint64_t seed) {
+	if (len > 8) {
+		auto bitflipl = (readLE64(secret + 32) ^ readLE64(secret + 40)) - seed;
+		auto bitfliph = (readLE64(secret + 48) ^ readLE64(secret + 56)) + seed;
+		auto inputLo = readLE64(input);
+		auto inputHi = readLE64(input + len - 8);
+
+		auto m128 = mult64to128(inputLo ^ inputHi ^ bitflipl, PRIME64_1);
+		m128.low += uint64_t(len - 1) << 54;
+		inputHi ^= bitfliph;
+		m128.high += inputHi + mult32to64(uint32_t(inputHi), PRIME32_2 - 1);
+		m128.low ^= __builtin_bswap64(m128.high);
+
+		auto h128 = mult64to128(m128.low, PRIME64_2);
+		h128.high += m128.high * PRIME64_2;
+		return Hash128{avalanche(h128.low), avalanche(h128.high)};
+	} else if (len >= 4) {
+		seed ^= uint64_t(__builtin_bswap32(uint32_t(seed))) << 32;
+		auto inputLo = readLE32(input);
+		auto inputHi = readLE32(input + len - 4);
+		auto bitflip = (readLE64(secret + 16) ^ readLE64(secret + 24)) + seed;
+		auto keyed = (inputLo + (uint64_t(inputHi) << 32)) ^ bitflip;
+
+		auto m128 = mult64to128(keyed, PRIME64_1 + (len << 2));
+		m128.high += (m128.low << 1);
+		m128.low ^= (m128.high >> 3);
+
+		m128.low = xorshift64(m128.low, 35);
+		m128.low *= PRIME_MX2;
+		m128.low = xorshift64(m128.low, 28);
+		m128.high = avalanche(m128.high);
+		return m128;
+	} else if (len > 0) {
+		uint32_t combinedl = (uint32_t(input[0]) << 16) | (uint32_t(input[len >> 1]) << 24)
+				| uint32_t(input[len - 1]) | (uint32_t(len) << 8);
+		uint32_t combinedh = rotl32(__builtin_bswap32(combinedl), 13);
+		auto bitflipl = (readLE32(secret) ^ readLE32(secret + 4)) + seed;
+		auto bitfliph = (readLE32(secret + 8) ^ readLE32(secret + 12)) - seed;
+		return Hash128{xxh64_avalanche(uint64_t(combinedl) ^ bitflipl),
+			xxh64_avalanche(uint64_t(combinedh) ^ bitfliph)};
+	}
+
+	auto bitflipl = readLE64(secret + 64) ^ readLE64(secret + 72);
+	auto bitfliph = readLE64(secret + 80) ^ readLE64(secret + 88);
+	return Hash128{xxh64_avalanche(seed ^ bitflipl), xxh64_avalanche(seed ^ bitfliph)};
+}
+
+static inline Hash128 mix32B(Hash128 acc, const uint8_t *input1, const uint8_t *input2,
+		const uint8_t *secret, uint64_t seed) {
+	acc.low += mix16B(input1, secret, seed);
+	acc.low ^= readLE64(input2) + readLE64(input2 + 8);
+	acc.high += mix16B(input2, secret + 16, seed);
+	acc.high ^= readLE64(input1) + readLE64(input1 + 8);
+	return acc;
+}
+
+static inline Hash128 finalizeMid128(Hash128 acc, size_t len, uint64_t seed) {
+	Hash128 h128;
+	h128.low = avalanche(acc.low + acc.high);
+	h128.high = uint64_t(0)
+			- avalanche((acc.low * PRIME64_1) + (acc.high * PRIME64_4) + ((len - seed) * PRIME64_2));
+	return h128;
+}
+
+static Hash128 len17to128_128(const uint8_t *input, size_t len, const uint8_t *secret,
+		uint64_t seed) {
+	Hash128 acc{len * PRIME64_1, 0};
+	if (len > 32) {
+		if (len > 64) {
+			if (len > 96) {
+				acc = mix32B(acc, input + 48, input + len - 64, secret + 96, seed);
+			}
+			acc = mix32B(acc, input + 32, input + len - 48, secret + 64, seed);
+		}
+		acc = mix32B(acc, input + 16, input + len - 32, secret + 32, seed);
+	}
+	acc = mix32B(acc, input, input + len - 16, secret, seed);
+	return finalizeMid128(acc, len, seed);
+}
+
+static Hash128 len129to240_128(const uint8_t *input, size_t len, const uint8_t *secret,
+		uint64_t seed) {
+	Hash128 acc{len * PRIME64_1, 0};
+	for (size_t i = 32; i < 160; i += 32) {
+		acc = mix32B(acc, input + i - 32, input + i - 16, secret + i - 32, seed);
+	}
+	acc.low = avalanche(acc.low);
+	acc.high = avalanche(acc.high);
+	for (size_t i = 160; i <= len; i += 32) {
+		acc = mix32B(acc, input + i - 32, input + i - 16, secret + MidSizeStartOffset + i - 160,
+				seed);
+	}
+	acc = mix32B(acc, input + len - 16, input + len - 32,
+			secret + SecretSizeMin - MidSizeLastOffset - 16, uint64_t(0) - seed);
+	return finalizeMid128(acc, len, seed);
+}
+
+static Hash128 mergeAccs128(const uint64_t *acc, const uint8_t *secret, size_t len) {
+	return Hash128{
+		mergeAccs(acc, secret + SecretMergeAccsStart, uint64_t(len) * PRIME64_1),
+		mergeAccs(acc, secret + SecretSize - sizeof(uint64_t) * AccCount - SecretMergeAccsStart,
+				~(uint64_t(len) * PRIME64_2)),
+	};
+}
+
+static Hash128 hashLong128(const uint8_t *input, size_t len, const uint8_t *secret) {
+	alignas(64) uint64_t acc[AccCount];
+	initAcc(acc);
+	hashLongLoop(acc, input, len, secret);
+	return mergeAccs128(acc, secret, len);
+}
+
+Hash128 hash128(const void *data, size_t len, uint64_t seed) {
+	auto input = static_cast<const uint8_t *>(data);
+	if (len <= 16) {
+		return len0to16_128(input, len, DefaultSecret, seed);
+	} else if (len <= 128) {
+		return len17to128_128(input, len, DefaultSecret, seed);
+	} else if (len <= MidSizeMax) {
+		return len129to240_128(input, len, DefaultSecret, seed);
+	} else if (seed == 0) {
+		return hashLong128(input, len, DefaultSecret);
+	}
+
+	alignas(64) uint8_t secret[SecretSize];
+	initSecret(secret, seed);
+	return hashLong128(input, len, secret);
+}
+
+/*
+	Streaming state
+*/
+
+// Process stripes, scrambling accumulators on each block boundary
+static const uint8_t *consumeStripes(uint64_t *acc, uint32_t &stripesSoFar, const uint8_t *input,
+		size_t nStripes, const uint8_t *secret) {
+	auto initialSecret = secret + stripesSoFar * SecretConsumeRate;
+	if (nStripes >= StripesPerBlock - stripesSoFar) {
+		auto nStripesThisIter = StripesPerBlock - stripesSoFar;
+		do {
+			accumulate(acc, input, initialSecret, nStripesThisIter);
+			scramble(acc, secret + SecretSize - StripeLen);
+			input += nStripesThisIter * StripeLen;
+			nStripes -= nStripesThisIter;
+			nStripesThisIter = StripesPerBlock;
+			initialSecret = secret;
+		} while (nStripes >= StripesPerBlock);
+		stripesSoFar = 0;
+	}
+	if (nStripes > 0) {
+		accumulate(acc, input, initialSecret, nStripes);
+		input += nStripes * StripeLen;
+		stripesSoFar += uint32_t(nStripes);
+	}
+	return input;
+}
+
+void init(Ctx &ctx, uint64_t seed) {
+	initAcc(ctx.acc);
+	initSecret(ctx.secret, seed);
+	ctx.seed = seed;
+	ctx.length = 0;
+	ctx.buffered = 0;
+	ctx.stripes = 0;
+}
+
+void update(Ctx &ctx, const uint8_t *input, size_t len) {
+	if (!input || len == 0) {
+		return;
+	}
+
+	auto end = input + len;
+	ctx.length += len;
+
+	if (len <= sizeof(ctx.buffer) - ctx.buffered) {
+		__builtin_memcpy(ctx.buffer + ctx.buffered, input, len);
+		ctx.buffered += uint32_t(len);
+		return;
+	}
+
+	// Input is consumed only when more data follows, last stripe should stay in buffer for digest
+	if (ctx.buffered) {
+		auto loadSize = sizeof(ctx.buffer) - ctx.buffered;
+		__builtin_memcpy(ctx.buffer + ctx.buffered, input, loadSize);
+		input += loadSize;
+		consumeStripes(ctx.acc, ctx.stripes, ctx.buffer, BufferStripes, ctx.secret);
+		ctx.buffered = 0;
+	}
+
+	if (size_t(end - input) > sizeof(ctx.buffer)) {
+		auto nStripes = size_t(end - 1 - input) / StripeLen;
+		input = consumeStripes(ctx.acc, ctx.stripes, input, nStripes, ctx.secret);
+		__builtin_memcpy(ctx.buffer + sizeof(ctx.buffer) - StripeLen, input - StripeLen, StripeLen);
+	}
+
+	__builtin_memcpy(ctx.buffer, input, size_t(end - input));
+	ctx.buffered = uint32_t(end - input);
+}
+
+static void digestLong(uint64_t *acc, const Ctx &ctx) {
+	uint8_t lastStripe[StripeLen];
+	const uint8_t *lastStripePtr = nullptr;
+
+	__builtin_memcpy(acc, ctx.acc, sizeof(ctx.acc));
+	if (ctx.buffered >= StripeLen) {
+		auto nStripes = (ctx.buffered - 1) / StripeLen;
+		auto stripesSoFar = ctx.stripes;
+		consumeStripes(acc, stripesSoFar, ctx.buffer, nStripes, ctx.secret);
+		lastStripePtr = ctx.buffer + ctx.buffered - StripeLen;
+	} else {
+		// last stripe is composed from the tail of previous block and buffered data
+		auto catchupSize = StripeLen - ctx.buffered;
+		__builtin_memcpy(lastStripe, ctx.buffer + sizeof(ctx.buffer) - catchupSize, catchupSize);
+		__builtin_memcpy(lastStripe + catchupSize, ctx.buffer, ctx.buffered);
+		lastStripePtr = lastStripe;
+	}
+	accumulate512(acc, lastStripePtr, ctx.secret + SecretSize - StripeLen - SecretLastAccStart);
+}
+
+uint64_t digest64(const Ctx &ctx) {
+	if (ctx.length > MidSizeMax) {
+		alignas(64) uint64_t acc[AccCount];
+		digestLong(acc, ctx);
+		return mergeAccs(acc, ctx.secret + SecretMergeAccsStart, ctx.length * PRIME64_1);
+	}
+	return hash64(ctx.buffer, size_t(ctx.length), ctx.seed);
+}
+
+Hash128 digest128(const Ctx &ctx) {
+	if (ctx.length > MidSizeMax) {
+		alignas(64) uint64_t acc[AccCount];
+		digestLong(acc, ctx);
+		return mergeAccs128(acc, ctx.secret, size_t(ctx.length));
+	}
+	return hash128(ctx.buffer, size_t(ctx.length), ctx.seed);
+}
+
+} // namespace sprt::xxh3
@@ -24,6 +24,7 @@ THE SOFTWARE.
 #define CORE_RUNTIME_INCLUDE_C___SPRT_DIRENT_H_
 
 #include <sprt/c/bits/__sprt_ssize_t.h>
+#include <sprt/c/bits/__sprt_size_t.h>
 #include <sprt/c/cross/__sprt_fstypes.h>
 #include <sprt/c/cross/__sprt_dir_ptr.h>
 
@@ -73,6 +74,14 @@ SPRT_API int __SPRT_ID(scandirat)(int __dir_fd, const char *__path,
 		int (*__comparator)(const struct __SPRT_DIRENT_NAME **,
 				const struct __SPRT_DIRENT_NAME **));
 
+#if __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64 || __SPRT_CONFIG_DEFINE_UNAVAILABLE_FUNCTIONS
+// Reads raw entries (in __SPRT_DIRENT_NAME layout, d_reclen bytes each) into the buffer,
+// returns number of bytes read, 0 at the end of directory
+__SPRT_CONFIG_HAVE_DIRENT_GETDENTS64_NOTICE
+SPRT_API __SPRT_ID(ssize_t)
+		__SPRT_ID(getdents64)(int __dir_fd, void *__buf, __SPRT_ID(size_t) __nbytes);
+#endif
+
 __SPRT_END_DECL
 
 #endif // CORE_RUNTIME_INCLUDE_C___SPRT_DIRENT_H_
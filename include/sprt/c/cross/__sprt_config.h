@@ -299,6 +299,17 @@ THE SOFTWARE.
 #endif
 
 
+#ifndef __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64
+#define __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64 0
+#endif
+
+#if __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64 == 0 && __SPRT_CONFIG_DEFINE_UNAVAILABLE_FUNCTIONS
+#define __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64_NOTICE __SPRT_CONFIG_UNAVAILABLE_NOTICE(__SPRT_CONFIG_HAVE_DIRENT_GETDENTS64)
+#else
+#define __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64_NOTICE
+#endif
+
+
 #ifndef __SPRT_CONFIG_HAVE_FUTEX
 #define __SPRT_CONFIG_HAVE_FUTEX 0
 #endif
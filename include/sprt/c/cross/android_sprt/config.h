@@ -34,6 +34,10 @@
 #define __SPRT_CONFIG_HAVE_URING 1
 #endif
 
+#ifndef __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64
+#define __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64 1
+#endif
+
 #ifndef __SPRT_CONFIG_HAVE_FUTEX
 #define __SPRT_CONFIG_HAVE_FUTEX 1
 #endif
@@ -25,6 +25,7 @@
 
 #include <sprt/c/cross/__sprt_config.h>
 #include <sprt/c/bits/__sprt_uint32_t.h>
+#include <sprt/c/bits/__sprt_uint64_t.h>
 #include <sprt/c/bits/__sprt_time_t.h>
 
 /*
@@ -81,6 +82,16 @@
 #define __SPRT_FUTEX2_PRIVATE __SPRT_FUTEX_PRIVATE_FLAG
 #define __SPRT_FUTEX2_SIZE_MASK	0x03
 
+#define __SPRT_FUTEX_WAITV_MAX 128
+
+// Element for futex_waitv; waiters with __SPRT_FUTEX2_SIZE_U32 can be woken with FUTEX_WAKE
+struct __SPRT_ID(futex_waitv) {
+	__SPRT_ID(uint64_t) val;
+	__SPRT_ID(uint64_t) uaddr;
+	__SPRT_ID(uint32_t) flags;
+	__SPRT_ID(uint32_t) __reserved;
+};
+
 #if __SPRT_CONFIG_HAVE_FUTEX || __SPRT_CONFIG_DEFINE_UNAVAILABLE_FUNCTIONS
 
 // clang-format on
@@ -142,6 +153,13 @@ SPRT_API long __SPRT_ID(futex2_wait)(volatile __SPRT_ID(uint32_t) * uaddr, __SPR
 		__SPRT_ID(uint32_t) bitset, __SPRT_ID(uint32_t) flags, __SPRT_TIMESPEC_NAME *timespec,
 		__SPRT_ID(clockid_t) clockid);
 
+// FUTEX_WAITV(2): waits on up to __SPRT_FUTEX_WAITV_MAX futexes, timeout is absolute
+// Returns index of the woken futex
+__SPRT_CONFIG_HAVE_FUTEX_NOTICE
+SPRT_API long __SPRT_ID(futex2_waitv)(struct __SPRT_ID(futex_waitv) * waiters,
+		__SPRT_ID(uint32_t) nr_futexes, __SPRT_ID(uint32_t) flags, __SPRT_TIMESPEC_NAME *timespec,
+		__SPRT_ID(clockid_t) clockid);
+
 __SPRT_END_DECL
 
 #endif
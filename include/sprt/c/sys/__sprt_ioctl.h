@@ -28,6 +28,9 @@ THE SOFTWARE.
 #define __SPRT_TIOCGWINSZ	0x5413
 #define __SPRT_TIOCSWINSZ	0x5414
 
+// Linux: share extents with the source file (reflink) on CoW filesystems
+#define __SPRT_FICLONE	0x40049409
+
 __SPRT_BEGIN_DECL
 
 SPRT_API
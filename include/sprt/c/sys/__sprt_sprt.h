@@ -129,6 +129,16 @@ SPRT_API
 int __SPRT_ID(sprt_qlock_wait)(__SPRT_ID(sprt_qlock_t) * value, __SPRT_ID(sprt_qlock_t) expected,
 		__SPRT_ID(sprt_timeout_t), __SPRT_ID(sprt_lock_flags_t));
 
+// Waits until one of the values is woken; values should be equal to the expected ones,
+// otherwise it returns -1 with EAGAIN immediately (like sprt_qlock_wait).
+// Returns index of the woken value, or -1 with errno (ENOSYS if OS has no such API).
+// Implementation:
+// - Linux/Android - futex_waitv (5.16+), up to 128 values
+SPRT_API
+int __SPRT_ID(sprt_qlock_wait_any)(__SPRT_ID(sprt_qlock_t) * const *values,
+		const __SPRT_ID(sprt_qlock_t) * expected, __SPRT_ID(uint32_t) count,
+		__SPRT_ID(sprt_timeout_t), __SPRT_ID(sprt_lock_flags_t));
+
 SPRT_API
 int __SPRT_ID(sprt_qlock_wake_one)(__SPRT_ID(sprt_qlock_t) * value, __SPRT_ID(sprt_lock_flags_t));
 
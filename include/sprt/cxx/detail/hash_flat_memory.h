@@ -0,0 +1,726 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#ifndef RUNTIME_INCLUDE_SPRT_CXX_DETAIL_HASH_FLAT_MEMORY_H_
+#define RUNTIME_INCLUDE_SPRT_CXX_DETAIL_HASH_FLAT_MEMORY_H_
+
+#include <sprt/cxx/detail/hash_memory.h>
+#include <sprt/cxx/bit>
+
+/*
+	Open-addressing backend for __unordered_map/__unordered_set
+
+	Every slot has a 1-byte control value: 0x80 for an empty slot, or low 7 bits of the hash
+	for a used one. Control bytes are stored after the slot array and probed 16 at a time,
+	so most failed comparisons are rejected without touching the slots.
+
+	Capacity is a power of two, so the home position is a mask, not a division. Probing
+	is linear over slots (16-wide unaligned windows), which allows backward-shift
+	deletion: erase never leaves tombstones and the table never degrades after churn.
+	First Width-1 control bytes are mirrored after the end, so a window never wraps.
+
+	Iteration starts after the first empty slot and wraps around the end of the table: a
+	cluster never spans the start of the iteration, so backward shift in erase moves only
+	entries, that are not visited yet. Insertion invalidates iterators.
+*/
+
+namespace sprt::detail {
+
+struct hash_flat_group {
+	static constexpr size_t Width = 16;
+
+	static constexpr uint8_t Empty = 0x80;
+
+	using vector_type = uint8_t __attribute__((vector_size(16)));
+
+#if __SSE2__
+	// one bit per slot from pmovmskb
+	using mask_type = uint32_t;
+	static constexpr int MaskShift = 0;
+#else
+	// one nibble per slot; on NEON compiles into a single shrn
+	using mask_type = uint64_t;
+	static constexpr int MaskShift = 2;
+#endif
+
+	static mask_type to_mask(vector_type v) noexcept {
+#if __SSE2__
+		using signed_vector = char __attribute__((vector_size(16)));
+		return mask_type(__builtin_ia32_pmovmskb128(signed_vector(v)));
+#else
+		using wide_vector = uint16_t __attribute__((vector_size(16)));
+		using narrow_vector = uint8_t __attribute__((vector_size(8)));
+		auto narrow = __builtin_convertvector(wide_vector(v) >> 4, narrow_vector);
+		mask_type ret;
+		__builtin_memcpy(&ret, &narrow, sizeof(ret));
+		return ret & 0x8888'8888'8888'8888;
+#endif
+	}
+
+	static size_t index(mask_type mask) noexcept { return sprt::countr_zero(mask) >> MaskShift; }
+
+	explicit hash_flat_group(const uint8_t *ctrl) noexcept { __builtin_memcpy(&_ctrl, ctrl, Width); }
+
+	// slots with the tag value
+	mask_type match(uint8_t tag) const noexcept {
+		return to_mask(vector_type(_ctrl == (vector_type{} + tag)));
+	}
+
+	mask_type match_empty() const noexcept {
+#if __SSE2__
+		return to_mask(_ctrl);
+#else
+		return to_mask(vector_type(_ctrl >= (vector_type{} + Empty)));
+#endif
+	}
+
+	vector_type _ctrl;
+};
+
+template <typename SlotType, typename ValueType>
+class hash_flat_iterator {
+public:
+	using iterator_category = bidirectional_iterator_tag;
+
+	using size_type = size_t;
+	using iterator = hash_flat_iterator<SlotType, ValueType>;
+	using non_const_iterator =
+			hash_flat_iterator<remove_const_t<SlotType>, remove_const_t<ValueType>>;
+	using const_iterator = hash_flat_iterator<add_const_t<SlotType>, add_const_t<ValueType>>;
+	using difference_type = ptrdiff_t;
+	using value_type = ValueType;
+	using reference = value_type &;
+	using pointer = value_type *;
+
+	hash_flat_iterator() noexcept { }
+
+	hash_flat_iterator(const non_const_iterator &other) noexcept
+	: ctrl(other.control())
+	, begin(other.init_node())
+	, current(other.node())
+	, end(other.final_node())
+	, stop(other.stop_node()) { }
+
+	hash_flat_iterator(const const_iterator &other) noexcept
+	: ctrl(other.control())
+	, begin(const_cast<SlotType *>(other.init_node()))
+	, current(const_cast<SlotType *>(other.node()))
+	, end(const_cast<SlotType *>(other.final_node()))
+	, stop(const_cast<SlotType *>(other.stop_node())) { }
+
+	// `s` is an empty slot, where iteration starts and stops; computed lazily if not set
+	explicit hash_flat_iterator(const uint8_t *c, SlotType *b, SlotType *p, SlotType *e,
+			SlotType *s = nullptr) noexcept
+	: ctrl(c), begin(b), current(p), end(e), stop(s) { }
+
+	iterator &operator=(const iterator &other) noexcept {
+		ctrl = other.ctrl;
+		begin = other.begin;
+		current = other.current;
+		end = other.end;
+		stop = other.stop;
+		return *this;
+	}
+	constexpr bool operator==(const iterator &other) const { return current == other.current; }
+	constexpr bool operator!=(const iterator &other) const { return current != other.current; }
+	constexpr bool operator<(const iterator &other) const { return current < other.current; }
+	constexpr bool operator>(const iterator &other) const { return current > other.current; }
+	constexpr bool operator<=(const iterator &other) const { return current <= other.current; }
+	constexpr bool operator>=(const iterator &other) const { return current >= other.current; }
+
+	iterator &operator++() {
+		increment();
+		return *this;
+	}
+	iterator operator++(int) {
+		auto tmp = *this;
+		increment();
+		return tmp;
+	}
+	iterator &operator--() {
+		decrement();
+		return *this;
+	}
+	iterator operator--(int) {
+		auto tmp = *this;
+		decrement();
+		return tmp;
+	}
+
+	reference operator*() const { return current->value.ref(); }
+	pointer operator->() const { return current->value.ptr(); }
+
+	const uint8_t *control() const { return ctrl; }
+	SlotType *init_node() const { return begin; }
+	SlotType *node() const { return current; }
+	SlotType *final_node() const { return end; }
+	SlotType *stop_node() const { return stop; }
+
+protected:
+	bool is_empty(SlotType *slot) const { return ctrl[slot - begin] & hash_flat_group::Empty; }
+
+	// table always has at least one empty slot
+	SlotType *get_stop() {
+		if (!stop) {
+			stop = begin;
+			while (!is_empty(stop)) { ++stop; }
+		}
+		return stop;
+	}
+
+	void increment() {
+		if (current != end) {
+			auto s = get_stop();
+			do {
+				if (++current == end) {
+					current = begin;
+				}
+				if (current == s) {
+					current = end;
+					return;
+				}
+			} while (is_empty(current));
+		}
+	}
+
+	void decrement() {
+		if (begin != end) {
+			auto s = get_stop();
+			if (current == end) {
+				current = s;
+			}
+			do {
+				if (current == begin) {
+					current = end;
+				}
+				--current;
+			} while (current != s && is_empty(current));
+		}
+	}
+
+	const uint8_t *ctrl = nullptr;
+	SlotType *begin = nullptr;
+	SlotType *current = nullptr;
+	SlotType *end = nullptr;
+	SlotType *stop = nullptr;
+};
+
+template <typename Value>
+struct hash_flat_slot {
+	using value_type = Value;
+
+	aligned_storage<Value> value;
+	size_t hash;
+};
+
+template <typename Key, typename Value, typename HashFn, typename EqualFn, typename Allocator>
+class hash_flat_memory {
+public:
+	using size_type = size_t;
+	using hash_type = size_t;
+	using node_type = hash_flat_slot<Value>;
+	using group_type = hash_flat_group;
+
+	using allocator_type = Allocator;
+	using node_allocator_type = allocator_type::template rebind<node_type>::other;
+
+	using iterator = hash_flat_iterator<node_type, Value>;
+	using const_iterator = hash_flat_iterator<add_const_t<node_type>, add_const_t<Value>>;
+	using local_iterator = hash_local_iterator<node_type>;
+	using const_local_iterator = hash_local_iterator<const node_type>;
+
+	static constexpr float CoverageLoadFactor = 1.5f;
+	static constexpr float DefaultMaxLoadFactor = 0.875f;
+	static constexpr size_type MinCapacity = group_type::Width;
+
+	// User hashes for integers and pointers are identity-like, while both the home position
+	// and the tag are taken from the low bits, so spread them first
+	static constexpr hash_type mix(size_t value) noexcept {
+		uint64_t h = value;
+		h ^= h >> 33;
+		h *= 0xFF51'AFD7'ED55'8CCD;
+		h ^= h >> 33;
+		return hash_type(h);
+	}
+
+	static constexpr uint8_t tag(hash_type hashValue) noexcept { return hashValue & 0x7F; }
+
+	~hash_flat_memory() noexcept { clear_deallocate(); }
+
+	hash_flat_memory(size_type capacity, const HashFn &h, const EqualFn &eq,
+			const allocator_type &a) noexcept
+	: _hasher(h), _equal(eq), _allocator(a) {
+		if (capacity != 0) {
+			rehash(capacity);
+		}
+	}
+
+	void clear_free() noexcept {
+		if (_storage) {
+			if (_size > 0) {
+				for (size_type i = 0; i < _capacity; ++i) {
+					if (!(_ctrl[i] & group_type::Empty)) {
+						_storage[i].value.destroy(_allocator);
+					}
+				}
+			}
+			__builtin_memset(_ctrl, group_type::Empty, _capacity + group_type::Width - 1);
+			_size = 0;
+		}
+	}
+
+	void clear_deallocate() noexcept {
+		clear_free();
+		if (_storage) {
+			auto nodeAllocator = node_allocator_type(_allocator);
+			nodeAllocator.__deallocate(_storage, get_alloc_count(_capacity), _allocated);
+
+			_storage = nullptr;
+			_ctrl = nullptr;
+			_capacity = 0;
+			_allocated = 0;
+			_growthLimit = 0;
+		}
+	}
+
+	bool rehash(size_type newsize) noexcept {
+		if (newsize == 0) {
+			newsize = sprt::memory::config::BlockThreshold / (sizeof(node_type) + 1);
+		}
+
+		// keep at least one empty slot, probing relies on it
+		newsize = sprt::max(newsize, size_type(__builtin_ceilf(_size / _maxLoadFactor)) + 1);
+		newsize = sprt::max(MinCapacity, sprt::bit_ceil(newsize));
+
+		auto nodeAllocator = node_allocator_type(_allocator);
+
+		size_t allocated = get_alloc_count(newsize) * sizeof(node_type);
+		node_type *ptr = nodeAllocator.__allocate(get_alloc_count(newsize), allocated);
+		if (!ptr) {
+			return false;
+		}
+
+		auto ctrl = reinterpret_cast<uint8_t *>(ptr + newsize);
+		__builtin_memset(ctrl, group_type::Empty, newsize + group_type::Width - 1);
+
+		if (_storage) {
+			for (size_type i = 0; i < _capacity; ++i) {
+				if (_ctrl[i] & group_type::Empty) {
+					continue;
+				}
+
+				auto source = _storage + i;
+				auto pos = find_empty(ctrl, newsize, source->hash);
+				auto target = ptr + pos;
+
+				if constexpr (is_move_constructible_v<Value>) {
+					target->value.construct(_allocator, sprt::move_unsafe(source->value.ref()));
+				} else {
+					target->value.construct(_allocator, source->value.ref());
+				}
+				target->hash = source->hash;
+				set_ctrl(ctrl, newsize, pos, tag(source->hash));
+
+				source->value.destroy(_allocator);
+			}
+
+			nodeAllocator.__deallocate(_storage, get_alloc_count(_capacity), _allocated);
+		}
+
+		_storage = ptr;
+		_ctrl = ctrl;
+		_capacity = newsize;
+		_allocated = allocated;
+		update_growth_limit();
+
+		return true;
+	}
+
+	template <typename Arg, typename Iterator = iterator>
+	auto insert(Arg &&arg) noexcept -> pair<Iterator, bool> {
+		auto &key = aligned_storage_kv_traits<Key, Value>::extract_key(arg);
+		auto hashValue = mix(_hasher(key));
+
+		if (auto node = find_node(key, hashValue)) {
+			return pair<Iterator, bool>(
+					make_iterator<Iterator>(const_cast<node_type *>(node)), false);
+		}
+
+		auto node = prepare_insert(hashValue);
+		if (!node) {
+			return pair<Iterator, bool>(Iterator(nullptr, nullptr, nullptr, nullptr), false);
+		}
+
+		aligned_storage_kv_traits<Key, Value>::construct(_allocator, node->value,
+				sprt::forward<Arg>(arg));
+		return pair<Iterator, bool>(make_iterator<Iterator>(node), true);
+	}
+
+	template <typename K, typename... Args>
+	pair<iterator, bool> try_emplace(K &&key, Args &&...args) noexcept {
+		auto hashValue = mix(_hasher(key));
+
+		if (auto node = find_node(key, hashValue)) {
+			return pair<iterator, bool>(make_iterator(const_cast<node_type *>(node)), false);
+		}
+
+		auto node = prepare_insert(hashValue);
+		if (!node) {
+			return pair<iterator, bool>(iterator(nullptr, nullptr, nullptr, nullptr), false);
+		}
+
+		aligned_storage_kv_traits<Key, Value>::construct(_allocator, node->value,
+				sprt::forward<K>(key), sprt::forward<Args>(args)...);
+		return pair<iterator, bool>(make_iterator(node), true);
+	}
+
+	void copy_from(const hash_flat_memory &other) noexcept {
+		clear_free();
+		if (_capacity < other._capacity) {
+			rehash(other._capacity);
+		}
+		for (auto &it : other) { insert(it); }
+	}
+
+	void move_from(hash_flat_memory &&other) noexcept {
+		if (_allocator == other._allocator) {
+			clear_deallocate();
+			_storage = other._storage;
+			_ctrl = other._ctrl;
+			_size = other._size;
+			_capacity = other._capacity;
+			_allocated = other._allocated;
+			_growthLimit = other._growthLimit;
+			_maxLoadFactor = other._maxLoadFactor;
+
+			other._storage = nullptr;
+			other._ctrl = nullptr;
+			other._size = 0;
+			other._capacity = 0;
+			other._allocated = 0;
+			other._growthLimit = 0;
+			other._maxLoadFactor = DefaultMaxLoadFactor;
+		} else {
+			copy_from(other);
+		}
+	}
+
+	// Backward-shift deletion: following entries are moved into the hole while
+	// their home position allows it, so no tombstone is left behind.
+	// Returns true if the slot of the erased entry was refilled with a next entry
+	bool erase_node(node_type *node) noexcept {
+		auto mask = _capacity - 1;
+		auto origin = size_type(node - _storage);
+		auto hole = origin;
+		bool refilled = false;
+
+		node->value.destroy(_allocator);
+		--_size;
+
+		auto next = (hole + 1) & mask;
+		while (!(_ctrl[next] & group_type::Empty)) {
+			auto source = _storage + next;
+			auto home = source->hash >> 7 & mask;
+
+			// entry can be moved only if the hole lies between its home and its current position
+			if (((next - home) & mask) >= ((next - hole) & mask)) {
+				auto target = _storage + hole;
+				target->value.construct(_allocator, sprt::move_unsafe(source->value.ref()));
+				target->hash = source->hash;
+				set_ctrl(_ctrl, _capacity, hole, _ctrl[next]);
+				source->value.destroy(_allocator);
+
+				if (hole == origin) {
+					refilled = true;
+				}
+				hole = next;
+			}
+			next = (next + 1) & mask;
+		}
+
+		set_ctrl(_ctrl, _capacity, hole, group_type::Empty);
+		return refilled;
+	}
+
+	// Entries are moved only within the part of the iteration, that is not visited yet
+	// (see the iteration order above), so the refilled slot is the next one to visit
+	const_iterator erase(const_iterator iter) noexcept {
+		sprt_passert(iter.init_node() == _storage && iter.final_node() == _storage + _capacity,
+				"Invalid hash_flat_memory iterator: invalid value range");
+
+		if (erase_node(const_cast<node_type *>(iter.node()))) {
+			return iter;
+		}
+		return ++iter;
+	}
+
+	iterator erase(iterator iter) noexcept {
+		sprt_passert(iter.init_node() == _storage && iter.final_node() == _storage + _capacity,
+				"Invalid hash_flat_memory iterator: invalid value range");
+
+		if (erase_node(iter.node())) {
+			return iter;
+		}
+		return ++iter;
+	}
+
+	template <typename K>
+	const node_type *find_node(const K &k) const noexcept {
+		if (!_storage) {
+			return nullptr;
+		}
+		return find_node(k, mix(_hasher(k)));
+	}
+
+	template <typename K>
+	iterator find(K &&k) noexcept {
+		auto node = find_node(k);
+		if (!node) {
+			return end();
+		}
+		return make_iterator(const_cast<node_type *>(node));
+	}
+
+	template <typename K>
+	const_iterator find(K &&k) const noexcept {
+		auto node = find_node(k);
+		if (!node) {
+			return end();
+		}
+		return const_iterator(_ctrl, _storage, node, _storage + _capacity);
+	}
+
+	template <typename K>
+	size_type count(K &&k) const noexcept {
+		return find_node(k) ? 1 : 0;
+	}
+
+	template <typename K>
+	sprt::pair<const_iterator, const_iterator> equal_range(K &&k) const noexcept {
+		auto it = find(k);
+		if (it == end()) {
+			return sprt::make_pair(it, it);
+		}
+		auto next = it;
+		return sprt::make_pair(it, ++next);
+	}
+
+	template <typename K>
+	sprt::pair<iterator, iterator> equal_range(K &&k) noexcept {
+		auto it = find(k);
+		if (it == end()) {
+			return sprt::make_pair(it, it);
+		}
+		auto next = it;
+		return sprt::make_pair(it, ++next);
+	}
+
+	void swap(hash_flat_memory &other) noexcept {
+		if constexpr (sprt::allocator_traits<allocator_type>::propagate_on_container_swap::value) {
+			sprt::swap(_allocator, other._allocator);
+		} else if (other._allocator != _allocator) {
+			return;
+		}
+		sprt::swap(_hasher, other._hasher);
+		sprt::swap(_equal, other._equal);
+		sprt::swap(_storage, other._storage);
+		sprt::swap(_ctrl, other._ctrl);
+		sprt::swap(_size, other._size);
+		sprt::swap(_capacity, other._capacity);
+		sprt::swap(_allocated, other._allocated);
+		sprt::swap(_growthLimit, other._growthLimit);
+		sprt::swap(_maxLoadFactor, other._maxLoadFactor);
+	}
+
+	iterator begin() noexcept {
+		if (!_storage) {
+			return iterator(nullptr, nullptr, nullptr, nullptr);
+		}
+		auto stop = first_empty_node();
+		return ++iterator(_ctrl, _storage, stop, _storage + _capacity, stop);
+	}
+	const_iterator begin() const noexcept {
+		if (!_storage) {
+			return const_iterator(nullptr, nullptr, nullptr, nullptr);
+		}
+		auto stop = first_empty_node();
+		return ++const_iterator(_ctrl, _storage, stop, _storage + _capacity, stop);
+	}
+	iterator end() noexcept {
+		if (!_storage) {
+			return iterator(nullptr, nullptr, nullptr, nullptr);
+		}
+		return iterator(_ctrl, _storage, _storage + _capacity, _storage + _capacity);
+	}
+	const_iterator end() const noexcept {
+		if (!_storage) {
+			return const_iterator(nullptr, nullptr, nullptr, nullptr);
+		}
+		return const_iterator(_ctrl, _storage, _storage + _capacity, _storage + _capacity);
+	}
+
+	auto size() const noexcept { return _size; }
+	auto max_size() const noexcept { return Max<size_type> >> 1; }
+
+	auto get_allocator() const noexcept { return _allocator; }
+	void set_allocator(const Allocator &a) noexcept {
+		if (a != _allocator) {
+			clear_deallocate();
+			_allocator = a;
+		}
+	}
+	void set_allocator(Allocator &&a) noexcept {
+		if (a != _allocator) {
+			clear_deallocate();
+			_allocator = sprt::move_unsafe(a);
+		}
+	}
+
+	auto hash_function() const noexcept { return _hasher; }
+	auto key_eq() const noexcept { return _equal; }
+
+	float load_factor() const noexcept {
+		if (_capacity > 0) {
+			return float(_size) / float(_capacity);
+		}
+		return 0.0f;
+	}
+
+	float max_load_factor() const noexcept { return _maxLoadFactor; }
+	void max_load_factor(float ml) noexcept {
+		_maxLoadFactor = sprt::min(sprt::max(ml, 0.25f), 0.9375f);
+		update_growth_limit();
+	}
+
+protected:
+	// slots are followed by control bytes in the same allocation
+	static size_type get_alloc_count(size_type capacity) noexcept {
+		return capacity
+				+ (capacity + group_type::Width - 1 + sizeof(node_type) - 1) / sizeof(node_type);
+	}
+
+	static void set_ctrl(uint8_t *ctrl, size_type capacity, size_type pos, uint8_t value) noexcept {
+		ctrl[pos] = value;
+		if (pos < group_type::Width - 1) {
+			ctrl[capacity + pos] = value;
+		}
+	}
+
+	static size_type find_empty(const uint8_t *ctrl, size_type capacity,
+			hash_type hashValue) noexcept {
+		auto mask = capacity - 1;
+		auto pos = hashValue >> 7 & mask;
+		while (true) {
+			auto empty = group_type(ctrl + pos).match_empty();
+			if (empty) {
+				return (pos + group_type::index(empty)) & mask;
+			}
+			pos = (pos + group_type::Width) & mask;
+		}
+	}
+
+	template <typename K>
+	const node_type *find_node(const K &k, hash_type hashValue) const noexcept {
+		if (!_storage) {
+			return nullptr;
+		}
+
+		auto mask = _capacity - 1;
+		auto pos = hashValue >> 7 & mask;
+		auto t = tag(hashValue);
+		while (true) {
+			group_type group(_ctrl + pos);
+			auto match = group.match(t);
+			while (match) {
+				auto node = _storage + ((pos + group_type::index(match)) & mask);
+				if (node->hash == hashValue
+						&& _equal(k,
+								aligned_storage_kv_traits<Key, Value>::extract_key(node->value))) {
+					return node;
+				}
+				match &= match - 1;
+			}
+			if (group.match_empty()) {
+				return nullptr;
+			}
+			pos = (pos + group_type::Width) & mask;
+		}
+	}
+
+	// Reserve slot for a new value with hashValue, value should be constructed by caller
+	node_type *prepare_insert(hash_type hashValue) noexcept {
+		if (_size + 1 > _growthLimit) {
+			if (!rehash(_capacity * 2)) {
+				return nullptr;
+			}
+		}
+
+		auto pos = find_empty(_ctrl, _capacity, hashValue);
+		auto node = _storage + pos;
+		node->hash = hashValue;
+		set_ctrl(_ctrl, _capacity, pos, tag(hashValue));
+		++_size;
+		return node;
+	}
+
+	void update_growth_limit() noexcept {
+		_growthLimit = sprt::min(size_type(_capacity * _maxLoadFactor), _capacity - 1);
+	}
+
+	// Iteration starts and stops on this slot, table always has at least one empty slot
+	node_type *first_empty_node() const noexcept {
+		size_type pos = 0;
+		while (true) {
+			auto empty = group_type(_ctrl + pos).match_empty();
+			if (empty) {
+				return _storage + pos + group_type::index(empty);
+			}
+			pos += group_type::Width;
+		}
+	}
+
+	template <typename Iterator = iterator>
+	Iterator make_iterator(node_type *node) noexcept {
+		return Iterator(_ctrl, _storage, node, _storage + _capacity);
+	}
+
+	SPRT_NO_UNIQUE_ADDRESS
+	HashFn _hasher;
+
+	SPRT_NO_UNIQUE_ADDRESS
+	EqualFn _equal;
+
+	SPRT_NO_UNIQUE_ADDRESS
+	allocator_type _allocator;
+
+	node_type *_storage = nullptr;
+	uint8_t *_ctrl = nullptr;
+	size_type _size = 0;
+	size_type _capacity = 0;
+	size_type _allocated = 0;
+	size_type _growthLimit = 0;
+	float _maxLoadFactor = DefaultMaxLoadFactor;
+};
+
+} // namespace sprt::detail
+
+#endif // RUNTIME_INCLUDE_SPRT_CXX_DETAIL_HASH_FLAT_MEMORY_H_
@@ -608,6 +608,129 @@ inline void MatchTraits::_foreachCompose(const Func &f) {
 	_foreachCompose<CharType, Func, T1, Args...>(f);
 }
 
+/* Compile-time 256-bit class table for single-byte matchers
+ *
+ * Table can be built for any Chars|Range|CharGroup|Compose composition over `char`
+ * with CharTableValue<Matcher>, scan functions use it to classify input with SIMD
+ */
+struct alignas(16) CharTable {
+	static constexpr uint32_t MaxRanges = 8;
+
+	// Nibble tables for shuffle-based classification:
+	// bit H of low[L] is set if char (H << 4 | L) is matched (H < 8), high[L] - for H >= 8
+	uint8_t low[16] = {0};
+	uint8_t high[16] = {0};
+
+	// Runs of matched chars for compare-based classification (only if nranges <= MaxRanges)
+	uint8_t ranges[MaxRanges][2] = {{0}};
+	uint32_t nranges = 0;
+
+	uint64_t bits[4] = {0};
+
+	constexpr bool test(char c) const {
+		auto b = uint8_t(c);
+		return (bits[b >> 6] >> (b & 63)) & 1;
+	}
+
+	constexpr void set(uint8_t b) {
+		bits[b >> 6] |= uint64_t(1) << (b & 63);
+		if (b & 0x80) {
+			high[b & 0x0F] |= uint8_t(1 << ((b >> 4) - 8));
+		} else {
+			low[b & 0x0F] |= uint8_t(1 << (b >> 4));
+		}
+	}
+
+	constexpr void finalize() {
+		nranges = 0;
+		uint32_t i = 0;
+		while (i < 256) {
+			if (!test(char(uint8_t(i)))) {
+				++i;
+				continue;
+			}
+
+			auto first = i;
+			while (i < 256 && test(char(uint8_t(i)))) { ++i; }
+
+			if (nranges == MaxRanges) {
+				nranges = MaxRanges + 1;
+				return;
+			}
+
+			ranges[nranges][0] = uint8_t(first);
+			ranges[nranges][1] = uint8_t(i - 1);
+			++nranges;
+		}
+	}
+
+	// Length of the prefix, where every char is matched (value = true) or not matched (value = false)
+	size_t scan(const char *ptr, size_t len, bool value) const;
+};
+
+// Out-of-line SIMD kernel for CharTable::scan
+SPRT_API size_t scanCharTable(const CharTable &, const char *ptr, size_t len, bool value);
+
+template <char... Args>
+constexpr void addToCharTable(CharTable &t, const Chars<char, Args...> *) {
+	(t.set(uint8_t(Args)), ...);
+}
+
+template <char First, char Last>
+constexpr void addToCharTable(CharTable &t, const Range<char, First, Last> *) {
+	// follow the signed comparison of Range::match
+	for (uint32_t i = 0; i < 256; ++i) {
+		auto c = char(uint8_t(i));
+		if (First <= c && c <= Last) {
+			t.set(uint8_t(i));
+		}
+	}
+}
+
+constexpr void addToCharTable(CharTable &t, const UniChar *) {
+	for (uint32_t i = 128; i < 256; ++i) { t.set(uint8_t(i)); }
+}
+
+template <typename T>
+concept CharTableMatcher =
+		requires(CharTable &t) { addToCharTable(t, static_cast<const T *>(nullptr)); };
+
+// CharGroup<char, ...> specializations are matched with their Compose base
+template <typename... Args>
+requires(CharTableMatcher<Args> && ...)
+constexpr void addToCharTable(CharTable &t, const Compose<char, Args...> *) {
+	(addToCharTable(t, static_cast<const Args *>(nullptr)), ...);
+}
+
+template <typename T>
+constexpr CharTable makeCharTable() {
+	CharTable ret;
+	addToCharTable(ret, static_cast<const T *>(nullptr));
+	ret.finalize();
+	return ret;
+}
+
+template <typename T>
+inline constexpr CharTable CharTableValue = makeCharTable<T>();
+
+inline size_t CharTable::scan(const char *ptr, size_t len, bool value) const {
+	size_t offset = 0;
+
+	// most of tokens are short, check them inline
+	while (offset < len && offset < 16) {
+		if (test(ptr[offset]) != value) {
+			return offset;
+		}
+		++offset;
+	}
+
+	if (offset == len) {
+		return offset;
+	}
+
+	return offset + scanCharTable(*this, ptr + offset, len - offset, value);
+}
+
 template <typename CharType>
 inline bool isupper(CharType c) {
 	return CharGroup<CharType, GroupId::LatinUppercase>::match(c);
@@ -0,0 +1,259 @@
+/**
+Copyright (c) 2025 Xenolith Team <admin@stappler.org>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#ifndef RUNTIME_INCLUDE_SPRT_RUNTIME_DETAIL_ATOF_H_
+#define RUNTIME_INCLUDE_SPRT_RUNTIME_DETAIL_ATOF_H_
+
+#include <sprt/runtime/init.h>
+#include <sprt/cxx/detail/constexpr.h>
+#include <sprt/cxx/detail/ctypes.h>
+#include <sprt/cxx/bit>
+
+namespace sprt::_atof {
+
+// Decimal number in form `mantissa * 10^exponent`
+struct decimal {
+	uint64_t mantissa = 0;
+	int64_t exponent = 0;
+	bool negative = false;
+
+	// more then 19 significant digits, mantissa holds only the first 19 of them
+	bool truncated = false;
+};
+
+// Correctly rounded conversion (Clinger fast path, then Eisel-Lemire)
+// Returns false, if truncated mantissa is not enough to determine the result
+SPRT_API bool to_float(const decimal &, double &);
+SPRT_API bool to_float(const decimal &, float &);
+
+template <typename Char>
+constexpr inline bool is_digit(Char c) {
+	return c >= Char('0') && c <= Char('9');
+}
+
+// SWAR check for 8 ASCII digits, loaded as little-endian integer
+constexpr inline bool is_eight_digits(uint64_t val) {
+	return !(((val + 0x4646'4646'4646'4646) | (val - 0x3030'3030'3030'3030))
+			& 0x8080'8080'8080'8080);
+}
+
+// SWAR conversion of 8 ASCII digits, loaded as little-endian integer
+constexpr inline uint32_t parse_eight_digits(uint64_t val) {
+	constexpr uint64_t mask = 0x0000'00FF'0000'00FF;
+	constexpr uint64_t mul1 = 0x000F'4240'0000'0064; // 100 + (1000000ULL << 32)
+	constexpr uint64_t mul2 = 0x0000'2710'0000'0001; // 1 + (10000ULL << 32)
+	val -= 0x3030'3030'3030'3030;
+	val = (val * 10) + (val >> 8);
+	val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+	return uint32_t(val);
+}
+
+template <typename Char>
+inline bool read_eight_digits(const Char *ptr, uint32_t &out) {
+	if constexpr (sizeof(Char) == 1 && endian::native == endian::little) {
+		uint64_t val = 0;
+		__builtin_memcpy(&val, ptr, sizeof(uint64_t));
+		if (is_eight_digits(val)) {
+			out = parse_eight_digits(val);
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename Char>
+inline size_t parse_digits(const Char *ptr, size_t len, uint64_t &value) {
+	size_t i = 0;
+	uint32_t chunk = 0;
+	while (i + 8 <= len && read_eight_digits(ptr + i, chunk)) {
+		value = value * 100'000'000 + chunk;
+		i += 8;
+	}
+	while (i < len && is_digit(ptr[i])) {
+		value = value * 10 + uint64_t(ptr[i] - Char('0'));
+		++i;
+	}
+	return i;
+}
+
+// Parses number in strtod decimal format: [+-]digits[.digits][(e|E)[+-]digits]
+// Returns number of chars consumed, or 0 if string is not a plain decimal number
+// (special values and hexadecimal floats are not handled)
+template <typename Char>
+inline size_t parse_decimal(const Char *ptr, size_t len, decimal &out) {
+	size_t i = 0;
+	if (i < len && (ptr[i] == Char('-') || ptr[i] == Char('+'))) {
+		out.negative = (ptr[i] == Char('-'));
+		++i;
+	}
+
+	uint64_t mantissa = 0;
+
+	auto intBegin = i;
+	i += parse_digits(ptr + i, len - i, mantissa);
+	auto intEnd = i;
+
+	if (intEnd - intBegin == 1 && ptr[intBegin] == Char('0') && i < len
+			&& (ptr[i] == Char('x') || ptr[i] == Char('X'))) {
+		return 0;
+	}
+
+	auto fracBegin = i;
+	auto fracEnd = i;
+	if (i < len && ptr[i] == Char('.')) {
+		++i;
+		fracBegin = i;
+		i += parse_digits(ptr + i, len - i, mantissa);
+		fracEnd = i;
+	}
+
+	auto ndigits = (intEnd - intBegin) + (fracEnd - fracBegin);
+	if (ndigits == 0) {
+		return 0;
+	}
+
+	int64_t explicitExponent = 0;
+	if (i < len && (ptr[i] == Char('e') || ptr[i] == Char('E'))) {
+		auto j = i + 1;
+		bool negativeExponent = false;
+		if (j < len && (ptr[j] == Char('-') || ptr[j] == Char('+'))) {
+			negativeExponent = (ptr[j] == Char('-'));
+			++j;
+		}
+
+		// exponent without digits is not a part of the number
+		if (j < len && is_digit(ptr[j])) {
+			while (j < len && is_digit(ptr[j])) {
+				if (explicitExponent < 0x1000'0000) {
+					explicitExponent = explicitExponent * 10 + int64_t(ptr[j] - Char('0'));
+				}
+				++j;
+			}
+			if (negativeExponent) {
+				explicitExponent = -explicitExponent;
+			}
+			i = j;
+		}
+	}
+
+	out.mantissa = mantissa;
+	out.exponent = explicitExponent - int64_t(fracEnd - fracBegin);
+
+	if (ndigits > 19) {
+		// mantissa was overflowed, leading zeros do not count
+		auto p = intBegin;
+		while (p < fracEnd && (ptr[p] == Char('0') || ptr[p] == Char('.'))) {
+			if (ptr[p] == Char('0')) {
+				--ndigits;
+			}
+			++p;
+		}
+
+		if (ndigits > 19) {
+			constexpr uint64_t minNineteenDigits = 1'000'000'000'000'000'000;
+
+			mantissa = 0;
+			p = intBegin;
+			while (mantissa < minNineteenDigits && p < intEnd) {
+				mantissa = mantissa * 10 + uint64_t(ptr[p] - Char('0'));
+				++p;
+			}
+
+			if (mantissa >= minNineteenDigits) {
+				out.exponent = int64_t(intEnd - p) + explicitExponent;
+			} else {
+				p = fracBegin;
+				while (mantissa < minNineteenDigits && p < fracEnd) {
+					mantissa = mantissa * 10 + uint64_t(ptr[p] - Char('0'));
+					++p;
+				}
+				out.exponent = int64_t(fracBegin) - int64_t(p) + explicitExponent;
+			}
+
+			out.mantissa = mantissa;
+			out.truncated = true;
+		}
+	}
+
+	return i;
+}
+
+// Parses decimal integer [+-]digits, saturates on overflow like strtoll
+// Returns number of chars consumed or 0, if input should be processed with libc (other bases
+// or prefixed input with auto-detected base)
+template <typename Char>
+inline size_t parse_integer(const Char *ptr, size_t len, int base, int64_t &out) {
+	if (base != 0 && base != 10) {
+		return 0;
+	}
+
+	size_t i = 0;
+	bool negative = false;
+	if (i < len && (ptr[i] == Char('-') || ptr[i] == Char('+'))) {
+		negative = (ptr[i] == Char('-'));
+		++i;
+	}
+
+	auto begin = i;
+
+	// octal or hexadecimal with auto-detected base
+	if (base == 0 && i + 1 < len && ptr[i] == Char('0')
+			&& (is_digit(ptr[i + 1]) || ptr[i + 1] == Char('x') || ptr[i + 1] == Char('X'))) {
+		return 0;
+	}
+
+	uint64_t value = 0;
+	bool overflow = false;
+
+	// 16 digits can not overflow
+	uint32_t chunk = 0;
+	while (i + 8 <= len && i - begin < 16 && read_eight_digits(ptr + i, chunk)) {
+		value = value * 100'000'000 + chunk;
+		i += 8;
+	}
+
+	while (i < len && is_digit(ptr[i])) {
+		auto d = uint64_t(ptr[i] - Char('0'));
+		if (value > (Max<uint64_t> - d) / 10) {
+			overflow = true;
+		} else {
+			value = value * 10 + d;
+		}
+		++i;
+	}
+
+	if (i == begin) {
+		return 0;
+	}
+
+	auto limit = negative ? uint64_t(Max<int64_t>) + 1 : uint64_t(Max<int64_t>);
+	if (overflow || value > limit) {
+		out = negative ? Min<int64_t> : Max<int64_t>;
+	} else {
+		out = negative ? int64_t(0 - value) : int64_t(value);
+	}
+	return i;
+}
+
+} // namespace sprt::_atof
+
+#endif // RUNTIME_INCLUDE_SPRT_RUNTIME_DETAIL_ATOF_H_
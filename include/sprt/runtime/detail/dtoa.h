@@ -64,59 +64,36 @@ struct dtoa_options {
 	mode mode = fixed;
 };
 
+// Writes fixed string at the end of the buffer, like all other values
+template <typename Char, size_t N>
+constexpr inline size_t write_literal(Char *buffer, size_t bufferSize, const char (&str)[N]) {
+	for (size_t i = 0; i < N - 1; ++i) { buffer[bufferSize - N + 1 + i] = Char(str[i]); }
+	return N - 1;
+}
+
+// Writes `value` with exactly `width` digits, padded with leading zeros
+template <typename Char>
+constexpr inline size_t write_digits(Char *buffer, uint64_t value, size_t width,
+		size_t bufferSize) {
+	auto ret = _itoa::unsigned_to_decimal(buffer, value, bufferSize);
+	while (ret < width) { buffer[bufferSize - ret++ - 1] = '0'; }
+	return ret;
+}
+
 template <typename Char, floating_point T>
 constexpr inline size_t dtoa(Char *buffer, T value, size_t bufferSize,
 		dtoa_options opts = dtoa_options()) {
 	if (isnan(value)) {
-		if constexpr (sizeof(Char) == sizeof(char)) {
-			__constexpr_memcpy(buffer, "NaN", 3);
-			return 3;
-		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			__constexpr_memcpy(buffer, u"NaN", 3);
-			return 3;
-		} else {
-			return 0;
-		}
+		return write_literal(buffer, bufferSize, "NaN");
 	} else if (value == Infinity<T>) {
-		if constexpr (sizeof(Char) == sizeof(char)) {
-			__constexpr_memcpy(buffer, "inf", 3);
-			return 3;
-		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			__constexpr_memcpy(buffer, u"inf", 3);
-			return 3;
-		} else {
-			return 0;
-		}
+		return write_literal(buffer, bufferSize, "inf");
 	} else if (value == -Infinity<T>) {
-		if constexpr (sizeof(Char) == sizeof(char)) {
-			__constexpr_memcpy(buffer, "-inf", 4);
-			return 4;
-		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			__constexpr_memcpy(buffer, u"-inf", 4);
-			return 4;
-		} else {
-			return 0;
-		}
+		return write_literal(buffer, bufferSize, "-inf");
 	} else if (value == T(0.0)) {
-		if constexpr (sizeof(Char) == sizeof(char)) {
-			__constexpr_memcpy(buffer, "0.0", 3);
-			return 3;
-		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			__constexpr_memcpy(buffer, u"0.0", 3);
-			return 3;
-		} else {
-			return 0;
-		}
-	} else if (value == -T(0.0)) {
-		if constexpr (sizeof(Char) == sizeof(char)) {
-			__constexpr_memcpy(buffer, "-0.0", 3);
-			return 3;
-		} else if constexpr (sizeof(Char) == sizeof(char16_t)) {
-			__constexpr_memcpy(buffer, u"-0.0", 3);
-			return 3;
-		} else {
-			return 0;
+		if (__sprt_signbit(value)) {
+			return write_literal(buffer, bufferSize, "-0.0");
 		}
+		return write_literal(buffer, bufferSize, "0.0");
 	} else {
 		auto result = jkj::dragonbox::to_decimal(value, jkj::dragonbox::policy::sign::return_sign,
 				jkj::dragonbox::policy::cache::compact);
@@ -142,7 +119,7 @@ constexpr inline size_t dtoa(Char *buffer, T value, size_t bufferSize,
 			}
 			buffer[bufferSize - ret++ - 1] = 'e';
 
-			ret += _itoa::unsigned_to_decimal(buffer, result.significand % pow10, bufferSize - ret);
+			ret += write_digits(buffer, result.significand % pow10, intLen - 1, bufferSize - ret);
 			buffer[bufferSize - ret++ - 1] = '.';
 			ret += _itoa::unsigned_to_decimal(buffer, result.significand / pow10, bufferSize - ret);
 		};
@@ -178,7 +155,7 @@ constexpr inline size_t dtoa(Char *buffer, T value, size_t bufferSize,
 			auto top = result.significand / pow10;
 			auto bottom = result.significand % pow10;
 
-			ret += _itoa::unsigned_to_decimal(buffer, bottom, bufferSize - ret);
+			ret += write_digits(buffer, bottom, -result.exponent, bufferSize - ret);
 			buffer[bufferSize - ret++ - 1] = '.';
 			ret += _itoa::unsigned_to_decimal(buffer, top, bufferSize - ret);
 		}
@@ -199,9 +176,7 @@ constexpr size_t dtoa_len(T value, dtoa_options opts = dtoa_options()) {
 	} else if (value == -Infinity<T>) {
 		return 4;
 	} else if (value == T(0.0)) {
-		return 3;
-	} else if (value == -T(0.0)) {
-		return 4;
+		return __sprt_signbit(value) ? 4 : 3;
 	}
 
 	auto result = jkj::dragonbox::to_decimal(value, jkj::dragonbox::policy::sign::return_sign,
@@ -229,7 +204,8 @@ constexpr size_t dtoa_len(T value, dtoa_options opts = dtoa_options()) {
 			ret += 2;
 		}
 
-		ret += _itoa::unsigned_to_decimal_len(result.significand % pow10);
+		// fraction is written with exactly intLen - 1 digits, or as single zero
+		ret += (intLen > 1) ? size_t(intLen - 1) : 1;
 		ret += _itoa::unsigned_to_decimal_len(result.significand / pow10);
 	};
 
@@ -254,9 +230,9 @@ constexpr size_t dtoa_len(T value, dtoa_options opts = dtoa_options()) {
 		auto pow10 = POWERS_OF_10[-result.exponent];
 
 		auto top = result.significand / pow10;
-		auto bottom = result.significand % pow10;
 
-		ret += _itoa::unsigned_to_decimal_len(bottom);
+		// bottom part is padded with zeros
+		ret += size_t(-result.exponent);
 		ret++;
 		ret += _itoa::unsigned_to_decimal_len(top);
 	}
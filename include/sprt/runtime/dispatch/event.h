@@ -26,6 +26,7 @@
 #include <sprt/runtime/filesystem/lookup.h>
 #include <sprt/runtime/utils/native_handle.h>
 #include <sprt/runtime/dispatch/types.h>
+#include <sprt/c/bits/iovec.h>
 
 namespace sprt::dispatch {
 
@@ -36,11 +37,20 @@ class Handle;
 class TimerHandle;
 class ThreadHandle;
 class PollHandle;
+class ReadHandle;
+class WriteHandle;
+class AcceptHandle;
+class RecvHandle;
 
 struct BufferChain;
 
 using NativeHandle = sprt::native_handle;
 
+using IoVec = __SPRT_IOVEC_NAME;
+
+// Use this offset to read or write from the current file position
+static constexpr uint64_t FileOffsetCurrent = Max<uint64_t>;
+
 using filesystem::OpenFlags;
 using filesystem::PollFlags;
 
@@ -102,6 +112,20 @@ struct SPRT_API TimerInfo {
 	bool resetable = false;
 };
 
+struct SPRT_API RecvInfo {
+	static constexpr uint32_t DefaultBufferCount = 8;
+	static constexpr uint32_t DefaultBufferSize = 16 * 1'024;
+
+	using Completion = CompletionHandle<RecvHandle>;
+
+	Completion completion;
+
+	// Receiving buffers are owned by the handle, kernel selects buffer for each chunk
+	// (provided buffers on io_uring). Data should be consumed within completion call
+	uint32_t bufferCount = DefaultBufferCount;
+	uint32_t bufferSize = DefaultBufferSize;
+};
+
 } // namespace sprt::dispatch
 
 #endif /* RUNTIME_INCLUDE_SPRT_RUNTIME_DISPATCH_EVENT_H_ */
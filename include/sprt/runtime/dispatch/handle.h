@@ -37,6 +37,9 @@ class SPRT_API alignas(32) Handle : public Ref {
 public:
 	static constexpr size_t DataSize = 40;
 
+	// Handles are retained per queue operation, use inlined retain/release in debug mode
+	static constexpr bool RefInlineRetain = true;
+
 	static inline bool isValidCancelStatus(Status st) {
 		return st == Status::Done || (st != Status::Declined && !isSuccessful(st));
 	}
@@ -119,6 +122,50 @@ public:
 	virtual bool reset(PollFlags) = 0;
 };
 
+// One-shot positional read from file descriptor
+// Completes with Status::Done and number of bytes read, or with an error status
+class SPRT_API ReadHandle : public Handle {
+public:
+	virtual ~ReadHandle() = default;
+
+	virtual NativeHandle getNativeHandle() const = 0;
+};
+
+// One-shot positional write or sync for file descriptor
+// Completes with Status::Done and number of bytes written (0 for sync), or with an error status
+class SPRT_API WriteHandle : public Handle {
+public:
+	virtual ~WriteHandle() = default;
+
+	virtual NativeHandle getNativeHandle() const = 0;
+};
+
+// Listening socket handle, runs until cancelled or failed
+// Value in completion is descriptor of the accepted connection (with Status::Ok),
+// receiver takes ownership of it. Accepted sockets are non-blocking and close-on-exec
+// When process is out of descriptors or memory, accepting is paused for a short time
+class SPRT_API AcceptHandle : public Handle {
+public:
+	virtual ~AcceptHandle() = default;
+
+	virtual NativeHandle getNativeHandle() const = 0;
+};
+
+// Stream socket receiving handle, runs until cancelled, failed or EOF (Status::Done)
+// Value in completion is number of bytes received
+class SPRT_API RecvHandle : public Handle {
+public:
+	virtual ~RecvHandle() = default;
+
+	virtual NativeHandle getNativeHandle() const = 0;
+
+	// Received data, only valid within completion call
+	BytesView getData() const { return _received; }
+
+protected:
+	BytesView _received;
+};
+
 class SPRT_API TimerHandle : public Handle {
 public:
 	static constexpr uint32_t Infinite = TimerInfo::Infinite;
@@ -154,18 +201,62 @@ public:
 	}
 
 protected:
-	uint32_t performAll(const Callback<void(uint32_t)> &unlockCallback);
-
 	struct CallbackInfo {
 		dispatch::Function<void()> fn;
 		Rc<Ref> ref;
 		StringView tag;
 	};
 
+	// Node of the incoming queue, taken by producer from the free list (or allocated, if
+	// the list is empty or busy), returned into the free list by consumer after the drain
+	struct PerformNode {
+		PerformNode *next = nullptr;
+		Rc<Task> task;
+		CallbackInfo callback;
+	};
+
+	// Drained nodes are kept for reuse up to this count, the rest are released
+	static constexpr uint32_t MaxFreeNodes = 1'024;
+
+	// Adds task into lock-free incoming queue from any thread
+	// Returns true, if consumer should be woken up: wakeups are coalesced until the next drain,
+	// so platform wakeup (eventfd write, kevent, etc.) is issued only once per drain
+	bool enqueue(Rc<Task> &&);
+	bool enqueue(dispatch::Function<void()> &&, Ref *target, StringView tag);
+	bool enqueue(PerformNode *);
+
+	PerformNode *acquireNode();
+
+	// Returns drained chain (from `front` to `back`, linked with `next`) into the free list
+	void releaseNodes(PerformNode *front, PerformNode *back, uint32_t count);
+
+	// Drains incoming queue on the consumer thread
+	// Callback is called when the queue was taken with the number of the taken entries
+	uint32_t performAll(const Callback<void(uint32_t)> &takenCallback);
+
+	uint32_t performAll();
+
+	// Runs engine tasks with the reusable temporary pool
+	uint32_t runTasks();
+
 	Rc<PoolRef> _pool;
 	PerformEngine *_engine = nullptr;
-	dispatch::Vector<Rc<Task>> _outputQueue;
-	dispatch::Vector<CallbackInfo> _outputCallbacks;
+
+	// Intrusive MPSC stack: producers push with CAS, consumer takes the whole list
+	sprt::atomic<PerformNode *> _incoming = nullptr;
+
+	// Set by the producer that issued the wakeup, cleared by consumer before the drain
+	sprt::atomic<bool> _signaled = false;
+
+	// Empty nodes for reuse: consumer pushes the whole chain with CAS, producers pop
+	// one by one under `_freeLocked`, so popped node can not return into the list
+	// between the load and the CAS (no ABA on `next`)
+	sprt::atomic<PerformNode *> _freeNodes = nullptr;
+	sprt::atomic<uint32_t> _freeCount = 0;
+	sprt::atomic<bool> _freeLocked = false;
+
+	memory::pool_t *_drainPool = nullptr;
+	uint32_t _drainDepth = 0;
 
 	dispatch::Vector<Rc<Task>> _unsafeQueue;
 	dispatch::Vector<CallbackInfo> _unsafeCallbacks;
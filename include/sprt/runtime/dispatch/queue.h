@@ -41,6 +41,10 @@ enum class QueueFlags : uint32_t {
 	// submit all operations as they added, no need to call `submitPending`
 	SubmitImmediate = 1 << 1,
 
+	// use engine-native timer for every TimerHandle; by default, relative millisecond timers
+	// share a single kernel timer through the queue's timer wheel (io_uring and epoll)
+	NativeTimers = 1 << 2,
+
 	// Engine flags
 	// use thread-native backend (used by Looper, do not use this on Queue directly)
 	ThreadNative = 1 << 15,
@@ -73,6 +77,8 @@ SPRT_DEFINE_ENUM_AS_MASK(WakeupFlags)
 
 struct SPRT_API QueueInfo {
 	static constexpr uint32_t DefaultQueueSize = 32;
+	static constexpr uint16_t DefaultFileIoThreads = 2;
+	static constexpr uint32_t DefaultFixedBufferSize = 64 * 1'024;
 
 	QueueFlags flags = QueueFlags::None;
 	QueueEngine engineMask = QueueEngine::Any;
@@ -84,6 +90,15 @@ struct SPRT_API QueueInfo {
 
 	uint32_t externalHandles = 0; // limit for externally opened handles (if applicable)
 	uint32_t internalHandles = 0; // limit for internally opened handles (if applicable)
+
+	// threads for blocking file operations on engines without native async file IO
+	// (0 for default), threads are spawned on first operation
+	uint16_t fileIoThreads = 0;
+
+	// fixed buffers arena, allocated from queue's memory pool and registered within engine
+	// (if applicable), see Queue::acquireFixedBuffer
+	uint32_t fixedBufferCount = 0;
+	uint32_t fixedBufferSize = DefaultFixedBufferSize;
 };
 
 // If Graceful flag is set - wait until all operations are completed, and forbid a new ones from running
@@ -125,6 +140,74 @@ public:
 	Rc<PollHandle> listenPollableHandle(NativeHandle, PollFlags,
 			dispatch::Function<Status(NativeHandle, PollFlags)> &&, Ref * = nullptr);
 
+	// Async file operations, value in completion is number of bytes transferred
+	// Offset can be FileOffsetCurrent to use (and advance) current file position
+	// Buffer (and IoVec array) should be available until completion
+	// Operations can not be paused or cancelled, they are completed with Status::Done or an error
+	// Uses Handle userdata slot for the Ref
+	Rc<ReadHandle> read(NativeHandle, uint8_t *, size_t, uint64_t offset,
+			CompletionHandle<ReadHandle> &&, Ref * = nullptr);
+	Rc<ReadHandle> readv(NativeHandle, const IoVec *, uint32_t, uint64_t offset,
+			CompletionHandle<ReadHandle> &&, Ref * = nullptr);
+
+	Rc<WriteHandle> write(NativeHandle, const uint8_t *, size_t, uint64_t offset,
+			CompletionHandle<WriteHandle> &&, Ref * = nullptr);
+	Rc<WriteHandle> writev(NativeHandle, const IoVec *, uint32_t, uint64_t offset,
+			CompletionHandle<WriteHandle> &&, Ref * = nullptr);
+
+	// fsync or fdatasync (with `dataOnly`) for a file descriptor
+	Rc<WriteHandle> sync(NativeHandle, bool dataOnly, CompletionHandle<WriteHandle> &&,
+			Ref * = nullptr);
+
+	// Uses Handle userdata slot for a private data
+	Rc<ReadHandle> read(NativeHandle, uint8_t *, size_t, uint64_t offset,
+			dispatch::Function<void(Status, size_t)> &&, Ref * = nullptr);
+	Rc<WriteHandle> write(NativeHandle, const uint8_t *, size_t, uint64_t offset,
+			dispatch::Function<void(Status, size_t)> &&, Ref * = nullptr);
+
+	// Accept connections on listening socket, see AcceptHandle
+	// Uses Handle userdata slot for the Ref
+	Rc<AcceptHandle> acceptSocket(NativeHandle, CompletionHandle<AcceptHandle> &&,
+			Ref * = nullptr);
+
+	// Receive data from connected stream socket, see RecvHandle
+	// Uses Handle userdata slot for the Ref
+	Rc<RecvHandle> recvSocket(NativeHandle, RecvInfo &&, Ref * = nullptr);
+
+	// One-shot send, value in completion is number of bytes sent (can be less then requested)
+	// Buffer (and IoVec array) should be available until completion, large buffers can be sent
+	// with zero-copy, if supported by engine
+	// Sends for the same socket should be serialized (next send performed from completion)
+	// Uses Handle userdata slot for the Ref
+	Rc<WriteHandle> sendSocket(NativeHandle, const uint8_t *, size_t,
+			CompletionHandle<WriteHandle> &&, Ref * = nullptr);
+	Rc<WriteHandle> sendSocket(NativeHandle, const IoVec *, uint32_t,
+			CompletionHandle<WriteHandle> &&, Ref * = nullptr);
+
+	// Register descriptor in engine's file table (io_uring registered files)
+	// Operations with registered descriptor skip per-operation file lookup in kernel
+	// Table slots are limited with QueueInfo::externalHandles
+	// Unregister descriptor before closing it
+	// Returns ErrorNotSupported if engine has no file table,
+	// ErrorOutOfDeviceMemory when table is full
+	Status registerFile(NativeHandle);
+	Status unregisterFile(NativeHandle);
+
+	// Acquire buffer from the fixed buffers arena (QueueInfo::fixedBufferCount)
+	// File reads and writes within acquired buffer use registered buffers (READ_FIXED/WRITE_FIXED)
+	// on engines with support for them, buffer is usable as a regular memory otherwise
+	// Returns nullptr when arena is exhausted
+	// Arena is not synchronized: acquire and release only on the thread, that runs the queue
+	// (or from its completions)
+	uint8_t *acquireFixedBuffer();
+
+	// Returns buffer, acquired with acquireFixedBuffer, back to the arena
+	// Returns ErrorInvalidArguemnt for a pointer, that is not a start of an arena buffer,
+	// ErrorAlreadyPerformed if buffer is not acquired (double release)
+	Status releaseFixedBuffer(uint8_t *);
+
+	size_t getFixedBufferSize() const;
+
 	Rc<ThreadHandle> addThreadHandle();
 
 	// run custom handle
@@ -64,6 +64,9 @@ class SPRT_API Task : public Ref {
 public:
 	static const uint32_t INVALID_TAG = sprt::Max<uint32_t>;
 
+	// Tasks are retained per queue transition, use inlined retain/release in debug mode
+	static constexpr bool RefInlineRetain = true;
+
 	/* Function to be executed in init phase */
 	using PrepareCallback = Function<bool(const Task &)>;
 
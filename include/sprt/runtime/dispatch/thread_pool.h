@@ -47,6 +47,13 @@ public:
 enum class ThreadPoolFlags : uint32_t {
 	None,
 	LazyInit = 1 << 0, // do not spawn threads unless some task is performed
+
+	// Use per-worker task deques with stealing instead of single shared queue
+	// Tasks, performed from pool's worker with default priority, are pushed into worker's local
+	// deque and executed in LIFO order; idle workers steal from other workers in FIFO order.
+	// Tasks with non-default priority and tasks from other threads use shared priority queue,
+	// tasks with priority above default are always executed before local tasks
+	WorkStealing = 1 << 1,
 };
 
 SPRT_DEFINE_ENUM_AS_MASK(ThreadPoolFlags);
@@ -92,6 +99,8 @@ protected:
 		sprt::atomic<bool> finalized;
 		sprt::atomic<size_t> tasksInExecution = 0;
 		sprt::atomic<size_t> tasksInQueue = 0;
+		sprt::atomic<size_t> tasksPrioritized = 0; // tasks with priority above default in inputQueue
+		sprt::atomic<uint32_t> workersParked = 0;
 
 		Vector<Worker *> workers;
 
@@ -106,6 +115,7 @@ protected:
 		bool init(ThreadPoolInfo &&i, ThreadPool *p);
 
 		void wait(sprt::unique_lock<sprt::qmutex> &lock);
+		void notifyAll();
 		void finalize();
 		void spawn();
 		void cancel();
@@ -114,6 +124,14 @@ protected:
 		void onMainThreadWorker(Rc<Task> &&task);
 
 		Rc<Task> popTask();
+
+		// WorkStealing mode
+		Rc<Task> popTask(Worker *);
+		Rc<Task> stealTask(Worker *);
+
+		// Returns the task, that was found after the worker was announced as parked
+		Rc<Task> park(Worker *);
+		void unpark(bool all = false);
 	};
 
 	WorkerContext _context;
@@ -61,6 +61,12 @@ using HashSet = __malloc_unordered_set<Type>;
 template <typename Key, typename Value>
 using HashMap = __malloc_unordered_map<Key, Value>;
 
+template <typename Type>
+using FlatHashSet = __malloc_flat_unordered_set<Type>;
+
+template <typename Key, typename Value>
+using FlatHashMap = __malloc_flat_unordered_map<Key, Value>;
+
 template <typename Type>
 using Function = __malloc_function<Type>;
 
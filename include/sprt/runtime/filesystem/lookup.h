@@ -26,10 +26,17 @@
 #include <sprt/runtime/stringview.h>
 #include <sprt/runtime/thread/qmutex.h>
 #include <sprt/runtime/io_traits.h>
+#include <sprt/runtime/dispatch/types.h>
 #include <sprt/cxx/forward_list>
 #include <sprt/cxx/list>
 #include <sprt/c/sys/__sprt_stat.h>
 
+namespace sprt::dispatch {
+
+class ThreadPool;
+
+} // namespace sprt::dispatch
+
 namespace sprt::filesystem {
 
 /**
@@ -277,6 +284,11 @@ struct LocationInterface {
 	Status (*_ftw)(const LocationInfo &, StringView path,
 			const callback<bool(StringView, FileType)> &, int depth, bool dirFirst) = nullptr;
 
+	// Lists a single directory level with entry names (without "." and ".."); optional,
+	// used by performFtw to read subdirectories in parallel
+	Status (*_readdir)(const LocationInfo &, StringView path,
+			const callback<bool(StringView, FileType)> &) = nullptr;
+
 	Status (*_write_oneshot)(const LocationInfo &, StringView path, const uint8_t *buf,
 			size_t nbytes, __sprt_mode_t mode, bool override) = nullptr;
 
@@ -328,6 +340,23 @@ SPRT_API void enumeratePaths(const LookupInfo &res, StringView ifilename, Lookup
 SPRT_API void enumeratePaths(LocationCategory t, LookupFlags flags,
 		const callback<bool(const LocationInfo &, StringView)> &cb);
 
+constexpr static size_t FtwBatchSize = 1'024;
+
+// Walks directory tree on pool's workers: every directory is listed by a separate task with
+// LocationInterface::_readdir, so subdirectories are read in parallel. Locations without
+// _readdir are walked with _ftw on a single worker.
+// Entries are delivered to `cb` with the pool's complete interface in batches of up to
+// `batchSize` entries; paths are relative to `path`, the root itself is reported first as an
+// empty path. Order of entries is not defined, but a directory is always reported before its
+// content. `cb` can return false to stop the walk. `depth` is the same as for _ftw.
+// `complete` is called after the last entry with Status::Ok, Status::Suspended when stopped,
+// ErrorCancelled if pool was cancelled, or error of the root directory listing.
+// Subdirectories, that can not be listed, are reported, but skipped.
+SPRT_API Status performFtw(dispatch::ThreadPool &, const LocationInfo &, StringView path,
+		dispatch::Function<bool(StringView, FileType)> &&cb,
+		dispatch::Function<void(Status)> &&complete, int depth = -1,
+		size_t batchSize = FtwBatchSize, Ref * = nullptr);
+
 } // namespace sprt::filesystem
 
 namespace sprt {
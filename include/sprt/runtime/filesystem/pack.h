@@ -0,0 +1,170 @@
+/**
+ Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef RUNTIME_INCLUDE_SPRT_RUNTIME_FILESYSTEM_PACK_H_
+#define RUNTIME_INCLUDE_SPRT_RUNTIME_FILESYSTEM_PACK_H_
+
+#include <sprt/runtime/filesystem/lookup.h>
+
+namespace sprt::filesystem {
+
+/**
+	Read-only asset pack: a single file with many small resources, that is mapped into memory once.
+
+	Layout (little-endian):
+		Header
+		Entry[count] - sorted by path bytes, so directories are contiguous ranges
+		Slot[tableSize] - open-addressing hash index over entries (hash64 of path)
+		path strings
+		entry data - raw entries, larger then a page, are page-aligned
+
+	Raw entries are served directly from the mapping without copying; compressed entries are
+	stored as LZ4 blocks and decompressed on open.
+
+	Packs are mounted into lookup categories with `mountAssetPack`, then files inside it are
+	available with `enumeratePaths` as `<pack path>/<entry path>`.
+*/
+enum class AssetPackEntryFlags : uint16_t {
+	None = 0,
+	Compressed = 1 << 0, // entry data is a LZ4 block
+};
+
+SPRT_DEFINE_ENUM_AS_MASK(AssetPackEntryFlags)
+
+class SPRT_API AssetPack {
+public:
+	static constexpr uint64_t Magic = 0x4B43'4150'5452'5053; // "SPRTPACK"
+	static constexpr uint32_t Version = 1;
+	static constexpr uint32_t PageSize = 4'096;
+	static constexpr uint32_t DataAlignment = 16;
+
+	struct Header {
+		uint64_t magic;
+		uint32_t version;
+		uint32_t count;
+		uint32_t tableSize; // power of two, at least twice the count
+		uint32_t pageSize;
+		uint64_t entriesOffset;
+		uint64_t tableOffset;
+		uint64_t stringsOffset;
+		uint64_t stringsSize;
+		uint64_t dataOffset;
+	};
+
+	struct Entry {
+		uint64_t offset;
+		uint64_t size; // decompressed size
+		uint64_t storedSize;
+		uint32_t path; // offset in strings
+		uint16_t pathSize;
+		AssetPackEntryFlags flags;
+	};
+
+	struct Slot {
+		uint32_t hash; // high bits of path hash64, low bits select the slot
+		uint32_t index; // entry index + 1, 0 for empty slot
+	};
+
+	static_assert(sizeof(Header) == 64 && sizeof(Entry) == 32 && sizeof(Slot) == 8);
+
+	struct SourceFile {
+		StringView path; // relative, with '/' separators
+		BytesView data;
+		bool compress = true; // stored raw if LZ4 does not save enough space
+	};
+
+	// Writes pack with the files into the output stream; paths should be unique
+	static Status write(const SourceFile *, size_t count,
+			const callback<void(const uint8_t *, size_t)> &);
+
+	~AssetPack();
+
+	AssetPack() = default;
+
+	AssetPack(const AssetPack &) = delete;
+	AssetPack &operator=(const AssetPack &) = delete;
+
+	// Maps pack file from the location
+	Status init(const LocationInfo &, StringView path);
+
+	// Uses pack data from memory (like embedded into executable), data should outlive the pack
+	Status init(BytesView);
+
+	const Entry *find(StringView path) const;
+
+	// Directories are not stored, path is a directory if some entries are within it
+	bool isDirectory(StringView path) const;
+
+	StringView getPath(const Entry *) const;
+
+	// Data from the mapping for raw entries, empty view for compressed entries
+	BytesView getData(const Entry *) const;
+
+	// Reads whole entry content, buffer should have at least `entry->size` bytes
+	Status read(const Entry *, uint8_t *buf, size_t size) const;
+
+	// Walks directory like LocationInterface::_ftw; paths are relative to the directory
+	Status ftw(StringView path, const callback<bool(StringView, FileType)> &, int depth,
+			bool dirFirst) const;
+
+	size_t size() const { return _header ? _header->count : 0; }
+
+	const Entry *begin() const { return _entries; }
+	const Entry *end() const { return _entries + size(); }
+
+	// stat of the pack file, used as a base for entries stat
+	const struct __SPRT_STAT_NAME &getStat() const { return _stat; }
+
+protected:
+	Status initData(const uint8_t *, size_t);
+
+	// First entry within directory, or end()
+	const Entry *lowerBound(StringView dir) const;
+
+	Status walk(size_t rootLen, StringView dir, const callback<bool(StringView, FileType)> &,
+			int depth, bool dirFirst, const Entry *&it) const;
+
+	const LocationInterface *_interface = nullptr;
+	uint8_t _storage[16] = {0};
+	uint8_t *_mapping = nullptr;
+	size_t _size = 0;
+
+	const Header *_header = nullptr;
+	const Entry *_entries = nullptr;
+	const Slot *_table = nullptr;
+	const char *_strings = nullptr;
+
+	struct __SPRT_STAT_NAME _stat;
+};
+
+// Returns pack for the location, that was added with `mountAssetPack`, or nullptr
+SPRT_API const AssetPack *getAssetPack(const LocationInfo &);
+
+// Maps the pack and adds it as a location for the category, packs are searched before
+// other locations of the category. Should be called on initialization, before lookups
+// from other threads.
+SPRT_API Status mountAssetPack(LocationCategory, const LocationInfo &, StringView path,
+		LookupFlags = LookupFlags::Private);
+
+} // namespace sprt::filesystem
+
+#endif // RUNTIME_INCLUDE_SPRT_RUNTIME_FILESYSTEM_PACK_H_
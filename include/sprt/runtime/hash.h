@@ -26,6 +26,13 @@ THE SOFTWARE.
 #include <sprt/runtime/init.h>
 #include <sprt/c/bits/__sprt_def.h>
 
+// With SPRT_HASH_XXH3=1 hashSize uses XXH3: runtime evaluation uses vectorized xxh3::hash64,
+// constant evaluation uses scalar xxh3::chash64 with the same result.
+// Value should be the same for the whole build, it affects hashed containers layout.
+#ifndef SPRT_HASH_XXH3
+#define SPRT_HASH_XXH3 0
+#endif
+
 namespace sprt::sha1 {
 
 struct Ctx {
@@ -55,10 +62,18 @@ struct Ctx {
 
 constexpr static uint32_t Length = 32;
 
+// Number of messages, processed in parallel by sha_multi
+constexpr static uint32_t MultiBufferLanes = 8;
+
 SPRT_API void sha_init(Ctx &md);
 SPRT_API void sha_process(Ctx &md, const uint8_t *src, uint32_t inlen);
 SPRT_API void sha_done(Ctx &md, uint8_t out[Length]);
 
+// Hashes `count` independent messages; when CPU has no SHA extensions, but supports AVX2,
+// groups of up to MultiBufferLanes messages are hashed in parallel
+SPRT_API void sha_multi(const uint8_t *const src[], const size_t inlen[], uint8_t out[][Length],
+		uint32_t count);
+
 } // namespace sprt::sha256
 
 
@@ -79,6 +94,56 @@ SPRT_API void sha_done(Ctx &md, uint8_t out[Length]);
 
 } // namespace sprt::sha512
 
+
+namespace sprt::xxh3 {
+
+struct Hash128 {
+	uint64_t low;
+	uint64_t high;
+};
+
+constexpr static uint32_t SecretSize = 192;
+
+// Streaming state; seeded secret is precomputed on init
+struct Ctx {
+	alignas(64) uint64_t acc[8];
+	alignas(64) uint8_t secret[SecretSize];
+	alignas(64) uint8_t buffer[256];
+	uint64_t seed;
+	uint64_t length;
+	uint32_t buffered;
+	uint32_t stripes;
+};
+
+// Pseudorandom secret from the reference implementation
+alignas(64) inline constexpr uint8_t DefaultSecret[SecretSize] = {
+	0xB8, 0xFE, 0x6C, 0x39, 0x23, 0xA4, 0x4B, 0xBE, 0x7C, 0x01, 0x81, 0x2C, 0xF7, 0x21, 0xAD, 0x1C,
+	0xDE, 0xD4, 0x6D, 0xE9, 0x83, 0x90, 0x97, 0xDB, 0x72, 0x40, 0xA4, 0xA4, 0xB7, 0xB3, 0x67, 0x1F,
+	0xCB, 0x79, 0xE6, 0x4E, 0xCC, 0xC0, 0xE5, 0x78, 0x82, 0x5A, 0xD0, 0x7D, 0xCC, 0xFF, 0x72, 0x21,
+	0xB8, 0x08, 0x46, 0x74, 0xF7, 0x43, 0x24, 0x8E, 0xE0, 0x35, 0x90, 0xE6, 0x81, 0x3A, 0x26, 0x4C,
+	0x3C, 0x28, 0x52, 0xBB, 0x91, 0xC3, 0x00, 0xCB, 0x88, 0xD0, 0x65, 0x8B, 0x1B, 0x53, 0x2E, 0xA3,
+	0x71, 0x64, 0x48, 0x97, 0xA2, 0x0D, 0xF9, 0x4E, 0x38, 0x19, 0xEF, 0x46, 0xA9, 0xDE, 0xAC, 0xD8,
+	0xA8, 0xFA, 0x76, 0x3F, 0xE3, 0x9C, 0x34, 0x3F, 0xF9, 0xDC, 0xBB, 0xC7, 0xC7, 0x0B, 0x4F, 0x1D,
+	0x8A, 0x51, 0xE0, 0x4B, 0xCD, 0xB4, 0x59, 0x31, 0xC8, 0x9F, 0x7E, 0xC9, 0xD9, 0x78, 0x73, 0x64,
+	0xEA, 0xC5, 0xAC, 0x83, 0x34, 0xD3, 0xEB, 0xC3, 0xC5, 0x81, 0xA0, 0xFF, 0xFA, 0x13, 0x63, 0xEB,
+	0x17, 0x0D, 0xDD, 0x51, 0xB7, 0xF0, 0xDA, 0x49, 0xD3, 0x16, 0x55, 0x26, 0x29, 0xD4, 0x68, 0x9E,
+	0x2B, 0x16, 0xBE, 0x58, 0x7D, 0x47, 0xA1, 0xFC, 0x8F, 0xF8, 0xB8, 0xD1, 0x7A, 0xD0, 0x31, 0xCE,
+	0x45, 0xCB, 0x3A, 0x8F, 0x95, 0x16, 0x04, 0x28, 0xAF, 0xD7, 0xFB, 0xCA, 0xBB, 0x4B, 0x40, 0x7E,
+};
+
+SPRT_API uint64_t hash64(const void *, size_t, uint64_t seed = 0);
+SPRT_API Hash128 hash128(const void *, size_t, uint64_t seed = 0);
+
+SPRT_API void init(Ctx &, uint64_t seed = 0);
+SPRT_API void update(Ctx &, const uint8_t *, size_t);
+SPRT_API uint64_t digest64(const Ctx &);
+SPRT_API Hash128 digest128(const Ctx &);
+
+// Scalar XXH3 64-bit, usable in constant evaluation; result is the same as for hash64
+constexpr uint64_t chash64(const char *, size_t, uint64_t seed = 0);
+
+} // namespace sprt::xxh3
+
 namespace sprt {
 
 class SPRT_API xxh32 {
@@ -250,6 +315,228 @@ private:
 	}
 };
 
+namespace xxh3 {
+
+// Scalar constexpr counterpart of the kernels from runtime_core_xxh3.cpp
+class chash {
+public:
+	static constexpr uint64_t hash64(const char *input, size_t len, uint64_t seed) {
+		if (len <= 16) {
+			return len0to16(input, len, DefaultSecret, seed);
+		} else if (len <= 128) {
+			return len17to128(input, len, DefaultSecret, seed);
+		} else if (len <= MidSizeMax) {
+			return len129to240(input, len, DefaultSecret, seed);
+		} else if (seed == 0) {
+			return hashLong(input, len, DefaultSecret);
+		}
+
+		uint8_t secret[SecretSize] = {0};
+		for (size_t i = 0; i < SecretSize / 16; ++i) {
+			writeLE64(secret + 16 * i, readLE64(DefaultSecret + 16 * i) + seed);
+			writeLE64(secret + 16 * i + 8, readLE64(DefaultSecret + 16 * i + 8) - seed);
+		}
+		return hashLong(input, len, secret);
+	}
+
+private:
+	static constexpr uint32_t PRIME32_1 = 0x9E37'79B1U;
+	static constexpr uint32_t PRIME32_2 = 0x85EB'CA77U;
+	static constexpr uint32_t PRIME32_3 = 0xC2B2'AE3DU;
+
+	static constexpr uint64_t PRIME64_1 = 0x9E37'79B1'85EB'CA87ULL;
+	static constexpr uint64_t PRIME64_2 = 0xC2B2'AE3D'27D4'EB4FULL;
+	static constexpr uint64_t PRIME64_3 = 0x1656'67B1'9E37'79F9ULL;
+	static constexpr uint64_t PRIME64_4 = 0x85EB'CA77'C2B2'AE63ULL;
+	static constexpr uint64_t PRIME64_5 = 0x27D4'EB2F'1656'67C5ULL;
+
+	static constexpr uint64_t PRIME_MX1 = 0x1656'6791'9E37'79F9ULL;
+	static constexpr uint64_t PRIME_MX2 = 0x9FB2'1C65'1E98'DF25ULL;
+
+	static constexpr size_t StripeLen = 64;
+	static constexpr size_t SecretConsumeRate = 8;
+	static constexpr size_t SecretSizeMin = 136;
+	static constexpr size_t MidSizeMax = 240;
+	static constexpr size_t MidSizeStartOffset = 3;
+	static constexpr size_t MidSizeLastOffset = 17;
+	static constexpr size_t SecretLastAccStart = 7;
+	static constexpr size_t SecretMergeAccsStart = 11;
+	static constexpr size_t StripesPerBlock = (SecretSize - StripeLen) / SecretConsumeRate;
+
+	template <typename T>
+	SPRT_FORCEINLINE static constexpr uint32_t readLE32(const T *p) {
+		return uint32_t(uint8_t(p[0])) | (uint32_t(uint8_t(p[1])) << 8)
+				| (uint32_t(uint8_t(p[2])) << 16) | (uint32_t(uint8_t(p[3])) << 24);
+	}
+	template <typename T>
+	SPRT_FORCEINLINE static constexpr uint64_t readLE64(const T *p) {
+		return uint64_t(readLE32(p)) | (uint64_t(readLE32(p + 4)) << 32);
+	}
+	SPRT_FORCEINLINE static constexpr void writeLE64(uint8_t *p, uint64_t v) {
+		for (size_t i = 0; i < 8; ++i) { p[i] = uint8_t(v >> (i * 8)); }
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t rotl64(uint64_t x, int r) {
+		return (x << r) | (x >> (64 - r));
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t xorshift64(uint64_t v, int shift) {
+		return v ^ (v >> shift);
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t mult32to64(uint64_t a, uint64_t b) {
+		return uint64_t(uint32_t(a)) * uint64_t(uint32_t(b));
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t mul128_fold64(uint64_t lhs, uint64_t rhs) {
+#if __SIZEOF_INT128__
+		auto product = static_cast<unsigned __int128>(lhs) * rhs;
+		return uint64_t(product) ^ uint64_t(product >> 64);
+#else
+		auto lo_lo = mult32to64(lhs & 0xFFFF'FFFF, rhs & 0xFFFF'FFFF);
+		auto hi_lo = mult32to64(lhs >> 32, rhs & 0xFFFF'FFFF);
+		auto lo_hi = mult32to64(lhs & 0xFFFF'FFFF, rhs >> 32);
+		auto hi_hi = mult32to64(lhs >> 32, rhs >> 32);
+
+		auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFF'FFFF) + lo_hi;
+		auto upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+		auto lower = (cross << 32) | (lo_lo & 0xFFFF'FFFF);
+		return lower ^ upper;
+#endif
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t xxh64_avalanche(uint64_t h) {
+		h ^= h >> 33;
+		h *= PRIME64_2;
+		h ^= h >> 29;
+		h *= PRIME64_3;
+		h ^= h >> 32;
+		return h;
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t avalanche(uint64_t h) {
+		return xorshift64(xorshift64(h, 37) * PRIME_MX1, 32);
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t rrmxmx(uint64_t h, uint64_t len) {
+		h ^= rotl64(h, 49) ^ rotl64(h, 24);
+		h *= PRIME_MX2;
+		h ^= (h >> 35) + len;
+		h *= PRIME_MX2;
+		return xorshift64(h, 28);
+	}
+	SPRT_FORCEINLINE static constexpr uint64_t mix16B(const char *input, const uint8_t *secret,
+			uint64_t seed) {
+		return mul128_fold64(readLE64(input) ^ (readLE64(secret) + seed),
+				readLE64(input + 8) ^ (readLE64(secret + 8) - seed));
+	}
+
+	static constexpr uint64_t len0to16(const char *input, size_t len, const uint8_t *secret,
+			uint64_t seed) {
+		if (len > 8) {
+			auto bitflip1 = (readLE64(secret + 24) ^ readLE64(secret + 32)) + seed;
+			auto bitflip2 = (readLE64(secret + 40) ^ readLE64(secret + 48)) - seed;
+			auto lo = readLE64(input) ^ bitflip1;
+			auto hi = readLE64(input + len - 8) ^ bitflip2;
+			return avalanche(len + __builtin_bswap64(lo) + hi + mul128_fold64(lo, hi));
+		} else if (len >= 4) {
+			seed ^= uint64_t(__builtin_bswap32(uint32_t(seed))) << 32;
+			auto input1 = readLE32(input);
+			auto input2 = readLE32(input + len - 4);
+			auto bitflip = (readLE64(secret + 8) ^ readLE64(secret + 16)) - seed;
+			return rrmxmx((input2 + (uint64_t(input1) << 32)) ^ bitflip, len);
+		} else if (len > 0) {
+			uint32_t combined = (uint32_t(uint8_t(input[0])) << 16)
+					| (uint32_t(uint8_t(input[len >> 1])) << 24) | uint32_t(uint8_t(input[len - 1]))
+					| (uint32_t(len) << 8);
+			auto bitflip = (readLE32(secret) ^ readLE32(secret + 4)) + seed;
+			return xxh64_avalanche(uint64_t(combined) ^ bitflip);
+		}
+		return xxh64_avalanche(seed ^ (readLE64(secret + 56) ^ readLE64(secret + 64)));
+	}
+
+	static constexpr uint64_t len17to128(const char *input, size_t len, const uint8_t *secret,
+			uint64_t seed) {
+		uint64_t acc = len * PRIME64_1;
+		if (len > 32) {
+			if (len > 64) {
+				if (len > 96) {
+					acc += mix16B(input + 48, secret + 96, seed);
+					acc += mix16B(input + len - 64, secret + 112, seed);
+				}
+				acc += mix16B(input + 32, secret + 64, seed);
+				acc += mix16B(input + len - 48, secret + 80, seed);
+			}
+			acc += mix16B(input + 16, secret + 32, seed);
+			acc += mix16B(input + len - 32, secret + 48, seed);
+		}
+		acc += mix16B(input, secret, seed);
+		acc += mix16B(input + len - 16, secret + 16, seed);
+		return avalanche(acc);
+	}
+
+	static constexpr uint64_t len129to240(const char *input, size_t len, const uint8_t *secret,
+			uint64_t seed) {
+		uint64_t acc = len * PRIME64_1;
+		auto nRounds = len / 16;
+		for (size_t i = 0; i < 8; ++i) { acc += mix16B(input + 16 * i, secret + 16 * i, seed); }
+		acc = avalanche(acc);
+
+		auto accEnd = mix16B(input + len - 16, secret + SecretSizeMin - MidSizeLastOffset, seed);
+		for (size_t i = 8; i < nRounds; ++i) {
+			accEnd += mix16B(input + 16 * i, secret + 16 * (i - 8) + MidSizeStartOffset, seed);
+		}
+		return avalanche(acc + accEnd);
+	}
+
+	static constexpr void accumulate512(uint64_t *acc, const char *input, const uint8_t *secret) {
+		for (size_t i = 0; i < 8; ++i) {
+			auto data = readLE64(input + i * 8);
+			auto dataKey = data ^ readLE64(secret + i * 8);
+			acc[i ^ 1] += data;
+			acc[i] += mult32to64(dataKey, dataKey >> 32);
+		}
+	}
+
+	static constexpr void scramble(uint64_t *acc, const uint8_t *secret) {
+		for (size_t i = 0; i < 8; ++i) {
+			acc[i] = (xorshift64(acc[i], 47) ^ readLE64(secret + i * 8)) * PRIME32_1;
+		}
+	}
+
+	static constexpr uint64_t hashLong(const char *input, size_t len, const uint8_t *secret) {
+		constexpr size_t BlockLen = StripeLen * StripesPerBlock;
+
+		uint64_t acc[8] = {PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2,
+			PRIME64_5, PRIME32_1};
+
+		auto nBlocks = (len - 1) / BlockLen;
+		for (size_t n = 0; n < nBlocks; ++n) {
+			for (size_t s = 0; s < StripesPerBlock; ++s) {
+				accumulate512(acc, input + n * BlockLen + s * StripeLen,
+						secret + s * SecretConsumeRate);
+			}
+			scramble(acc, secret + SecretSize - StripeLen);
+		}
+
+		auto nStripes = ((len - 1) - (BlockLen * nBlocks)) / StripeLen;
+		for (size_t s = 0; s < nStripes; ++s) {
+			accumulate512(acc, input + nBlocks * BlockLen + s * StripeLen,
+					secret + s * SecretConsumeRate);
+		}
+
+		// last stripe
+		accumulate512(acc, input + len - StripeLen,
+				secret + SecretSize - StripeLen - SecretLastAccStart);
+
+		auto result = uint64_t(len) * PRIME64_1;
+		for (size_t i = 0; i < 4; ++i) {
+			result += mul128_fold64(acc[2 * i] ^ readLE64(secret + SecretMergeAccsStart + 16 * i),
+					acc[2 * i + 1] ^ readLE64(secret + SecretMergeAccsStart + 16 * i + 8));
+		}
+		return avalanche(result);
+	}
+};
+
+constexpr uint64_t chash64(const char *input, size_t len, uint64_t seed) {
+	return chash::hash64(input, len, seed);
+}
+
+} // namespace xxh3
+
 inline constexpr uint32_t hash32(const char *str, uint32_t len, uint32_t seed = 0) {
 	return xxh32::hash(str, len, seed);
 }
@@ -259,11 +546,19 @@ inline constexpr sprt::uint64_t hash64(const char *str, sprt::size_t len, sprt::
 }
 
 inline constexpr sprt::size_t hashSize(const char *str, sprt::size_t len, sprt::uint64_t seed = 0) {
+#if SPRT_HASH_XXH3
+	if (__builtin_is_constant_evaluated()) {
+		return sprt::size_t(xxh3::chash64(str, len, seed));
+	} else {
+		return sprt::size_t(xxh3::hash64(str, len, seed));
+	}
+#else
 	if constexpr (sizeof(sprt::size_t) == 4) {
 		return xxh32::hash(str, len, seed);
 	} else {
 		return xxh64::hash(str, len, seed);
 	}
+#endif
 }
 
 } // namespace sprt
@@ -44,6 +44,9 @@ enum LogType {
 struct SPRT_API LogFeatures {
 	static LogFeatures acquire();
 
+	// Features are detected once on startup, reference is valid for the whole process lifetime
+	static const LogFeatures &get();
+
 	enum Features : uint32_t {
 		None,
 		AnsiCompatible = 1 << 0,
@@ -87,16 +90,140 @@ struct SPRT_API LogFeatures {
 
 SPRT_DEFINE_ENUM_AS_MASK(LogFeatures::Features)
 
+enum class LogOverflow : uint32_t {
+	Drop, // discard message
+	Block, // wait for the drain thread to free space in buffer
+	Count, // discard message, then report number of discarded messages
+};
+
+struct LogAsyncInfo {
+	// per-thread ring buffer size (rounded up to power of 2), messages larger than
+	// a half of the buffer are written synchronously
+	size_t bufferSize = 64 * 1'024;
+	LogOverflow overflow = LogOverflow::Count;
+};
+
 SPRT_API void print(LogType type, StringView prefix, StringView tag, StringView text);
 
+// Asynchronous mode: formatted messages are copied into per-thread lock-free ring buffers
+// and written with writev from the background drain thread
+// Fatal messages are always written synchronously after all buffered messages
+// Async mode is disabled (with flush) on process termination
+// Not available on Android, where messages are passed to the system log
+SPRT_API bool enableAsync(const LogAsyncInfo & = LogAsyncInfo());
+SPRT_API void disableAsync();
+
+// Write all buffered messages on the calling thread
+SPRT_API void flush();
+
+// Binary mode: vprint writes format-site id, tag, timestamp and raw argument values instead of
+// rendered text; messages from `print` are written as records with a single text argument
+// Output is a stream of records in native byte order, use `decodeBinary` to render it
+// Async mode (if enabled) writes binary records into `fd` as well
+SPRT_API bool enableBinary(int fd);
+SPRT_API void disableBinary();
+SPRT_API bool isBinary();
+
+SPRT_API void printBinary(LogType type, const source_location &loc, StringView tag,
+		BytesView args);
+
+struct LogRecord {
+	LogType type = LogType::Info;
+	uint64_t time = 0; // realtime, microseconds
+	StringView file;
+	uint32_t line = 0;
+	StringView tag;
+	StringView text;
+};
+
+// Decodes and renders binary log records; fails with ErrorInvalidArguemnt on malformed data
+// Trailing incomplete record (like from the interrupted process) is ignored
+SPRT_API Status decodeBinary(BytesView, const callback<void(const LogRecord &)> &);
+
+enum class LogArgType : uint8_t {
+	Text = 1,
+	Signed,
+	Unsigned,
+	Float, // double
+	Float32,
+};
+
+template <typename T>
+static constexpr bool __log_binary_numeric =
+		(signed_or_unsigned_integer<T> || floating_point<T> || enumeration<T>)
+		&& !io_character<T>;
+
+template <typename Type>
+size_t __logBinaryArgSize(const Type &value) {
+	if constexpr (__log_binary_numeric<remove_cvref_t<Type>>) {
+		return 1 + sizeof(uint64_t);
+	} else {
+		return 1 + sizeof(uint32_t) + io_traits<void>::template length<char>(value);
+	}
+}
+
+template <typename Type>
+uint8_t *__logBinaryArgWrite(uint8_t *target, const Type &value) {
+	using T = remove_cvref_t<Type>;
+	if constexpr (enumeration<T>) {
+		return __logBinaryArgWrite(target, sprt::underlying_type_t<T>(value));
+	} else if constexpr (__log_binary_numeric<T>) {
+		uint64_t bits = 0;
+		if constexpr (is_same_v<T, float>) {
+			// keep float rendering precision
+			*target++ = uint8_t(LogArgType::Float32);
+			__builtin_memcpy(&bits, &value, sizeof(float));
+		} else if constexpr (floating_point<T>) {
+			*target++ = uint8_t(LogArgType::Float);
+			double v = double(value);
+			__builtin_memcpy(&bits, &v, sizeof(v));
+		} else if constexpr (signed_integer<T>) {
+			*target++ = uint8_t(LogArgType::Signed);
+			bits = uint64_t(int64_t(value));
+		} else {
+			*target++ = uint8_t(LogArgType::Unsigned);
+			bits = uint64_t(value);
+		}
+		__builtin_memcpy(target, &bits, sizeof(bits));
+		return target + sizeof(bits);
+	} else {
+		*target++ = uint8_t(LogArgType::Text);
+		auto sizeTarget = target;
+		target += sizeof(uint32_t);
+
+		uint32_t size = 0;
+		io_traits<void>::template encode<char>([&](StringView str) {
+			__builtin_memcpy(target, str.data(), str.size());
+			target += str.size();
+			size += uint32_t(str.size());
+		}, value);
+		__builtin_memcpy(sizeTarget, &size, sizeof(size));
+		return target;
+	}
+}
+
+template <typename... Args>
+void __vprintBinary(LogType type, const source_location &loc, StringView tag, Args &&...args) {
+	size_t bufSize = (0 + ... + __logBinaryArgSize(args));
+	auto buf = __sprt_typed_malloca(uint8_t, bufSize + 1);
+	auto target = buf;
+	((target = __logBinaryArgWrite(target, args)), ...);
+	printBinary(type, loc, tag, BytesView(buf, target - buf));
+	__sprt_freea(buf);
+}
+
 template <typename... Args>
 SPRT_API void vprint(LogType type, const source_location &loc, StringView tag, Args &&...args) {
-	LogFeatures features;
+	if (isBinary()) {
+		__vprintBinary(type, loc, tag, sprt::forward<Args>(args)...);
+		return;
+	}
+
+	auto &features = LogFeatures::get();
 	size_t bufSize = StreamTraits<char>::calculateSize(sprt::forward<Args>(args)...);
 
 	if (auto name = loc.file_name()) {
 		auto fileNameLen = __builtin_strlen(name);
-		features = LogFeatures::acquire();
 
 		// add space for SourceLocation encoding
 		bufSize += (1 + features.underline.size() + features.dim.size() + fileNameLen + 1
@@ -122,6 +122,12 @@ public:
 	template <typename T>
 	using HashSet = sprt::__pool_unordered_set<T>;
 
+	template <typename K, typename V>
+	using FlatHashMap = sprt::__pool_flat_unordered_map<K, V>;
+
+	template <typename T>
+	using FlatHashSet = sprt::__pool_flat_unordered_set<T>;
+
 	using StringStream = sprt::__pool_stringstream;
 
 	template <typename T>
@@ -45,7 +45,12 @@ enum class ClockType {
 
 	// hardware clock tick counter with unknown monotonic resolution;
 	// see `rdtsc`
-	Hardware
+	Hardware,
+
+	// hardware clock tick counter, calibrated against Monotonic clock, with the same time base;
+	// much cheaper then Monotonic, but can slightly drift between corrections (once per second);
+	// if counter is not invariant - Monotonic is used instead
+	Fast,
 };
 
 // current time in microseconds (with except for Hardware, see above)
@@ -54,6 +59,10 @@ SPRT_API uint64_t clock(ClockType = ClockType::Default);
 // current time in nanoseconds
 SPRT_API uint64_t nanoclock(ClockType = ClockType::Default);
 
+// Frequency of the Hardware clock in Hz, or 0 if it can not be used for a timing
+// (counter is not invariant or not available)
+SPRT_API uint64_t getHardwareClockFrequency();
+
 // sleep for the microseconds
 SPRT_API void sleep(uint64_t microseconds);
 
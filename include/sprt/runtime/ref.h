@@ -32,6 +32,10 @@
 #include <sprt/cxx/atomic>
 
 // enable Ref debug mode to track retain/release sources
+//
+// With SPRT_REF_DEBUG=0 (release mode) Ref uses non-virtual inlined counter,
+// and Rc is a single pointer. Value should be the same for the whole build,
+// it affects Ref vtable and Rc layout.
 #ifndef SPRT_REF_DEBUG
 #define SPRT_REF_DEBUG 1
 #endif
@@ -47,6 +51,7 @@
 namespace sprt {
 
 class SPRT_API Ref;
+class SPRT_API LocalRef;
 
 template <typename T, typename... Args>
 inline T *__new(Args &&...args) noexcept;
@@ -70,6 +75,12 @@ SPRT_API void releaseRef(const Ref *);
 SPRT_API void foreachBacktrace(const Ref *,
 		const callback<void(uint64_t, time_t, const __pool_list<StringView> &)> &);
 
+// Capture backtrace for one of every `rate` tracked retains (per thread)
+// Retains without backtrace are still tracked, and reported with empty backtrace
+// 0 disables backtrace capture, default is 1 (capture every retain)
+SPRT_API void setBacktraceSampleRate(uint32_t rate);
+SPRT_API uint32_t getBacktraceSampleRate();
+
 } // namespace memleak
 
 // Reference allocation base class
@@ -193,10 +204,11 @@ protected:
 
 	[[nodiscard("Caller should delete object with __delete if release returns true")]]
 	bool release(uint64_t id) {
+		(void)id;
 		if (decrementReferenceCount()) {
 			return true;
 		}
-		return false
+		return false;
 	}
 #endif
 
@@ -209,6 +221,43 @@ protected:
 #endif
 };
 
+// Define `static constexpr bool RefInlineRetain = true;` within Ref subclass to use
+// non-virtual inlined retain/release for it in SPRT_REF_DEBUG mode
+// Retain tracking is not available for such classes
+template <typename T>
+concept __ref_inline_retain = requires { requires T::RefInlineRetain; };
+
+// Reference with non-atomic counter for objects, that are never shared between threads
+// Retain/release are always inlined and never tracked
+//
+// LocalRef can still be used with Rc<Ref> or other base-class Rc, but only
+// within the owner thread
+class SPRT_API LocalRef : public Ref {
+public:
+	static constexpr bool RefInlineRetain = true;
+
+protected:
+	template <typename U>
+	friend uint64_t retain(U *, uint64_t) noexcept;
+
+	template <typename U, typename V>
+	friend void release(U *, uint64_t) noexcept;
+
+	LocalRef() noexcept : Ref() { }
+
+	// plain load/store instead of locked RMW, valid only for a single thread
+	void incrementLocalReferenceCount() {
+		_referenceCount.store(_referenceCount.load(memory_order::relaxed) + 1,
+				memory_order::relaxed);
+	}
+
+	bool decrementLocalReferenceCount() {
+		auto value = _referenceCount.load(memory_order::relaxed) - 1;
+		_referenceCount.store(value, memory_order::relaxed);
+		return value == 0;
+	}
+};
+
 enum class SharedRefMode {
 	Pool,
 	Allocator,
@@ -514,14 +563,20 @@ auto ref_cast(const Rc<Source> &source) -> Rc<Target> {
 // Implementation
 //
 
-inline uint32_t RefAlloc::getReferenceCount() const noexcept { return _referenceCount.load(); }
+inline uint32_t RefAlloc::getReferenceCount() const noexcept {
+	return _referenceCount.load(memory_order::relaxed);
+}
 
 // DO NOT USE THIS DIRECTLY, use Ref::retain
-inline void RefAlloc::incrementReferenceCount() { ++_referenceCount; }
+// New reference is always created from existing one, so, no ordering required
+inline void RefAlloc::incrementReferenceCount() {
+	_referenceCount.fetch_add(1, memory_order::relaxed);
+}
 
 // DO NOT USE THIS DIRECTLY, use Ref::release
+// Release publishes object changes for the thread, that will delete it
 inline bool RefAlloc::decrementReferenceCount() {
-	if (_referenceCount.fetch_sub(1) == 1) {
+	if (_referenceCount.fetch_sub(1, memory_order::acq_rel) == 1) {
 		return true;
 	}
 	return false;
@@ -989,6 +1044,7 @@ inline auto Rc<_Base>::operator=(const Rc<B> &value) noexcept -> Rc & {
 template <typename _Base>
 template <typename B, typename enable_if<is_convertible_v<B *, _Base *>>::type *>
 inline auto Rc<_Base>::operator=(Rc<B> &&value) noexcept -> Rc & {
+	this->doRelease();
 	this->_ptr = static_cast<Type *>(value._ptr);
 	value._ptr = nullptr;
 #if SPRT_REF_DEBUG
@@ -1148,12 +1204,35 @@ inline T *__new(Args &&...args) noexcept {
 
 template <typename T>
 inline uint64_t retain(T *t, uint64_t value) noexcept {
+#if !SPRT_REF_SAFE_INSTANIATION
+	if constexpr (is_base_of_v<LocalRef, T>) {
+		static_cast<LocalRef *>(t)->incrementLocalReferenceCount();
+		return 0;
+	} else if constexpr (__ref_inline_retain<T>) {
+		static_cast<Ref *>(t)->incrementReferenceCount();
+		return 0;
+	}
+#endif
 	return t->retain(value);
 }
 
 template <typename T, typename Pointer>
 inline void release(T *t, uint64_t value) noexcept {
-	if (t->release(value)) {
+#if !SPRT_REF_SAFE_INSTANIATION
+	using Type = remove_cv_t<remove_pointer_t<Pointer>>;
+
+	bool finalize = false;
+	if constexpr (is_base_of_v<LocalRef, Type>) {
+		finalize = static_cast<LocalRef *>(t)->decrementLocalReferenceCount();
+	} else if constexpr (__ref_inline_retain<Type>) {
+		finalize = static_cast<Ref *>(t)->decrementReferenceCount();
+	} else {
+		finalize = t->release(value);
+	}
+#else
+	bool finalize = t->release(value);
+#endif
+	if (finalize) {
 		if constexpr (__is_shared_ref<sprt::remove_pointer_t<Pointer>>::value) {
 			sprt::remove_pointer_t<Pointer>::__delete(Pointer(t));
 		} else {
@@ -1182,6 +1261,10 @@ inline void release(const NotNull<T> &t, uint64_t value) noexcept {
 	sprt::release(t.get(), value);
 }
 
+#if !SPRT_REF_DEBUG
+static_assert(sizeof(Rc<Ref>) == sizeof(Ref *), "Rc should be a single pointer in release mode");
+#endif
+
 } // namespace sprt
 
 #endif // RUNTIME_INCLUDE_SPRT_RUNTIME_REF_H_
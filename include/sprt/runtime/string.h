@@ -76,8 +76,8 @@ constexpr inline size_t itoa(uint64_t number, CharType *buffer, size_t bufSize)
 /*
 	Fast dtoa implementation
 
-	Data will be written from beginning, no trailing zero (do not try to use strlen on it!);
-	Designed to be used with StringView: StringView(buf, ret)
+	Data will be written at the end of buffer, no trailing zero (do not try to use strlen on it!);
+	Designed to be used with StringView: StringView(buf + bufSize - ret, ret)
 
 	Returns number size on symbols
 	Use nullptr buffer to calculate expected buffer length.
@@ -187,7 +187,7 @@ template <typename CharType, bool InsertNullterm = true>
 constexpr inline auto strappend(char SPRT_NONNULL *buf, size_t *bufSize, double val) -> CharType * {
 	CharType tmp[DOUBLE_MAX_DIGITS];
 	auto ret = sprt::dtoa(val, tmp, DOUBLE_MAX_DIGITS);
-	return strappend<CharType, InsertNullterm>(buf, bufSize, tmp, ret);
+	return strappend<CharType, InsertNullterm>(buf, bufSize, tmp + DOUBLE_MAX_DIGITS - ret, ret);
 }
 
 } // namespace sprt
@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <sprt/runtime/utils/notnull.h>
 #include <sprt/runtime/utils/byteorder.h>
 #include <sprt/runtime/utils/halffloat.h>
+#include <sprt/runtime/detail/atof.h>
 
 #include <sprt/cxx/detail/constexpr.h>
 #include <sprt/cxx/cstring>
@@ -1159,10 +1160,29 @@ constexpr size_t length(const uint8_t *__p, size_t max) {
 }
 
 template <typename T, typename Char>
-inline auto readNumber(const Char *ptr, size_t len, int base, uint8_t &offset) -> Result<T> {
+inline auto readNumber(const Char *ptr, size_t len, int base, size_t &offset) -> Result<T> {
+	// locale-independent fast path, reads directly from the view without copying
+	if constexpr (is_same_v<T, float> || is_same_v<T, double>) {
+		_atof::decimal dec;
+		auto n = _atof::parse_decimal(ptr, len, dec);
+		T val;
+		if (n > 0 && _atof::to_float(dec, val)) {
+			offset = n;
+			return Result<T>(val);
+		}
+	} else if constexpr (is_same_v<T, int64_t>) {
+		int64_t val = 0;
+		auto n = _atof::parse_integer(ptr, len, base, val);
+		if (n > 0) {
+			offset = n;
+			return Result<T>(val);
+		}
+	}
+
+	// inf/nan, hex floats, other bases and ambiguous long mantissas go through libc;
 	// prevent to read out of bounds, copy symbols to stack buffer
-	char buf[32] = {0}; // int64_t/scientific double character length max
-	size_t m = min(size_t(31), len);
+	char buf[128] = {0};
+	size_t m = min(sizeof(buf) - 1, len);
 	size_t i = 0;
 	for (; i < m; i++) {
 		auto c = ptr[i];
@@ -1176,16 +1196,16 @@ inline auto readNumber(const Char *ptr, size_t len, int base, uint8_t &offset) -
 	// read number from internal buffer
 	char *ret = nullptr;
 	auto val = StringToNumber<T>(buf, &ret, base);
-	if (*ret == 0) {
+	if (!ret || ret == buf) {
+		// fail to read number
+		offset = 0;
+		return Result<T>();
+	} else if (*ret == 0) {
 		// while string was used
 		offset = i;
-	} else if (ret && ret != buf) {
+	} else {
 		// part of string was used
 		offset = ret - buf;
-	} else {
-		// fail to read number
-		offset = 0;
-		return Result<T>();
 	}
 	return Result<T>(val);
 }
@@ -1745,10 +1765,13 @@ template <typename _CharType>
 auto StringViewBase<_CharType>::readFloat() -> Result<float> {
 	Self tmp = *this;
 	tmp.skipChars<typename Self::template CharGroup<CharGroupId::WhiteSpace>>();
-	uint8_t offset = 0;
+	size_t offset = 0;
 	auto ret = detail::readNumber<float>(tmp.ptr, tmp.len, 0, offset);
-	this->ptr += offset;
-	this->len -= offset;
+	if (offset > 0) {
+		// leading whitespace is consumed with the number, view is unchanged on failure
+		this->ptr = tmp.ptr + offset;
+		this->len = tmp.len - offset;
+	}
 	return ret;
 }
 
@@ -1756,10 +1779,13 @@ template <typename _CharType>
 auto StringViewBase<_CharType>::readDouble() -> Result<double> {
 	Self tmp = *this;
 	tmp.skipChars<typename Self::template CharGroup<CharGroupId::WhiteSpace>>();
-	uint8_t offset = 0;
+	size_t offset = 0;
 	auto ret = detail::readNumber<double>(tmp.ptr, tmp.len, 0, offset);
-	this->ptr += offset;
-	this->len -= offset;
+	if (offset > 0) {
+		// leading whitespace is consumed with the number, view is unchanged on failure
+		this->ptr = tmp.ptr + offset;
+		this->len = tmp.len - offset;
+	}
 	return ret;
 }
 
@@ -1767,10 +1793,13 @@ template <typename _CharType>
 auto StringViewBase<_CharType>::readInteger(int base) -> Result<int64_t> {
 	Self tmp = *this;
 	tmp.skipChars<typename Self::template CharGroup<CharGroupId::WhiteSpace>>();
-	uint8_t offset = 0;
+	size_t offset = 0;
 	auto ret = detail::readNumber<int64_t>(tmp.ptr, tmp.len, base, offset);
-	this->ptr += offset;
-	this->len -= offset;
+	if (offset > 0) {
+		// leading whitespace is consumed with the number, view is unchanged on failure
+		this->ptr = tmp.ptr + offset;
+		this->len = tmp.len - offset;
+	}
 	return ret;
 }
 
@@ -1778,7 +1807,12 @@ template <typename _CharType>
 template <typename... Args>
 auto StringViewBase<_CharType>::skipChars() -> void {
 	size_t offset = 0;
-	while (this->len > offset && match<Args...>(this->ptr[offset])) { ++offset; }
+	if constexpr (chars::CharTableMatcher<chars::Compose<CharType, Args...>>) {
+		offset = chars::CharTableValue<chars::Compose<CharType, Args...>>.scan(this->ptr,
+				this->len, true);
+	} else {
+		while (this->len > offset && match<Args...>(this->ptr[offset])) { ++offset; }
+	}
 	auto off = sprt::min(offset, this->len);
 	this->len -= off;
 	this->ptr += off;
@@ -1788,7 +1822,12 @@ template <typename _CharType>
 template <typename... Args>
 auto StringViewBase<_CharType>::skipUntil() -> void {
 	size_t offset = 0;
-	while (this->len > offset && !match<Args...>(this->ptr[offset])) { ++offset; }
+	if constexpr (chars::CharTableMatcher<chars::Compose<CharType, Args...>>) {
+		offset = chars::CharTableValue<chars::Compose<CharType, Args...>>.scan(this->ptr,
+				this->len, false);
+	} else {
+		while (this->len > offset && !match<Args...>(this->ptr[offset])) { ++offset; }
+	}
 	auto off = sprt::min(offset, this->len);
 	this->len -= off;
 	this->ptr += off;
@@ -1917,7 +1956,11 @@ auto StringViewBase<_CharType>::trimUntil() -> void {
 template <typename _CharType>
 template <typename... Args>
 auto StringViewBase<_CharType>::match(CharType c) -> bool {
-	return chars::Compose<CharType, Args...>::match(c);
+	if constexpr (chars::CharTableMatcher<chars::Compose<CharType, Args...>>) {
+		return chars::CharTableValue<chars::Compose<CharType, Args...>>.test(c);
+	} else {
+		return chars::Compose<CharType, Args...>::match(c);
+	}
 }
 
 
@@ -2106,28 +2149,37 @@ inline StringViewUtf8::operator StringViewBase<char>() const {
 inline Result<float> StringViewUtf8::readFloat() {
 	Self tmp = *this;
 	tmp.skipChars<CharGroup<CharGroupId::WhiteSpace>>();
-	uint8_t offset = 0;
+	size_t offset = 0;
 	auto ret = detail::readNumber<float>(tmp.ptr, tmp.len, 0, offset);
-	this->ptr += offset;
-	this->len -= offset;
+	if (offset > 0) {
+		// leading whitespace is consumed with the number, view is unchanged on failure
+		this->ptr = tmp.ptr + offset;
+		this->len = tmp.len - offset;
+	}
 	return ret;
 }
 inline Result<double> StringViewUtf8::readDouble() {
 	Self tmp = *this;
 	tmp.skipChars<CharGroup<CharGroupId::WhiteSpace>>();
-	uint8_t offset = 0;
+	size_t offset = 0;
 	auto ret = detail::readNumber<double>(tmp.ptr, tmp.len, 0, offset);
-	this->ptr += offset;
-	this->len -= offset;
+	if (offset > 0) {
+		// leading whitespace is consumed with the number, view is unchanged on failure
+		this->ptr = tmp.ptr + offset;
+		this->len = tmp.len - offset;
+	}
 	return ret;
 }
 inline Result<int64_t> StringViewUtf8::readInteger(int base) {
 	Self tmp = *this;
 	tmp.skipChars<CharGroup<CharGroupId::WhiteSpace>>();
-	uint8_t offset = 0;
-	auto ret = detail::readNumber<int64_t>(tmp.ptr, tmp.len, 0, offset);
-	this->ptr += offset;
-	this->len -= offset;
+	size_t offset = 0;
+	auto ret = detail::readNumber<int64_t>(tmp.ptr, tmp.len, base, offset);
+	if (offset > 0) {
+		// leading whitespace is consumed with the number, view is unchanged on failure
+		this->ptr = tmp.ptr + offset;
+		this->len = tmp.len - offset;
+	}
 	return ret;
 }
 
@@ -25,6 +25,8 @@
 
 #include <sprt/cxx/atomic>
 #include <sprt/c/sys/__sprt_sprt.h>
+#include <sprt/c/__sprt_errno.h>
+#include <sprt/c/__sprt_sched.h>
 #include <sprt/runtime/status.h>
 
 namespace sprt {
@@ -50,9 +52,76 @@ public:
 	// First unused bit
 	static constexpr value_type BIT_MAX = 0b0'1000;
 
+	// Upper limit for the spin phase before the thread is parked
+	static constexpr uint32_t SPIN_MAX = 100;
+
+	// Spin budget when recent spins failed
+	static constexpr uint32_t SPIN_MIN = 10;
+
+	// Fixed point precision for the spin estimation
+	static constexpr uint32_t SPIN_FRACTION_BITS = 3;
+
+	// Max number of locks for `_lock_any`
+	static constexpr uint32_t LOCK_ANY_MAX = 128;
+
+	// CPU hint for the spin-wait loops
+	SPRT_FORCEINLINE static void _relax() {
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		__asm__ __volatile__("yield" ::: "memory");
+#endif
+	}
+
+	// Spin budget for the `spins` estimation: twice the recent average, at least a minimal probe
+	SPRT_FORCEINLINE static uint32_t _spinBudget(const uint32_t *spins) {
+		return min(SPIN_MAX, (_atomic::loadRel(spins) >> (SPIN_FRACTION_BITS - 1)) + SPIN_MIN);
+	}
+
+	/*
+		Exponential moving average with 1/8 weight, `spins` is stored in fixed point with
+		SPIN_FRACTION_BITS, so small samples still move it. Decay rounds up, so failed spins
+		(sample = 0) pull it down to zero. Races on update are harmless.
+	*/
+	SPRT_FORCEINLINE static void _spinUpdate(uint32_t *spins, uint32_t sample) {
+		const uint32_t prev = _atomic::loadRel(spins);
+		__atomic_store_n(spins,
+				prev + sample - ((prev + (1 << SPIN_FRACTION_BITS) - 1) >> SPIN_FRACTION_BITS),
+				__ATOMIC_RELAXED);
+	}
+
+	/*
+		Adaptive spin phase: waits for the owner to release the lock without a syscall.
+		`spins` is a per-lock estimation of how many iterations it took to acquire lock
+		recently (basically, a hold time of the short critical sections); spin budget follows it,
+		so locks with long critical sections stop spinning and park almost immediately.
+
+		Returns true if lock was acquired
+	*/
+	static bool _spin(value_type *__value, uint32_t *spins) {
+		const uint32_t max = _spinBudget(spins);
+		uint32_t count = 0;
+		bool locked = false;
+		while (count < max) {
+			++count;
+			_relax();
+			// test before test-and-set, to keep cache line shared while lock is held
+			if ((_atomic::loadRel(__value) & LOCK_BIT) == 0
+					&& (_atomic::fetchOr(__value, LOCK_BIT) & LOCK_BIT) == 0) {
+				locked = true;
+				break;
+			}
+		}
+
+		_spinUpdate(spins, locked ? count : 0);
+		return locked;
+	}
+
+	// With `spins` storage, lock tries to spin before it parks the thread with WaitFn
 	template <int (*WaitFn)(value_type *, value_type, timeout_type, flags_type),
 			timeout_type (*ClockFn)(flags_type)>
-	static Status _lock(value_type *__value, timeout_type *timeout, flags_type flags) {
+	static Status _lock(value_type *__value, timeout_type *timeout, flags_type flags,
+			uint32_t *spins = nullptr) {
 		// try to mark futex to own it
 		timeout_type now = 0, next = 0;
 		if constexpr (ClockFn != nullptr) {
@@ -63,6 +132,13 @@ public:
 
 		uint32_t c = _atomic::fetchOr(__value, LOCK_BIT);
 		if ((c & LOCK_BIT) != 0) {
+			if (spins && (!timeout || *timeout != 0)) {
+				if (_spin(__value, spins)) {
+					return Status::Ok;
+				}
+				c = _atomic::loadSeq(__value);
+			}
+
 			// prev value already has LOCK flag, wait
 			do {
 				if constexpr (ClockFn != nullptr) {
@@ -103,6 +179,58 @@ public:
 		return Status::Ok;
 	}
 
+	/*
+		Locks the first available lock from the list, and returns its index, or -1 with errno.
+		When all locks are busy, thread waits on all of them at once with WaitAnyFn
+		(see `sprt_qlock_wait_any`); if it's not supported, it polls locks with sched_yield.
+	*/
+	template <int (*WaitAnyFn)(value_type *const *, const value_type *, uint32_t, timeout_type,
+			flags_type)>
+	static int _lock_any(value_type *const *values, uint32_t count, flags_type flags) {
+		if (count == 0 || count > LOCK_ANY_MAX) {
+			__sprt_errno = EINVAL;
+			return -1;
+		}
+
+		value_type expected[LOCK_ANY_MAX];
+		bool waitAnySupported = true;
+
+		// after the first wait, we should keep WAIT_BIT to unlock other potential waiters
+		value_type lockBits = LOCK_BIT;
+		while (true) {
+			for (uint32_t i = 0; i < count; ++i) {
+				if ((_atomic::fetchOr(values[i], lockBits) & LOCK_BIT) == 0) {
+					return int(i);
+				}
+			}
+
+			if (!waitAnySupported) {
+				__sprt_sched_yield();
+				continue;
+			}
+
+			for (uint32_t i = 0; i < count; ++i) {
+				expected[i] = _atomic::fetchOr(values[i], WAIT_BIT) | WAIT_BIT;
+				if ((expected[i] & LOCK_BIT) == 0) {
+					// released while we set WAIT_BIT
+					if ((_atomic::fetchOr(values[i], LOCK_BIT | WAIT_BIT) & LOCK_BIT) == 0) {
+						return int(i);
+					}
+					expected[i] = LOCK_BIT | WAIT_BIT;
+				}
+			}
+
+			if (WaitAnyFn(values, expected, count, __SPRT_SPRT_TIMEOUT_INFINITE, flags) < 0) {
+				if (__sprt_errno == ENOSYS) {
+					waitAnySupported = false;
+				} else if (__sprt_errno != EAGAIN) {
+					return -1;
+				}
+			}
+			lockBits = LOCK_BIT | WAIT_BIT;
+		}
+	}
+
 	static Status _try_lock(value_type *__value) {
 		// returns true if successfully locked
 		// set LOCK flag, return true if it was not set (so, we successfully locked)
@@ -144,7 +272,10 @@ public:
 	qmutex(const qmutex &) = delete;
 	qmutex &operator=(const qmutex &) = delete;
 
-	void lock() { _lock<__sprt_sprt_qlock_wait, nullptr>(&_data, 0, 0); }
+	void lock() { _lock<__sprt_sprt_qlock_wait, nullptr>(&_data, 0, 0, &_spins); }
+
+	// Locks the first available mutex from the list (up to LOCK_ANY_MAX), returns its index
+	static int lock_any(qmutex *const *, uint32_t count);
 
 	bool try_lock() { return _try_lock(&_data) == Status::Ok; }
 
@@ -155,6 +286,7 @@ public:
 
 protected:
 	value_type _data;
+	uint32_t _spins = 0;
 };
 
 } // namespace sprt
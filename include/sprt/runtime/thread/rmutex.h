@@ -23,9 +23,7 @@
 #ifndef RUNTIME_INCLUDE_SPRT_RUNTIME_THREAD_RMUTEX_H_
 #define RUNTIME_INCLUDE_SPRT_RUNTIME_THREAD_RMUTEX_H_
 
-#include <sprt/cxx/atomic>
-#include <sprt/c/sys/__sprt_sprt.h>
-#include <sprt/runtime/status.h>
+#include <sprt/runtime/thread/qmutex.h>
 
 namespace sprt {
 
@@ -68,6 +66,7 @@ struct __rmutex_data {
 #endif
 	__sprt_sprt_rlock_t value = {0};
 	uint32_t counter = 0;
+	uint32_t spins = 0; // spin phase estimation, see qmutex_base::_spinUpdate
 };
 
 class rmutex_base {
@@ -98,8 +97,30 @@ public:
 		return __rmutex_data::getNativeValue(lock.value);
 	}
 
+	// Adaptive spin phase, same as qmutex_base::_spin; returns true if lock was acquired
+	static bool _spin(value_type &data, tid_type tidWithPrio, uint32_t *spins) {
+		const uint32_t max = qmutex_base::_spinBudget(spins);
+		uint32_t count = 0;
+		bool locked = false;
+		while (count < max) {
+			++count;
+			qmutex_base::_relax();
+			tid_type value = _atomic::loadRel(getNativeValue(data));
+			// lock is free, if only WAITERS_BIT can be set; we keep it to wake other waiters
+			if ((value & ~WAITERS_BIT) == 0
+					&& _atomic::compareSwap(getNativeValue(data), &value, tidWithPrio | value)) {
+				locked = true;
+				break;
+			}
+		}
+
+		qmutex_base::_spinUpdate(spins, locked ? count : 0);
+		return locked;
+	}
+
 	/*
 		Set SyscallLock to true when whole locking process should be performed with WaitFn
+		With `spins` storage, lock tries to spin before it parks the thread with WaitFn
 
 		returns:
 		- Status::Ok on success
@@ -109,7 +130,8 @@ public:
 	template <int (*WaitFn)(value_type *, value_type *, timeout_type, flags_type),
 			timeout_type (*ClockFn)(flags_type), bool SyscallLock>
 	static Status _lock(value_type &data, value_type threadId, timeout_type *timeout,
-			flags_type flags, const Callback<void(const value_type &)> &prioCb = nullptr) {
+			flags_type flags, const Callback<void(const value_type &)> &prioCb = nullptr,
+			uint32_t *spins = nullptr) {
 		bool priorityProtectionEnabled = false;
 		tid_type tidWithPrio = *getNativeValue(threadId) & VALUE_MASK;
 		value_type expected = {0};
@@ -123,6 +145,17 @@ public:
 		// We need not set WAITERS_BIT hee, as we assume that mutex is not locked and no waiters exists
 		if (!_atomic::compareSwap(getNativeValue(data), getNativeValue(expected), tidWithPrio))
 				[[unlikely]] {
+			// spin only when lock is held by other live thread
+			if (spins && (*getNativeValue(expected) & OWNER_DIED) == 0
+					&& (*getNativeValue(expected) & THREAD_ID_MASK)
+							!= (tidWithPrio & THREAD_ID_MASK)
+					&& (!timeout || *timeout != 0)) {
+				if (_spin(data, tidWithPrio, spins)) {
+					return Status::Ok;
+				}
+				*getNativeValue(expected) = _atomic::loadSeq(getNativeValue(data));
+			}
+
 			// failed - should lock
 			do {
 				if ((*getNativeValue(expected) & OWNER_DIED) != 0) {
@@ -80,7 +80,8 @@ SPRT_INLINE constexpr inline bool isUtf16LowSurrogate(char16_t c) {
 }
 
 SPRT_INLINE constexpr inline char32_t utf16CombineSurrogates(char16_t ch1, char16_t ch2) {
-	return char32_t(0b0000'0011'1111'1111 & ch1) << 10 | char32_t(0b0000'0011'1111'1111 & ch2);
+	return (char32_t(0b0000'0011'1111'1111 & ch1) << 10 | char32_t(0b0000'0011'1111'1111 & ch2))
+			+ 0x1'0000;
 }
 
 constexpr inline char32_t utf8Decode32(const char *ptr, size_t len, uint8_t &offset) {
@@ -197,11 +198,16 @@ SPRT_INLINE constexpr inline uint8_t utf8EncodeBuf(char *ptr, size_t bufSize, ch
 
 SPRT_INLINE constexpr inline char32_t utf16Decode32(const char16_t *ptr, size_t len,
 		uint8_t &offset) {
-	if ((*ptr & char16_t(0xD800)) != 0) {
+	if (isUtf16Surrogate(*ptr)) {
+		// surrogates always take two units, like in getUtf8Length/getUtf32Length;
+		// broken pair is decoded as 0
 		offset = 2;
 		if (offset > len) {
 			return 0;
 		}
+		if (!isUtf16HighSurrogate(ptr[0]) || !isUtf16LowSurrogate(ptr[1])) {
+			return 0;
+		}
 		return utf16CombineSurrogates(ptr[0], ptr[1]);
 	} else {
 		offset = 1;
@@ -237,7 +243,7 @@ SPRT_INLINE constexpr inline uint8_t utf16EncodeCb(const PutCharFn &cb, char32_t
 		cb(char16_t(c));
 		return 1;
 	} else {
-		cb(char16_t(((0b1111'1111'1100'0000'0000 & c) >> 10) + 0xD800));
+		cb(char16_t((((c - 0x1'0000) >> 10) & 0b0000'0000'0011'1111'1111) + 0xD800));
 		cb(char16_t(((0b0000'0000'0011'1111'1111 & c) >> 00) + 0xDC00));
 		return 2;
 	}
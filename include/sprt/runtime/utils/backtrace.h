@@ -32,6 +32,13 @@ namespace sprt::backtrace {
 
 SPRT_API void getBacktrace(size_t offset, const callback<void(uintptr_t, StringView)> &);
 
+// Capture raw return addresses without symbolization, returns number of frames written
+SPRT_API size_t captureBacktrace(size_t offset, uintptr_t *, size_t count);
+
+// Symbolize addresses, captured with captureBacktrace
+SPRT_API void symbolizeBacktrace(const uintptr_t *, size_t count,
+		const callback<void(uintptr_t, StringView)> &);
+
 } // namespace sprt::backtrace
 
 #endif // RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_BACKTRACE_H_
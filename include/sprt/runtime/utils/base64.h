@@ -24,9 +24,21 @@
 #define RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_BASE64_H_
 
 #include <sprt/runtime/callback.h>
+#include <sprt/runtime/status.h>
 
 namespace sprt::base64 {
 
+enum class DecodeMode {
+	// Characters out of the alphabet and padding are skipped, standard and URL-safe
+	// characters are accepted together
+	Lenient,
+
+	// Only alphabet characters are accepted, '=' padding only at the end, unused bits of the
+	// last character should be zero. Padding is required for the standard alphabet and
+	// optional for URL-safe one
+	Strict,
+};
+
 SPRT_API constexpr inline size_t getEncodeSize(size_t l) {
 	constexpr int BinaryUnit = 3;
 	constexpr int Base64Unit = 4;
@@ -51,6 +63,58 @@ SPRT_API size_t decode(const char *in, size_t insize, uint8_t *out, size_t outsi
 SPRT_API size_t decode(const char *in, size_t insize,
 		const callback<void(const uint8_t *, size_t)> &);
 
+// Writes number of decoded bytes into `ret`, including the bytes, decoded before an error
+SPRT_API Status decode(const char *in, size_t insize, uint8_t *out, size_t outsize, size_t *ret,
+		DecodeMode);
+
+// Chunked encoder, writes directly into the caller's buffers
+class SPRT_API Encoder {
+public:
+	// Max number of chars, that `update` can write for the input size
+	static constexpr size_t getUpdateSize(size_t l) { return ((l + 2) / 3) * 4; }
+
+	Encoder(bool url = false) : _url(url) { }
+
+	// Encodes complete 3-byte groups, the rest is kept for the next call;
+	// output should have at least getUpdateSize(size) bytes
+	Status update(const uint8_t *, size_t, char *out, size_t outsize, size_t *ret);
+
+	// Writes the last group (up to 4 chars), padded for the standard alphabet;
+	// encoder is ready for the next stream after this
+	Status finalize(char *out, size_t outsize, size_t *ret);
+
+protected:
+	uint8_t _tail[2] = {0};
+	uint8_t _tailSize = 0;
+	bool _url = false;
+};
+
+// Chunked decoder, writes directly into the caller's buffers. After an error all subsequent
+// calls fail until `finalize`
+class SPRT_API Decoder {
+public:
+	// Max number of bytes, that `update` can write for the input size
+	static constexpr size_t getUpdateSize(size_t l) { return ((l + 3) / 4) * 3; }
+
+	Decoder(DecodeMode mode = DecodeMode::Lenient, bool url = false) : _mode(mode), _url(url) { }
+
+	// Output should have at least getUpdateSize(size) bytes
+	Status update(const char *, size_t, uint8_t *out, size_t outsize, size_t *ret);
+
+	// Decodes incomplete last group (up to 2 bytes) and checks padding in strict mode;
+	// decoder is ready for the next stream after this
+	Status finalize(uint8_t *out, size_t outsize, size_t *ret);
+
+protected:
+	uint32_t _accum = 0;
+	uint8_t _count = 0; // characters in the current group
+	uint8_t _padding = 0;
+	bool _finished = false; // padded group was decoded, no more data allowed in strict mode
+	bool _failed = false;
+	DecodeMode _mode = DecodeMode::Lenient;
+	bool _url = false;
+};
+
 } // namespace sprt::base64
 
 
@@ -64,7 +128,19 @@ SPRT_API size_t encode(const uint8_t *in, size_t insize, char *out, size_t outsi
 SPRT_API size_t encode(const uint8_t *in, size_t insize,
 		const callback<void(const char *, size_t)> &);
 
-using sprt::base64::decode;
+// Lenient decoding accepts both alphabets
+inline size_t decode(const char *in, size_t insize, uint8_t *out, size_t outsize) {
+	return base64::decode(in, insize, out, outsize);
+}
+
+inline size_t decode(const char *in, size_t insize,
+		const callback<void(const uint8_t *, size_t)> &cb) {
+	return base64::decode(in, insize, cb);
+}
+
+// Strict mode accepts only URL-safe alphabet
+SPRT_API Status decode(const char *in, size_t insize, uint8_t *out, size_t outsize, size_t *ret,
+		base64::DecodeMode);
 
 } // namespace sprt::base64url
 
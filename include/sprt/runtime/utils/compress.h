@@ -23,7 +23,15 @@
 #ifndef RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_COMPRESS_H_
 #define RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_COMPRESS_H_
 
-#include <sprt/runtime/init.h>
+#include <sprt/runtime/status.h>
+#include <sprt/runtime/callback.h>
+#include <sprt/runtime/dispatch/types.h>
+
+namespace sprt::dispatch {
+
+class ThreadPool;
+
+} // namespace sprt::dispatch
 
 namespace sprt {
 
@@ -40,6 +48,184 @@ SPRT_API size_t lz4hc_compressData(const uint8_t *src, size_t srcSize, uint8_t *
 SPRT_API size_t lz4_decompressData(const uint8_t *src, size_t srcSize, uint8_t *dest,
 		size_t destSize);
 
+
+// LZ4 frame format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md)
+
+enum class Lz4BlockSize : uint8_t {
+	Max64KB = 4,
+	Max256KB = 5,
+	Max1MB = 6,
+	Max4MB = 7,
+};
+
+enum class Lz4FrameFlags : uint32_t {
+	None = 0,
+
+	// Blocks can reference data of previous blocks; better ratio for small blocks,
+	// but blocks can not be compressed or decompressed in parallel
+	LinkedBlocks = 1 << 0,
+
+	BlockChecksum = 1 << 1, // xxh32 for every compressed block
+	ContentChecksum = 1 << 2, // xxh32 for the whole decompressed content
+	ContentSize = 1 << 3, // store content size in frame header
+};
+
+SPRT_DEFINE_ENUM_AS_MASK(Lz4FrameFlags);
+
+class Lz4Dictionary;
+
+struct SPRT_API Lz4FrameInfo {
+	Lz4FrameFlags flags = Lz4FrameFlags::BlockChecksum | Lz4FrameFlags::ContentChecksum;
+	Lz4BlockSize blockSize = Lz4BlockSize::Max64KB;
+
+	// 0 - fast LZ4, 1-12 - LZ4HC with compression level
+	int level = 0;
+
+	// stored in header with ContentSize flag, encoder fails if actual size is different
+	uint64_t contentSize = 0;
+
+	// dictionary should be valid until the end of compression
+	const Lz4Dictionary *dictionary = nullptr;
+};
+
+// Dictionary improves compression of many small similar payloads (like IPC messages),
+// when every payload compressed separately. Only last 64KB of dictionary is used by LZ4.
+class SPRT_API Lz4Dictionary {
+public:
+	static constexpr size_t MaxSize = 64 * 1'024;
+
+	// Builds dictionary from samples of typical payloads: selects segments with the most frequent
+	// content, that covers samples best. Returns dictionary size, written into `dict`.
+	static size_t train(uint8_t *dict, size_t dictCapacity, const uint8_t *const samples[],
+			const size_t sampleSizes[], size_t count);
+
+	~Lz4Dictionary();
+
+	// Dictionary data is copied; zero id is replaced with xxh32 of data
+	Lz4Dictionary(const uint8_t *, size_t, uint32_t id = 0);
+
+	Lz4Dictionary(const Lz4Dictionary &) = delete;
+	Lz4Dictionary &operator=(const Lz4Dictionary &) = delete;
+
+	uint32_t getId() const { return _id; }
+	const uint8_t *getData() const { return _data; }
+	size_t getSize() const { return _size; }
+
+	// Prepared LZ4 stream for LZ4_attach_dictionary
+	const void *getStream() const { return _stream; }
+
+	// Prepared LZ4HC stream for LZ4_attach_HC_dictionary, created on first use for every level
+	const void *getStreamHC(int level) const;
+
+protected:
+	static constexpr int MaxLevel = 12;
+
+	uint8_t *_data = nullptr;
+	size_t _size = 0;
+	uint32_t _id = 0;
+	void *_stream = nullptr;
+	mutable void *_streamHC[MaxLevel] = {nullptr};
+};
+
+// Streaming frame compressor; output callback receives frame parts, when they are ready
+class SPRT_API Lz4Encoder {
+public:
+	using OutputCallback = callback<void(const uint8_t *, size_t)>;
+
+	~Lz4Encoder();
+
+	Lz4Encoder(const Lz4FrameInfo & = Lz4FrameInfo());
+
+	Lz4Encoder(const Lz4Encoder &) = delete;
+	Lz4Encoder &operator=(const Lz4Encoder &) = delete;
+
+	Status update(const uint8_t *, size_t, const OutputCallback &);
+
+	// Writes last block, end mark and checksum; encoder is ready for the next frame after this
+	Status finalize(const OutputCallback &);
+
+	const Lz4FrameInfo &getInfo() const;
+
+protected:
+	struct Data;
+
+	Data *_data = nullptr;
+};
+
+// Streaming frame decompressor; skippable frames are ignored
+class SPRT_API Lz4Decoder {
+public:
+	using OutputCallback = callback<void(const uint8_t *, size_t)>;
+
+	~Lz4Decoder();
+
+	// Dictionary is required to decode frames with dictionary id
+	Lz4Decoder(const Lz4Dictionary * = nullptr);
+
+	Lz4Decoder(const Lz4Decoder &) = delete;
+	Lz4Decoder &operator=(const Lz4Decoder &) = delete;
+
+	// Returns Status::Ok when more data is required, Status::Done when frame is finished;
+	// `consumed` receives number of bytes, used from input, data after frame end is not consumed.
+	// Decoder is ready for the next frame after Status::Done
+	Status update(const uint8_t *, size_t, const OutputCallback &, size_t *consumed = nullptr);
+
+	// Frame info, available after frame header was decoded
+	const Lz4FrameInfo &getInfo() const;
+
+protected:
+	struct Data;
+
+	Data *_data = nullptr;
+};
+
+// Parallel frame compressor for large buffers: data is split into independent blocks, that can be
+// compressed in any thread, then frame is assembled with `write`. LinkedBlocks flag is ignored.
+class SPRT_API Lz4ParallelEncoder {
+public:
+	using OutputCallback = callback<void(const uint8_t *, size_t)>;
+
+	~Lz4ParallelEncoder();
+
+	// Data should be valid until frame is written
+	Lz4ParallelEncoder(const uint8_t *, size_t, const Lz4FrameInfo & = Lz4FrameInfo());
+
+	Lz4ParallelEncoder(const Lz4ParallelEncoder &) = delete;
+	Lz4ParallelEncoder &operator=(const Lz4ParallelEncoder &) = delete;
+
+	size_t getBlockCount() const;
+
+	// Can be called concurrently for different blocks
+	Status compressBlock(size_t);
+
+	// Size of the complete frame, all blocks should be compressed
+	size_t getFrameSize() const;
+
+	// All blocks should be compressed
+	Status write(const OutputCallback &) const;
+
+protected:
+	struct Data;
+
+	Data *_data = nullptr;
+};
+
+// One-shot frame functions; return 0 on failure
+SPRT_API size_t lz4_getFrameBounds(size_t size, const Lz4FrameInfo & = Lz4FrameInfo());
+
+SPRT_API size_t lz4_compressFrame(const uint8_t *src, size_t srcSize, uint8_t *dest,
+		size_t destSize, const Lz4FrameInfo & = Lz4FrameInfo());
+
+SPRT_API size_t lz4_decompressFrame(const uint8_t *src, size_t srcSize, uint8_t *dest,
+		size_t destSize, const Lz4Dictionary * = nullptr);
+
+// Compresses the large buffer into LZ4 frame on pool's workers with Lz4ParallelEncoder:
+// independent blocks are compressed in parallel, frame is decodable by any LZ4 decoder.
+// Data should be valid until callback is called with the pool's complete interface;
+// frame data is valid only within the callback.
+SPRT_API Status lz4_performCompress(dispatch::ThreadPool &, BytesView data, const Lz4FrameInfo &,
+		dispatch::Function<void(Status, BytesView)> &&, Ref * = nullptr);
+
 } // namespace sprt
 
 #endif // RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_COMPRESS_H_
@@ -0,0 +1,50 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#ifndef RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_TREE_HASH_H_
+#define RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_TREE_HASH_H_
+
+#include <sprt/runtime/hash.h>
+#include <sprt/runtime/dispatch/types.h>
+
+namespace sprt::dispatch {
+
+class ThreadPool;
+
+} // namespace sprt::dispatch
+
+namespace sprt::sha256 {
+
+constexpr static size_t TreeHashChunkSize = 1 << 20;
+
+// Computes SHA-256 tree hash of the large buffer on pool's workers: data is split into chunks
+// of `chunkSize` bytes, that are hashed in parallel, root is SHA-256 of concatenated chunk
+// digests. Root is NOT equal to plain SHA-256 of the data.
+// Data should be valid until callback is called with the pool's complete interface;
+// callback receives root digest or ErrorCancelled if pool was cancelled.
+SPRT_API Status performTreeHash(dispatch::ThreadPool &, BytesView data,
+		dispatch::Function<void(Status, BytesView)> &&, size_t chunkSize = TreeHashChunkSize,
+		Ref * = nullptr);
+
+} // namespace sprt::sha256
+
+#endif /* RUNTIME_INCLUDE_SPRT_RUNTIME_UTILS_TREE_HASH_H_ */
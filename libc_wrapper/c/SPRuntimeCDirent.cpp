@@ -38,6 +38,12 @@ THE SOFTWARE.
 
 #include <dirent.h>
 
+#if __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64
+#include <sprt/c/cross/__sprt_syscall.h>
+
+__SPRT_C_FUNC long int syscall(long int __sysno, ...);
+#endif
+
 static_assert(sizeof(struct dirent) == sizeof(struct __SPRT_DIRENT_NAME));
 
 namespace sprt {
@@ -164,4 +170,16 @@ __SPRT_C_FUNC int __SPRT_ID(scandirat)(int __dir_fd, const char *path,
 #endif
 }
 
+__SPRT_C_FUNC __SPRT_ID(ssize_t)
+		__SPRT_ID(getdents64)(int __dir_fd, void *__buf, __SPRT_ID(size_t) __nbytes) {
+#if __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64
+	return (__SPRT_ID(ssize_t))syscall(__SPRT_SYSCALL_getdents64, __dir_fd, __buf, __nbytes);
+#else
+	oslog::vprint(oslog::LogType::Info, __SPRT_LOCATION, "rt-libc", __SPRT_FUNCTION__,
+			" not available for this platform (__SPRT_CONFIG_HAVE_DIRENT_GETDENTS64)");
+	*__sprt___errno_location() = ENOSYS;
+	return -1;
+#endif
+}
+
 } // namespace sprt
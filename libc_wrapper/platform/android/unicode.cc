@@ -35,379 +35,12 @@ THE SOFTWARE.
 #include <sprt/c/__sprt_dirent.h>
 #include <sprt/c/__sprt_limits.h>
 
-#include "private/SPRTDso.h"
-
-#include <unicode/uchar.h>
-#include <unicode/urename.h>
-#include <unicode/ustring.h>
-
 #include <android/configuration.h>
 
 #include "private/SPRTPrivate.h"
 
 namespace sprt::unicode {
 
-static qmutex s_collatorMutex;
-
-namespace icujava {
-
-char32_t tolower(jni::App *app, char32_t c) {
-	return app->UCharacter.toLowerChar(app->UCharacter.getClass().ref(), jint(c));
-}
-
-char32_t toupper(jni::App *app, char32_t c) {
-	return app->UCharacter.toUpperChar(app->UCharacter.getClass().ref(), jint(c));
-}
-
-char32_t totitle(jni::App *app, char32_t c) {
-	return app->UCharacter.toTitleChar(app->UCharacter.getClass().ref(), jint(c));
-}
-
-bool toupper(jni::App *app, const callback<void(StringView)> &cb, StringView data) {
-	auto env = jni::Env::getEnv();
-	auto ret =
-			app->UCharacter.toUpperString(app->UCharacter.getClass().ref(env), env.newString(data))
-					.getString();
-	cb(ret);
-	return true;
-}
-
-bool totitle(jni::App *app, const callback<void(StringView)> &cb, StringView data) {
-	auto env = jni::Env::getEnv();
-	auto ret = app->UCharacter
-					   .toTitleString(app->UCharacter.getClass().ref(env), env.newString(data),
-							   nullptr)
-					   .getString();
-	cb(ret);
-	return true;
-}
-
-bool tolower(jni::App *app, const callback<void(StringView)> &cb, StringView data) {
-	auto env = jni::Env::getEnv();
-	auto ret =
-			app->UCharacter.toLowerString(app->UCharacter.getClass().ref(env), env.newString(data))
-					.getString();
-	cb(ret);
-	return true;
-}
-
-bool toupper(jni::App *app, const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto env = jni::Env::getEnv();
-	auto ret =
-			app->UCharacter.toUpperString(app->UCharacter.getClass().ref(env), env.newString(data))
-					.getWideString();
-	cb(ret);
-	return true;
-}
-
-bool totitle(jni::App *app, const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto env = jni::Env::getEnv();
-	auto ret = app->UCharacter
-					   .toTitleString(app->UCharacter.getClass().ref(env), env.newString(data),
-							   nullptr)
-					   .getWideString();
-	cb(ret);
-	return true;
-}
-
-bool tolower(jni::App *app, const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto env = jni::Env::getEnv();
-	auto ret =
-			app->UCharacter.toLowerString(app->UCharacter.getClass().ref(env), env.newString(data))
-					.getWideString();
-	cb(ret);
-	return true;
-}
-
-bool compare(jni::App *app, StringView l, StringView r, bool caseInsensetive, int *result) {
-	auto env = jni::Env::getEnv();
-
-	auto strL = env.newString(l);
-	auto strR = env.newString(r);
-
-	auto coll = app->Collator.getInstance(app->Collator.getClass().ref(env));
-	if (coll) {
-		unique_lock lock(s_collatorMutex);
-		app->Collator.setStrength(coll,
-				jint(caseInsensetive ? app->Collator.SECONDARY() : app->Collator.TERTIARY()));
-		*result = app->Collator._compare(coll, strL, strR);
-		return true;
-	}
-	return false;
-}
-
-bool compare(jni::App *app, WideStringView l, WideStringView r, bool caseInsensetive, int *result) {
-	auto env = jni::Env::getEnv();
-
-	auto strL = env.newString(l);
-	auto strR = env.newString(r);
-
-	auto coll = app->Collator.getInstance(app->Collator.getClass().ref(env));
-	if (coll) {
-		unique_lock lock(s_collatorMutex);
-		app->Collator.setStrength(coll,
-				jint(caseInsensetive ? app->Collator.SECONDARY() : app->Collator.TERTIARY()));
-		*result = app->Collator._compare(coll, strL, strR);
-		return true;
-	}
-	return false;
-}
-
-} // namespace icujava
-
-using cmp_fn = int32_t (*)(const char16_t *s1, int32_t length1, const char16_t *s2, int32_t length2,
-		int8_t codePointOrder);
-using case_cmp_fn = int32_t (*)(const char16_t *s1, int32_t length1, const char16_t *s2,
-		int32_t length2, uint32_t options, int *pErrorCode);
-
-static Dso s_icuNative;
-
-static int32_t (*tolower_fn)(int32_t) = nullptr;
-static int32_t (*toupper_fn)(int32_t) = nullptr;
-static int32_t (*totitle_fn)(int32_t) = nullptr;
-
-static int32_t (*strToLower_fn)(char16_t *dest, int32_t destCapacity, const char16_t *src,
-		int32_t srcLength, const char *locale, int *pErrorCode) = nullptr;
-
-static int32_t (*strToUpper_fn)(char16_t *dest, int32_t destCapacity, const char16_t *src,
-		int32_t srcLength, const char *locale, int *pErrorCode) = nullptr;
-
-static int32_t (*strToTitle_fn)(char16_t *dest, int32_t destCapacity, const char16_t *src,
-		int32_t srcLength, void *iter, const char *locale, int *pErrorCode) = nullptr;
-
-static cmp_fn u_strCompare = nullptr;
-static case_cmp_fn u_strCaseCompare = nullptr;
-
-char32_t tolower(char32_t c) {
-	if (s_icuNative) {
-		return char32_t(tolower_fn(int32_t(c)));
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::tolower(app, c);
-	}
-	return c;
-}
-
-char32_t toupper(char32_t c) {
-	if (s_icuNative) {
-		return char32_t(toupper_fn(int32_t(c)));
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::toupper(app, c);
-	}
-	return c;
-}
-
-char32_t totitle(char32_t c) {
-	if (s_icuNative) {
-		return char32_t(totitle_fn(int32_t(c)));
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::totitle(app, c);
-	}
-	return c;
-}
-
-bool toupper(const callback<void(StringView)> &cb, StringView data) {
-	if (s_icuNative) {
-		bool ret = false;
-		toUtf16([&](WideStringView uData) {
-			ret = toupper([&](WideStringView result) { toUtf8(cb, result); }, uData);
-		}, data);
-		if (ret) {
-			return ret;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::toupper(app, cb, data);
-	}
-	return false;
-}
-
-bool totitle(const callback<void(StringView)> &cb, StringView data) {
-	if (s_icuNative) {
-		bool ret = false;
-		toUtf16([&](WideStringView uData) {
-			ret = totitle([&](WideStringView result) { toUtf8(cb, result); }, uData);
-		}, data);
-		if (ret) {
-			return ret;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::totitle(app, cb, data);
-	}
-	return false;
-}
-
-bool tolower(const callback<void(StringView)> &cb, StringView data) {
-	if (s_icuNative) {
-		bool ret = false;
-		toUtf16([&](WideStringView uData) {
-			ret = tolower([&](WideStringView result) { toUtf8(cb, result); }, uData);
-		}, data);
-		if (ret) {
-			return ret;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::tolower(app, cb, data);
-	}
-	return false;
-}
-
-bool toupper(const callback<void(WideStringView)> &cb, WideStringView data) {
-	if (s_icuNative) {
-		__malloc_u16string str;
-		str.resize(data.size());
-
-		int status = 0;
-		size_t capacity = str.size();
-		auto ptr = str.data();
-
-		auto len = strToUpper_fn(ptr, capacity, data.data(), data.size(), nullptr, &status);
-		if (len <= int32_t(str.size())) {
-			str.resize(len);
-		} else {
-			capacity = len;
-			str.resize(capacity);
-			ptr = str.data();
-			strToUpper_fn(ptr, capacity, data.data(), data.size(), nullptr, &status);
-		}
-		if (status == 0) {
-			cb(ptr);
-			return true;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::toupper(app, cb, data);
-	}
-	return false;
-}
-
-bool totitle(const callback<void(WideStringView)> &cb, WideStringView data) {
-	if (s_icuNative) {
-		__malloc_u16string str;
-		str.resize(data.size());
-
-		int status = 0;
-		size_t capacity = str.size();
-		auto ptr = str.data();
-
-		auto len =
-				strToTitle_fn(ptr, capacity, data.data(), data.size(), nullptr, nullptr, &status);
-		if (len <= int32_t(str.size())) {
-			str.resize(len);
-		} else {
-			capacity = len;
-			str.resize(capacity);
-			ptr = str.data();
-			strToTitle_fn(ptr, capacity, data.data(), data.size(), nullptr, nullptr, &status);
-		}
-		if (status == 0) {
-			cb(ptr);
-			return true;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::totitle(app, cb, data);
-	}
-	return false;
-}
-
-bool tolower(const callback<void(WideStringView)> &cb, WideStringView data) {
-	if (s_icuNative) {
-		__malloc_u16string str;
-		str.resize(data.size());
-
-		int status = 0;
-		size_t capacity = str.size();
-		auto ptr = str.data();
-
-		auto len = strToLower_fn(ptr, capacity, data.data(), data.size(), nullptr, &status);
-		if (len <= int32_t(str.size())) {
-			str.resize(len);
-		} else {
-			capacity = len;
-			str.resize(capacity);
-			ptr = str.data();
-			strToLower_fn(ptr, capacity, data.data(), data.size(), nullptr, &status);
-		}
-		if (status == 0) {
-			cb(ptr);
-			return true;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::tolower(app, cb, data);
-	}
-	return false;
-}
-
-bool compare(StringView l, StringView r, int *result) {
-	if (u_strCompare) {
-		bool ret = false;
-		unicode::toUtf16([&](WideStringView lStr) {
-			unicode::toUtf16([&](WideStringView rStr) {
-				int status = -1;
-				*result = u_strCompare(lStr.data(), lStr.size(), rStr.data(), rStr.size(), 1);
-				ret = status == U_ZERO_ERROR;
-			}, r);
-		}, l);
-		if (ret) {
-			return true;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::compare(app, l, r, false, result);
-	}
-	return false;
-}
-
-bool compare(WideStringView l, WideStringView r, int *result) {
-	if (u_strCompare) {
-		*result = u_strCompare(l.data(), l.size(), r.data(), r.size(), 1);
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::compare(app, l, r, false, result);
-	}
-	return false;
-}
-
-bool caseCompare(StringView l, StringView r, int *result) {
-	if (u_strCaseCompare) {
-		bool ret = false;
-		unicode::toUtf16([&](WideStringView lStr) {
-			unicode::toUtf16([&](WideStringView rStr) {
-				int status;
-				*result = u_strCaseCompare(lStr.data(), lStr.size(), rStr.data(), rStr.size(),
-						U_COMPARE_CODE_POINT_ORDER, &status);
-				ret = status == U_ZERO_ERROR;
-			}, r);
-		}, l);
-		if (ret) {
-			return true;
-		}
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::compare(app, l, r, true, result);
-	}
-	return false;
-}
-
-bool caseCompare(WideStringView l, WideStringView r, int *result) {
-	if (u_strCaseCompare) {
-		int status = 0;
-		*result = u_strCaseCompare(l.data(), l.size(), r.data(), r.size(),
-				U_COMPARE_CODE_POINT_ORDER, &status);
-		return true;
-	}
-	if (auto app = jni::Env::getApp()) {
-		return icujava::compare(app, l, r, true, result);
-	}
-	return false;
-}
-
 bool idnToAscii(const callback<void(StringView)> &cb, StringView source) {
 	if (source.empty()) {
 		return false;
@@ -749,28 +382,10 @@ bool initialize(sprt::AppConfig &&appcfg, int &resultCode) {
 		AConfiguration_getCountry(cfg, &s_globalConfig.localeBuf[3]);
 	}
 
-	unicode::s_icuNative = Dso("libicu.so");
-	if (unicode::s_icuNative) {
-		unicode::tolower_fn = unicode::s_icuNative.sym<decltype(unicode::tolower_fn)>("u_tolower");
-		unicode::toupper_fn = unicode::s_icuNative.sym<decltype(unicode::toupper_fn)>("u_toupper");
-		unicode::totitle_fn = unicode::s_icuNative.sym<decltype(unicode::totitle_fn)>("u_totitle");
-		unicode::strToLower_fn =
-				unicode::s_icuNative.sym<decltype(unicode::strToLower_fn)>("u_strToLower");
-		unicode::strToUpper_fn =
-				unicode::s_icuNative.sym<decltype(unicode::strToUpper_fn)>("u_strToUpper");
-		unicode::strToTitle_fn =
-				unicode::s_icuNative.sym<decltype(unicode::strToTitle_fn)>("u_strToTitle");
-
-		unicode::u_strCompare =
-				unicode::s_icuNative.sym<decltype(unicode::u_strCompare)>("u_strCompare");
-		unicode::u_strCaseCompare =
-				unicode::s_icuNative.sym<decltype(unicode::u_strCaseCompare)>("u_strCaseCompare");
-	}
-
 	return true;
 }
 
-void terminate() { unicode::s_icuNative.close(); }
+void terminate() { }
 
 memory::pool_t *getConfigPool() { return s_globalConfig._pool; }
 
@@ -47,245 +47,6 @@ extern "C" int _NSGetExecutablePath(char *buf, uint32_t *bufsize);
 
 namespace sprt::unicode {
 
-static char32_t convertChar(char32_t c, const callback<void(CFMutableStringRef, CFLocaleRef)> &cb) {
-	auto locale = CFLocaleCopyCurrent();
-	UniChar buf[4] = {0};
-	char32_t buf2[2];
-	auto num = unicode::utf16EncodeBuf((char16_t *)buf, 4, c);
-	auto str = CFStringCreateMutable(nullptr, 2);
-	CFStringAppendCharacters(str, buf, num);
-	cb(str, locale);
-	CFStringLowercase(str, locale);
-
-	auto bytes = CFStringGetCStringPtr(str, kCFStringEncodingUTF32);
-
-	if (bytes == nullptr) {
-		if (CFStringGetCString(str, (char *)buf2, 2 * sizeof(char32_t), kCFStringEncodingUTF32)) {
-			c = buf2[0];
-		}
-	} else {
-		c = ((char32_t *)bytes)[0];
-	}
-
-	CFRelease(str);
-	CFRelease(locale);
-	return c;
-}
-
-static CFMutableStringRef makeString(WideStringView str) {
-	auto ret = CFStringCreateMutable(nullptr, str.size());
-	CFStringAppendCharacters(ret, (UniChar *)str.data(), str.size());
-	return ret;
-}
-
-static CFMutableStringRef makeString(StringViewUtf8 str) {
-	auto ret = CFStringCreateMutable(nullptr, str.code_size());
-	UniChar buf[4] = {0};
-	str.foreach ([&](char32_t c) {
-		auto num = unicode::utf16EncodeBuf((char16_t *)buf, 4, c);
-		CFStringAppendCharacters(ret, buf, num);
-	});
-	return ret;
-}
-
-static bool toString(CFMutableStringRef str, const callback<void(StringView)> &cb) {
-	auto len = CFStringGetLength(str);
-	auto bytes = (const char *)CFStringGetCStringPtr(str, kCFStringEncodingUTF16);
-
-	if (bytes == nullptr) {
-		char32_t buf[len + 1];
-		if (CFStringGetCString(str, (char *)buf, len * sizeof(char32_t), kCFStringEncodingUTF16)) {
-			cb(StringView((char *)buf, len));
-			return true;
-		}
-	} else {
-		cb(StringView(bytes, len));
-		return true;
-	}
-	return false;
-}
-
-static bool toWideString(CFMutableStringRef str, const callback<void(WideStringView)> &cb) {
-	auto len = CFStringGetLength(str);
-	auto bytes = (const char16_t *)CFStringGetCStringPtr(str, kCFStringEncodingUTF16);
-
-	if (bytes == nullptr) {
-		char32_t buf[len + 1];
-		if (CFStringGetCString(str, (char *)buf, len * sizeof(char32_t), kCFStringEncodingUTF16)) {
-			cb(WideStringView((char16_t *)buf, len));
-			return true;
-		}
-	} else {
-		cb(WideStringView(bytes, len));
-		return true;
-	}
-	return false;
-}
-
-char32_t tolower(char32_t c) {
-	return convertChar(c, [](CFMutableStringRef str, CFLocaleRef locale) {
-		CFStringLowercase(str, locale); //
-	});
-}
-
-char32_t toupper(char32_t c) {
-	return convertChar(c, [](CFMutableStringRef str, CFLocaleRef locale) {
-		CFStringUppercase(str, locale); //
-	});
-}
-
-char32_t totitle(char32_t c) {
-	return convertChar(c, [](CFMutableStringRef str, CFLocaleRef locale) {
-		CFStringCapitalize(str, locale); //
-	});
-}
-
-bool toupper(const callback<void(StringView)> &cb, StringView data) {
-	auto locale = CFLocaleCopyCurrent();
-	auto str = makeString(data);
-
-	CFStringUppercase(str, locale);
-
-	auto ret = toString(str, cb);
-
-	CFRelease(str);
-	CFRelease(locale);
-	return ret;
-}
-bool totitle(const callback<void(StringView)> &cb, StringView data) {
-	auto locale = CFLocaleCopyCurrent();
-	auto str = makeString(data);
-
-	CFStringCapitalize(str, locale);
-
-	auto ret = toString(str, cb);
-
-	CFRelease(str);
-	CFRelease(locale);
-	return ret;
-}
-bool tolower(const callback<void(StringView)> &cb, StringView data) {
-	auto locale = CFLocaleCopyCurrent();
-	auto str = makeString(data);
-
-	CFStringLowercase(str, locale);
-
-	auto ret = toString(str, cb);
-
-	CFRelease(str);
-	CFRelease(locale);
-	return ret;
-}
-
-bool toupper(const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto locale = CFLocaleCopyCurrent();
-	auto str = makeString(data);
-
-	CFStringUppercase(str, locale);
-
-	auto ret = toWideString(str, cb);
-
-	CFRelease(str);
-	CFRelease(locale);
-	return ret;
-}
-bool totitle(const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto locale = CFLocaleCopyCurrent();
-	auto str = makeString(data);
-
-	CFStringCapitalize(str, locale);
-
-	auto ret = toWideString(str, cb);
-
-	CFRelease(str);
-	CFRelease(locale);
-	return ret;
-}
-bool tolower(const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto locale = CFLocaleCopyCurrent();
-	auto str = makeString(data);
-
-	CFStringLowercase(str, locale);
-
-	auto ret = toWideString(str, cb);
-
-	CFRelease(str);
-	CFRelease(locale);
-	return ret;
-}
-
-bool compare(StringView l, StringView r, int *res) {
-	if (!res) {
-		return false;
-	}
-
-	auto locale = CFLocaleCopyCurrent();
-	auto lstr = makeString(l);
-	auto rstr = makeString(r);
-
-	*res = CFStringCompareWithOptionsAndLocale(lstr, rstr, CFRangeMake(0, CFStringGetLength(lstr)),
-			kCFCompareLocalized, locale);
-
-	CFRelease(rstr);
-	CFRelease(lstr);
-	CFRelease(locale);
-	return true;
-}
-
-bool compare(WideStringView l, WideStringView r, int *res) {
-	if (!res) {
-		return false;
-	}
-
-	auto locale = CFLocaleCopyCurrent();
-	auto lstr = makeString(l);
-	auto rstr = makeString(r);
-
-	*res = CFStringCompareWithOptionsAndLocale(lstr, rstr, CFRangeMake(0, CFStringGetLength(lstr)),
-			kCFCompareLocalized, locale);
-
-	CFRelease(rstr);
-	CFRelease(lstr);
-	CFRelease(locale);
-	return true;
-}
-
-bool caseCompare(StringView l, StringView r, int *res) {
-	if (!res) {
-		return false;
-	}
-
-	auto locale = CFLocaleCopyCurrent();
-	auto lstr = makeString(l);
-	auto rstr = makeString(r);
-
-	*res = CFStringCompareWithOptionsAndLocale(lstr, rstr, CFRangeMake(0, CFStringGetLength(lstr)),
-			kCFCompareLocalized | kCFCompareCaseInsensitive, locale);
-
-	CFRelease(rstr);
-	CFRelease(lstr);
-	CFRelease(locale);
-	return true;
-}
-
-bool caseCompare(WideStringView l, WideStringView r, int *res) {
-	if (!res) {
-		return false;
-	}
-
-	auto locale = CFLocaleCopyCurrent();
-	auto lstr = makeString(l);
-	auto rstr = makeString(r);
-
-	*res = CFStringCompareWithOptionsAndLocale(lstr, rstr, CFRangeMake(0, CFStringGetLength(lstr)),
-			kCFCompareLocalized | kCFCompareCaseInsensitive, locale);
-
-	CFRelease(rstr);
-	CFRelease(lstr);
-	CFRelease(locale);
-	return true;
-}
-
 bool idnToAscii(const callback<void(StringView)> &cb, StringView source) {
 	UErrorCode err = U_ZERO_ERROR;
 	auto idna = uidna_openUTS46(UIDNA_CHECK_BIDI | UIDNA_NONTRANSITIONAL_TO_ASCII, &err);
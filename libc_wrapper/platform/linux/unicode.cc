@@ -23,16 +23,12 @@ THE SOFTWARE.
 #include <sprt/runtime/platform.h>
 #include <sprt/runtime/unicode.h>
 #include <sprt/runtime/utils/dso.h>
-#include <sprt/c/__sprt_locale.h>
 
-static constexpr sprt::uint32_t U_COMPARE_CODE_POINT_ORDER = 0x8000;
 static constexpr int U_ZERO_ERROR = 0;
-static constexpr int U_BUFFER_OVERFLOW_ERROR = 15;
 
 static constexpr int UIDNA_ERROR_EMPTY_LABEL = 1;
 
 using UErrorCode = int;
-using UBreakIterator = void;
 using UIDNA = void;
 
 struct UIDNAInfo {
@@ -42,85 +38,6 @@ struct UIDNAInfo {
 
 namespace sprt::unicode {
 
-struct unistring_iface {
-	using u8_case_fn = uint8_t *(*)(const uint8_t *s, size_t n, const char *iso639_language,
-			void *nf, uint8_t *resultbuf, size_t *lengthp);
-	using u16_case_fn = uint16_t *(*)(const uint16_t *s, size_t n, const char *iso639_language,
-			void *nf, uint16_t *resultbuf, size_t *lengthp);
-
-	int32_t (*tolower_fn)(int32_t) = nullptr;
-	int32_t (*toupper_fn)(int32_t) = nullptr;
-	int32_t (*totitle_fn)(int32_t) = nullptr;
-
-	const char *(*uc_locale_language)() = nullptr;
-
-	u8_case_fn u8_toupper = nullptr;
-	u8_case_fn u8_tolower = nullptr;
-	u8_case_fn u8_totitle = nullptr;
-
-	int (*u8_cmp2)(const uint8_t *s1, size_t n1, const uint8_t *s2, size_t n2) = nullptr;
-	int (*u8_casecoll)(const uint8_t *s1, size_t n1, const uint8_t *s2, size_t n2,
-			const char *iso639_language, void *nf, int *resultp) = nullptr;
-
-	u16_case_fn u16_toupper = nullptr;
-	u16_case_fn u16_tolower = nullptr;
-	u16_case_fn u16_totitle = nullptr;
-
-	int (*u16_cmp2)(const uint16_t *s1, size_t n1, const uint16_t *s2, size_t n2) = nullptr;
-	int (*u16_casecoll)(const uint16_t *s1, size_t n1, const uint16_t *s2, size_t n2,
-			const char *iso639_language, void *nf, int *resultp) = nullptr;
-
-	void load(Dso &handle) {
-		tolower_fn = handle.sym<decltype(tolower_fn)>("uc_tolower");
-		toupper_fn = handle.sym<decltype(toupper_fn)>("uc_toupper");
-		totitle_fn = handle.sym<decltype(totitle_fn)>("uc_totitle");
-
-		uc_locale_language = handle.sym<decltype(uc_locale_language)>("uc_locale_language");
-
-		u8_toupper = handle.sym<decltype(u8_toupper)>("u8_toupper");
-		u8_tolower = handle.sym<decltype(u8_tolower)>("u8_tolower");
-		u8_totitle = handle.sym<decltype(u8_totitle)>("u8_totitle");
-
-		u8_cmp2 = handle.sym<decltype(u8_cmp2)>("u8_cmp2");
-		u8_casecoll = handle.sym<decltype(u8_casecoll)>("u8_casecoll");
-
-		u16_toupper = handle.sym<decltype(u16_toupper)>("u16_toupper");
-		u16_tolower = handle.sym<decltype(u16_tolower)>("u16_tolower");
-		u16_totitle = handle.sym<decltype(u16_totitle)>("u16_totitle");
-
-		u16_cmp2 = handle.sym<decltype(u16_cmp2)>("u16_cmp2");
-		u16_casecoll = handle.sym<decltype(u16_casecoll)>("u16_casecoll");
-	}
-
-	explicit operator bool() const {
-		return uc_locale_language && tolower_fn && toupper_fn && totitle_fn && u8_toupper
-				&& u8_tolower && u8_totitle && u8_cmp2 && u8_casecoll && u16_toupper && u16_tolower
-				&& u16_totitle && u16_cmp2 && u16_casecoll;
-	}
-
-	void clear() {
-		tolower_fn = nullptr;
-		toupper_fn = nullptr;
-		totitle_fn = nullptr;
-
-		uc_locale_language = nullptr;
-
-		u8_toupper = nullptr;
-		u8_tolower = nullptr;
-		u8_totitle = nullptr;
-
-		u8_cmp2 = nullptr;
-		u8_casecoll = nullptr;
-
-		u16_toupper = nullptr;
-		u16_tolower = nullptr;
-		u16_totitle = nullptr;
-
-		u16_cmp2 = nullptr;
-		u16_casecoll = nullptr;
-	}
-};
-
 struct idn2_iface {
 	enum flags {
 		IDN2_NFC_INPUT = 1,
@@ -165,27 +82,6 @@ struct icu_iface {
 		UIDNA_CHECK_CONTEXTO = 0x40
 	};
 
-	using case_fn = int32_t (*)(char16_t *dest, int32_t destCapacity, const char16_t *src,
-			int32_t srcLength, const char *locale, UErrorCode *pErrorCode);
-	using case_iter_fn = int32_t (*)(char16_t *dest, int32_t destCapacity, const char16_t *src,
-			int32_t srcLength, UBreakIterator *iter, const char *locale, UErrorCode *pErrorCode);
-
-	using cmp_fn = int32_t (*)(const char16_t *s1, int32_t length1, const char16_t *s2,
-			int32_t length2, int8_t codePointOrder);
-	using case_cmp_fn = int32_t (*)(const char16_t *s1, int32_t length1, const char16_t *s2,
-			int32_t length2, uint32_t options, UErrorCode *pErrorCode);
-
-	int32_t (*tolower_fn)(int32_t) = nullptr;
-	int32_t (*toupper_fn)(int32_t) = nullptr;
-	int32_t (*totitle_fn)(int32_t) = nullptr;
-
-	case_fn u_strToLower_fn = nullptr;
-	case_fn u_strToUpper_fn = nullptr;
-	case_iter_fn u_strToTitle_fn = nullptr;
-
-	cmp_fn u_strCompare_fn = nullptr;
-	case_cmp_fn u_strCaseCompare_fn = nullptr;
-
 	const char *(*u_errorName_fn)(UErrorCode code) = nullptr;
 
 	UIDNA *(*uidna_openUTS46_fn)(uint32_t options, UErrorCode *pErrorCode) = nullptr;
@@ -217,23 +113,6 @@ struct icu_iface {
 	}
 
 	void load(Dso &handle, StringView verSuffix) {
-		tolower_fn =
-				reinterpret_cast<decltype(tolower_fn)>(loadIcu(handle, "u_tolower", verSuffix));
-		toupper_fn =
-				reinterpret_cast<decltype(toupper_fn)>(loadIcu(handle, "u_toupper", verSuffix));
-		totitle_fn =
-				reinterpret_cast<decltype(totitle_fn)>(loadIcu(handle, "u_totitle", verSuffix));
-		u_strToLower_fn = reinterpret_cast<decltype(u_strToLower_fn)>(
-				loadIcu(handle, "u_strToLower", verSuffix));
-		u_strToUpper_fn = reinterpret_cast<decltype(u_strToUpper_fn)>(
-				loadIcu(handle, "u_strToUpper", verSuffix));
-		u_strToTitle_fn = reinterpret_cast<decltype(u_strToTitle_fn)>(
-				loadIcu(handle, "u_strToTitle", verSuffix));
-		u_strCompare_fn = reinterpret_cast<decltype(u_strCompare_fn)>(
-				loadIcu(handle, "u_strCompare", verSuffix));
-		u_strCaseCompare_fn = reinterpret_cast<decltype(u_strCaseCompare_fn)>(
-				loadIcu(handle, "u_strCaseCompare", verSuffix));
-
 		u_errorName_fn = reinterpret_cast<decltype(u_errorName_fn)>(
 				loadIcu(handle, "u_errorName", verSuffix));
 		uidna_openUTS46_fn = reinterpret_cast<decltype(uidna_openUTS46_fn)>(
@@ -252,22 +131,12 @@ struct icu_iface {
 	}
 
 	explicit operator bool() const {
-		return tolower_fn && toupper_fn && totitle_fn && u_strToLower_fn && u_strToUpper_fn
-				&& u_strToTitle_fn && u_strCompare_fn && u_strCaseCompare_fn && u_errorName_fn
-				&& uidna_openUTS46_fn && uidna_close_fn && uidna_labelToASCII_UTF8_fn
+		return u_errorName_fn && uidna_openUTS46_fn && uidna_close_fn && uidna_labelToASCII_UTF8_fn
 				&& uidna_labelToUnicodeUTF8_fn && uidna_nameToASCII_UTF8_fn
 				&& uidna_nameToUnicodeUTF8_fn;
 	}
 
 	void clear() {
-		tolower_fn = nullptr;
-		toupper_fn = nullptr;
-		totitle_fn = nullptr;
-		u_strToLower_fn = nullptr;
-		u_strToUpper_fn = nullptr;
-		u_strToTitle_fn = nullptr;
-		u_strCompare_fn = nullptr;
-		u_strCaseCompare_fn = nullptr;
 		u_errorName_fn = nullptr;
 		uidna_openUTS46_fn = nullptr;
 		uidna_close_fn = nullptr;
@@ -285,35 +154,15 @@ struct i18n {
 	}
 
 	i18n() {
-		// try unistring
-		// try version 0 or 1 if no general symlink
-		_handle = Dso("libunistring.so");
-		if (!_handle) {
-			_handle = Dso("libunistring.so.1");
-		}
-		if (!_handle) {
-			_handle = Dso("libunistring.so.0");
-		}
-		if (_handle) {
-			unistring.load(_handle);
-			if (unistring) {
-				_idnHandle = Dso("libidn2.so");
-				if (_idnHandle) {
-					idn2.load(_idnHandle);
-					if (!idn2) {
-						idn2.clear();
-						_idnHandle.close();
-					}
-				}
-
-				// We have to set locale for unistring to work
-				auto loc = sprt::platform::getOsLocale();
-				__sprt_setlocale(__SPRT_LC_ALL, loc.data());
+		// libidn2 is preferred, ICU is used when it's not available
+		_idnHandle = Dso("libidn2.so");
+		if (_idnHandle) {
+			idn2.load(_idnHandle);
+			if (idn2) {
 				return;
-			} else {
-				unistring.clear();
-				_handle.close();
 			}
+			idn2.clear();
+			_idnHandle.close();
 		}
 
 		// try ICU
@@ -353,350 +202,25 @@ struct i18n {
 				_handle.close();
 			}
 		}
-
-		if (!icu) {
-			_idnHandle = Dso("libidn2.so");
-			if (_idnHandle) {
-				idn2.load(_idnHandle);
-				if (!idn2) {
-					idn2.clear();
-					_idnHandle.close();
-				}
-			}
-		}
 	}
 
 	~i18n() { }
 
-	char32_t tolower(char32_t c) {
-		return _handle
-				? char32_t(icu ? icu.tolower_fn(int32_t(c)) : unistring.tolower_fn(int32_t(c)))
-				: 0;
-	}
-
-	char32_t toupper(char32_t c) {
-		return _handle
-				? char32_t(icu ? icu.toupper_fn(int32_t(c)) : unistring.toupper_fn(int32_t(c)))
-				: 0;
-	}
-
-	char32_t totitle(char32_t c) {
-		return _handle
-				? char32_t(icu ? icu.totitle_fn(int32_t(c)) : unistring.totitle_fn(int32_t(c)))
-				: 0;
-	}
-
-	bool applyIcuFunction(const callback<void(WideStringView)> &cb, WideStringView data,
-			icu_iface::case_fn icuFn) {
-		bool ret = false;
-
-		UErrorCode status = U_ZERO_ERROR;
-		auto len = icuFn(nullptr, 0, data.data(), data.size(), nullptr, &status);
-		if (status != U_ZERO_ERROR && status != U_BUFFER_OVERFLOW_ERROR) {
-			__sprt_perror(icu.u_errorName_fn(status));
-			return false;
-		}
-
-		status = U_ZERO_ERROR;
-
-		auto targetBuf = __sprt_typed_malloca(char16_t, len + 1);
-		len = icuFn(targetBuf, len + 1, data.data(), data.size(), nullptr, &status);
-		if (len <= int32_t(len)) {
-			cb(WideStringView(targetBuf, len));
-			ret = true;
-		}
-		__sprt_freea(targetBuf);
-		return ret;
-	}
-
-	bool applyUnistringFunction(const callback<void(StringView)> &cb, StringView data,
-			unistring_iface::u8_case_fn ustrFn) {
-		bool ret = false;
-		size_t targetSize = data.size();
-		auto targetBuf = __sprt_typed_malloca(char, data.size() + 1);
-
-		auto buf = ustrFn((const uint8_t *)data.data(), data.size(), unistring.uc_locale_language(),
-				nullptr, (uint8_t *)targetBuf, &targetSize);
-		if (targetSize > data.size() + 1) {
-			cb(StringView((const char *)buf, targetSize));
-			::__sprt_free(buf);
-			ret = true;
-		} else {
-			cb(StringView((const char *)buf, targetSize));
-			ret = true;
-		}
-		__sprt_freea(targetBuf);
-		return ret;
-	}
-
-	bool applyUnistringFunction(const callback<void(WideStringView)> &cb, WideStringView data,
-			unistring_iface::u16_case_fn ustrFn) {
-		bool ret = false;
-		size_t targetSize = data.size();
-		auto targetBuf = __sprt_typed_malloca(char16_t, data.size() + 1);
-
-		auto buf = ustrFn((const uint16_t *)data.data(), data.size(),
-				unistring.uc_locale_language(), nullptr, (uint16_t *)targetBuf, &targetSize);
-		if (targetSize > data.size() + 1) {
-			cb(WideStringView((const char16_t *)buf, targetSize));
-			::__sprt_free(buf);
-			ret = true;
-		} else {
-			cb(WideStringView((const char16_t *)buf, targetSize));
-			ret = true;
-		}
-		__sprt_freea(targetBuf);
-		return ret;
-	}
-
-	auto applyFunction(const callback<void(StringView)> &cb, StringView data,
-			icu_iface::case_fn icuFn, unistring_iface::u8_case_fn ustrFn) {
-		bool ret = false;
-		if (icuFn) {
-			unicode::toUtf16([&](WideStringView str) {
-				applyIcuFunction([&](WideStringView result) {
-					unicode::toUtf8([&](StringView out) {
-						cb(out);
-						ret = true;
-					}, result);
-				}, str, icuFn);
-			}, data);
-		} else if (ustrFn) {
-			return applyUnistringFunction(cb, data, ustrFn);
-		}
-		return ret;
-	}
-
-	auto applyFunction(const callback<void(WideStringView)> &cb, WideStringView data,
-			icu_iface::case_fn icuFn, unistring_iface::u16_case_fn ustrFn) {
-		if (icuFn) {
-			return applyIcuFunction(cb, data, icuFn);
-		} else if (ustrFn) {
-			return applyUnistringFunction(cb, data, ustrFn);
-		}
-		return false;
-	}
-
-	bool tolower(const callback<void(StringView)> &cb, StringView data) {
-		return applyFunction(cb, data, icu.u_strToLower_fn, unistring.u8_tolower);
-	}
-
-	bool tolower(const callback<void(WideStringView)> &cb, WideStringView data) {
-		return applyFunction(cb, data, icu.u_strToLower_fn, unistring.u16_tolower);
-	}
-
-	bool toupper(const callback<void(StringView)> &cb, StringView data) {
-		return applyFunction(cb, data, icu.u_strToUpper_fn, unistring.u8_toupper);
-	}
-
-	bool toupper(const callback<void(WideStringView)> &cb, WideStringView data) {
-		return applyFunction(cb, data, icu.u_strToUpper_fn, unistring.u16_toupper);
-	}
-
-	auto totitle(const callback<void(StringView)> &cb, StringView data) {
-		bool ret = false;
-		if (icu.u_strToTitle_fn) {
-			unicode::toUtf16([&](WideStringView str) {
-				totitle([&](WideStringView result) {
-					unicode::toUtf8([&](StringView out) {
-						cb(out);
-						ret = true;
-					}, result);
-				}, str);
-			}, data);
-		} else if (unistring.u8_totitle) {
-			return applyUnistringFunction(cb, data, unistring.u8_totitle);
-		}
-		return ret;
-	}
-
-	bool totitle(const callback<void(WideStringView)> &cb, WideStringView data) {
-		if (icu.u_strToTitle_fn) {
-			bool ret = false;
-			UErrorCode status = U_ZERO_ERROR;
-			auto len = icu.u_strToTitle_fn(nullptr, 0, data.data(), data.size(), nullptr, nullptr,
-					&status);
-			if (status != U_ZERO_ERROR && status != U_BUFFER_OVERFLOW_ERROR) {
-				__sprt_perror(icu.u_errorName_fn(status));
-				return false;
-			}
-
-			auto targetBuf = __sprt_typed_malloca(char16_t, len + 1);
-			status = U_ZERO_ERROR;
-
-			len = icu.u_strToTitle_fn(targetBuf, len + 1, data.data(), data.size(), nullptr,
-					nullptr, &status);
-			if (len <= int32_t(data.size())) {
-				cb(WideStringView(targetBuf, len));
-				ret = true;
-			}
-			__sprt_freea(targetBuf);
-			return ret;
-		} else if (unistring.u16_totitle) {
-			return applyUnistringFunction(cb, data, unistring.u16_totitle);
-		}
-
-		return false;
-	}
-
-	bool compare(StringView l, StringView r, int *result) {
-		if (!result) {
-			return false;
-		}
-
-		if (unistring.u8_cmp2) {
-			return unistring.u8_cmp2((const uint8_t *)l.data(), l.size(), (const uint8_t *)r.data(),
-					r.size());
-		} else if (icu.u_strCompare_fn) {
-			bool ret = false;
-			unicode::toUtf16([&](WideStringView lStr) {
-				unicode::toUtf16([&](WideStringView rStr) {
-					*result = icu.u_strCompare_fn(lStr.data(), lStr.size(), rStr.data(),
-							rStr.size(), 1);
-					ret = true;
-				}, r);
-			}, l);
-			return ret;
-		}
-		return false;
-	}
-
-	bool compare(WideStringView l, WideStringView r, int *result) {
-		if (!result) {
-			return false;
-		}
-
-		if (unistring.u16_cmp2) {
-			*result = unistring.u16_cmp2((const uint16_t *)l.data(), l.size(),
-					(const uint16_t *)r.data(), r.size());
-			return true;
-		} else if (icu.u_strCompare_fn) {
-			*result = icu.u_strCompare_fn(l.data(), l.size(), r.data(), r.size(), 1);
-			return true;
-		}
-		return false;
-	}
-	bool caseCompare(StringView l, StringView r, int *result) {
-		if (!result) {
-			return false;
-		}
-
-		if (unistring.u8_casecoll) {
-			int ret = 0;
-			auto lang = unistring.uc_locale_language();
-			auto err = unistring.u8_casecoll((const uint8_t *)l.data(), l.size() + 1,
-					(const uint8_t *)r.data(), r.size() + 1, lang, nullptr, &ret);
-			if (err == 0) {
-				*result = ret;
-				return true;
-			} else {
-				auto st = status::errnoToStatus(__sprt_errno);
-				status::getStatusDescription(st, [](StringView str) {
-					__sprt_fwrite(str.data(), str.size(), 1, __sprt_stdout_impl());
-				});
-				__sprt_fwrite("\n", 1, 1, __sprt_stdout_impl());
-			}
-		} else if (icu.u_strCaseCompare_fn) {
-			bool ret = false;
-			unicode::toUtf16([&](WideStringView lStr) {
-				unicode::toUtf16([&](WideStringView rStr) {
-					UErrorCode status = U_ZERO_ERROR;
-					*result = icu.u_strCaseCompare_fn(lStr.data(), lStr.size(), rStr.data(),
-							rStr.size(), U_COMPARE_CODE_POINT_ORDER, &status);
-					ret = status == U_ZERO_ERROR;
-				}, r);
-			}, l);
-			return ret;
-		}
-		return false;
-	}
-
-	bool caseCompare(WideStringView l, WideStringView r, int *result) {
-		if (!result) {
-			return false;
-		}
-
-		if (unistring.u16_casecoll) {
-			int ret = 0;
-			auto lang = unistring.uc_locale_language();
-			auto err = unistring.u16_casecoll((const uint16_t *)l.data(), l.size(),
-					(const uint16_t *)r.data(), r.size(), lang, nullptr, &ret);
-			if (err == 0) {
-				*result = ret;
-				return true;
-			} else {
-				auto st = status::errnoToStatus(__sprt_errno);
-				status::getStatusDescription(st, [](StringView str) {
-					__sprt_fwrite(str.data(), str.size(), 1, __sprt_stdout_impl());
-				});
-				__sprt_fwrite("\n", 1, 1, __sprt_stdout_impl());
-			}
-		} else if (icu.u_strCaseCompare_fn) {
-			UErrorCode status = U_ZERO_ERROR;
-			*result = icu.u_strCaseCompare_fn(l.data(), l.size(), r.data(), r.size(),
-					U_COMPARE_CODE_POINT_ORDER, &status);
-			return status == U_ZERO_ERROR;
-		}
-		return false;
-	}
-
 	icu_iface icu;
-	unistring_iface unistring;
 	idn2_iface idn2;
 
 	Dso _handle;
 	Dso _idnHandle;
 };
 
-static i18n *s_instance = i18n::getInstance();
-
-char32_t tolower(char32_t c) { return s_instance->tolower(c); }
-
-char32_t toupper(char32_t c) { return s_instance->toupper(c); }
-
-char32_t totitle(char32_t c) { return s_instance->totitle(c); }
-
-bool toupper(const callback<void(StringView)> &cb, StringView data) {
-	return s_instance->toupper(cb, data);
-}
-bool totitle(const callback<void(StringView)> &cb, StringView data) {
-	return s_instance->totitle(cb, data);
-}
-bool tolower(const callback<void(StringView)> &cb, StringView data) {
-	return s_instance->tolower(cb, data);
-}
-
-bool toupper(const callback<void(WideStringView)> &cb, WideStringView data) {
-	return s_instance->toupper(cb, data);
-}
-bool totitle(const callback<void(WideStringView)> &cb, WideStringView data) {
-	return s_instance->totitle(cb, data);
-}
-bool tolower(const callback<void(WideStringView)> &cb, WideStringView data) {
-	return s_instance->tolower(cb, data);
-}
-
-bool compare(StringView l, StringView r, int *result) { return s_instance->compare(l, r, result); }
-
-bool compare(WideStringView l, WideStringView r, int *result) {
-	return s_instance->compare(l, r, result);
-}
-
-bool caseCompare(StringView l, StringView r, int *result) {
-	return s_instance->caseCompare(l, r, result);
-}
-
-bool caseCompare(WideStringView l, WideStringView r, int *result) {
-	return s_instance->caseCompare(l, r, result);
-}
-
 bool idnToAscii(const callback<void(StringView)> &cb, StringView source) {
+	auto instance = i18n::getInstance();
 	uint8_t *out = nullptr;
-	if (s_instance->idn2) {
+	if (instance->idn2) {
 		int flags = idn2_iface::IDN2_NFC_INPUT | idn2_iface::IDN2_NONTRANSITIONAL;
-		int rc = s_instance->idn2.lookup_u8((const uint8_t *)source.data(), &out, flags);
+		int rc = instance->idn2.lookup_u8((const uint8_t *)source.data(), &out, flags);
 		if (rc != 0) {
-			rc = s_instance->idn2.lookup_u8((const uint8_t *)source.data(), &out,
+			rc = instance->idn2.lookup_u8((const uint8_t *)source.data(), &out,
 					idn2_iface::IDN2_TRANSITIONAL);
 		}
 
@@ -705,16 +229,16 @@ bool idnToAscii(const callback<void(StringView)> &cb, StringView source) {
 			::__sprt_free(out);
 			return true;
 		}
-	} else if (s_instance->icu) {
+	} else if (instance->icu) {
 		UErrorCode err = U_ZERO_ERROR;
-		auto idna = s_instance->icu.uidna_openUTS46_fn(
+		auto idna = instance->icu.uidna_openUTS46_fn(
 				icu_iface::UIDNA_CHECK_BIDI | icu_iface::UIDNA_NONTRANSITIONAL_TO_ASCII, &err);
 		if (err == U_ZERO_ERROR) {
 			UIDNAInfo info = {0, 0};
 			char buffer[1_KiB] = {0};
-			auto retLen = s_instance->icu.uidna_nameToASCII_UTF8_fn(idna, source.data(),
+			auto retLen = instance->icu.uidna_nameToASCII_UTF8_fn(idna, source.data(),
 					(int)source.size(), buffer, 1_KiB - 1, &info, &err);
-			s_instance->icu.uidna_close_fn(idna);
+			instance->icu.uidna_close_fn(idna);
 			if (retLen > 0 && err == 0 && !info.errors) {
 				cb(StringView(buffer, retLen));
 				return true;
@@ -725,24 +249,25 @@ bool idnToAscii(const callback<void(StringView)> &cb, StringView source) {
 }
 
 bool idnToUnicode(const callback<void(StringView)> &cb, StringView source) {
-	if (s_instance->idn2) {
+	auto instance = i18n::getInstance();
+	if (instance->idn2) {
 		char *out = nullptr;
-		auto err = s_instance->idn2.to_unicode_8z8z(source.data(), &out, 0);
+		auto err = instance->idn2.to_unicode_8z8z(source.data(), &out, 0);
 		if (err == 0) {
 			cb(StringView((const char *)out, ::__sprt_strlen((const char *)out)));
 			__sprt_free(out);
 			return true;
 		}
-	} else if (s_instance->icu) {
+	} else if (instance->icu) {
 		UErrorCode err = U_ZERO_ERROR;
-		auto idna = s_instance->icu.uidna_openUTS46_fn(
+		auto idna = instance->icu.uidna_openUTS46_fn(
 				icu_iface::UIDNA_CHECK_BIDI | icu_iface::UIDNA_NONTRANSITIONAL_TO_UNICODE, &err);
 		if (err == U_ZERO_ERROR) {
 			char buffer[1_KiB] = {0};
 			UIDNAInfo info = {0, 0};
-			auto retLen = s_instance->icu.uidna_nameToUnicodeUTF8_fn(idna, source.data(),
+			auto retLen = instance->icu.uidna_nameToUnicodeUTF8_fn(idna, source.data(),
 					(int)source.size(), buffer, 1_KiB - 1, &info, &err);
-			s_instance->icu.uidna_close_fn(idna);
+			instance->icu.uidna_close_fn(idna);
 			if (retLen > 0 && err == 0 && !info.errors) {
 				cb(StringView(buffer, retLen));
 				return true;
@@ -781,6 +306,7 @@ static int map_icu_to_idn2_error(UErrorCode u_error) {
 }
 
 extern "C" SPRT_GLOBAL int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupname, int flags) {
+	auto instance = unicode::i18n::getInstance();
 	if (!src) {
 		if (lookupname) {
 			*lookupname = nullptr;
@@ -788,8 +314,8 @@ extern "C" SPRT_GLOBAL int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupna
 		return IDN2_OK;
 	}
 
-	if (unicode::s_instance->idn2) {
-		return unicode::s_instance->idn2.lookup_u8(src, lookupname, flags);
+	if (instance->idn2) {
+		return instance->idn2.lookup_u8(src, lookupname, flags);
 	} else {
 		uint32_t options = unicode::icu_iface::UIDNA_CHECK_BIDI
 				| unicode::icu_iface::UIDNA_CHECK_CONTEXTJ
@@ -808,15 +334,15 @@ extern "C" SPRT_GLOBAL int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupna
 		}
 
 		UErrorCode err = U_ZERO_ERROR;
-		auto idna = unicode::s_instance->icu.uidna_openUTS46_fn(options, &err);
+		auto idna = instance->icu.uidna_openUTS46_fn(options, &err);
 		if (err == U_ZERO_ERROR) {
 			char *buffer = (char *)__sprt_malloc(DefaultBufferSize);
 
 			UIDNAInfo info = {0, 0};
-			unicode::s_instance->icu.uidna_nameToASCII_UTF8_fn(idna, (const char *)src,
+			instance->icu.uidna_nameToASCII_UTF8_fn(idna, (const char *)src,
 					sprt::strlen((const char *)src), buffer, DefaultBufferSize - 1, &info, &err);
 
-			unicode::s_instance->icu.uidna_close_fn(idna);
+			instance->icu.uidna_close_fn(idna);
 
 			if (err == U_ZERO_ERROR && info.errors == 0) {
 				if (lookupname) {
@@ -847,6 +373,7 @@ extern "C" SPRT_GLOBAL int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupna
 }
 
 extern "C" SPRT_GLOBAL int idn2_lookup_ul(const char *src, char **lookupname, int flags) {
+	auto instance = unicode::i18n::getInstance();
 	if (!src) {
 		if (lookupname) {
 			*lookupname = nullptr;
@@ -854,8 +381,8 @@ extern "C" SPRT_GLOBAL int idn2_lookup_ul(const char *src, char **lookupname, in
 		return IDN2_OK;
 	}
 
-	if (unicode::s_instance->idn2) {
-		return unicode::s_instance->idn2.lookup_ul(src, lookupname, flags);
+	if (instance->idn2) {
+		return instance->idn2.lookup_ul(src, lookupname, flags);
 	} else {
 		uint32_t options = unicode::icu_iface::UIDNA_CHECK_BIDI
 				| unicode::icu_iface::UIDNA_CHECK_CONTEXTJ
@@ -874,15 +401,15 @@ extern "C" SPRT_GLOBAL int idn2_lookup_ul(const char *src, char **lookupname, in
 		}
 
 		UErrorCode err = U_ZERO_ERROR;
-		auto idna = unicode::s_instance->icu.uidna_openUTS46_fn(options, &err);
+		auto idna = instance->icu.uidna_openUTS46_fn(options, &err);
 		if (err == U_ZERO_ERROR) {
 			char *buffer = (char *)__sprt_malloc(DefaultBufferSize);
 
 			UIDNAInfo info = {0, 0};
-			unicode::s_instance->icu.uidna_nameToASCII_UTF8_fn(idna, (const char *)src,
+			instance->icu.uidna_nameToASCII_UTF8_fn(idna, (const char *)src,
 					sprt::strlen((const char *)src), buffer, DefaultBufferSize - 1, &info, &err);
 
-			unicode::s_instance->icu.uidna_close_fn(idna);
+			instance->icu.uidna_close_fn(idna);
 
 			if (err == U_ZERO_ERROR && info.errors == 0) {
 				if (lookupname) {
@@ -913,6 +440,7 @@ extern "C" SPRT_GLOBAL int idn2_lookup_ul(const char *src, char **lookupname, in
 }
 
 extern "C" SPRT_GLOBAL int idn2_to_unicode_8z8z(const char *src, char **lookupname, int flags) {
+	auto instance = unicode::i18n::getInstance();
 	if (!src) {
 		if (lookupname) {
 			*lookupname = nullptr;
@@ -920,8 +448,8 @@ extern "C" SPRT_GLOBAL int idn2_to_unicode_8z8z(const char *src, char **lookupna
 		return IDN2_OK;
 	}
 
-	if (unicode::s_instance->idn2) {
-		return unicode::s_instance->idn2.lookup_ul(src, lookupname, flags);
+	if (instance->idn2) {
+		return instance->idn2.lookup_ul(src, lookupname, flags);
 	} else {
 		uint32_t options = unicode::icu_iface::UIDNA_CHECK_BIDI
 				| unicode::icu_iface::UIDNA_CHECK_CONTEXTJ
@@ -940,15 +468,15 @@ extern "C" SPRT_GLOBAL int idn2_to_unicode_8z8z(const char *src, char **lookupna
 		}
 
 		UErrorCode err = U_ZERO_ERROR;
-		auto idna = unicode::s_instance->icu.uidna_openUTS46_fn(options, &err);
+		auto idna = instance->icu.uidna_openUTS46_fn(options, &err);
 		if (err == U_ZERO_ERROR) {
 			char *buffer = (char *)__sprt_malloc(DefaultBufferSize);
 
 			UIDNAInfo info = {0, 0};
-			unicode::s_instance->icu.uidna_nameToUnicodeUTF8_fn(idna, (const char *)src,
+			instance->icu.uidna_nameToUnicodeUTF8_fn(idna, (const char *)src,
 					sprt::strlen((const char *)src), buffer, DefaultBufferSize - 1, &info, &err);
 
-			unicode::s_instance->icu.uidna_close_fn(idna);
+			instance->icu.uidna_close_fn(idna);
 
 			if (err == U_ZERO_ERROR && info.errors == 0) {
 				if (lookupname) {
@@ -979,14 +507,15 @@ extern "C" SPRT_GLOBAL int idn2_to_unicode_8z8z(const char *src, char **lookupna
 }
 
 extern "C" SPRT_GLOBAL const char *idn2_strerror(int rc) {
-	if (unicode::s_instance->idn2) {
-		return unicode::s_instance->idn2.strerror(rc);
-	} else if (unicode::s_instance->icu) {
+	auto instance = unicode::i18n::getInstance();
+	if (instance->idn2) {
+		return instance->idn2.strerror(rc);
+	} else if (instance->icu) {
 		switch (rc) {
 		case IDN2_OK: return "success"; break;
 		default:
 			if (rc < -1'000) {
-				return unicode::s_instance->icu.u_errorName_fn(UErrorCode(-rc - 1'000));
+				return instance->icu.u_errorName_fn(UErrorCode(-rc - 1'000));
 			} else {
 				return "processing error";
 			}
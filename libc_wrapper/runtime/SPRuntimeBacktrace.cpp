@@ -226,6 +226,33 @@ static void performBacktrace(State &state, size_t offset,
 	}
 }
 
+static size_t captureBacktrace(State &state, size_t offset, uintptr_t *buf, size_t count) {
+	return RtlCaptureStackBackTrace(DWORD(offset), DWORD(count), reinterpret_cast<PVOID *>(buf),
+			nullptr);
+}
+
+static void symbolizeBacktrace(State &state, const uintptr_t *pcs, size_t count,
+		const callback<void(uintptr_t, StringView)> &cb) {
+	unique_lock lock(state.mutex);
+
+	DWORD dwDisplacement;
+	StackFrameSym stackSym;
+
+	for (size_t i = 0; i < count; ++i) {
+		BOOL hasSym = FALSE;
+		BOOL hasLine = FALSE;
+
+		hasSym = state.SymGetSymFromAddr64(state.hProcess, pcs[i], nullptr, &stackSym.sym);
+		hasLine = state.SymGetLineFromAddr64(state.hProcess, pcs[i], &dwDisplacement,
+				&stackSym.line);
+
+		auto size = backtrace::detail::print(stackSym.targetNameBuffer, 1_KiB, pcs[i],
+				hasLine ? stackSym.line.FileName : nullptr, hasLine ? stackSym.line.LineNumber : 0,
+				hasSym ? stackSym.sym.Name : nullptr);
+		cb(pcs[i], StringView(stackSym.targetNameBuffer, size));
+	}
+}
+
 } // namespace sprt::backtrace::detail
 
 #else
@@ -248,6 +275,9 @@ typedef int (*backtrace_full_callback)(void *data, __SPRT_ID(uintptr_t) pc, cons
 extern "C" int backtrace_full(struct backtrace_state *state, int skip,
 		backtrace_full_callback callback, backtrace_error_callback error_callback, void *data);
 
+extern "C" int backtrace_pcinfo(struct backtrace_state *state, __SPRT_ID(uintptr_t) pc,
+		backtrace_full_callback callback, backtrace_error_callback error_callback, void *data);
+
 
 #endif
 
@@ -295,6 +325,48 @@ static void performBacktrace(State &state, size_t offset,
 			(void *)&cb);
 }
 
+struct UnwindData {
+	uintptr_t *buf;
+	size_t count;
+	size_t max;
+	size_t skip;
+};
+
+static _Unwind_Reason_Code debug_unwind_callback(struct _Unwind_Context *ctx, void *data) {
+	auto d = (UnwindData *)data;
+	if (d->skip > 0) {
+		--d->skip;
+		return _URC_NO_REASON;
+	}
+
+	if (d->count >= d->max) {
+		return _URC_END_OF_STACK;
+	}
+
+	auto pc = uintptr_t(_Unwind_GetIP(ctx));
+	if (pc == 0) {
+		return _URC_END_OF_STACK;
+	}
+
+	// return address points to the next instruction, use call instruction for lookup
+	d->buf[d->count++] = pc - 1;
+	return _URC_NO_REASON;
+}
+
+static size_t captureBacktrace(State &state, size_t offset, uintptr_t *buf, size_t count) {
+	UnwindData data{buf, 0, count, offset};
+	_Unwind_Backtrace(debug_unwind_callback, &data);
+	return data.count;
+}
+
+static void symbolizeBacktrace(State &state, const uintptr_t *pcs, size_t count,
+		const callback<void(uintptr_t, StringView)> &cb) {
+	for (size_t i = 0; i < count; ++i) {
+		backtrace_pcinfo(state.state, pcs[i], debug_backtrace_full_callback, debug_backtrace_error,
+				(void *)&cb);
+	}
+}
+
 } // namespace sprt::backtrace::detail
 
 #endif
@@ -312,6 +384,17 @@ struct BacktraceState {
 		}
 	}
 
+	size_t captureBacktrace(size_t offset, uintptr_t *buf, size_t count) {
+		return backtrace::detail::captureBacktrace(state, offset + 2, buf, count);
+	}
+
+	void symbolizeBacktrace(const uintptr_t *pcs, size_t count,
+			const callback<void(uintptr_t, StringView)> &cb) {
+		if (state) {
+			backtrace::detail::symbolizeBacktrace(state, pcs, count, cb);
+		}
+	}
+
 	backtrace::detail::State state;
 };
 
@@ -325,4 +408,13 @@ void getBacktrace(size_t offset, const callback<void(uintptr_t, StringView)> &cb
 	s_backtraceState.getBacktrace(offset + 1, cb);
 }
 
+size_t captureBacktrace(size_t offset, uintptr_t *buf, size_t count) {
+	return s_backtraceState.captureBacktrace(offset + 1, buf, count);
+}
+
+void symbolizeBacktrace(const uintptr_t *pcs, size_t count,
+		const callback<void(uintptr_t, StringView)> &cb) {
+	s_backtraceState.symbolizeBacktrace(pcs, count, cb);
+}
+
 } // namespace sprt::backtrace
@@ -99,6 +99,12 @@ __SPRT_C_FUNC long __SPRT_ID(futex2_wait)(volatile __SPRT_ID(uint32_t) * uaddr,
 	return syscall(__SPRT_SYSCALL_futex_wait, uaddr, val, bitset, flags, timespec, clockid);
 }
 
+__SPRT_C_FUNC long __SPRT_ID(futex2_waitv)(struct __SPRT_ID(futex_waitv) * waiters,
+		__SPRT_ID(uint32_t) nr_futexes, __SPRT_ID(uint32_t) flags, __SPRT_TIMESPEC_NAME *timespec,
+		__SPRT_ID(clockid_t) clockid) {
+	return syscall(__SPRT_SYSCALL_futex_waitv, waiters, nr_futexes, flags, timespec, clockid);
+}
+
 #else
 
 // FUTEX_WAKE(2const): https://man7.org/linux/man-pages/man2/FUTEX_WAKE.2const.html
@@ -180,6 +186,13 @@ __SPRT_C_FUNC long __SPRT_ID(futex2_wait)(volatile __SPRT_ID(uint32_t) * uaddr,
 	return -1;
 }
 
+__SPRT_C_FUNC long __SPRT_ID(futex2_waitv)(struct __SPRT_ID(futex_waitv) * waiters,
+		__SPRT_ID(uint32_t) nr_futexes, __SPRT_ID(uint32_t) flags, __SPRT_TIMESPEC_NAME *timespec,
+		__SPRT_ID(clockid_t) clockid) {
+	*__sprt___errno_location() = ENOSYS;
+	return -1;
+}
+
 #endif
 
 } // namespace sprt
@@ -21,15 +21,35 @@
  **/
 
 #include <sprt/runtime/utils/compress.h>
+#include <sprt/runtime/hash.h>
+#include <sprt/runtime/dispatch/thread_pool.h>
 #include <sprt/cxx/algorithm>
+#include <sprt/cxx/new>
+
+#include <sprt/c/__sprt_stdlib.h>
+#include <sprt/c/__sprt_string.h>
 
 #include "private/thirdparty/lz4hc.h"
 
 namespace sprt {
 
-thread_local uint8_t tl_lz4HCEncodeState[sprt::max(sizeof(LZ4_streamHC_t), sizeof(LZ4_stream_t))];
+enum class Lz4StateType {
+	None,
+	Fast,
+	HC,
+};
+
+alignas(16) thread_local uint8_t
+		tl_lz4HCEncodeState[sprt::max(sizeof(LZ4_streamHC_t), sizeof(LZ4_stream_t))];
 
-uint8_t *lz4_getEncodeState() { return tl_lz4HCEncodeState; }
+// Stream type, that was initialized in tl_lz4HCEncodeState
+thread_local Lz4StateType tl_lz4StateType = Lz4StateType::None;
+
+uint8_t *lz4_getEncodeState() {
+	// state can be used for anything, so it should be initialized again
+	tl_lz4StateType = Lz4StateType::None;
+	return tl_lz4HCEncodeState;
+}
 
 size_t lz4_getCompressBounds(size_t size) {
 	if (size < LZ4_MAX_INPUT_SIZE) {
@@ -41,6 +61,7 @@ size_t lz4_getCompressBounds(size_t size) {
 size_t lz4_compressData(const uint8_t *src, size_t srcSize, uint8_t *dest, size_t destSize) {
 	auto ret = LZ4_compress_fast_extState(tl_lz4HCEncodeState, (const char *)src, (char *)dest,
 			int(srcSize), int(destSize), 65'537);
+	tl_lz4StateType = Lz4StateType::Fast;
 	if (ret > 0) {
 		return size_t(ret);
 	}
@@ -50,6 +71,7 @@ size_t lz4_compressData(const uint8_t *src, size_t srcSize, uint8_t *dest, size_
 size_t lz4hc_compressData(const uint8_t *src, size_t srcSize, uint8_t *dest, size_t destSize) {
 	auto ret = LZ4_compress_HC_extStateHC(tl_lz4HCEncodeState, (const char *)src, (char *)dest,
 			int(srcSize), int(destSize), LZ4HC_CLEVEL_MAX);
+	tl_lz4StateType = Lz4StateType::HC;
 	if (ret > 0) {
 		return size_t(ret);
 	}
@@ -65,4 +87,1176 @@ size_t lz4_decompressData(const uint8_t *src, size_t srcSize, uint8_t *dest, siz
 }
 
 
+static constexpr uint32_t Lz4FrameMagic = 0x184D'2204;
+static constexpr uint32_t Lz4SkippableMagic = 0x184D'2A50;
+static constexpr uint32_t Lz4SkippableMask = 0xFFFF'FFF0;
+static constexpr uint32_t Lz4UncompressedBit = 0x8000'0000;
+static constexpr size_t Lz4MaxHeaderSize = 4 + 2 + 8 + 4 + 1;
+static constexpr size_t Lz4HistorySize = 64 * 1'024;
+
+static constexpr uint8_t Lz4FlagVersion = 1 << 6;
+static constexpr uint8_t Lz4FlagIndependent = 1 << 5;
+static constexpr uint8_t Lz4FlagBlockChecksum = 1 << 4;
+static constexpr uint8_t Lz4FlagContentSize = 1 << 3;
+static constexpr uint8_t Lz4FlagContentChecksum = 1 << 2;
+static constexpr uint8_t Lz4FlagDictId = 1 << 0;
+
+static size_t lz4_getBlockSize(Lz4BlockSize s) { return size_t(1) << (8 + 2 * toInt(s)); }
+
+static void lz4_write32(uint8_t *p, uint32_t v) {
+	for (int i = 0; i < 4; ++i) { p[i] = uint8_t(v >> (i * 8)); }
+}
+
+static void lz4_write64(uint8_t *p, uint64_t v) {
+	for (int i = 0; i < 8; ++i) { p[i] = uint8_t(v >> (i * 8)); }
+}
+
+static uint32_t lz4_read32(const uint8_t *p) {
+	return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+static uint64_t lz4_read64(const uint8_t *p) {
+	return uint64_t(lz4_read32(p)) | (uint64_t(lz4_read32(p + 4)) << 32);
+}
+
+static uint32_t lz4_checksum(const uint8_t *p, size_t size) {
+	return xxh32::hash((const char *)p, uint32_t(size), 0);
+}
+
+// Streaming xxh32 for the frame content checksum
+struct Lz4ContentChecksum {
+	static constexpr uint32_t PRIME1 = 0x9E37'79B1U;
+	static constexpr uint32_t PRIME2 = 0x85EB'CA77U;
+	static constexpr uint32_t PRIME3 = 0xC2B2'AE3DU;
+	static constexpr uint32_t PRIME4 = 0x27D4'EB2FU;
+	static constexpr uint32_t PRIME5 = 0x1656'67B1U;
+
+	static uint32_t rotl(uint32_t x, int r) { return (x << r) | (x >> (32 - r)); }
+
+	static uint32_t round(uint32_t acc, const uint8_t *p) {
+		return rotl(acc + lz4_read32(p) * PRIME2, 13) * PRIME1;
+	}
+
+	uint32_t v[4];
+	uint64_t total = 0;
+	uint8_t mem[16];
+	uint32_t memsize = 0;
+
+	void reset() {
+		v[0] = PRIME1 + PRIME2;
+		v[1] = PRIME2;
+		v[2] = 0;
+		v[3] = 0 - PRIME1;
+		total = 0;
+		memsize = 0;
+	}
+
+	void update(const uint8_t *p, size_t len) {
+		total += len;
+
+		if (memsize + len < 16) {
+			__sprt_memcpy(mem + memsize, p, len);
+			memsize += uint32_t(len);
+			return;
+		}
+
+		if (memsize > 0) {
+			const size_t n = 16 - memsize;
+			__sprt_memcpy(mem + memsize, p, n);
+			for (int i = 0; i < 4; ++i) { v[i] = round(v[i], mem + i * 4); }
+			p += n;
+			len -= n;
+			memsize = 0;
+		}
+
+		while (len >= 16) {
+			for (int i = 0; i < 4; ++i) { v[i] = round(v[i], p + i * 4); }
+			p += 16;
+			len -= 16;
+		}
+
+		if (len > 0) {
+			__sprt_memcpy(mem, p, len);
+			memsize = uint32_t(len);
+		}
+	}
+
+	uint32_t digest() const {
+		uint32_t h = (total >= 16) ? rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18)
+								   : v[2] + PRIME5;
+		h += uint32_t(total);
+
+		const uint8_t *p = mem;
+		uint32_t len = memsize;
+		while (len >= 4) {
+			h = rotl(h + lz4_read32(p) * PRIME3, 17) * PRIME4;
+			p += 4;
+			len -= 4;
+		}
+		while (len > 0) {
+			h = rotl(h + (*p++) * PRIME5, 11) * PRIME1;
+			--len;
+		}
+
+		h ^= h >> 15;
+		h *= PRIME2;
+		h ^= h >> 13;
+		h *= PRIME3;
+		h ^= h >> 16;
+		return h;
+	}
+};
+
+static LZ4_stream_t *lz4_getFastState() {
+	auto state = reinterpret_cast<LZ4_stream_t *>(tl_lz4HCEncodeState);
+	if (tl_lz4StateType != Lz4StateType::Fast) {
+		LZ4_initStream(state, sizeof(LZ4_stream_t));
+		tl_lz4StateType = Lz4StateType::Fast;
+	} else {
+		LZ4_resetStream_fast(state);
+	}
+	return state;
+}
+
+static LZ4_streamHC_t *lz4_getHCState(int level) {
+	auto state = reinterpret_cast<LZ4_streamHC_t *>(tl_lz4HCEncodeState);
+	if (tl_lz4StateType != Lz4StateType::HC) {
+		LZ4_initStreamHC(state, sizeof(LZ4_streamHC_t));
+		tl_lz4StateType = Lz4StateType::HC;
+	}
+	LZ4_resetStreamHC_fast(state, level);
+	return state;
+}
+
+// Compresses independent block with thread-local state; returns 0 when block is not compressible
+static size_t lz4_compressIndependentBlock(const uint8_t *src, size_t srcSize, uint8_t *dest,
+		size_t destSize, const Lz4FrameInfo &info) {
+	int ret = 0;
+	if (info.level > 0) {
+		auto state = lz4_getHCState(info.level);
+		if (info.dictionary) {
+			LZ4_attach_HC_dictionary(state,
+					static_cast<const LZ4_streamHC_t *>(info.dictionary->getStreamHC(info.level)));
+		}
+		ret = LZ4_compress_HC_continue(state, (const char *)src, (char *)dest, int(srcSize),
+				int(destSize));
+	} else {
+		auto state = lz4_getFastState();
+		if (info.dictionary) {
+			LZ4_attach_dictionary(state,
+					static_cast<const LZ4_stream_t *>(info.dictionary->getStream()));
+		}
+		ret = LZ4_compress_fast_continue(state, (const char *)src, (char *)dest, int(srcSize),
+				int(destSize), 1);
+	}
+	return ret > 0 ? size_t(ret) : 0;
+}
+
+static size_t lz4_writeFrameHeader(uint8_t *out, const Lz4FrameInfo &info, uint64_t contentSize) {
+	uint8_t flags = Lz4FlagVersion;
+	if (!hasFlag(info.flags, Lz4FrameFlags::LinkedBlocks)) {
+		flags |= Lz4FlagIndependent;
+	}
+	if (hasFlag(info.flags, Lz4FrameFlags::BlockChecksum)) {
+		flags |= Lz4FlagBlockChecksum;
+	}
+	if (hasFlag(info.flags, Lz4FrameFlags::ContentSize)) {
+		flags |= Lz4FlagContentSize;
+	}
+	if (hasFlag(info.flags, Lz4FrameFlags::ContentChecksum)) {
+		flags |= Lz4FlagContentChecksum;
+	}
+	if (info.dictionary) {
+		flags |= Lz4FlagDictId;
+	}
+
+	size_t pos = 0;
+	lz4_write32(out, Lz4FrameMagic);
+	pos += 4;
+	out[pos++] = flags;
+	out[pos++] = uint8_t(toInt(info.blockSize) << 4);
+	if (flags & Lz4FlagContentSize) {
+		lz4_write64(out + pos, contentSize);
+		pos += 8;
+	}
+	if (flags & Lz4FlagDictId) {
+		lz4_write32(out + pos, info.dictionary->getId());
+		pos += 4;
+	}
+	out[pos] = uint8_t((lz4_checksum(out + 4, pos - 4) >> 8) & 0xFF);
+	return pos + 1;
+}
+
+// Writes block header, data and checksum; `compressed` is 0 for uncompressed block, that should
+// be already placed after header
+static size_t lz4_finalizeBlock(uint8_t *out, const uint8_t *src, size_t srcSize, size_t compressed,
+		const Lz4FrameInfo &info) {
+	size_t size = compressed;
+	if (compressed == 0) {
+		__sprt_memcpy(out + 4, src, srcSize);
+		size = srcSize;
+		lz4_write32(out, uint32_t(size) | Lz4UncompressedBit);
+	} else {
+		lz4_write32(out, uint32_t(size));
+	}
+
+	if (hasFlag(info.flags, Lz4FrameFlags::BlockChecksum)) {
+		lz4_write32(out + 4 + size, lz4_checksum(out + 4, size));
+		return size + 8;
+	}
+	return size + 4;
+}
+
+
+size_t Lz4Dictionary::train(uint8_t *dict, size_t dictCapacity, const uint8_t *const samples[],
+		const size_t sampleSizes[], size_t count) {
+	// Simplified FastCover: d-mers frequencies are counted with a hash table, then dictionary
+	// is filled with the best segment from every epoch; d-mers of the selected segment are
+	// zeroed, so next segments cover another content
+	static constexpr size_t DmerSize = 8;
+	static constexpr size_t SegmentSize = 1'024;
+	static constexpr uint32_t TableBits = 20;
+	static constexpr size_t TableSize = size_t(1) << TableBits;
+
+	if (!dict || dictCapacity == 0) {
+		return 0;
+	}
+
+	size_t total = 0;
+	for (size_t i = 0; i < count; ++i) { total += sampleSizes[i]; }
+
+	if (total <= dictCapacity) {
+		// samples are smaller then dictionary, use them as is
+		size_t offset = dictCapacity - total;
+		for (size_t i = 0; i < count; ++i) {
+			__sprt_memcpy(dict + offset, samples[i], sampleSizes[i]);
+			offset += sampleSizes[i];
+		}
+		__sprt_memmove(dict, dict + dictCapacity - total, total);
+		return total;
+	}
+
+	if (total < DmerSize || dictCapacity < DmerSize) {
+		// nothing to count, d-mers and segments do not fit
+		return 0;
+	}
+
+	auto data = static_cast<uint8_t *>(__sprt_malloc(total));
+	auto freqs = static_cast<uint32_t *>(__sprt_calloc(TableSize, sizeof(uint32_t)));
+	auto segmentFreqs = static_cast<uint16_t *>(__sprt_calloc(TableSize, sizeof(uint16_t)));
+
+	if (!data || !freqs || !segmentFreqs) {
+		__sprt_free(data);
+		__sprt_free(freqs);
+		__sprt_free(segmentFreqs);
+		return 0;
+	}
+
+	size_t offset = 0;
+	for (size_t i = 0; i < count; ++i) {
+		__sprt_memcpy(data + offset, samples[i], sampleSizes[i]);
+		offset += sampleSizes[i];
+	}
+
+	auto hashDmer = [&](size_t pos) -> uint32_t {
+		uint64_t v;
+		__sprt_memcpy(&v, data + pos, sizeof(v));
+		return uint32_t((v * 0xCF1B'BCDC'B7A5'6463ULL) >> (64 - TableBits));
+	};
+
+	const size_t dmers = total - DmerSize + 1;
+	for (size_t i = 0; i < dmers; ++i) { ++freqs[hashDmer(i)]; }
+
+	const size_t segmentSize = sprt::min(SegmentSize, dictCapacity);
+	const size_t epochs = sprt::max(dictCapacity / segmentSize, size_t(1));
+	const size_t epochSize = sprt::max(total / epochs, segmentSize);
+
+	// segments are written from the end, so the best segments are closest to the payload
+	size_t tail = dictCapacity;
+
+	for (size_t epoch = 0; epoch < epochs && tail > 0; ++epoch) {
+		const size_t begin = epoch * epochSize;
+		const size_t end = sprt::min(begin + epochSize, total);
+		if (end <= begin || end - begin < segmentSize) {
+			break;
+		}
+
+		const size_t windowDmers = segmentSize - DmerSize + 1;
+		size_t bestBegin = begin;
+		uint64_t bestScore = 0;
+		uint64_t score = 0;
+
+		// sliding window over segment candidates; every distinct d-mer counts once
+		for (size_t pos = begin; pos + DmerSize <= end; ++pos) {
+			auto h = hashDmer(pos);
+			if (segmentFreqs[h]++ == 0) {
+				score += freqs[h];
+			}
+
+			if (pos + 1 >= begin + windowDmers) {
+				const size_t first = pos + 1 - windowDmers;
+				if (score > bestScore) {
+					bestScore = score;
+					bestBegin = first;
+				}
+
+				auto fh = hashDmer(first);
+				if (--segmentFreqs[fh] == 0) {
+					score -= freqs[fh];
+				}
+			}
+		}
+
+		// clear window counters
+		for (size_t pos = begin; pos + DmerSize <= end; ++pos) { segmentFreqs[hashDmer(pos)] = 0; }
+
+		if (bestScore == 0) {
+			continue;
+		}
+
+		const size_t n = sprt::min(segmentSize, tail);
+		tail -= n;
+		__sprt_memcpy(dict + tail, data + bestBegin, n);
+
+		for (size_t pos = bestBegin; pos + DmerSize <= bestBegin + segmentSize; ++pos) {
+			freqs[hashDmer(pos)] = 0;
+		}
+	}
+
+	__sprt_free(data);
+	__sprt_free(freqs);
+	__sprt_free(segmentFreqs);
+
+	const size_t size = dictCapacity - tail;
+	if (tail > 0) {
+		__sprt_memmove(dict, dict + tail, size);
+	}
+	return size;
+}
+
+Lz4Dictionary::~Lz4Dictionary() {
+	for (auto &it : _streamHC) {
+		if (it) {
+			__sprt_free(it);
+		}
+	}
+	if (_stream) {
+		__sprt_free(_stream);
+	}
+	if (_data) {
+		__sprt_free(_data);
+	}
+}
+
+Lz4Dictionary::Lz4Dictionary(const uint8_t *data, size_t size, uint32_t id) {
+	// LZ4 uses only last 64KB
+	if (size > MaxSize) {
+		data += size - MaxSize;
+		size = MaxSize;
+	}
+
+	_data = static_cast<uint8_t *>(__sprt_malloc(sprt::max(size, size_t(1))));
+	_size = size;
+	__sprt_memcpy(_data, data, size);
+
+	_id = id ? id : lz4_checksum(_data, _size);
+	if (_id == 0) {
+		_id = 1;
+	}
+
+	_stream = __sprt_malloc(sizeof(LZ4_stream_t));
+	auto stream = LZ4_initStream(_stream, sizeof(LZ4_stream_t));
+	LZ4_loadDictSlow(stream, (const char *)_data, int(_size));
+}
+
+const void *Lz4Dictionary::getStreamHC(int level) const {
+	level = sprt::min(sprt::max(level, 1), MaxLevel);
+
+	auto &slot = _streamHC[level - 1];
+	auto ret = __atomic_load_n(&slot, __ATOMIC_ACQUIRE);
+	if (ret) {
+		return ret;
+	}
+
+	void *mem = __sprt_malloc(sizeof(LZ4_streamHC_t));
+	auto stream = LZ4_initStreamHC(mem, sizeof(LZ4_streamHC_t));
+	LZ4_resetStreamHC_fast(stream, level);
+	LZ4_loadDictHC(stream, (const char *)_data, int(_size));
+
+	void *expected = nullptr;
+	if (__atomic_compare_exchange_n(&slot, &expected, mem, false, __ATOMIC_ACQ_REL,
+				__ATOMIC_ACQUIRE)) {
+		return mem;
+	}
+
+	// other thread was first
+	__sprt_free(mem);
+	return expected;
+}
+
+
+struct Lz4Encoder::Data {
+	Lz4FrameInfo info;
+	size_t blockSize = 0;
+	bool linked = false;
+	bool started = false;
+
+	uint8_t *input = nullptr; // [blockSize]
+	size_t buffered = 0;
+
+	uint8_t *output = nullptr; // [Lz4MaxHeaderSize + 4 + blockSize + 4]
+	uint8_t *history = nullptr; // [Lz4HistorySize]
+	void *stream = nullptr; // for LinkedBlocks
+
+	uint64_t contentSize = 0;
+	Lz4ContentChecksum checksum;
+
+	Data(const Lz4FrameInfo &i) : info(i) {
+		blockSize = lz4_getBlockSize(info.blockSize);
+		linked = hasFlag(info.flags, Lz4FrameFlags::LinkedBlocks);
+
+		input = static_cast<uint8_t *>(__sprt_malloc(blockSize));
+		output = static_cast<uint8_t *>(__sprt_malloc(Lz4MaxHeaderSize + blockSize + 8));
+
+		if (linked) {
+			history = static_cast<uint8_t *>(__sprt_malloc(Lz4HistorySize));
+			if (info.level > 0) {
+				stream = __sprt_malloc(sizeof(LZ4_streamHC_t));
+				LZ4_initStreamHC(stream, sizeof(LZ4_streamHC_t));
+			} else {
+				stream = __sprt_malloc(sizeof(LZ4_stream_t));
+				LZ4_initStream(stream, sizeof(LZ4_stream_t));
+			}
+		}
+	}
+
+	~Data() {
+		__sprt_free(input);
+		__sprt_free(output);
+		if (history) {
+			__sprt_free(history);
+		}
+		if (stream) {
+			__sprt_free(stream);
+		}
+	}
+
+	void start(const OutputCallback &cb) {
+		if (linked) {
+			if (info.level > 0) {
+				auto s = static_cast<LZ4_streamHC_t *>(stream);
+				LZ4_resetStreamHC_fast(s, info.level);
+				if (info.dictionary) {
+					LZ4_attach_HC_dictionary(s,
+							static_cast<const LZ4_streamHC_t *>(
+									info.dictionary->getStreamHC(info.level)));
+				}
+			} else {
+				auto s = static_cast<LZ4_stream_t *>(stream);
+				LZ4_resetStream_fast(s);
+				if (info.dictionary) {
+					LZ4_attach_dictionary(s,
+							static_cast<const LZ4_stream_t *>(info.dictionary->getStream()));
+				}
+			}
+		}
+
+		checksum.reset();
+		contentSize = 0;
+		buffered = 0;
+		started = true;
+
+		cb(output, lz4_writeFrameHeader(output, info, info.contentSize));
+	}
+
+	void writeBlock(const uint8_t *src, size_t size, const OutputCallback &cb) {
+		size_t compressed = 0;
+		auto dst = output + 4;
+		// compressed block should be smaller then source, or it will be stored uncompressed
+		if (!linked) {
+			compressed = lz4_compressIndependentBlock(src, size, dst, size - 1, info);
+		} else if (info.level > 0) {
+			auto ret = LZ4_compress_HC_continue(static_cast<LZ4_streamHC_t *>(stream),
+					(const char *)src, (char *)dst, int(size), int(size - 1));
+			compressed = ret > 0 ? size_t(ret) : 0;
+		} else {
+			auto ret = LZ4_compress_fast_continue(static_cast<LZ4_stream_t *>(stream),
+					(const char *)src, (char *)dst, int(size), int(size - 1), 1);
+			compressed = ret > 0 ? size_t(ret) : 0;
+		}
+
+		cb(output, lz4_finalizeBlock(output, src, size, compressed, info));
+	}
+
+	// In linked mode previous blocks should remain available for the next block
+	void saveHistory() {
+		if (info.level > 0) {
+			LZ4_saveDictHC(static_cast<LZ4_streamHC_t *>(stream), (char *)history,
+					int(Lz4HistorySize));
+		} else {
+			LZ4_saveDict(static_cast<LZ4_stream_t *>(stream), (char *)history, int(Lz4HistorySize));
+		}
+	}
+};
+
+Lz4Encoder::~Lz4Encoder() {
+	if (_data) {
+		_data->~Data();
+		__sprt_free(_data);
+	}
+}
+
+Lz4Encoder::Lz4Encoder(const Lz4FrameInfo &info) {
+	_data = new (__sprt_malloc(sizeof(Data))) Data(info);
+}
+
+Status Lz4Encoder::update(const uint8_t *src, size_t size, const OutputCallback &cb) {
+	if (!_data->started) {
+		_data->start(cb);
+	}
+
+	if (size == 0) {
+		return Status::Ok;
+	}
+
+	if (hasFlag(_data->info.flags, Lz4FrameFlags::ContentChecksum)) {
+		_data->checksum.update(src, size);
+	}
+	_data->contentSize += size;
+
+	const auto blockSize = _data->blockSize;
+
+	if (_data->buffered > 0) {
+		auto n = sprt::min(size, blockSize - _data->buffered);
+		__sprt_memcpy(_data->input + _data->buffered, src, n);
+		_data->buffered += n;
+		src += n;
+		size -= n;
+
+		if (_data->buffered < blockSize) {
+			return Status::Ok;
+		}
+
+		_data->writeBlock(_data->input, blockSize, cb);
+		_data->buffered = 0;
+		if (_data->linked) {
+			_data->saveHistory();
+		}
+	}
+
+	// full blocks are compressed directly from the input
+	bool direct = false;
+	while (size >= blockSize) {
+		_data->writeBlock(src, blockSize, cb);
+		src += blockSize;
+		size -= blockSize;
+		direct = true;
+	}
+
+	if (direct && _data->linked) {
+		_data->saveHistory();
+	}
+
+	if (size > 0) {
+		__sprt_memcpy(_data->input, src, size);
+		_data->buffered = size;
+	}
+
+	return Status::Ok;
+}
+
+Status Lz4Encoder::finalize(const OutputCallback &cb) {
+	if (!_data->started) {
+		_data->start(cb);
+	}
+
+	if (_data->buffered > 0) {
+		_data->writeBlock(_data->input, _data->buffered, cb);
+		_data->buffered = 0;
+	}
+
+	_data->started = false;
+
+	uint8_t tail[8];
+	size_t tailSize = 4;
+	lz4_write32(tail, 0); // end mark
+	if (hasFlag(_data->info.flags, Lz4FrameFlags::ContentChecksum)) {
+		lz4_write32(tail + 4, _data->checksum.digest());
+		tailSize += 4;
+	}
+	cb(tail, tailSize);
+
+	if (hasFlag(_data->info.flags, Lz4FrameFlags::ContentSize)
+			&& _data->contentSize != _data->info.contentSize) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	return Status::Ok;
+}
+
+const Lz4FrameInfo &Lz4Encoder::getInfo() const { return _data->info; }
+
+
+struct Lz4Decoder::Data {
+	enum class Stage {
+		Magic,
+		Header,
+		SkippableSize,
+		Skip,
+		BlockHeader,
+		Block,
+		ContentChecksum,
+	};
+
+	const Lz4Dictionary *dictionary = nullptr;
+	Lz4FrameInfo info;
+	Stage stage = Stage::Magic;
+
+	uint8_t header[Lz4MaxHeaderSize];
+	size_t headerSize = 0;
+
+	// bytes, collected for the current stage
+	size_t have = 0;
+	size_t need = 0;
+
+	uint32_t blockHeader = 0;
+	uint64_t skip = 0;
+
+	size_t blockMax = 0;
+	uint8_t *block = nullptr; // [blockMax + 4], compressed block with checksum
+	uint8_t *window = nullptr; // [Lz4HistorySize + blockMax], history and decoded block
+	size_t historySize = 0;
+
+	uint64_t decodedSize = 0;
+	Lz4ContentChecksum checksum;
+
+	~Data() {
+		if (block) {
+			__sprt_free(block);
+		}
+		if (window) {
+			__sprt_free(window);
+		}
+	}
+
+	// Collects `need` bytes for the stage into `target`, returns true when all bytes are collected
+	bool collect(const uint8_t *&src, size_t &size, uint8_t *target) {
+		auto n = sprt::min(size, need - have);
+		__sprt_memcpy(target + have, src, n);
+		have += n;
+		src += n;
+		size -= n;
+		return have == need;
+	}
+
+	void next(Stage s, size_t n) {
+		stage = s;
+		have = 0;
+		need = n;
+	}
+
+	Status readHeader() {
+		auto flags = header[4];
+		auto bd = header[5];
+
+		if ((flags & 0xC0) != Lz4FlagVersion || (flags & 0x02) != 0 || (bd & 0x8F) != 0) {
+			return Status::ErrorNotSupported;
+		}
+
+		auto blockSize = Lz4BlockSize((bd >> 4) & 0x07);
+		if (toInt(blockSize) < toInt(Lz4BlockSize::Max64KB)) {
+			return Status::ErrorNotSupported;
+		}
+
+		if (header[headerSize - 1]
+				!= uint8_t((lz4_checksum(header + 4, headerSize - 5) >> 8) & 0xFF)) {
+			return Status::ErrorInvalidArguemnt;
+		}
+
+		info = Lz4FrameInfo();
+		info.flags = Lz4FrameFlags::None;
+		info.blockSize = blockSize;
+
+		size_t pos = 6;
+		if (!(flags & Lz4FlagIndependent)) {
+			info.flags |= Lz4FrameFlags::LinkedBlocks;
+		}
+		if (flags & Lz4FlagBlockChecksum) {
+			info.flags |= Lz4FrameFlags::BlockChecksum;
+		}
+		if (flags & Lz4FlagContentChecksum) {
+			info.flags |= Lz4FrameFlags::ContentChecksum;
+		}
+		if (flags & Lz4FlagContentSize) {
+			info.flags |= Lz4FrameFlags::ContentSize;
+			info.contentSize = lz4_read64(header + pos);
+			pos += 8;
+		}
+		if (flags & Lz4FlagDictId) {
+			if (!dictionary || dictionary->getId() != lz4_read32(header + pos)) {
+				return Status::ErrorNotFound;
+			}
+		}
+
+		// frames without dictionary id can still be compressed with dictionary
+		info.dictionary = dictionary;
+
+		auto size = lz4_getBlockSize(blockSize);
+		if (size > blockMax) {
+			if (block) {
+				__sprt_free(block);
+			}
+			if (window) {
+				__sprt_free(window);
+			}
+			blockMax = size;
+			block = static_cast<uint8_t *>(__sprt_malloc(blockMax + 4));
+			window = static_cast<uint8_t *>(__sprt_malloc(Lz4HistorySize + blockMax));
+		}
+
+		historySize = 0;
+		if (dictionary && hasFlag(info.flags, Lz4FrameFlags::LinkedBlocks)) {
+			historySize = sprt::min(dictionary->getSize(), Lz4HistorySize);
+			__sprt_memcpy(window + Lz4HistorySize - historySize,
+					dictionary->getData() + dictionary->getSize() - historySize, historySize);
+		}
+
+		decodedSize = 0;
+		checksum.reset();
+		return Status::Ok;
+	}
+
+	Status readBlock(const uint8_t *data, const OutputCallback &cb) {
+		const size_t size = blockHeader & ~Lz4UncompressedBit;
+
+		if (hasFlag(info.flags, Lz4FrameFlags::BlockChecksum)) {
+			if (lz4_checksum(data, size) != lz4_read32(data + size)) {
+				return Status::ErrorInvalidArguemnt;
+			}
+		}
+
+		const bool linked = hasFlag(info.flags, Lz4FrameFlags::LinkedBlocks);
+		const uint8_t *out = window + Lz4HistorySize;
+		size_t outSize = 0;
+
+		if (blockHeader & Lz4UncompressedBit) {
+			if (linked) {
+				__sprt_memcpy(window + Lz4HistorySize, data, size);
+			} else {
+				out = data;
+			}
+			outSize = size;
+		} else {
+			int ret = 0;
+			auto dst = (char *)window + Lz4HistorySize;
+			if (linked) {
+				// history is placed right before the output
+				ret = LZ4_decompress_safe_usingDict((const char *)data, dst, int(size),
+						int(blockMax), dst - historySize, int(historySize));
+			} else if (dictionary) {
+				ret = LZ4_decompress_safe_usingDict((const char *)data, dst, int(size),
+						int(blockMax), (const char *)dictionary->getData(),
+						int(dictionary->getSize()));
+			} else {
+				ret = LZ4_decompress_safe((const char *)data, dst, int(size), int(blockMax));
+			}
+			if (ret < 0) {
+				return Status::ErrorInvalidArguemnt;
+			}
+			outSize = size_t(ret);
+		}
+
+		if (hasFlag(info.flags, Lz4FrameFlags::ContentChecksum)) {
+			checksum.update(out, outSize);
+		}
+		decodedSize += outSize;
+
+		if (outSize > 0) {
+			cb(out, outSize);
+		}
+
+		if (linked) {
+			auto keep = sprt::min(historySize + outSize, Lz4HistorySize);
+			__sprt_memmove(window + Lz4HistorySize - keep, window + Lz4HistorySize + outSize - keep,
+					keep);
+			historySize = keep;
+		}
+		return Status::Ok;
+	}
+};
+
+Lz4Decoder::~Lz4Decoder() {
+	if (_data) {
+		_data->~Data();
+		__sprt_free(_data);
+	}
+}
+
+Lz4Decoder::Lz4Decoder(const Lz4Dictionary *dict) {
+	_data = new (__sprt_malloc(sizeof(Data))) Data();
+	_data->dictionary = dict;
+	_data->next(Data::Stage::Magic, 4);
+}
+
+Status Lz4Decoder::update(const uint8_t *src, size_t size, const OutputCallback &cb,
+		size_t *consumed) {
+	using Stage = Data::Stage;
+
+	auto d = _data;
+	const auto initialSize = size;
+	Status status = Status::Ok;
+
+	while (size > 0 && status == Status::Ok) {
+		switch (d->stage) {
+		case Stage::Magic:
+			if (d->collect(src, size, d->header)) {
+				auto magic = lz4_read32(d->header);
+				if (magic == Lz4FrameMagic) {
+					// FLG and BD define the rest of the descriptor
+					d->stage = Stage::Header;
+					d->need = 6;
+				} else if ((magic & Lz4SkippableMask) == Lz4SkippableMagic) {
+					d->stage = Stage::SkippableSize;
+					d->need = 8;
+				} else {
+					status = Status::ErrorInvalidArguemnt;
+				}
+			}
+			break;
+		case Stage::Header:
+			if (d->collect(src, size, d->header)) {
+				if (d->need == 6) {
+					auto flags = d->header[4];
+					d->need = 7 + ((flags & Lz4FlagContentSize) ? 8 : 0)
+							+ ((flags & Lz4FlagDictId) ? 4 : 0);
+				} else {
+					d->headerSize = d->need;
+					status = d->readHeader();
+					d->next(Stage::BlockHeader, 4);
+				}
+			}
+			break;
+		case Stage::SkippableSize:
+			if (d->collect(src, size, d->header)) {
+				d->skip = lz4_read32(d->header + 4);
+				d->next(Stage::Skip, 0);
+			}
+			break;
+		case Stage::Skip: {
+			auto n = size_t(sprt::min(uint64_t(size), d->skip));
+			d->skip -= n;
+			src += n;
+			size -= n;
+			break;
+		}
+		case Stage::BlockHeader:
+			if (d->collect(src, size, d->header)) {
+				d->blockHeader = lz4_read32(d->header);
+				if (d->blockHeader == 0) {
+					if (hasFlag(d->info.flags, Lz4FrameFlags::ContentChecksum)) {
+						d->next(Stage::ContentChecksum, 4);
+					} else {
+						status = Status::Done;
+					}
+				} else {
+					const size_t blockSize = d->blockHeader & ~Lz4UncompressedBit;
+					if (blockSize > d->blockMax) {
+						status = Status::ErrorInvalidArguemnt;
+					} else {
+						d->next(Stage::Block,
+								blockSize
+										+ (hasFlag(d->info.flags, Lz4FrameFlags::BlockChecksum)
+														? 4
+														: 0));
+					}
+				}
+			}
+			break;
+		case Stage::Block:
+			if (d->have == 0 && size >= d->need) {
+				// whole block is available in the input
+				status = d->readBlock(src, cb);
+				src += d->need;
+				size -= d->need;
+				d->next(Stage::BlockHeader, 4);
+			} else if (d->collect(src, size, d->block)) {
+				status = d->readBlock(d->block, cb);
+				d->next(Stage::BlockHeader, 4);
+			}
+			break;
+		case Stage::ContentChecksum:
+			if (d->collect(src, size, d->header)) {
+				if (lz4_read32(d->header) != d->checksum.digest()) {
+					status = Status::ErrorInvalidArguemnt;
+				} else {
+					status = Status::Done;
+				}
+			}
+			break;
+		}
+
+		if (d->stage == Stage::Skip && d->skip == 0) {
+			d->next(Stage::Magic, 4);
+		}
+	}
+
+	if (status == Status::Done) {
+		if (hasFlag(d->info.flags, Lz4FrameFlags::ContentSize)
+				&& d->decodedSize != d->info.contentSize) {
+			status = Status::ErrorInvalidArguemnt;
+		}
+		d->next(Stage::Magic, 4);
+	}
+
+	if (consumed) {
+		*consumed = initialSize - size;
+	}
+
+	return status;
+}
+
+const Lz4FrameInfo &Lz4Decoder::getInfo() const { return _data->info; }
+
+
+struct Lz4ParallelEncoder::Data {
+	const uint8_t *source = nullptr;
+	size_t sourceSize = 0;
+	Lz4FrameInfo info;
+
+	size_t blockSize = 0;
+	size_t blockCount = 0;
+	size_t blockStride = 0;
+
+	uint8_t *output = nullptr; // [blockCount * blockStride]
+	size_t *outputSizes = nullptr; // 0 for blocks, that are not compressed yet
+
+	uint8_t header[Lz4MaxHeaderSize];
+	size_t headerSize = 0;
+
+	~Data() {
+		if (output) {
+			__sprt_free(output);
+		}
+		if (outputSizes) {
+			__sprt_free(outputSizes);
+		}
+	}
+};
+
+Lz4ParallelEncoder::~Lz4ParallelEncoder() {
+	if (_data) {
+		_data->~Data();
+		__sprt_free(_data);
+	}
+}
+
+Lz4ParallelEncoder::Lz4ParallelEncoder(const uint8_t *data, size_t size,
+		const Lz4FrameInfo &info) {
+	_data = new (__sprt_malloc(sizeof(Data))) Data();
+	_data->source = data;
+	_data->sourceSize = size;
+	_data->info = info;
+	_data->info.flags &= ~Lz4FrameFlags::LinkedBlocks;
+	_data->info.contentSize = size;
+
+	_data->blockSize = lz4_getBlockSize(info.blockSize);
+	_data->blockCount = (size + _data->blockSize - 1) / _data->blockSize;
+	_data->blockStride = _data->blockSize + 8;
+
+	if (_data->blockCount > 0) {
+		_data->output =
+				static_cast<uint8_t *>(__sprt_malloc(_data->blockCount * _data->blockStride));
+		_data->outputSizes =
+				static_cast<size_t *>(__sprt_calloc(_data->blockCount, sizeof(size_t)));
+	}
+
+	_data->headerSize = lz4_writeFrameHeader(_data->header, _data->info, size);
+}
+
+size_t Lz4ParallelEncoder::getBlockCount() const { return _data->blockCount; }
+
+Status Lz4ParallelEncoder::compressBlock(size_t idx) {
+	if (idx >= _data->blockCount) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto src = _data->source + idx * _data->blockSize;
+	auto size = sprt::min(_data->blockSize, _data->sourceSize - idx * _data->blockSize);
+	auto out = _data->output + idx * _data->blockStride;
+
+	auto compressed = lz4_compressIndependentBlock(src, size, out + 4, size - 1, _data->info);
+	_data->outputSizes[idx] = lz4_finalizeBlock(out, src, size, compressed, _data->info);
+	return Status::Ok;
+}
+
+size_t Lz4ParallelEncoder::getFrameSize() const {
+	size_t ret = _data->headerSize + 4;
+	if (hasFlag(_data->info.flags, Lz4FrameFlags::ContentChecksum)) {
+		ret += 4;
+	}
+	for (size_t i = 0; i < _data->blockCount; ++i) {
+		if (_data->outputSizes[i] == 0) {
+			return 0;
+		}
+		ret += _data->outputSizes[i];
+	}
+	return ret;
+}
+
+Status Lz4ParallelEncoder::write(const OutputCallback &cb) const {
+	for (size_t i = 0; i < _data->blockCount; ++i) {
+		if (_data->outputSizes[i] == 0) {
+			return Status::ErrorInvalidArguemnt;
+		}
+	}
+
+	cb(_data->header, _data->headerSize);
+
+	for (size_t i = 0; i < _data->blockCount; ++i) {
+		cb(_data->output + i * _data->blockStride, _data->outputSizes[i]);
+	}
+
+	uint8_t tail[8];
+	size_t tailSize = 4;
+	lz4_write32(tail, 0);
+	if (hasFlag(_data->info.flags, Lz4FrameFlags::ContentChecksum)) {
+		// xxh32 can not be combined from parts, so it's computed sequentially
+		Lz4ContentChecksum checksum;
+		checksum.reset();
+		checksum.update(_data->source, _data->sourceSize);
+		lz4_write32(tail + 4, checksum.digest());
+		tailSize += 4;
+	}
+	cb(tail, tailSize);
+	return Status::Ok;
+}
+
+
+size_t lz4_getFrameBounds(size_t size, const Lz4FrameInfo &info) {
+	const size_t blockSize = lz4_getBlockSize(info.blockSize);
+	const size_t blocks = sprt::max((size + blockSize - 1) / blockSize, size_t(1));
+
+	// every block is either compressed or stored as is
+	return Lz4MaxHeaderSize + blocks * 8 + size + 8;
+}
+
+size_t lz4_compressFrame(const uint8_t *src, size_t srcSize, uint8_t *dest, size_t destSize,
+		const Lz4FrameInfo &info) {
+	size_t offset = 0;
+	bool overflow = false;
+
+	auto write = [&](const uint8_t *data, size_t size) {
+		if (overflow || destSize - offset < size) {
+			overflow = true;
+			return;
+		}
+		__sprt_memcpy(dest + offset, data, size);
+		offset += size;
+	};
+
+	Lz4Encoder encoder(info);
+	if (encoder.update(src, srcSize, write) != Status::Ok || encoder.finalize(write) != Status::Ok
+			|| overflow) {
+		return 0;
+	}
+	return offset;
+}
+
+size_t lz4_decompressFrame(const uint8_t *src, size_t srcSize, uint8_t *dest, size_t destSize,
+		const Lz4Dictionary *dict) {
+	size_t offset = 0;
+	bool overflow = false;
+
+	Lz4Decoder decoder(dict);
+	auto status = decoder.update(src, srcSize, [&](const uint8_t *data, size_t size) {
+		if (overflow || destSize - offset < size) {
+			overflow = true;
+			return;
+		}
+		__sprt_memcpy(dest + offset, data, size);
+		offset += size;
+	});
+
+	if (status != Status::Done || overflow) {
+		return 0;
+	}
+	return offset;
+}
+
+Status lz4_performCompress(dispatch::ThreadPool &pool, BytesView data, const Lz4FrameInfo &info,
+		dispatch::Function<void(Status, BytesView)> &&cb, Ref *ref) {
+	using dispatch::Task;
+
+	if (!cb) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	struct CompressState : Ref {
+		Lz4ParallelEncoder encoder;
+		size_t blocks = 0;
+		sprt::atomic<size_t> completed = 0;
+		sprt::atomic<bool> failed = false;
+		dispatch::Function<void(Status, BytesView)> callback;
+
+		CompressState(BytesView data, const Lz4FrameInfo &info)
+		: encoder(data.data(), data.size(), info) {
+			blocks = encoder.getBlockCount();
+		}
+
+		void complete(size_t count, bool success) {
+			if (!success) {
+				failed = true;
+			}
+			if (completed.fetch_add(count) + count == blocks) {
+				if (failed.load()) {
+					callback(Status::ErrorCancelled, BytesView());
+					return;
+				}
+
+				dispatch::Vector<uint8_t> frame;
+				frame.reserve(encoder.getFrameSize());
+				auto status = encoder.write([&](const uint8_t *buf, size_t size) {
+					frame.insert(frame.end(), buf, buf + size);
+				});
+				callback(status, BytesView(frame.data(), frame.size()));
+			}
+		}
+	};
+
+	auto state = Rc<CompressState>::alloc(data, info);
+	state->callback = sprt::move(cb);
+
+	if (state->blocks == 0) {
+		// empty frame has no blocks to compress
+		return pool.performCompleted([state] { state->complete(0, true); }, ref);
+	}
+
+	const size_t threads = sprt::max(size_t(pool.getInfo().threadCount), size_t(1));
+	const size_t batch = sprt::max(state->blocks / (threads * 2), size_t(1));
+
+	for (size_t first = 0; first < state->blocks; first += batch) {
+		const size_t count = sprt::min(batch, state->blocks - first);
+
+		auto status = pool.perform(Rc<Task>::create([state, first, count](const Task &) {
+			for (size_t i = first; i < first + count; ++i) {
+				if (state->encoder.compressBlock(i) != Status::Ok) {
+					return false;
+				}
+			}
+			return true;
+		}, [state, count](const Task &, bool success) { state->complete(count, success); }, ref,
+				nullptr, "lz4_performCompress"));
+
+		if (status != Status::Ok) {
+			if (first == 0) {
+				return status;
+			}
+			state->complete(state->blocks - first, false);
+			break;
+		}
+	}
+
+	return Status::Ok;
+}
+
 } // namespace sprt
@@ -20,10 +20,13 @@
  THE SOFTWARE.
  **/
 
-#include <sprt/runtime/hash.h>
 #include <sprt/runtime/utils/byteorder.h>
+#include <sprt/runtime/utils/tree_hash.h>
+#include <sprt/runtime/dispatch/thread_pool.h>
 #include <sprt/c/__sprt_string.h>
 
+#include "private/SPRTHash.h"
+
 namespace sprt::sha1 {
 
 /* SHA f()-functions */
@@ -48,74 +51,63 @@ static constexpr uint32_t SHA_BLOCKSIZE = 64;
 	temp = ROT32(A,5) + f##n(B,C,D) + E + W[i] + CONST##n; \
 	E = D; D = C; C = ROT32(B,30); B = A; A = temp
 
-/* do SHA transformation */
-static void sha_transform(Ctx &sha_info) {
+/* do SHA transformation, data is in message byte order */
+static void sha_transform(uint32_t digest[5], const uint8_t *data, size_t blocks) {
 	int i;
 	uint32_t temp, A, B, C, D, E, W[80];
 
-	for (i = 0; i < 16; ++i) { W[i] = sha_info.data[i]; }
-	for (i = 16; i < 80; ++i) {
-		W[i] = W[i - 3] ^ W[i - 8] ^ W[i - 14] ^ W[i - 16];
+	while (blocks-- > 0) {
+		for (i = 0; i < 16; ++i) {
+			W[i] = (uint32_t(data[i * 4]) << 24) | (uint32_t(data[i * 4 + 1]) << 16)
+					| (uint32_t(data[i * 4 + 2]) << 8) | uint32_t(data[i * 4 + 3]);
+		}
+		for (i = 16; i < 80; ++i) {
+			W[i] = W[i - 3] ^ W[i - 8] ^ W[i - 14] ^ W[i - 16];
 
-		W[i] = ROT32(W[i], 1);
-	}
+			W[i] = ROT32(W[i], 1);
+		}
 
-	A = sha_info.digest[0];
-	B = sha_info.digest[1];
-	C = sha_info.digest[2];
-	D = sha_info.digest[3];
-	E = sha_info.digest[4];
-
-	// clang-format off
-	FUNC(1, 0);  FUNC(1, 1);  FUNC(1, 2);  FUNC(1, 3);  FUNC(1, 4);
-	FUNC(1, 5);  FUNC(1, 6);  FUNC(1, 7);  FUNC(1, 8);  FUNC(1, 9);
-	FUNC(1,10);  FUNC(1,11);  FUNC(1,12);  FUNC(1,13);  FUNC(1,14);
-	FUNC(1,15);  FUNC(1,16);  FUNC(1,17);  FUNC(1,18);  FUNC(1,19);
-
-	FUNC(2,20);  FUNC(2,21);  FUNC(2,22);  FUNC(2,23);  FUNC(2,24);
-	FUNC(2,25);  FUNC(2,26);  FUNC(2,27);  FUNC(2,28);  FUNC(2,29);
-	FUNC(2,30);  FUNC(2,31);  FUNC(2,32);  FUNC(2,33);  FUNC(2,34);
-	FUNC(2,35);  FUNC(2,36);  FUNC(2,37);  FUNC(2,38);  FUNC(2,39);
-
-	FUNC(3,40);  FUNC(3,41);  FUNC(3,42);  FUNC(3,43);  FUNC(3,44);
-	FUNC(3,45);  FUNC(3,46);  FUNC(3,47);  FUNC(3,48);  FUNC(3,49);
-	FUNC(3,50);  FUNC(3,51);  FUNC(3,52);  FUNC(3,53);  FUNC(3,54);
-	FUNC(3,55);  FUNC(3,56);  FUNC(3,57);  FUNC(3,58);  FUNC(3,59);
-
-	FUNC(4,60);  FUNC(4,61);  FUNC(4,62);  FUNC(4,63);  FUNC(4,64);
-	FUNC(4,65);  FUNC(4,66);  FUNC(4,67);  FUNC(4,68);  FUNC(4,69);
-	FUNC(4,70);  FUNC(4,71);  FUNC(4,72);  FUNC(4,73);  FUNC(4,74);
-	FUNC(4,75);  FUNC(4,76);  FUNC(4,77);  FUNC(4,78);  FUNC(4,79);
-	// clang-format on
-
-	sha_info.digest[0] += A;
-	sha_info.digest[1] += B;
-	sha_info.digest[2] += C;
-	sha_info.digest[3] += D;
-	sha_info.digest[4] += E;
+		A = digest[0];
+		B = digest[1];
+		C = digest[2];
+		D = digest[3];
+		E = digest[4];
+
+		// clang-format off
+		FUNC(1, 0);  FUNC(1, 1);  FUNC(1, 2);  FUNC(1, 3);  FUNC(1, 4);
+		FUNC(1, 5);  FUNC(1, 6);  FUNC(1, 7);  FUNC(1, 8);  FUNC(1, 9);
+		FUNC(1,10);  FUNC(1,11);  FUNC(1,12);  FUNC(1,13);  FUNC(1,14);
+		FUNC(1,15);  FUNC(1,16);  FUNC(1,17);  FUNC(1,18);  FUNC(1,19);
+
+		FUNC(2,20);  FUNC(2,21);  FUNC(2,22);  FUNC(2,23);  FUNC(2,24);
+		FUNC(2,25);  FUNC(2,26);  FUNC(2,27);  FUNC(2,28);  FUNC(2,29);
+		FUNC(2,30);  FUNC(2,31);  FUNC(2,32);  FUNC(2,33);  FUNC(2,34);
+		FUNC(2,35);  FUNC(2,36);  FUNC(2,37);  FUNC(2,38);  FUNC(2,39);
+
+		FUNC(3,40);  FUNC(3,41);  FUNC(3,42);  FUNC(3,43);  FUNC(3,44);
+		FUNC(3,45);  FUNC(3,46);  FUNC(3,47);  FUNC(3,48);  FUNC(3,49);
+		FUNC(3,50);  FUNC(3,51);  FUNC(3,52);  FUNC(3,53);  FUNC(3,54);
+		FUNC(3,55);  FUNC(3,56);  FUNC(3,57);  FUNC(3,58);  FUNC(3,59);
+
+		FUNC(4,60);  FUNC(4,61);  FUNC(4,62);  FUNC(4,63);  FUNC(4,64);
+		FUNC(4,65);  FUNC(4,66);  FUNC(4,67);  FUNC(4,68);  FUNC(4,69);
+		FUNC(4,70);  FUNC(4,71);  FUNC(4,72);  FUNC(4,73);  FUNC(4,74);
+		FUNC(4,75);  FUNC(4,76);  FUNC(4,77);  FUNC(4,78);  FUNC(4,79);
+		// clang-format on
+
+		digest[0] += A;
+		digest[1] += B;
+		digest[2] += C;
+		digest[3] += D;
+		digest[4] += E;
+
+		data += SHA_BLOCKSIZE;
+	}
 }
 
-/* count is the number of bytes to do an endian flip */
-static void maybe_byte_reverse(uint32_t *buffer, int count) {
-	int i;
-	uint8_t ct[4], *cp;
-
-	/* do the swap only if it is little endian */
-	if constexpr (endian::native == endian::little) {
-		count /= sizeof(uint32_t);
-		cp = reinterpret_cast<uint8_t *>(buffer);
-		for (i = 0; i < count; ++i) {
-			ct[0] = cp[0];
-			ct[1] = cp[1];
-			ct[2] = cp[2];
-			ct[3] = cp[3];
-			cp[0] = ct[3];
-			cp[1] = ct[2];
-			cp[2] = ct[1];
-			cp[3] = ct[0];
-			cp += sizeof(uint32_t);
-		}
-	}
+static detail::BlockFn getBlockFn() {
+	static detail::BlockFn fn = detail::getAcceleratedBlockFn();
+	return fn ? fn : &sha_transform;
 }
 
 void sha_init(Ctx &sha_info) {
@@ -131,6 +123,8 @@ void sha_init(Ctx &sha_info) {
 
 void sha_process(Ctx &sha_info, const uint8_t *buffer, uint32_t count) {
 	unsigned int i;
+	auto data = reinterpret_cast<uint8_t *>(sha_info.data);
+	auto transform = getBlockFn();
 
 	if ((sha_info.count_lo + (count << 3)) < sha_info.count_lo) {
 		++sha_info.count_hi;
@@ -142,49 +136,48 @@ void sha_process(Ctx &sha_info, const uint8_t *buffer, uint32_t count) {
 		if (i > count) {
 			i = count;
 		}
-		__sprt_memcpy(reinterpret_cast<uint8_t *>(sha_info.data) + sha_info.local, buffer, i);
+		__sprt_memcpy(data + sha_info.local, buffer, i);
 		count -= i;
 		buffer += i;
 		sha_info.local += i;
 		if (sha_info.local == SHA_BLOCKSIZE) {
-			maybe_byte_reverse(sha_info.data, SHA_BLOCKSIZE);
-			sha_transform(sha_info);
+			transform(sha_info.digest, data, 1);
 		} else {
 			return;
 		}
 	}
-	while (count >= SHA_BLOCKSIZE) {
-		__sprt_memcpy(sha_info.data, buffer, SHA_BLOCKSIZE);
-		buffer += SHA_BLOCKSIZE;
-		count -= SHA_BLOCKSIZE;
-		maybe_byte_reverse(sha_info.data, SHA_BLOCKSIZE);
-		sha_transform(sha_info);
+	if (count >= SHA_BLOCKSIZE) {
+		// full blocks are hashed directly from the input
+		transform(sha_info.digest, buffer, count / SHA_BLOCKSIZE);
+		buffer += count & ~(SHA_BLOCKSIZE - 1);
+		count &= SHA_BLOCKSIZE - 1;
 	}
-	__sprt_memcpy(sha_info.data, buffer, count);
+	__sprt_memcpy(data, buffer, count);
 	sha_info.local = count;
 }
 
 void sha_done(Ctx &sha_info, uint8_t digest[Length]) {
 	int count, i, j;
 	uint32_t lo_bit_count, hi_bit_count, k;
+	auto data = reinterpret_cast<uint8_t *>(sha_info.data);
+	auto transform = getBlockFn();
 
 	lo_bit_count = sha_info.count_lo;
 	hi_bit_count = sha_info.count_hi;
 	count = int32_t((lo_bit_count >> 3) & 0x3f);
-	reinterpret_cast<uint8_t *>(sha_info.data)[count++] = 0x80;
+	data[count++] = 0x80;
 	if (count > int(SHA_BLOCKSIZE - 8)) {
-		__sprt_memset(reinterpret_cast<uint8_t *>(sha_info.data) + count, 0, SHA_BLOCKSIZE - count);
-		maybe_byte_reverse(sha_info.data, SHA_BLOCKSIZE);
-		sha_transform(sha_info);
-		__sprt_memset(reinterpret_cast<uint8_t *>(sha_info.data), 0, SHA_BLOCKSIZE - 8);
+		__sprt_memset(data + count, 0, SHA_BLOCKSIZE - count);
+		transform(sha_info.digest, data, 1);
+		__sprt_memset(data, 0, SHA_BLOCKSIZE - 8);
 	} else {
-		__sprt_memset(reinterpret_cast<uint8_t *>(sha_info.data) + count, 0,
-				SHA_BLOCKSIZE - 8 - count);
+		__sprt_memset(data + count, 0, SHA_BLOCKSIZE - 8 - count);
+	}
+	for (i = 0; i < 4; ++i) {
+		data[SHA_BLOCKSIZE - 8 + i] = uint8_t((hi_bit_count >> ((3 - i) * 8)) & 0xff);
+		data[SHA_BLOCKSIZE - 4 + i] = uint8_t((lo_bit_count >> ((3 - i) * 8)) & 0xff);
 	}
-	maybe_byte_reverse(sha_info.data, SHA_BLOCKSIZE);
-	sha_info.data[14] = hi_bit_count;
-	sha_info.data[15] = lo_bit_count;
-	sha_transform(sha_info);
+	transform(sha_info.digest, data, 1);
 
 	for (i = 0, j = 0; j < int(Length); i++) {
 		k = sha_info.digest[i];
@@ -206,7 +199,7 @@ typedef uint64_t u64;
 
 // clang-format off
 
-static const u32 K[64] = {
+alignas(16) const u32 detail::K[64] = {
     0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL,
     0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL, 0xd807aa98UL, 0x12835b01UL,
     0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL,
@@ -224,6 +217,8 @@ static const u32 K[64] = {
 
 // clang-format on
 
+using detail::K;
+
 static u32 sha_min(u32 x, u32 y) { return x < y ? x : y; }
 
 static u32 load32(const unsigned char *y) {
@@ -247,43 +242,52 @@ static u32 Sigma1(u32 x) { return Rot(x, 6) ^ Rot(x, 11) ^ Rot(x, 25); }
 static u32 Gamma0(u32 x) { return Rot(x, 7) ^ Rot(x, 18) ^ Sh(x, 3); }
 static u32 Gamma1(u32 x) { return Rot(x, 17) ^ Rot(x, 19) ^ Sh(x, 10); }
 
-static void sha_compress(sha256_state &md, const unsigned char *buf) {
+static void sha_compress(u32 state[8], const uint8_t *buf, size_t blocks) {
 	u32 S[8], W[64], t0, t1, t;
 
-	// Copy state into S
-	for (int i = 0; i < 8; i++) { S[i] = md.state[i]; }
+	while (blocks-- > 0) {
+		// Copy state into S
+		for (int i = 0; i < 8; i++) { S[i] = state[i]; }
 
-	// Copy the state into 512-bits into W[0..15]
-	for (int i = 0; i < 16; i++) { W[i] = load32(buf + (4 * i)); }
+		// Copy the state into 512-bits into W[0..15]
+		for (int i = 0; i < 16; i++) { W[i] = load32(buf + (4 * i)); }
 
-	// Fill W[16..63]
-	for (int i = 16; i < 64; i++) {
-		W[i] = Gamma1(W[i - 2]) + W[i - 7] + Gamma0(W[i - 15]) + W[i - 16];
-	}
+		// Fill W[16..63]
+		for (int i = 16; i < 64; i++) {
+			W[i] = Gamma1(W[i - 2]) + W[i - 7] + Gamma0(W[i - 15]) + W[i - 16];
+		}
 
-	// Compress
-	auto RND = [&](u32 a, u32 b, u32 c, u32 &d, u32 e, u32 f, u32 g, u32 &h, u32 i) {
-		t0 = h + Sigma1(e) + Ch(e, f, g) + K[i] + W[i];
-		t1 = Sigma0(a) + Maj(a, b, c);
-		d += t0;
-		h = t0 + t1;
-	};
+		// Compress
+		auto RND = [&](u32 a, u32 b, u32 c, u32 &d, u32 e, u32 f, u32 g, u32 &h, u32 i) {
+			t0 = h + Sigma1(e) + Ch(e, f, g) + K[i] + W[i];
+			t1 = Sigma0(a) + Maj(a, b, c);
+			d += t0;
+			h = t0 + t1;
+		};
+
+		for (int i = 0; i < 64; ++i) {
+			RND(S[0], S[1], S[2], S[3], S[4], S[5], S[6], S[7], i);
+			t = S[7];
+			S[7] = S[6];
+			S[6] = S[5];
+			S[5] = S[4];
+			S[4] = S[3];
+			S[3] = S[2];
+			S[2] = S[1];
+			S[1] = S[0];
+			S[0] = t;
+		}
+
+		// Feedback
+		for (int i = 0; i < 8; i++) { state[i] = state[i] + S[i]; }
 
-	for (int i = 0; i < 64; ++i) {
-		RND(S[0], S[1], S[2], S[3], S[4], S[5], S[6], S[7], i);
-		t = S[7];
-		S[7] = S[6];
-		S[6] = S[5];
-		S[5] = S[4];
-		S[4] = S[3];
-		S[3] = S[2];
-		S[2] = S[1];
-		S[1] = S[0];
-		S[0] = t;
+		buf += 64;
 	}
+}
 
-	// Feedback
-	for (int i = 0; i < 8; i++) { md.state[i] = md.state[i] + S[i]; }
+static detail::BlockFn getBlockFn() {
+	static detail::BlockFn fn = detail::getAcceleratedBlockFn();
+	return fn ? fn : &sha_compress;
 }
 
 // Public interface
@@ -304,13 +308,16 @@ void sha_init(sha256_state &md) {
 void sha_process(sha256_state &md, const uint8_t *src, uint32_t inlen) {
 	const u32 block_size = sizeof(sha256_state::buf);
 	auto in = static_cast<const unsigned char *>(src);
+	auto compress = getBlockFn();
 
 	while (inlen > 0) {
 		if (md.curlen == 0 && inlen >= block_size) {
-			sha_compress(md, in);
-			md.length += block_size * 8;
-			in += block_size;
-			inlen -= block_size;
+			// full blocks are hashed directly from the input
+			const u32 blocks = inlen / block_size;
+			compress(md.state, in, blocks);
+			md.length += u64(blocks) * block_size * 8;
+			in += blocks * block_size;
+			inlen -= blocks * block_size;
 		} else {
 			u32 n = sha_min(inlen, (block_size - md.curlen));
 			::__sprt_memcpy(md.buf + md.curlen, in, n);
@@ -319,7 +326,7 @@ void sha_process(sha256_state &md, const uint8_t *src, uint32_t inlen) {
 			inlen -= n;
 
 			if (md.curlen == block_size) {
-				sha_compress(md, md.buf);
+				compress(md.state, md.buf, 1);
 				md.length += 8 * block_size;
 				md.curlen = 0;
 			}
@@ -328,6 +335,8 @@ void sha_process(sha256_state &md, const uint8_t *src, uint32_t inlen) {
 }
 
 void sha_done(sha256_state &md, uint8_t out[Length]) {
+	auto compress = getBlockFn();
+
 	// Increase the length of the message
 	md.length += md.curlen * 8;
 
@@ -338,7 +347,7 @@ void sha_done(sha256_state &md, uint8_t out[Length]) {
 	// Then we can fall back to padding zeros and length encoding like normal.
 	if (md.curlen > 56) {
 		while (md.curlen < 64) { md.buf[md.curlen++] = 0; }
-		sha_compress(md, md.buf);
+		compress(md.state, md.buf, 1);
 		md.curlen = 0;
 	}
 
@@ -347,7 +356,7 @@ void sha_done(sha256_state &md, uint8_t out[Length]) {
 
 	// Store length
 	store64(md.length, md.buf + 56);
-	sha_compress(md, md.buf);
+	compress(md.state, md.buf, 1);
 
 	// Copy output
 	for (int i = 0; i < 8; i++) {
@@ -355,6 +364,158 @@ void sha_done(sha256_state &md, uint8_t out[Length]) {
 	}
 }
 
+void sha_multi(const uint8_t *const src[], const size_t inlen[], uint8_t out[][Length],
+		uint32_t count) {
+	// finish message from the intermediate state with the best single-buffer function
+	auto finalize = [](const u32 *state, size_t stride, size_t blocks, const uint8_t *data,
+							size_t len, uint8_t *out) {
+		sha256_state md;
+		for (int i = 0; i < 8; i++) { md.state[i] = state[i * stride]; }
+		md.length = u64(blocks) * 64 * 8;
+		md.curlen = 0;
+
+		data += blocks * 64;
+		len -= blocks * 64;
+		while (len > 0) {
+			auto n = uint32_t(len < (size_t(1) << 30) ? len : (size_t(1) << 30));
+			sha_process(md, data, n);
+			data += n;
+			len -= n;
+		}
+		sha_done(md, out);
+	};
+
+	if (auto multi = detail::getMultiBlockFn()) {
+		// with less messages parallel lanes are wasted, and sequential hashing is faster
+		while (count >= MultiBufferLanes / 2) {
+			const uint32_t lanes = sha_min(count, MultiBufferLanes);
+			const uint8_t *data[MultiBufferLanes];
+			size_t blocks = ~size_t(0);
+
+			for (uint32_t j = 0; j < MultiBufferLanes; ++j) {
+				// unused lanes repeat the first message
+				data[j] = src[j < lanes ? j : 0];
+				const size_t laneBlocks = inlen[j < lanes ? j : 0] / 64;
+				if (laneBlocks < blocks) {
+					blocks = laneBlocks;
+				}
+			}
+
+			alignas(32) u32 state[8 * MultiBufferLanes];
+			sha256_state init;
+			sha_init(init);
+			for (uint32_t i = 0; i < 8; ++i) {
+				for (uint32_t j = 0; j < MultiBufferLanes; ++j) {
+					state[i * MultiBufferLanes + j] = init.state[i];
+				}
+			}
+
+			if (blocks > 0) {
+				multi(state, data, blocks);
+			}
+
+			for (uint32_t j = 0; j < lanes; ++j) {
+				finalize(state + j, MultiBufferLanes, blocks, src[j], inlen[j], out[j]);
+			}
+
+			src += lanes;
+			inlen += lanes;
+			out += lanes;
+			count -= lanes;
+		}
+	}
+
+	sha256_state init;
+	sha_init(init);
+	for (uint32_t j = 0; j < count; ++j) { finalize(init.state, 1, 0, src[j], inlen[j], out[j]); }
+}
+
+Status performTreeHash(dispatch::ThreadPool &pool, BytesView data,
+		dispatch::Function<void(Status, BytesView)> &&cb, size_t chunkSize, Ref *ref) {
+	using dispatch::Task;
+
+	if (!cb || chunkSize == 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	struct TreeHashState : Ref {
+		BytesView data;
+		size_t chunkSize = 0;
+		size_t chunks = 0;
+		dispatch::Vector<uint8_t> digests;
+		uint8_t root[Length];
+		sprt::atomic<size_t> executed = 0;
+		sprt::atomic<size_t> completed = 0;
+		sprt::atomic<bool> failed = false;
+		dispatch::Function<void(Status, BytesView)> callback;
+
+		void complete(size_t count, bool success) {
+			if (!success) {
+				failed = true;
+			}
+			if (completed.fetch_add(count) + count == chunks) {
+				if (failed.load()) {
+					callback(Status::ErrorCancelled, BytesView());
+				} else {
+					callback(Status::Ok, BytesView(root, Length));
+				}
+			}
+		}
+	};
+
+	auto state = Rc<TreeHashState>::alloc();
+	state->data = data;
+	state->chunkSize = chunkSize;
+	state->chunks = sprt::max((data.size() + chunkSize - 1) / chunkSize, size_t(1));
+	state->digests.resize(state->chunks * Length);
+	state->callback = sprt::move(cb);
+
+	// Every task hashes a batch of chunks with sha_multi to use parallel lanes when
+	// available, but batches should be small enough to load all workers
+	const size_t threads = sprt::max(size_t(pool.getInfo().threadCount), size_t(1));
+	const size_t batch =
+			sprt::min(sprt::max(state->chunks / threads, size_t(1)), size_t(MultiBufferLanes));
+
+	for (size_t first = 0; first < state->chunks; first += batch) {
+		const size_t count = sprt::min(batch, state->chunks - first);
+
+		auto status = pool.perform(Rc<Task>::create([state, first, count](const Task &) {
+			const uint8_t *src[MultiBufferLanes];
+			size_t len[MultiBufferLanes];
+			for (size_t i = 0; i < count; ++i) {
+				const size_t offset = (first + i) * state->chunkSize;
+				src[i] = state->data.data() + offset;
+				len[i] = sprt::min(state->chunkSize, state->data.size() - offset);
+			}
+
+			sha_multi(src, len,
+					reinterpret_cast<uint8_t(*)[Length]>(state->digests.data() + first * Length),
+					uint32_t(count));
+
+			// the last executed batch computes root
+			if (state->executed.fetch_add(count) + count == state->chunks) {
+				Ctx ctx;
+				sha_init(ctx);
+				sha_process(ctx, state->digests.data(), uint32_t(state->digests.size()));
+				sha_done(ctx, state->root);
+			}
+			return true;
+		}, [state, count](const Task &, bool success) { state->complete(count, success); }, ref,
+				nullptr, "sha256::performTreeHash"));
+
+		if (status != Status::Ok) {
+			if (first == 0) {
+				return status;
+			}
+			// batches, that were not scheduled, are failed
+			state->complete(state->chunks - first, false);
+			break;
+		}
+	}
+
+	return Status::Ok;
+}
+
 } // namespace sprt::sha256
 
 namespace sprt::sha512 {
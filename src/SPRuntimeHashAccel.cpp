@@ -0,0 +1,533 @@
+/**
+ Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include "private/SPRTHash.h"
+
+// Hardware SHA kernels are selected at runtime, so they are compiled with target attributes
+// and native intrinsics instead of SIMDe, which can only use extensions enabled for the whole TU
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SPRT_SHA_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define SPRT_SHA_ARM 1
+#include <arm_neon.h>
+#if SPRT_LINUX || SPRT_ANDROID
+#include <sys/auxv.h>
+#endif
+#if __clang__
+#define SPRT_SHA_ARM_TARGET __attribute__((target("sha2")))
+#else
+#define SPRT_SHA_ARM_TARGET __attribute__((target("+sha2")))
+#endif
+#endif
+
+namespace sprt::sha {
+
+struct CpuFeatures {
+	bool sha1 = false;
+	bool sha256 = false;
+	bool avx2 = false;
+};
+
+#if SPRT_SHA_X86
+
+static CpuFeatures detectCpuFeatures() {
+	CpuFeatures ret;
+	unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return ret;
+	}
+
+	const bool ssse3 = (ecx & bit_SSSE3) != 0;
+	const bool sse41 = (ecx & bit_SSE4_1) != 0;
+	const bool avx = (ecx & bit_AVX) != 0 && (ecx & bit_OSXSAVE) != 0;
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+		return ret;
+	}
+
+	ret.sha1 = ret.sha256 = ssse3 && sse41 && (ebx & bit_SHA) != 0;
+
+	if (avx && (ebx & bit_AVX2) != 0) {
+		// OS should save YMM state on context switch
+		uint32_t xcr0lo = 0, xcr0hi = 0;
+		__asm__ volatile("xgetbv" : "=a"(xcr0lo), "=d"(xcr0hi) : "c"(0));
+		ret.avx2 = (xcr0lo & 0x6) == 0x6;
+	}
+	return ret;
+}
+
+#elif SPRT_SHA_ARM
+
+static CpuFeatures detectCpuFeatures() {
+	CpuFeatures ret;
+#if SPRT_MACOS
+	// every Apple arm64 CPU implements crypto extensions
+	ret.sha1 = ret.sha256 = true;
+#elif SPRT_LINUX || SPRT_ANDROID
+	auto hwcap = getauxval(AT_HWCAP);
+	ret.sha1 = (hwcap & (1 << 5)) != 0; // HWCAP_SHA1
+	ret.sha256 = (hwcap & (1 << 6)) != 0; // HWCAP_SHA2
+#elif defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+	ret.sha1 = ret.sha256 = true;
+#endif
+	return ret;
+}
+
+#else
+
+static CpuFeatures detectCpuFeatures() { return CpuFeatures(); }
+
+#endif
+
+static const CpuFeatures &getCpuFeatures() {
+	static CpuFeatures features = detectCpuFeatures();
+	return features;
+}
+
+} // namespace sprt::sha
+
+
+namespace sprt::sha1::detail {
+
+#if SPRT_SHA_X86
+
+// Every 4 rounds share one message vector; messages for the next rounds are computed
+// from the four previous vectors with sha1msg1/sha1msg2
+#define SHA1_NI_ROUNDS(ecur, enext, m0, m1, m2, m3, func) \
+	ecur = _mm_sha1nexte_epu32(ecur, m0); \
+	enext = abcd; \
+	m1 = _mm_sha1msg2_epu32(m1, m0); \
+	abcd = _mm_sha1rnds4_epu32(abcd, ecur, func); \
+	m3 = _mm_sha1msg1_epu32(m3, m0); \
+	m2 = _mm_xor_si128(m2, m0)
+
+__attribute__((target("sha,sse4.1,ssse3"))) static void sha1_blocks_ni(uint32_t digest[5],
+		const uint8_t *data, size_t blocks) {
+	const __m128i mask = _mm_set_epi64x(0x0001'0203'0405'0607ULL, 0x0809'0A0B'0C0D'0E0FULL);
+
+	__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)digest), 0x1B);
+	__m128i e0 = _mm_set_epi32(int(digest[4]), 0, 0, 0);
+	__m128i e1, m0, m1, m2, m3;
+
+	while (blocks-- > 0) {
+		const __m128i abcdSave = abcd;
+		const __m128i eSave = e0;
+
+		// Rounds 0-11 load message words
+		m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), mask);
+		e0 = _mm_add_epi32(e0, m0);
+		e1 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+		m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), mask);
+		e1 = _mm_sha1nexte_epu32(e1, m1);
+		e0 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+		m0 = _mm_sha1msg1_epu32(m0, m1);
+
+		m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), mask);
+		e0 = _mm_sha1nexte_epu32(e0, m2);
+		e1 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+		m1 = _mm_sha1msg1_epu32(m1, m2);
+		m0 = _mm_xor_si128(m0, m2);
+
+		m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+
+		// clang-format off
+		SHA1_NI_ROUNDS(e1, e0, m3, m0, m1, m2, 0); // 12-15
+		SHA1_NI_ROUNDS(e0, e1, m0, m1, m2, m3, 0); // 16-19
+		SHA1_NI_ROUNDS(e1, e0, m1, m2, m3, m0, 1); // 20-23
+		SHA1_NI_ROUNDS(e0, e1, m2, m3, m0, m1, 1);
+		SHA1_NI_ROUNDS(e1, e0, m3, m0, m1, m2, 1);
+		SHA1_NI_ROUNDS(e0, e1, m0, m1, m2, m3, 1);
+		SHA1_NI_ROUNDS(e1, e0, m1, m2, m3, m0, 1); // 36-39
+		SHA1_NI_ROUNDS(e0, e1, m2, m3, m0, m1, 2); // 40-43
+		SHA1_NI_ROUNDS(e1, e0, m3, m0, m1, m2, 2);
+		SHA1_NI_ROUNDS(e0, e1, m0, m1, m2, m3, 2);
+		SHA1_NI_ROUNDS(e1, e0, m1, m2, m3, m0, 2);
+		SHA1_NI_ROUNDS(e0, e1, m2, m3, m0, m1, 2); // 56-59
+		SHA1_NI_ROUNDS(e1, e0, m3, m0, m1, m2, 3); // 60-63
+		SHA1_NI_ROUNDS(e0, e1, m0, m1, m2, m3, 3);
+		SHA1_NI_ROUNDS(e1, e0, m1, m2, m3, m0, 3);
+		SHA1_NI_ROUNDS(e0, e1, m2, m3, m0, m1, 3);
+		// clang-format on
+
+		// Rounds 76-79, no more message words required
+		e1 = _mm_sha1nexte_epu32(e1, m3);
+		e0 = abcd;
+		abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+		e0 = _mm_sha1nexte_epu32(e0, eSave);
+		abcd = _mm_add_epi32(abcd, abcdSave);
+
+		data += 64;
+	}
+
+	_mm_storeu_si128((__m128i *)digest, _mm_shuffle_epi32(abcd, 0x1B));
+	digest[4] = uint32_t(_mm_extract_epi32(e0, 3));
+}
+
+#undef SHA1_NI_ROUNDS
+
+BlockFn getAcceleratedBlockFn() {
+	return sha::getCpuFeatures().sha1 ? &sha1_blocks_ni : nullptr;
+}
+
+#elif SPRT_SHA_ARM
+
+static constexpr uint32_t K[4] = {0x5A82'7999, 0x6ED9'EBA1, 0x8F1B'BCDC, 0xCA62'C1D6};
+
+#define SHA1_ARM_SCHEDULE(m0, m1, m2, m3) m0 = vsha1su1q_u32(vsha1su0q_u32(m0, m1, m2), m3)
+
+#define SHA1_ARM_ROUNDS(m, op, k) \
+	tmp = vaddq_u32(m, vdupq_n_u32(K[k])); \
+	enext = vsha1h_u32(vgetq_lane_u32(abcd, 0)); \
+	abcd = op(abcd, e, tmp); \
+	e = enext
+
+SPRT_SHA_ARM_TARGET static void sha1_blocks_arm(uint32_t digest[5],
+		const uint8_t *data, size_t blocks) {
+	uint32x4_t abcd = vld1q_u32(digest);
+	uint32_t e = digest[4];
+	uint32_t enext;
+	uint32x4_t tmp, m0, m1, m2, m3;
+
+	while (blocks-- > 0) {
+		const uint32x4_t abcdSave = abcd;
+		const uint32_t eSave = e;
+
+		m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+		m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+		m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+		m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+		// clang-format off
+		SHA1_ARM_ROUNDS(m0, vsha1cq_u32, 0);
+		SHA1_ARM_ROUNDS(m1, vsha1cq_u32, 0);
+		SHA1_ARM_ROUNDS(m2, vsha1cq_u32, 0);
+		SHA1_ARM_ROUNDS(m3, vsha1cq_u32, 0);
+		SHA1_ARM_SCHEDULE(m0, m1, m2, m3); SHA1_ARM_ROUNDS(m0, vsha1cq_u32, 0); // 16-19
+
+		SHA1_ARM_SCHEDULE(m1, m2, m3, m0); SHA1_ARM_ROUNDS(m1, vsha1pq_u32, 1); // 20-23
+		SHA1_ARM_SCHEDULE(m2, m3, m0, m1); SHA1_ARM_ROUNDS(m2, vsha1pq_u32, 1);
+		SHA1_ARM_SCHEDULE(m3, m0, m1, m2); SHA1_ARM_ROUNDS(m3, vsha1pq_u32, 1);
+		SHA1_ARM_SCHEDULE(m0, m1, m2, m3); SHA1_ARM_ROUNDS(m0, vsha1pq_u32, 1);
+		SHA1_ARM_SCHEDULE(m1, m2, m3, m0); SHA1_ARM_ROUNDS(m1, vsha1pq_u32, 1);
+
+		SHA1_ARM_SCHEDULE(m2, m3, m0, m1); SHA1_ARM_ROUNDS(m2, vsha1mq_u32, 2); // 40-43
+		SHA1_ARM_SCHEDULE(m3, m0, m1, m2); SHA1_ARM_ROUNDS(m3, vsha1mq_u32, 2);
+		SHA1_ARM_SCHEDULE(m0, m1, m2, m3); SHA1_ARM_ROUNDS(m0, vsha1mq_u32, 2);
+		SHA1_ARM_SCHEDULE(m1, m2, m3, m0); SHA1_ARM_ROUNDS(m1, vsha1mq_u32, 2);
+		SHA1_ARM_SCHEDULE(m2, m3, m0, m1); SHA1_ARM_ROUNDS(m2, vsha1mq_u32, 2);
+
+		SHA1_ARM_SCHEDULE(m3, m0, m1, m2); SHA1_ARM_ROUNDS(m3, vsha1pq_u32, 3); // 60-63
+		SHA1_ARM_SCHEDULE(m0, m1, m2, m3); SHA1_ARM_ROUNDS(m0, vsha1pq_u32, 3);
+		SHA1_ARM_SCHEDULE(m1, m2, m3, m0); SHA1_ARM_ROUNDS(m1, vsha1pq_u32, 3);
+		SHA1_ARM_SCHEDULE(m2, m3, m0, m1); SHA1_ARM_ROUNDS(m2, vsha1pq_u32, 3);
+		SHA1_ARM_SCHEDULE(m3, m0, m1, m2); SHA1_ARM_ROUNDS(m3, vsha1pq_u32, 3);
+		// clang-format on
+
+		abcd = vaddq_u32(abcd, abcdSave);
+		e += eSave;
+
+		data += 64;
+	}
+
+	vst1q_u32(digest, abcd);
+	digest[4] = e;
+}
+
+#undef SHA1_ARM_SCHEDULE
+#undef SHA1_ARM_ROUNDS
+
+BlockFn getAcceleratedBlockFn() {
+	return sha::getCpuFeatures().sha1 ? &sha1_blocks_arm : nullptr;
+}
+
+#else
+
+BlockFn getAcceleratedBlockFn() { return nullptr; }
+
+#endif
+
+} // namespace sprt::sha1::detail
+
+
+namespace sprt::sha256::detail {
+
+#if SPRT_SHA_X86
+
+// new m0 = W[i] from m0 = W[i-4], m1 = W[i-3], m2 = W[i-2], m3 = W[i-1]
+#define SHA256_NI_SCHEDULE(m0, m1, m2, m3) \
+	m0 = _mm_sha256msg2_epu32( \
+			_mm_add_epi32(_mm_sha256msg1_epu32(m0, m1), _mm_alignr_epi8(m3, m2, 4)), m3)
+
+#define SHA256_NI_ROUNDS(m, k) \
+	tmp = _mm_add_epi32(m, _mm_loadu_si128((const __m128i *)&K[k])); \
+	state1 = _mm_sha256rnds2_epu32(state1, state0, tmp); \
+	tmp = _mm_shuffle_epi32(tmp, 0x0E); \
+	state0 = _mm_sha256rnds2_epu32(state0, state1, tmp)
+
+__attribute__((target("sha,sse4.1,ssse3"))) static void sha256_blocks_ni(uint32_t state[8],
+		const uint8_t *data, size_t blocks) {
+	const __m128i mask = _mm_set_epi64x(0x0C0D'0E0F'0809'0A0BULL, 0x0405'0607'0001'0203ULL);
+
+	// sha256rnds2 works with ABEF/CDGH state layout
+	__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1); // CDAB
+	__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B); // EFGH
+	__m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+
+	__m128i m0, m1, m2, m3;
+
+	while (blocks-- > 0) {
+		const __m128i state0Save = state0;
+		const __m128i state1Save = state1;
+
+		m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 0)), mask);
+		SHA256_NI_ROUNDS(m0, 0);
+		m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), mask);
+		SHA256_NI_ROUNDS(m1, 4);
+		m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), mask);
+		SHA256_NI_ROUNDS(m2, 8);
+		m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+		SHA256_NI_ROUNDS(m3, 12);
+
+		for (uint32_t i = 16; i < 64; i += 16) {
+			SHA256_NI_SCHEDULE(m0, m1, m2, m3);
+			SHA256_NI_ROUNDS(m0, i);
+			SHA256_NI_SCHEDULE(m1, m2, m3, m0);
+			SHA256_NI_ROUNDS(m1, i + 4);
+			SHA256_NI_SCHEDULE(m2, m3, m0, m1);
+			SHA256_NI_ROUNDS(m2, i + 8);
+			SHA256_NI_SCHEDULE(m3, m0, m1, m2);
+			SHA256_NI_ROUNDS(m3, i + 12);
+		}
+
+		state0 = _mm_add_epi32(state0, state0Save);
+		state1 = _mm_add_epi32(state1, state1Save);
+
+		data += 64;
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B); // FEBA
+	state1 = _mm_shuffle_epi32(state1, 0xB1); // DCHG
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+	state1 = _mm_alignr_epi8(state1, tmp, 8); // HGFE
+
+	_mm_storeu_si128((__m128i *)&state[0], state0);
+	_mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#undef SHA256_NI_SCHEDULE
+#undef SHA256_NI_ROUNDS
+
+// 8-lane SHA-256: every vector holds the same word of 8 independent messages
+
+#define SHA256_X8_ROR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n))
+
+#define SHA256_X8_ROUND(a, b, c, d, e, f, g, h, i) \
+	t0 = _mm256_add_epi32(_mm256_add_epi32(h, _mm256_set1_epi32(int(K[i]))), w[(i) & 15]); \
+	t0 = _mm256_add_epi32(t0, \
+			_mm256_xor_si256(_mm256_xor_si256(SHA256_X8_ROR(e, 6), SHA256_X8_ROR(e, 11)), \
+					SHA256_X8_ROR(e, 25))); \
+	t0 = _mm256_add_epi32(t0, _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)))); \
+	t1 = _mm256_xor_si256(_mm256_xor_si256(SHA256_X8_ROR(a, 2), SHA256_X8_ROR(a, 13)), \
+			SHA256_X8_ROR(a, 22)); \
+	t1 = _mm256_add_epi32(t1, \
+			_mm256_or_si256(_mm256_and_si256(_mm256_or_si256(a, b), c), _mm256_and_si256(a, b))); \
+	d = _mm256_add_epi32(d, t0); \
+	h = _mm256_add_epi32(t0, t1)
+
+__attribute__((target("avx2"))) static inline void sha256_x8_transpose(__m256i out[8],
+		const uint8_t *const data[MultiBufferLanes], size_t offset) {
+	const __m256i bswap = _mm256_set_epi64x(0x0C0D'0E0F'0809'0A0BULL, 0x0405'0607'0001'0203ULL,
+			0x0C0D'0E0F'0809'0A0BULL, 0x0405'0607'0001'0203ULL);
+
+	__m256i r[8], t[8];
+	for (uint32_t j = 0; j < 8; ++j) {
+		r[j] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(data[j] + offset)), bswap);
+	}
+
+	for (uint32_t j = 0; j < 8; j += 2) {
+		t[j] = _mm256_unpacklo_epi32(r[j], r[j + 1]);
+		t[j + 1] = _mm256_unpackhi_epi32(r[j], r[j + 1]);
+	}
+
+	r[0] = _mm256_unpacklo_epi64(t[0], t[2]);
+	r[1] = _mm256_unpackhi_epi64(t[0], t[2]);
+	r[2] = _mm256_unpacklo_epi64(t[1], t[3]);
+	r[3] = _mm256_unpackhi_epi64(t[1], t[3]);
+	r[4] = _mm256_unpacklo_epi64(t[4], t[6]);
+	r[5] = _mm256_unpackhi_epi64(t[4], t[6]);
+	r[6] = _mm256_unpacklo_epi64(t[5], t[7]);
+	r[7] = _mm256_unpackhi_epi64(t[5], t[7]);
+
+	for (uint32_t j = 0; j < 4; ++j) {
+		out[j] = _mm256_permute2x128_si256(r[j], r[j + 4], 0x20);
+		out[j + 4] = _mm256_permute2x128_si256(r[j], r[j + 4], 0x31);
+	}
+}
+
+__attribute__((target("avx2"))) static void sha256_blocks_x8(uint32_t state[8 * MultiBufferLanes],
+		const uint8_t *const data[MultiBufferLanes], size_t blocks) {
+	__m256i s[8], w[16], t0, t1;
+
+	for (uint32_t i = 0; i < 8; ++i) {
+		s[i] = _mm256_loadu_si256((const __m256i *)(state + i * MultiBufferLanes));
+	}
+
+	for (size_t block = 0; block < blocks; ++block) {
+		__m256i a = s[0], b = s[1], c = s[2], d = s[3], e = s[4], f = s[5], g = s[6], h = s[7];
+
+		sha256_x8_transpose(w, data, block * 64);
+		sha256_x8_transpose(w + 8, data, block * 64 + 32);
+
+		for (uint32_t i = 0; i < 64; i += 8) {
+			if (i >= 16) {
+				for (uint32_t j = i; j < i + 8; ++j) {
+					auto w2 = w[(j - 2) & 15];
+					auto w15 = w[(j - 15) & 15];
+					auto gamma1 = _mm256_xor_si256(
+							_mm256_xor_si256(SHA256_X8_ROR(w2, 17), SHA256_X8_ROR(w2, 19)),
+							_mm256_srli_epi32(w2, 10));
+					auto gamma0 = _mm256_xor_si256(
+							_mm256_xor_si256(SHA256_X8_ROR(w15, 7), SHA256_X8_ROR(w15, 18)),
+							_mm256_srli_epi32(w15, 3));
+					w[j & 15] = _mm256_add_epi32(_mm256_add_epi32(gamma1, w[(j - 7) & 15]),
+							_mm256_add_epi32(gamma0, w[j & 15]));
+				}
+			}
+
+			SHA256_X8_ROUND(a, b, c, d, e, f, g, h, i + 0);
+			SHA256_X8_ROUND(h, a, b, c, d, e, f, g, i + 1);
+			SHA256_X8_ROUND(g, h, a, b, c, d, e, f, i + 2);
+			SHA256_X8_ROUND(f, g, h, a, b, c, d, e, i + 3);
+			SHA256_X8_ROUND(e, f, g, h, a, b, c, d, i + 4);
+			SHA256_X8_ROUND(d, e, f, g, h, a, b, c, i + 5);
+			SHA256_X8_ROUND(c, d, e, f, g, h, a, b, i + 6);
+			SHA256_X8_ROUND(b, c, d, e, f, g, h, a, i + 7);
+		}
+
+		s[0] = _mm256_add_epi32(s[0], a);
+		s[1] = _mm256_add_epi32(s[1], b);
+		s[2] = _mm256_add_epi32(s[2], c);
+		s[3] = _mm256_add_epi32(s[3], d);
+		s[4] = _mm256_add_epi32(s[4], e);
+		s[5] = _mm256_add_epi32(s[5], f);
+		s[6] = _mm256_add_epi32(s[6], g);
+		s[7] = _mm256_add_epi32(s[7], h);
+	}
+
+	for (uint32_t i = 0; i < 8; ++i) {
+		_mm256_storeu_si256((__m256i *)(state + i * MultiBufferLanes), s[i]);
+	}
+}
+
+#undef SHA256_X8_ROR
+#undef SHA256_X8_ROUND
+
+BlockFn getAcceleratedBlockFn() {
+	return sha::getCpuFeatures().sha256 ? &sha256_blocks_ni : nullptr;
+}
+
+MultiBlockFn getMultiBlockFn() {
+	// single SHA-NI stream is about as fast as 8 AVX2 lanes, and does not require
+	// lanes to be filled
+	auto &features = sha::getCpuFeatures();
+	return (features.avx2 && !features.sha256) ? &sha256_blocks_x8 : nullptr;
+}
+
+#elif SPRT_SHA_ARM
+
+#define SHA256_ARM_SCHEDULE(m0, m1, m2, m3) \
+	m0 = vsha256su1q_u32(vsha256su0q_u32(m0, m1), m2, m3)
+
+#define SHA256_ARM_ROUNDS(m, k) \
+	tmp = vaddq_u32(m, vld1q_u32(&K[k])); \
+	save = state0; \
+	state0 = vsha256hq_u32(state0, state1, tmp); \
+	state1 = vsha256h2q_u32(state1, save, tmp)
+
+SPRT_SHA_ARM_TARGET static void sha256_blocks_arm(uint32_t state[8],
+		const uint8_t *data, size_t blocks) {
+	uint32x4_t state0 = vld1q_u32(&state[0]);
+	uint32x4_t state1 = vld1q_u32(&state[4]);
+	uint32x4_t tmp, save, m0, m1, m2, m3;
+
+	while (blocks-- > 0) {
+		const uint32x4_t state0Save = state0;
+		const uint32x4_t state1Save = state1;
+
+		m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+		m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+		m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+		m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+		SHA256_ARM_ROUNDS(m0, 0);
+		SHA256_ARM_ROUNDS(m1, 4);
+		SHA256_ARM_ROUNDS(m2, 8);
+		SHA256_ARM_ROUNDS(m3, 12);
+
+		for (uint32_t i = 16; i < 64; i += 16) {
+			SHA256_ARM_SCHEDULE(m0, m1, m2, m3);
+			SHA256_ARM_ROUNDS(m0, i);
+			SHA256_ARM_SCHEDULE(m1, m2, m3, m0);
+			SHA256_ARM_ROUNDS(m1, i + 4);
+			SHA256_ARM_SCHEDULE(m2, m3, m0, m1);
+			SHA256_ARM_ROUNDS(m2, i + 8);
+			SHA256_ARM_SCHEDULE(m3, m0, m1, m2);
+			SHA256_ARM_ROUNDS(m3, i + 12);
+		}
+
+		state0 = vaddq_u32(state0, state0Save);
+		state1 = vaddq_u32(state1, state1Save);
+
+		data += 64;
+	}
+
+	vst1q_u32(&state[0], state0);
+	vst1q_u32(&state[4], state1);
+}
+
+#undef SHA256_ARM_SCHEDULE
+#undef SHA256_ARM_ROUNDS
+
+BlockFn getAcceleratedBlockFn() {
+	return sha::getCpuFeatures().sha256 ? &sha256_blocks_arm : nullptr;
+}
+
+MultiBlockFn getMultiBlockFn() { return nullptr; }
+
+#else
+
+BlockFn getAcceleratedBlockFn() { return nullptr; }
+
+MultiBlockFn getMultiBlockFn() { return nullptr; }
+
+#endif
+
+} // namespace sprt::sha256::detail
@@ -24,9 +24,8 @@
 #include <sprt/runtime/ref.h>
 #include <sprt/runtime/utils/backtrace.h>
 #include <sprt/c/__sprt_assert.h>
-#include <sprt/cxx/forward_list>
+#include <sprt/c/__sprt_string.h>
 #include <sprt/cxx/list>
-#include <sprt/cxx/map>
 #include <sprt/runtime/thread/qmutex.h>
 
 namespace sprt {
@@ -45,27 +44,114 @@ RefAlloc::RefAlloc() noexcept { }
 
 namespace sprt::memleak {
 
-static qmutex s_mutex;
+// Tracker data is sharded by the Ref address, every shard has its own lock.
+// Backtraces are stored as raw return addresses, symbolization is performed
+// only when backtraces are requested with foreachBacktrace.
+//
+// Shards are zero-initialized statically, so, tracker is usable before static constructors
+
+static constexpr uint32_t ShardsBits = 6;
+static constexpr uint32_t ShardsCount = 1 << ShardsBits;
+static constexpr uint32_t BucketsCount = 256; // per shard
+static constexpr uint32_t MaxFrames = 32;
+static constexpr uint32_t MaxFreeRecords = 256; // per shard
+
 static atomic<uint64_t> s_refId = 1;
+static atomic<uint32_t> s_sampleRate = 1;
+
+static thread_local uint32_t tl_sampleCounter = 0;
 
-struct BackraceInfo : detail::AllocPool {
-	time_t t = platform::clock(platform::ClockType::Monotonic);
-	memory::pool_t *pool = nullptr;
-	__pool_list<StringView> backtrace;
+struct BacktraceRecord {
+	BacktraceRecord *next;
+	uint64_t id;
+	time_t t;
+	uint32_t nframes;
+	uintptr_t frames[MaxFrames];
 };
 
-struct RefInfo : detail::AllocPool {
-	qmutex refMutex;
-	const Ref *ref = nullptr;
-	memory::pool_t *pool = nullptr;
-	__pool_map<uint64_t, BackraceInfo *> backtraces;
+struct RefRecord {
+	RefRecord *next;
+	const Ref *ref;
+	BacktraceRecord *backtraces;
 };
 
-static __pool_map<const Ref *, RefInfo *> s_retainMap =
-		__pool_map<const Ref *, RefInfo *>(memory::get_zero_pool());
+struct alignas(64) Shard {
+	qmutex mutex;
+	RefRecord *buckets[BucketsCount];
+	RefRecord *freeRefs;
+	BacktraceRecord *freeBacktraces;
+	uint32_t nFreeRefs;
+	uint32_t nFreeBacktraces;
+
+	RefRecord **findRef(const Ref *, uint32_t bucket);
+
+	RefRecord *allocRef();
+	void freeRef(RefRecord *);
+
+	BacktraceRecord *allocBacktrace();
+	void freeBacktrace(BacktraceRecord *);
+};
+
+static Shard s_shards[ShardsCount];
+
+static Shard &getShard(const Ref *ptr, uint32_t &bucket) {
+	auto h = uint64_t(uintptr_t(ptr)) * 0x9E37'79B9'7F4A'7C15ULL;
+	bucket = uint32_t((h >> 32) % BucketsCount);
+	return s_shards[h >> (64 - ShardsBits)];
+}
+
+RefRecord **Shard::findRef(const Ref *ptr, uint32_t bucket) {
+	auto ref = &buckets[bucket];
+	while (*ref && (*ref)->ref != ptr) { ref = &(*ref)->next; }
+	return ref;
+}
+
+RefRecord *Shard::allocRef() {
+	if (freeRefs) {
+		auto ret = freeRefs;
+		freeRefs = ret->next;
+		--nFreeRefs;
+		return ret;
+	}
+	return reinterpret_cast<RefRecord *>(__sprt_malloc(sizeof(RefRecord)));
+}
+
+void Shard::freeRef(RefRecord *rec) {
+	if (nFreeRefs < MaxFreeRecords) {
+		rec->next = freeRefs;
+		freeRefs = rec;
+		++nFreeRefs;
+	} else {
+		__sprt_free(rec);
+	}
+}
+
+BacktraceRecord *Shard::allocBacktrace() {
+	if (freeBacktraces) {
+		auto ret = freeBacktraces;
+		freeBacktraces = ret->next;
+		--nFreeBacktraces;
+		return ret;
+	}
+	return reinterpret_cast<BacktraceRecord *>(__sprt_malloc(sizeof(BacktraceRecord)));
+}
+
+void Shard::freeBacktrace(BacktraceRecord *rec) {
+	if (nFreeBacktraces < MaxFreeRecords) {
+		rec->next = freeBacktraces;
+		freeBacktraces = rec;
+		++nFreeBacktraces;
+	} else {
+		__sprt_free(rec);
+	}
+}
 
 uint64_t getNextRefId() { return s_refId.fetch_add(1); }
 
+void setBacktraceSampleRate(uint32_t rate) { s_sampleRate.store(rate); }
+
+uint32_t getBacktraceSampleRate() { return s_sampleRate.load(); }
+
 uint64_t retainBacktrace(const Ref *ptr, uint64_t id) {
 	if (!id) {
 		return 0;
@@ -75,49 +161,49 @@ uint64_t retainBacktrace(const Ref *ptr, uint64_t id) {
 		id = getNextRefId();
 	}
 
-	RefInfo *info = nullptr;
+	// capture backtrace out of lock
+	uintptr_t frames[MaxFrames];
+	uint32_t nframes = 0;
 
-	// acquire global info for reference
-	s_mutex.lock();
-	// on initial call, set persistent memory for map
-	if (s_retainMap.empty()) {
-		s_retainMap.memory_persistent(true);
+	auto rate = s_sampleRate.load(memory_order::relaxed);
+	if (rate > 0 && ++tl_sampleCounter >= rate) {
+		tl_sampleCounter = 0;
+		nframes = uint32_t(backtrace::captureBacktrace(2, frames, MaxFrames));
 	}
 
-	auto it = s_retainMap.find(ptr);
-	if (it == s_retainMap.end()) {
-		// allocate by-reference pool
-		auto newRefPool = memory::pool::create(memory::get_zero_pool());
-		memory::perform([&] { info = new (newRefPool) RefInfo; }, newRefPool);
+	auto t = platform::clock(platform::ClockType::Fast);
+
+	uint32_t bucket = 0;
+	auto &shard = getShard(ptr, bucket);
+
+	shard.mutex.lock();
+	auto refIt = shard.findRef(ptr, bucket);
+	auto rec = *refIt;
+	if (!rec) {
+		rec = shard.allocRef();
+		if (!rec) {
+			shard.mutex.unlock();
+			return id;
+		}
+
+		rec->next = nullptr;
+		rec->ref = ptr;
+		rec->backtraces = nullptr;
+		*refIt = rec;
+	}
 
-		info->pool = newRefPool;
-		info->ref = ptr;
-		info->backtraces.memory_persistent(true);
+	if (auto bt = shard.allocBacktrace()) {
+		bt->id = id;
+		bt->t = t;
+		bt->nframes = nframes;
+		if (nframes) {
+			__sprt_memcpy(bt->frames, frames, nframes * sizeof(uintptr_t));
+		}
 
-		s_retainMap.emplace(ptr, info);
-	} else {
-		info = it->second;
+		bt->next = rec->backtraces;
+		rec->backtraces = bt;
 	}
-	s_mutex.unlock();
-
-	// collect backtrace with new pool
-	BackraceInfo *btInfo = nullptr;
-
-	// pool creation is thread-safe
-	auto btPool = memory::pool::create(info->pool);
-	memory::perform([&] {
-		btInfo = new (btPool) BackraceInfo;
-		btInfo->pool = btPool;
-
-		sprt::backtrace::getBacktrace(2, [&](uintptr_t, StringView str) {
-			btInfo->backtrace.emplace_back(str.pdup(btPool));
-		});
-	}, btPool);
-
-	// write new backtrace to RefInfo, we need lock
-	info->refMutex.lock();
-	info->backtraces.emplace(id, btInfo);
-	info->refMutex.unlock();
+	shard.mutex.unlock();
 	return id;
 }
 
@@ -126,62 +212,91 @@ void releaseBacktrace(const Ref *ptr, uint64_t id) {
 		return;
 	}
 
-	// first - acquire ref info from global data
-	RefInfo *info = nullptr;
-
-	s_mutex.lock();
-	auto it = s_retainMap.find(ptr);
-	if (it != s_retainMap.end()) {
-		info = it->second;
-	}
-	s_mutex.unlock();
-
-	if (info) {
-		info->refMutex.lock();
-		memory::perform([&] {
-			auto btInfoIt = info->backtraces.find(id);
-			if (btInfoIt != info->backtraces.end()) {
-				memory::pool::destroy(btInfoIt->second->pool);
-				info->backtraces.erase(btInfoIt);
-			}
-		}, info->pool);
-		info->refMutex.unlock();
+	uint32_t bucket = 0;
+	auto &shard = getShard(ptr, bucket);
+
+	shard.mutex.lock();
+	auto refIt = shard.findRef(ptr, bucket);
+	if (auto rec = *refIt) {
+		auto btIt = &rec->backtraces;
+		while (*btIt && (*btIt)->id != id) { btIt = &(*btIt)->next; }
+
+		if (auto bt = *btIt) {
+			*btIt = bt->next;
+			shard.freeBacktrace(bt);
+		}
+
+		// drop record without active retains
+		if (!rec->backtraces) {
+			*refIt = rec->next;
+			shard.freeRef(rec);
+		}
 	}
+	shard.mutex.unlock();
 }
 
 void foreachBacktrace(const Ref *ptr,
 		const callback<void(uint64_t, time_t, const __pool_list<StringView> &)> &cb) {
-
-	// first - acquire ref info from global data
-	RefInfo *info = nullptr;
-
-	s_mutex.lock();
-	auto it = s_retainMap.find(ptr);
-	if (it != s_retainMap.end()) {
-		info = it->second;
+	uint32_t bucket = 0;
+	auto &shard = getShard(ptr, bucket);
+
+	// copy records to symbolize them without lock
+	BacktraceRecord *records = nullptr;
+	size_t count = 0;
+
+	shard.mutex.lock();
+	if (auto rec = *shard.findRef(ptr, bucket)) {
+		for (auto bt = rec->backtraces; bt; bt = bt->next) { ++count; }
+
+		records = reinterpret_cast<BacktraceRecord *>(
+				__sprt_malloc(sizeof(BacktraceRecord) * count));
+		if (records) {
+			size_t i = 0;
+			for (auto bt = rec->backtraces; bt; bt = bt->next) {
+				__sprt_memcpy(&records[i++], bt, sizeof(BacktraceRecord));
+			}
+		}
 	}
-	s_mutex.unlock();
+	shard.mutex.unlock();
 
-	if (!info) {
+	if (!records) {
 		return;
 	}
 
-	info->refMutex.lock();
-
-	for (auto &it : info->backtraces) { cb(it.first, it.second->t, it.second->backtrace); }
+	auto pool = memory::pool::create(memory::get_zero_pool());
+	for (size_t i = 0; i < count; ++i) {
+		auto &bt = records[i];
+		memory::perform([&] {
+			__pool_list<StringView> backtrace;
+			sprt::backtrace::symbolizeBacktrace(bt.frames, bt.nframes,
+					[&](uintptr_t, StringView str) { backtrace.emplace_back(str.pdup(pool)); });
+			cb(bt.id, bt.t, backtrace);
+		}, pool);
+		memory::pool::clear(pool);
+	}
+	memory::pool::destroy(pool);
 
-	info->refMutex.unlock();
+	__sprt_free(records);
 }
 
 void releaseRef(const Ref *ptr) {
-	s_mutex.lock();
-	auto it = s_retainMap.find(ptr);
-	if (it != s_retainMap.end()) {
-		// this will destroy all the pool tree with backtrace data
-		memory::pool::destroy(it->second->pool);
-		s_retainMap.erase(it);
+	uint32_t bucket = 0;
+	auto &shard = getShard(ptr, bucket);
+
+	shard.mutex.lock();
+	auto refIt = shard.findRef(ptr, bucket);
+	if (auto rec = *refIt) {
+		*refIt = rec->next;
+
+		auto bt = rec->backtraces;
+		while (bt) {
+			auto next = bt->next;
+			shard.freeBacktrace(bt);
+			bt = next;
+		}
+		shard.freeRef(rec);
 	}
-	s_mutex.unlock();
+	shard.mutex.unlock();
 }
 
 } // namespace sprt::memleak
@@ -40,6 +40,8 @@
 #include "platform/fd/SPEventSignalFd.cc"
 #include "platform/fd/SPEventTimerFd.cc"
 #include "platform/fd/SPEventPollFd.cc"
+#include "platform/fd/SPEventFileFd.cc"
+#include "platform/fd/SPEventSocketFd.cc"
 #endif
 
 #if SPRT_WINDOWS
@@ -58,6 +60,7 @@
 #endif
 
 #include "detail/SPRuntimeDispatchHandleClass.cc"
+#include "detail/SPRuntimeDispatchTimerWheel.cc"
 #include "detail/SPRuntimeDispatchQueueData.cc"
 #include "SPRuntimeDispatchHandle.cc"
 #include "SPRuntimeDispatchQueue.cc"
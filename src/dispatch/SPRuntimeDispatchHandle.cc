@@ -22,6 +22,8 @@
 
 #include <sprt/runtime/dispatch/handle.h>
 #include <sprt/runtime/log.h>
+#include <sprt/cxx/new>
+#include <sprt/c/__sprt_stdlib.h>
 
 #include "detail/SPRuntimeDispatchQueueData.h"
 
@@ -251,8 +253,20 @@ bool Handle::reset() {
 
 __SPRT_PUSH_ALLOW_CXXABI_ALLOC
 ThreadHandle::~ThreadHandle() {
-	_outputQueue.clear();
-	_outputCallbacks.clear();
+	PerformNode *lists[] = {
+		_incoming.exchange(nullptr, sprt::memory_order::acquire),
+		_freeNodes.exchange(nullptr, sprt::memory_order::acquire),
+	};
+
+	for (auto node : lists) {
+		while (node) {
+			auto next = node->next;
+			node->~PerformNode();
+			__sprt_free(node);
+			node = next;
+		}
+	}
+
 	_unsafeQueue.clear();
 	_unsafeCallbacks.clear();
 	_engine->cleanup();
@@ -271,37 +285,124 @@ bool ThreadHandle::init(HandleClass *cl) {
 
 		// tasks can be performed at any time on this engine
 		_engine->_performEnabled = 1;
-	});
 
-	_outputQueue.reserve(2);
-	_outputCallbacks.reserve(2);
+		// reused for every drain, perform_clear releases memory after each task
+		_drainPool = memory::pool::create(_engine->_tmpPool);
+	});
 
 	return true;
 }
 
-void ThreadHandle::wakeup() {
-	auto p = memory::pool::create(_engine->_tmpPool);
+void ThreadHandle::wakeup() { runTasks(); }
+
+bool ThreadHandle::enqueue(Rc<Task> &&task) {
+	auto node = acquireNode();
+	node->task = sprt::move(task);
+	return enqueue(node);
+}
+
+bool ThreadHandle::enqueue(dispatch::Function<void()> &&fn, Ref *target, StringView tag) {
+	auto node = acquireNode();
+	node->callback = CallbackInfo{sprt::move(fn), target, tag};
+	return enqueue(node);
+}
+
+bool ThreadHandle::enqueue(PerformNode *node) {
+	auto head = _incoming.load(sprt::memory_order::relaxed);
+	do {
+		node->next = head;
+	} while (!_incoming.compare_exchange_weak(head, node, sprt::memory_order::release,
+			sprt::memory_order::relaxed));
+
+	// If the flag is already set, consumer is signaled, but has not cleared it yet, so
+	// it will take this node with the next drain
+	return !_signaled.exchange(true, sprt::memory_order::acq_rel);
+}
 
-	_engine->runAllTasks(p);
+__SPRT_PUSH_ALLOW_CXXABI_ALLOC
+ThreadHandle::PerformNode *ThreadHandle::acquireNode() {
+	PerformNode *node = nullptr;
+
+	// Producer does not wait for the list, busy list means other producer is popping now
+	if (!_freeLocked.exchange(true, sprt::memory_order::acquire)) {
+		node = _freeNodes.load(sprt::memory_order::acquire);
+		while (node
+				&& !_freeNodes.compare_exchange_weak(node, node->next,
+						sprt::memory_order::acquire, sprt::memory_order::acquire)) { }
+		_freeLocked.store(false, sprt::memory_order::release);
+	}
 
-	memory::pool::destroy(p);
+	if (node) {
+		_freeCount.fetch_sub(1, sprt::memory_order::relaxed);
+		node->next = nullptr;
+		return node;
+	}
+	return new (__sprt_malloc(sizeof(PerformNode))) PerformNode();
 }
 
-uint32_t ThreadHandle::performAll(const Callback<void(uint32_t)> &unlockCallback) {
-	auto stack = sprt::move(_outputQueue);
-	auto callbacks = sprt::move(_outputCallbacks);
+void ThreadHandle::releaseNodes(PerformNode *front, PerformNode *back, uint32_t count) {
+	// keep the tail of the chain within the limit, release the rest
+	auto cached = _freeCount.load(sprt::memory_order::relaxed);
+	while (front && cached + count > MaxFreeNodes) {
+		auto next = front->next;
+		front->~PerformNode();
+		__sprt_free(front);
+		front = next;
+		--count;
+	}
+
+	if (!front) {
+		return;
+	}
+
+	_freeCount.fetch_add(count, sprt::memory_order::relaxed);
+
+	auto head = _freeNodes.load(sprt::memory_order::relaxed);
+	do {
+		back->next = head;
+	} while (!_freeNodes.compare_exchange_weak(head, front, sprt::memory_order::release,
+			sprt::memory_order::relaxed));
+}
+__SPRT_POP_ALLOW_CXXABI_ALLOC
 
-	_outputQueue.clear();
-	_outputCallbacks.clear();
+uint32_t ThreadHandle::performAll(const Callback<void(uint32_t)> &takenCallback) {
+	// Clear flag before taking the queue: nodes, pushed after this point, will be signaled again
+	_signaled.exchange(false, sprt::memory_order::acq_rel);
+
+	auto node = _incoming.exchange(nullptr, sprt::memory_order::acquire);
+
+	// stack is in reverse order, restore submission order
+	PerformNode *front = nullptr;
+	uint32_t count = 0;
+	while (node) {
+		auto next = node->next;
+		node->next = front;
+		front = node;
+		node = next;
+		++count;
+	}
 
-	unlockCallback(static_cast<uint32_t>(stack.size() + callbacks.size()));
+	takenCallback(count);
 
-	for (auto &it : stack) {
-		_engine->perform(move(it)); //
+	// nodes are emptied in place and returned into the free list with a single push
+	node = front;
+	PerformNode *back = nullptr;
+	while (node) {
+		if (node->task) {
+			_engine->perform(sprt::move(node->task));
+		} else {
+			_engine->perform(sprt::move(node->callback.fn), sprt::move(node->callback.ref),
+					node->callback.tag);
+			node->callback = CallbackInfo();
+		}
+		back = node;
+		node = node->next;
 	}
-	for (auto &it : callbacks) {
-		_engine->perform(sprt::move(it.fn), sprt::move(it.ref), it.tag); //
+
+	if (front) {
+		releaseNodes(front, back, count);
 	}
+
 	for (auto &it : _unsafeQueue) {
 		_engine->perform(sprt::move(it)); //
 	}
@@ -309,16 +410,27 @@ uint32_t ThreadHandle::performAll(const Callback<void(uint32_t)> &unlockCallback
 		_engine->perform(sprt::move(it.fn), sprt::move(it.ref), it.tag);
 	}
 
-	stack.clear();
-	callbacks.clear();
 	_unsafeQueue.clear();
 	_unsafeCallbacks.clear();
 
-	auto p = memory::pool::create(_engine->_tmpPool);
+	return runTasks();
+}
+
+uint32_t ThreadHandle::performAll() {
+	return performAll([](uint32_t) { });
+}
+
+uint32_t ThreadHandle::runTasks() {
+	// nested run (from within the task) can not clear the pool of the outer run
+	auto p = (_drainDepth == 0) ? _drainPool : memory::pool::create(_engine->_tmpPool);
 
+	++_drainDepth;
 	auto ret = _engine->runAllTasks(p);
+	--_drainDepth;
 
-	memory::pool::destroy(p);
+	if (p != _drainPool) {
+		memory::pool::destroy(p);
+	}
 
 	return ret;
 }
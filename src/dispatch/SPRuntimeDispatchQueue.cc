@@ -41,7 +41,18 @@ Queue::~Queue() {
 bool Queue::init(const QueueInfo &info) {
 	memory::perform([&] { _data = new (getPool()) Data(static_cast<QueueRef *>(getRef()), info); },
 			getPool());
-	return _data != nullptr && _data->isValid();
+	if (_data == nullptr || !_data->isValid()) {
+		return false;
+	}
+
+	if (info.fixedBufferCount > 0) {
+		auto status = _data->initFixedBuffers(info.fixedBufferCount, info.fixedBufferSize);
+		if (status != Status::Ok) {
+			oslog::vperror(__SPRT_LOCATION, "dispatch::Queue", "Fail to allocate fixed buffers: ",
+					status);
+		}
+	}
+	return true;
 }
 
 Rc<TimerHandle> Queue::scheduleTimer(TimerInfo &&info, Ref *ref) {
@@ -125,6 +136,237 @@ Rc<PollHandle> Queue::listenPollableHandle(NativeHandle handle, PollFlags flags,
 	return h;
 }
 
+static bool Queue_checkFileOpInfo(const FileOpInfo &info) {
+	if (info.fd < 0) {
+		oslog::vperror(__SPRT_LOCATION, "dispatch::Queue", "Invalid file descriptor for file op");
+		return false;
+	}
+
+	switch (info.type) {
+	case FileOpType::ReadVec:
+	case FileOpType::WriteVec:
+	case FileOpType::SendMsg:
+		if (!info.buffer || info.size == 0 || info.size > FileOpInfo::MaxVecCount) {
+			oslog::vperror(__SPRT_LOCATION, "dispatch::Queue", "Invalid IoVec for file op");
+			return false;
+		} else {
+			// transferred size is reported as uint32_t value in completion
+			auto iov = static_cast<const IoVec *>(info.buffer);
+			size_t total = 0;
+			for (uint32_t i = 0; i < info.size; ++i) {
+				if (iov[i].iov_len > FileOpInfo::MaxSize - total) {
+					oslog::vperror(__SPRT_LOCATION, "dispatch::Queue",
+							"IoVec for file op is larger then FileOpInfo::MaxSize");
+					return false;
+				}
+				total += iov[i].iov_len;
+			}
+		}
+		break;
+	case FileOpType::Read:
+	case FileOpType::Write:
+	case FileOpType::Send:
+		if (!info.buffer && info.size > 0) {
+			oslog::vperror(__SPRT_LOCATION, "dispatch::Queue", "Invalid buffer for file op");
+			return false;
+		}
+		break;
+	default: break;
+	}
+	return true;
+}
+
+template <typename HandleType>
+static Rc<HandleType> Queue_runFileOp(Queue::Data *data, Rc<HandleType> &&h, Ref *ref) {
+	if (h) {
+		h->setUserdata(ref);
+		data->runHandle(h);
+	} else {
+		oslog::vperror(__SPRT_LOCATION, "dispatch::Queue",
+				"Operation is not supported by queue engine");
+	}
+	return move(h);
+}
+
+Rc<ReadHandle> Queue::read(NativeHandle handle, uint8_t *buf, size_t size, uint64_t offset,
+		CompletionHandle<ReadHandle> &&cb, Ref *ref) {
+	FileOpInfo info{
+		.type = FileOpType::Read,
+		.fd = handle.fd,
+		.buffer = buf,
+		.size = uint32_t(sprt::min(size, FileOpInfo::MaxSize)),
+		.offset = offset,
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->read(info, move(cb)), ref);
+}
+
+Rc<ReadHandle> Queue::readv(NativeHandle handle, const IoVec *iov, uint32_t count,
+		uint64_t offset, CompletionHandle<ReadHandle> &&cb, Ref *ref) {
+	FileOpInfo info{
+		.type = FileOpType::ReadVec,
+		.fd = handle.fd,
+		.buffer = const_cast<IoVec *>(iov),
+		.size = count,
+		.offset = offset,
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->read(info, move(cb)), ref);
+}
+
+Rc<WriteHandle> Queue::write(NativeHandle handle, const uint8_t *buf, size_t size,
+		uint64_t offset, CompletionHandle<WriteHandle> &&cb, Ref *ref) {
+	FileOpInfo info{
+		.type = FileOpType::Write,
+		.fd = handle.fd,
+		.buffer = const_cast<uint8_t *>(buf),
+		.size = uint32_t(sprt::min(size, FileOpInfo::MaxSize)),
+		.offset = offset,
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->write(info, move(cb)), ref);
+}
+
+Rc<WriteHandle> Queue::writev(NativeHandle handle, const IoVec *iov, uint32_t count,
+		uint64_t offset, CompletionHandle<WriteHandle> &&cb, Ref *ref) {
+	FileOpInfo info{
+		.type = FileOpType::WriteVec,
+		.fd = handle.fd,
+		.buffer = const_cast<IoVec *>(iov),
+		.size = count,
+		.offset = offset,
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->write(info, move(cb)), ref);
+}
+
+Rc<WriteHandle> Queue::sync(NativeHandle handle, bool dataOnly, CompletionHandle<WriteHandle> &&cb,
+		Ref *ref) {
+	FileOpInfo info{
+		.type = dataOnly ? FileOpType::DataSync : FileOpType::Sync,
+		.fd = handle.fd,
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->write(info, move(cb)), ref);
+}
+
+Rc<AcceptHandle> Queue::acceptSocket(NativeHandle handle, CompletionHandle<AcceptHandle> &&cb,
+		Ref *ref) {
+	if (handle.fd < 0) {
+		oslog::vperror(__SPRT_LOCATION, "dispatch::Queue", "Invalid socket for accept");
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->accept(handle, move(cb)), ref);
+}
+
+Rc<RecvHandle> Queue::recvSocket(NativeHandle handle, RecvInfo &&info, Ref *ref) {
+	if (handle.fd < 0 || info.bufferCount == 0 || info.bufferSize == 0) {
+		oslog::vperror(__SPRT_LOCATION, "dispatch::Queue", "Invalid parameters for recv");
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->recv(handle, move(info)), ref);
+}
+
+Rc<WriteHandle> Queue::sendSocket(NativeHandle handle, const uint8_t *buf, size_t size,
+		CompletionHandle<WriteHandle> &&cb, Ref *ref) {
+	FileOpInfo info{
+		.type = FileOpType::Send,
+		.fd = handle.fd,
+		.buffer = const_cast<uint8_t *>(buf),
+		.size = uint32_t(sprt::min(size, FileOpInfo::MaxSize)),
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->write(info, move(cb)), ref);
+}
+
+Rc<WriteHandle> Queue::sendSocket(NativeHandle handle, const IoVec *iov, uint32_t count,
+		CompletionHandle<WriteHandle> &&cb, Ref *ref) {
+	FileOpInfo info{
+		.type = FileOpType::SendMsg,
+		.fd = handle.fd,
+		.buffer = const_cast<IoVec *>(iov),
+		.size = count,
+	};
+
+	if (!Queue_checkFileOpInfo(info)) {
+		return nullptr;
+	}
+
+	return Queue_runFileOp(_data, _data->write(info, move(cb)), ref);
+}
+
+struct FileOpData : public Ref {
+	dispatch::Function<void(Status, size_t)> cb;
+	Rc<Ref> ref;
+
+	template <typename HandleType>
+	static void complete(FileOpData *data, HandleType *, uint32_t value, Status st) {
+		if (data->cb) {
+			data->cb(st, value);
+		}
+	}
+};
+
+Rc<ReadHandle> Queue::read(NativeHandle handle, uint8_t *buf, size_t size, uint64_t offset,
+		dispatch::Function<void(Status, size_t)> &&cb, Ref *ref) {
+	auto data = Rc<FileOpData>::alloc();
+	data->cb = sprt::move(cb);
+	data->ref = ref;
+
+	return read(handle, buf, size, offset,
+			CompletionHandle<ReadHandle>::create<FileOpData>(data,
+					&FileOpData::complete<ReadHandle>),
+			data);
+}
+
+Rc<WriteHandle> Queue::write(NativeHandle handle, const uint8_t *buf, size_t size,
+		uint64_t offset, dispatch::Function<void(Status, size_t)> &&cb, Ref *ref) {
+	auto data = Rc<FileOpData>::alloc();
+	data->cb = sprt::move(cb);
+	data->ref = ref;
+
+	return write(handle, buf, size, offset,
+			CompletionHandle<WriteHandle>::create<FileOpData>(data,
+					&FileOpData::complete<WriteHandle>),
+			data);
+}
+
+Status Queue::registerFile(NativeHandle handle) { return _data->registerFile(handle); }
+
+Status Queue::unregisterFile(NativeHandle handle) { return _data->unregisterFile(handle); }
+
+uint8_t *Queue::acquireFixedBuffer() { return _data->acquireFixedBuffer(); }
+
+Status Queue::releaseFixedBuffer(uint8_t *ptr) { return _data->releaseFixedBuffer(ptr); }
+
+size_t Queue::getFixedBufferSize() const { return _data->_fixedBufferSize; }
+
 Rc<ThreadHandle> Queue::addThreadHandle() {
 	auto h = _data->addThreadHandle();
 	_data->runHandle(h);
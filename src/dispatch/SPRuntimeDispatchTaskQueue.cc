@@ -139,7 +139,7 @@ void TaskQueue::update(uint32_t *count) {
 	}
 
 	if (_context.tasksInQueue.load() > 0) {
-		_context.inputCondition.notify_all();
+		_context.notifyAll();
 	}
 }
 
@@ -28,6 +28,12 @@ namespace sprt::dispatch {
 
 class ThreadPool::Worker : public Thread {
 public:
+	// Bounded Chase-Lev deque for WorkStealing mode; when it's full, tasks go to shared queue
+	static constexpr int64_t LocalQueueSize = 256;
+	static constexpr int64_t LocalQueueMask = LocalQueueSize - 1;
+
+	static thread_local Worker *s_current;
+
 	Worker(ThreadPool::WorkerContext *queue, StringView name, uint32_t workerId);
 	virtual ~Worker();
 
@@ -35,14 +41,42 @@ public:
 	virtual void threadDispose() override;
 	virtual bool worker() override;
 
+	// owner thread only
+	bool pushLocal(Rc<Task> &task);
+	Rc<Task> popLocal();
+
+	// any thread
+	Rc<Task> steal();
+
+	uint32_t nextRandom();
+
 protected:
+	friend struct ThreadPool::WorkerContext;
+
+	struct LocalSlot {
+		sprt::atomic<Task *> task;
+		sprt::atomic<uint64_t> id;
+	};
+
 	uint64_t _queueRefId = 0;
 	ThreadPool::WorkerContext *_queue = nullptr;
 
 	uint32_t _workerId;
+	uint32_t _random = 0;
 	StringView _name;
+	bool _stealing = false;
+
+	sprt::atomic<bool> _parked = false;
+	sprt::qmutex _parkMutex;
+	sprt::condition_variable _parkCondition;
+
+	alignas(64) sprt::atomic<int64_t> _top = 0;
+	alignas(64) sprt::atomic<int64_t> _bottom = 0;
+	LocalSlot _slots[LocalQueueSize];
 };
 
+thread_local ThreadPool::Worker *ThreadPool::Worker::s_current = nullptr;
+
 bool ThreadPool::init(ThreadPoolInfo &&info) { return _context.init(move(info), this); }
 
 Status ThreadPool::perform(Rc<Task> &&task, bool first) {
@@ -83,18 +117,26 @@ const ThreadPoolInfo &ThreadPool::getInfo() const { return _context.info; }
 StringView ThreadPool::getName() const { return _context.info.name; }
 
 ThreadPool::Worker::Worker(ThreadPool::WorkerContext *queue, StringView name, uint32_t workerId)
-: _queue(queue), _workerId(workerId), _name(name) {
+: _queue(queue)
+, _workerId(workerId)
+, _random(workerId * 0x9E37'79B9 + 1)
+, _name(name)
+, _stealing(hasFlag(queue->info.flags, ThreadPoolFlags::WorkStealing)) {
 	_queueRefId = sprt::retain(_queue->threadPool);
 }
 
 ThreadPool::Worker::~Worker() { sprt::release(_queue->threadPool, _queueRefId); }
 
 void ThreadPool::Worker::threadInit() {
+	s_current = this;
 	sprt::dispatch::thread_info::set(_name, _workerId, true);
 	Thread::threadInit();
 }
 
-void ThreadPool::Worker::threadDispose() { Thread::threadDispose(); }
+void ThreadPool::Worker::threadDispose() {
+	s_current = nullptr;
+	Thread::threadDispose();
+}
 
 bool ThreadPool::Worker::worker() {
 	if (!_continueExecution.test_and_set()) {
@@ -103,7 +145,15 @@ bool ThreadPool::Worker::worker() {
 
 	Rc<Task> task;
 
-	if (!task) {
+	if (_stealing) {
+		task = _queue->popTask(this);
+		if (!task) {
+			task = _queue->park(this);
+			if (!task) {
+				return true;
+			}
+		}
+	} else {
 		task = _queue->popTask();
 	}
 
@@ -125,6 +175,87 @@ bool ThreadPool::Worker::worker() {
 	return true;
 }
 
+bool ThreadPool::Worker::pushLocal(Rc<Task> &task) {
+	auto b = _bottom.load(sprt::memory_order::relaxed);
+	auto t = _top.load(sprt::memory_order::acquire);
+	if (b - t >= LocalQueueSize) {
+		return false;
+	}
+
+	auto ptr = task.get();
+	auto &slot = _slots[b & LocalQueueMask];
+	slot.id.store(sprt::retain(ptr), sprt::memory_order::relaxed);
+	slot.task.store(ptr, sprt::memory_order::relaxed);
+	task = nullptr;
+
+	sprt::atomic_thread_fence(sprt::memory_order::release);
+	_bottom.store(b + 1, sprt::memory_order::relaxed);
+	return true;
+}
+
+Rc<Task> ThreadPool::Worker::popLocal() {
+	auto b = _bottom.load(sprt::memory_order::relaxed) - 1;
+	_bottom.store(b, sprt::memory_order::relaxed);
+	sprt::atomic_thread_fence(sprt::memory_order::seq_cst);
+	auto t = _top.load(sprt::memory_order::relaxed);
+
+	if (t > b) {
+		// deque is empty
+		_bottom.store(b + 1, sprt::memory_order::relaxed);
+		return nullptr;
+	}
+
+	auto &slot = _slots[b & LocalQueueMask];
+	auto ptr = slot.task.load(sprt::memory_order::relaxed);
+	auto id = slot.id.load(sprt::memory_order::relaxed);
+
+	if (t == b) {
+		// last task, race with thieves
+		if (!_top.compare_exchange_strong(t, t + 1, sprt::memory_order::seq_cst,
+					sprt::memory_order::relaxed)) {
+			_bottom.store(b + 1, sprt::memory_order::relaxed);
+			return nullptr;
+		}
+		_bottom.store(b + 1, sprt::memory_order::relaxed);
+	}
+
+	Rc<Task> ret(ptr);
+	sprt::release(ptr, id);
+	return ret;
+}
+
+Rc<Task> ThreadPool::Worker::steal() {
+	auto t = _top.load(sprt::memory_order::acquire);
+	sprt::atomic_thread_fence(sprt::memory_order::seq_cst);
+	auto b = _bottom.load(sprt::memory_order::acquire);
+
+	if (t >= b) {
+		return nullptr;
+	}
+
+	auto &slot = _slots[t & LocalQueueMask];
+	auto ptr = slot.task.load(sprt::memory_order::relaxed);
+	auto id = slot.id.load(sprt::memory_order::relaxed);
+
+	if (!_top.compare_exchange_strong(t, t + 1, sprt::memory_order::seq_cst,
+				sprt::memory_order::relaxed)) {
+		// lost race with owner or other thief
+		return nullptr;
+	}
+
+	Rc<Task> ret(ptr);
+	sprt::release(ptr, id);
+	return ret;
+}
+
+uint32_t ThreadPool::Worker::nextRandom() {
+	// xorshift32
+	_random ^= _random << 13;
+	_random ^= _random >> 17;
+	_random ^= _random << 5;
+	return _random;
+}
+
 ThreadPool::WorkerContext::WorkerContext() { }
 
 ThreadPool::WorkerContext::~WorkerContext() { cancel(); }
@@ -149,15 +280,24 @@ void ThreadPool::WorkerContext::wait(sprt::unique_lock<sprt::qmutex> &lock) {
 	}
 }
 
+void ThreadPool::WorkerContext::notifyAll() {
+	inputCondition.notify_all();
+	if (hasFlag(info.flags, ThreadPoolFlags::WorkStealing)) {
+		unpark(true);
+	}
+}
+
 void ThreadPool::WorkerContext::spawn() {
 	sprt::unique_lock lock(inputMutexQueue);
 	if (workers.empty()) {
+		// workers can access each other for stealing, so, create them all before running
+		workers.reserve(info.threadCount);
 		for (uint32_t i = 0; i < info.threadCount; i++) {
-			auto worker = RefAlloc::__new<Worker>(this, info.name, i);
-			workers.push_back(worker);
-			worker->run();
+			workers.push_back(RefAlloc::__new<Worker>(this, info.name, i));
 		}
 
+		for (auto &it : workers) { it->run(); }
+
 		// remove lazy-init flag to prevent run-after-cancel
 		info.flags &= ~ThreadPoolFlags::LazyInit;
 	}
@@ -169,10 +309,12 @@ void ThreadPool::WorkerContext::cancel() {
 	if (!workers.empty()) {
 		for (auto &it : workers) { it->stop(); }
 
-		inputCondition.notify_all();
+		notifyAll();
+
+		for (auto &it : workers) { it->waitStopped(); }
 
 		for (auto &it : workers) {
-			it->waitStopped();
+			while (auto t = it->popLocal()) { t->cancel(); }
 			__delete(it);
 		}
 		workers.clear();
@@ -209,9 +351,30 @@ Status ThreadPool::WorkerContext::perform(Rc<Task> &&task, bool first) {
 
 	task->addRef(threadPool);
 
+	auto priority = task->getPriority().get();
+
 	++tasksInExecution;
 	++tasksInQueue;
-	inputQueue.push(task->getPriority().get(), first, sprt::move(task));
+
+	if (hasFlag(info.flags, ThreadPoolFlags::WorkStealing)) {
+		// LIFO order of the local deque makes `first` meaningful for worker's own tasks
+		auto current = Worker::s_current;
+		if (!current || current->_queue != this || priority != 0 || !current->pushLocal(task)) {
+			if (priority < 0) {
+				++tasksPrioritized;
+			}
+			inputQueue.push(priority, first, sprt::move(task));
+		}
+
+		// task should be visible for workers before the check, see `park`
+		sprt::atomic_thread_fence(sprt::memory_order::seq_cst);
+		if (workersParked.load() > 0) {
+			unpark();
+		}
+		return Status::Ok;
+	}
+
+	inputQueue.push(priority, first, sprt::move(task));
 	inputCondition.notify_one();
 	return Status::Ok;
 }
@@ -226,10 +389,103 @@ void ThreadPool::WorkerContext::onMainThreadWorker(Rc<Task> &&task) {
 }
 
 Rc<Task> ThreadPool::WorkerContext::popTask() {
+	// prioritized tasks are counted only in WorkStealing mode, see `perform`
+	const bool counted = hasFlag(info.flags, ThreadPoolFlags::WorkStealing);
+
 	Rc<Task> ret;
-	inputQueue.pop_direct(
-			[&](PriorityQueue<Rc<Task>>::PriorityType, Rc<Task> &&task) { ret = move(task); });
+	inputQueue.pop_direct([&](PriorityQueue<Rc<Task>>::PriorityType p, Rc<Task> &&task) {
+		if (counted && p < 0) {
+			--tasksPrioritized;
+		}
+		ret = move(task);
+	});
 	return ret;
 }
 
+Rc<Task> ThreadPool::WorkerContext::popTask(Worker *w) {
+	Rc<Task> ret;
+
+	// tasks with priority above default should not wait for local tasks
+	if (tasksPrioritized.load() > 0) {
+		ret = popTask();
+		if (ret) {
+			return ret;
+		}
+	}
+
+	ret = w->popLocal();
+	if (ret) {
+		return ret;
+	}
+
+	ret = popTask();
+	if (ret) {
+		return ret;
+	}
+
+	return stealTask(w);
+}
+
+Rc<Task> ThreadPool::WorkerContext::stealTask(Worker *w) {
+	auto count = workers.size();
+	if (count <= 1) {
+		return nullptr;
+	}
+
+	auto offset = w->nextRandom() % count;
+	for (size_t i = 0; i < count; ++i) {
+		auto victim = workers[(offset + i) % count];
+		if (victim != w) {
+			if (auto ret = victim->steal()) {
+				return ret;
+			}
+		}
+	}
+	return nullptr;
+}
+
+Rc<Task> ThreadPool::WorkerContext::park(Worker *w) {
+	// Worker is announced as parked before the last scan for the tasks. Producer makes the task
+	// visible before it checks for the parked workers (see `perform`), so the task is either
+	// found by the scan, or the worker is unparked by the producer.
+	// Task counters can not be used instead of the scan: task can be counted, but not stolen
+	// yet (or already taken by another worker), so the worker would spin instead of sleeping.
+	++workersParked;
+	w->_parked.store(true);
+	sprt::atomic_thread_fence(sprt::memory_order::seq_cst);
+
+	auto task = popTask(w);
+	if (!task) {
+		sprt::unique_lock lock(w->_parkMutex);
+		while (w->_parked.load() && !finalized.load()) { w->_parkCondition.wait(lock); }
+	}
+
+	if (w->_parked.exchange(false)) {
+		// not unparked by producer
+		--workersParked;
+	}
+	return task;
+}
+
+void ThreadPool::WorkerContext::unpark(bool all) {
+	for (auto &it : workers) {
+		bool expected = true;
+		if (it->_parked.compare_exchange_strong(expected, false, sprt::memory_order::seq_cst,
+					sprt::memory_order::relaxed)) {
+			--workersParked;
+
+			sprt::unique_lock lock(it->_parkMutex);
+			it->_parkCondition.notify_one();
+
+			if (!all) {
+				return;
+			}
+		} else if (all) {
+			// finalization does not rely on the flag
+			sprt::unique_lock lock(it->_parkMutex);
+			it->_parkCondition.notify_one();
+		}
+	}
+}
+
 } // namespace sprt::dispatch
@@ -80,6 +80,9 @@ struct SPRT_API HandleClass {
 
 	Queue::Map<Handle *, Queue::Vector<Rc<Handle>>> pendingHandles;
 
+	// suspendFn completes suspension in place, queue should not wait for a suspension event
+	bool inplaceSuspend = false;
+
 	size_t runningHandles = 0;
 	size_t suspendedHandles = 0;
 	size_t registredHandles = 0;
@@ -24,6 +24,7 @@
 #include <sprt/runtime/log.h>
 
 #include "SPRuntimeDispatchQueueData.h"
+#include "SPRuntimeDispatchTimerWheel.h"
 
 namespace sprt::dispatch {
 
@@ -171,6 +172,10 @@ uint32_t QueueData::suspendAll(Handle **buf) {
 	for (auto &it : _suspendableHandles) {
 		if (it->getStatus() == Status::Ok) {
 			if (isSuccessful(it->suspend())) {
+				if (it->_class->inplaceSuspend) {
+					// already suspended, nothing to wait for
+					continue;
+				}
 				if (buf) {
 					*buf = it.get();
 					++buf;
@@ -245,6 +250,10 @@ void QueueData::cleanup() {
 	_suspendableHandles.clear();
 	_pendingHandles.clear();
 
+	if (_timerWheel) {
+		_timerWheel->cleanup();
+	}
+
 	PerformEngine::cleanup();
 }
 
@@ -313,6 +322,18 @@ void QueueData::cancel() {
 }
 
 Rc<TimerHandle> QueueData::scheduleTimer(TimerInfo &&info) {
+	if (_timer && !hasFlag(_flags, QueueFlags::NativeTimers)
+			&& (_engine == QueueEngine::URing || _engine == QueueEngine::EPoll)
+			&& TimerWheel::isSupported(info)) {
+		if (!_timerWheel) {
+			memory::perform([&] { _timerWheel = new (_pool) TimerWheel(this); }, _pool);
+		}
+
+		if (_timerWheel->start()) {
+			return Rc<TimerWheelHandle>::create(&_timerWheel->_class, _timerWheel, move(info));
+		}
+	}
+
 	if (_timer) {
 		return _timer(this, _platformQueue, move(info));
 	}
@@ -334,7 +355,142 @@ Rc<ThreadHandle> QueueData::addThreadHandle() {
 	return nullptr;
 }
 
+Rc<ReadHandle> QueueData::read(const FileOpInfo &info, CompletionHandle<ReadHandle> &&cb) {
+	if (_read) {
+		return _read(this, _platformQueue, info, move(cb));
+	}
+	return nullptr;
+}
+
+Rc<WriteHandle> QueueData::write(const FileOpInfo &info, CompletionHandle<WriteHandle> &&cb) {
+	if (_write) {
+		return _write(this, _platformQueue, info, move(cb));
+	}
+	return nullptr;
+}
+
+Rc<AcceptHandle> QueueData::accept(NativeHandle handle, CompletionHandle<AcceptHandle> &&cb) {
+	if (_accept) {
+		return _accept(this, _platformQueue, handle, move(cb));
+	}
+	return nullptr;
+}
+
+Rc<RecvHandle> QueueData::recv(NativeHandle handle, RecvInfo &&info) {
+	if (_recv) {
+		return _recv(this, _platformQueue, handle, move(info));
+	}
+	return nullptr;
+}
+
+Status QueueData::registerFile(NativeHandle handle) {
+	if (_registerFile) {
+		return _registerFile(_platformQueue, handle, false);
+	}
+	return Status::ErrorNotSupported;
+}
+
+Status QueueData::unregisterFile(NativeHandle handle) {
+	if (_registerFile) {
+		return _registerFile(_platformQueue, handle, true);
+	}
+	return Status::ErrorNotSupported;
+}
+
+Status QueueData::initFixedBuffers(uint32_t count, uint32_t size) {
+	if (_fixedBuffers) {
+		return Status::ErrorAlreadyPerformed;
+	}
+
+	if (count == 0 || size == 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	// page-aligned, so kernel pins only pages of the arena
+	static constexpr uint32_t PageSize = 4'096;
+
+	size = (size + PageSize - 1) & ~(PageSize - 1);
+
+	memory::perform([&] {
+		_fixedBuffers = reinterpret_cast<uint8_t *>(
+				memory::pool::palloc(_pool, size_t(count) * size, PageSize));
+
+		_fixedBuffersFree.reserve(count);
+		for (uint32_t i = count; i > 0; --i) { _fixedBuffersFree.emplace_back(i - 1); }
+		_fixedBuffersUsed.resize((count + 63) / 64, uint64_t(0));
+	}, _pool);
+
+	if (!_fixedBuffers) {
+		return Status::ErrorOutOfHostMemory;
+	}
+
+	_fixedBufferCount = count;
+	_fixedBufferSize = size;
+
+	if (_registerBuffers) {
+		_fixedBuffersRegistered =
+				(_registerBuffers(_platformQueue, _fixedBuffers, count, size) == Status::Ok);
+	}
+	return Status::Ok;
+}
+
+uint8_t *QueueData::acquireFixedBuffer() {
+	if (_fixedBuffersFree.empty()) {
+		return nullptr;
+	}
+
+	auto idx = _fixedBuffersFree.back();
+	_fixedBuffersFree.pop_back();
+	_fixedBuffersUsed[idx / 64] |= uint64_t(1) << (idx % 64);
+	return _fixedBuffers + size_t(idx) * _fixedBufferSize;
+}
+
+Status QueueData::releaseFixedBuffer(uint8_t *ptr) {
+	if (!_fixedBuffers || ptr < _fixedBuffers
+			|| ptr >= _fixedBuffers + size_t(_fixedBufferCount) * _fixedBufferSize) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto offset = size_t(ptr - _fixedBuffers);
+	if (offset % _fixedBufferSize != 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	// duplicate in the free list would be acquired twice
+	auto idx = uint32_t(offset / _fixedBufferSize);
+	auto bit = uint64_t(1) << (idx % 64);
+	if ((_fixedBuffersUsed[idx / 64] & bit) == 0) {
+		return Status::ErrorAlreadyPerformed;
+	}
+
+	_fixedBuffersUsed[idx / 64] &= ~bit;
+	_fixedBuffersFree.emplace_back(idx);
+	return Status::Ok;
+}
+
+int32_t QueueData::getFixedBufferIndex(const void *ptr, size_t size) const {
+	if (!_fixedBuffersRegistered) {
+		return -1;
+	}
+
+	auto p = reinterpret_cast<const uint8_t *>(ptr);
+	if (p < _fixedBuffers || p >= _fixedBuffers + size_t(_fixedBufferCount) * _fixedBufferSize) {
+		return -1;
+	}
+
+	auto idx = size_t(p - _fixedBuffers) / _fixedBufferSize;
+	if (p + size > _fixedBuffers + (idx + 1) * _fixedBufferSize) {
+		return -1;
+	}
+	return int32_t(idx);
+}
+
 QueueData::~QueueData() {
+	if (_timerWheel) {
+		_timerWheel->~TimerWheel();
+		_timerWheel = nullptr;
+	}
+
 	if (_platformQueue && _destroy) {
 		_destroy(_platformQueue);
 	}
@@ -41,6 +41,35 @@ struct _linux_itimerspec {
 namespace sprt::dispatch {
 
 struct PlatformQueueData;
+struct TimerWheel;
+
+enum class FileOpType : uint32_t {
+	Read,
+	ReadVec,
+	Write,
+	WriteVec,
+	Sync,
+	DataSync,
+	Send,
+	SendMsg,
+};
+
+struct SPRT_API FileOpInfo {
+	// Linux limit for a single read/write operation (MAX_RW_COUNT); larger buffers are
+	// transferred partially, larger IoVec arrays are rejected, so result always fits
+	// into uint32_t completion value
+	static constexpr size_t MaxSize = 0x7fff'f000;
+	static constexpr uint32_t MaxVecCount = 1'024;
+
+	FileOpType type = FileOpType::Read;
+	int fd = -1;
+	void *buffer = nullptr; // data or IoVec array
+	uint32_t size = 0; // bytes or IoVec count
+	uint64_t offset = FileOffsetCurrent;
+
+	bool isWrite() const { return toInt(type) >= toInt(FileOpType::Write); }
+	bool isSocket() const { return type == FileOpType::Send || type == FileOpType::SendMsg; }
+};
 
 // PerformEngine can be used for resumable nested 'perform' variants
 // Action, that performed within engine, can safely call Queue::run, that also can cause 'perform'
@@ -86,6 +115,15 @@ struct SPRT_API QueueData : public PerformEngine {
 	using ThreadCallback = Rc<ThreadHandle> (*)(QueueData *, void *);
 	using ListenHandleCallback = Rc<PollHandle> (*)(QueueData *, void *, NativeHandle, PollFlags,
 			CompletionHandle<PollHandle> &&);
+	using ReadCallback = Rc<ReadHandle> (*)(QueueData *, void *, const FileOpInfo &,
+			CompletionHandle<ReadHandle> &&);
+	using WriteCallback = Rc<WriteHandle> (*)(QueueData *, void *, const FileOpInfo &,
+			CompletionHandle<WriteHandle> &&);
+	using AcceptCallback = Rc<AcceptHandle> (*)(QueueData *, void *, NativeHandle,
+			CompletionHandle<AcceptHandle> &&);
+	using RecvCallback = Rc<RecvHandle> (*)(QueueData *, void *, NativeHandle, RecvInfo &&);
+	using RegisterFileCallback = Status (*)(void *, NativeHandle, bool unregister);
+	using RegisterBuffersCallback = Status (*)(void *, uint8_t *, uint32_t count, uint32_t size);
 
 	QueueHandleClassInfo _info;
 	QueueFlags _flags = QueueFlags::None;
@@ -108,6 +146,22 @@ struct SPRT_API QueueData : public PerformEngine {
 	TimerCallback _timer = nullptr;
 	ThreadCallback _thread = nullptr;
 	ListenHandleCallback _listenHandle = nullptr;
+	ReadCallback _read = nullptr;
+	WriteCallback _write = nullptr;
+	AcceptCallback _accept = nullptr;
+	RecvCallback _recv = nullptr;
+	RegisterFileCallback _registerFile = nullptr;
+	RegisterBuffersCallback _registerBuffers = nullptr;
+
+	uint8_t *_fixedBuffers = nullptr;
+	uint32_t _fixedBufferCount = 0;
+	uint32_t _fixedBufferSize = 0;
+	bool _fixedBuffersRegistered = false;
+	Queue::Vector<uint32_t> _fixedBuffersFree;
+	Queue::Vector<uint64_t> _fixedBuffersUsed; // bitmap of acquired buffers
+
+	// shared wheel for the millisecond timers, created with the first such timer
+	TimerWheel *_timerWheel = nullptr;
 
 	Thread::Id _threadId;
 
@@ -118,7 +172,7 @@ struct SPRT_API QueueData : public PerformEngine {
 	bool isRunning() const { return _running; }
 	bool isWithinNotify() const { return _performEnabled > 0; }
 
-	// returns number of operations suspended
+	// returns number of operations suspended, that should report its suspension
 	// Suspended handle pointers written to buffer provided
 	uint32_t suspendAll(Handle **);
 
@@ -148,6 +202,20 @@ struct SPRT_API QueueData : public PerformEngine {
 	Rc<TimerHandle> scheduleTimer(TimerInfo &&);
 	Rc<PollHandle> listenHandle(NativeHandle, PollFlags, CompletionHandle<PollHandle> &&);
 	Rc<ThreadHandle> addThreadHandle();
+	Rc<ReadHandle> read(const FileOpInfo &, CompletionHandle<ReadHandle> &&);
+	Rc<WriteHandle> write(const FileOpInfo &, CompletionHandle<WriteHandle> &&);
+	Rc<AcceptHandle> accept(NativeHandle, CompletionHandle<AcceptHandle> &&);
+	Rc<RecvHandle> recv(NativeHandle, RecvInfo &&);
+
+	Status registerFile(NativeHandle);
+	Status unregisterFile(NativeHandle);
+
+	Status initFixedBuffers(uint32_t count, uint32_t size);
+	uint8_t *acquireFixedBuffer();
+	Status releaseFixedBuffer(uint8_t *);
+
+	// Index of the registered fixed buffer, that contains whole [ptr, ptr + size) or -1
+	int32_t getFixedBufferIndex(const void *ptr, size_t size) const;
 
 	~QueueData();
 
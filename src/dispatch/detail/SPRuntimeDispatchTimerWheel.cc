@@ -0,0 +1,498 @@
+/**
+ Copyright (c) 2025 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#include <sprt/runtime/platform.h>
+#include <sprt/cxx/bit>
+
+#include "SPRuntimeDispatchTimerWheel.h"
+#include "SPRuntimeDispatchQueueData.h"
+
+namespace sprt::dispatch {
+
+// Distance from `start` to the next occupied slot within [base, base + size), wrapping around
+// base and size should be aligned to bitmap words
+static uint32_t TimerWheel_findNextSlot(const uint64_t *bitmap, uint32_t base, uint32_t size,
+		uint32_t start) {
+	uint32_t offset = 0;
+	while (offset < size) {
+		auto idx = (start + offset) & (size - 1);
+		auto bit = base + idx;
+		auto word = bitmap[bit / 64] >> (bit % 64);
+		if (word) {
+			return (idx + uint32_t(sprt::countr_zero(word)) - start) & (size - 1);
+		}
+		offset += 64 - (bit % 64);
+	}
+	return Max<uint32_t>;
+}
+
+static void TimerWheel_onDriver(TimerWheel *wheel, TimerHandle *, uint32_t, Status status) {
+	if (status == Status::Ok) {
+		auto now = TimerWheel::now();
+
+		// timerfd can still be armed as periodic, force update
+		wheel->_armed = Max<uint64_t>;
+		wheel->advance(now);
+		wheel->arm(now);
+	} else {
+		// driver was cancelled or failed, it will be recreated with the next timer
+		wheel->_driver = nullptr;
+		wheel->_armed = 0;
+	}
+}
+
+void TimerWheelSource::cancel() {
+	if (wheel) {
+		wheel->remove(this);
+	}
+}
+
+bool TimerWheelHandle::init(HandleClass *cl, TimerWheel *wheel, TimerInfo &&info) {
+	if (!TimerHandle::init(cl, info.completion)) {
+		return false;
+	}
+
+	auto source = reinterpret_cast<TimerWheelSource *>(_data);
+	source->wheel = wheel;
+	source->handle = this;
+
+	setup(info);
+	return true;
+}
+
+bool TimerWheelHandle::reset(TimerInfo &&info) {
+	if (!TimerWheel::isSupported(info)) {
+		return false;
+	}
+
+	if (info.completion) {
+		_completion = move(info.completion);
+		_userdata = nullptr;
+	}
+
+	auto source = reinterpret_cast<TimerWheelSource *>(_data);
+
+	setup(info);
+
+	if (_status == Status::Ok) {
+		// active timer can be relinked in place, no need to suspend it
+		source->wheel->remove(source);
+		source->deadline = TimerWheel::now() + _timeout;
+		source->wheel->insert(source);
+		return true;
+	}
+
+	source->deadline = 0;
+	return Handle::reset();
+}
+
+Status TimerWheelHandle::rearm(TimerWheel *wheel, TimerWheelSource *source) {
+	auto status = prepareRearm();
+	if (status == Status::Ok) {
+		// resumed timer keeps its deadline
+		if (source->deadline == 0) {
+			source->deadline = TimerWheel::now() + _timeout;
+		}
+		wheel->insert(source);
+	}
+	return status;
+}
+
+Status TimerWheelHandle::disarm(TimerWheel *wheel, TimerWheelSource *source) {
+	auto status = prepareDisarm();
+	if (status == Status::Ok) {
+		wheel->remove(source);
+		++_timeline;
+	} else if (status == Status::ErrorAlreadyPerformed) {
+		return Status::Ok;
+	}
+	return status;
+}
+
+void TimerWheelHandle::notify(TimerWheel *wheel, TimerWheelSource *source, uint64_t now) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	// count periods, that were missed while queue was busy
+	uint64_t expirations = 1;
+	if (_interval > 0 && now > source->deadline) {
+		expirations += (now - source->deadline) / _interval;
+	}
+
+	auto current = sprt::min(uint64_t(_value) + expirations, uint64_t(Infinite));
+	if (_count != Infinite) {
+		_value = uint32_t(sprt::min(current, uint64_t(_count)));
+	}
+
+	if (_count != Infinite && current >= _count) {
+		cancel(Status::Done, _value);
+		return;
+	}
+
+	source->deadline += expirations * _interval;
+	wheel->insert(source);
+
+	sendCompletion(_value, Status::Ok);
+}
+
+void TimerWheelHandle::setup(const TimerInfo &info) {
+	_count = info.count;
+	_value = 0;
+	_timeout = TimerWheel::getTicks(info.timeout ? info.timeout : info.interval);
+	if (_count == 1) {
+		_interval = 0;
+	} else {
+		_interval = TimerWheel::getTicks(info.interval ? info.interval : info.timeout);
+	}
+}
+
+bool TimerWheel::isSupported(const TimerInfo &info) {
+	if (info.clock != __SPRT_CLOCK_MONOTONIC && info.clock != __SPRT_CLOCK_REALTIME) {
+		return false;
+	}
+
+	if (!info.timeout && !info.interval) {
+		return false;
+	}
+
+	// sub-millisecond precision requested, leave it for the native timer
+	return (info.timeout.toMicros() % 1'000) == 0 && (info.interval.toMicros() % 1'000) == 0;
+}
+
+uint64_t TimerWheel::getTicks(TimeInterval ival) { return (ival.toMicros() + 999) / 1'000; }
+
+uint64_t TimerWheel::now() { return platform::clock(platform::ClockType::Fast) / 1'000; }
+
+void TimerWheel::insert(TimerWheelSource *source) {
+	if (source->isLinked()) {
+		return;
+	}
+
+	if (_count == 0 && !_advancing) {
+		// wheel is idle, skip ticks, that were not processed
+		_current = sprt::max(_current, now());
+	}
+
+	link(source);
+	++_count;
+
+	if (!_advancing && (_armed == 0 || source->deadline < _armed)) {
+		arm(now());
+	}
+}
+
+void TimerWheel::remove(TimerWheelSource *source) {
+	if (!source->isLinked()) {
+		return;
+	}
+
+	// driver stays armed, spurious wakeup is cheaper then timer update on every cancel
+	unlink(source);
+	--_count;
+}
+
+void TimerWheel::advance(uint64_t now) {
+	_advancing = true;
+
+	while (_current <= now && _count > 0) {
+		auto next = getNextTick();
+		if (next > now) {
+			break;
+		}
+
+		_current = next;
+
+		auto idx = uint32_t(_current & (RootSize - 1));
+		if (idx == 0) {
+			for (uint32_t level = 0; level < Levels; ++level) {
+				auto lidx = uint32_t(
+						(_current >> (RootBits + level * LevelBits)) & (LevelSize - 1));
+				cascade(RootSize + level * LevelSize + lidx);
+				if (lidx != 0) {
+					break;
+				}
+			}
+		}
+
+		TimerWheelLink expired;
+		detach(idx, &expired);
+
+		_processing = true;
+		while (expired.next != &expired) {
+			auto source = reinterpret_cast<TimerWheelSource *>(expired.next);
+
+			unlink(source);
+			--_count;
+
+			if (source->deadline > _current) {
+				// timer was clamped to the wheel range, schedule remaining time
+				link(source);
+				++_count;
+				continue;
+			}
+
+			Rc<TimerWheelHandle> handle(source->handle);
+			handle->notify(this, source, now);
+		}
+		_processing = false;
+
+		++_current;
+	}
+
+	if (_current <= now) {
+		_current = now + 1;
+	}
+
+	_advancing = false;
+}
+
+uint64_t TimerWheel::getNextTick() const {
+	uint64_t ret = Max<uint64_t>;
+
+	auto dist = TimerWheel_findNextSlot(_bitmap, 0, RootSize,
+			uint32_t(_current & (RootSize - 1)));
+	if (dist != Max<uint32_t>) {
+		ret = _current + dist;
+	}
+
+	// upper level slot is processed on the first tick of its window
+	for (uint32_t level = 0; level < Levels; ++level) {
+		auto shift = RootBits + level * LevelBits;
+		auto window = (_current >> shift);
+		if ((_current & ((uint64_t(1) << shift) - 1)) != 0) {
+			++window;
+		}
+
+		dist = TimerWheel_findNextSlot(_bitmap, RootSize + level * LevelSize, LevelSize,
+				uint32_t(window & (LevelSize - 1)));
+		if (dist != Max<uint32_t>) {
+			ret = sprt::min(ret, (window + dist) << shift);
+		}
+	}
+
+	return ret;
+}
+
+bool TimerWheel::start() {
+	if (_driver) {
+		return true;
+	}
+
+	// Driver is a resetable kernel timer, that is started disarmed
+	_driver = _queue->_timer(_queue, _queue->_platformQueue,
+			TimerInfo{
+				.completion = TimerInfo::Completion::create<TimerWheel>(this, &TimerWheel_onDriver),
+				.count = TimerInfo::Infinite,
+				.clock = __SPRT_CLOCK_MONOTONIC,
+				.resetable = true,
+			});
+
+	if (!_driver) {
+		return false;
+	}
+
+	_armed = 0;
+
+	// on failure, driver will be released within completion
+	_queue->runHandle(_driver.get());
+
+	if (_driver && _count > 0) {
+		arm(now());
+	}
+	return _driver != nullptr;
+}
+
+void TimerWheel::arm(uint64_t now) {
+	if (!_driver) {
+		return;
+	}
+
+	uint64_t next = 0;
+	TimeInterval delay;
+
+	if (_count > 0) {
+		next = getNextTick();
+		if (next > now) {
+			delay = TimeInterval::milliseconds(next - now);
+		} else {
+			delay = TimeInterval::microseconds(1);
+		}
+	}
+
+	if (next == _armed) {
+		return;
+	}
+
+	_armed = next;
+
+	// zero timeout disarms driver
+	_driver->reset(TimerInfo{
+		.timeout = delay,
+		.count = TimerInfo::Infinite,
+		.clock = __SPRT_CLOCK_MONOTONIC,
+		.resetable = true,
+	});
+}
+
+void TimerWheel::cleanup() {
+	_driver = nullptr;
+	_armed = 0;
+}
+
+void TimerWheel::link(TimerWheelSource *source) {
+	// timers, that are already expired, go to the nearest unprocessed tick
+	auto base = _processing ? _current + 1 : _current;
+	auto expires = sprt::max(source->deadline, base);
+	auto delta = expires - _current;
+
+	uint32_t slot = 0;
+	if (delta < RootSize) {
+		slot = uint32_t(expires & (RootSize - 1));
+	} else {
+		if (delta > MaxDelta) {
+			delta = MaxDelta;
+			expires = _current + MaxDelta;
+		}
+
+		uint32_t level = 0;
+		while (level + 1 < Levels && delta >= (uint64_t(1) << (RootBits + (level + 1) * LevelBits))) {
+			++level;
+		}
+
+		slot = RootSize + level * LevelSize
+				+ uint32_t((expires >> (RootBits + level * LevelBits)) & (LevelSize - 1));
+	}
+
+	auto head = &_slots[slot];
+	auto l = &source->link;
+
+	l->next = head;
+	l->prev = head->prev;
+	head->prev->next = l;
+	head->prev = l;
+
+	_bitmap[slot / 64] |= uint64_t(1) << (slot % 64);
+}
+
+void TimerWheel::unlink(TimerWheelSource *source) {
+	auto l = &source->link;
+
+	l->prev->next = l->next;
+	l->next->prev = l->prev;
+
+	// list becomes empty, when only slot head remains
+	if (l->next == l->prev && l->next >= _slots && l->next < _slots + SlotsCount) {
+		auto slot = uint32_t(l->next - _slots);
+		_bitmap[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+	}
+
+	l->next = l->prev = nullptr;
+}
+
+void TimerWheel::detach(uint32_t slot, TimerWheelLink *target) {
+	auto head = &_slots[slot];
+
+	if (head->next == head) {
+		target->next = target->prev = target;
+		return;
+	}
+
+	target->next = head->next;
+	target->prev = head->prev;
+	target->next->prev = target;
+	target->prev->next = target;
+
+	head->next = head->prev = head;
+
+	_bitmap[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+}
+
+void TimerWheel::cascade(uint32_t slot) {
+	TimerWheelLink pending;
+	detach(slot, &pending);
+
+	while (pending.next != &pending) {
+		auto source = reinterpret_cast<TimerWheelSource *>(pending.next);
+		unlink(source);
+		link(source);
+	}
+}
+
+TimerWheel::TimerWheel(QueueData *queue) : _queue(queue) {
+	for (auto &it : _slots) { it.next = it.prev = &it; }
+	sprt::memset(_bitmap, 0, sizeof(_bitmap));
+
+	_class.info = &queue->_info;
+	_class.inplaceSuspend = true;
+
+	_class.createFn = [](HandleClass *cl, Handle *handle, uint8_t data[Handle::DataSize]) {
+		static_assert(sizeof(TimerWheelSource) <= Handle::DataSize
+				&& sprt::is_standard_layout<TimerWheelSource>::value);
+		new (data) TimerWheelSource;
+		return HandleClass::create(cl, handle, data);
+	};
+	_class.destroyFn = HandleClass::destroy;
+
+	_class.runFn = [](HandleClass *cl, Handle *handle, uint8_t data[Handle::DataSize]) {
+		auto source = reinterpret_cast<TimerWheelSource *>(data);
+
+		auto status = static_cast<TimerWheelHandle *>(handle)->rearm(source->wheel, source);
+		if (status == Status::Ok || status == Status::Done) {
+			return HandleClass::run(cl, handle, data);
+		}
+		return status;
+	};
+
+	_class.cancelFn = [](HandleClass *cl, Handle *handle, uint8_t data[Handle::DataSize],
+							  Status st) {
+		auto source = reinterpret_cast<TimerWheelSource *>(data);
+
+		source->cancel();
+		source->~TimerWheelSource();
+
+		return HandleClass::cancel(cl, handle, data, st);
+	};
+
+	_class.suspendFn = [](HandleClass *cl, Handle *handle, uint8_t data[Handle::DataSize]) {
+		auto source = reinterpret_cast<TimerWheelSource *>(data);
+
+		auto status = static_cast<TimerWheelHandle *>(handle)->disarm(source->wheel, source);
+		if (status == Status::Ok || status == Status::Done) {
+			return HandleClass::suspend(cl, handle, data);
+		}
+		return status;
+	};
+
+	_class.resumeFn = [](HandleClass *cl, Handle *handle, uint8_t data[Handle::DataSize]) {
+		auto source = reinterpret_cast<TimerWheelSource *>(data);
+
+		auto status = HandleClass::resume(cl, handle, data);
+		if (status == Status::Ok || status == Status::Done) {
+			status = static_cast<TimerWheelHandle *>(handle)->rearm(source->wheel, source);
+		}
+		return status;
+	};
+}
+
+} // namespace sprt::dispatch
@@ -0,0 +1,140 @@
+/**
+ Copyright (c) 2025 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#ifndef RUNTIME_SRC_DISPATCH_DETAIL_SPRUNTIMEDISPATCHTIMERWHEEL_H_
+#define RUNTIME_SRC_DISPATCH_DETAIL_SPRUNTIMEDISPATCHTIMERWHEEL_H_
+
+#include "SPRuntimeDispatchHandleClass.h"
+
+namespace sprt::dispatch {
+
+struct TimerWheel;
+class TimerWheelHandle;
+
+struct SPRT_API TimerWheelLink {
+	TimerWheelLink *next = nullptr;
+	TimerWheelLink *prev = nullptr;
+};
+
+// Wheel entry for a handle, stored within Handle's data block
+struct SPRT_API TimerWheelSource {
+	TimerWheelLink link;
+	TimerWheel *wheel = nullptr;
+	TimerWheelHandle *handle = nullptr;
+	uint64_t deadline = 0; // in wheel ticks, 0 - not scheduled yet
+
+	bool isLinked() const { return link.next != nullptr; }
+
+	void cancel();
+};
+
+class SPRT_API TimerWheelHandle : public TimerHandle {
+public:
+	virtual ~TimerWheelHandle() = default;
+
+	bool init(HandleClass *, TimerWheel *, TimerInfo &&);
+
+	// Reset is performed in-place, without kernel calls
+	// Returns false if timer can not be represented with a wheel tick
+	virtual bool reset(TimerInfo &&) override;
+
+	Status rearm(TimerWheel *, TimerWheelSource *);
+	Status disarm(TimerWheel *, TimerWheelSource *);
+
+	void notify(TimerWheel *, TimerWheelSource *, uint64_t now);
+
+protected:
+	void setup(const TimerInfo &);
+
+	uint64_t _timeout = 0; // in wheel ticks
+	uint64_t _interval = 0; // in wheel ticks, 0 for oneshot timers
+	uint32_t _count = 0;
+	uint32_t _value = 0;
+};
+
+// Hierarchical timing wheel with a 1ms tick
+//
+// Root level has 256 slots, each of 4 upper levels has 64 slots, that covers 2^32 ticks
+// (~49 days); longer timers are parked on the last level and reinserted on cascade.
+// Insert and cancel are O(1), all wheel timers of a queue are driven with a single
+// kernel timer, that is re-armed only when the earliest deadline moves.
+struct SPRT_API TimerWheel : public sprt::detail::AllocPool {
+	static constexpr uint32_t RootBits = 8;
+	static constexpr uint32_t LevelBits = 6;
+	static constexpr uint32_t Levels = 4;
+
+	static constexpr uint32_t RootSize = 1 << RootBits;
+	static constexpr uint32_t LevelSize = 1 << LevelBits;
+	static constexpr uint32_t SlotsCount = RootSize + Levels * LevelSize;
+
+	static constexpr uint64_t MaxDelta = Max<uint32_t>;
+
+	// Wheel works only with relative timers, that are the multiples of a tick
+	static bool isSupported(const TimerInfo &);
+
+	static uint64_t getTicks(TimeInterval);
+	static uint64_t now();
+
+	QueueData *_queue = nullptr;
+	HandleClass _class;
+
+	Rc<TimerHandle> _driver;
+	uint64_t _armed = 0; // tick, driver was armed for, 0 if disarmed
+
+	uint64_t _current = 0; // next tick to process
+	size_t _count = 0;
+	bool _advancing = false;
+	bool _processing = false;
+
+	uint64_t _bitmap[SlotsCount / 64];
+	TimerWheelLink _slots[SlotsCount];
+
+	void insert(TimerWheelSource *);
+	void remove(TimerWheelSource *);
+
+	// Fire all timers with deadline <= now
+	void advance(uint64_t now);
+
+	// Tick of the nearest event within the wheel (expiration or cascade)
+	uint64_t getNextTick() const;
+
+	// Creates and runs driver timer, if it is not running
+	bool start();
+
+	// Updates driver for the nearest event within the wheel
+	void arm(uint64_t now);
+
+	void cleanup();
+
+	TimerWheel(QueueData *);
+
+protected:
+	void link(TimerWheelSource *);
+	void unlink(TimerWheelSource *);
+	void detach(uint32_t slot, TimerWheelLink *target);
+	void cascade(uint32_t slot);
+};
+
+} // namespace sprt::dispatch
+
+#endif /* RUNTIME_SRC_DISPATCH_DETAIL_SPRUNTIMEDISPATCHTIMERWHEEL_H_ */
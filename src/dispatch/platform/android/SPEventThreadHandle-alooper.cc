@@ -80,11 +80,7 @@ void ThreadALooperHandle::notify(ALooperData *alooper, EventFdSource *source,
 	}
 
 	if (data.queueFlags & __SPRT_ALOOPER_EVENT_INPUT) {
-		while (read() == Status::Ok) {
-			_mutex.lock();
-
-			performAll([&](uint32_t count) { _mutex.unlock(); });
-		}
+		while (read() == Status::Ok) { performAll(); }
 	}
 
 	if ((data.queueFlags & __SPRT_ALOOPER_EVENT_ERROR)
@@ -95,21 +91,19 @@ void ThreadALooperHandle::notify(ALooperData *alooper, EventFdSource *source,
 }
 
 Status ThreadALooperHandle::perform(Rc<Task> &&task) {
-	sprt::unique_lock lock(_mutex);
-	_outputQueue.emplace_back(move(task));
-
-	uint64_t value = 1;
-	::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	if (enqueue(move(task))) {
+		uint64_t value = 1;
+		::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	}
 	return Status::Ok;
 }
 
 Status ThreadALooperHandle::perform(dispatch::Function<void()> &&func, Ref *target,
 		StringView tag) {
-	sprt::unique_lock lock(_mutex);
-	_outputCallbacks.emplace_back(CallbackInfo{sprt::move(func), target, tag});
-
-	uint64_t value = 1;
-	::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	if (enqueue(sprt::move(func), target, tag)) {
+		uint64_t value = 1;
+		::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	}
 	return Status::Ok;
 }
 
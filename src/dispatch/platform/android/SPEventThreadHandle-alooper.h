@@ -45,9 +45,6 @@ public:
 
 	virtual Status perform(Rc<Task> &&task) override;
 	virtual Status perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) override;
-
-protected:
-	sprt::mutex _mutex;
 };
 
 } // namespace sprt::dispatch
@@ -378,6 +378,10 @@ Status KQueueThreadHandle::rearm(KQueueData *queue, KQueueThreadSource *source)
 		EV_SET(&ev, reinterpret_cast<uintptr_t>(source), EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0,
 				this);
 		status = queue->update(ev);
+
+		// trigger, that was issued while the event was not added, is lost, so allow next
+		// perform to signal again
+		_signaled.store(false, sprt::memory_order::release);
 	}
 	return status;
 }
@@ -398,17 +402,8 @@ void KQueueThreadHandle::notify(KQueueData *queue, KQueueThreadSource *source,
 		return; // just exit
 	}
 
-	auto performUnlock = [&] { performAll([&](uint32_t count) { _mutex.unlock(); }); };
-
 	if (data.result > 0) {
-		if constexpr (KQUEUE_THREAD_NONBLOCK) {
-			if (_mutex.try_lock()) {
-				performUnlock();
-			}
-		} else {
-			_mutex.lock();
-			performUnlock();
-		}
+		performAll();
 	} else {
 		cancel(data.result == 0 ? Status::Done : Status(data.result));
 	}
@@ -416,12 +411,11 @@ void KQueueThreadHandle::notify(KQueueData *queue, KQueueThreadSource *source,
 
 Status KQueueThreadHandle::perform(Rc<Task> &&task) {
 	auto q = reinterpret_cast<KQueueData *>(_class->info->data->_platformQueue);
-	sprt::unique_lock lock(_mutex);
-	_outputQueue.emplace_back(move(task));
-
-	struct kevent ev;
-	EV_SET(&ev, reinterpret_cast<uintptr_t>(_data), EVFILT_USER, 0, NOTE_TRIGGER, 1, this);
-	q->update(ev);
+	if (enqueue(move(task))) {
+		struct kevent ev;
+		EV_SET(&ev, reinterpret_cast<uintptr_t>(_data), EVFILT_USER, 0, NOTE_TRIGGER, 1, this);
+		q->update(ev);
+	}
 
 	return Status::Ok;
 }
@@ -429,12 +423,11 @@ Status KQueueThreadHandle::perform(Rc<Task> &&task) {
 Status KQueueThreadHandle::perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) {
 	auto q = reinterpret_cast<KQueueData *>(_class->info->data->_platformQueue);
 
-	sprt::unique_lock lock(_mutex);
-	_outputCallbacks.emplace_back(CallbackInfo{sprt::move(func), target, tag});
-
-	struct kevent ev;
-	EV_SET(&ev, reinterpret_cast<uintptr_t>(_data), EVFILT_USER, 0, NOTE_TRIGGER, 1, this);
-	q->update(ev);
+	if (enqueue(sprt::move(func), target, tag)) {
+		struct kevent ev;
+		EV_SET(&ev, reinterpret_cast<uintptr_t>(_data), EVFILT_USER, 0, NOTE_TRIGGER, 1, this);
+		q->update(ev);
+	}
 
 	return Status::Ok;
 }
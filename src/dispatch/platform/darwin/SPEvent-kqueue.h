@@ -33,8 +33,6 @@
 
 namespace sprt::dispatch {
 
-static constexpr bool KQUEUE_THREAD_NONBLOCK = false;
-
 struct SPRT_API KQueueData : public PlatformQueueData {
 	int _kqueueFd = -1;
 
@@ -107,9 +105,6 @@ public:
 
 	virtual Status perform(Rc<Task> &&task) override;
 	virtual Status perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) override;
-
-protected:
-	sprt::mutex _mutex;
 };
 
 } // namespace sprt::dispatch
@@ -338,17 +338,8 @@ void RunLoopThreadHandle::notify(RunLoopData *queue, RunLoopThreadSource *source
 		return; // just exit
 	}
 
-	auto performUnlock = [&] { performAll([&](uint32_t count) { _mutex.unlock(); }); };
-
 	if (data.result > 0) {
-		if constexpr (RUNLOOP_THREAD_NONBLOCK) {
-			if (_mutex.try_lock()) {
-				performUnlock();
-			}
-		} else {
-			_mutex.lock();
-			performUnlock();
-		}
+		performAll();
 	} else {
 		cancel(data.result == 0 ? Status::Done : Status(data.result));
 	}
@@ -356,11 +347,10 @@ void RunLoopThreadHandle::notify(RunLoopData *queue, RunLoopThreadSource *source
 
 Status RunLoopThreadHandle::perform(Rc<Task> &&task) {
 	auto q = reinterpret_cast<RunLoopData *>(_class->info->data->_platformQueue);
-	sprt::unique_lock lock(_mutex);
-	_outputQueue.emplace_back(move(task));
-
-	NotifyData n{1, 0, 0};
-	q->trigger(this, n);
+	if (enqueue(move(task))) {
+		NotifyData n{1, 0, 0};
+		q->trigger(this, n);
+	}
 	return Status::Ok;
 }
 
@@ -368,11 +358,10 @@ Status RunLoopThreadHandle::perform(dispatch::Function<void()> &&func, Ref *targ
 		StringView tag) {
 	auto q = reinterpret_cast<RunLoopData *>(_class->info->data->_platformQueue);
 
-	sprt::unique_lock lock(_mutex);
-	_outputCallbacks.emplace_back(CallbackInfo{sprt::move(func), target, tag});
-
-	NotifyData n{1, 0, 0};
-	q->trigger(this, n);
+	if (enqueue(sprt::move(func), target, tag)) {
+		NotifyData n{1, 0, 0};
+		q->trigger(this, n);
+	}
 	return Status::Ok;
 }
 
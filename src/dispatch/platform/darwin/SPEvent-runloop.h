@@ -31,8 +31,6 @@
 
 namespace sprt::dispatch {
 
-static constexpr bool RUNLOOP_THREAD_NONBLOCK = false;
-
 struct RunLoopData;
 
 struct SPRT_API RunLoopTimerSource {
@@ -104,9 +102,6 @@ public:
 
 	virtual Status perform(Rc<Task> &&task) override;
 	virtual Status perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) override;
-
-protected:
-	sprt::mutex _mutex;
 };
 
 } // namespace sprt::dispatch
@@ -22,6 +22,7 @@
  **/
 
 #include "SPEvent-epoll.h"
+#include "../fd/SPEventFileFd.h"
 
 #include <sprt/runtime/log.h>
 
@@ -51,6 +52,47 @@ Status EPollData::remove(int fd) {
 	return Status::Ok;
 }
 
+ThreadHandle *EPollData::getFileIoHandle() {
+	if (!_fileIoHandle) {
+		_fileIoHandle = _data->addThreadHandle();
+		if (!_fileIoHandle || !isSuccessful(_data->runHandle(_fileIoHandle))) {
+			_fileIoHandle = nullptr;
+		}
+	}
+	return _fileIoHandle;
+}
+
+Status EPollData::performFileOp(Handle *h, FileOpSource *source) {
+	if (!_fileIoPool) {
+		auto handle = getFileIoHandle();
+		if (!handle) {
+			return Status::ErrorNotImplemented;
+		}
+
+		_fileIoPool = Rc<ThreadPool>::create(ThreadPoolInfo{
+			.flags = ThreadPoolFlags::LazyInit,
+			.name = StringView("Queue:FileIo"),
+			.threadCount = _fileIoThreads,
+			.complete = handle,
+			.ref = handle,
+		});
+
+		if (!_fileIoPool) {
+			return Status::ErrorNotImplemented;
+		}
+	}
+
+	return _fileIoPool->perform(Rc<Task>::create([source](const Task &) {
+		source->result = source->perform();
+		return true;
+	}, [this, h, source](const Task &, bool success) {
+		// Task fails only when pool was cancelled with the queue, do not notify handle then
+		if (success) {
+			_data->notify(h, NotifyData{intptr_t(source->result)});
+		}
+	}, h));
+}
+
 Status EPollData::runPoll(TimeInterval ival) {
 	if (_processedEvents < _receivedEvents) {
 		return Status::Ok;
@@ -255,6 +297,10 @@ EPollData::EPollData(QueueRef *q, Queue::Data *data, const QueueInfo &info, Span
 		return;
 	}
 
+	if (info.fileIoThreads) {
+		_fileIoThreads = info.fileIoThreads;
+	}
+
 	auto size = info.completeQueueSize;
 
 	if (size == 0) {
@@ -266,6 +312,12 @@ EPollData::EPollData(QueueRef *q, Queue::Data *data, const QueueInfo &info, Span
 }
 
 EPollData::~EPollData() {
+	if (_fileIoPool) {
+		_fileIoPool->cancel();
+		_fileIoPool = nullptr;
+	}
+	_fileIoHandle = nullptr;
+
 	if (_epollFd >= 0) {
 		::close(_epollFd);
 		_epollFd = -1;
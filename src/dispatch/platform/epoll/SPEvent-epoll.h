@@ -33,6 +33,8 @@
 
 namespace sprt::dispatch {
 
+struct FileOpSource;
+
 struct SPRT_API EPollData : public PlatformQueueData {
 	Rc<SignalFdHandle> _signalFd;
 	Rc<EventFdHandle> _eventFd;
@@ -44,9 +46,21 @@ struct SPRT_API EPollData : public PlatformQueueData {
 	uint32_t _receivedEvents = 0;
 	uint32_t _processedEvents = 0;
 
+	// epoll has no async file IO, blocking operations are performed on the thread pool,
+	// and completed on this queue with ThreadHandle
+	Rc<ThreadHandle> _fileIoHandle;
+	Rc<ThreadPool> _fileIoPool;
+	uint16_t _fileIoThreads = QueueInfo::DefaultFileIoThreads;
+
 	Status add(int fd, const epoll_event &ev);
 	Status remove(int fd);
 
+	// Handle to deliver results of the deferred operations on this queue, created on demand
+	ThreadHandle *getFileIoHandle();
+
+	// Handle will be notified with operation result
+	Status performFileOp(Handle *, FileOpSource *);
+
 	Status runPoll(TimeInterval);
 	uint32_t processEvents();
 
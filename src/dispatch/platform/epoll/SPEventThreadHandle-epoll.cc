@@ -86,8 +86,7 @@ void ThreadEPollHandle::notify(EPollData *epoll, EventFdSource *source, const No
 		while (read() == Status::Ok) { checked = true; }
 
 		if (checked) {
-			_mutex.lock();
-			performAll([&](uint32_t count) { _mutex.unlock(); });
+			performAll();
 		}
 	}
 
@@ -97,20 +96,18 @@ void ThreadEPollHandle::notify(EPollData *epoll, EventFdSource *source, const No
 }
 
 Status ThreadEPollHandle::perform(Rc<Task> &&task) {
-	sprt::unique_lock lock(_mutex);
-	_outputQueue.emplace_back(move(task));
-
-	uint64_t value = 1;
-	::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	if (enqueue(move(task))) {
+		uint64_t value = 1;
+		::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	}
 	return Status::Ok;
 }
 
 Status ThreadEPollHandle::perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) {
-	sprt::unique_lock lock(_mutex);
-	_outputCallbacks.emplace_back(CallbackInfo{sprt::move(func), target, tag});
-
-	uint64_t value = 1;
-	::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	if (enqueue(sprt::move(func), target, tag)) {
+		uint64_t value = 1;
+		::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
+	}
 	return Status::Ok;
 }
 
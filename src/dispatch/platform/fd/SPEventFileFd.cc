@@ -0,0 +1,247 @@
+/**
+ Copyright (c) 2025 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#include "SPEventFileFd.h"
+#include "../epoll/SPEvent-epoll.h"
+#include "../uring/SPEvent-uring.h"
+
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+
+namespace sprt::dispatch {
+
+static_assert(sizeof(IoVec) == sizeof(struct iovec), "IoVec should be compatible with iovec");
+
+static uint8_t getFileOpUringCode(FileOpType type) {
+	switch (type) {
+	case FileOpType::Read: return IORING_OP_READ;
+	case FileOpType::ReadVec: return IORING_OP_READV;
+	case FileOpType::Write: return IORING_OP_WRITE;
+	case FileOpType::WriteVec: return IORING_OP_WRITEV;
+	case FileOpType::Sync:
+	case FileOpType::DataSync: return IORING_OP_FSYNC;
+	case FileOpType::Send: return IORING_OP_SEND;
+	case FileOpType::SendMsg: return IORING_OP_SENDMSG;
+	}
+	return IORING_OP_NOP;
+}
+
+bool FileOpSource::init(const FileOpInfo &info) {
+	fd = info.fd;
+	type = info.type;
+	buffer = info.buffer;
+	offset = info.offset;
+	result = 0;
+	size = info.size;
+	waitFd = -1;
+	return fd >= 0;
+}
+
+int64_t FileOpSource::perform() {
+	ssize_t ret = -1;
+	auto iov = reinterpret_cast<const struct iovec *>(buffer);
+	bool current = (offset == FileOffsetCurrent);
+
+	switch (type) {
+	case FileOpType::Read:
+		ret = current ? ::read(fd, buffer, size) : ::pread(fd, buffer, size, off_t(offset));
+		break;
+	case FileOpType::ReadVec:
+		ret = current ? ::readv(fd, iov, int(size)) : ::preadv(fd, iov, int(size), off_t(offset));
+		break;
+	case FileOpType::Write:
+		ret = current ? ::write(fd, buffer, size) : ::pwrite(fd, buffer, size, off_t(offset));
+		break;
+	case FileOpType::WriteVec:
+		ret = current ? ::writev(fd, iov, int(size))
+					  : ::pwritev(fd, iov, int(size), off_t(offset));
+		break;
+	case FileOpType::Sync: ret = ::fsync(fd); break;
+	case FileOpType::DataSync: ret = ::fdatasync(fd); break;
+	case FileOpType::Send:
+	case FileOpType::SendMsg: return send();
+	}
+
+	if (ret < 0) {
+		return -int64_t(__sprt_errno);
+	}
+	return ret;
+}
+
+int64_t FileOpSource::send() {
+	ssize_t ret = -1;
+	struct msghdr msg;
+	if (type == FileOpType::SendMsg) {
+		sprt::memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = reinterpret_cast<struct iovec *>(buffer);
+		msg.msg_iovlen = size;
+	}
+
+	do {
+		if (type == FileOpType::Send) {
+			ret = ::send(fd, buffer, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+		} else {
+			ret = ::sendmsg(fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT);
+		}
+	} while (ret < 0 && __sprt_errno == EINTR);
+
+	if (ret < 0) {
+		return -int64_t(__sprt_errno);
+	}
+	return ret;
+}
+
+template <typename Base>
+bool FileOpHandle<Base>::init(HandleClass *cl, const FileOpInfo &info,
+		CompletionHandle<Base> &&c) {
+	if (!Handle::init(cl, move(c))) {
+		return false;
+	}
+
+	auto source = new (this->_data) FileOpSource;
+	return source->init(info);
+}
+
+template <typename Base>
+NativeHandle FileOpHandle<Base>::getNativeHandle() const {
+	return reinterpret_cast<const FileOpSource *>(this->_data)->fd;
+}
+
+template <typename Base>
+void FileOpHandle<Base>::complete(int64_t result) {
+	// operation is finished, so, handle can be cancelled without suspendFn
+	this->_status = Status::Suspended;
+
+	static_assert(FileOpInfo::MaxSize <= Max<uint32_t>,
+			"Operation size should fit into the completion value");
+
+	if (result < 0) {
+		this->cancel(sprt::status::errnoToStatus(int(-result)));
+	} else {
+		// requests are limited with FileOpInfo::MaxSize on submission
+		this->cancel(Status::Done, uint32_t(result));
+	}
+}
+
+template <typename Base>
+bool FileOpURingHandle<Base>::isSupported(URingData *uring, FileOpType type) {
+	return uring->_probe.isOpcodeSupported(getFileOpUringCode(type));
+}
+
+template <typename Base>
+Status FileOpURingHandle<Base>::rearm(URingData *uring, FileOpSource *source) {
+	auto status = this->prepareRearm();
+	if (status == Status::Ok) {
+		auto opcode = getFileOpUringCode(source->type);
+
+		// buffers within queue's fixed buffers arena are already pinned by kernel
+		int32_t bufferIndex = -1;
+		if (source->type == FileOpType::Read || source->type == FileOpType::Write) {
+			bufferIndex = uring->_data->getFixedBufferIndex(source->buffer, source->size);
+			if (bufferIndex >= 0) {
+				opcode = (source->type == FileOpType::Read) ? IORING_OP_READ_FIXED
+															: IORING_OP_WRITE_FIXED;
+			}
+		}
+
+		status = uring->pushSqe({opcode}, [&](io_uring_sqe *sqe, uint32_t n) {
+			sqe->ioprio = 0;
+			uring->setSqeFile(sqe, source->fd);
+			sqe->buf_index = (bufferIndex >= 0) ? uint16_t(bufferIndex) : 0;
+			sqe->personality = 0;
+			sqe->splice_fd_in = 0;
+			switch (source->type) {
+			case FileOpType::Sync:
+			case FileOpType::DataSync:
+				sqe->off = 0;
+				sqe->addr = 0;
+				sqe->len = 0;
+				sqe->fsync_flags =
+						(source->type == FileOpType::DataSync) ? IORING_FSYNC_DATASYNC : 0;
+				break;
+			default:
+				// FileOffsetCurrent is -1, that means current file position for io_uring
+				sqe->off = source->offset;
+				sqe->addr = reinterpret_cast<uintptr_t>(source->buffer);
+				sqe->len = source->size;
+				sqe->rw_flags = 0;
+				break;
+			}
+			sqe->user_data = reinterpret_cast<uintptr_t>(this) | URING_USERDATA_RETAIN_BIT
+					| (this->_timeline & URING_USERDATA_SERIAL_MASK);
+		}, URingPushFlags::Submit);
+	}
+	return status;
+}
+
+template <typename Base>
+Status FileOpURingHandle<Base>::disarm(URingData *uring, FileOpSource *source) {
+	// in-flight io can not be safely interrupted, buffer ownership belongs to the kernel
+	return Status::ErrorNotSupported;
+}
+
+template <typename Base>
+void FileOpURingHandle<Base>::notify(URingData *uring, FileOpSource *source,
+		const NotifyData &data) {
+	if (this->_status != Status::Ok) {
+		return;
+	}
+
+	this->complete(data.result);
+}
+
+template <typename Base>
+Status FileOpEPollHandle<Base>::rearm(EPollData *epoll, FileOpSource *source) {
+	auto status = this->prepareRearm();
+	if (status == Status::Ok) {
+		status = epoll->performFileOp(this, source);
+	}
+	return status;
+}
+
+template <typename Base>
+Status FileOpEPollHandle<Base>::disarm(EPollData *epoll, FileOpSource *source) {
+	return Status::ErrorNotSupported;
+}
+
+template <typename Base>
+void FileOpEPollHandle<Base>::notify(EPollData *epoll, FileOpSource *source,
+		const NotifyData &data) {
+	if (this->_status != Status::Ok) {
+		return;
+	}
+
+	this->complete(data.result);
+}
+
+template class FileOpHandle<ReadHandle>;
+template class FileOpHandle<WriteHandle>;
+
+template class FileOpURingHandle<ReadHandle>;
+template class FileOpURingHandle<WriteHandle>;
+
+template class FileOpEPollHandle<ReadHandle>;
+template class FileOpEPollHandle<WriteHandle>;
+
+} // namespace sprt::dispatch
@@ -0,0 +1,108 @@
+/**
+ Copyright (c) 2025 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#ifndef CORE_EVENT_PLATFORM_FD_SPEVENTFILEFD_H_
+#define CORE_EVENT_PLATFORM_FD_SPEVENTFILEFD_H_
+
+#include "SPEventFd.h"
+#include "../../detail/SPRuntimeDispatchHandleClass.h"
+#include "../../detail/SPRuntimeDispatchQueueData.h"
+
+namespace sprt::dispatch {
+
+struct FileOpSource {
+	// `waitFd` value for the epoll socket send, that is completed, but not reported yet
+	static constexpr int WaitFdResultPending = -2;
+
+	int fd;
+	FileOpType type;
+	void *buffer;
+	uint64_t offset;
+	int64_t result; // used by blocking fallback and epoll socket send
+	uint32_t size;
+	int waitFd; // epoll socket send: duplicate of `fd`, registered for EPOLLOUT
+
+	bool init(const FileOpInfo &);
+	void cancel() { }
+
+	// Blocking variant of the operation, returns result or negative errno
+	// Sockets are not waited for, see `send`
+	int64_t perform();
+
+	// Single non-blocking attempt for Send/SendMsg, returns result or negative errno
+	int64_t send();
+};
+
+/* One-shot file operation handle
+ *
+ * Base should be ReadHandle or WriteHandle. Handle is not suspendable,
+ * it completes with Status::Done and number of bytes transferred, or with an errno-based status
+ */
+template <typename Base>
+class SPRT_API FileOpHandle : public Base {
+public:
+	virtual ~FileOpHandle() = default;
+
+	bool init(HandleClass *, const FileOpInfo &, CompletionHandle<Base> &&);
+
+	virtual NativeHandle getNativeHandle() const override;
+
+protected:
+	void complete(int64_t result);
+};
+
+// Native io_uring read/write/fsync
+template <typename Base>
+class SPRT_API FileOpURingHandle : public FileOpHandle<Base> {
+public:
+	static bool isSupported(URingData *, FileOpType);
+
+	virtual ~FileOpURingHandle() = default;
+
+	Status rearm(URingData *, FileOpSource *);
+	Status disarm(URingData *, FileOpSource *);
+
+	void notify(URingData *, FileOpSource *, const NotifyData &);
+};
+
+// Blocking operation on the queue's file IO thread pool
+template <typename Base>
+class SPRT_API FileOpEPollHandle : public FileOpHandle<Base> {
+public:
+	virtual ~FileOpEPollHandle() = default;
+
+	Status rearm(EPollData *, FileOpSource *);
+	Status disarm(EPollData *, FileOpSource *);
+
+	void notify(EPollData *, FileOpSource *, const NotifyData &);
+};
+
+using FileReadURingHandle = FileOpURingHandle<ReadHandle>;
+using FileWriteURingHandle = FileOpURingHandle<WriteHandle>;
+
+using FileReadEPollHandle = FileOpEPollHandle<ReadHandle>;
+using FileWriteEPollHandle = FileOpEPollHandle<WriteHandle>;
+
+} // namespace sprt::dispatch
+
+#endif /* CORE_EVENT_PLATFORM_FD_SPEVENTFILEFD_H_ */
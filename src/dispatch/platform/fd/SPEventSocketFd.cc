@@ -0,0 +1,558 @@
+/**
+ Copyright (c) 2025 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#include "SPEventSocketFd.h"
+#include "../epoll/SPEvent-epoll.h"
+#include "../uring/SPEvent-uring.h"
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace sprt::dispatch {
+
+static constexpr int SOCKET_ACCEPT_FLAGS = SOCK_CLOEXEC | SOCK_NONBLOCK;
+
+// pause before the next accept after the resource exhaustion
+static constexpr uint64_t SOCKET_ACCEPT_BACKOFF_MS = 100;
+
+// errors for a single connection, next one can be accepted right away
+static bool isSocketAcceptErrorRetryable(int err) {
+	switch (err) {
+	case EINTR:
+	case ECONNABORTED:
+	case EPROTO: return true;
+	default: break;
+	}
+	return false;
+}
+
+// out of descriptors or memory: retrying right away only spins, wait for the system to recover
+static bool isSocketAcceptErrorResource(int err) {
+	switch (err) {
+	case EPERM:
+	case EMFILE:
+	case ENFILE:
+	case ENOBUFS:
+	case ENOMEM: return true;
+	default: break;
+	}
+	return false;
+}
+
+bool SocketSource::init(int f) {
+	fd = f;
+	backoff = false;
+	return fd >= 0;
+}
+
+bool SocketAcceptHandle::init(HandleClass *cl, int fd, CompletionHandle<AcceptHandle> &&c) {
+	if (!Handle::init(cl, move(c))) {
+		return false;
+	}
+
+	auto source = new (_data) SocketSource;
+	return source->init(fd);
+}
+
+NativeHandle SocketAcceptHandle::getNativeHandle() const {
+	return reinterpret_cast<const SocketSource *>(_data)->fd;
+}
+
+Status SocketAcceptURingHandle::rearm(URingData *uring, SocketSource *source) {
+	auto status = prepareRearm();
+	if (status == Status::Ok) {
+		source->backoff = false;
+		status = uring->pushSqe({IORING_OP_ACCEPT}, [&](io_uring_sqe *sqe, uint32_t n) {
+			uring->setSqeFile(sqe, source->fd);
+			sqe->addr = 0;
+			sqe->addr2 = 0;
+			sqe->accept_flags = SOCKET_ACCEPT_FLAGS;
+			if (hasFlag(uring->_uflags, URingFlags::AcceptMultishotSupported)) {
+				sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+			}
+			sqe->user_data = reinterpret_cast<uintptr_t>(this) | URING_USERDATA_RETAIN_BIT
+					| (_timeline & URING_USERDATA_SERIAL_MASK);
+		}, URingPushFlags::Submit);
+	}
+	return status;
+}
+
+Status SocketAcceptURingHandle::disarm(URingData *uring, SocketSource *source) {
+	auto status = prepareDisarm();
+	if (status == Status::Ok) {
+		status = uring->cancelOp(reinterpret_cast<uintptr_t>(this) | URING_USERDATA_RETAIN_BIT
+						| (_timeline & URING_USERDATA_SERIAL_MASK),
+				URingCancelFlags::Suspend);
+		++_timeline;
+	}
+	return status;
+}
+
+void SocketAcceptURingHandle::notify(URingData *uring, SocketSource *source,
+		const NotifyData &data) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	if ((data.queueFlags & IORING_CQE_F_MORE) == 0) {
+		_status = Status::Suspended;
+	}
+
+	if (data.result < 0) {
+		auto err = -data.result;
+		if (isSocketAcceptErrorResource(err)) {
+			if (_status == Status::Suspended) {
+				// rearm after the pause, so the kernel does not fail it right away in a loop
+				source->backoff = true;
+				uring->_queue->get()->schedule(
+						TimeInterval::milliseconds(SOCKET_ACCEPT_BACKOFF_MS),
+						[this, uring, source](Handle *, bool success) {
+					if (success && source->backoff && _status == Status::Suspended) {
+						rearm(uring, source);
+					}
+				}, this);
+			}
+			return;
+		} else if (err != EAGAIN && !isSocketAcceptErrorRetryable(err)) {
+			cancel(URingData::getErrnoStatus(data.result));
+			return;
+		}
+	}
+
+	if (_status == Status::Suspended) {
+		rearm(uring, source);
+	}
+
+	if (data.result >= 0) {
+		sendCompletion(uint32_t(data.result), Status::Ok);
+	}
+}
+
+Status SocketAcceptEPollHandle::rearm(EPollData *epoll, SocketSource *source) {
+	auto status = prepareRearm();
+	if (status == Status::Ok) {
+		source->backoff = false;
+		source->event.data.ptr = this;
+		source->event.events = __SPRT_EPOLLIN;
+
+		status = epoll->add(source->fd, source->event);
+	}
+	return status;
+}
+
+Status SocketAcceptEPollHandle::disarm(EPollData *epoll, SocketSource *source) {
+	auto status = prepareDisarm();
+	if (status == Status::Ok) {
+		// socket is already removed from epoll on backoff
+		if (!source->backoff) {
+			status = epoll->remove(source->fd);
+		}
+		source->backoff = false;
+		++_timeline;
+	} else if (status == Status::ErrorAlreadyPerformed) {
+		return Status::Ok;
+	}
+	return status;
+}
+
+void SocketAcceptEPollHandle::notify(EPollData *epoll, SocketSource *source,
+		const NotifyData &data) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	if (data.queueFlags & __SPRT_EPOLLIN) {
+		// accept all pending connections, stop if handle was cancelled from completion
+		while (_status == Status::Ok) {
+			auto fd = ::accept4(source->fd, nullptr, nullptr, SOCKET_ACCEPT_FLAGS);
+			if (fd >= 0) {
+				sendCompletion(uint32_t(fd), Status::Ok);
+			} else if (__sprt_errno == EAGAIN || __sprt_errno == EWOULDBLOCK) {
+				break;
+			} else if (isSocketAcceptErrorResource(__sprt_errno)) {
+				// listening socket stays readable, stop polling it for a while
+				if (epoll->remove(source->fd) == Status::Ok) {
+					source->backoff = true;
+					epoll->_queue->get()->schedule(
+							TimeInterval::milliseconds(SOCKET_ACCEPT_BACKOFF_MS),
+							[this, epoll, source](Handle *, bool success) {
+						if (success && source->backoff && _status == Status::Ok) {
+							auto status = epoll->add(source->fd, source->event);
+							if (status == Status::Ok) {
+								source->backoff = false;
+							} else {
+								cancel(status);
+							}
+						}
+					}, this);
+				}
+				return;
+			} else if (!isSocketAcceptErrorRetryable(__sprt_errno)) {
+				cancel(sprt::status::errnoToStatus(__sprt_errno));
+				return;
+			}
+		}
+	}
+
+	if ((data.queueFlags & __SPRT_EPOLLERR) || (data.queueFlags & __SPRT_EPOLLHUP)) {
+		cancel();
+	}
+}
+
+SocketRecvHandle::~SocketRecvHandle() { }
+
+bool SocketRecvHandle::init(HandleClass *cl, int fd, RecvInfo &&info) {
+	if (!Handle::init(cl, move(info.completion))) {
+		return false;
+	}
+
+	if (info.bufferCount == 0 || info.bufferCount > Max<uint16_t> || info.bufferSize == 0) {
+		return false;
+	}
+
+	_bufferCount = info.bufferCount;
+	_bufferSize = info.bufferSize;
+	_buffers.resize(size_t(_bufferCount) * _bufferSize);
+
+	auto source = new (_data) SocketSource;
+	return source->init(fd);
+}
+
+NativeHandle SocketRecvHandle::getNativeHandle() const {
+	return reinterpret_cast<const SocketSource *>(_data)->fd;
+}
+
+Status SocketRecvURingHandle::rearm(URingData *uring, SocketSource *source, bool updateBuffers) {
+	auto status = prepareRearm();
+	if (status == Status::Ok) {
+		if (!_bufferGroup) {
+			_bufferGroup = uring->registerBufferGroup(_bufferCount, _bufferSize, _buffers.data());
+		} else if (updateBuffers) {
+			_bufferGroup =
+					uring->reloadBufferGroup(_bufferGroup, _bufferCount, _bufferSize, _buffers.data());
+		}
+
+		if (!_bufferGroup) {
+			return Status::ErrorInvalidArguemnt;
+		}
+
+		status = uring->pushSqe({IORING_OP_RECV}, [&](io_uring_sqe *sqe, uint32_t) {
+			uring->setSqeFile(sqe, source->fd);
+			sqe->buf_group = _bufferGroup;
+			sqe->len = 0; // use size of the selected buffer
+			sqe->msg_flags = 0;
+			sqe->flags |= IOSQE_BUFFER_SELECT;
+			if (hasFlag(uring->_uflags, URingFlags::RecvMultishotSupported)) {
+				sqe->ioprio = IORING_RECV_MULTISHOT;
+			}
+			sqe->user_data = reinterpret_cast<uintptr_t>(this) | URING_USERDATA_RETAIN_BIT
+					| (_timeline & URING_USERDATA_SERIAL_MASK);
+		}, URingPushFlags::Submit);
+	}
+	return status;
+}
+
+Status SocketRecvURingHandle::disarm(URingData *uring, SocketSource *source) {
+	auto status = prepareDisarm();
+	if (status == Status::Ok) {
+		status = uring->cancelOp(reinterpret_cast<uintptr_t>(this) | URING_USERDATA_RETAIN_BIT
+						| (_timeline & URING_USERDATA_SERIAL_MASK),
+				URingCancelFlags::Suspend);
+		++_timeline;
+		if (_bufferGroup) {
+			uring->unregisterBufferGroup(_bufferGroup, _bufferCount);
+			_bufferGroup = 0;
+		}
+	}
+	return status;
+}
+
+void SocketRecvURingHandle::notify(URingData *uring, SocketSource *source,
+		const NotifyData &data) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	bool more = (data.queueFlags & IORING_CQE_F_MORE);
+	if (!more) {
+		_status = Status::Suspended;
+	}
+
+	if (data.result == -ENOBUFS) {
+		// all buffers were consumed and processed, provide them again
+		if (!more) {
+			rearm(uring, source, true);
+		}
+		return;
+	}
+
+	if (data.result <= 0) {
+		if (_bufferGroup) {
+			uring->unregisterBufferGroup(_bufferGroup, _bufferCount);
+			_bufferGroup = 0;
+		}
+
+		if (data.result == 0) {
+			cancel(Status::Done); // EOF
+		} else {
+			cancel(URingData::getErrnoStatus(data.result));
+		}
+		return;
+	}
+
+	if (data.queueFlags & IORING_CQE_F_BUFFER) {
+		auto bid = data.queueFlags >> IORING_CQE_BUFFER_SHIFT;
+		_received = BytesView(_buffers.data() + size_t(bid) * _bufferSize, size_t(data.result));
+	}
+
+	if (!more) {
+		rearm(uring, source);
+	}
+
+	sendCompletion(uint32_t(data.result), Status::Ok);
+
+	_received = BytesView();
+}
+
+Status SocketRecvEPollHandle::rearm(EPollData *epoll, SocketSource *source) {
+	auto status = prepareRearm();
+	if (status == Status::Ok) {
+		source->event.data.ptr = this;
+		source->event.events = __SPRT_EPOLLIN | __SPRT_EPOLLRDHUP;
+
+		status = epoll->add(source->fd, source->event);
+	}
+	return status;
+}
+
+Status SocketRecvEPollHandle::disarm(EPollData *epoll, SocketSource *source) {
+	auto status = prepareDisarm();
+	if (status == Status::Ok) {
+		status = epoll->remove(source->fd);
+		++_timeline;
+	} else if (status == Status::ErrorAlreadyPerformed) {
+		return Status::Ok;
+	}
+	return status;
+}
+
+void SocketRecvEPollHandle::notify(EPollData *epoll, SocketSource *source,
+		const NotifyData &data) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	// read until EAGAIN or EOF, buffers are reused in order
+	uint32_t bid = 0;
+	while (_status == Status::Ok) {
+		auto buf = _buffers.data() + size_t(bid) * _bufferSize;
+		auto ret = ::recv(source->fd, buf, _bufferSize, MSG_DONTWAIT);
+		if (ret > 0) {
+			_received = BytesView(buf, size_t(ret));
+			sendCompletion(uint32_t(ret), Status::Ok);
+			_received = BytesView();
+			bid = (bid + 1) % _bufferCount;
+		} else if (ret == 0) {
+			cancel(Status::Done);
+			return;
+		} else if (__sprt_errno == EAGAIN || __sprt_errno == EWOULDBLOCK) {
+			break;
+		} else if (__sprt_errno != EINTR) {
+			cancel(sprt::status::errnoToStatus(__sprt_errno));
+			return;
+		}
+	}
+
+	if (_status == Status::Ok && (data.queueFlags & __SPRT_EPOLLERR)) {
+		cancel();
+	}
+}
+
+static uint8_t getSocketSendUringCode(FileOpType type, bool zeroCopy) {
+	if (type == FileOpType::Send) {
+		return zeroCopy ? IORING_OP_SEND_ZC : IORING_OP_SEND;
+	}
+	return zeroCopy ? IORING_OP_SENDMSG_ZC : IORING_OP_SENDMSG;
+}
+
+bool SocketSendURingHandle::isSupported(URingData *uring, FileOpType type) {
+	return uring->_probe.isOpcodeSupported(getSocketSendUringCode(type, false));
+}
+
+Status SocketSendURingHandle::rearm(URingData *uring, FileOpSource *source) {
+	auto status = prepareRearm();
+	if (status == Status::Ok) {
+		size_t size = source->size;
+		if (source->type == FileOpType::SendMsg) {
+			sprt::memset(&_msg, 0, sizeof(_msg));
+			_msg.msg_iov = reinterpret_cast<struct iovec *>(source->buffer);
+			_msg.msg_iovlen = source->size;
+
+			size = 0;
+			for (uint32_t i = 0; i < source->size; ++i) { size += _msg.msg_iov[i].iov_len; }
+		}
+
+		auto zeroCopy = size >= ZeroCopyThreshold
+				&& hasFlag(uring->_uflags, URingFlags::SendZeroCopySupported);
+
+		source->result = 0;
+
+		status = uring->pushSqe({getSocketSendUringCode(source->type, zeroCopy)},
+				[&](io_uring_sqe *sqe, uint32_t) {
+			uring->setSqeFile(sqe, source->fd);
+			if (source->type == FileOpType::Send) {
+				sqe->addr = reinterpret_cast<uintptr_t>(source->buffer);
+				sqe->len = source->size;
+			} else {
+				sqe->addr = reinterpret_cast<uintptr_t>(&_msg);
+				sqe->len = 1;
+			}
+			sqe->msg_flags = MSG_NOSIGNAL;
+			sqe->user_data = reinterpret_cast<uintptr_t>(this) | URING_USERDATA_RETAIN_BIT
+					| (_timeline & URING_USERDATA_SERIAL_MASK);
+		}, URingPushFlags::Submit);
+	}
+	return status;
+}
+
+Status SocketSendURingHandle::disarm(URingData *uring, FileOpSource *source) {
+	return Status::ErrorNotSupported;
+}
+
+void SocketSendURingHandle::notify(URingData *uring, FileOpSource *source,
+		const NotifyData &data) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	if (data.queueFlags & IORING_CQE_F_NOTIF) {
+		// zero-copy buffer was released by kernel, now we can complete
+		complete(source->result);
+		return;
+	}
+
+	if (data.queueFlags & IORING_CQE_F_MORE) {
+		// zero-copy result, wait for the notification
+		source->result = data.result;
+		return;
+	}
+
+	complete(data.result);
+}
+
+
+Status SocketSendEPollHandle::rearm(EPollData *epoll, FileOpSource *source) {
+	auto status = prepareRearm();
+	if (status != Status::Ok) {
+		return status;
+	}
+
+	if (source->waitFd == FileOpSource::WaitFdResultPending) {
+		// result was not delivered before suspension
+		return postResult(epoll, source, source->result);
+	}
+
+	auto ret = source->send();
+	if (ret != -EAGAIN) {
+		return postResult(epoll, source, ret);
+	}
+
+	// socket fd itself can be registered with a receiver, so, wait on a duplicate
+	source->waitFd = ::fcntl(source->fd, F_DUPFD_CLOEXEC, 0);
+	if (source->waitFd < 0) {
+		return postResult(epoll, source, -int64_t(__sprt_errno));
+	}
+
+	epoll_event event;
+	event.data.ptr = this;
+	event.events = __SPRT_EPOLLOUT;
+
+	status = epoll->add(source->waitFd, event);
+	if (status != Status::Ok) {
+		auto err = __sprt_errno;
+		::close(source->waitFd);
+		source->waitFd = -1;
+		return postResult(epoll, source, -int64_t(err));
+	}
+	return Status::Ok;
+}
+
+Status SocketSendEPollHandle::disarm(EPollData *epoll, FileOpSource *source) {
+	auto status = prepareDisarm();
+	if (status == Status::Ok) {
+		stopWaiting(epoll, source);
+		++_timeline;
+	} else if (status == Status::ErrorAlreadyPerformed) {
+		return Status::Ok;
+	}
+	return status;
+}
+
+void SocketSendEPollHandle::notify(EPollData *epoll, FileOpSource *source,
+		const NotifyData &data) {
+	if (_status != Status::Ok) {
+		return;
+	}
+
+	if (data.queueFlags == 0) {
+		// posted result, stale one is possible after the suspension
+		if (source->waitFd == FileOpSource::WaitFdResultPending) {
+			source->waitFd = -1;
+			complete(source->result);
+		}
+		return;
+	}
+
+	auto ret = source->send();
+	if (ret == -EAGAIN) {
+		return;
+	}
+
+	stopWaiting(epoll, source);
+	complete(ret);
+}
+
+Status SocketSendEPollHandle::postResult(EPollData *epoll, FileOpSource *source,
+		int64_t result) {
+	auto handle = epoll->getFileIoHandle();
+	if (!handle) {
+		return Status::ErrorNotImplemented;
+	}
+
+	// completion can not be called from rearm directly, it's within runHandle
+	source->result = result;
+	source->waitFd = FileOpSource::WaitFdResultPending;
+	return handle->perform([this, epoll] { epoll->_data->notify(this, NotifyData{}); }, this);
+}
+
+void SocketSendEPollHandle::stopWaiting(EPollData *epoll, FileOpSource *source) {
+	if (source->waitFd >= 0) {
+		epoll->remove(source->waitFd);
+		::close(source->waitFd);
+		source->waitFd = -1;
+	}
+}
+
+} // namespace sprt::dispatch
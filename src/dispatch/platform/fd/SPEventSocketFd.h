@@ -0,0 +1,157 @@
+/**
+ Copyright (c) 2025 Stappler LLC <admin@stappler.dev>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+
+#ifndef CORE_EVENT_PLATFORM_FD_SPEVENTSOCKETFD_H_
+#define CORE_EVENT_PLATFORM_FD_SPEVENTSOCKETFD_H_
+
+#include "SPEventFd.h"
+#include "SPEventFileFd.h"
+#include "../../detail/SPRuntimeDispatchHandleClass.h"
+
+#include <sys/socket.h>
+
+namespace sprt::dispatch {
+
+struct SocketSource {
+	int fd;
+	epoll_event event;
+	bool backoff; // accepting is paused after resource exhaustion
+
+	bool init(int);
+	void cancel() { }
+};
+
+class SPRT_API SocketAcceptHandle : public AcceptHandle {
+public:
+	virtual ~SocketAcceptHandle() = default;
+
+	bool init(HandleClass *, int, CompletionHandle<AcceptHandle> &&);
+
+	virtual NativeHandle getNativeHandle() const override;
+};
+
+class SPRT_API SocketAcceptURingHandle : public SocketAcceptHandle {
+public:
+	virtual ~SocketAcceptURingHandle() = default;
+
+	Status rearm(URingData *, SocketSource *);
+	Status disarm(URingData *, SocketSource *);
+
+	void notify(URingData *, SocketSource *, const NotifyData &);
+};
+
+class SPRT_API SocketAcceptEPollHandle : public SocketAcceptHandle {
+public:
+	virtual ~SocketAcceptEPollHandle() = default;
+
+	Status rearm(EPollData *, SocketSource *);
+	Status disarm(EPollData *, SocketSource *);
+
+	void notify(EPollData *, SocketSource *, const NotifyData &);
+};
+
+class SPRT_API SocketRecvHandle : public RecvHandle {
+public:
+	virtual ~SocketRecvHandle();
+
+	bool init(HandleClass *, int, RecvInfo &&);
+
+	virtual NativeHandle getNativeHandle() const override;
+
+protected:
+	dispatch::Vector<uint8_t> _buffers;
+	uint32_t _bufferCount = 0;
+	uint32_t _bufferSize = 0;
+};
+
+/* io_uring receiver, based on provided buffers group
+ *
+ * Multishot RECV is used when available. When all buffers are consumed, kernel stops
+ * receiving with ENOBUFS, all buffers were processed by completions at this moment, so,
+ * whole group is reloaded and receiving is restarted.
+ */
+class SPRT_API SocketRecvURingHandle : public SocketRecvHandle {
+public:
+	virtual ~SocketRecvURingHandle() = default;
+
+	Status rearm(URingData *, SocketSource *, bool updateBuffers = false);
+	Status disarm(URingData *, SocketSource *);
+
+	void notify(URingData *, SocketSource *, const NotifyData &);
+
+protected:
+	uint16_t _bufferGroup = 0;
+};
+
+class SPRT_API SocketRecvEPollHandle : public SocketRecvHandle {
+public:
+	virtual ~SocketRecvEPollHandle() = default;
+
+	Status rearm(EPollData *, SocketSource *);
+	Status disarm(EPollData *, SocketSource *);
+
+	void notify(EPollData *, SocketSource *, const NotifyData &);
+};
+
+// io_uring SEND/SENDMSG, zero-copy variants are used for large buffers when supported.
+class SPRT_API SocketSendURingHandle : public FileOpHandle<WriteHandle> {
+public:
+	// zero-copy has page pinning and notification overhead, it's not profitable for small buffers
+	static constexpr size_t ZeroCopyThreshold = 16 * 1'024;
+
+	static bool isSupported(URingData *, FileOpType);
+
+	virtual ~SocketSendURingHandle() = default;
+
+	Status rearm(URingData *, FileOpSource *);
+	Status disarm(URingData *, FileOpSource *);
+
+	void notify(URingData *, FileOpSource *, const NotifyData &);
+
+protected:
+	struct msghdr _msg;
+};
+
+/* Epoll send, performed on the queue thread without the file IO pool
+ *
+ * Non-blocking attempt is made on rearm, its result is reported with the queue's file IO
+ * ThreadHandle. When socket is not writable, handle waits for EPOLLOUT on a duplicate
+ * descriptor (original one can already be registered in epoll by the receiver).
+ */
+class SPRT_API SocketSendEPollHandle : public FileOpHandle<WriteHandle> {
+public:
+	virtual ~SocketSendEPollHandle() = default;
+
+	Status rearm(EPollData *, FileOpSource *);
+	Status disarm(EPollData *, FileOpSource *);
+
+	void notify(EPollData *, FileOpSource *, const NotifyData &);
+
+protected:
+	Status postResult(EPollData *, FileOpSource *, int64_t);
+	void stopWaiting(EPollData *, FileOpSource *);
+};
+
+} // namespace sprt::dispatch
+
+#endif /* CORE_EVENT_PLATFORM_FD_SPEVENTSOCKETFD_H_ */
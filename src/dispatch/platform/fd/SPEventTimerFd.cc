@@ -102,7 +102,15 @@ bool TimerFdHandle::reset(TimerInfo &&info) {
 	}
 
 	auto source = reinterpret_cast<TimerFdSource *>(_data);
-	return source->init(info) && Handle::reset();
+	if (!source->init(info)) {
+		return false;
+	}
+
+	// timerfd_settime updates running timer in place, pending read or epoll registration stays valid
+	if (_status == Status::Ok) {
+		return true;
+	}
+	return Handle::reset();
 }
 
 Status TimerFdHandle::read(uint64_t *target) {
@@ -28,6 +28,8 @@
 #include "../fd/SPEventFd.h"
 #include "../fd/SPEventTimerFd.h"
 #include "../fd/SPEventPollFd.h"
+#include "../fd/SPEventFileFd.h"
+#include "../fd/SPEventSocketFd.h"
 #include "../epoll/SPEvent-epoll.h"
 #include "../epoll/SPEventThreadHandle-epoll.h"
 #include "../uring/SPEventThreadHandle-uring.h"
@@ -102,6 +104,16 @@ Queue::Data::Data(QueueRef *q, const QueueInfo &info) : QueueData(q, info.flags)
 		setupUringHandleClass<SignalFdURingHandle, SignalFdSource>(&_info, &_uringSignalFdClass,
 				true);
 		setupUringHandleClass<PollFdURingHandle, PollFdSource>(&_info, &_uringPollFdClass, true);
+		setupUringHandleClass<FileReadURingHandle, FileOpSource>(&_info, &_uringFileReadClass,
+				false);
+		setupUringHandleClass<FileWriteURingHandle, FileOpSource>(&_info, &_uringFileWriteClass,
+				false);
+		setupUringHandleClass<SocketAcceptURingHandle, SocketSource>(&_info,
+				&_uringSocketAcceptClass, true);
+		setupUringHandleClass<SocketRecvURingHandle, SocketSource>(&_info, &_uringSocketRecvClass,
+				true);
+		setupUringHandleClass<SocketSendURingHandle, FileOpSource>(&_info, &_uringSocketSendClass,
+				false);
 
 		auto uring = new (memory::pool::acquire())
 				URingData(_info.queue, this, info, SignalsToIntercept);
@@ -145,6 +157,60 @@ Queue::Data::Data(QueueRef *q, const QueueInfo &info) : QueueData(q, info.flags)
 						sprt::move(cb));
 			};
 
+			_read = [](QueueData *d, void *ptr, const FileOpInfo &info,
+							CompletionHandle<ReadHandle> &&cb) -> Rc<ReadHandle> {
+				auto uring = reinterpret_cast<URingData *>(ptr);
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				if (!FileReadURingHandle::isSupported(uring, info.type)) {
+					return nullptr;
+				}
+				return Rc<FileReadURingHandle>::create(&data->_uringFileReadClass, info,
+						sprt::move(cb));
+			};
+
+			_write = [](QueueData *d, void *ptr, const FileOpInfo &info,
+							 CompletionHandle<WriteHandle> &&cb) -> Rc<WriteHandle> {
+				auto uring = reinterpret_cast<URingData *>(ptr);
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				if (info.isSocket()) {
+					if (!SocketSendURingHandle::isSupported(uring, info.type)) {
+						return nullptr;
+					}
+					return Rc<SocketSendURingHandle>::create(&data->_uringSocketSendClass, info,
+							sprt::move(cb));
+				}
+				if (!FileWriteURingHandle::isSupported(uring, info.type)) {
+					return nullptr;
+				}
+				return Rc<FileWriteURingHandle>::create(&data->_uringFileWriteClass, info,
+						sprt::move(cb));
+			};
+
+			_accept = [](QueueData *d, void *ptr, NativeHandle handle,
+							  CompletionHandle<AcceptHandle> &&cb) -> Rc<AcceptHandle> {
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				return Rc<SocketAcceptURingHandle>::create(&data->_uringSocketAcceptClass,
+						handle.fd, sprt::move(cb));
+			};
+
+			_recv = [](QueueData *d, void *ptr, NativeHandle handle,
+							RecvInfo &&info) -> Rc<RecvHandle> {
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				return Rc<SocketRecvURingHandle>::create(&data->_uringSocketRecvClass, handle.fd,
+						sprt::move(info));
+			};
+
+			_registerFile = [](void *ptr, NativeHandle handle, bool unregister) -> Status {
+				auto uring = reinterpret_cast<URingData *>(ptr);
+				return unregister ? uring->unregisterFile(handle.fd)
+								  : uring->registerFile(handle.fd);
+			};
+
+			_registerBuffers = [](void *ptr, uint8_t *data, uint32_t count,
+									   uint32_t size) -> Status {
+				return reinterpret_cast<URingData *>(ptr)->registerBuffers(data, count, size);
+			};
+
 			_platformQueue = uring;
 			uring->runInternalHandles();
 			_engine = QueueEngine::URing;
@@ -162,6 +228,16 @@ Queue::Data::Data(QueueRef *q, const QueueInfo &info) : QueueData(q, info.flags)
 		setupEpollHandleClass<SignalFdEPollHandle, SignalFdSource>(&_info, &_epollSignalFdClass,
 				true);
 		setupEpollHandleClass<PollFdEPollHandle, PollFdSource>(&_info, &_epollPollFdClass, true);
+		setupEpollHandleClass<FileReadEPollHandle, FileOpSource>(&_info, &_epollFileReadClass,
+				false);
+		setupEpollHandleClass<FileWriteEPollHandle, FileOpSource>(&_info, &_epollFileWriteClass,
+				false);
+		setupEpollHandleClass<SocketAcceptEPollHandle, SocketSource>(&_info,
+				&_epollSocketAcceptClass, true);
+		setupEpollHandleClass<SocketRecvEPollHandle, SocketSource>(&_info, &_epollSocketRecvClass,
+				true);
+		setupEpollHandleClass<SocketSendEPollHandle, FileOpSource>(&_info, &_epollSocketSendClass,
+				true);
 
 		auto epoll = new (memory::pool::acquire())
 				EPollData(_info.queue, this, info, SignalsToIntercept);
@@ -196,6 +272,38 @@ Queue::Data::Data(QueueRef *q, const QueueInfo &info) : QueueData(q, info.flags)
 						sprt::move(cb));
 			};
 
+			_read = [](QueueData *d, void *ptr, const FileOpInfo &info,
+							CompletionHandle<ReadHandle> &&cb) -> Rc<ReadHandle> {
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				return Rc<FileReadEPollHandle>::create(&data->_epollFileReadClass, info,
+						sprt::move(cb));
+			};
+
+			_write = [](QueueData *d, void *ptr, const FileOpInfo &info,
+							 CompletionHandle<WriteHandle> &&cb) -> Rc<WriteHandle> {
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				if (info.isSocket()) {
+					return Rc<SocketSendEPollHandle>::create(&data->_epollSocketSendClass, info,
+							sprt::move(cb));
+				}
+				return Rc<FileWriteEPollHandle>::create(&data->_epollFileWriteClass, info,
+						sprt::move(cb));
+			};
+
+			_accept = [](QueueData *d, void *ptr, NativeHandle handle,
+							  CompletionHandle<AcceptHandle> &&cb) -> Rc<AcceptHandle> {
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				return Rc<SocketAcceptEPollHandle>::create(&data->_epollSocketAcceptClass,
+						handle.fd, sprt::move(cb));
+			};
+
+			_recv = [](QueueData *d, void *ptr, NativeHandle handle,
+							RecvInfo &&info) -> Rc<RecvHandle> {
+				auto data = reinterpret_cast<Queue::Data *>(d);
+				return Rc<SocketRecvEPollHandle>::create(&data->_epollSocketRecvClass, handle.fd,
+						sprt::move(info));
+			};
+
 			_platformQueue = epoll;
 			epoll->runInternalHandles();
 			_engine = QueueEngine::EPoll;
@@ -40,12 +40,22 @@ struct SPRT_API Queue::Data : public QueueData {
 	HandleClass _uringSignalFdClass;
 	HandleClass _uringEventFdClass;
 	HandleClass _uringPollFdClass;
+	HandleClass _uringFileReadClass;
+	HandleClass _uringFileWriteClass;
+	HandleClass _uringSocketAcceptClass;
+	HandleClass _uringSocketRecvClass;
+	HandleClass _uringSocketSendClass;
 
 	HandleClass _epollThreadClass;
 	HandleClass _epollTimerFdClass;
 	HandleClass _epollSignalFdClass;
 	HandleClass _epollEventFdClass;
 	HandleClass _epollPollFdClass;
+	HandleClass _epollFileReadClass;
+	HandleClass _epollFileWriteClass;
+	HandleClass _epollSocketAcceptClass;
+	HandleClass _epollSocketRecvClass;
+	HandleClass _epollSocketSendClass;
 
 	HandleClass _alooperThreadClass;
 	HandleClass _alooperTimerFdClass;
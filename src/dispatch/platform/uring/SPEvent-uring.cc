@@ -122,7 +122,7 @@ uint16_t URingData::reloadBufferGroup(uint16_t id, uint32_t count, uint32_t size
 	pushSqe({IORING_OP_REMOVE_BUFFERS, IORING_OP_PROVIDE_BUFFERS},
 			[&](io_uring_sqe *sqe, uint32_t idx) {
 		switch (idx) {
-		case 0: unregisterBufferGroup(count, id, sqe); break;
+		case 0: unregisterBufferGroup(id, count, sqe); break;
 		case 1: id = registerBufferGroup(count, size, data, sqe); break;
 		}
 	}, URingPushFlags::Submit);
@@ -146,6 +146,107 @@ void URingData::unregisterBufferGroup(uint16_t id, uint32_t count, io_uring_sqe
 	_unregistredBuffers.emplace_back(id);
 }
 
+Status URingData::registerFile(int fd) {
+	if (fd < 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	if (_fds.empty()) {
+		return Status::ErrorNotSupported;
+	}
+
+	if (size_t(fd) < _fixedFiles.size() && _fixedFiles[fd] != 0) {
+		return Status::ErrorAlreadyPerformed;
+	}
+
+	uint32_t slot = 0;
+	if (!_fileSlotsFree.empty()) {
+		slot = _fileSlotsFree.back();
+		_fileSlotsFree.pop_back();
+	} else if (_fileSlotsNext < _fds.size()) {
+		slot = _fileSlotsNext++;
+	} else {
+		return Status::ErrorOutOfDeviceMemory;
+	}
+
+	io_uring_rsrc_update2 update;
+	update.offset = slot;
+	update.resv = 0;
+	update.data = reinterpret_cast<uintptr_t>(&fd);
+	update.tags = 0;
+	update.nr = 1;
+	update.resv2 = 0;
+
+	auto err = __sprt_io_uring_register(_ringFd, IORING_REGISTER_FILES_UPDATE2, &update,
+			sizeof(io_uring_rsrc_update2));
+	if (err < 0) {
+		_fileSlotsFree.emplace_back(slot);
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	if (size_t(fd) >= _fixedFiles.size()) {
+		_fixedFiles.resize(fd + 1, 0);
+	}
+
+	_fds[slot] = fd;
+	_fixedFiles[fd] = slot + 1;
+	return Status::Ok;
+}
+
+Status URingData::unregisterFile(int fd) {
+	if (fd < 0 || size_t(fd) >= _fixedFiles.size() || _fixedFiles[fd] == 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto slot = _fixedFiles[fd] - 1;
+	int32_t emptyFd = -1;
+
+	io_uring_rsrc_update2 update;
+	update.offset = slot;
+	update.resv = 0;
+	update.data = reinterpret_cast<uintptr_t>(&emptyFd);
+	update.tags = 0;
+	update.nr = 1;
+	update.resv2 = 0;
+
+	auto err = __sprt_io_uring_register(_ringFd, IORING_REGISTER_FILES_UPDATE2, &update,
+			sizeof(io_uring_rsrc_update2));
+	if (err < 0) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	_fds[slot] = -1;
+	_fixedFiles[fd] = 0;
+	_fileSlotsFree.emplace_back(slot);
+	return Status::Ok;
+}
+
+Status URingData::registerBuffers(uint8_t *data, uint32_t count, uint32_t size) {
+	dispatch::Vector<IoVec> iov;
+	iov.reserve(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		iov.emplace_back(IoVec{data + size_t(i) * size, size});
+	}
+
+	auto err = __sprt_io_uring_register(_ringFd, IORING_REGISTER_BUFFERS, iov.data(), count);
+	if (err < 0) {
+		auto status = sprt::status::errnoToStatus(__sprt_errno);
+		oslog::vperror(__SPRT_LOCATION, "dispatch::URingData", "Fail to register buffers: ",
+				status);
+		return status;
+	}
+	return Status::Ok;
+}
+
+void URingData::setSqeFile(io_uring_sqe *sqe, int fd) const {
+	if (fd >= 0 && size_t(fd) < _fixedFiles.size() && _fixedFiles[fd] != 0) {
+		sqe->fd = int32_t(_fixedFiles[fd] - 1);
+		sqe->flags |= IOSQE_FIXED_FILE;
+	} else {
+		sqe->fd = fd;
+	}
+}
+
 unsigned URingData::getUnprocessedSqeCount() {
 	unsigned head;
 
@@ -248,8 +349,10 @@ Status URingData::pushSqe(sprt::initializer_list<uint8_t> ops,
 
 			sq.array[index] = index;
 
+			// slots are reused, every rearm should start from a clean SQE (stale ioprio or
+			// op-specific flags from the previous operation make the next one fail with EINVAL)
+			sprt::memset(ptr, 0, sizeof(io_uring_sqe));
 			ptr->opcode = *(ops.begin() + n);
-			ptr->flags = 0;
 			cb(ptr, n);
 
 			if (linked && n < sqe.count) {
@@ -829,6 +932,14 @@ URingData::URingData(QueueRef *q, Queue::Data *data, const QueueInfo &info, Span
 	}
 #endif
 
+	if (strverscmp(buffer.release, "5.19.0") >= 0) {
+		_uflags |= URingFlags::AcceptMultishotSupported;
+	}
+
+	if (strverscmp(buffer.release, "6.0.0") >= 0) {
+		_uflags |= URingFlags::RecvMultishotSupported;
+	}
+
 	if (strverscmp(buffer.release, "6.4.0") >= 0) {
 		_uflags |= URingFlags::TimerMultishotSupported;
 	}
@@ -957,6 +1068,11 @@ URingData::URingData(QueueRef *q, Queue::Data *data, const QueueInfo &info, Span
 		return;
 	}
 
+	if (_probe.isOpcodeSupported(IORING_OP_SEND_ZC)
+			&& _probe.isOpcodeSupported(IORING_OP_SENDMSG_ZC)) {
+		_uflags |= URingFlags::SendZeroCopySupported;
+	}
+
 	sq.head = reinterpret_cast<unsigned *>(sq.ring + _params.sq_off.head);
 	sq.tail = reinterpret_cast<unsigned *>(sq.ring + _params.sq_off.tail);
 	sq.mask = reinterpret_cast<unsigned *>(sq.ring + _params.sq_off.ring_mask);
@@ -983,7 +1099,8 @@ URingData::URingData(QueueRef *q, Queue::Data *data, const QueueInfo &info, Span
 	auto totalHandles = info.externalHandles + info.internalHandles;
 
 	if (totalHandles > 0) {
-		_fds.resize(totalHandles);
+		// sparse table: -1 marks unused slot
+		_fds.resize(totalHandles, -1);
 		_tags.resize(totalHandles);
 
 		io_uring_rsrc_register fdTableReg;
@@ -1020,7 +1137,9 @@ URingData::URingData(QueueRef *q, Queue::Data *data, const QueueInfo &info, Span
 				cleanup();
 				return;
 			}
+			_fileSlotsOffset = info.internalHandles;
 		}
+		_fileSlotsNext = _fileSlotsOffset;
 	}
 
 	_ringFd = ringFd;
@@ -57,6 +57,9 @@ enum class URingFlags : uint32_t {
 	TimerMultishotSupported = 1 << 8,
 	FutexSupported = 1 << 9,
 	ReadMultishotSupported = 1 << 10,
+	AcceptMultishotSupported = 1 << 11,
+	RecvMultishotSupported = 1 << 12,
+	SendZeroCopySupported = 1 << 13,
 };
 
 SPRT_DEFINE_ENUM_AS_MASK(URingFlags)
@@ -142,6 +145,13 @@ struct SPRT_API alignas(32) URingData : public PlatformQueueData {
 	Queue::Vector<int32_t> _fds;
 	Queue::Vector<uint64_t> _tags;
 
+	// registered files: slots [_fileSlotsOffset, _fds.size()) of the fd table,
+	// range below offset is reserved for kernel-allocated (internal) descriptors
+	uint32_t _fileSlotsOffset = 0;
+	uint32_t _fileSlotsNext = 0;
+	Queue::Vector<uint32_t> _fileSlotsFree;
+	Queue::Vector<uint32_t> _fixedFiles; // fd -> slot + 1, 0 if not registered
+
 	Rc<SignalFdHandle> _signalFd;
 	Rc<EventFdHandle> _eventFd;
 
@@ -167,6 +177,15 @@ struct SPRT_API alignas(32) URingData : public PlatformQueueData {
 
 	void unregisterBufferGroup(uint16_t id, uint32_t count, io_uring_sqe *sqe = nullptr);
 
+	Status registerFile(int fd);
+	Status unregisterFile(int fd);
+
+	// Register `count` buffers of `size` bytes, starting from `data`, as fixed buffers
+	Status registerBuffers(uint8_t *data, uint32_t count, uint32_t size);
+
+	// Use registered file slot for SQE, if fd was registered with registerFile
+	void setSqeFile(io_uring_sqe *, int fd) const;
+
 	unsigned getUnprocessedSqeCount();
 
 	unsigned flushSqe();
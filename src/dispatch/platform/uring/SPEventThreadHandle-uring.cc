@@ -108,7 +108,7 @@ void ThreadEventFdHandle::notify(URingData *uring, EventFdSource *source, const
 		_status = Status::Suspended;
 	}
 
-	auto performUnlock = [&] {
+	if (data.result == sizeof(uint64_t)) {
 		performAll([&](uint32_t count) {
 			if constexpr (URING_THREAD_DEBUG_SWITCH_TIMER) {
 				if (count == 1) {
@@ -116,7 +116,6 @@ void ThreadEventFdHandle::notify(URingData *uring, EventFdSource *source, const
 							__sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC) - _switchTimer);
 				}
 			}
-			_mutex.unlock();
 			if (!more) {
 				rearm(uring, source);
 			}
@@ -126,23 +125,6 @@ void ThreadEventFdHandle::notify(URingData *uring, EventFdSource *source, const
 			// no need to rearm, handle is still armed
 			_status = Status::Ok;
 		}
-	};
-
-	if (data.result == sizeof(uint64_t)) {
-		if constexpr (URING_THREAD_NONBLOCK) {
-			if (_mutex.try_lock()) {
-				performUnlock();
-			} else {
-				if (!more) {
-					rearm(uring, source);
-				}
-				uint64_t value = 1;
-				::__sprt_eventfd_write(source->fd, value);
-			}
-		} else {
-			_mutex.lock();
-			performUnlock();
-		}
 	} else if (data.result == -ENOBUFS) {
 		// Rearm buffers only when multishot is failed
 		rearm(uring, source, true);
@@ -152,29 +134,27 @@ void ThreadEventFdHandle::notify(URingData *uring, EventFdSource *source, const
 }
 
 Status ThreadEventFdHandle::perform(Rc<Task> &&task) {
-	sprt::unique_lock lock(_mutex);
-	_outputQueue.emplace_back(move(task));
+	if (enqueue(move(task))) {
+		if constexpr (URING_THREAD_DEBUG_SWITCH_TIMER) {
+			_switchTimer = __sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC);
+		}
 
-	if constexpr (URING_THREAD_DEBUG_SWITCH_TIMER) {
-		_switchTimer = __sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC);
+		uint64_t value = 1;
+		::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
 	}
-
-	uint64_t value = 1;
-	::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
 	return Status::Ok;
 }
 
 Status ThreadEventFdHandle::perform(dispatch::Function<void()> &&func, Ref *target,
 		StringView tag) {
-	sprt::unique_lock lock(_mutex);
-	_outputCallbacks.emplace_back(CallbackInfo{sprt::move(func), target, tag});
+	if (enqueue(sprt::move(func), target, tag)) {
+		if constexpr (URING_THREAD_DEBUG_SWITCH_TIMER) {
+			_switchTimer = __sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC);
+		}
 
-	if constexpr (URING_THREAD_DEBUG_SWITCH_TIMER) {
-		_switchTimer = __sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC);
+		uint64_t value = 1;
+		::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
 	}
-
-	uint64_t value = 1;
-	::__sprt_eventfd_write(reinterpret_cast<EventFdSource *>(_data)->fd, value);
 	return Status::Ok;
 }
 
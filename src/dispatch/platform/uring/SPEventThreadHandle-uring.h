@@ -33,14 +33,11 @@ namespace sprt::dispatch {
 
 /* Thread handle implementations for io_uring.
  *
- * Classic implementation uses eventfd + mutex with write + potential futex syscalls per task
+ * Classic implementation uses eventfd with lock-free incoming queue, eventfd is written
+ * only once per drain, when a burst of tasks is posted
  * Modern implementation uses IORING_OP_FUTEX_WAIT with only futex syscall per task
  */
 
-// For eventfd-based haandle - do not block on mutex, wait until nonblocking capture
-// Can increase overall performance, with the cost of stable context switch time
-static constexpr bool URING_THREAD_NONBLOCK = false;
-
 // Try to observe context switch timer (in nanoseconds) to determine Handle performance
 static constexpr bool URING_THREAD_DEBUG_SWITCH_TIMER = false;
 
@@ -63,7 +60,6 @@ public:
 
 protected:
 	uint16_t _bufferGroup = 0;
-	sprt::mutex _mutex;
 };
 
 } // namespace sprt::dispatch
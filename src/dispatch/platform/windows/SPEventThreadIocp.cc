@@ -55,6 +55,9 @@ Status ThreadIocpHandle::rearm(IocpData *iocp, ThreadIocpSource *source) {
 	if (status == Status::Ok) {
 		source->currentThread = __sprt_gettid();
 		source->port = iocp->_port;
+
+		// completion, posted without the port, is lost, so allow next perform to signal again
+		_signaled.store(false, sprt::memory_order::release);
 	}
 	return status;
 }
@@ -70,17 +73,8 @@ void ThreadIocpHandle::notify(IocpData *iocp, ThreadIocpSource *source, const No
 		return; // just exit
 	}
 
-	auto performUnlock = [&] { performAll([&](uint32_t count) { _mutex.unlock(); }); };
-
 	if (data.result > 0) {
-		if constexpr (IOCP_THREAD_NONBLOCK) {
-			if (_mutex.try_lock()) {
-				performUnlock();
-			}
-		} else {
-			_mutex.lock();
-			performUnlock();
-		}
+		performAll();
 	} else {
 		cancel(Status(data.result));
 	}
@@ -89,10 +83,9 @@ void ThreadIocpHandle::notify(IocpData *iocp, ThreadIocpSource *source, const No
 Status ThreadIocpHandle::perform(Rc<Task> &&task) {
 	auto source = reinterpret_cast<ThreadIocpSource *>(_data);
 
-	sprt::unique_lock lock(_mutex);
-	_outputQueue.emplace_back(move(task));
-
-	PostQueuedCompletionStatus(source->port, 1, reinterpret_cast<uintptr_t>(this), nullptr);
+	if (enqueue(move(task))) {
+		PostQueuedCompletionStatus(source->port, 1, reinterpret_cast<uintptr_t>(this), nullptr);
+	}
 
 	return Status::Ok;
 }
@@ -100,10 +93,9 @@ Status ThreadIocpHandle::perform(Rc<Task> &&task) {
 Status ThreadIocpHandle::perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) {
 	auto source = reinterpret_cast<ThreadIocpSource *>(_data);
 
-	sprt::unique_lock lock(_mutex);
-	_outputCallbacks.emplace_back(CallbackInfo{sprt::move(func), target, tag});
-
-	PostQueuedCompletionStatus(source->port, 1, reinterpret_cast<uintptr_t>(this), nullptr);
+	if (enqueue(sprt::move(func), target, tag)) {
+		PostQueuedCompletionStatus(source->port, 1, reinterpret_cast<uintptr_t>(this), nullptr);
+	}
 
 	return Status::Ok;
 }
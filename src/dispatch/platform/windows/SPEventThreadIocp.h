@@ -28,8 +28,6 @@
 
 namespace sprt::dispatch {
 
-static constexpr bool IOCP_THREAD_NONBLOCK = false;
-
 struct SPRT_API ThreadIocpSource {
 	__sprt_pid_t currentThread = 0;
 	void *port = nullptr;
@@ -51,9 +49,6 @@ public:
 
 	virtual Status perform(Rc<Task> &&task) override;
 	virtual Status perform(dispatch::Function<void()> &&func, Ref *target, StringView tag) override;
-
-protected:
-	sprt::mutex _mutex;
 };
 
 } // namespace sprt::dispatch
@@ -25,6 +25,7 @@
 #include <sprt/runtime/log.h>
 #include <sprt/runtime/enum.h>
 #include <sprt/runtime/stringview.h>
+#include <sprt/runtime/dispatch/thread_pool.h>
 #include "private/SPRTFilesystem.h"
 #include "private/SPRTPrivate.h"
 
@@ -279,6 +280,7 @@ void terminate() {
 	}
 
 	detail::_termSystemPaths(*s_resourceData);
+	detail::_termAssetPacks(*s_resourceData);
 }
 
 LocationCategory getResourceCategoryByPrefix(StringView prefix) {
@@ -463,6 +465,212 @@ void enumeratePaths(LocationCategory t, LookupFlags flags,
 	}
 }
 
+Status performFtw(dispatch::ThreadPool &pool, const LocationInfo &loc, StringView path,
+		dispatch::Function<bool(StringView, FileType)> &&cb,
+		dispatch::Function<void(Status)> &&complete, int depth, size_t batchSize, Ref *ref) {
+	using dispatch::String;
+	using dispatch::Vector;
+	using dispatch::Task;
+
+	if (!cb || !complete || !loc.interface || batchSize == 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	if (!loc.interface->_readdir && !loc.interface->_ftw) {
+		return Status::ErrorNotImplemented;
+	}
+
+	struct FtwEntry {
+		size_t offset;
+		size_t size;
+		FileType type;
+	};
+
+	// Entries from a single directory, paths are stored in one buffer
+	struct FtwBatch {
+		String paths;
+		Vector<FtwEntry> entries;
+
+		StringView getPath(const FtwEntry &entry) const {
+			return StringView(paths.data() + entry.offset, entry.size);
+		}
+
+		void push(StringView dir, StringView name, FileType type) {
+			auto offset = paths.size();
+			if (!dir.empty() && !name.empty()) {
+				paths.append(dir.data(), dir.size());
+				paths.push_back('/');
+			}
+			paths.append(name.data(), name.size());
+			entries.emplace_back(FtwEntry{offset, paths.size() - offset, type});
+		}
+	};
+
+	// Listing of a single directory; batches, that are filled while listing, are delivered
+	// with performCompleted, the last one - with the task's complete function, so it's always
+	// delivered after the others
+	struct FtwTask : Ref {
+		String dir;
+		int depth = 0;
+		FtwBatch batch;
+		Status status = Status::Ok;
+	};
+
+	struct FtwState : Ref {
+		Rc<dispatch::ThreadPool> pool;
+		Rc<Ref> ref;
+		String root;
+		String locationPath;
+		LocationInfo location;
+		int depth = -1;
+		size_t batchSize = 0;
+		bool parallel = true;
+
+		dispatch::Function<bool(StringView, FileType)> callback;
+		dispatch::Function<void(Status)> complete;
+
+		// modified only with the complete interface
+		size_t pending = 0;
+		bool stopped = false;
+		Status status = Status::Ok;
+
+		sprt::atomic<bool> cancelled = false; // checked by workers to stop listing
+
+		// Called on worker
+		bool read(FtwTask *task) {
+			String path(root);
+			if (!task->dir.empty()) {
+				if (!path.empty()) {
+					path.push_back('/');
+				}
+				path.append(task->dir.data(), task->dir.size());
+			}
+
+			auto onEntry = [&](StringView name, FileType type) {
+				if (cancelled.load()) {
+					return false;
+				}
+				task->batch.push(task->dir, name, type);
+				if (task->batch.entries.size() >= batchSize) {
+					flush(task->depth, sprt::move(task->batch));
+					task->batch = FtwBatch();
+				}
+				return true;
+			};
+
+			if (parallel) {
+				task->status = location.interface->_readdir(location, path, onEntry);
+			} else {
+				// entries from _ftw are already relative to the root
+				task->status = location.interface->_ftw(location, path,
+						[&](StringView name, FileType type) {
+					return name.empty() || onEntry(name, type);
+				}, depth, true);
+			}
+			return true;
+		}
+
+		void flush(int depth, FtwBatch &&batch) {
+			Rc<FtwState> self(this);
+			pool->performCompleted([self, depth, batch = sprt::move(batch)] {
+				self->deliver(depth, batch);
+			}, ref);
+		}
+
+		// Called with the complete interface
+		void deliver(int depth, const FtwBatch &batch) {
+			for (auto &it : batch.entries) {
+				if (stopped) {
+					return;
+				}
+				if (!callback(batch.getPath(it), it.type)) {
+					stopped = true;
+					cancelled = true;
+					return;
+				}
+			}
+
+			// subdirectories are listed after they were reported
+			if (!parallel || depth == 1) {
+				return;
+			}
+
+			for (auto &it : batch.entries) {
+				if (it.type == FileType::Dir && it.size > 0) {
+					spawn(batch.getPath(it), depth - 1);
+				}
+			}
+		}
+
+		void spawn(StringView dir, int depth) {
+			auto task = Rc<FtwTask>::alloc();
+			task->dir = String(dir.data(), dir.size());
+			task->depth = depth;
+
+			Rc<FtwState> self(this);
+			auto st = pool->perform(Rc<Task>::create(
+					[self, task](const Task &) { return self->read(task); },
+					[self, task](const Task &, bool success) { self->finalize(task, success); },
+					ref, nullptr, "filesystem::performFtw"));
+			if (st == Status::Ok) {
+				++pending;
+			} else if (status == Status::Ok) {
+				status = Status::ErrorCancelled;
+			}
+		}
+
+		void finalize(FtwTask *task, bool success) {
+			if (!success) {
+				if (status == Status::Ok) {
+					status = Status::ErrorCancelled;
+				}
+			} else {
+				if (task->dir.empty() && task->status != Status::Ok
+						&& task->status != Status::Suspended && status == Status::Ok) {
+					// only the root listing error is fatal
+					status = task->status;
+				} else {
+					deliver(task->depth, task->batch);
+				}
+			}
+
+			if (--pending == 0) {
+				complete(stopped ? Status::Suspended : status);
+			}
+		}
+	};
+
+	auto state = Rc<FtwState>::alloc();
+	state->pool = &pool;
+	state->ref = ref;
+	state->root = String(path.data(), path.size());
+	state->locationPath = String(loc.path.data(), loc.path.size());
+	state->location = loc;
+	state->location.path = state->locationPath;
+	state->depth = depth;
+	state->batchSize = batchSize;
+	state->parallel = loc.interface->_readdir != nullptr;
+	state->callback = sprt::move(cb);
+	state->complete = sprt::move(complete);
+
+	auto task = Rc<FtwTask>::alloc();
+	task->depth = depth;
+	task->batch.push(StringView(), StringView(), FileType::Dir);
+
+	if (depth == 0) {
+		// only the root itself is reported
+		return pool.performCompleted([state, task] {
+			state->pending = 1;
+			state->finalize(task, true);
+		}, ref);
+	}
+
+	state->pending = 1;
+	return pool.perform(Rc<Task>::create([state, task](const Task &) { return state->read(task); },
+			[state, task](const Task &, bool success) { state->finalize(task, success); }, ref,
+			nullptr, "filesystem::performFtw"));
+}
+
 } // namespace sprt::filesystem
 
 namespace sprt::filesystem::detail {
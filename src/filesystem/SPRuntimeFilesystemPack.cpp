@@ -0,0 +1,920 @@
+/**
+ Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#include <sprt/runtime/filesystem/pack.h>
+#include <sprt/runtime/filesystem/filepath.h>
+#include <sprt/runtime/utils/compress.h>
+#include <sprt/runtime/mem/pool.h>
+#include <sprt/runtime/hash.h>
+#include <sprt/cxx/algorithm>
+#include <sprt/cxx/vector>
+#include <sprt/cxx/new>
+#include <sprt/cxx/__mutex/unique_lock.h>
+
+#include <sprt/c/__sprt_stdlib.h>
+#include <sprt/c/__sprt_string.h>
+#include <sprt/c/sys/__sprt_mman.h>
+#include <sprt/c/bits/seek.h>
+
+#include "private/SPRTFilesystem.h"
+
+namespace sprt::filesystem {
+
+// LZ4 block should save at least 1/8 of the entry, or it's stored raw
+static constexpr size_t PackCompressionGain = 8;
+
+static constexpr size_t PackAlign(size_t value, size_t align) {
+	return (value + align - 1) & ~(align - 1);
+}
+
+// Compares `str` with `prefix` followed by '/'; returns 0 when `str` is within the directory
+static int comparePackDir(StringView str, StringView prefix) {
+	auto n = sprt::min(str.size(), prefix.size());
+	if (n > 0) {
+		auto ret = __sprt_memcmp(str.data(), prefix.data(), n);
+		if (ret != 0) {
+			return ret;
+		}
+	}
+	if (str.size() <= prefix.size()) {
+		return -1;
+	}
+	auto c = uint8_t(str[prefix.size()]);
+	return (c < '/') ? -1 : ((c > '/') ? 1 : 0);
+}
+
+static bool isPackPathLess(StringView l, StringView r) {
+	auto n = sprt::min(l.size(), r.size());
+	auto ret = (n > 0) ? __sprt_memcmp(l.data(), r.data(), n) : 0;
+	return ret < 0 || (ret == 0 && l.size() < r.size());
+}
+
+// Checks that [offset, offset + length) is within `size` without overflow
+static bool isPackRegionValid(uint64_t offset, uint64_t length, uint64_t size) {
+	return offset <= size && length <= size - offset;
+}
+
+// Path within the pack: location path prefix and separators on the edges are removed
+static StringView getPackPath(const LocationInfo &loc, StringView path) {
+	if (path.starts_with(loc.path)
+			&& (path.size() == loc.path.size() || path[loc.path.size()] == '/')) {
+		path += loc.path.size();
+	}
+	path.skipChars<StringView::Chars<'/'>>();
+	path.backwardSkipChars<StringView::Chars<'/'>>();
+	return path;
+}
+
+Status AssetPack::write(const SourceFile *files, size_t count,
+		const callback<void(const uint8_t *, size_t)> &cb) {
+	if (count >= (size_t(1) << 30)) {
+		return Status::ErrorTooManyObjects;
+	}
+
+	__malloc_vector<uint32_t> order;
+	order.resize(count);
+	for (uint32_t i = 0; i < count; ++i) {
+		if (files[i].path.empty() || files[i].path.size() > Max<uint16_t>
+				|| files[i].path.starts_with('/') || files[i].path.ends_with('/')) {
+			return Status::ErrorInvalidArguemnt;
+		}
+		order[i] = i;
+	}
+
+	sprt::sort(order.begin(), order.end(), [&](uint32_t l, uint32_t r) {
+		return isPackPathLess(files[l].path, files[r].path);
+	});
+
+	for (size_t i = 1; i < count; ++i) {
+		if (files[order[i - 1]].path == files[order[i]].path) {
+			return Status::ErrorInvalidArguemnt;
+		}
+	}
+
+	// file can not be a directory for other files (`a/b` with `a/b/c`); entries within
+	// a directory are contiguous, but not always next to the file (`a/b.txt` is between)
+	for (size_t i = 0; i < count; ++i) {
+		auto &path = files[order[i]].path;
+		auto first = i + 1;
+		auto n = count - first;
+		while (n > 0) {
+			auto step = n / 2;
+			auto it = first + step;
+			if (comparePackDir(files[order[it]].path, path) < 0) {
+				first = it + 1;
+				n -= step + 1;
+			} else {
+				n = step;
+			}
+		}
+		if (first < count && comparePackDir(files[order[first]].path, path) == 0) {
+			return Status::ErrorInvalidArguemnt;
+		}
+	}
+
+	uint32_t tableSize = 1;
+	while (tableSize < count * 2) { tableSize <<= 1; }
+
+	Header header;
+	header.magic = Magic;
+	header.version = Version;
+	header.count = uint32_t(count);
+	header.tableSize = tableSize;
+	header.pageSize = PageSize;
+	header.entriesOffset = sizeof(Header);
+	header.tableOffset = header.entriesOffset + count * sizeof(Entry);
+	header.stringsOffset = header.tableOffset + tableSize * sizeof(Slot);
+	header.stringsSize = 0;
+	for (size_t i = 0; i < count; ++i) { header.stringsSize += files[i].path.size(); }
+	header.dataOffset = PackAlign(header.stringsOffset + header.stringsSize, DataAlignment);
+
+	__malloc_vector<Entry> entries;
+	__malloc_vector<Slot> table;
+	entries.resize(count);
+	table.resize(tableSize, Slot{0, 0});
+
+	// compressed blocks are kept until the data section is written
+	__malloc_vector<uint8_t> compressed;
+	__malloc_vector<uint64_t> compressedOffsets;
+	compressedOffsets.resize(count);
+
+	uint64_t pathOffset = 0;
+	uint64_t dataOffset = header.dataOffset;
+
+	for (size_t i = 0; i < count; ++i) {
+		auto &file = files[order[i]];
+		auto &entry = entries[i];
+
+		entry.size = file.data.size();
+		entry.storedSize = file.data.size();
+		entry.path = uint32_t(pathOffset);
+		entry.pathSize = uint16_t(file.path.size());
+		entry.flags = AssetPackEntryFlags::None;
+
+		pathOffset += file.path.size();
+
+		auto bounds = file.compress ? lz4_getCompressBounds(file.data.size()) : 0;
+		if (bounds > 0 && file.data.size() >= PackCompressionGain) {
+			auto offset = compressed.size();
+			compressed.resize(offset + bounds);
+
+			auto size = lz4hc_compressData(file.data.data(), file.data.size(),
+					compressed.data() + offset, bounds);
+			if (size > 0 && size <= file.data.size() - file.data.size() / PackCompressionGain) {
+				entry.storedSize = size;
+				entry.flags |= AssetPackEntryFlags::Compressed;
+				compressedOffsets[i] = offset;
+				compressed.resize(offset + size);
+			} else {
+				compressed.resize(offset);
+			}
+		}
+
+		// raw entries can be mapped separately, so large ones are page-aligned
+		auto align = (entry.storedSize >= PageSize
+							 && !hasFlag(entry.flags, AssetPackEntryFlags::Compressed))
+				? PageSize
+				: DataAlignment;
+
+		entry.offset = PackAlign(dataOffset, align);
+		dataOffset = entry.offset + entry.storedSize;
+
+		auto hash = hash64(file.path.data(), file.path.size());
+		auto slot = size_t(hash) & (tableSize - 1);
+		while (table[slot].index != 0) { slot = (slot + 1) & (tableSize - 1); }
+		table[slot].hash = uint32_t(hash >> 32);
+		table[slot].index = uint32_t(i + 1);
+	}
+
+	static constexpr uint8_t Padding[PageSize] = {0};
+
+	uint64_t offset = 0;
+	auto pad = [&](uint64_t target) {
+		while (offset < target) {
+			auto n = size_t(sprt::min(target - offset, uint64_t(PageSize)));
+			cb(Padding, n);
+			offset += n;
+		}
+	};
+
+	cb(reinterpret_cast<const uint8_t *>(&header), sizeof(Header));
+	cb(reinterpret_cast<const uint8_t *>(entries.data()), entries.size() * sizeof(Entry));
+	cb(reinterpret_cast<const uint8_t *>(table.data()), table.size() * sizeof(Slot));
+	offset = header.stringsOffset;
+
+	for (size_t i = 0; i < count; ++i) {
+		auto &path = files[order[i]].path;
+		cb(reinterpret_cast<const uint8_t *>(path.data()), path.size());
+	}
+	offset += header.stringsSize;
+
+	for (size_t i = 0; i < count; ++i) {
+		auto &entry = entries[i];
+		pad(entry.offset);
+		if (hasFlag(entry.flags, AssetPackEntryFlags::Compressed)) {
+			cb(compressed.data() + compressedOffsets[i], entry.storedSize);
+		} else if (entry.storedSize > 0) {
+			cb(files[order[i]].data.data(), entry.storedSize);
+		}
+		offset += entry.storedSize;
+	}
+
+	return Status::Ok;
+}
+
+AssetPack::~AssetPack() {
+	if (_mapping && _interface) {
+		_interface->_munmap(_mapping, _storage);
+	}
+}
+
+Status AssetPack::init(const LocationInfo &loc, StringView path) {
+	if (_header) {
+		return Status::ErrorAlreadyPerformed;
+	}
+
+	if (!loc.interface || !loc.interface->_stat || !loc.interface->_mmap
+			|| !loc.interface->_munmap) {
+		return Status::ErrorNotSupported;
+	}
+
+	auto status = loc.interface->_stat(loc, path, &_stat);
+	if (status != Status::Ok) {
+		return status;
+	}
+
+	if (size_t(_stat.st_size) < sizeof(Header)) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto ptr = loc.interface->_mmap(_storage, loc, path, MappingType::Private, __SPRT_S_IROTH, 0,
+			size_t(_stat.st_size), &status);
+	if (!ptr || ptr == (uint8_t *)__SPRT_MAP_FAILED || status != Status::Ok) {
+		return status != Status::Ok ? status : Status::ErrorMemoryMapFailed;
+	}
+
+	_interface = loc.interface;
+	_mapping = ptr;
+	_size = size_t(_stat.st_size);
+
+	status = initData(_mapping, _size);
+	if (status != Status::Ok) {
+		_interface->_munmap(_mapping, _storage);
+		_interface = nullptr;
+		_mapping = nullptr;
+		_size = 0;
+	}
+	return status;
+}
+
+Status AssetPack::init(BytesView data) {
+	if (_header) {
+		return Status::ErrorAlreadyPerformed;
+	}
+
+	__sprt_memset(&_stat, 0, sizeof(_stat));
+	_stat.st_size = data.size();
+	_stat.st_mode = __SPRT_S_IRUSR | __SPRT_S_IFREG;
+	_stat.st_nlink = 1;
+
+	return initData(data.data(), data.size());
+}
+
+Status AssetPack::initData(const uint8_t *data, size_t size) {
+	if (size < sizeof(Header) || (uintptr_t(data) & (alignof(Header) - 1)) != 0) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto header = reinterpret_cast<const Header *>(data);
+	if (header->magic != Magic) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	if (header->version != Version) {
+		return Status::ErrorNotSupported;
+	}
+
+	// count and tableSize are 32-bit, so region sizes can not overflow uint64
+	if (header->tableSize <= header->count || (header->tableSize & (header->tableSize - 1)) != 0
+			|| header->entriesOffset % alignof(Entry) != 0
+			|| header->tableOffset % alignof(Slot) != 0
+			|| !isPackRegionValid(header->entriesOffset,
+					uint64_t(header->count) * sizeof(Entry), size)
+			|| !isPackRegionValid(header->tableOffset,
+					uint64_t(header->tableSize) * sizeof(Slot), size)
+			|| !isPackRegionValid(header->stringsOffset, header->stringsSize, size)) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto entries = reinterpret_cast<const Entry *>(data + header->entriesOffset);
+	auto table = reinterpret_cast<const Slot *>(data + header->tableOffset);
+	auto strings = reinterpret_cast<const char *>(data + header->stringsOffset);
+
+	// entries and index are validated once, so lookups can trust them
+	StringView prevPath;
+	for (uint32_t i = 0; i < header->count; ++i) {
+		auto &entry = entries[i];
+		if (entry.pathSize == 0
+				|| !isPackRegionValid(entry.path, entry.pathSize, header->stringsSize)
+				|| !isPackRegionValid(entry.offset, entry.storedSize, size)
+				|| (!hasFlag(entry.flags, AssetPackEntryFlags::Compressed)
+						&& entry.size != entry.storedSize)) {
+			return Status::ErrorInvalidArguemnt;
+		}
+
+		// lowerBound and walk rely on the strict order, it also rejects duplicates
+		StringView path(strings + entry.path, entry.pathSize);
+		if (i > 0 && !isPackPathLess(prevPath, path)) {
+			return Status::ErrorInvalidArguemnt;
+		}
+		prevPath = path;
+	}
+
+	// table should have empty slots, or lookup for missing path will not stop
+	bool hasEmptySlot = false;
+	for (uint32_t i = 0; i < header->tableSize; ++i) {
+		if (table[i].index > header->count) {
+			return Status::ErrorInvalidArguemnt;
+		} else if (table[i].index == 0) {
+			hasEmptySlot = true;
+		}
+	}
+
+	if (!hasEmptySlot) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	_header = header;
+	_entries = entries;
+	_table = table;
+	_strings = strings;
+	return Status::Ok;
+}
+
+const AssetPack::Entry *AssetPack::find(StringView path) const {
+	if (!_header || path.empty()) {
+		return nullptr;
+	}
+
+	const auto mask = _header->tableSize - 1;
+	const auto hash = hash64(path.data(), path.size());
+	const auto tag = uint32_t(hash >> 32);
+
+	auto slot = size_t(hash) & mask;
+	while (_table[slot].index != 0) {
+		if (_table[slot].hash == tag) {
+			auto entry = &_entries[_table[slot].index - 1];
+			if (getPath(entry) == path) {
+				return entry;
+			}
+		}
+		slot = (slot + 1) & mask;
+	}
+	return nullptr;
+}
+
+bool AssetPack::isDirectory(StringView path) const {
+	if (!_header) {
+		return false;
+	}
+
+	if (path.empty()) {
+		return true;
+	}
+
+	auto it = lowerBound(path);
+	return it != end() && comparePackDir(getPath(it), path) == 0;
+}
+
+StringView AssetPack::getPath(const Entry *entry) const {
+	return StringView(_strings + entry->path, entry->pathSize);
+}
+
+BytesView AssetPack::getData(const Entry *entry) const {
+	if (hasFlag(entry->flags, AssetPackEntryFlags::Compressed)) {
+		return BytesView();
+	}
+	return BytesView(reinterpret_cast<const uint8_t *>(_header) + entry->offset, entry->size);
+}
+
+Status AssetPack::read(const Entry *entry, uint8_t *buf, size_t size) const {
+	if (size < entry->size) {
+		return Status::ErrorBufferOverflow;
+	}
+
+	auto data = reinterpret_cast<const uint8_t *>(_header) + entry->offset;
+	if (hasFlag(entry->flags, AssetPackEntryFlags::Compressed)) {
+		if (entry->size > 0
+				&& lz4_decompressData(data, entry->storedSize, buf, entry->size) != entry->size) {
+			return Status::ErrorInvalidArguemnt;
+		}
+	} else if (entry->size > 0) {
+		__sprt_memcpy(buf, data, entry->size);
+	}
+	return Status::Ok;
+}
+
+Status AssetPack::ftw(StringView path, const callback<bool(StringView, FileType)> &cb, int depth,
+		bool dirFirst) const {
+	if (!_header) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	if (!path.empty() && !isDirectory(path)) {
+		if (!find(path)) {
+			return Status::ErrorNotFound;
+		}
+		// same as POSIX walker: file is reported as a root
+		return cb(StringView(), FileType::File) ? Status::Ok : Status::Suspended;
+	}
+
+	auto it = lowerBound(path);
+	return walk(path.empty() ? 0 : path.size() + 1, path, cb, depth, dirFirst, it);
+}
+
+const AssetPack::Entry *AssetPack::lowerBound(StringView dir) const {
+	if (dir.empty()) {
+		return begin();
+	}
+
+	auto first = begin();
+	size_t count = size();
+	while (count > 0) {
+		auto step = count / 2;
+		auto it = first + step;
+		if (comparePackDir(getPath(it), dir) < 0) {
+			first = it + 1;
+			count -= step + 1;
+		} else {
+			count = step;
+		}
+	}
+	return first;
+}
+
+Status AssetPack::walk(size_t rootLen, StringView dir,
+		const callback<bool(StringView, FileType)> &cb, int depth, bool dirFirst,
+		const Entry *&it) const {
+	auto rel = dir.size() > rootLen ? dir.sub(rootLen) : StringView();
+	if (dirFirst && !cb(rel, FileType::Dir)) {
+		return Status::Suspended;
+	}
+
+	if (depth != 0) {
+		const size_t dirLen = dir.empty() ? 0 : dir.size() + 1;
+		while (it != end()) {
+			auto path = getPath(it);
+			if (!dir.empty() && comparePackDir(path, dir) != 0) {
+				break;
+			}
+
+			auto name = path.sub(dirLen);
+			auto sep = static_cast<const char *>(__sprt_memchr(name.data(), '/', name.size()));
+			if (!sep) {
+				if (!cb(path.sub(rootLen), FileType::File)) {
+					return Status::Suspended;
+				}
+				++it;
+				continue;
+			}
+
+			auto child = path.sub(0, dirLen + (sep - name.data()));
+			if (depth == 1) {
+				if (!cb(child.sub(rootLen), FileType::Dir)) {
+					return Status::Suspended;
+				}
+				while (it != end() && comparePackDir(getPath(it), child) == 0) { ++it; }
+			} else {
+				auto status = walk(rootLen, child, cb, depth - 1, dirFirst, it);
+				if (status != Status::Ok) {
+					return status;
+				}
+			}
+		}
+	}
+
+	if (!dirFirst && !cb(rel, FileType::Dir)) {
+		return Status::Suspended;
+	}
+	return Status::Ok;
+}
+
+
+struct AssetPackFile {
+	const uint8_t *data = nullptr;
+	size_t size = 0;
+	size_t offset = 0;
+	uint8_t *buffer = nullptr; // decompressed entry
+};
+
+struct AssetPackMmapStorage {
+	uint8_t *buffer; // allocated region for compressed or writable mappings
+	uint64_t length;
+};
+
+namespace detail {
+
+// Interface is copied for every mounted pack, so the pack is found from LocationInfo::interface
+struct AssetPackMount {
+	LocationInterface interface;
+	AssetPack pack;
+	AssetPackMount *next = nullptr;
+};
+
+} // namespace detail
+
+static const AssetPack *getPack(const LocationInfo &loc) {
+	return &reinterpret_cast<const detail::AssetPackMount *>(loc.interface)->pack;
+}
+
+static void fillPackStat(const AssetPack *pack, StringView path, const AssetPack::Entry *entry,
+		struct __SPRT_STAT_NAME *_stat) {
+	*_stat = pack->getStat();
+
+	_stat->st_ino ^= hash64(path.data(), path.size());
+	_stat->st_nlink = 1;
+	if (entry) {
+		_stat->st_mode = __SPRT_S_IRUSR | __SPRT_S_IFREG;
+		_stat->st_size = entry->size;
+		_stat->st_blksize = AssetPack::PageSize;
+		_stat->st_blocks = (entry->storedSize + 511) / 512;
+	} else {
+		_stat->st_mode = __SPRT_S_IRUSR | __SPRT_S_IXUSR | __SPRT_S_IFDIR;
+		_stat->st_size = 0;
+		_stat->st_blksize = AssetPack::PageSize;
+		_stat->st_blocks = 0;
+	}
+}
+
+static LocationInterface s_packInterface = {
+	._access = [](const LocationInfo &loc, StringView path, Access mode) -> Status {
+	if (hasFlag(mode, Access::Write) || hasFlag(mode, Access::Execute)) {
+		return Status::ErrorNotPermitted;
+	}
+
+	auto pack = getPack(loc);
+	path = getPackPath(loc, path);
+
+	bool exists = pack->find(path) || pack->isDirectory(path);
+	if (hasFlag(mode, Access::Empty)) {
+		return exists ? Status::ErrorFileExists : Status::Ok;
+	}
+	return exists ? Status::Ok : Status::ErrorNotFound;
+},
+
+	._stat = [](const LocationInfo &loc, StringView path,
+					 struct __SPRT_STAT_NAME *_stat) -> Status {
+	auto pack = getPack(loc);
+	path = getPackPath(loc, path);
+
+	if (auto entry = pack->find(path)) {
+		fillPackStat(pack, path, entry, _stat);
+		return Status::Ok;
+	}
+	if (pack->isDirectory(path)) {
+		fillPackStat(pack, path, nullptr, _stat);
+		return Status::Ok;
+	}
+	return Status::ErrorNotFound;
+},
+
+	._open = [](const LocationInfo &loc, StringView path, OpenFlags flags, Status *st) -> void * {
+	if (hasFlag(flags,
+				OpenFlags::Write | OpenFlags::Append | OpenFlags::Create | OpenFlags::Truncate
+						| OpenFlags::CreateExclusive | OpenFlags::DelOnClose)) {
+		if (st) {
+			*st = Status::ErrorNotPermitted;
+		}
+		return nullptr;
+	}
+
+	auto pack = getPack(loc);
+	auto entry = pack->find(getPackPath(loc, path));
+	if (!entry) {
+		if (st) {
+			*st = Status::ErrorNotFound;
+		}
+		return nullptr;
+	}
+
+	auto file = new (__sprt_malloc(sizeof(AssetPackFile))) AssetPackFile;
+	file->size = entry->size;
+	if (hasFlag(entry->flags, AssetPackEntryFlags::Compressed)) {
+		file->buffer = static_cast<uint8_t *>(__sprt_malloc(sprt::max(size_t(entry->size), size_t(1))));
+		auto status = pack->read(entry, file->buffer, entry->size);
+		if (status != Status::Ok) {
+			__sprt_free(file->buffer);
+			__sprt_free(file);
+			if (st) {
+				*st = status;
+			}
+			return nullptr;
+		}
+		file->data = file->buffer;
+	} else {
+		file->data = pack->getData(entry).data();
+	}
+
+	if (st) {
+		*st = Status::Ok;
+	}
+	return file;
+},
+	._read = [](void *ptr, uint8_t *buf, size_t nbytes, Status *st) -> size_t {
+	auto file = static_cast<AssetPackFile *>(ptr);
+	if (!file) {
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return 0;
+	}
+
+	auto n = (file->offset < file->size) ? sprt::min(nbytes, file->size - file->offset) : 0;
+	if (n > 0) {
+		__sprt_memcpy(buf, file->data + file->offset, n);
+		file->offset += n;
+	}
+	if (st) {
+		*st = Status::Ok;
+	}
+	return n;
+},
+	._write = [](void *ptr, const uint8_t *buf, size_t nbytes, Status *st) -> size_t {
+	if (st) {
+		*st = Status::ErrorNotPermitted;
+	}
+	return 0;
+},
+	._seek = [](void *ptr, int64_t offset, int w, Status *st) -> size_t {
+	auto file = static_cast<AssetPackFile *>(ptr);
+	if (!file) {
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return 0;
+	}
+
+	int64_t base = 0;
+	switch (w) {
+	case __SPRT_SEEK_SET: base = 0; break;
+	case __SPRT_SEEK_CUR: base = int64_t(file->offset); break;
+	case __SPRT_SEEK_END: base = int64_t(file->size); break;
+	default:
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return 0;
+	}
+
+	if (base + offset < 0) {
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return 0;
+	}
+
+	file->offset = size_t(base + offset);
+	if (st) {
+		*st = Status::Ok;
+	}
+	return file->offset;
+},
+	._tell = [](void *ptr, Status *st) -> size_t {
+	auto file = static_cast<AssetPackFile *>(ptr);
+	if (!file) {
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return 0;
+	}
+	if (st) {
+		*st = Status::Ok;
+	}
+	return file->offset;
+},
+	._flush =
+			[](void *ptr, Status *st) {
+	if (st) {
+		*st = ptr ? Status::Ok : Status::ErrorInvalidArguemnt;
+	}
+},
+	._close =
+			[](void *ptr, Status *st) {
+	auto file = static_cast<AssetPackFile *>(ptr);
+	if (!file) {
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return;
+	}
+	if (file->buffer) {
+		__sprt_free(file->buffer);
+	}
+	__sprt_free(file);
+	if (st) {
+		*st = Status::Ok;
+	}
+},
+
+	._unlink = [](const LocationInfo &loc, StringView path) -> Status {
+	return Status::ErrorNotPermitted; //
+},
+
+	._remove = [](const LocationInfo &loc, StringView path) -> Status {
+	return Status::ErrorNotPermitted; //
+},
+
+	._touch = [](const LocationInfo &loc, StringView path) -> Status {
+	return Status::ErrorNotPermitted; //
+},
+
+	._mkdir = [](const LocationInfo &loc, StringView path, __sprt_mode_t mode) -> Status {
+	return Status::ErrorNotPermitted; //
+},
+
+	._rename = [](const LocationInfo &loc1, StringView from, const LocationInfo &loc2,
+					   StringView to) -> Status {
+	return Status::ErrorNotPermitted; //
+},
+	._copy = nullptr,
+
+	._ftw = [](const LocationInfo &loc, StringView path,
+					const callback<bool(StringView, FileType)> &cb, int depth,
+					bool dirFirst) -> Status {
+	return getPack(loc)->ftw(getPackPath(loc, path), cb, depth, dirFirst);
+},
+
+	._readdir = [](const LocationInfo &loc, StringView path,
+						const callback<bool(StringView, FileType)> &cb) -> Status {
+	return getPack(loc)->ftw(getPackPath(loc, path), [&](StringView name, FileType type) {
+		return name.empty() || cb(name, type); // skip the directory itself
+	}, 1, true);
+},
+
+	._write_oneshot = [](const LocationInfo &loc, StringView path, const uint8_t *buf,
+							  size_t nbytes, __sprt_mode_t mode, bool override) -> Status {
+	return Status::ErrorNotPermitted; //
+},
+
+	._mmap = [](uint8_t storage[16], const LocationInfo &loc, StringView path, MappingType type,
+					 __sprt_mode_t prot, size_t offset, size_t len, Status *st) -> uint8_t * {
+	auto pack = getPack(loc);
+	auto entry = pack->find(getPackPath(loc, path));
+	if (!entry) {
+		if (st) {
+			*st = Status::ErrorNotFound;
+		}
+		return nullptr;
+	}
+
+	if (len == 0 && offset <= entry->size) {
+		len = entry->size - offset;
+	}
+
+	const bool writable = (prot & __SPRT_S_IWOTH) != 0;
+	if ((prot & __SPRT_S_IXOTH) != 0 || (writable && type == MappingType::Shared)
+			|| offset > entry->size || len > entry->size - offset) {
+		if (st) {
+			*st = Status::ErrorInvalidArguemnt;
+		}
+		return nullptr;
+	}
+
+	auto s = (AssetPackMmapStorage *)&storage[0];
+	s->buffer = nullptr;
+	s->length = len;
+
+	auto data = pack->getData(entry);
+	if (!writable && !data.empty()) {
+		// zero-copy: region within the pack mapping
+		if (st) {
+			*st = Status::Ok;
+		}
+		return const_cast<uint8_t *>(data.data()) + offset;
+	}
+
+	// private copy for compressed entries and private writable mappings
+	s->buffer = static_cast<uint8_t *>(__sprt_malloc(sprt::max(size_t(entry->size), size_t(1))));
+	auto status = pack->read(entry, s->buffer, entry->size);
+	if (status != Status::Ok) {
+		__sprt_free(s->buffer);
+		s->buffer = nullptr;
+		if (st) {
+			*st = status;
+		}
+		return nullptr;
+	}
+
+	if (st) {
+		*st = Status::Ok;
+	}
+	return s->buffer + offset;
+},
+	._munmap = [](uint8_t *region, uint8_t storage[16]) -> Status {
+	if (!region) {
+		return Status::ErrorInvalidArguemnt;
+	}
+	auto s = (AssetPackMmapStorage *)&storage[0];
+	if (s->buffer) {
+		__sprt_free(s->buffer);
+		s->buffer = nullptr;
+	}
+	return Status::Ok;
+},
+	._msync = [](uint8_t *region, uint8_t storage[16]) -> Status {
+	return region ? Status::Ok : Status::ErrorInvalidArguemnt;
+},
+
+	._fdopen = [](void *ptr, const char *mode, Status *st) -> __sprt_FILE * {
+	if (st) {
+		*st = Status::ErrorNotSupported;
+	}
+	return nullptr;
+}};
+
+const AssetPack *getAssetPack(const LocationInfo &loc) {
+	if (loc.interface && loc.interface->_access == s_packInterface._access) {
+		return getPack(loc);
+	}
+	return nullptr;
+}
+
+Status mountAssetPack(LocationCategory cat, const LocationInfo &loc, StringView path,
+		LookupFlags flags) {
+	auto data = detail::LookupData::get();
+	if (!data || toInt(cat) >= toInt(LocationCategory::Custom)) {
+		return Status::ErrorInvalidArguemnt;
+	}
+
+	auto mount = new (__sprt_malloc(sizeof(detail::AssetPackMount)))
+			detail::AssetPackMount{s_packInterface};
+
+	auto status = mount->pack.init(loc, path);
+	if (status != Status::Ok) {
+		mount->~AssetPackMount();
+		__sprt_free(mount);
+		return status;
+	}
+
+	auto &res = data->_resourceLocations[toInt(cat)];
+
+	sprt::unique_lock lock(res.mutex);
+
+	memory::perform([&] {
+		auto emplace = [&](StringView fullPath) {
+			res.paths.emplace_front(LocationInfo{
+				fullPath.pdup(data->_pool),
+				flags & LookupFlags::PathMask,
+				LocationFlags::Specific,
+				&mount->interface,
+			});
+		};
+
+		if (filepath::isAbsolute(path)) {
+			emplace(path);
+		} else {
+			filepath::merge(emplace, loc.path, path);
+		}
+
+		mount->next = data->_packs;
+		data->_packs = mount;
+	}, data->_pool);
+
+	return Status::Ok;
+}
+
+} // namespace sprt::filesystem
+
+namespace sprt::filesystem::detail {
+
+void _termAssetPacks(LookupData &data) {
+	auto mount = data._packs;
+	while (mount) {
+		auto next = mount->next;
+		mount->~AssetPackMount();
+		__sprt_free(mount);
+		mount = next;
+	}
+	data._packs = nullptr;
+}
+
+} // namespace sprt::filesystem::detail
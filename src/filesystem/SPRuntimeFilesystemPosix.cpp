@@ -30,8 +30,11 @@
 #include <sprt/c/__sprt_utime.h>
 #include <sprt/c/__sprt_fcntl.h>
 #include <sprt/c/__sprt_dirent.h>
+#include <sprt/c/__sprt_stdlib.h>
 #include <sprt/c/__sprt_limits.h>
 #include <sprt/c/sys/__sprt_mman.h>
+#include <sprt/c/sys/__sprt_stat.h>
+#include <sprt/c/sys/__sprt_ioctl.h>
 #include <string.h>
 
 namespace sprt::filesystem {
@@ -53,30 +56,117 @@ static void performWithPath(const LocationInfo &loc, StringView path, const Call
 static constexpr int OpenDirFlags =
 		__SPRT_O_DIRECTORY | __SPRT_O_RDONLY | __SPRT_O_NDELAY | __SPRT_O_CLOEXEC;
 
-static Status _ftw_fn(int dirfd, const callback<bool(StringView, FileType)> &callback, int depth,
-		bool dirFirst, const char *origBuf, char *buf, size_t bufMax) {
+static constexpr size_t DirBufferSize = 64 * 1'024;
 
-	struct Dir {
-		Dir(int dirfd) : dp(::__sprt_fdopendir(dirfd)) { }
-		~Dir() {
-			if (dp) {
-				::__sprt_closedir(dp);
+// Reads entries of the directory, takes ownership of the descriptor
+// With getdents64 entries are read with a large buffer directly into user space, so
+// one syscall returns hundreds of entries, and no DIR stream is allocated
+struct DirReader {
+#if __SPRT_CONFIG_HAVE_DIRENT_GETDENTS64
+	DirReader(int dirfd) : fd(dirfd), buffer((uint8_t *)::__sprt_malloc(DirBufferSize)) { }
+	~DirReader() {
+		if (buffer) {
+			::__sprt_free(buffer);
+		}
+		if (fd >= 0) {
+			::__sprt_close(fd);
+		}
+	}
+
+	struct __SPRT_DIRENT_NAME *read() {
+		if (offset >= filled) {
+			auto ret = ::__sprt_getdents64(fd, buffer, DirBufferSize);
+			if (ret <= 0) {
+				if (ret < 0) {
+					status = sprt::status::errnoToStatus(__sprt_errno);
+				}
+				return nullptr;
 			}
+			filled = size_t(ret);
+			offset = 0;
+		}
+
+		auto entry = reinterpret_cast<struct __SPRT_DIRENT_NAME *>(buffer + offset);
+		offset += entry->d_reclen;
+		return entry;
+	}
+
+	int getFd() const { return fd; }
+
+	explicit operator bool() const { return buffer != nullptr; }
+
+	int fd = -1;
+	uint8_t *buffer = nullptr;
+	size_t filled = 0;
+	size_t offset = 0;
+	Status status = Status::Ok;
+#else
+	DirReader(int dirfd) : dp(::__sprt_fdopendir(dirfd)) {
+		if (!dp) {
+			::__sprt_close(dirfd);
+		}
+	}
+	~DirReader() {
+		if (dp) {
+			::__sprt_closedir(dp);
+		}
+	}
+
+	struct __SPRT_DIRENT_NAME *read() {
+		__sprt_errno = 0;
+		auto entry = ::__sprt_readdir(dp);
+		if (!entry && __sprt_errno != 0) {
+			status = sprt::status::errnoToStatus(__sprt_errno);
 		}
+		return entry;
+	}
 
-		struct dirent *read() { return ::__sprt_readdir(dp); }
+	int getFd() const { return ::__sprt_dirfd(dp); }
 
-		int getFd() { return ::__sprt_dirfd(dp); }
+	explicit operator bool() const { return dp != nullptr; }
 
-		explicit operator bool() const { return dp != nullptr; }
+	__sprt_DIR *dp = nullptr;
+	Status status = Status::Ok;
+#endif
+};
+
+static FileType _ftw_type(const struct __SPRT_DIRENT_NAME *entry) {
+	switch (entry->d_type) {
+	case __SPRT_DT_BLK: return FileType::BlockDevice; break;
+	case __SPRT_DT_CHR: return FileType::CharDevice; break;
+	case __SPRT_DT_FIFO: return FileType::Pipe; break;
+	case __SPRT_DT_LNK: return FileType::Link; break;
+	case __SPRT_DT_REG: return FileType::File; break;
+	case __SPRT_DT_DIR: return FileType::Dir; break;
+	case __SPRT_DT_SOCK: return FileType::Socket; break;
+	default: break;
+	}
+	return FileType::Unknown;
+}
+
+static FileType _stat_type(__sprt_mode_t mode) {
+	switch (mode & __SPRT_S_IFMT) {
+	case __SPRT_S_IFBLK: return FileType::BlockDevice; break;
+	case __SPRT_S_IFCHR: return FileType::CharDevice; break;
+	case __SPRT_S_IFIFO: return FileType::Pipe; break;
+	case __SPRT_S_IFLNK: return FileType::Link; break;
+	case __SPRT_S_IFREG: return FileType::File; break;
+	case __SPRT_S_IFDIR: return FileType::Dir; break;
+	case __SPRT_S_IFSOCK: return FileType::Socket; break;
+	default: break;
+	}
+	return FileType::Unknown;
+}
 
-		__sprt_DIR *dp = nullptr;
-	};
+static bool _ftw_skip(const char *name) {
+	return name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0));
+}
 
-	Dir dp(dirfd);
+static Status _ftw_fn(int dirfd, const callback<bool(StringView, FileType)> &callback, int depth,
+		bool dirFirst, const char *origBuf, char *buf, size_t bufMax) {
+	DirReader dp(dirfd);
 
 	if (!dp) {
-		::__sprt_close(dirfd);
 		auto result = sprt::status::errnoToStatus(__sprt_errno);
 		buf[0] = 0;
 		if (callback(StringView(origBuf, buf - origBuf), FileType::File)) {
@@ -93,21 +183,10 @@ static Status _ftw_fn(int dirfd, const callback<bool(StringView, FileType)> &cal
 			}
 		}
 		if (depth < 0 || depth > 0) {
-			struct dirent *entry;
+			struct __SPRT_DIRENT_NAME *entry;
 			while ((entry = dp.read())) {
-				FileType type = FileType::Unknown;
-				switch (entry->d_type) {
-				case __SPRT_DT_BLK: type = FileType::BlockDevice; break;
-				case __SPRT_DT_CHR: type = FileType::CharDevice; break;
-				case __SPRT_DT_FIFO: type = FileType::Pipe; break;
-				case __SPRT_DT_LNK: type = FileType::Link; break;
-				case __SPRT_DT_REG: type = FileType::File; break;
-				case __SPRT_DT_DIR: type = FileType::Dir; break;
-				case __SPRT_DT_SOCK: type = FileType::Socket; break;
-				default: break;
-				}
-
-				if (strcmp(entry->d_name, "..") != 0 && strcmp(entry->d_name, ".") != 0) {
+				auto type = _ftw_type(entry);
+				if (!_ftw_skip(entry->d_name)) {
 					size_t bufSize = bufMax;
 					auto newBufEnd = buf;
 					if (buf != origBuf) {
@@ -160,6 +239,257 @@ static Status _ftw_fn(int dirfd, const callback<bool(StringView, FileType)> &cal
 	return Status::Ok;
 }
 
+static Status _ftw_path(const char *tpath, const callback<bool(StringView, FileType)> &cb,
+		int depth, bool dirFirst) {
+	auto dirfd = ::__sprt_openat(-1, tpath, OpenDirFlags);
+	if (dirfd < 0) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	auto pathConfMax = ::__sprt_fpathconf(dirfd, __SPRT_PC_PATH_MAX);
+	auto pathMax = sprt::max(size_t(pathConfMax > 0 ? pathConfMax : 0), size_t(__SPRT_PATH_MAX));
+
+	auto bufSize = __SPRT_PATH_MAX + pathMax;
+
+	auto workBuf = __sprt_typed_malloca(char, bufSize);
+
+	auto st = _ftw_fn(dirfd, cb, depth, dirFirst, workBuf, workBuf, bufSize);
+
+	__sprt_freea(workBuf);
+	return st;
+}
+
+// Reads a single directory level; d_type is used when provided, fstatat is called only
+// for the filesystems, that report DT_UNKNOWN
+static Status _readdir_path(const char *tpath, const callback<bool(StringView, FileType)> &cb) {
+	auto dirfd = ::__sprt_openat(-1, tpath, OpenDirFlags);
+	if (dirfd < 0) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	DirReader dp(dirfd);
+	if (!dp) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	struct __SPRT_DIRENT_NAME *entry;
+	while ((entry = dp.read())) {
+		if (_ftw_skip(entry->d_name)) {
+			continue;
+		}
+
+		auto type = _ftw_type(entry);
+		if (type == FileType::Unknown) {
+			struct __SPRT_STAT_NAME s;
+			if (::__sprt_fstatat(dp.getFd(), entry->d_name, &s, __SPRT_AT_SYMLINK_NOFOLLOW) == 0) {
+				type = _stat_type(s.st_mode);
+			}
+		}
+
+		if (!cb(StringView(entry->d_name, strlen(entry->d_name)), type)) {
+			return Status::Suspended;
+		}
+	}
+	return dp.status;
+}
+
+static constexpr size_t CopyBufferSize = 128 * 1'024;
+
+// Copies the rest of the file content from the current offsets
+// In-kernel methods are tried first, read/write loop is used when they are not supported
+static Status _copy_fd(int in, int out) {
+#if SPRT_LINUX
+	// reflink: no data is copied on CoW filesystems (btrfs, xfs, bcachefs)
+	if (::__sprt_ioctl(out, __SPRT_FICLONE, in) == 0) {
+		return Status::Ok;
+	}
+
+#if __SPRT_CONFIG_HAVE_UNISTD_COPY_FILE_RANGE
+	// in-kernel copy (or server-side copy on NFS/SMB), returns 0 on EOF
+	size_t copied = 0;
+	while (true) {
+		auto ret = ::__sprt_copy_file_range(in, nullptr, out, nullptr, Max<int32_t>, 0);
+		if (ret > 0) {
+			copied += size_t(ret);
+		} else if (ret == 0) {
+			// also returned for some special files with zero st_size (procfs), so, fallback
+			// to the read loop, it returns 0 for a real EOF immediately
+			break;
+		} else if (__sprt_errno != EINTR) {
+			auto err = __sprt_errno;
+			if (copied == 0
+					&& (err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP
+							|| err == EPERM)) {
+				break;
+			}
+			return sprt::status::errnoToStatus(err);
+		}
+	}
+#endif
+#endif
+
+	Status st = Status::Ok;
+	auto buf = __sprt_typed_malloca(uint8_t, CopyBufferSize);
+	while (true) {
+		auto nread = ::__sprt_read(in, buf, CopyBufferSize);
+		if (nread < 0) {
+			if (__sprt_errno == EINTR) {
+				continue;
+			}
+			st = sprt::status::errnoToStatus(__sprt_errno);
+			break;
+		} else if (nread == 0) {
+			break;
+		}
+
+		auto data = buf;
+		while (nread > 0) {
+			auto nwrite = ::__sprt_write(out, data, size_t(nread));
+			if (nwrite < 0) {
+				if (__sprt_errno == EINTR) {
+					continue;
+				}
+				st = sprt::status::errnoToStatus(__sprt_errno);
+				break;
+			}
+			data += nwrite;
+			nread -= nwrite;
+		}
+
+		if (st != Status::Ok) {
+			break;
+		}
+	}
+	__sprt_freea(buf);
+	return st;
+}
+
+static Status _copy_file(const char *from, const char *to) {
+	auto in = ::__sprt_open(from, __SPRT_O_RDONLY | __SPRT_O_CLOEXEC);
+	if (in < 0) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	struct __SPRT_STAT_NAME s;
+	if (::__sprt_fstat(in, &s) != 0) {
+		auto st = sprt::status::errnoToStatus(__sprt_errno);
+		::__sprt_close(in);
+		return st;
+	}
+
+	auto mode = __sprt_mode_t(s.st_mode & ~__SPRT_S_IFMT);
+
+	// truncated only after the check, copy onto itself (or onto a hard link) would erase it
+	auto out = ::__sprt_open(to, __SPRT_O_WRONLY | __SPRT_O_CREAT | __SPRT_O_CLOEXEC, mode);
+	if (out < 0) {
+		auto st = sprt::status::errnoToStatus(__sprt_errno);
+		::__sprt_close(in);
+		return st;
+	}
+
+	struct __SPRT_STAT_NAME t;
+	auto st = Status::Ok;
+	if (::__sprt_fstat(out, &t) != 0) {
+		st = sprt::status::errnoToStatus(__sprt_errno);
+	} else if (t.st_dev == s.st_dev && t.st_ino == s.st_ino) {
+		st = Status::ErrorInvalidArguemnt;
+	} else if ((t.st_mode & __SPRT_S_IFMT) == __SPRT_S_IFREG && ::__sprt_ftruncate(out, 0) != 0) {
+		st = sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	if (st == Status::Ok) {
+		st = _copy_fd(in, out);
+	}
+
+	// open mode is affected by umask and ignored for existing files
+	if (st == Status::Ok && ::__sprt_fchmod(out, mode) != 0) {
+		st = sprt::status::errnoToStatus(__sprt_errno);
+	}
+
+	::__sprt_close(out);
+	::__sprt_close(in);
+	return st;
+}
+
+static Status _copy_link(const char *from, const char *to) {
+	char buf[__SPRT_PATH_MAX + 1];
+	auto len = ::__sprt_readlink(from, buf, __SPRT_PATH_MAX);
+	if (len < 0) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+	buf[len] = 0;
+
+	if (::__sprt_symlink(buf, to) != 0) {
+		return sprt::status::errnoToStatus(__sprt_errno);
+	}
+	return Status::Ok;
+}
+
+// Calls `cb` with null-terminated source and target paths for the entry within the tree
+static void _copy_dir_paths(const char *from, const char *to, StringView path,
+		const callback<void(const char *, const char *)> &cb) {
+	filepath::merge([&](StringView source) {
+		filepath::merge([&](StringView target) {
+			source.performWithTerminated([&](const char *tsource, size_t) {
+				target.performWithTerminated(
+						[&](const char *ttarget, size_t) { cb(tsource, ttarget); });
+			});
+		}, StringView(to), path);
+	}, StringView(from), path);
+}
+
+/*
+	Directories are created owner-writable before their content is copied (so read-only
+	sources like 0555 can be copied), then the second, post-order, pass sets the source
+	mode exactly, without umask, for both new and existing directories.
+*/
+static Status _copy_dir(const char *from, const char *to) {
+	Status st = Status::Ok;
+
+	auto ftwSt = _ftw_path(from, [&](StringView path, FileType type) -> bool {
+		_copy_dir_paths(from, to, path, [&](const char *tsource, const char *ttarget) {
+			switch (type) {
+			case FileType::Dir:
+				if (::__sprt_mkdir(ttarget, __SPRT_S_IRWXU) != 0) {
+					if (__sprt_errno != EEXIST) {
+						st = sprt::status::errnoToStatus(__sprt_errno);
+					} else {
+						// failure is reported by the final chmod
+						::__sprt_chmod(ttarget, __SPRT_S_IRWXU);
+					}
+				}
+				break;
+			case FileType::File: st = _copy_file(tsource, ttarget); break;
+			case FileType::Link: st = _copy_link(tsource, ttarget); break;
+			default:
+				// devices, pipes and sockets are not copied
+				break;
+			}
+		});
+		return st == Status::Ok;
+	}, -1, true);
+
+	if (st != Status::Ok || ftwSt != Status::Ok) {
+		return st != Status::Ok ? st : ftwSt;
+	}
+
+	ftwSt = _ftw_path(from, [&](StringView path, FileType type) -> bool {
+		if (type != FileType::Dir) {
+			return true;
+		}
+		_copy_dir_paths(from, to, path, [&](const char *tsource, const char *ttarget) {
+			struct __SPRT_STAT_NAME s;
+			if (::__sprt_stat(tsource, &s) != 0
+					|| ::__sprt_chmod(ttarget, __sprt_mode_t(s.st_mode & ~__SPRT_S_IFMT)) != 0) {
+				st = sprt::status::errnoToStatus(__sprt_errno);
+			}
+		});
+		return st == Status::Ok;
+	}, -1, false);
+
+	return st != Status::Ok ? st : ftwSt;
+}
+
 static LocationInterface s_defaultInterface = {
 	._access = [](const LocationInfo &loc, StringView path, Access mode) -> Status {
 	Status st = Status::Ok;
@@ -395,38 +725,41 @@ static LocationInterface s_defaultInterface = {
 	});
 	return st;
 },
-	/*
-	._copy = [](const LocationInfo &, StringView from, const LocationInfo &,
-					 StringView to) -> Status {},
-					 */
-	._copy = nullptr,
+	._copy = [](const LocationInfo &loc1, StringView from, const LocationInfo &loc2,
+					 StringView to) -> Status {
+	Status st = Status::Ok;
+	performWithPath(loc1, from, [&](const char *tfrom, size_t) {
+		performWithPath(loc2, to, [&](const char *tto, size_t) {
+			struct __SPRT_STAT_NAME s;
+			if (::__sprt_stat(tfrom, &s) != 0) {
+				st = sprt::status::errnoToStatus(__sprt_errno);
+			} else if (__SPRT_S_ISDIR(s.st_mode)) {
+				st = _copy_dir(tfrom, tto);
+			} else {
+				st = _copy_file(tfrom, tto);
+			}
+		});
+	});
+	return st;
+},
 
 	._ftw = [](const LocationInfo &loc, StringView path,
 					const callback<bool(StringView, FileType)> &cb, int depth,
 					bool dirFirst) -> Status {
 	Status st = Status::Ok;
 	performWithPath(loc, path, [&](const char *tpath, size_t) {
-		auto dirfd = ::__sprt_openat(-1, tpath, OpenDirFlags);
-		if (dirfd < 0) {
-			st = sprt::status::errnoToStatus(__sprt_errno);
-			return;
-		}
-
-		auto pathConfMax = ::__sprt_fpathconf(dirfd, __SPRT_PC_PATH_MAX);
-		auto pathMax =
-				sprt::max(size_t(pathConfMax > 0 ? pathConfMax : 0), size_t(__SPRT_PATH_MAX));
-
-		auto bufSize = __SPRT_PATH_MAX + pathMax;
-
-		auto workBuf = __sprt_typed_malloca(char, bufSize);
-
-		st = _ftw_fn(dirfd, cb, depth, dirFirst, workBuf, workBuf, bufSize);
-
-		__sprt_freea(workBuf);
+		st = _ftw_path(tpath, cb, depth, dirFirst);
 	});
 	return st;
 },
 
+	._readdir = [](const LocationInfo &loc, StringView path,
+						const callback<bool(StringView, FileType)> &cb) -> Status {
+	Status st = Status::Ok;
+	performWithPath(loc, path, [&](const char *tpath, size_t) { st = _readdir_path(tpath, cb); });
+	return st;
+},
+
 	._write_oneshot = [](const LocationInfo &loc, StringView path, const uint8_t *buf,
 							  size_t nbytes, __sprt_mode_t mode, bool override) -> Status {
 	Status result = Status::Ok;
@@ -21,11 +21,14 @@
  **/
 
 #include <sprt/runtime/platform.h>
+#include <sprt/cxx/atomic>
 #include <sprt/c/__sprt_unistd.h>
+#include <sprt/c/__sprt_fcntl.h>
 #include <sprt/c/__sprt_time.h>
 
 #if __SSE__
 //#include <x86intrin.h>
+#include <cpuid.h>
 #define SP_HAS_RDTSC 1
 static inline sprt::uint64_t rdtsc() { return __rdtsc(); }
 #elif __aarch64__
@@ -71,6 +74,240 @@ static __sprt_clockid_t getClockSource() {
 	return __SPRT_CLOCK_MONOTONIC;
 }
 
+#if SP_HAS_RDTSC
+
+/* Hardware counter, calibrated against CLOCK_MONOTONIC
+ *
+ * Nanoseconds are computed as `nanos + ((ticks - base) * mult) >> 32`, parameters are
+ * published with a seqlock. Once per SyncInterval one of the readers compares the clock with
+ * CLOCK_MONOTONIC: frequency is re-estimated from the initial anchor (so, it becomes more
+ * precise with time), and accumulated error is slewed out within the next interval, so the
+ * clock stays continuous.
+ *
+ * Slewed rate is used only for `slewTicks` after the base, nominal rate is used beyond that,
+ * so the correction does not accumulate when the next sync comes late. Clock never steps
+ * backwards: when it is ahead of CLOCK_MONOTONIC by more than StepThreshold, it holds until
+ * monotonic clock catches up.
+ */
+struct FastClock {
+	static constexpr uint64_t SyncInterval = 1'000'000'000; // ns
+	static constexpr uint64_t CalibrationTime = 5'000'000; // ns
+	static constexpr uint64_t StepThreshold = 1'000'000; // ns, jump forward on larger error
+	static constexpr double MaxSlew = 0.001; // max rate correction within the interval
+
+	uint64_t frequency = 0; // 0 if counter can not be used
+
+	uint64_t anchorTicks = 0;
+	uint64_t anchorNanos = 0;
+
+	sprt::atomic<uint32_t> seq = 0;
+	sprt::atomic<uint64_t> baseTicks = 0;
+	sprt::atomic<uint64_t> baseNanos = 0;
+	sprt::atomic<uint64_t> mult = 0; // ns per tick within slewTicks, 32.32 fixed point
+	sprt::atomic<uint64_t> nominalMult = 0; // ns per tick after slewTicks
+	sprt::atomic<uint64_t> slewTicks = 0;
+	sprt::atomic<bool> syncing = false;
+
+	static uint64_t scale(uint64_t ticks, uint64_t mult) {
+		// split to avoid 128-bit multiplication, valid until `ticks` fits in 64 bits
+		return (ticks >> 32) * mult + (((ticks & 0xFFFF'FFFF) * mult) >> 32);
+	}
+
+	static uint64_t makeMult(double nanosPerTick) {
+		return uint64_t(nanosPerTick * double(1ULL << 32));
+	}
+
+	// Reads counter and monotonic clock as close as possible, returns ticks at the reading
+	static uint64_t sample(uint64_t &nanos) {
+		uint64_t bestTicks = 0;
+		uint64_t bestSpan = Max<uint64_t>;
+		for (int i = 0; i < 3; ++i) {
+			auto t1 = rdtsc();
+			auto ns = ::__sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC);
+			auto t2 = rdtsc();
+			if (t2 - t1 < bestSpan) {
+				bestSpan = t2 - t1;
+				bestTicks = t1 + (t2 - t1) / 2;
+				nanos = ns;
+			}
+		}
+		return bestTicks;
+	}
+
+	static bool isInvariant() {
+#if __SSE__
+		unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+		if (__get_cpuid_max(0x8000'0000, nullptr) < 0x8000'0007) {
+			return false;
+		}
+		__get_cpuid(0x8000'0007, &eax, &ebx, &ecx, &edx);
+		if ((edx & (1 << 8)) == 0) {
+			return false;
+		}
+#if SPRT_LINUX || SPRT_ANDROID
+		// kernel watchdog switches from tsc, when it finds it unstable
+		char buf[32] = {0};
+		auto fd = ::__sprt_open("/sys/devices/system/clocksource/clocksource0/current_clocksource",
+				__SPRT_O_RDONLY | __SPRT_O_CLOEXEC);
+		if (fd >= 0) {
+			auto len = ::__sprt_read(fd, buf, sizeof(buf) - 1);
+			::__sprt_close(fd);
+			if (len > 0) {
+				auto source = StringView(buf, len);
+				source.trimChars<StringView::WhiteSpace>();
+				if (source != "tsc") {
+					return false;
+				}
+			}
+		}
+#endif
+		return true;
+#else
+		// generic timer has fixed frequency
+		return true;
+#endif
+	}
+
+	static uint64_t getNominalFrequency() {
+#if __SSE__
+		// TSC/crystal ratio and crystal frequency, available on newer CPUs
+		unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+		if (__get_cpuid_max(0, nullptr) >= 0x15) {
+			__get_cpuid(0x15, &eax, &ebx, &ecx, &edx);
+			if (eax != 0 && ebx != 0 && ecx != 0) {
+				return uint64_t(ecx) * ebx / eax;
+			}
+		}
+		return 0;
+#else
+		uint64_t freq = 0;
+		asm volatile("mrs %0, cntfrq_el0" : "=r"(freq));
+		return freq;
+#endif
+	}
+
+	FastClock() {
+		if (!isInvariant()) {
+			return;
+		}
+
+		anchorTicks = sample(anchorNanos);
+
+		frequency = getNominalFrequency();
+		if (!frequency) {
+			// measure frequency with a short busy wait
+			uint64_t nanos = 0;
+			uint64_t ticks = 0;
+			do {
+				ticks = sample(nanos);
+			} while (nanos - anchorNanos < CalibrationTime);
+			frequency = uint64_t(double(ticks - anchorTicks) * 1'000'000'000.0
+					/ double(nanos - anchorNanos));
+		}
+
+		if (!frequency) {
+			return;
+		}
+
+		baseTicks.store(anchorTicks, sprt::memory_order::relaxed);
+		baseNanos.store(anchorNanos, sprt::memory_order::relaxed);
+		nominalMult.store(makeMult(1'000'000'000.0 / double(frequency)),
+				sprt::memory_order::relaxed);
+		mult.store(nominalMult.load(sprt::memory_order::relaxed), sprt::memory_order::release);
+	}
+
+	static uint64_t value(uint64_t ticks, uint64_t t, uint64_t n, uint64_t m, uint64_t nm,
+			uint64_t sl) {
+		// counter can be slightly behind the base on other core
+		if (ticks <= t) {
+			return n;
+		}
+		auto delta = ticks - t;
+		if (delta <= sl) {
+			return n + scale(delta, m);
+		}
+		return n + scale(sl, m) + scale(delta - sl, nm);
+	}
+
+	uint64_t now() {
+		auto ticks = rdtsc();
+
+		uint32_t s = 0;
+		uint64_t t = 0, n = 0, m = 0, nm = 0, sl = 0;
+		do {
+			s = seq.load(sprt::memory_order::acquire);
+			t = baseTicks.load(sprt::memory_order::relaxed);
+			n = baseNanos.load(sprt::memory_order::relaxed);
+			m = mult.load(sprt::memory_order::relaxed);
+			nm = nominalMult.load(sprt::memory_order::relaxed);
+			sl = slewTicks.load(sprt::memory_order::relaxed);
+			sprt::atomic_thread_fence(sprt::memory_order::acquire);
+		} while ((s & 1) != 0 || seq.load(sprt::memory_order::relaxed) != s);
+
+		auto ret = value(ticks, t, n, m, nm, sl);
+		if (ticks > t && scale(ticks - t, nm) > SyncInterval
+				&& !syncing.exchange(true, sprt::memory_order::acquire)) {
+			ret = sync(t, n, m, nm, sl);
+			syncing.store(false, sprt::memory_order::release);
+		}
+		return ret;
+	}
+
+	uint64_t sync(uint64_t t, uint64_t n, uint64_t m, uint64_t nm, uint64_t sl) {
+		uint64_t mono = 0;
+		auto ticks = sample(mono);
+
+		// value of the current parameters at this moment, new parameters continue from it
+		auto current = value(ticks, t, n, m, nm, sl);
+
+		// long-term frequency
+		auto nanosPerTick = double(mono - anchorNanos) / double(ticks - anchorTicks);
+		auto newNominal = makeMult(nanosPerTick);
+
+		uint64_t newMult = 0;
+		uint64_t newSlewTicks = uint64_t(double(SyncInterval) / nanosPerTick);
+
+		auto error = double(int64_t(mono - current));
+		if (error > double(StepThreshold)) {
+			// counter was stopped or clock was changed significantly
+			current = mono;
+			newMult = newNominal;
+		} else if (error < -double(StepThreshold)) {
+			// clock is too far ahead, hold it until monotonic clock catches up
+			newMult = 0;
+			newSlewTicks = uint64_t(-error / nanosPerTick);
+		} else {
+			// catch up with monotonic clock within next interval
+			auto correction = error / double(SyncInterval);
+			if (correction > MaxSlew) {
+				correction = MaxSlew;
+			} else if (correction < -MaxSlew) {
+				correction = -MaxSlew;
+			}
+			newMult = makeMult(nanosPerTick * (1.0 + correction));
+		}
+
+		auto s = seq.load(sprt::memory_order::relaxed);
+		seq.store(s + 1, sprt::memory_order::relaxed);
+		sprt::atomic_thread_fence(sprt::memory_order::release);
+		baseTicks.store(ticks, sprt::memory_order::relaxed);
+		baseNanos.store(current, sprt::memory_order::relaxed);
+		mult.store(newMult, sprt::memory_order::relaxed);
+		nominalMult.store(newNominal, sprt::memory_order::relaxed);
+		slewTicks.store(newSlewTicks, sprt::memory_order::relaxed);
+		seq.store(s + 2, sprt::memory_order::release);
+
+		return current;
+	}
+};
+
+static FastClock &getFastClock() {
+	static FastClock s_clock;
+	return s_clock;
+}
+
+#endif
+
 static void _clock(struct __SPRT_TIMESPEC_NAME *ts, ClockType type) {
 	static __sprt_clockid_t ClockSource = getClockSource();
 
@@ -81,6 +318,7 @@ static void _clock(struct __SPRT_TIMESPEC_NAME *ts, ClockType type) {
 	case ClockType::Process: ::__sprt_clock_gettime(__SPRT_CLOCK_PROCESS_CPUTIME_ID, ts); break;
 	case ClockType::Thread: ::__sprt_clock_gettime(__SPRT_CLOCK_THREAD_CPUTIME_ID, ts); break;
 	case ClockType::Hardware: break;
+	case ClockType::Fast: ::__sprt_clock_gettime(__SPRT_CLOCK_MONOTONIC, ts); break;
 	}
 }
 
@@ -90,6 +328,13 @@ uint64_t clock(ClockType type) {
 		return rdtsc();
 #else
 		type = ClockType::Monotonic;
+#endif
+	} else if (type == ClockType::Fast) {
+#if SP_HAS_RDTSC
+		auto &c = getFastClock();
+		if (c.frequency) {
+			return c.now() / 1'000;
+		}
 #endif
 	}
 
@@ -113,11 +358,27 @@ uint64_t nanoclock(ClockType type) {
 		return ::__sprt_clock_gettime_nsec_np(__SPRT_CLOCK_THREAD_CPUTIME_ID);
 		break;
 	case ClockType::Hardware: break;
+	case ClockType::Fast:
+#if SP_HAS_RDTSC
+		if (auto &c = getFastClock(); c.frequency) {
+			return c.now();
+		}
+#endif
+		return ::__sprt_clock_gettime_nsec_np(__SPRT_CLOCK_MONOTONIC);
+		break;
 	}
 
 	return 0;
 }
 
+uint64_t getHardwareClockFrequency() {
+#if SP_HAS_RDTSC
+	return getFastClock().frequency;
+#else
+	return 0;
+#endif
+}
+
 void sleep(uint64_t microseconds) { ::__sprt_usleep(time_t(microseconds)); }
 
 uint32_t getMemoryPageSize() { return static_cast<uint32_t>(::__sprt_sysconf(__SPRT_SC_PAGESIZE)); }
@@ -35,187 +35,6 @@
 
 namespace sprt::unicode {
 
-static auto mapBuffer(WideStringView data, char16_t *buf, size_t count, int flags) {
-	return LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, (wchar_t *)data.data(), data.size(),
-			(wchar_t *)buf, int(count), nullptr, nullptr, 0);
-}
-
-template <typename Interface>
-auto mapString(WideStringView data, int flags) {
-	auto bufSize = LCMapStringEx(LOCALE_NAME_SYSTEM_DEFAULT, flags, (wchar_t *)data.data(),
-			data.size(), (wchar_t *)nullptr, 0, nullptr, nullptr, 0);
-
-	typename Interface::WideStringType ret;
-	ret.resize(bufSize);
-
-	mapBuffer(data, ret.data(), ret.size(), flags);
-
-	return ret;
-}
-
-char32_t tolower(char32_t c) {
-	char16_t bufA[4];
-	char16_t bufB[8];
-
-	auto size = unicode::utf16EncodeBuf(bufA, 3, c);
-	auto bufSize = mapBuffer(WideStringView(bufA, size), bufB, 8, LCMAP_LOWERCASE);
-	if (bufSize > 0) {
-		uint8_t off;
-		return unicode::utf16Decode32(bufB, 8, off);
-	}
-	return c;
-}
-
-char32_t toupper(char32_t c) {
-	char16_t bufA[4];
-	char16_t bufB[8];
-
-	auto size = unicode::utf16EncodeBuf(bufA, 3, c);
-	auto bufSize = mapBuffer(WideStringView(bufA, size), bufB, 8, LCMAP_UPPERCASE);
-	if (bufSize > 0) {
-		uint8_t off;
-		return unicode::utf16Decode32(bufB, 8, off);
-	}
-	return c;
-}
-
-char32_t totitle(char32_t c) {
-	char16_t bufA[4];
-	char16_t bufB[8];
-
-	auto size = unicode::utf16EncodeBuf(bufA, 3, c);
-	auto bufSize = mapBuffer(WideStringView(bufA, size), bufB, 8, LCMAP_TITLECASE);
-	if (bufSize > 0) {
-		uint8_t off;
-		return unicode::utf16Decode32(bufB, 8, off);
-	}
-	return c;
-}
-
-bool toupper(const callback<void(StringView)> &cb, StringView data) {
-	bool ret = false;
-	toUtf16([&](WideStringView uData) {
-		ret = toupper([&](WideStringView result) { toUtf8(cb, result); }, uData);
-	}, data);
-	return ret;
-}
-
-bool totitle(const callback<void(StringView)> &cb, StringView data) {
-	bool ret = false;
-	toUtf16([&](WideStringView uData) {
-		ret = totitle([&](WideStringView result) { toUtf8(cb, result); }, uData);
-	}, data);
-	return ret;
-}
-
-bool tolower(const callback<void(StringView)> &cb, StringView data) {
-	bool ret = false;
-	toUtf16([&](WideStringView uData) {
-		ret = tolower([&](WideStringView result) { toUtf8(cb, result); }, uData);
-	}, data);
-	return ret;
-}
-
-bool toupper(const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto bufSize = mapBuffer(data, nullptr, 0, LCMAP_UPPERCASE);
-	if (bufSize <= 0) {
-		return false;
-	}
-
-	auto buf = __sprt_typed_malloca(char16_t, bufSize + 1);
-	bufSize = mapBuffer(data, buf, bufSize + 1, LCMAP_UPPERCASE);
-	if (bufSize <= 0) {
-		__sprt_freea(buf);
-		return false;
-	}
-	buf[bufSize] = 0;
-
-	cb(WideStringView(buf, bufSize));
-	__sprt_freea(buf);
-	return true;
-}
-
-bool totitle(const callback<void(WideStringView)> &cb, WideStringView data) {
-	bool ret = false;
-	// lowercase first, WinAPI cannt do titlecase on uppercased strings
-	if (!tolower([&](WideStringView lstr) {
-		auto bufSize = mapBuffer(lstr, nullptr, 0, LCMAP_TITLECASE);
-		if (bufSize <= 0) {
-			return;
-		}
-
-		auto buf = __sprt_typed_malloca(char16_t, bufSize + 1);
-		bufSize = mapBuffer(lstr, buf, bufSize + 1, LCMAP_TITLECASE);
-		if (bufSize <= 0) {
-			__sprt_freea(buf);
-			return;
-		}
-		buf[bufSize] = 0;
-
-		cb(WideStringView(buf, bufSize));
-		__sprt_freea(buf);
-		ret = true;
-	}, data)) {
-		return false;
-	}
-	return ret;
-}
-
-bool tolower(const callback<void(WideStringView)> &cb, WideStringView data) {
-	auto bufSize = mapBuffer(data, nullptr, 0, LCMAP_LOWERCASE);
-	if (bufSize <= 0) {
-		return false;
-	}
-
-	auto buf = __sprt_typed_malloca(char16_t, bufSize + 1);
-	bufSize = mapBuffer(data, buf, bufSize + 1, LCMAP_LOWERCASE);
-	if (bufSize <= 0) {
-		__sprt_freea(buf);
-		return false;
-	}
-	buf[bufSize] = 0;
-
-	cb(WideStringView(buf, bufSize));
-	__sprt_freea(buf);
-	return true;
-}
-
-bool compare(StringView l, StringView r, int *result) {
-	bool ret = false;
-	unicode::toUtf16([&](WideStringView lStr) {
-		unicode::toUtf16([&](WideStringView rStr) { ret = compare(lStr, rStr, result); }, r);
-	}, l);
-	return ret;
-}
-
-bool compare(WideStringView l, WideStringView r, int *result) {
-	auto ret = CompareStringEx(LOCALE_NAME_SYSTEM_DEFAULT, NORM_LINGUISTIC_CASING,
-			(wchar_t *)l.data(), l.size(), (wchar_t *)r.data(), r.size(), nullptr, nullptr, 0);
-	if (ret > 0) {
-		*result = ret - CSTR_EQUAL;
-		return true;
-	}
-	return false;
-}
-
-bool caseCompare(StringView l, StringView r, int *result) {
-	bool ret = false;
-	unicode::toUtf16([&](WideStringView lStr) {
-		unicode::toUtf16([&](WideStringView rStr) { ret = caseCompare(lStr, rStr, result); }, r);
-	}, l);
-	return ret;
-}
-
-bool caseCompare(WideStringView l, WideStringView r, int *result) {
-	auto ret = CompareStringEx(LOCALE_NAME_SYSTEM_DEFAULT, NORM_LINGUISTIC_CASING | NORM_IGNORECASE,
-			(wchar_t *)l.data(), l.size(), (wchar_t *)r.data(), r.size(), nullptr, nullptr, 0);
-	if (ret > 0) {
-		*result = ret - CSTR_EQUAL;
-		return true;
-	}
-	return false;
-}
-
 bool idnToAscii(const callback<void(StringView)> &cb, StringView source) {
 	bool ret = false;
 	unicode::toUtf16([&](WideStringView usource) {
@@ -28,6 +28,8 @@
 
 namespace sprt::filesystem::detail {
 
+struct AssetPackMount;
+
 struct LookupData : public sprt::detail::AllocPool {
 	static LookupData *get();
 
@@ -37,6 +39,9 @@ struct LookupData : public sprt::detail::AllocPool {
 	memory::pool_t *_pool = nullptr;
 	array<LookupInfo, toInt(LocationCategory::Max)> _resourceLocations;
 
+	// Mounted asset packs, unmapped on termination
+	AssetPackMount *_packs = nullptr;
+
 	// Init application paths as executable-relative fallbacks
 	void initAppPaths(StringView execDir);
 };
@@ -46,6 +51,8 @@ SPRT_LOCAL StringView _readEnvExt(memory::pool_t *pool, StringView key);
 SPRT_LOCAL void _initSystemPaths(LookupData &);
 SPRT_LOCAL void _termSystemPaths(LookupData &);
 
+SPRT_LOCAL void _termAssetPacks(LookupData &);
+
 } // namespace sprt::filesystem::detail
 
 #endif // CORE_RUNTIME_PRIVATE_SPRTFILESYSTEM_H_
@@ -0,0 +1,58 @@
+/**
+ Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ **/
+
+#ifndef CORE_RUNTIME_PRIVATE_SPRTHASH_H_
+#define CORE_RUNTIME_PRIVATE_SPRTHASH_H_
+
+#include <sprt/runtime/hash.h>
+
+namespace sprt::sha1::detail {
+
+// Processes `blocks` of 64-byte message blocks, data is in message (big-endian) byte order
+using BlockFn = void (*)(uint32_t digest[5], const uint8_t *data, size_t blocks);
+
+// Returns hardware block function for the current CPU or nullptr
+BlockFn getAcceleratedBlockFn();
+
+} // namespace sprt::sha1::detail
+
+
+namespace sprt::sha256::detail {
+
+extern const uint32_t K[64];
+
+using BlockFn = void (*)(uint32_t state[8], const uint8_t *data, size_t blocks);
+
+// State is word-major: state[word * MultiBufferLanes + lane]
+// Every lane should have at least `blocks` full blocks of data
+using MultiBlockFn = void (*)(uint32_t state[8 * MultiBufferLanes],
+		const uint8_t *const data[MultiBufferLanes], size_t blocks);
+
+BlockFn getAcceleratedBlockFn();
+
+// Returns multi-buffer function, if it's faster then sequential hashing with
+// the best available block function, or nullptr
+MultiBlockFn getMultiBlockFn();
+
+} // namespace sprt::sha256::detail
+
+#endif // CORE_RUNTIME_PRIVATE_SPRTHASH_H_
@@ -0,0 +1,84 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+using namespace sprt;
+
+/*
+	sprt-test [--bench] [--full] [filter...]
+
+	Runs registered tests (or benchmarks with `--bench`), which name starts with any of
+	the filters; returns non-zero, if any of them failed
+*/
+int main(int argc, const char *argv[]) {
+	bool bench = false;
+	const char *filters[64];
+	int nfilters = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		auto arg = StringView(argv[i]);
+		if (arg == "--bench") {
+			bench = true;
+		} else if (arg == "--full") {
+			test::Test::setFull(true);
+		} else if (nfilters < 64) {
+			filters[nfilters++] = argv[i];
+		}
+	}
+
+	// dispatch tests require memory pools and the platform layer
+	int resultCode = 0;
+	if (!sprt::initialize(
+				AppConfig{.bundleName = "org.stappler.runtime.test", .appName = "sprt-test"},
+				resultCode)) {
+		__sprt_printf("Fail to initialize runtime: %d\n", resultCode);
+		return resultCode ? resultCode : 1;
+	}
+
+	uint32_t total = 0;
+	uint32_t failed = 0;
+	for (auto t = test::Test::getFirst(); t; t = t->getNext()) {
+		if (t->isBenchmark() != bench) {
+			continue;
+		}
+
+		bool matched = (nfilters == 0);
+		for (int i = 0; i < nfilters && !matched; ++i) {
+			matched = t->getName().starts_with(StringView(filters[i]));
+		}
+		if (!matched) {
+			continue;
+		}
+
+		__sprt_printf("%.*s\n", int(t->getName().size()), t->getName().data());
+		++total;
+		if (!t->run()) {
+			++failed;
+		}
+	}
+
+	__sprt_printf("%u %s, %u failed\n", total, bench ? "benchmarks" : "tests", failed);
+
+	sprt::terminate();
+	return failed ? 1 : 0;
+}
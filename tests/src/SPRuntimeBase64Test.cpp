@@ -0,0 +1,538 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/utils/base64.h>
+#include <sprt/runtime/utils/base16.h>
+
+namespace sprt::test {
+
+// Scalar codec, used before the SIMD kernels, kept as the benchmark reference
+namespace base64ref {
+
+// Mapping from 6 bit pattern to ASCII character.
+static const char *s_refEncodeLookup =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Definition for "masked-out" areas of the s_refDecodeLookup mapping
+#define xx 65
+
+// clang-format off
+static unsigned char s_refDecodeLookup[256] = {
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,62, xx,62,xx,63,
+	52,53,54,55, 56,57,58,59, 60,61,xx,xx, xx,xx,xx,xx,
+	xx, 0, 1, 2,  3, 4, 5, 6,  7, 8, 9,10, 11,12,13,14,
+	15,16,17,18, 19,20,21,22, 23,24,25,xx, xx,xx,xx,63,
+	xx,26,27,28, 29,30,31,32, 33,34,35,36, 37,38,39,40,
+	41,42,43,44, 45,46,47,48, 49,50,51,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+	xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx, xx,xx,xx,xx,
+};
+// clang-format on
+
+// Fundamental sizes of the binary and base64 encode/decode units in bytes
+static constexpr int BinaryUnit = 3;
+static constexpr int Base64Unit = 4;
+
+template <typename Callback>
+static void refEncode(BytesView inputBuffer, const Callback &cb) {
+	auto length = inputBuffer.size();
+
+	size_t i = 0;
+	for (; i + BinaryUnit - 1 < length; i += BinaryUnit) {
+		// Inner loop: turn 48 bytes into 64 base64 characters
+		cb(s_refEncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
+		cb(s_refEncodeLookup[((inputBuffer[i] & 0x03) << 4) | ((inputBuffer[i + 1] & 0xF0) >> 4)]);
+		cb(s_refEncodeLookup[((inputBuffer[i + 1] & 0x0F) << 2)
+				| ((inputBuffer[i + 2] & 0xC0) >> 6)]);
+		cb(s_refEncodeLookup[inputBuffer[i + 2] & 0x3F]);
+	}
+
+	if (i + 1 < length) {
+		// Handle the single '=' case
+		cb(s_refEncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
+		cb(s_refEncodeLookup[((inputBuffer[i] & 0x03) << 4) | ((inputBuffer[i + 1] & 0xF0) >> 4)]);
+		cb(s_refEncodeLookup[(inputBuffer[i + 1] & 0x0F) << 2]);
+		cb('=');
+	} else if (i < length) {
+		// Handle the double '=' case
+		cb(s_refEncodeLookup[(inputBuffer[i] & 0xFC) >> 2]);
+		cb(s_refEncodeLookup[(inputBuffer[i] & 0x03) << 4]);
+		cb('=');
+		cb('=');
+	}
+}
+
+template <typename Callback>
+static void refDecode(StringView inputBuffer, const Callback &cb) {
+	auto length = inputBuffer.size();
+
+	size_t i = 0;
+	while (i < length) {
+		// Accumulate 4 valid characters (ignore everything else)
+		unsigned char accumulated[Base64Unit];
+		size_t accumulateIndex = 0;
+		while (i < length) {
+			unsigned char decode = s_refDecodeLookup[(unsigned char)inputBuffer[i++]];
+			if (decode != xx) {
+				accumulated[accumulateIndex] = decode;
+				accumulateIndex++;
+				if (accumulateIndex == Base64Unit) {
+					break;
+				}
+			}
+		}
+
+		if (accumulateIndex >= 2) {
+			cb((accumulated[0] << 2) | (accumulated[1] >> 4));
+		}
+		if (accumulateIndex >= 3) {
+			cb((accumulated[1] << 4) | (accumulated[2] >> 2));
+		}
+		if (accumulateIndex >= 4) {
+			cb((accumulated[2] << 6) | accumulated[3]);
+		}
+	}
+}
+
+#undef xx
+
+} // namespace base64ref
+
+struct Base64Case {
+	StringView input;
+	bool url;
+	bool valid;
+	StringView output;
+};
+
+// Decoding with DecodeMode::Strict
+static const Base64Case s_strictCases[] = {
+	{"", false, true, ""},
+	{"Zg==", false, true, "f"},
+	{"Zm8=", false, true, "fo"},
+	{"Zm9v", false, true, "foo"},
+	{"Zm9vYg==", false, true, "foob"},
+	{"Zm9vYmE=", false, true, "fooba"},
+	{"Zm9vYmFy", false, true, "foobar"},
+	{"+/8=", false, true, "\xFB\xFF"},
+	{"Zg", false, false, ""}, // padding is required for the standard alphabet
+	{"Zm8", false, false, ""},
+	{"Zg=", false, false, ""}, // incomplete padding
+	{"Zg===", false, false, ""},
+	{"Z===", false, false, ""},
+	{"Z", false, false, ""},
+	{"=", false, false, ""},
+	{"Zm9v=", false, false, ""},
+	{"=Zg=", false, false, ""},
+	{"Z=g=", false, false, ""},
+	{"Zg==Zg==", false, false, ""}, // data after padding
+	{"Zm9vYmFy=", false, false, ""},
+	{"Zh==", false, false, ""}, // non-zero unused bits
+	{"Zm9=", false, false, ""},
+	{"Zm 9v", false, false, ""}, // out of the alphabet
+	{"Zm9v\n", false, false, ""},
+	{"Zm9v*", false, false, ""},
+	{"-_8=", false, false, ""},
+	{"Zg", true, true, "f"}, // padding is optional for the URL-safe alphabet
+	{"Zg==", true, true, "f"},
+	{"Zm8", true, true, "fo"},
+	{"-_8", true, true, "\xFB\xFF"},
+	{"-_8=", true, true, "\xFB\xFF"},
+	{"+/8=", true, false, ""},
+	{"Zg=", true, false, ""},
+	{"Z", true, false, ""},
+	{"Zh", true, false, ""},
+	{"Zg==Zg", true, false, ""},
+};
+
+static uint8_t getLenientValue(char c) {
+	if (c >= 'A' && c <= 'Z') {
+		return c - 'A';
+	} else if (c >= 'a' && c <= 'z') {
+		return c - 'a' + 26;
+	} else if (c >= '0' && c <= '9') {
+		return c - '0' + 52;
+	} else if (c == '+' || c == '-') {
+		return 62;
+	} else if (c == '/' || c == '_') {
+		return 63;
+	}
+	return 0xFF;
+}
+
+// Lenient decoding: characters out of both alphabets are skipped, single trailing char is dropped
+static size_t decodeLenientReference(const char *in, size_t len, uint8_t *out) {
+	size_t ret = 0;
+	uint32_t accum = 0;
+	uint32_t count = 0;
+	for (size_t i = 0; i < len; ++i) {
+		auto value = getLenientValue(in[i]);
+		if (value == 0xFF) {
+			continue;
+		}
+		accum = (accum << 6) | value;
+		if (++count == 4) {
+			out[ret++] = uint8_t(accum >> 16);
+			out[ret++] = uint8_t(accum >> 8);
+			out[ret++] = uint8_t(accum);
+			accum = count = 0;
+		}
+	}
+	if (count == 2) {
+		out[ret++] = uint8_t(accum >> 4);
+	} else if (count == 3) {
+		out[ret++] = uint8_t(accum >> 10);
+		out[ret++] = uint8_t(accum >> 2);
+	}
+	return ret;
+}
+
+static void fillRandom(Random &rnd, uint8_t *data, size_t len) {
+	for (size_t i = 0; i < len; ++i) { data[i] = uint8_t(rnd.next()); }
+}
+
+struct Base64Test : Test {
+	static constexpr size_t MaxSize = 1'200;
+
+	Base64Test() : Test("base64") { }
+
+	virtual bool run() override {
+		runTest("vectors", [&] {
+			bool success = true;
+			char buf[16];
+			const StringView vectors[][3] = {
+				{"", "", ""},
+				{"f", "Zg==", "Zg"},
+				{"fo", "Zm8=", "Zm8"},
+				{"foo", "Zm9v", "Zm9v"},
+				{"foob", "Zm9vYg==", "Zm9vYg"},
+				{"fooba", "Zm9vYmE=", "Zm9vYmE"},
+				{"foobar", "Zm9vYmFy", "Zm9vYmFy"},
+				{"\xFB\xFF\xBF", "+/+/", "-_-_"},
+			};
+			for (auto &it : vectors) {
+				auto data = (const uint8_t *)it[0].data();
+				auto len = base64::encode(data, it[0].size(), buf, sizeof(buf));
+				success &= SPRT_TEST_CHECK(StringView(buf, len) == it[1]);
+				success &= SPRT_TEST_CHECK(base64::getEncodeSize(it[0].size()) == it[1].size());
+				len = base64url::encode(data, it[0].size(), buf, sizeof(buf));
+				success &= SPRT_TEST_CHECK(StringView(buf, len) == it[2]);
+			}
+			return success;
+		});
+
+		runTest("strict", [&] {
+			bool success = true;
+			uint8_t buf[16];
+			for (auto &it : s_strictCases) {
+				size_t ret = 0;
+				Status status;
+				if (it.url) {
+					status = base64url::decode(it.input.data(), it.input.size(), buf, sizeof(buf),
+							&ret, base64::DecodeMode::Strict);
+				} else {
+					status = base64::decode(it.input.data(), it.input.size(), buf, sizeof(buf),
+							&ret, base64::DecodeMode::Strict);
+				}
+				if (it.valid) {
+					success &= SPRT_TEST_CHECK(status == Status::Ok
+							&& StringView((const char *)buf, ret) == it.output);
+				} else {
+					success &= SPRT_TEST_CHECK(status == Status::ErrorInvalidArguemnt);
+				}
+			}
+
+			// lenient mode skips everything out of the alphabet
+			const StringView lenient[][2] = {
+				{"Zm9v YmFy\n", "foobar"},
+				{"Zg", "f"},
+				{"Z", ""},
+				{"Zg==Zg==", "f\x06`"},
+				{"-_8=", "\xFB\xFF"},
+				{"+/8", "\xFB\xFF"},
+			};
+			for (auto &it : lenient) {
+				auto ret = base64::decode(it[0].data(), it[0].size(), buf, sizeof(buf));
+				success &= SPRT_TEST_CHECK(StringView((const char *)buf, ret) == it[1]);
+			}
+
+			size_t ret = 0;
+			auto status = base64::decode("Zm9vYmFy", 8, buf, 5, &ret, base64::DecodeMode::Strict);
+			success &= SPRT_TEST_CHECK(status == Status::ErrorBufferOverflow);
+			return success;
+		});
+
+		// lengths cover the scalar tails and the block kernels
+		runTest("round-trip", [&] {
+			bool success = true;
+			auto data = new uint8_t[MaxSize];
+			auto encoded = new char[base64::getEncodeSize(MaxSize)];
+			auto decoded = new uint8_t[MaxSize + 3];
+			Random rnd;
+
+			for (size_t len = 0; len < MaxSize && success; ++len) {
+				fillRandom(rnd, data, len);
+				size_t ret = 0;
+
+				auto elen = base64::encode(data, len, encoded, base64::getEncodeSize(len));
+				success &= SPRT_TEST_CHECK(elen == base64::getEncodeSize(len));
+				auto status = base64::decode(encoded, elen, decoded, MaxSize + 3, &ret,
+						base64::DecodeMode::Strict);
+				success &= SPRT_TEST_CHECK(status == Status::Ok && ret == len
+						&& __sprt_memcmp(decoded, data, len) == 0);
+
+				ret = base64::decode(encoded, elen, decoded, MaxSize + 3);
+				success &= SPRT_TEST_CHECK(ret == len && __sprt_memcmp(decoded, data, len) == 0);
+
+				elen = base64url::encode(data, len, encoded, base64::getEncodeSize(len));
+				success &= SPRT_TEST_CHECK(elen == (len * 4 + 2) / 3);
+				status = base64url::decode(encoded, elen, decoded, MaxSize + 3, &ret,
+						base64::DecodeMode::Strict);
+				success &= SPRT_TEST_CHECK(status == Status::Ok && ret == len
+						&& __sprt_memcmp(decoded, data, len) == 0);
+
+				ret = base64url::decode(encoded, elen, decoded, MaxSize + 3);
+				success &= SPRT_TEST_CHECK(ret == len && __sprt_memcmp(decoded, data, len) == 0);
+			}
+
+			delete[] decoded;
+			delete[] encoded;
+			delete[] data;
+			return success;
+		});
+
+		// single foreign character anywhere in the long input
+		runTest("rejection", [&] {
+			bool success = true;
+			auto data = new uint8_t[MaxSize];
+			auto encoded = new char[base64::getEncodeSize(MaxSize)];
+			auto decoded = new uint8_t[MaxSize + 3];
+			auto expected = new uint8_t[MaxSize + 3];
+			const char foreign[] = " \n\r\t!#*.=-_\x80\xFF";
+			Random rnd;
+
+			uint32_t count = isFull() ? 1'000'000 : 20'000;
+			for (uint32_t round = 0; round < count && success; ++round) {
+				auto len = 100 + rnd.next() % (MaxSize - 100);
+				fillRandom(rnd, data, len);
+
+				auto elen = base64::encode(data, len, encoded, base64::getEncodeSize(len));
+				auto pos = rnd.next() % elen;
+				auto c = foreign[rnd.next() % (sizeof(foreign) - 1)];
+				if (c == '=' && encoded[pos] == '=') {
+					continue;
+				}
+				encoded[pos] = c;
+
+				size_t ret = 0;
+				auto status = base64::decode(encoded, elen, decoded, MaxSize + 3, &ret,
+						base64::DecodeMode::Strict);
+				success &= SPRT_TEST_CHECK(status == Status::ErrorInvalidArguemnt);
+				// '=' can complete the group with the foreign char
+				success &= SPRT_TEST_CHECK(ret <= (pos / 4) * 3 + (c == '=' ? 2 : 0));
+
+				auto elen2 = decodeLenientReference(encoded, elen, expected);
+				ret = base64::decode(encoded, elen, decoded, MaxSize + 3);
+				success &= SPRT_TEST_CHECK(
+						ret == elen2 && __sprt_memcmp(decoded, expected, ret) == 0);
+			}
+
+			delete[] expected;
+			delete[] decoded;
+			delete[] encoded;
+			delete[] data;
+			return success;
+		});
+
+		runTest("streaming", [&] {
+			bool success = true;
+			auto data = new uint8_t[MaxSize];
+			auto encoded = new char[base64::getEncodeSize(MaxSize)];
+			auto chunked = new char[base64::getEncodeSize(MaxSize)];
+			auto decoded = new uint8_t[MaxSize + 3];
+			Random rnd;
+
+			for (uint32_t round = 0; round < 2'000 && success; ++round) {
+				const bool url = (round % 2) != 0;
+				auto len = rnd.next() % MaxSize;
+				fillRandom(rnd, data, len);
+
+				auto elen = url ? base64url::encode(data, len, encoded, base64::getEncodeSize(len))
+								: base64::encode(data, len, encoded, base64::getEncodeSize(len));
+
+				base64::Encoder encoder(url);
+				size_t offset = 0;
+				size_t clen = 0;
+				size_t ret = 0;
+				while (offset < len) {
+					auto chunk = sprt::min(size_t(rnd.next() % 100), len - offset);
+					auto status = encoder.update(data + offset, chunk, chunked + clen,
+							base64::Encoder::getUpdateSize(chunk), &ret);
+					success &= SPRT_TEST_CHECK(status == Status::Ok);
+					offset += chunk;
+					clen += ret;
+				}
+				success &= SPRT_TEST_CHECK(encoder.finalize(chunked + clen, 4, &ret) == Status::Ok);
+				clen += ret;
+				success &= SPRT_TEST_CHECK(StringView(chunked, clen) == StringView(encoded, elen));
+
+				base64::Decoder decoder(base64::DecodeMode::Strict, url);
+				offset = 0;
+				size_t dlen = 0;
+				while (offset < elen) {
+					auto chunk = sprt::min(size_t(rnd.next() % 100), elen - offset);
+					auto status = decoder.update(encoded + offset, chunk, decoded + dlen,
+							base64::Decoder::getUpdateSize(chunk) + 3, &ret);
+					success &= SPRT_TEST_CHECK(status == Status::Ok);
+					offset += chunk;
+					dlen += ret;
+				}
+				success &= SPRT_TEST_CHECK(decoder.finalize(decoded + dlen, 3, &ret) == Status::Ok);
+				dlen += ret;
+				success &= SPRT_TEST_CHECK(dlen == len && __sprt_memcmp(decoded, data, len) == 0);
+
+				// error is sticky until finalize
+				if (len > 0) {
+					success &= SPRT_TEST_CHECK(decoder.update("Zm9v*", 5, decoded, MaxSize, &ret)
+							== Status::ErrorInvalidArguemnt);
+					success &= SPRT_TEST_CHECK(decoder.update("Zm9v", 4, decoded, MaxSize, &ret)
+							== Status::ErrorInvalidArguemnt);
+					success &= SPRT_TEST_CHECK(
+							decoder.finalize(decoded, 3, &ret) == Status::ErrorInvalidArguemnt);
+					auto status = decoder.update("Zm9v", 4, decoded, MaxSize, &ret);
+					success &= SPRT_TEST_CHECK(status == Status::Ok && ret == 3);
+					decoder.finalize(decoded, 3, &ret);
+				}
+			}
+
+			delete[] decoded;
+			delete[] chunked;
+			delete[] encoded;
+			delete[] data;
+			return success;
+		});
+
+		runTest("base16", [&] {
+			bool success = true;
+			uint8_t data[300];
+			char encoded[600];
+			uint8_t decoded[300];
+			Random rnd;
+
+			auto elen = base16::encode((const uint8_t *)"\x01\xAB\xFF", 3, encoded, 6, false);
+			success &= SPRT_TEST_CHECK(StringView(encoded, elen) == "01abff");
+			elen = base16::encode((const uint8_t *)"\x01\xAB\xFF", 3, encoded, 6, true);
+			success &= SPRT_TEST_CHECK(StringView(encoded, elen) == "01ABFF");
+
+			for (size_t len = 0; len < 300; ++len) {
+				fillRandom(rnd, data, len);
+				elen = base16::encode(data, len, encoded, sizeof(encoded), len % 2);
+				success &= SPRT_TEST_CHECK(elen == len * 2);
+				auto dlen = base16::decode(encoded, elen, decoded, sizeof(decoded));
+				success &= SPRT_TEST_CHECK(dlen == len && __sprt_memcmp(decoded, data, len) == 0);
+
+				// odd trailing char is ignored
+				if (len > 0) {
+					success &= SPRT_TEST_CHECK(
+							base16::decode(encoded, elen - 1, decoded, sizeof(decoded)) == len - 1);
+				}
+			}
+			return success;
+		});
+
+		return _failed == 0;
+	}
+} _Base64Test;
+
+struct Base64Bench : Test {
+	static constexpr size_t DataSize = 1'024 * 1'024;
+
+	Base64Bench() : Test("base64", true) { }
+
+	virtual bool run() override {
+		auto data = new uint8_t[DataSize];
+		auto encoded = new char[base64::getEncodeSize(DataSize)];
+		auto decoded = new uint8_t[DataSize];
+		auto hex = new char[DataSize * 2];
+
+		Random rnd;
+		fillRandom(rnd, data, DataSize);
+
+		size_t elen = 0;
+		size_t ret = 0;
+		runBench("base64 encode", 200, DataSize, [&] {
+			elen = base64::encode(data, DataSize, encoded, base64::getEncodeSize(DataSize));
+			doNotOptimize(encoded);
+		});
+
+		runBench("base64 decode", 200, elen, [&] {
+			ret = base64::decode(encoded, elen, decoded, DataSize);
+			doNotOptimize(decoded);
+		});
+
+		runBench("base64 decode strict", 200, elen, [&] {
+			base64::decode(encoded, elen, decoded, DataSize, &ret, base64::DecodeMode::Strict);
+			doNotOptimize(decoded);
+		});
+
+		runBench("base64 encode reference", 200, DataSize, [&] {
+			size_t accum = 0;
+			base64ref::refEncode(BytesView(data, DataSize), [&](char c) { encoded[accum++] = c; });
+			doNotOptimize(encoded);
+		});
+
+		runBench("base64 decode reference", 200, elen, [&] {
+			size_t accum = 0;
+			base64ref::refDecode(StringView(encoded, elen),
+					[&](uint8_t c) { decoded[accum++] = c; });
+			doNotOptimize(decoded);
+		});
+
+		runBench("base16 encode", 200, DataSize, [&] {
+			elen = base16::encode(data, DataSize, hex, DataSize * 2);
+			doNotOptimize(hex);
+		});
+
+		runBench("base16 decode", 200, DataSize * 2, [&] {
+			ret = base16::decode(hex, DataSize * 2, decoded, DataSize);
+			doNotOptimize(decoded);
+		});
+
+		delete[] hex;
+		delete[] decoded;
+		delete[] encoded;
+		delete[] data;
+		return true;
+	}
+} _Base64Bench;
+
+} // namespace sprt::test
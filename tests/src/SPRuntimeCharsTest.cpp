@@ -0,0 +1,212 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/chargroup.h>
+#include <sprt/runtime/stringview.h>
+
+namespace sprt::test {
+
+using Alnum = StringView::CharGroup<CharGroupId::Alphanumeric>;
+using Space = StringView::CharGroup<CharGroupId::WhiteSpace>;
+
+// Scalar per-char scan, used by StringView before the class tables
+template <typename T>
+static size_t scanReference(const char *ptr, size_t len, bool value) {
+	size_t offset = 0;
+	while (offset < len && T::match(ptr[offset]) == value) { ++offset; }
+	return offset;
+}
+
+// Checks the class table of `T` against `T::match`, then compares table scans
+// with the scalar loop on inputs with matched and unmatched runs of random length
+template <typename T>
+static bool checkCharTable(const char *name) {
+	static constexpr uint32_t MaxLength = 512;
+	static constexpr uint32_t MaxOffset = 32;
+
+	const auto &table = chars::CharTableValue<T>;
+
+	char matched[256];
+	char unmatched[256];
+	uint32_t nmatched = 0;
+	uint32_t nunmatched = 0;
+
+	for (uint32_t i = 0; i < 256; ++i) {
+		auto c = char(uint8_t(i));
+		if (table.test(c) != T::match(c)) {
+			__sprt_printf("  [FAIL] %s: table mismatch for 0x%02X\n", name, i);
+			return false;
+		}
+		if (T::match(c)) {
+			matched[nmatched++] = c;
+		} else {
+			unmatched[nunmatched++] = c;
+		}
+	}
+
+	Random rnd;
+	char buf[MaxLength + MaxOffset];
+	for (uint32_t iter = 0; iter < 4'000; ++iter) {
+		auto offset = uint32_t(rnd.next() % MaxOffset);
+		auto len = uint32_t(rnd.next() % MaxLength);
+		auto ptr = buf + offset;
+
+		bool inMatched = (rnd.next() & 1) != 0;
+		for (uint32_t i = 0; i < len;) {
+			auto run = min(uint32_t(rnd.next() % 100), len - i);
+			for (uint32_t j = 0; j < run; ++j, ++i) {
+				if (inMatched && nmatched > 0) {
+					ptr[i] = matched[rnd.next() % nmatched];
+				} else {
+					ptr[i] = unmatched[rnd.next() % nunmatched];
+				}
+			}
+			inMatched = !inMatched;
+		}
+
+		for (uint32_t v = 0; v < 2; ++v) {
+			auto expected = scanReference<T>(ptr, len, v != 0);
+			auto scanned = chars::scanCharTable(table, ptr, len, v != 0);
+			auto inlined = table.scan(ptr, len, v != 0);
+			if (scanned != expected || inlined != expected) {
+				__sprt_printf("  [FAIL] %s: scan(%u, %u, %u): %zu %zu, expected %zu\n", name,
+						offset, len, v, scanned, inlined, expected);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+struct CharsTest : Test {
+	CharsTest() : Test("chars") { }
+
+	virtual bool run() override {
+		runTest("char tables", [&] {
+			return checkCharTable<StringView::Chars<' ', '\t'>>("chars")
+					&& checkCharTable<StringView::Range<'0', '9'>>("range")
+					&& checkCharTable<StringView::Range<'\x80', '\xFF'>>("high range")
+					&& checkCharTable<chars::UniChar>("unichar")
+					&& checkCharTable<Alnum>("alphanumeric")
+					&& checkCharTable<Space>("whitespace")
+					&& checkCharTable<StringView::CharGroup<CharGroupId::Base64>>("base64")
+					// more runs, than compare-based kernel supports
+					&& checkCharTable<StringView::CharGroup<CharGroupId::TextPunctuation>>(
+							"text punctuation")
+					&& checkCharTable<chars::Compose<char, chars::UniChar, Alnum>>("compose");
+		});
+
+		runTest("read chars", [&] {
+			StringView expected("identifier_with_a_long_name_over_sixteen_bytes");
+			StringView str("  identifier_with_a_long_name_over_sixteen_bytes = value;\n");
+			str.skipChars<Space>();
+			auto id = str.readChars<Alnum, StringView::Chars<'_'>>();
+			str.skipUntil<StringView::Chars<'='>>();
+			str.skipChars<StringView::Chars<'='>, Space>();
+			auto value = str.readUntil<StringView::Chars<';'>>();
+			return SPRT_TEST_CHECK(id == expected)
+					&& SPRT_TEST_CHECK(value == StringView("value"))
+					&& SPRT_TEST_CHECK(str == StringView(";\n"));
+		});
+
+		return _failed == 0;
+	}
+} _CharsTest;
+
+struct CharsBench : Test {
+	static constexpr uint32_t TextSize = 1 << 20;
+
+	CharsBench() : Test("chars", true) { }
+
+	// Words and identifiers, separated with whitespace and punctuation
+	static void fillText(char *buf, uint32_t size) {
+		static const char *s_separators[] = {" ", "  ", ", ", ".\n", " = ", "; ", "\t"};
+
+		Random rnd;
+		uint32_t offset = 0;
+		while (offset < size) {
+			// mostly short words, sometimes long identifiers
+			auto len = ((rnd.next() % 8) == 0) ? 24 + rnd.next() % 64 : 1 + rnd.next() % 10;
+			for (uint32_t i = 0; i < len && offset < size; ++i) {
+				buf[offset++] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+						[rnd.next() % 62];
+			}
+
+			auto sep = s_separators[rnd.next() % (sizeof(s_separators) / sizeof(char *))];
+			while (*sep && offset < size) { buf[offset++] = *sep++; }
+		}
+	}
+
+	virtual bool run() override {
+		const uint64_t count = isFull() ? 200 : 20;
+
+		auto text = new char[TextSize];
+		fillText(text, TextSize);
+
+		runBench("tokenize", count, TextSize, [&] {
+			StringView str(text, TextSize);
+			while (!str.empty()) {
+				str.skipUntil<Alnum>();
+				auto word = str.readChars<Alnum>();
+				doNotOptimize(word);
+			}
+		});
+
+		runBench("tokenize reference", count, TextSize, [&] {
+			auto ptr = text;
+			auto len = size_t(TextSize);
+			while (len > 0) {
+				auto skip = scanReference<Alnum>(ptr, len, false);
+				ptr += skip;
+				len -= skip;
+
+				auto word = scanReference<Alnum>(ptr, len, true);
+				doNotOptimize(ptr);
+				ptr += word;
+				len -= word;
+			}
+		});
+
+		// single run over the whole buffer
+		for (uint32_t i = 0; i < TextSize; ++i) { text[i] = 'a' + char(i % 26); }
+
+		runBench("long run", count, TextSize, [&] {
+			StringView str(text, TextSize);
+			auto word = str.readChars<Alnum>();
+			doNotOptimize(word);
+		});
+
+		runBench("long run reference", count, TextSize, [&] {
+			auto len = scanReference<Alnum>(text, TextSize, true);
+			doNotOptimize(len);
+		});
+
+		delete[] text;
+		return true;
+	}
+} _CharsBench;
+
+} // namespace sprt::test
@@ -0,0 +1,174 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/cxx/atomic>
+#include <sprt/cxx/thread>
+
+namespace sprt::test {
+
+using platform::ClockType;
+
+struct ClockTest : Test {
+	static constexpr uint32_t Threads = 4;
+
+	// Fast clock is allowed to drift from Monotonic between syncs, but not further,
+	// than a step threshold (1ms) plus the slew for an interval
+	static constexpr uint64_t MaxDrift = 2'000'000;
+
+	ClockTest() : Test("clock") { }
+
+	virtual bool run() override {
+		// should cover at least one sync interval (1s)
+		const uint64_t duration = isFull() ? 5'000'000'000 : 1'500'000'000;
+
+		// Fast clock falls back to Monotonic
+		if (platform::getHardwareClockFrequency() == 0) {
+			__sprt_printf("  [skip] %s is not available\n", "invariant hardware clock");
+			return true;
+		}
+
+		// concurrent readers, one of them resyncs the clock, while others read it
+		runTest("fast monotonic", [&] {
+			atomic<uint32_t> backwards(0);
+			thread threads[Threads];
+			for (auto &it : threads) {
+				it = thread([&] {
+					auto end = platform::nanoclock(ClockType::Monotonic) + duration;
+					auto prev = platform::nanoclock(ClockType::Fast);
+					while (prev < end) {
+						auto next = platform::nanoclock(ClockType::Fast);
+						if (next < prev) {
+							++backwards;
+						}
+						prev = next;
+					}
+				});
+			}
+			for (auto &it : threads) { it.join(); }
+			return SPRT_TEST_CHECK(backwards.load() == 0);
+		});
+
+		runTest("fast drift", [&] {
+			uint64_t maxAhead = 0;
+			uint64_t maxBehind = 0;
+
+			// Fast clock is read between two Monotonic reads, every 1ms
+			auto end = platform::nanoclock(ClockType::Monotonic) + duration;
+			uint64_t after = 0;
+			while (after < end) {
+				auto before = platform::nanoclock(ClockType::Monotonic);
+				auto fast = platform::nanoclock(ClockType::Fast);
+				after = platform::nanoclock(ClockType::Monotonic);
+
+				if (fast > after) {
+					maxAhead = max(maxAhead, fast - after);
+				} else if (fast < before) {
+					maxBehind = max(maxBehind, before - fast);
+				}
+
+				platform::sleep(1'000);
+			}
+
+			if (maxAhead > MaxDrift || maxBehind > MaxDrift) {
+				__sprt_printf("  [FAIL] drift: ahead %lluns, behind %lluns\n",
+						(unsigned long long)maxAhead, (unsigned long long)maxBehind);
+				return false;
+			}
+			return true;
+		});
+
+		return _failed == 0;
+	}
+} _ClockTest;
+
+struct ClockBench : Test {
+	struct ClockInfo {
+		ClockType type;
+		const char *name;
+	};
+
+	static constexpr ClockInfo s_clocks[] = {
+		{ClockType::Monotonic, "monotonic"},
+		{ClockType::Realtime, "realtime"},
+		{ClockType::Hardware, "hardware"},
+		{ClockType::Fast, "fast"},
+	};
+
+	ClockBench() : Test("clock", true) { }
+
+	// Per-call cost with `threads` concurrent readers of the same clock
+	void runShared(const ClockInfo &clock, uint32_t threads, uint64_t count) {
+		static constexpr uint32_t MaxThreads = 16;
+
+		atomic<uint32_t> ready(0);
+		atomic<bool> start(false);
+		thread workers[MaxThreads];
+
+		threads = min(threads, MaxThreads);
+		for (uint32_t i = 0; i < threads; ++i) {
+			workers[i] = thread([&] {
+				++ready;
+				while (!start.load()) { __sprt_sched_yield(); }
+				for (uint64_t j = 0; j < count; ++j) {
+					doNotOptimize(platform::nanoclock(clock.type));
+				}
+			});
+		}
+
+		while (ready.load() != threads) { __sprt_sched_yield(); }
+
+		auto t = platform::nanoclock(ClockType::Monotonic);
+		start.store(true);
+		for (uint32_t i = 0; i < threads; ++i) { workers[i].join(); }
+		auto nanos = platform::nanoclock(ClockType::Monotonic) - t;
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "%s %ut", clock.name, threads);
+
+		// all readers run in parallel, report the per-thread cost of a call
+		reportBench(StringView(name, len), count, 0, nanos);
+	}
+
+	virtual bool run() override {
+		const uint64_t count = isFull() ? 100'000'000 : 10'000'000;
+
+		for (auto &it : s_clocks) {
+			runBench(it.name, count, 0, [&] { doNotOptimize(platform::nanoclock(it.type)); });
+		}
+
+		const auto hw = uint32_t(thread::hardware_concurrency());
+		uint32_t threads[] = {2, 4, (hw > 4) ? hw : 0};
+		for (auto t : threads) {
+			if (t != 0) {
+				runShared(s_clocks[0], t, count / 10);
+				runShared(s_clocks[3], t, count / 10);
+			}
+		}
+		return true;
+	}
+} _ClockBench;
+
+} // namespace sprt::test
@@ -0,0 +1,333 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/utils/compress.h>
+#include <sprt/c/__sprt_string.h>
+
+namespace sprt::test {
+
+// Text-like content from a small vocabulary, so blocks are actually compressed
+static void fillWords(uint8_t *buf, size_t size, uint64_t seed) {
+	static constexpr const char *words[] = {"alpha ", "beta ", "gamma ", "delta ", "frame ",
+		"block ", "stream ", "dictionary ", "checksum ", "\n", "0123456789 ", "{\"id\":"};
+
+	Random rnd{seed};
+	size_t offset = 0;
+	while (offset < size) {
+		auto w = words[rnd.next() % (sizeof(words) / sizeof(words[0]))];
+		for (size_t i = 0; w[i] && offset < size; ++i) { buf[offset++] = uint8_t(w[i]); }
+	}
+}
+
+static void fillRandom(uint8_t *buf, size_t size, uint64_t seed) {
+	Random rnd{seed};
+	for (size_t i = 0; i < size; ++i) { buf[i] = uint8_t(rnd.next()); }
+}
+
+struct Lz4Buffer {
+	uint8_t *data = nullptr;
+	size_t size = 0;
+	size_t capacity = 0;
+
+	Lz4Buffer(size_t cap) : data(new uint8_t[cap ? cap : 1]), capacity(cap) { }
+	~Lz4Buffer() { delete[] data; }
+
+	void append(const uint8_t *buf, size_t len) {
+		if (size + len > capacity) {
+			auto tmp = new uint8_t[(size + len) * 2];
+			__sprt_memcpy(tmp, data, size);
+			delete[] data;
+			data = tmp;
+			capacity = (size + len) * 2;
+		}
+		__sprt_memcpy(data + size, buf, len);
+		size += len;
+	}
+};
+
+static bool checkRoundTrip(const uint8_t *src, size_t size, Lz4FrameInfo info,
+		const Lz4Dictionary *dict = nullptr) {
+	if (hasFlag(info.flags, Lz4FrameFlags::ContentSize)) {
+		info.contentSize = size;
+	}
+
+	Lz4Buffer frame(lz4_getFrameBounds(size, info));
+	frame.size = lz4_compressFrame(src, size, frame.data, frame.capacity, info);
+	if (frame.size == 0) {
+		return false;
+	}
+
+	Lz4Buffer out(size);
+	auto ret = lz4_decompressFrame(frame.data, frame.size, out.data, out.capacity, dict);
+	return ret == size && __sprt_memcmp(out.data, src, size) == 0;
+}
+
+struct CompressTest : Test {
+	static constexpr size_t MaxSize = 300'000;
+
+	CompressTest() : Test("compress") { }
+
+	virtual bool run() override {
+		auto text = new uint8_t[MaxSize];
+		auto noise = new uint8_t[MaxSize];
+		fillWords(text, MaxSize, 0x5EED'0017);
+		fillRandom(noise, MaxSize, 0x5EED'0017);
+
+		// around the block boundaries of 64KB blocks
+		const size_t sizes[] = {0, 1, 15, 4'096, 65'535, 65'536, 65'537, 3 * 65'536 + 17,
+			MaxSize};
+
+		runTest("frame flags", [&] {
+			bool success = true;
+			// every combination of LinkedBlocks, BlockChecksum, ContentChecksum and ContentSize
+			for (uint32_t flags = 0; flags < 16; ++flags) {
+				for (auto size : sizes) {
+					Lz4FrameInfo info;
+					info.flags = Lz4FrameFlags(flags);
+					success &= SPRT_TEST_CHECK(checkRoundTrip(text, size, info));
+					success &= SPRT_TEST_CHECK(checkRoundTrip(noise, size, info));
+				}
+			}
+			return success;
+		});
+
+		runTest("frame levels and block sizes", [&] {
+			bool success = true;
+			const Lz4BlockSize blockSizes[] = {Lz4BlockSize::Max64KB, Lz4BlockSize::Max256KB,
+				Lz4BlockSize::Max1MB, Lz4BlockSize::Max4MB};
+			const int levels[] = {0, 1, 9, 12};
+			for (auto blockSize : blockSizes) {
+				for (auto level : levels) {
+					Lz4FrameInfo info;
+					info.blockSize = blockSize;
+					info.level = level;
+					info.flags |= Lz4FrameFlags::LinkedBlocks;
+					success &= SPRT_TEST_CHECK(checkRoundTrip(text, MaxSize, info));
+					success &= SPRT_TEST_CHECK(checkRoundTrip(noise, 65'537, info));
+				}
+			}
+			return success;
+		});
+
+		runTest("streaming chunks", [&] {
+			bool success = true;
+			Random rnd{0x5EED'0018};
+			for (uint32_t iter = 0; iter < 16; ++iter) {
+				Lz4FrameInfo info;
+				info.flags = Lz4FrameFlags(iter % 16);
+				if (hasFlag(info.flags, Lz4FrameFlags::ContentSize)) {
+					info.contentSize = MaxSize;
+				}
+
+				// encoder and decoder receive data in random chunks, down to a single byte
+				Lz4Buffer frame(lz4_getFrameBounds(MaxSize, info));
+				Lz4Encoder encoder(info);
+				auto write = [&](const uint8_t *buf, size_t len) { frame.append(buf, len); };
+				for (size_t offset = 0; offset < MaxSize;) {
+					auto n = sprt::min(size_t(1 + rnd.next() % 100'000), MaxSize - offset);
+					success &=
+							SPRT_TEST_CHECK(encoder.update(text + offset, n, write) == Status::Ok);
+					offset += n;
+				}
+				success &= SPRT_TEST_CHECK(encoder.finalize(write) == Status::Ok);
+
+				Lz4Buffer out(MaxSize);
+				Lz4Decoder decoder;
+				Status status = Status::Ok;
+				for (size_t offset = 0; offset < frame.size && status == Status::Ok;) {
+					auto n = sprt::min(size_t(1 + rnd.next() % (iter < 8 ? 7 : 70'000)),
+							frame.size - offset);
+					size_t consumed = 0;
+					status = decoder.update(frame.data + offset, n,
+							[&](const uint8_t *buf, size_t len) { out.append(buf, len); },
+							&consumed);
+					offset += consumed;
+				}
+				success &= SPRT_TEST_CHECK(status == Status::Done);
+				success &= SPRT_TEST_CHECK(out.size == MaxSize);
+				success &= SPRT_TEST_CHECK(__sprt_memcmp(out.data, text, MaxSize) == 0);
+			}
+			return success;
+		});
+
+		runTest("parallel encoder", [&] {
+			bool success = true;
+			for (auto size : sizes) {
+				Lz4FrameInfo info;
+				info.flags |= Lz4FrameFlags::ContentSize;
+				info.contentSize = size;
+
+				Lz4ParallelEncoder encoder(text, size, info);
+				for (size_t i = 0; i < encoder.getBlockCount(); ++i) {
+					success &= SPRT_TEST_CHECK(encoder.compressBlock(i) == Status::Ok);
+				}
+
+				Lz4Buffer frame(encoder.getFrameSize());
+				success &= SPRT_TEST_CHECK(encoder.write([&](const uint8_t *buf, size_t len) {
+					frame.append(buf, len);
+				}) == Status::Ok);
+				success &= SPRT_TEST_CHECK(frame.size == encoder.getFrameSize());
+
+				Lz4Buffer out(size);
+				success &= SPRT_TEST_CHECK(lz4_decompressFrame(frame.data, frame.size, out.data,
+													out.capacity)
+						== size);
+				success &= SPRT_TEST_CHECK(__sprt_memcmp(out.data, text, size) == 0);
+			}
+			return success;
+		});
+
+		runTest("dictionary", [&] {
+			bool success = true;
+
+			// small similar messages, every one compressed separately
+			static constexpr size_t SampleCount = 256;
+			static constexpr size_t SampleSize = 200;
+			const uint8_t *samples[SampleCount];
+			size_t sampleSizes[SampleCount];
+			for (size_t i = 0; i < SampleCount; ++i) {
+				samples[i] = text + i * 1'000;
+				sampleSizes[i] = SampleSize;
+			}
+
+			uint8_t dictData[4'096];
+			auto dictSize = Lz4Dictionary::train(dictData, sizeof(dictData), samples, sampleSizes,
+					SampleCount);
+			success &= SPRT_TEST_CHECK(dictSize > 0 && dictSize <= sizeof(dictData));
+
+			Lz4Dictionary dict(dictData, dictSize);
+			success &= SPRT_TEST_CHECK(dict.getId() != 0);
+
+			const uint8_t *message = text + MaxSize - 1'000;
+			const int levels[] = {0, 9};
+			for (auto level : levels) {
+				Lz4FrameInfo info;
+				info.level = level;
+				info.dictionary = &dict;
+				success &= SPRT_TEST_CHECK(checkRoundTrip(message, SampleSize, info, &dict));
+
+				// frame refers dictionary id, it can not be decoded without it
+				uint8_t frame[1'024];
+				uint8_t out[SampleSize];
+				auto frameSize = lz4_compressFrame(message, SampleSize, frame, sizeof(frame), info);
+				success &= SPRT_TEST_CHECK(frameSize > 0);
+				success &= SPRT_TEST_CHECK(
+						lz4_decompressFrame(frame, frameSize, out, sizeof(out)) == 0);
+
+				Lz4Dictionary other(dictData, dictSize / 2);
+				success &= SPRT_TEST_CHECK(
+						lz4_decompressFrame(frame, frameSize, out, sizeof(out), &other) == 0);
+
+				// dictionary helps with the small payloads
+				info.dictionary = nullptr;
+				auto plainSize = lz4_compressFrame(message, SampleSize, frame, sizeof(frame), info);
+				success &= SPRT_TEST_CHECK(frameSize < plainSize);
+			}
+
+			// samples are smaller, than dictionary: used as is
+			uint8_t small[1'024];
+			success &= SPRT_TEST_CHECK(
+					Lz4Dictionary::train(small, sizeof(small), samples, sampleSizes, 4) == 800);
+			success &= SPRT_TEST_CHECK(__sprt_memcmp(small, samples[0], SampleSize) == 0);
+
+			// too small to count d-mers
+			const size_t tinySizes[] = {3, 2};
+			success &= SPRT_TEST_CHECK(
+					Lz4Dictionary::train(small, 4, samples, tinySizes, 2) == 0);
+			success &= SPRT_TEST_CHECK(
+					Lz4Dictionary::train(small, 2, samples, sampleSizes, 1) == 0);
+			return success;
+		});
+
+		runTest("corrupt frames", [&] {
+			bool success = true;
+			const size_t size = 3 * 65'536 + 17;
+
+			Lz4FrameInfo info;
+			info.flags = Lz4FrameFlags::BlockChecksum | Lz4FrameFlags::ContentChecksum
+					| Lz4FrameFlags::ContentSize;
+			info.contentSize = size;
+
+			Lz4Buffer frame(lz4_getFrameBounds(size, info));
+			frame.size = lz4_compressFrame(text, size, frame.data, frame.capacity, info);
+			success &= SPRT_TEST_CHECK(frame.size > 0);
+
+			Lz4Buffer out(size);
+			auto decode = [&](const uint8_t *buf, size_t len) {
+				return lz4_decompressFrame(buf, len, out.data, out.capacity);
+			};
+
+			success &= SPRT_TEST_CHECK(decode(frame.data, frame.size) == size);
+
+			// every truncation is rejected
+			for (size_t len = 0; len < frame.size; len += (len < 64 ? 1 : 997)) {
+				success &= SPRT_TEST_CHECK(decode(frame.data, len) == 0);
+			}
+			success &= SPRT_TEST_CHECK(decode(frame.data, frame.size - 1) == 0);
+
+			// any changed byte is detected by header, block or content checksum
+			Random rnd{0x5EED'0019};
+			Lz4Buffer copy(frame.size);
+			copy.append(frame.data, frame.size);
+			for (uint32_t i = 0; i < 256; ++i) {
+				auto pos = (i < 24) ? size_t(i) : size_t(rnd.next() % frame.size);
+				auto bit = uint8_t(1 << (rnd.next() % 8));
+				copy.data[pos] ^= bit;
+				success &= SPRT_TEST_CHECK(decode(copy.data, copy.size) == 0);
+				copy.data[pos] ^= bit;
+			}
+
+			// block size above the frame maximum
+			copy.data[15 + 0] = 0xFF;
+			copy.data[15 + 1] = 0xFF;
+			copy.data[15 + 2] = 0x01;
+			copy.data[15 + 3] = 0x00;
+			success &= SPRT_TEST_CHECK(decode(copy.data, copy.size) == 0);
+
+			// output does not fit into destination
+			success &= SPRT_TEST_CHECK(
+					lz4_decompressFrame(frame.data, frame.size, out.data, size - 1) == 0);
+
+			// without checksums corrupted data can be decoded into garbage, but safely
+			info.flags = Lz4FrameFlags::None;
+			frame.size = lz4_compressFrame(text, size, frame.data, frame.capacity, info);
+			for (uint32_t i = 0; i < 256; ++i) {
+				auto pos = 7 + size_t(rnd.next() % (frame.size - 7));
+				auto value = frame.data[pos];
+				frame.data[pos] = uint8_t(rnd.next());
+				auto ret = decode(frame.data, frame.size);
+				success &= SPRT_TEST_CHECK(ret <= size);
+				frame.data[pos] = value;
+			}
+			return success;
+		});
+
+		delete[] text;
+		delete[] noise;
+		return _failed == 0;
+	}
+} _CompressTest;
+
+} // namespace sprt::test
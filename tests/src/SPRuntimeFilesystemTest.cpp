@@ -0,0 +1,659 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/filesystem/lookup.h>
+#include <sprt/runtime/filesystem/pack.h>
+#include <sprt/runtime/dispatch/task_queue.h>
+#include <sprt/runtime/hash.h>
+#include <sprt/cxx/unordered_map>
+
+#include <sprt/c/__sprt_stdlib.h>
+#include <sprt/c/__sprt_string.h>
+#include <sprt/c/__sprt_unistd.h>
+
+namespace sprt::test {
+
+// Unique directory under /tmp, removed with its content on destruction
+struct TempDir {
+	char path[64] = "/tmp/sprt-test-XXXXXX";
+	filesystem::LocationInfo loc;
+	const filesystem::LocationInterface *iface = filesystem::getDefaultInterface();
+
+	TempDir() {
+		if (::__sprt_mkdtemp(path)) {
+			loc.path = StringView(path);
+			loc.interface = iface;
+		} else {
+			path[0] = 0;
+		}
+	}
+
+	~TempDir() {
+		if (path[0]) {
+			iface->_ftw(loc, StringView(path), [&](StringView p, filesystem::FileType) {
+				iface->_remove(loc, p);
+				return true;
+			}, -1, false);
+		}
+	}
+
+	explicit operator bool() const { return path[0] != 0; }
+
+	Status write(StringView name, const uint8_t *buf, size_t size) {
+		return iface->_write_oneshot(loc, name, buf, size,
+				filesystem::LocationInterface::FileMode, true);
+	}
+
+	bool matches(StringView name, const uint8_t *buf, size_t size) {
+		Status st = Status::Ok;
+		auto f = iface->_open(loc, name, filesystem::OpenFlags::Read, &st);
+		if (!f) {
+			return false;
+		}
+
+		uint8_t tmp[4'096];
+		size_t offset = 0;
+		bool success = true;
+		while (success) {
+			auto ret = iface->_read(f, tmp, sizeof(tmp), nullptr);
+			if (ret == 0 || ret == size_t(-1)) {
+				success = (ret == 0 && offset == size);
+				break;
+			}
+			success = (offset + ret <= size && __sprt_memcmp(buf + offset, tmp, ret) == 0);
+			offset += ret;
+		}
+		iface->_close(f, nullptr);
+		return success;
+	}
+};
+
+static void fillRandom(uint8_t *buf, size_t size, uint64_t seed) {
+	Random rnd{seed};
+	for (size_t i = 0; i < size; ++i) { buf[i] = uint8_t(rnd.next()); }
+}
+
+// Directory tree with `fanout` subdirectories and `files` files in every directory,
+// returns number of the created entries or 0 on failure
+static size_t makeTree(TempDir &dir, StringView path, uint32_t depth, uint32_t fanout,
+		uint32_t files) {
+	if (dir.iface->_mkdir(dir.loc, path, filesystem::LocationInterface::DirMode) != Status::Ok) {
+		return 0;
+	}
+
+	size_t count = 0;
+	char name[256];
+	for (uint32_t i = 0; i < files; ++i) {
+		auto len = __sprt_snprintf(name, sizeof(name), "%.*s/file%u", int(path.size()),
+				path.data(), i);
+		if (dir.write(StringView(name, len), (const uint8_t *)name, len) != Status::Ok) {
+			return 0;
+		}
+		++count;
+	}
+
+	if (depth > 0) {
+		for (uint32_t i = 0; i < fanout; ++i) {
+			auto len = __sprt_snprintf(name, sizeof(name), "%.*s/dir%u", int(path.size()),
+					path.data(), i);
+			auto ret = makeTree(dir, StringView(name, len), depth - 1, fanout, files);
+			if (ret == 0) {
+				return 0;
+			}
+			count += ret + 1;
+		}
+	}
+	return count;
+}
+
+// Order-independent digest of the walk; also checks, that every entry is reported after
+// its directory
+struct FtwDigest {
+	__malloc_flat_unordered_map<uint64_t, uint64_t> seen;
+	size_t count = 0;
+	uint64_t sum = 0;
+	bool ordered = true;
+
+	void add(StringView path, filesystem::FileType type) {
+		auto h = xxh3::hash64(path.data(), path.size());
+		if (!path.empty()) {
+			auto sep = path.rfind('/');
+			auto parent = (sep < path.size()) ? StringView(path.data(), sep) : StringView();
+			if (seen.find(xxh3::hash64(parent.data(), parent.size())) == seen.end()) {
+				ordered = false;
+			}
+		}
+		seen.try_emplace(h, uint64_t(type));
+		sum += h ^ uint64_t(type);
+		++count;
+	}
+
+	bool operator==(const FtwDigest &other) const {
+		return count == other.count && sum == other.sum;
+	}
+};
+
+static FtwDigest walkFtw(TempDir &dir, StringView path, int depth = -1) {
+	FtwDigest digest;
+	dir.iface->_ftw(dir.loc, path, [&](StringView p, filesystem::FileType type) {
+		digest.add(p, type);
+		return true;
+	}, depth, true);
+	return digest;
+}
+
+// Runs performFtw and waits for its completion; `limit` stops the walk after the number
+// of entries
+static Status walkParallel(dispatch::TaskQueue *queue, TempDir &dir, StringView path,
+		FtwDigest &digest, int depth = -1, size_t batchSize = filesystem::FtwBatchSize,
+		size_t limit = Max<size_t>) {
+	bool completed = false;
+	Status result = Status::Pending;
+	auto st = filesystem::performFtw(*queue, dir.loc, path,
+			[&](StringView p, filesystem::FileType type) {
+		digest.add(p, type);
+		return digest.count < limit;
+	}, [&](Status status) {
+		result = status;
+		completed = true;
+	}, depth, batchSize);
+	if (st != Status::Ok) {
+		return st;
+	}
+
+	auto deadline = platform::nanoclock(platform::ClockType::Monotonic) + 30'000'000'000ULL;
+	while (!completed && platform::nanoclock(platform::ClockType::Monotonic) < deadline) {
+		queue->wait(TimeInterval::milliseconds(10));
+	}
+	return completed ? result : Status::ErrorTimerExpired;
+}
+
+static Rc<dispatch::TaskQueue> makeFtwQueue() {
+	return Rc<dispatch::TaskQueue>::create(dispatch::TaskQueueInfo{.name = StringView("FtwTest"),
+		.threadCount = uint16_t(max(uint32_t(thread::hardware_concurrency()), uint32_t(2)))});
+}
+
+struct FilesystemTest : Test {
+	FilesystemTest() : Test("filesystem") { }
+
+	virtual bool run() override {
+		runTest("copy", [&] {
+			TempDir dir;
+			if (!SPRT_TEST_CHECK(dir)) {
+				return false;
+			}
+
+			uint8_t data[10'000];
+			fillRandom(data, sizeof(data), 0x5EED'0010);
+
+			bool success = SPRT_TEST_CHECK(dir.write("a", data, sizeof(data)) == Status::Ok);
+			success &= SPRT_TEST_CHECK(dir.write("b", data, 16) == Status::Ok);
+
+			// existing target is truncated and replaced
+			success &= SPRT_TEST_CHECK(dir.iface->_copy(dir.loc, "a", dir.loc, "b") == Status::Ok);
+			success &= SPRT_TEST_CHECK(dir.matches("b", data, sizeof(data)));
+
+			success &= SPRT_TEST_CHECK(dir.iface->_copy(dir.loc, "b", dir.loc, "c") == Status::Ok);
+			success &= SPRT_TEST_CHECK(dir.matches("c", data, sizeof(data)));
+			return success;
+		});
+
+		runTest("copy onto itself", [&] {
+			TempDir dir;
+			if (!SPRT_TEST_CHECK(dir)) {
+				return false;
+			}
+
+			uint8_t data[4'096];
+			fillRandom(data, sizeof(data), 0x5EED'0011);
+
+			bool success = SPRT_TEST_CHECK(dir.write("a", data, sizeof(data)) == Status::Ok);
+
+			success &= SPRT_TEST_CHECK(dir.iface->_copy(dir.loc, "a", dir.loc, "a")
+					== Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(dir.matches("a", data, sizeof(data)));
+
+			// same file with the other name
+			dir.iface->_mkdir(dir.loc, "sub", filesystem::LocationInterface::DirMode);
+			char from[128], to[128];
+			__sprt_snprintf(from, sizeof(from), "%s/a", dir.path);
+			__sprt_snprintf(to, sizeof(to), "%s/sub/link", dir.path);
+			success &= SPRT_TEST_CHECK(::__sprt_link(from, to) == 0);
+
+			success &= SPRT_TEST_CHECK(dir.iface->_copy(dir.loc, "a", dir.loc, "sub/link")
+					== Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(dir.matches("a", data, sizeof(data)));
+			return success;
+		});
+
+		runTest("performFtw", [&] {
+			TempDir dir;
+			if (!SPRT_TEST_CHECK(dir)) {
+				return false;
+			}
+
+			auto created = makeTree(dir, "tree", 3, 3, 4);
+			if (!SPRT_TEST_CHECK(created > 0)) {
+				return false;
+			}
+
+			auto queue = makeFtwQueue();
+			auto expected = walkFtw(dir, "tree");
+			bool success = SPRT_TEST_CHECK(expected.count == created + 1);
+
+			// small batches to deliver every directory in several parts
+			FtwDigest digest;
+			success &= SPRT_TEST_CHECK(
+					walkParallel(queue, dir, "tree", digest, -1, 7) == Status::Ok);
+			success &= SPRT_TEST_CHECK(digest == expected) && SPRT_TEST_CHECK(digest.ordered);
+
+			for (int depth = 0; depth < 3; ++depth) {
+				FtwDigest limited;
+				auto st = walkParallel(queue, dir, "tree", limited, depth);
+				success &= SPRT_TEST_CHECK(st == Status::Ok)
+						&& SPRT_TEST_CHECK(limited == walkFtw(dir, "tree", depth));
+			}
+
+			FtwDigest stopped;
+			auto st = walkParallel(queue, dir, "tree", stopped, -1, 5, 10);
+			success &= SPRT_TEST_CHECK(st == Status::Suspended)
+					&& SPRT_TEST_CHECK(stopped.count == 10);
+
+			FtwDigest missing;
+			st = walkParallel(queue, dir, "missing", missing);
+			success &= SPRT_TEST_CHECK(st != Status::Ok && st != Status::ErrorTimerExpired);
+
+			queue->cancel();
+			return success;
+		});
+
+		return _failed == 0;
+	}
+} _FilesystemTest;
+
+struct PackSource {
+	const char *path;
+	size_t size;
+	bool text; // compressible content
+};
+
+// Sorted order differs from the walk order: "dir.txt" is before "dir/..."
+static constexpr PackSource s_packSources[] = {
+	{"a.txt", 100, true},
+	{"dir/big.txt", 200'000, true},
+	{"dir/random.bin", 10'000, false},
+	{"dir/sub/x", 10, false},
+	{"dir/sub/y", 5'000, true},
+	{"dir.txt", 20, false},
+	{"empty", 0, false},
+};
+
+static constexpr size_t PackSourceCount = sizeof(s_packSources) / sizeof(PackSource);
+
+// Source files for the pack, data is owned by the set
+struct PackSourceSet {
+	filesystem::AssetPack::SourceFile files[PackSourceCount];
+	uint8_t *data[PackSourceCount] = {nullptr};
+
+	PackSourceSet() {
+		static constexpr char Words[] = "lorem ipsum dolor sit amet consectetur adipiscing ";
+		static constexpr size_t WordsSize = sizeof(Words) - 1;
+
+		for (size_t i = 0; i < PackSourceCount; ++i) {
+			auto &src = s_packSources[i];
+			data[i] = new uint8_t[src.size + 1];
+			if (src.text) {
+				for (size_t j = 0; j < src.size; ++j) { data[i][j] = Words[(j * 7) % WordsSize]; }
+			} else {
+				fillRandom(data[i], src.size, 0x5EED'0100 + i);
+			}
+			files[i].path = StringView(src.path);
+			files[i].data = BytesView(data[i], src.size);
+		}
+	}
+
+	~PackSourceSet() {
+		for (auto it : data) { delete[] it; }
+	}
+};
+
+static Status writePack(const filesystem::AssetPack::SourceFile *files, size_t count,
+		__malloc_vector<uint8_t> &out) {
+	out.clear();
+	return filesystem::AssetPack::write(files, count, [&](const uint8_t *buf, size_t size) {
+		auto offset = out.size();
+		out.resize(offset + size);
+		__sprt_memcpy(out.data() + offset, buf, size);
+	});
+}
+
+static FtwDigest walkPack(const filesystem::AssetPack &pack, StringView path, int depth = -1) {
+	FtwDigest digest;
+	pack.ftw(path, [&](StringView p, filesystem::FileType type) {
+		digest.add(p, type);
+		return true;
+	}, depth, true);
+	return digest;
+}
+
+struct AssetPackTest : Test {
+	AssetPackTest() : Test("asset pack") { }
+
+	virtual bool run() override {
+		PackSourceSet sources;
+
+		__malloc_vector<uint8_t> packData;
+		if (writePack(sources.files, PackSourceCount, packData) != Status::Ok) {
+			__sprt_printf("  [FAIL] asset pack: fail to write pack\n");
+			return false;
+		}
+
+		runTest("round trip", [&] {
+			filesystem::AssetPack pack;
+			if (!SPRT_TEST_CHECK(pack.init(BytesView(packData.data(), packData.size()))
+						== Status::Ok)) {
+				return false;
+			}
+
+			bool success = SPRT_TEST_CHECK(pack.size() == PackSourceCount);
+			bool hasCompressed = false;
+
+			uint8_t *buf = new uint8_t[200'000];
+			for (auto &it : sources.files) {
+				auto entry = pack.find(it.path);
+				if (!SPRT_TEST_CHECK(entry && pack.getPath(entry) == it.path)) {
+					success = false;
+					continue;
+				}
+
+				success &= SPRT_TEST_CHECK(entry->size == it.data.size());
+				success &= SPRT_TEST_CHECK(pack.read(entry, buf, 200'000) == Status::Ok
+						&& __sprt_memcmp(buf, it.data.data(), it.data.size()) == 0);
+
+				if (hasFlag(entry->flags, filesystem::AssetPackEntryFlags::Compressed)) {
+					hasCompressed = true;
+					success &= SPRT_TEST_CHECK(pack.getData(entry).empty());
+				} else {
+					auto data = pack.getData(entry);
+					success &= SPRT_TEST_CHECK(data.size() == it.data.size()
+							&& __sprt_memcmp(data.data(), it.data.data(), data.size()) == 0);
+
+					// large raw entries can be mapped separately
+					if (entry->size >= filesystem::AssetPack::PageSize) {
+						success &= SPRT_TEST_CHECK(
+								entry->offset % filesystem::AssetPack::PageSize == 0);
+					}
+				}
+			}
+			delete[] buf;
+
+			success &= SPRT_TEST_CHECK(hasCompressed);
+
+			success &= SPRT_TEST_CHECK(pack.find("missing") == nullptr);
+			success &= SPRT_TEST_CHECK(pack.find("dir") == nullptr);
+			success &= SPRT_TEST_CHECK(pack.find("dir/sub/") == nullptr);
+			success &= SPRT_TEST_CHECK(pack.isDirectory("dir") && pack.isDirectory("dir/sub"));
+			success &= SPRT_TEST_CHECK(!pack.isDirectory("dir.txt") && !pack.isDirectory("di"));
+			return success;
+		});
+
+		// pack walk should be the same as the walk on the unpacked files
+		runTest("ftw", [&] {
+			TempDir dir;
+			filesystem::AssetPack pack;
+			if (!SPRT_TEST_CHECK(dir)
+					|| !SPRT_TEST_CHECK(pack.init(BytesView(packData.data(), packData.size()))
+							== Status::Ok)) {
+				return false;
+			}
+
+			const char *dirs[] = {"tree", "tree/dir", "tree/dir/sub"};
+			for (auto it : dirs) {
+				dir.iface->_mkdir(dir.loc, StringView(it), filesystem::LocationInterface::DirMode);
+			}
+
+			char name[256];
+			for (auto &it : sources.files) {
+				auto len = __sprt_snprintf(name, sizeof(name), "tree/%.*s", int(it.path.size()),
+						it.path.data());
+				if (!SPRT_TEST_CHECK(dir.write(StringView(name, len), it.data.data(),
+											 it.data.size())
+							== Status::Ok)) {
+					return false;
+				}
+			}
+
+			bool success = true;
+			int depths[] = {-1, 0, 1, 2};
+			for (auto depth : depths) {
+				auto expected = walkFtw(dir, "tree", depth);
+				auto walked = walkPack(pack, StringView(), depth);
+				success &= SPRT_TEST_CHECK(walked == expected && walked.ordered);
+
+				expected = walkFtw(dir, "tree/dir", depth);
+				walked = walkPack(pack, "dir", depth);
+				success &= SPRT_TEST_CHECK(walked == expected && walked.ordered);
+			}
+
+			// file is reported as a root, missing path is not found
+			auto walked = walkPack(pack, "dir/sub/x");
+			success &= SPRT_TEST_CHECK(walked.count == 1);
+			auto st = pack.ftw("dir/missing", [](StringView, filesystem::FileType) { return true; },
+					-1, true);
+			success &= SPRT_TEST_CHECK(st == Status::ErrorNotFound);
+
+			// pack, mapped from the file
+			filesystem::AssetPack mapped;
+			success &= SPRT_TEST_CHECK(dir.write("pack", packData.data(), packData.size())
+					== Status::Ok);
+			success &= SPRT_TEST_CHECK(mapped.init(dir.loc, "pack") == Status::Ok);
+			success &= SPRT_TEST_CHECK(
+					walkPack(mapped, StringView()) == walkPack(pack, StringView()));
+			return success;
+		});
+
+		runTest("invalid paths", [&] {
+			auto check = [&](const char *const *paths, size_t count, Status expected) {
+				filesystem::AssetPack::SourceFile files[4];
+				for (size_t i = 0; i < count; ++i) {
+					files[i].path = StringView(paths[i]);
+					files[i].data = sources.files[0].data;
+				}
+				__malloc_vector<uint8_t> out;
+				return writePack(files, count, out) == expected;
+			};
+
+			const char *duplicate[] = {"a/b", "c", "a/b"};
+			const char *fileAsDir[] = {"a/b", "a/b/c"};
+			// "a/b.txt" is between the file and the directory in the sorted order
+			const char *fileAsDirSplit[] = {"a/b/c", "a/b.txt", "a/b", "a/b-c"};
+			const char *absolute[] = {"/a"};
+			const char *trailing[] = {"a/"};
+			const char *empty[] = {""};
+			const char *siblings[] = {"a/b/c", "a/b.txt", "a/bc", "a/b-c"};
+
+			return SPRT_TEST_CHECK(check(duplicate, 3, Status::ErrorInvalidArguemnt))
+					&& SPRT_TEST_CHECK(check(fileAsDir, 2, Status::ErrorInvalidArguemnt))
+					&& SPRT_TEST_CHECK(check(fileAsDirSplit, 4, Status::ErrorInvalidArguemnt))
+					&& SPRT_TEST_CHECK(check(absolute, 1, Status::ErrorInvalidArguemnt))
+					&& SPRT_TEST_CHECK(check(trailing, 1, Status::ErrorInvalidArguemnt))
+					&& SPRT_TEST_CHECK(check(empty, 1, Status::ErrorInvalidArguemnt))
+					&& SPRT_TEST_CHECK(check(siblings, 4, Status::Ok));
+		});
+
+		runTest("corrupt header", [&] {
+			using Pack = filesystem::AssetPack;
+
+			auto init = [&](const callback<void(uint8_t *, size_t)> &corrupt, size_t size) {
+				__malloc_vector<uint8_t> data(packData);
+				corrupt(data.data(), data.size());
+
+				Pack pack;
+				return pack.init(BytesView(data.data(), min(size, data.size())));
+			};
+
+			auto header = [](uint8_t *data) { return reinterpret_cast<Pack::Header *>(data); };
+			auto entries = [&](uint8_t *data) {
+				return reinterpret_cast<Pack::Entry *>(data + header(data)->entriesOffset);
+			};
+			auto table = [&](uint8_t *data) {
+				return reinterpret_cast<Pack::Slot *>(data + header(data)->tableOffset);
+			};
+
+			auto full = packData.size();
+			bool success = SPRT_TEST_CHECK(init([](uint8_t *, size_t) { }, full) == Status::Ok);
+
+			success &= SPRT_TEST_CHECK(init([](uint8_t *, size_t) { }, sizeof(Pack::Header) - 1)
+					== Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(
+					init([](uint8_t *, size_t) { }, full / 2) == Status::ErrorInvalidArguemnt);
+
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) { header(d)->magic ^= 1; },
+											   full)
+					== Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) { header(d)->version = 2; },
+											   full)
+					== Status::ErrorNotSupported);
+
+			// table should be a power of two, larger than count
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				header(d)->count = header(d)->tableSize;
+			}, full) == Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				header(d)->tableSize += 8;
+			}, full) == Status::ErrorInvalidArguemnt);
+
+			// regions out of the data
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t s) {
+				header(d)->stringsSize = s;
+			}, full) == Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t s) {
+				header(d)->entriesOffset = s - sizeof(Pack::Entry);
+			}, full) == Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				header(d)->tableOffset = Max<uint64_t> - 7;
+			}, full) == Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t s) {
+				entries(d)[1].offset = s - entries(d)[1].storedSize + 1;
+			}, full) == Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t s) {
+				entries(d)[0].path = uint32_t(header(d)->stringsSize);
+			}, full) == Status::ErrorInvalidArguemnt);
+
+			// raw entry ("dir.txt") with the different sizes
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				entries(d)[1].size += 1;
+			}, full) == Status::ErrorInvalidArguemnt);
+
+			// unordered entries
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				auto tmp = entries(d)[0];
+				entries(d)[0] = entries(d)[1];
+				entries(d)[1] = tmp;
+			}, full) == Status::ErrorInvalidArguemnt);
+
+			// index out of entries, no empty slots
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				table(d)[0].index = header(d)->count + 1;
+			}, full) == Status::ErrorInvalidArguemnt);
+			success &= SPRT_TEST_CHECK(init([&](uint8_t *d, size_t) {
+				for (uint32_t i = 0; i < header(d)->tableSize; ++i) { table(d)[i].index = 1; }
+			}, full) == Status::ErrorInvalidArguemnt);
+
+			// misaligned data
+			Pack pack;
+			success &= SPRT_TEST_CHECK(pack.init(BytesView(packData.data() + 1, full - 1))
+					== Status::ErrorInvalidArguemnt);
+			return success;
+		});
+
+		return _failed == 0;
+	}
+} _AssetPackTest;
+
+struct FilesystemBench : Test {
+	FilesystemBench() : Test("filesystem", true) { }
+
+	virtual bool run() override {
+		TempDir dir;
+		if (!dir) {
+			__sprt_printf("  [FAIL] fail to create temporary directory\n");
+			return false;
+		}
+
+		struct BenchCase {
+			const char *name;
+			size_t size;
+			uint64_t count;
+		} cases[] = {
+			{"copy 4KiB", 4 * 1'024, 2'000},
+			{"copy 256KiB", 256 * 1'024, 500},
+			{"copy 16MiB", 16 * 1'024 * 1'024, 20},
+			{"copy 128MiB", 128 * 1'024 * 1'024, 3},
+		};
+
+		bool success = true;
+		for (auto &c : cases) {
+			auto data = new uint8_t[c.size];
+			fillRandom(data, c.size, 0x5EED'0012);
+			success &= dir.write("source", data, c.size) == Status::Ok;
+			delete[] data;
+
+			runBench(StringView(c.name), c.count, c.size, [&] {
+				success &= dir.iface->_copy(dir.loc, "source", dir.loc, "target") == Status::Ok;
+			});
+
+			dir.iface->_unlink(dir.loc, "target");
+		}
+
+		// deep synthetic tree: 364 directories, 8 files in every one
+		auto created = makeTree(dir, "tree", 5, 3, 8);
+		if (created == 0) {
+			__sprt_printf("  [FAIL] fail to create directory tree\n");
+			return false;
+		}
+
+		size_t entries = 0;
+		runBench("ftw tree", 20, 0, [&] {
+			entries = walkFtw(dir, "tree").count;
+			success &= (entries == created + 1);
+		});
+
+		auto queue = makeFtwQueue();
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "performFtw tree %ut",
+				uint32_t(queue->getInfo().threadCount));
+		runBench(StringView(name, len), 20, 0, [&] {
+			FtwDigest digest;
+			success &= walkParallel(queue, dir, "tree", digest) == Status::Ok
+					&& digest.count == created + 1;
+		});
+		queue->cancel();
+
+		return success;
+	}
+} _FilesystemBench;
+
+} // namespace sprt::test
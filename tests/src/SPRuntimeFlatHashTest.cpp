@@ -0,0 +1,220 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/cxx/unordered_map>
+
+namespace sprt::test {
+
+using FlatMap = __malloc_flat_unordered_map<uint64_t, uint64_t>;
+using ChainedMap = __malloc_unordered_map<uint64_t, uint64_t>;
+
+struct FlatHashTest : Test {
+	static constexpr size_t Capacity = 16;
+	static constexpr size_t MaxKeys = 12; // below the max load factor for Capacity
+
+	FlatHashTest() : Test("flat_hash") { }
+
+	static size_t getHome(uint64_t key) {
+		return (FlatMap::container_type::mix(FlatMap::hasher()(key)) >> 7) & (Capacity - 1);
+	}
+
+	static bool contains(const uint64_t *keys, size_t count, uint64_t key) {
+		for (size_t i = 0; i < count; ++i) {
+			if (keys[i] == key) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Erases random entries during iteration over a table with a cluster, that wraps
+	// from the last slots to the first ones; every entry should be visited exactly once
+	bool runWrapped(Random &rnd) {
+		FlatMap m(Capacity);
+
+		uint64_t keys[MaxKeys];
+		size_t nkeys = 0;
+		size_t nwrap = 2 + rnd.next() % 6;
+		size_t nother = rnd.next() % 5;
+
+		for (uint64_t k = rnd.next() % 100'000; nkeys < nwrap; ++k) {
+			if (getHome(k) >= Capacity - 3) {
+				keys[nkeys++] = k;
+			}
+		}
+		for (uint64_t k = rnd.next() % 100'000 + 200'000; nkeys < nwrap + nother; ++k) {
+			keys[nkeys++] = k;
+		}
+
+		for (size_t i = 0; i < nkeys; ++i) { m.try_emplace(keys[i], keys[i]); }
+		if (!SPRT_TEST_CHECK(m.size() == nkeys)) {
+			return false;
+		}
+
+		uint64_t visited[MaxKeys];
+		uint64_t erased[MaxKeys];
+		size_t nvisited = 0;
+		size_t nerased = 0;
+
+		for (auto it = m.begin(); it != m.end();) {
+			if (!SPRT_TEST_CHECK(!contains(visited, nvisited, it->first))
+					|| !SPRT_TEST_CHECK(nvisited < nkeys)) {
+				return false;
+			}
+			visited[nvisited++] = it->first;
+			if (rnd.next() % 2) {
+				erased[nerased++] = it->first;
+				it = m.erase(it);
+			} else {
+				++it;
+			}
+		}
+
+		bool success = SPRT_TEST_CHECK(nvisited == nkeys);
+		for (size_t i = 0; i < nkeys; ++i) {
+			auto found = m.find(keys[i]) != m.end();
+			success &= SPRT_TEST_CHECK(found != contains(erased, nerased, keys[i]));
+		}
+		success &= SPRT_TEST_CHECK(m.size() == nkeys - nerased);
+
+		size_t n = 0;
+		auto it = m.end();
+		while (it != m.begin()) {
+			--it;
+			++n;
+		}
+		success &= SPRT_TEST_CHECK(n == m.size());
+		return success;
+	}
+
+	// Random insert/erase churn compared with the chained backend, then a sweep, that erases
+	// odd keys during iteration
+	bool runChurn(Random &rnd, uint64_t range) {
+		FlatMap m;
+		ChainedMap ref;
+
+		for (uint32_t i = 0; i < 50'000; ++i) {
+			auto k = rnd.next() % range;
+			if (rnd.next() % 3 == 0) {
+				m.try_emplace(k, i);
+				ref.try_emplace(k, i);
+			} else {
+				m.erase(k);
+				ref.erase(k);
+			}
+		}
+
+		bool success = SPRT_TEST_CHECK(m.size() == ref.size());
+		for (auto &it : ref) {
+			auto f = m.find(it.first);
+			success &= SPRT_TEST_CHECK(f != m.end() && f->second == it.second);
+		}
+
+		size_t visited = 0;
+		for (auto it = m.begin(); it != m.end();) {
+			++visited;
+			if (it->first & 1) {
+				ref.erase(it->first);
+				it = m.erase(it);
+			} else {
+				++it;
+			}
+		}
+		success &= SPRT_TEST_CHECK(visited <= range);
+		success &= SPRT_TEST_CHECK(m.size() == ref.size());
+		for (auto &it : ref) { success &= SPRT_TEST_CHECK(m.find(it.first) != m.end()); }
+
+		size_t n = 0;
+		for (auto &it : m) {
+			success &= SPRT_TEST_CHECK((it.first & 1) == 0);
+			++n;
+		}
+		success &= SPRT_TEST_CHECK(n == ref.size());
+		return success;
+	}
+
+	virtual bool run() override {
+		runTest("erase in wrapped cluster", [&] {
+			Random rnd;
+			uint32_t count = isFull() ? 1'000'000 : 20'000;
+			for (uint32_t i = 0; i < count; ++i) {
+				if (!runWrapped(rnd)) {
+					return false;
+				}
+			}
+			return true;
+		});
+
+		runTest("churn", [&] {
+			Random rnd;
+			for (uint32_t i = 0; i < 40; ++i) {
+				if (!runChurn(rnd, 16 << (i % 10))) {
+					return false;
+				}
+			}
+			return true;
+		});
+
+		return _failed == 0;
+	}
+} _FlatHashTest;
+
+struct FlatHashBench : Test {
+	static constexpr size_t Count = 1'000'000;
+
+	FlatHashBench() : Test("flat_hash", true) { }
+
+	template <typename Map>
+	void runMap(StringView name, const uint64_t *keys) {
+		char buf[64];
+		auto bench = [&](StringView op, const auto &cb) {
+			auto len = __sprt_snprintf(buf, sizeof(buf), "%.*s %.*s", int(name.size()),
+					name.data(), int(op.size()), op.data());
+			size_t i = 0;
+			runBench(StringView(buf, len), Count, 0, [&] { cb(i++); });
+		};
+
+		Map m;
+		uint64_t sum = 0;
+		bench("insert", [&](size_t i) { m.try_emplace(keys[i], i); });
+		bench("find hit", [&](size_t i) { sum += m.find(keys[i])->second; });
+		bench("find miss", [&](size_t i) { sum += (m.find(~keys[i]) == m.end()); });
+		bench("erase", [&](size_t i) { m.erase(keys[i]); });
+		doNotOptimize(sum);
+	}
+
+	virtual bool run() override {
+		auto keys = new uint64_t[Count];
+		Random rnd;
+		for (size_t i = 0; i < Count; ++i) { keys[i] = rnd.next(); }
+
+		runMap<FlatMap>("flat", keys);
+		runMap<ChainedMap>("chained", keys);
+
+		delete[] keys;
+		return true;
+	}
+} _FlatHashBench;
+
+} // namespace sprt::test
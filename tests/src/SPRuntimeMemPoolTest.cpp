@@ -0,0 +1,145 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/mem/pool.h>
+#include <sprt/cxx/atomic>
+#include <sprt/cxx/thread>
+
+namespace sprt::test {
+
+static constexpr uint32_t MaxPoolThreads = 16;
+
+// Runs `cb(index)` on `count` threads, released at once; returns wall time in nanoseconds
+template <typename Callback>
+static uint64_t runPoolThreads(uint32_t count, const Callback &cb) {
+	atomic<uint32_t> ready(0);
+	atomic<bool> start(false);
+	thread threads[MaxPoolThreads];
+
+	count = min(count, MaxPoolThreads);
+	for (uint32_t i = 0; i < count; ++i) {
+		threads[i] = thread([&, i] {
+			++ready;
+			while (!start.load()) { __sprt_sched_yield(); }
+			cb(i);
+		});
+	}
+
+	while (ready.load() != count) { __sprt_sched_yield(); }
+
+	auto t = platform::nanoclock(platform::ClockType::Monotonic);
+	start.store(true);
+	for (uint32_t i = 0; i < count; ++i) { threads[i].join(); }
+	return platform::nanoclock(platform::ClockType::Monotonic) - t;
+}
+
+// Request-like pool usage: a few small allocations, then clear, nodes go back to the allocator
+static void runPoolCycles(memory::allocator_t *alloc, uint32_t cycles) {
+	auto pool = memory::pool::create(alloc);
+	for (uint32_t i = 0; i < cycles; ++i) {
+		for (uint32_t j = 0; j < 16; ++j) {
+			auto ptr = memory::pool::palloc(pool, 1'024 + j * 512);
+			doNotOptimize(ptr);
+		}
+		memory::pool::clear(pool);
+	}
+	memory::pool::destroy(pool);
+}
+
+struct MemPoolTest : Test {
+	static constexpr uint32_t Threads = 4;
+
+	MemPoolTest() : Test("mem pool") { }
+
+	virtual bool run() override {
+		// allocator is destroyed, while other threads still have its nodes in their caches,
+		// then the new one (likely at the same address) is used by the same threads
+		runTest("allocator handoff", [&] {
+			atomic<memory::allocator_t *> alloc = memory::allocator::create();
+			atomic<uint32_t> phase(0);
+			atomic<uint32_t> arrived(0);
+			atomic<uint32_t> done(0);
+
+			thread threads[Threads];
+			for (uint32_t i = 0; i < Threads; ++i) {
+				threads[i] = thread([&] {
+					runPoolCycles(alloc.load(), 100);
+					++arrived;
+					while (phase.load() == 0) { __sprt_sched_yield(); }
+					runPoolCycles(alloc.load(), 100);
+					++done;
+				});
+			}
+
+			while (arrived.load() != Threads) { __sprt_sched_yield(); }
+			memory::allocator::destroy(alloc.load());
+			alloc.store(memory::allocator::create());
+			phase.store(1);
+
+			for (auto &it : threads) { it.join(); }
+			memory::allocator::destroy(alloc.load());
+			return SPRT_TEST_CHECK(done.load() == Threads);
+		});
+
+		return _failed == 0;
+	}
+} _MemPoolTest;
+
+struct MemPoolBench : Test {
+	MemPoolBench() : Test("mem pool", true) { }
+
+	void runShared(const char *mode, bool cached, uint32_t threads, uint32_t cycles) {
+		auto alloc = memory::allocator::create();
+		if (!cached) {
+			// limited allocator bypasses the thread cache
+			memory::allocator::max_free_set(alloc, 1 << 30);
+		}
+
+		auto nanos = runPoolThreads(threads, [&](uint32_t) { runPoolCycles(alloc, cycles); });
+		memory::allocator::destroy(alloc);
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "shared %s %ut", mode, threads);
+		reportBench(StringView(name, len), uint64_t(threads) * cycles, 0, nanos);
+	}
+
+	virtual bool run() override {
+		const uint32_t cycles = isFull() ? 200'000 : 20'000;
+
+		const auto hw = uint32_t(thread::hardware_concurrency());
+		uint32_t threads[] = {1, 2, 4, 8, (hw > 8) ? min(hw, MaxPoolThreads) : 0};
+
+		for (auto t : threads) {
+			if (t == 0) {
+				continue;
+			}
+			runShared("cached", true, t, cycles);
+			runShared("locked", false, t, cycles);
+		}
+		return true;
+	}
+} _MemPoolBench;
+
+} // namespace sprt::test
@@ -0,0 +1,270 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/thread/qmutex.h>
+#include <sprt/runtime/thread/rmutex.h>
+#include <sprt/cxx/atomic>
+#include <sprt/cxx/thread>
+#include <sprt/cxx/condition_variable>
+
+namespace sprt::test {
+
+static constexpr uint32_t MaxMutexThreads = 64;
+
+// Runs `cb(index)` on `count` threads, released at once; returns wall time in nanoseconds
+template <typename Callback>
+static uint64_t runThreads(uint32_t count, const Callback &cb) {
+	atomic<uint32_t> ready(0);
+	atomic<bool> start(false);
+	thread threads[MaxMutexThreads];
+
+	count = min(count, MaxMutexThreads);
+	for (uint32_t i = 0; i < count; ++i) {
+		threads[i] = thread([&, i] {
+			++ready;
+			while (!start.load()) { __sprt_sched_yield(); }
+			cb(i);
+		});
+	}
+
+	while (ready.load() != count) { __sprt_sched_yield(); }
+
+	auto t = platform::nanoclock(platform::ClockType::Monotonic);
+	start.store(true);
+	for (uint32_t i = 0; i < count; ++i) { threads[i].join(); }
+	return platform::nanoclock(platform::ClockType::Monotonic) - t;
+}
+
+// Some work without memory access, `rounds` of splitmix64
+static uint64_t spinWork(uint64_t state, uint32_t rounds) {
+	Random rnd{state};
+	for (uint32_t i = 0; i < rounds; ++i) { state ^= rnd.next(); }
+	doNotOptimize(state);
+	return state;
+}
+
+struct MutexTest : Test {
+	static constexpr uint32_t Threads = 4;
+
+	MutexTest() : Test("mutex") { }
+
+	virtual bool run() override {
+		const uint32_t iterations = isFull() ? 1'000'000 : 100'000;
+
+		runTest("qmutex counter", [&] {
+			qmutex mutex;
+			uint64_t counter = 0;
+			runThreads(Threads, [&](uint32_t) {
+				for (uint32_t i = 0; i < iterations; ++i) {
+					mutex.lock();
+					++counter;
+					mutex.unlock();
+				}
+			});
+			return SPRT_TEST_CHECK(counter == uint64_t(Threads) * iterations)
+					&& SPRT_TEST_CHECK(mutex.try_lock()) && SPRT_TEST_CHECK(!mutex.try_lock());
+		});
+
+		runTest("rmutex counter", [&] {
+			rmutex mutex;
+			uint64_t counter = 0;
+			runThreads(Threads, [&](uint32_t) {
+				for (uint32_t i = 0; i < iterations; ++i) {
+					mutex.lock();
+					if (i % 16 == 0) {
+						// recursion should not be affected by the spin phase
+						mutex.lock();
+						++counter;
+						mutex.unlock();
+					} else {
+						++counter;
+					}
+					mutex.unlock();
+				}
+			});
+			return SPRT_TEST_CHECK(counter == uint64_t(Threads) * iterations);
+		});
+
+		runTest("qmutex lock_any", [&] {
+			static constexpr uint32_t Count = 3;
+
+			qmutex mutexes[Count];
+			qmutex *list[Count] = {&mutexes[0], &mutexes[1], &mutexes[2]};
+			uint64_t counters[Count] = {0};
+			atomic<uint32_t> invalid(0);
+
+			runThreads(Threads, [&](uint32_t) {
+				for (uint32_t i = 0; i < iterations / 4; ++i) {
+					auto idx = qmutex::lock_any(list, Count);
+					if (idx < 0 || idx >= int(Count)) {
+						++invalid;
+						continue;
+					}
+					++counters[idx];
+					spinWork(i, 8);
+					mutexes[idx].unlock();
+				}
+			});
+
+			bool success = SPRT_TEST_CHECK(invalid.load() == 0);
+			success &= SPRT_TEST_CHECK(counters[0] + counters[1] + counters[2]
+					== uint64_t(Threads) * (iterations / 4));
+
+			// only the free one should be taken
+			for (auto &it : mutexes) { success &= SPRT_TEST_CHECK(it.try_lock()); }
+			mutexes[1].unlock();
+			success &= SPRT_TEST_CHECK(qmutex::lock_any(list, Count) == 1);
+			for (auto &it : mutexes) { it.unlock(); }
+
+			success &= SPRT_TEST_CHECK(qmutex::lock_any(list, 0) < 0);
+			return success;
+		});
+
+		return _failed == 0;
+	}
+} _MutexTest;
+
+/*
+	Lock contention: every thread takes the same lock in a loop, `hold` is a work within the
+	critical section, `gap` is a work between the locks. Short critical sections should be served
+	with the spin phase, long ones should park the threads almost immediately.
+*/
+struct MutexBench : Test {
+	MutexBench() : Test("mutex", true) { }
+
+	struct BenchCase {
+		const char *name;
+		uint32_t hold;
+		uint32_t gap;
+	};
+
+	template <typename Mutex>
+	void runContention(const char *mutexName, uint32_t threads, const BenchCase &c,
+			uint32_t iterations) {
+		Mutex mutex;
+		uint64_t shared = 0;
+		auto nanos = runThreads(threads, [&](uint32_t idx) {
+			uint64_t local = idx;
+			for (uint32_t i = 0; i < iterations; ++i) {
+				mutex.lock();
+				shared = spinWork(shared, c.hold);
+				mutex.unlock();
+				local = spinWork(local, c.gap);
+			}
+			doNotOptimize(local);
+		});
+		doNotOptimize(shared);
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "%s %s %ut", mutexName, c.name, threads);
+		reportBench(StringView(name, len), uint64_t(threads) * iterations, 0, nanos);
+	}
+
+	// Token is passed around the ring of threads with a single condition variable (qcondvar),
+	// every handoff is a notify and a wakeup of the next thread; two threads with notify_one
+	// is a classic ping-pong, larger rings use notify_all, and other threads wake up in vain
+	void runCondvarRing(uint32_t threads, uint32_t rounds) {
+		mutex m;
+		condition_variable cv;
+		uint32_t turn = 0;
+		const uint32_t total = threads * rounds;
+		auto nanos = runThreads(threads, [&](uint32_t idx) {
+			unique_lock<mutex> lock(m);
+			while (true) {
+				cv.wait(lock, [&] { return turn >= total || turn % threads == idx; });
+				if (turn >= total) {
+					break;
+				}
+				++turn;
+				if (threads == 2) {
+					cv.notify_one();
+				} else {
+					cv.notify_all();
+				}
+			}
+		});
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "qcondvar %s %ut",
+				(threads == 2) ? "ping-pong" : "ring", threads);
+		reportBench(StringView(name, len), total, 0, nanos);
+	}
+
+	virtual bool run() override {
+		const uint32_t iterations = isFull() ? 200'000 : 50'000;
+
+		BenchCase cases[] = {
+			{"short", 1, 16},
+			{"medium", 64, 64},
+			{"long", 2'048, 256},
+		};
+
+		// all hardware threads, if there are more than the fixed counts
+		const auto hw = uint32_t(thread::hardware_concurrency());
+		uint32_t threads[] = {1, 2, 4, 8, (hw > 8) ? min(hw, MaxMutexThreads) : 0};
+
+		for (auto &c : cases) {
+			for (auto t : threads) {
+				if (t == 0) {
+					continue;
+				}
+				auto n = (c.hold > 256) ? iterations / 16 : iterations;
+				runContention<qmutex>("qmutex", t, c, n);
+				runContention<rmutex>("rmutex", t, c, n);
+			}
+		}
+
+		// lock_any spreads threads over several locks
+		static constexpr uint32_t Count = 4;
+		qmutex mutexes[Count];
+		qmutex *list[Count] = {&mutexes[0], &mutexes[1], &mutexes[2], &mutexes[3]};
+		const uint32_t threadCount = max(min(hw, MaxMutexThreads), uint32_t(2));
+		auto nanos = runThreads(threadCount, [&](uint32_t idx) {
+			uint64_t local = idx;
+			for (uint32_t i = 0; i < iterations; ++i) {
+				auto lock = qmutex::lock_any(list, Count);
+				if (lock >= 0) {
+					local = spinWork(local, 64);
+					mutexes[lock].unlock();
+				}
+			}
+			doNotOptimize(local);
+		});
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "qmutex lock_any(4) medium %ut",
+				threadCount);
+		reportBench(StringView(name, len), uint64_t(threadCount) * iterations, 0, nanos);
+
+		for (auto t : threads) {
+			if (t > 1) {
+				runCondvarRing(t, iterations / 50);
+			}
+		}
+		return true;
+	}
+} _MutexBench;
+
+} // namespace sprt::test
@@ -0,0 +1,303 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/string.h>
+#include <sprt/cxx/bit>
+
+namespace sprt::test {
+
+struct DoubleVector {
+	const char *str;
+	uint64_t bits;
+};
+
+struct FloatVector {
+	const char *str;
+	uint32_t bits;
+};
+
+// Expected values from glibc strtod/strtof
+static constexpr DoubleVector s_doubleVectors[] = {
+	{"0.1", 0x3FB9'9999'9999'999A},
+	{"1e23", 0x44B5'2D02'C7E1'4AF6},
+	{"8.98846567431158e307", 0x7FE0'0000'0000'0000},
+	{"2.2250738585072011e-308", 0x000F'FFFF'FFFF'FFFF},
+	{"2.2250738585072014e-308", 0x0010'0000'0000'0000},
+	{"4.9e-324", 0x0000'0000'0000'0001},
+	{"2.4703282292062327e-324", 0x0000'0000'0000'0000},
+	{"2.4703282292062328e-324", 0x0000'0000'0000'0001},
+	{"1.7976931348623157e308", 0x7FEF'FFFF'FFFF'FFFF},
+	{"1.7976931348623158e308", 0x7FEF'FFFF'FFFF'FFFF},
+	{"9007199254740993", 0x4340'0000'0000'0000},
+	{"9007199254740993.0000000000000000001", 0x4340'0000'0000'0001},
+	{"0.1000000000000000055511151231257827021181583404541015625", 0x3FB9'9999'9999'999A},
+	{"123456789012345678901234567890", 0x45F8'EE90'FF6C'373E},
+	{"7.2057594037927933e16", 0x4370'0000'0000'0000},
+	{"1e-400", 0x0000'0000'0000'0000},
+	{"1e400", 0x7FF0'0000'0000'0000},
+	{"-0.0", 0x8000'0000'0000'0000},
+	{"3.0e-45", 0x36B1'2081'41E9'900B},
+	{"0.000000000000000000000000000000000000000000001", 0x3696'D601'AD37'6AB9},
+};
+
+static constexpr FloatVector s_floatVectors[] = {
+	{"0.1", 0x3DCC'CCCD},
+	{"1.17549435e-38", 0x0080'0000},
+	{"1.4e-45", 0x0000'0001},
+	{"7.0e-46", 0x0000'0000},
+	{"3.4028235e38", 0x7F7F'FFFF},
+	{"3.4028236e38", 0x7F80'0000},
+	{"16777217", 0x4B80'0000},
+	{"16777219", 0x4B80'0002},
+	{"1.00000005960464477539062500001", 0x3F80'0001},
+	{"1e39", 0x7F80'0000},
+};
+
+struct NumberTest : Test {
+	NumberTest() : Test("number") { }
+
+	// formats value with dtoa and reads it back, result should be bitwise equal
+	template <typename T, typename Bits>
+	static bool roundTrip(T value) {
+		char buf[DOUBLE_MAX_DIGITS];
+		auto len = sprt::dtoa(value, buf, DOUBLE_MAX_DIGITS);
+		if (len != sprt::dtoa(value, (char *)nullptr, 0)) {
+			return false;
+		}
+
+		StringView str(buf + DOUBLE_MAX_DIGITS - len, len);
+		Result<T> ret;
+		if constexpr (sizeof(T) == sizeof(float)) {
+			ret = str.readFloat();
+		} else {
+			ret = str.readDouble();
+		}
+		if (!ret.valid() || !str.empty()) {
+			return false;
+		}
+		if (isnan(value)) {
+			return isnan(ret.get());
+		}
+		return bit_cast<Bits>(ret.get()) == bit_cast<Bits>(value);
+	}
+
+	static bool roundTrip(int64_t value) {
+		char buf[INT_MAX_DIGITS];
+		auto len = sprt::itoa(value, buf, INT_MAX_DIGITS);
+		StringView str(buf + INT_MAX_DIGITS - len, len);
+		auto ret = str.readInteger();
+		return ret.valid() && str.empty() && ret.get() == value;
+	}
+
+	virtual bool run() override {
+		runTest("double vectors", [&] {
+			bool success = true;
+			for (auto &it : s_doubleVectors) {
+				auto ret = StringView(it.str).readDouble();
+				success &= SPRT_TEST_CHECK(ret.valid() && bit_cast<uint64_t>(ret.get()) == it.bits);
+			}
+			return success;
+		});
+
+		runTest("float vectors", [&] {
+			bool success = true;
+			for (auto &it : s_floatVectors) {
+				auto ret = StringView(it.str).readFloat();
+				success &= SPRT_TEST_CHECK(ret.valid() && bit_cast<uint32_t>(ret.get()) == it.bits);
+			}
+			return success;
+		});
+
+		runTest("integer parsing", [&] {
+			bool success = true;
+			success &= SPRT_TEST_CHECK(
+					StringView("9223372036854775807").readInteger().get(0) == Max<int64_t>);
+			success &= SPRT_TEST_CHECK(
+					StringView("-9223372036854775808").readInteger().get(0) == Min<int64_t>);
+
+			// saturates on overflow
+			success &= SPRT_TEST_CHECK(
+					StringView("9223372036854775808").readInteger().get(0) == Max<int64_t>);
+			success &= SPRT_TEST_CHECK(
+					StringView("-99999999999999999999999").readInteger().get(0) == Min<int64_t>);
+
+			// stops on the first non-digit
+			StringView str("12345678901234567x");
+			success &= SPRT_TEST_CHECK(str.readInteger().get(0) == 12'345'678'901'234'567);
+			success &= SPRT_TEST_CHECK(str == "x");
+
+			success &= SPRT_TEST_CHECK(StringView("0x1F").readInteger().get(0) == 0x1F);
+			success &= SPRT_TEST_CHECK(StringView("777").readInteger(8).get(0) == 0777);
+
+			success &= SPRT_TEST_CHECK(!StringView("").readInteger().valid());
+			success &= SPRT_TEST_CHECK(!StringView("-").readInteger().valid());
+			success &= SPRT_TEST_CHECK(!StringView("x1").readInteger().valid());
+			success &= SPRT_TEST_CHECK(!StringView("").readDouble().valid());
+			success &= SPRT_TEST_CHECK(!StringView(".").readDouble().valid());
+			success &= SPRT_TEST_CHECK(!StringView("e5").readDouble().valid());
+			return success;
+		});
+
+		runTest("leading whitespace", [&] {
+			bool success = true;
+
+			// each read consumes whitespace before the number and the number itself
+			StringView str(" 12\t -3\n\r 4.5  0.25e1 x");
+			success &= SPRT_TEST_CHECK(str.readInteger().get(0) == 12);
+			success &= SPRT_TEST_CHECK(str == "\t -3\n\r 4.5  0.25e1 x");
+			success &= SPRT_TEST_CHECK(str.readInteger().get(0) == -3);
+			success &= SPRT_TEST_CHECK(str.readDouble().get(0.0) == 4.5);
+			success &= SPRT_TEST_CHECK(str.readFloat().get(0.0f) == 2.5f);
+			success &= SPRT_TEST_CHECK(str == " x");
+
+			// view is not changed on failure
+			success &= SPRT_TEST_CHECK(!str.readInteger().valid());
+			success &= SPRT_TEST_CHECK(!str.readDouble().valid());
+			success &= SPRT_TEST_CHECK(str == " x");
+
+			StringViewUtf8 utf8("  7 8.5");
+			success &= SPRT_TEST_CHECK(utf8.readInteger().get(0) == 7);
+			success &= SPRT_TEST_CHECK(utf8.readDouble().get(0.0) == 8.5);
+			success &= SPRT_TEST_CHECK(utf8.empty());
+			return success;
+		});
+
+		runTest("integer round-trip", [&] {
+			bool success = true;
+			int64_t pow10 = 1;
+			for (int i = 0; i < 19; ++i, pow10 *= 10) {
+				success &= SPRT_TEST_CHECK(roundTrip(pow10));
+				success &= SPRT_TEST_CHECK(roundTrip(pow10 - 1));
+				success &= SPRT_TEST_CHECK(roundTrip(-pow10));
+				success &= SPRT_TEST_CHECK(roundTrip(-pow10 + 1));
+			}
+			success &= SPRT_TEST_CHECK(roundTrip(Max<int64_t>));
+			success &= SPRT_TEST_CHECK(roundTrip(Min<int64_t>));
+
+			Random rnd;
+			for (uint32_t i = 0; i < 1'000'000 && success; ++i) {
+				auto v = rnd.next();
+				// uniform over the number of digits
+				success &= SPRT_TEST_CHECK(roundTrip(int64_t(v) >> (v % 64)));
+			}
+			return success;
+		});
+
+		runTest("double round-trip", [&] {
+			bool success = true;
+			const double special[] = {0.0, -0.0, 1.0, -1.0, 1.05, 1.005e100, 5e-324,
+				2.2250738585072014e-308, 1.7976931348623157e308, Infinity<double>,
+				-Infinity<double>, NaN<double>};
+			for (auto v : special) { success &= SPRT_TEST_CHECK((roundTrip<double, uint64_t>(v))); }
+
+			Random rnd;
+			uint32_t count = isFull() ? 1'000'000'000 : 2'000'000;
+			for (uint32_t i = 0; i < count && success; ++i) {
+				success &= SPRT_TEST_CHECK(
+						(roundTrip<double, uint64_t>(bit_cast<double>(rnd.next()))));
+			}
+			return success;
+		});
+
+		// every float value with --full
+		runTest("float round-trip", [&] {
+			bool success = true;
+			uint64_t step = isFull() ? 1 : 4'099;
+			for (uint64_t bits = 0; bits <= Max<uint32_t> && success; bits += step) {
+				success &= SPRT_TEST_CHECK(
+						(roundTrip<float, uint32_t>(bit_cast<float>(uint32_t(bits)))));
+			}
+			return success;
+		});
+
+		return _failed == 0;
+	}
+} _NumberTest;
+
+struct NumberBench : Test {
+	static constexpr size_t Count = 100'000;
+
+	NumberBench() : Test("number", true) { }
+
+	virtual bool run() override {
+		// formatted numbers, prefixed with spaces
+		auto doubles = new char[Count * (DOUBLE_MAX_DIGITS + 1)];
+		auto integers = new char[Count * (INT_MAX_DIGITS + 1)];
+		size_t doublesLen = 0;
+		size_t integersLen = 0;
+
+		Random rnd;
+		for (size_t i = 0; i < Count; ++i) {
+			auto v = rnd.next();
+
+			// with the exact length, number is written from the start of the buffer
+			auto d = double(v >> 11) * 0x1p-53 * 1e6;
+			doubles[doublesLen++] = ' ';
+			doublesLen += sprt::dtoa(d, doubles + doublesLen, sprt::dtoa(d, (char *)nullptr, 0));
+
+			auto n = int64_t(v) >> (v % 64);
+			integers[integersLen++] = ' ';
+			integersLen +=
+					sprt::itoa(n, integers + integersLen, sprt::itoa(n, (char *)nullptr, 0));
+		}
+
+		// every number should be read, otherwise the bench measures something else
+		size_t doublesRead = 0;
+		size_t integersRead = 0;
+
+		runBench("readDouble", 20, doublesLen, [&] {
+			StringView str(doubles, doublesLen);
+			double sum = 0.0;
+			doublesRead = 0;
+			while (auto ret = str.readDouble()) {
+				sum += ret.get(0.0);
+				++doublesRead;
+			}
+			doNotOptimize(sum);
+		});
+
+		runBench("readInteger", 20, integersLen, [&] {
+			StringView str(integers, integersLen);
+			int64_t sum = 0;
+			integersRead = 0;
+			while (auto ret = str.readInteger()) {
+				sum += ret.get(0);
+				++integersRead;
+			}
+			doNotOptimize(sum);
+		});
+
+		delete[] doubles;
+		delete[] integers;
+
+		if (doublesRead != Count || integersRead != Count) {
+			__sprt_printf("  [FAIL] numbers read: %zu doubles, %zu integers of %zu\n", doublesRead,
+					integersRead, Count);
+			return false;
+		}
+		return true;
+	}
+} _NumberBench;
+
+} // namespace sprt::test
@@ -0,0 +1,397 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/dispatch/queue.h>
+#include <sprt/runtime/dispatch/handle.h>
+#include <sprt/cxx/atomic>
+#include <sprt/cxx/thread>
+
+namespace sprt::test {
+
+static constexpr uint32_t MaxProducers = 8;
+
+struct PerformQueueEngine {
+	dispatch::QueueEngine engine;
+	const char *name;
+};
+
+static constexpr PerformQueueEngine s_performEngines[] = {
+	{dispatch::QueueEngine::URing, "uring"},
+	{dispatch::QueueEngine::EPoll, "epoll"},
+};
+
+// Messages from the producer threads, performed on the queue's thread
+struct PerformFanout {
+	dispatch::Queue *queue = nullptr;
+	Rc<dispatch::ThreadHandle> handle;
+
+	uint32_t received = 0;
+	uint32_t outOfOrder = 0;
+	uint32_t next[MaxProducers] = {0};
+
+	// number of the queue events, processed while waiting, each of them is a single
+	// wakeup (eventfd write and read, or the uring completion)
+	uint64_t wakeups = 0;
+
+	bool init(dispatch::Queue *q) {
+		queue = q;
+		handle = queue->addThreadHandle();
+		return handle != nullptr;
+	}
+
+	// Runs `producers` threads with `count` messages each, consumes them on the calling thread
+	// Returns false, if not all messages were received within the timeout
+	bool run(uint32_t producers, uint32_t count, uint64_t timeoutMs = 30'000) {
+		received = 0;
+		outOfOrder = 0;
+		wakeups = 0;
+		for (auto &it : next) { it = 0; }
+
+		atomic<bool> start(false);
+		thread threads[MaxProducers];
+		producers = min(producers, MaxProducers);
+		for (uint32_t p = 0; p < producers; ++p) {
+			threads[p] = thread([this, &start, p, count] {
+				while (!start.load()) { __sprt_sched_yield(); }
+				for (uint32_t i = 0; i < count; ++i) {
+					handle->perform([this, p, i] {
+						// messages from one producer should be performed in submission order
+						if (next[p] != i) {
+							++outOfOrder;
+						}
+						next[p] = i + 1;
+						++received;
+					});
+				}
+			});
+		}
+
+		start.store(true);
+
+		const uint32_t total = producers * count;
+		auto deadline = platform::nanoclock(platform::ClockType::Monotonic) + timeoutMs * 1'000'000;
+		while (received < total
+				&& platform::nanoclock(platform::ClockType::Monotonic) < deadline) {
+			wakeups += queue->wait(TimeInterval::milliseconds(100));
+		}
+
+		for (uint32_t p = 0; p < producers; ++p) { threads[p].join(); }
+		return received == total;
+	}
+
+	void cancel() {
+		if (handle) {
+			handle->cancel();
+			handle = nullptr;
+		}
+		queue->cancel();
+	}
+};
+
+static Rc<dispatch::QueueRef> makePerformQueue(const PerformQueueEngine &e) {
+	auto queue = dispatch::Queue::create(dispatch::QueueInfo{.engineMask = e.engine});
+	if (!queue || queue->get()->getEngine() != e.engine) {
+		__sprt_printf("  [skip] %s is not available\n", e.name);
+		return nullptr;
+	}
+	return queue;
+}
+
+struct QueuePerformTest : Test {
+	QueuePerformTest() : Test("queue perform") { }
+
+	virtual bool run() override {
+		for (auto &e : s_performEngines) {
+			auto queue = makePerformQueue(e);
+			if (!queue) {
+				continue;
+			}
+
+			char name[64];
+			auto len = __sprt_snprintf(name, sizeof(name), "%s fanout", e.name);
+			runTest(StringView(name, len), [&] {
+				PerformFanout fanout;
+				bool success = SPRT_TEST_CHECK(fanout.init(queue->get()));
+
+				// first run fills the node free list, the second one reuses it
+				for (uint32_t i = 0; success && i < 2; ++i) {
+					success &= SPRT_TEST_CHECK(fanout.run(4, 10'000))
+							&& SPRT_TEST_CHECK(fanout.outOfOrder == 0);
+				}
+
+				fanout.cancel();
+				return success;
+			});
+		}
+		return _failed == 0;
+	}
+} _QueuePerformTest;
+
+struct QueuePerformBench : Test {
+	QueuePerformBench() : Test("queue perform", true) { }
+
+	virtual bool run() override {
+		const uint32_t messages = isFull() ? 1'000'000 : 200'000;
+		const uint32_t producers[] = {1, 2, 4, 8};
+
+		for (auto &e : s_performEngines) {
+			auto queue = makePerformQueue(e);
+			if (!queue) {
+				continue;
+			}
+
+			PerformFanout fanout;
+			if (!fanout.init(queue->get())) {
+				__sprt_printf("  [FAIL] %s: fail to add thread handle\n", e.name);
+				continue;
+			}
+
+			for (auto p : producers) {
+				auto t = platform::nanoclock(platform::ClockType::Monotonic);
+				if (!fanout.run(p, messages / p)) {
+					__sprt_printf("  [FAIL] %s %up: %u of %u messages received\n", e.name, p,
+							fanout.received, messages / p * p);
+					continue;
+				}
+				t = platform::nanoclock(platform::ClockType::Monotonic) - t;
+
+				char name[96];
+				auto len = __sprt_snprintf(name, sizeof(name), "%s %up (%.4f wakeups/msg)",
+						e.name, p, double(fanout.wakeups) / fanout.received);
+				reportBench(StringView(name, len), fanout.received, 0, t);
+			}
+
+			fanout.cancel();
+		}
+		return true;
+	}
+} _QueuePerformBench;
+
+struct TimerQueueMode {
+	dispatch::QueueFlags flags;
+	const char *name;
+};
+
+static constexpr TimerQueueMode s_timerModes[] = {
+	{dispatch::QueueFlags::None, "wheel"},
+	{dispatch::QueueFlags::NativeTimers, "native"},
+};
+
+static Rc<dispatch::QueueRef> makeTimerQueue(const PerformQueueEngine &e,
+		const TimerQueueMode &mode) {
+	auto queue = dispatch::Queue::create(
+			dispatch::QueueInfo{.flags = mode.flags, .engineMask = e.engine});
+	if (!queue || queue->get()->getEngine() != e.engine) {
+		__sprt_printf("  [skip] %s is not available\n", e.name);
+		return nullptr;
+	}
+	return queue;
+}
+
+// Completion counters for a group of timers
+struct TimerBatch {
+	uint32_t ticks = 0; // intermediate completions of interval timers
+	uint32_t fired = 0;
+	uint32_t cancelled = 0;
+	uint32_t early = 0;
+};
+
+struct TimerProbe {
+	TimerBatch *batch = nullptr;
+	uint64_t deadline = 0; // nanoclock, timer should not fire before it
+	uint32_t value = 0;
+
+	static void complete(TimerProbe *probe, dispatch::TimerHandle *, uint32_t value,
+			Status status) {
+		auto now = platform::nanoclock(platform::ClockType::Monotonic);
+		probe->value = value;
+		if (status == Status::Ok) {
+			++probe->batch->ticks;
+		} else if (status == Status::Done) {
+			++probe->batch->fired;
+			if (now < probe->deadline) {
+				++probe->batch->early;
+			}
+		} else {
+			++probe->batch->cancelled;
+		}
+	}
+
+	Rc<dispatch::TimerHandle> schedule(dispatch::Queue *queue, TimerBatch *b, TimeInterval timeout,
+			TimeInterval interval = TimeInterval(), uint32_t count = 1) {
+		batch = b;
+		deadline = platform::nanoclock(platform::ClockType::Monotonic)
+				+ (timeout.toMicros() + interval.toMicros() * (count - 1)) * 1'000;
+		return queue->scheduleTimer(dispatch::TimerInfo{
+			.completion = dispatch::TimerInfo::Completion::create<TimerProbe>(this,
+					&TimerProbe::complete),
+			.timeout = timeout,
+			.interval = interval,
+			.count = count,
+			.clock = __SPRT_CLOCK_MONOTONIC,
+		});
+	}
+};
+
+// Processes queue events until `count` timers of the batch are completed
+static bool waitTimers(dispatch::Queue *queue, const TimerBatch &batch, uint32_t count,
+		uint64_t timeoutMs = 10'000) {
+	auto deadline = platform::nanoclock(platform::ClockType::Monotonic) + timeoutMs * 1'000'000;
+	while (batch.fired + batch.cancelled < count
+			&& platform::nanoclock(platform::ClockType::Monotonic) < deadline) {
+		queue->wait(TimeInterval::milliseconds(10));
+	}
+	return batch.fired + batch.cancelled == count;
+}
+
+struct QueueTimerTest : Test {
+	static constexpr uint32_t Timers = 200;
+
+	QueueTimerTest() : Test("queue timer") { }
+
+	virtual bool run() override {
+		for (auto &e : s_performEngines) {
+			for (auto &mode : s_timerModes) {
+				auto queue = makeTimerQueue(e, mode);
+				if (!queue) {
+					continue;
+				}
+
+				char name[64];
+				auto len = __sprt_snprintf(name, sizeof(name), "%s %s", e.name, mode.name);
+				runTest(StringView(name, len), [&] { return runTimers(queue->get()); });
+			}
+		}
+		return _failed == 0;
+	}
+
+	bool runTimers(dispatch::Queue *queue) {
+		TimerBatch batch;
+		TimerProbe probes[Timers + 1];
+		Rc<dispatch::TimerHandle> handles[Timers + 1];
+
+		// every 4th timer is cancelled before it fires
+		uint32_t expectCancelled = 0;
+		for (uint32_t i = 0; i < Timers; ++i) {
+			handles[i] = probes[i].schedule(queue, &batch, TimeInterval::milliseconds(i % 20 + 1));
+			if (!SPRT_TEST_CHECK(handles[i])) {
+				return false;
+			}
+		}
+		for (uint32_t i = 0; i < Timers; i += 4) {
+			handles[i]->cancel();
+			++expectCancelled;
+		}
+
+		// interval timer: intermediate completions (missed periods are coalesced),
+		// then Done with the final count
+		handles[Timers] = probes[Timers].schedule(queue, &batch, TimeInterval::milliseconds(2),
+				TimeInterval::milliseconds(2), 5);
+
+		bool success = SPRT_TEST_CHECK(waitTimers(queue, batch, Timers + 1));
+
+		// probes are on stack, drop timers, that are still running after a failure
+		queue->cancel();
+
+		success &= SPRT_TEST_CHECK(batch.cancelled == expectCancelled);
+		success &= SPRT_TEST_CHECK(batch.fired == Timers + 1 - expectCancelled);
+		success &= SPRT_TEST_CHECK(batch.early == 0);
+		success &= SPRT_TEST_CHECK(batch.ticks >= 1 && batch.ticks <= 4);
+		success &= SPRT_TEST_CHECK(probes[Timers].value == 5);
+		return success;
+	}
+} _QueueTimerTest;
+
+struct QueueTimerBench : Test {
+	QueueTimerBench() : Test("queue timer", true) { }
+
+	// Schedules `count` timers, that never fire within the bench, then cancels all of them
+	void runBatch(dispatch::Queue *queue, const char *prefix, uint32_t count) {
+		TimerBatch batch;
+		auto probes = new TimerProbe[count];
+		auto handles = new Rc<dispatch::TimerHandle>[count];
+
+		auto t = platform::nanoclock(platform::ClockType::Monotonic);
+		for (uint32_t i = 0; i < count; ++i) {
+			// spread over all wheel levels, from 10s to ~3h
+			auto timeout = TimeInterval::milliseconds(10'000 + (i * 7'919) % 10'000'000);
+			handles[i] = probes[i].schedule(queue, &batch, timeout);
+		}
+		queue->submitPending();
+		auto scheduled = platform::nanoclock(platform::ClockType::Monotonic) - t;
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "%s schedule", prefix);
+		reportBench(StringView(name, len), count, 0, scheduled);
+
+		// cancellation is complete, when all completions are received
+		t = platform::nanoclock(platform::ClockType::Monotonic);
+		for (uint32_t i = 0; i < count; ++i) {
+			if (handles[i]) {
+				handles[i]->cancel();
+			} else {
+				++batch.cancelled;
+			}
+		}
+		auto completed = waitTimers(queue, batch, count);
+		auto cancelled = platform::nanoclock(platform::ClockType::Monotonic) - t;
+
+		if (completed) {
+			len = __sprt_snprintf(name, sizeof(name), "%s cancel", prefix);
+			reportBench(StringView(name, len), count, 0, cancelled);
+		} else {
+			__sprt_printf("  [FAIL] %s: %u of %u timers completed\n", prefix,
+					batch.fired + batch.cancelled, count);
+			queue->cancel();
+		}
+
+		delete[] handles;
+		delete[] probes;
+	}
+
+	virtual bool run() override {
+		const uint32_t timers = isFull() ? 1'000'000 : 100'000;
+
+		for (auto &e : s_performEngines) {
+			for (auto &mode : s_timerModes) {
+				auto queue = makeTimerQueue(e, mode);
+				if (!queue) {
+					continue;
+				}
+
+				// native timers use kernel object per timer (timerfd for epoll),
+				// keep them within the descriptor limit
+				auto count = (mode.flags == dispatch::QueueFlags::None) ? timers : 500;
+
+				char prefix[64];
+				__sprt_snprintf(prefix, sizeof(prefix), "%s %s %u", e.name, mode.name, count);
+				runBatch(queue->get(), prefix, count);
+			}
+		}
+		return true;
+	}
+} _QueueTimerBench;
+
+} // namespace sprt::test
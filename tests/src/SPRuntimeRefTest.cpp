@@ -0,0 +1,202 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/ref.h>
+#include <sprt/cxx/atomic>
+#include <sprt/cxx/thread>
+
+namespace sprt::test {
+
+// Virtual (tracked in SPRT_REF_DEBUG mode) retain/release
+struct BenchRef : Ref {
+	uint64_t value = 0;
+};
+
+// Inlined atomic retain/release
+struct BenchInlineRef : Ref {
+	static constexpr bool RefInlineRetain = true;
+
+	uint64_t value = 0;
+};
+
+// Inlined non-atomic retain/release
+struct BenchLocalRef : LocalRef {
+	uint64_t value = 0;
+};
+
+struct RefTest : Test {
+	RefTest() : Test("ref") { }
+
+	template <typename T>
+	bool checkCounts() {
+		auto ref = Rc<T>::alloc();
+		if (!SPRT_TEST_CHECK(ref->getReferenceCount() == 1)) {
+			return false;
+		}
+
+		auto copy = ref;
+		if (!SPRT_TEST_CHECK(ref->getReferenceCount() == 2)) {
+			return false;
+		}
+
+		auto moved = move(copy);
+		if (!SPRT_TEST_CHECK(ref->getReferenceCount() == 2 && copy == nullptr)) {
+			return false;
+		}
+
+		Rc<Ref> base = moved;
+		if (!SPRT_TEST_CHECK(ref->getReferenceCount() == 3)) {
+			return false;
+		}
+
+		base = nullptr;
+		moved = nullptr;
+		return SPRT_TEST_CHECK(ref->getReferenceCount() == 1);
+	}
+
+	virtual bool run() override {
+		runTest("counts", [&] {
+			return checkCounts<BenchRef>() && checkCounts<BenchInlineRef>()
+					&& checkCounts<BenchLocalRef>();
+		});
+
+		// converting move-assignment should release the previously held reference
+		runTest("converting move", [&] {
+			auto first = Rc<BenchInlineRef>::alloc();
+			Rc<Ref> base = first;
+			if (!SPRT_TEST_CHECK(first->getReferenceCount() == 2)) {
+				return false;
+			}
+
+			auto second = Rc<BenchInlineRef>::alloc();
+			base = move(second);
+			return SPRT_TEST_CHECK(first->getReferenceCount() == 1)
+					&& SPRT_TEST_CHECK(base->getReferenceCount() == 1 && second == nullptr);
+		});
+
+		runTest("shared copy", [&] {
+			static constexpr uint32_t Threads = 4;
+
+			auto ref = Rc<BenchInlineRef>::alloc();
+			thread threads[Threads];
+			for (auto &it : threads) {
+				it = thread([&] {
+					for (uint32_t i = 0; i < 100'000; ++i) {
+						auto copy = ref;
+						doNotOptimize(copy);
+					}
+				});
+			}
+			for (auto &it : threads) { it.join(); }
+			return SPRT_TEST_CHECK(ref->getReferenceCount() == 1);
+		});
+
+		return _failed == 0;
+	}
+} _RefTest;
+
+struct RefBench : Test {
+	RefBench() : Test("ref", true) { }
+
+	template <typename T>
+	void runType(const char *type, uint64_t count) {
+		char name[64];
+
+		auto ref = Rc<T>::alloc();
+		auto len = __sprt_snprintf(name, sizeof(name), "%s copy", type);
+		runBench(StringView(name, len), count, 0, [&] {
+			Rc<T> copy = ref;
+			doNotOptimize(copy);
+		});
+
+		// ownership goes back and forth, counter is not touched
+		Rc<T> other;
+		len = __sprt_snprintf(name, sizeof(name), "%s move", type);
+		runBench(StringView(name, len), count, 0, [&] {
+			other = move(ref);
+			doNotOptimize(other);
+			ref = move(other);
+		});
+
+		len = __sprt_snprintf(name, sizeof(name), "%s create/destroy", type);
+		runBench(StringView(name, len), count / 10, 0, [&] {
+			auto obj = Rc<T>::alloc();
+			doNotOptimize(obj);
+		});
+	}
+
+	// All threads copy the same reference, the counter's cache line is contended
+	void runShared(uint32_t threads, uint64_t count) {
+		static constexpr uint32_t MaxThreads = 16;
+
+		auto ref = Rc<BenchInlineRef>::alloc();
+		atomic<uint32_t> ready(0);
+		atomic<bool> start(false);
+		thread workers[MaxThreads];
+
+		threads = min(threads, MaxThreads);
+		for (uint32_t i = 0; i < threads; ++i) {
+			workers[i] = thread([&] {
+				++ready;
+				while (!start.load()) { __sprt_sched_yield(); }
+				for (uint64_t j = 0; j < count; ++j) {
+					Rc<BenchInlineRef> copy = ref;
+					doNotOptimize(copy);
+				}
+			});
+		}
+
+		while (ready.load() != threads) { __sprt_sched_yield(); }
+
+		auto t = platform::nanoclock(platform::ClockType::Monotonic);
+		start.store(true);
+		for (uint32_t i = 0; i < threads; ++i) { workers[i].join(); }
+		auto nanos = platform::nanoclock(platform::ClockType::Monotonic) - t;
+
+		char name[64];
+		auto len = __sprt_snprintf(name, sizeof(name), "inline shared copy %ut", threads);
+		reportBench(StringView(name, len), uint64_t(threads) * count, 0, nanos);
+	}
+
+	virtual bool run() override {
+		const uint64_t count = isFull() ? 100'000'000 : 10'000'000;
+
+		runType<BenchRef>("virtual", count);
+		runType<BenchInlineRef>("inline", count);
+		runType<BenchLocalRef>("local", count);
+
+		const auto hw = uint32_t(thread::hardware_concurrency());
+		uint32_t threads[] = {2, 4, 8, (hw > 8) ? hw : 0};
+		for (auto t : threads) {
+			if (t != 0) {
+				runShared(t, count / 10);
+			}
+		}
+		return true;
+	}
+} _RefBench;
+
+} // namespace sprt::test
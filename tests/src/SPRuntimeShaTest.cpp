@@ -0,0 +1,305 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/hash.h>
+#include <sprt/runtime/utils/base16.h>
+#include <sprt/runtime/utils/tree_hash.h>
+#include <sprt/runtime/dispatch/task_queue.h>
+
+namespace sprt::test {
+
+struct ShaVector {
+	StringView input;
+	uint32_t repeat;
+	StringView sha1;
+	StringView sha256;
+	StringView sha512;
+};
+
+// FIPS 180 examples; the last one is one million of 'a'
+static const ShaVector s_shaVectors[] = {
+	ShaVector{"", 1, "da39a3ee5e6b4b0d3255bfef95601890afd80709",
+		"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+		"cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+		"47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e"},
+	ShaVector{"abc", 1, "a9993e364706816aba3e25717850c26c9cd0d89d",
+		"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+		"ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+		"2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f"},
+	ShaVector{"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+		"84983e441c3bd26ebaae4aa1f95129e5e54670f1",
+		"248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+		"204a8fc6dda82f0a0ced7beb8e08a41657c16ef468b228a8279be331a703c335"
+		"96fd15c13b1b07f9aa1d3bea57789ca031ad85c7a71dd70354ec631238ca3445"},
+	ShaVector{"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+			  "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+		1, "a49b2446a02c645bf419f995b67091253a04a259",
+		"cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1",
+		"8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018"
+		"501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909"},
+	ShaVector{"aaaaaaaaaa", 100'000, "34aa973cd4c4daa4f61eeb2bdbad27316534016f",
+		"cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0",
+		"e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973eb"
+		"de0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b"},
+};
+
+static constexpr uint8_t getInput(size_t i) { return uint8_t(i * 131 + 7); }
+
+static uint8_t *makeInput(size_t size) {
+	auto ret = new uint8_t[size];
+	for (size_t i = 0; i < size; ++i) { ret[i] = getInput(i); }
+	return ret;
+}
+
+template <typename Ctx, void (*Init)(Ctx &), void (*Process)(Ctx &, const uint8_t *, uint32_t),
+		void (*Done)(Ctx &, uint8_t *)>
+struct ShaFunctions {
+	// Hashes `repeat` copies of data, with random splits of every copy if `rnd` is defined
+	static void hash(const uint8_t *data, size_t len, uint8_t *out, uint32_t repeat = 1,
+			Random *rnd = nullptr) {
+		Ctx ctx;
+		Init(ctx);
+		for (uint32_t i = 0; i < repeat; ++i) {
+			size_t offset = 0;
+			while (rnd && offset < len) {
+				auto chunk = sprt::min(size_t(rnd->next() % 200), len - offset);
+				Process(ctx, data + offset, uint32_t(chunk));
+				offset += chunk;
+			}
+			Process(ctx, data + offset, uint32_t(len - offset));
+		}
+		Done(ctx, out);
+	}
+};
+
+using Sha1 = ShaFunctions<sha1::Ctx, sha1::sha_init, sha1::sha_process, sha1::sha_done>;
+using Sha256 = ShaFunctions<sha256::Ctx, sha256::sha_init, sha256::sha_process, sha256::sha_done>;
+using Sha512 = ShaFunctions<sha512::Ctx, sha512::sha_init, sha512::sha_process, sha512::sha_done>;
+
+struct ShaTest : Test {
+	ShaTest() : Test("sha") { }
+
+	virtual bool run() override {
+		runTest("vectors", [&] {
+			bool success = true;
+			uint8_t out[sha512::Length];
+			for (auto &it : s_shaVectors) {
+				auto data = (const uint8_t *)it.input.data();
+				Sha1::hash(data, it.input.size(), out, it.repeat);
+				success &= SPRT_TEST_CHECK(checkDigest(out, sha1::Length, it.sha1));
+				Sha256::hash(data, it.input.size(), out, it.repeat);
+				success &= SPRT_TEST_CHECK(checkDigest(out, sha256::Length, it.sha256));
+				Sha512::hash(data, it.input.size(), out, it.repeat);
+				success &= SPRT_TEST_CHECK(checkDigest(out, sha512::Length, it.sha512));
+			}
+			return success;
+		});
+
+		// Hash of concatenated digests for every length in [0, 600) with random streaming
+		// splits, that covers padding and block boundaries for all algorithms
+		runTest("lengths", [&] {
+			bool success = true;
+			auto data = makeInput(600);
+			auto digests = new uint8_t[600 * sha512::Length];
+			uint8_t out[sha512::Length];
+			Random rnd;
+
+			for (size_t i = 0; i < 600; ++i) {
+				Sha1::hash(data, i, digests + i * sha1::Length, 1, &rnd);
+			}
+			Sha1::hash(digests, 600 * sha1::Length, out);
+			success &= SPRT_TEST_CHECK(
+					checkDigest(out, sha1::Length, "a8d1fbd28acc0fd0de1219c6a8d08d308a53a928"));
+
+			for (size_t i = 0; i < 600; ++i) {
+				Sha256::hash(data, i, digests + i * sha256::Length, 1, &rnd);
+			}
+			Sha256::hash(digests, 600 * sha256::Length, out);
+			success &= SPRT_TEST_CHECK(checkDigest(out, sha256::Length,
+					"bd0fbafe6e97413374fce70b92d7ec38e5b645bf31c457959afdeaf934c327bf"));
+
+			for (size_t i = 0; i < 600; ++i) {
+				Sha512::hash(data, i, digests + i * sha512::Length, 1, &rnd);
+			}
+			Sha512::hash(digests, 600 * sha512::Length, out);
+			success &= SPRT_TEST_CHECK(checkDigest(out, sha512::Length,
+					"bd9672d46687888500f99e6a110286b6f6b137fa3d0845128f74fb0ace7458a5"
+					"6567fe4f1ee86cac5601fb3e4baca9575ad454723ca94dcc6df1a9b5d1ba1bef"));
+
+			delete[] digests;
+			delete[] data;
+			return success;
+		});
+
+		runTest("multi", [&] {
+			static constexpr size_t MaxCount = 20;
+
+			bool success = true;
+			auto data = makeInput(MaxCount * 3'000);
+			const uint8_t *src[MaxCount];
+			size_t len[MaxCount];
+			uint8_t out[MaxCount][sha256::Length];
+			uint8_t expected[sha256::Length];
+			Random rnd;
+
+			for (uint32_t round = 0; round < 200; ++round) {
+				auto count = uint32_t(1 + rnd.next() % MaxCount);
+				for (uint32_t i = 0; i < count; ++i) {
+					// similar lengths are processed in the same group by the parallel kernel
+					len[i] = (round % 2) ? rnd.next() % 3'000 : 1'000 + rnd.next() % 130;
+					src[i] = data + i * 3'000 + rnd.next() % (3'000 - len[i] + 1);
+				}
+
+				sha256::sha_multi(src, len, out, count);
+
+				for (uint32_t i = 0; i < count; ++i) {
+					Sha256::hash(src[i], len[i], expected);
+					success &=
+							SPRT_TEST_CHECK(__sprt_memcmp(out[i], expected, sha256::Length) == 0);
+				}
+			}
+
+			delete[] data;
+			return success;
+		});
+
+		runTest("tree", [&] {
+			bool success = true;
+			const size_t size = 5 * 1'024 * 1'024 + 123;
+			auto data = makeInput(size);
+			auto queue = Rc<dispatch::TaskQueue>::create(
+					dispatch::TaskQueueInfo{.name = StringView("ShaTest"), .threadCount = 4});
+
+			success &= SPRT_TEST_CHECK(checkTreeHash(queue, BytesView(data, size), 1'024 * 1'024,
+					"f10bb152d68d4dc1ca182065847cc926dcacd102b79492b48ed0aaaca5562163"));
+			success &= SPRT_TEST_CHECK(checkTreeHash(queue, BytesView(data, 1'024 * 1'024),
+					1'024 * 1'024,
+					"4bbe7c5bdeed5af2d45bc58e3812339b0caa654f3fee25dc212ef5ac5be8e527"));
+			success &= SPRT_TEST_CHECK(checkTreeHash(queue, BytesView(data, 100'000), 4'096,
+					"55b69e0a5a2dde71b357eaacc2c23b6bfed87b5c2d2136361f43e78314cdc06c"));
+
+			// single empty chunk
+			success &= SPRT_TEST_CHECK(checkTreeHash(queue, BytesView(), 1'024 * 1'024,
+					"5df6e0e2761359d30a8275058e299fcc0381534545f55cf43e41983f5d4c9456"));
+
+			auto invalid = sha256::performTreeHash(*queue, BytesView(data, 100),
+					[](Status, BytesView) { }, 0);
+			success &= SPRT_TEST_CHECK(invalid == Status::ErrorInvalidArguemnt);
+
+			queue->cancel();
+			delete[] data;
+			return success;
+		});
+
+		return _failed == 0;
+	}
+
+	static bool checkDigest(const uint8_t *digest, size_t len, StringView expected) {
+		char buf[sha512::Length * 2];
+		auto ret = base16::encode(digest, len, buf, sizeof(buf), false);
+		return StringView(buf, ret) == expected;
+	}
+
+	static bool checkTreeHash(dispatch::TaskQueue *queue, BytesView data, size_t chunkSize,
+			StringView expected) {
+		bool completed = false;
+		bool success = false;
+		auto status = sha256::performTreeHash(*queue, data, [&](Status st, BytesView root) {
+			completed = true;
+			success = (st == Status::Ok) && checkDigest(root.data(), root.size(), expected);
+		}, chunkSize);
+		if (status != Status::Ok) {
+			return false;
+		}
+
+		// callback is called with the queue's output context, e.g. from update()
+		while (!completed) { queue->wait(TimeInterval::milliseconds(100)); }
+		return success;
+	}
+} _ShaTest;
+
+struct ShaBench : Test {
+	static constexpr size_t BufferSize = 64 * 1'024 * 1'024;
+
+	ShaBench() : Test("sha", true) { }
+
+	virtual bool run() override {
+		auto data = makeInput(BufferSize);
+		uint8_t out[sha512::Length];
+
+		const size_t sizes[] = {64, 1'024, 1'024 * 1'024};
+		char name[64];
+		for (auto size : sizes) {
+			auto count = sprt::max(size_t(16), 256 * 1'024 * 1'024 / size / 16);
+
+			auto len = __sprt_snprintf(name, sizeof(name), "sha1 %zu", size);
+			runBench(StringView(name, len), count, size, [&] { Sha1::hash(data, size, out); });
+
+			len = __sprt_snprintf(name, sizeof(name), "sha256 %zu", size);
+			runBench(StringView(name, len), count, size, [&] { Sha256::hash(data, size, out); });
+
+			len = __sprt_snprintf(name, sizeof(name), "sha512 %zu", size);
+			runBench(StringView(name, len), count, size, [&] { Sha512::hash(data, size, out); });
+		}
+
+		// independent messages, as for the tree hash chunks
+		const uint8_t *src[sha256::MultiBufferLanes];
+		size_t len[sha256::MultiBufferLanes];
+		uint8_t digests[sha256::MultiBufferLanes][sha256::Length];
+		for (uint32_t i = 0; i < sha256::MultiBufferLanes; ++i) {
+			src[i] = data + i * 64 * 1'024;
+			len[i] = 64 * 1'024;
+		}
+
+		runBench("sha256 sequential 8x64KiB", 256, sha256::MultiBufferLanes * 64 * 1'024, [&] {
+			for (uint32_t i = 0; i < sha256::MultiBufferLanes; ++i) {
+				Sha256::hash(src[i], len[i], digests[i]);
+			}
+		});
+
+		runBench("sha256 multi 8x64KiB", 256, sha256::MultiBufferLanes * 64 * 1'024,
+				[&] { sha256::sha_multi(src, len, digests, sha256::MultiBufferLanes); });
+
+		auto queue = Rc<dispatch::TaskQueue>::create(
+				dispatch::TaskQueueInfo{.name = StringView("ShaBench"),
+					.threadCount = uint16_t(sprt::thread::hardware_concurrency())});
+
+		runBench("sha256 tree 64MiB", 4, BufferSize, [&] {
+			bool completed = false;
+			sha256::performTreeHash(*queue, BytesView(data, BufferSize),
+					[&](Status, BytesView root) {
+				__sprt_memcpy(out, root.data(), root.size());
+				completed = true;
+			});
+			while (!completed) { queue->wait(TimeInterval::milliseconds(100)); }
+		});
+
+		queue->cancel();
+		doNotOptimize(out);
+		delete[] data;
+		return true;
+	}
+} _ShaBench;
+
+} // namespace sprt::test
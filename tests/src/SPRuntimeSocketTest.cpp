@@ -0,0 +1,654 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/dispatch/queue.h>
+
+#if SPRT_LINUX
+
+// dispatch::Queue accepts native descriptors, loopback sockets are created with the system API
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace sprt::test {
+
+/*
+	Loopback TCP connection, both ends are driven by the same dispatch::Queue:
+	server accepts with acceptSocket and echoes everything it receives with sendSocket,
+	client sends a message and waits until the echo is received completely.
+*/
+struct EchoPair {
+	static constexpr uint64_t Timeout = 5'000'000'000; // nanoseconds
+
+	dispatch::Queue *queue = nullptr;
+
+	int listenFd = -1;
+	int serverFd = -1;
+	int clientFd = -1;
+
+	Rc<dispatch::AcceptHandle> acceptHandle;
+	Rc<dispatch::RecvHandle> serverRecv;
+	Rc<dispatch::RecvHandle> clientRecv;
+
+	// pending echo, next chunk is sent from the completion of the previous one
+	uint8_t *serverBuffer = nullptr;
+	size_t serverCapacity = 0;
+	size_t serverLen = 0;
+	size_t serverSent = 0;
+	bool serverSending = false;
+
+	const uint8_t *message = nullptr;
+	size_t messageSize = 0;
+	size_t clientSent = 0;
+	size_t clientReceived = 0;
+	bool clientSending = false;
+
+	bool closing = false;
+	bool failed = false;
+
+	~EchoPair() { delete[] serverBuffer; }
+
+	bool init(dispatch::Queue *q, size_t maxMessage) {
+		queue = q;
+		serverBuffer = new uint8_t[maxMessage];
+		serverCapacity = maxMessage;
+
+		listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		if (listenFd < 0) {
+			return false;
+		}
+
+		struct sockaddr_in addr = {};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		addr.sin_port = 0;
+
+		socklen_t addrLen = sizeof(addr);
+		if (::bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+				|| ::listen(listenFd, 4) != 0
+				|| ::getsockname(listenFd, (struct sockaddr *)&addr, &addrLen) != 0) {
+			return false;
+		}
+
+		acceptHandle = queue->acceptSocket(listenFd,
+				dispatch::CompletionHandle<dispatch::AcceptHandle>::create<EchoPair>(this,
+						&onAccept));
+		if (!acceptHandle) {
+			return false;
+		}
+
+		// connection to the listening loopback socket is established within the backlog,
+		// so, blocking connect is safe here; receiving requires non-blocking socket
+		clientFd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (clientFd < 0 || ::connect(clientFd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+				|| ::fcntl(clientFd, F_SETFL, ::fcntl(clientFd, F_GETFL) | O_NONBLOCK) != 0) {
+			return false;
+		}
+		setNoDelay(clientFd);
+
+		clientRecv = queue->recvSocket(clientFd,
+				dispatch::RecvInfo{
+					.completion =
+							dispatch::RecvInfo::Completion::create<EchoPair>(this, &onClientRecv),
+				});
+		if (!clientRecv) {
+			return false;
+		}
+
+		return pump([&] { return serverRecv != nullptr; });
+	}
+
+	// Sends message and waits for the complete echo
+	bool roundTrip(const uint8_t *data, size_t size) {
+		message = data;
+		messageSize = size;
+		clientSent = 0;
+		clientReceived = 0;
+		flushClient();
+		return pump([&] {
+			return clientReceived == messageSize && clientSent == messageSize && !clientSending;
+		});
+	}
+
+	void close() {
+		closing = true;
+		if (acceptHandle) {
+			acceptHandle->cancel();
+		}
+		if (serverRecv) {
+			serverRecv->cancel();
+		}
+		if (clientRecv) {
+			clientRecv->cancel();
+		}
+		queue->poll();
+
+		closeFd(clientFd);
+		closeFd(serverFd);
+		closeFd(listenFd);
+	}
+
+	template <typename Callback>
+	bool pump(const Callback &cb) {
+		auto deadline = platform::nanoclock(platform::ClockType::Monotonic) + Timeout;
+		while (!failed && !cb()) {
+			if (platform::nanoclock(platform::ClockType::Monotonic) > deadline) {
+				failed = true;
+				break;
+			}
+			queue->wait(TimeInterval::milliseconds(100));
+		}
+		return !failed;
+	}
+
+	void flushServer() {
+		if (serverSending) {
+			return;
+		}
+		if (serverSent == serverLen) {
+			serverSent = serverLen = 0;
+			return;
+		}
+
+		serverSending = true;
+		if (!queue->sendSocket(serverFd, serverBuffer + serverSent, serverLen - serverSent,
+					dispatch::CompletionHandle<dispatch::WriteHandle>::create<EchoPair>(this,
+							&onServerSent))) {
+			serverSending = false;
+			failed = true;
+		}
+	}
+
+	void flushClient() {
+		if (clientSending || clientSent == messageSize) {
+			return;
+		}
+
+		clientSending = true;
+		if (!queue->sendSocket(clientFd, message + clientSent, messageSize - clientSent,
+					dispatch::CompletionHandle<dispatch::WriteHandle>::create<EchoPair>(this,
+							&onClientSent))) {
+			clientSending = false;
+			failed = true;
+		}
+	}
+
+	static void closeFd(int &fd) {
+		if (fd >= 0) {
+			::close(fd);
+			fd = -1;
+		}
+	}
+
+	static void setNoDelay(int fd) {
+		int value = 1;
+		::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value));
+	}
+
+	static void onAccept(EchoPair *pair, dispatch::AcceptHandle *, uint32_t fd, Status status) {
+		if (status != Status::Ok) {
+			pair->failed |= !pair->closing;
+			return;
+		}
+
+		if (pair->serverFd >= 0) {
+			// unexpected connection
+			::close(int(fd));
+			return;
+		}
+
+		pair->serverFd = int(fd);
+		setNoDelay(pair->serverFd);
+		pair->serverRecv = pair->queue->recvSocket(pair->serverFd,
+				dispatch::RecvInfo{
+					.completion =
+							dispatch::RecvInfo::Completion::create<EchoPair>(pair, &onServerRecv),
+				});
+		if (!pair->serverRecv) {
+			pair->failed = true;
+		}
+	}
+
+	static void onServerRecv(EchoPair *pair, dispatch::RecvHandle *handle, uint32_t,
+			Status status) {
+		if (status != Status::Ok) {
+			pair->failed |= !pair->closing;
+			return;
+		}
+
+		auto data = handle->getData();
+		if (pair->serverLen + data.size() > pair->serverCapacity) {
+			pair->failed = true;
+			return;
+		}
+
+		__sprt_memcpy(pair->serverBuffer + pair->serverLen, data.data(), data.size());
+		pair->serverLen += data.size();
+		pair->flushServer();
+	}
+
+	static void onServerSent(EchoPair *pair, dispatch::WriteHandle *, uint32_t value,
+			Status status) {
+		pair->serverSending = false;
+		if (status != Status::Done || value == 0) {
+			pair->failed |= !pair->closing;
+			return;
+		}
+
+		pair->serverSent += value;
+		pair->flushServer();
+	}
+
+	static void onClientRecv(EchoPair *pair, dispatch::RecvHandle *handle, uint32_t,
+			Status status) {
+		if (status != Status::Ok) {
+			pair->failed |= !pair->closing;
+			return;
+		}
+
+		auto data = handle->getData();
+		if (pair->clientReceived + data.size() > pair->messageSize
+				|| __sprt_memcmp(pair->message + pair->clientReceived, data.data(), data.size())
+						!= 0) {
+			pair->failed = true;
+			return;
+		}
+
+		pair->clientReceived += data.size();
+	}
+
+	static void onClientSent(EchoPair *pair, dispatch::WriteHandle *, uint32_t value,
+			Status status) {
+		pair->clientSending = false;
+		if (status != Status::Done || value == 0) {
+			pair->failed |= !pair->closing;
+			return;
+		}
+
+		pair->clientSent += value;
+		pair->flushClient();
+	}
+};
+
+/*
+	Same echo, but over the plain poll handles: sockets are read and written with the system
+	calls when the queue reports readiness, like it was done before the socket handles.
+	Epoll can not register the same descriptor twice, so, writability is polled on a duplicate.
+*/
+struct PollEchoPair {
+	static constexpr uint64_t Timeout = EchoPair::Timeout;
+
+	dispatch::Queue *queue = nullptr;
+
+	int listenFd = -1;
+	int serverFd = -1;
+	int clientFd = -1;
+
+	Rc<dispatch::PollHandle> serverIn;
+	Rc<dispatch::PollHandle> serverOut;
+	Rc<dispatch::PollHandle> clientIn;
+	Rc<dispatch::PollHandle> clientOut;
+
+	uint8_t *serverBuffer = nullptr;
+	uint8_t *clientBuffer = nullptr;
+	size_t capacity = 0;
+	size_t serverLen = 0;
+	size_t serverSent = 0;
+
+	const uint8_t *message = nullptr;
+	size_t messageSize = 0;
+	size_t clientSent = 0;
+	size_t clientReceived = 0;
+
+	bool failed = false;
+
+	~PollEchoPair() {
+		delete[] serverBuffer;
+		delete[] clientBuffer;
+	}
+
+	bool init(dispatch::Queue *q, size_t maxMessage) {
+		queue = q;
+		serverBuffer = new uint8_t[maxMessage];
+		clientBuffer = new uint8_t[maxMessage];
+		capacity = maxMessage;
+
+		listenFd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (listenFd < 0) {
+			return false;
+		}
+
+		struct sockaddr_in addr = {};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		addr.sin_port = 0;
+
+		socklen_t addrLen = sizeof(addr);
+		if (::bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+				|| ::listen(listenFd, 4) != 0
+				|| ::getsockname(listenFd, (struct sockaddr *)&addr, &addrLen) != 0) {
+			return false;
+		}
+
+		clientFd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (clientFd < 0 || ::connect(clientFd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+				|| ::fcntl(clientFd, F_SETFL, ::fcntl(clientFd, F_GETFL) | O_NONBLOCK) != 0) {
+			return false;
+		}
+
+		serverFd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (serverFd < 0) {
+			return false;
+		}
+
+		EchoPair::setNoDelay(clientFd);
+		EchoPair::setNoDelay(serverFd);
+
+		serverIn = queue->listenPollableHandle(serverFd, dispatch::PollFlags::In,
+				[this](NativeHandle, dispatch::PollFlags) { return onServerReadable(); });
+		clientIn = queue->listenPollableHandle(clientFd, dispatch::PollFlags::In,
+				[this](NativeHandle, dispatch::PollFlags) { return onClientReadable(); });
+		return serverIn && clientIn;
+	}
+
+	bool roundTrip(const uint8_t *data, size_t size) {
+		message = data;
+		messageSize = size;
+		clientSent = 0;
+		clientReceived = 0;
+		flushClient();
+		return pump([&] { return clientReceived == messageSize && clientSent == messageSize; });
+	}
+
+	void close() {
+		if (serverIn) {
+			serverIn->cancel();
+		}
+		if (serverOut) {
+			serverOut->cancel();
+		}
+		if (clientIn) {
+			clientIn->cancel();
+		}
+		if (clientOut) {
+			clientOut->cancel();
+		}
+		queue->poll();
+
+		EchoPair::closeFd(clientFd);
+		EchoPair::closeFd(serverFd);
+		EchoPair::closeFd(listenFd);
+	}
+
+	template <typename Callback>
+	bool pump(const Callback &cb) {
+		auto deadline = platform::nanoclock(platform::ClockType::Monotonic) + Timeout;
+		while (!failed && !cb()) {
+			if (platform::nanoclock(platform::ClockType::Monotonic) > deadline) {
+				failed = true;
+				break;
+			}
+			queue->wait(TimeInterval::milliseconds(100));
+		}
+		return !failed;
+	}
+
+	// Reads everything available, returns false on EOF or error
+	bool readAll(int fd, uint8_t *buffer, size_t &len) {
+		while (len < capacity) {
+			auto ret = ::recv(fd, buffer + len, capacity - len, MSG_DONTWAIT);
+			if (ret > 0) {
+				len += size_t(ret);
+			} else if (ret < 0 && errno == EAGAIN) {
+				return true;
+			} else if (ret == 0 || errno != EINTR) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Writes until socket buffer is full, returns false on error
+	bool writeAll(int fd, const uint8_t *buffer, size_t size, size_t &sent) {
+		while (sent < size) {
+			auto ret = ::send(fd, buffer + sent, size - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+			if (ret > 0) {
+				sent += size_t(ret);
+			} else if (ret < 0 && errno == EAGAIN) {
+				return true;
+			} else if (ret == 0 || errno != EINTR) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// One-shot wait for writability, handle is cancelled when there is nothing to send
+	void waitWritable(int fd, Rc<dispatch::PollHandle> &out, bool server) {
+		if (out && out->getStatus() == Status::Ok) {
+			return;
+		}
+
+		auto dupFd = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+		if (dupFd < 0) {
+			failed = true;
+			return;
+		}
+
+		out = queue->listenPollableHandle(dupFd,
+				dispatch::PollFlags::Out | dispatch::PollFlags::CloseFd,
+				[this, server](NativeHandle, dispatch::PollFlags) {
+			auto pending = server ? flushServer() : flushClient();
+			return pending ? Status::Ok : Status::Done;
+		});
+		if (!out) {
+			::close(dupFd);
+			failed = true;
+		}
+	}
+
+	// returns true, if some data is still waiting for the socket
+	bool flushServer() {
+		if (!writeAll(serverFd, serverBuffer, serverLen, serverSent)) {
+			failed = true;
+			return false;
+		}
+		if (serverSent == serverLen) {
+			serverSent = serverLen = 0;
+			return false;
+		}
+		waitWritable(serverFd, serverOut, true);
+		return true;
+	}
+
+	bool flushClient() {
+		if (!writeAll(clientFd, message, messageSize, clientSent)) {
+			failed = true;
+			return false;
+		}
+		if (clientSent == messageSize) {
+			return false;
+		}
+		waitWritable(clientFd, clientOut, false);
+		return true;
+	}
+
+	Status onServerReadable() {
+		if (!readAll(serverFd, serverBuffer, serverLen)) {
+			failed = true;
+			return Status::ErrorCancelled;
+		}
+		flushServer();
+		return Status::Ok;
+	}
+
+	Status onClientReadable() {
+		auto offset = clientReceived;
+		if (!readAll(clientFd, clientBuffer, clientReceived) || clientReceived > messageSize
+				|| __sprt_memcmp(message + offset, clientBuffer + offset, clientReceived - offset)
+						!= 0) {
+			failed = true;
+			return Status::ErrorCancelled;
+		}
+		return Status::Ok;
+	}
+};
+
+struct EchoEngine {
+	dispatch::QueueEngine engine;
+	const char *name;
+};
+
+static constexpr EchoEngine s_echoEngines[] = {
+	{dispatch::QueueEngine::URing, "uring"},
+	{dispatch::QueueEngine::EPoll, "epoll"},
+};
+
+static Rc<dispatch::QueueRef> makeEchoQueue(const EchoEngine &e) {
+	auto queue = dispatch::Queue::create(dispatch::QueueInfo{.engineMask = e.engine});
+	if (!queue || queue->get()->getEngine() != e.engine) {
+		__sprt_printf("  [skip] %s is not available\n", e.name);
+		return nullptr;
+	}
+	return queue;
+}
+
+struct SocketTest : Test {
+	static constexpr size_t MaxMessage = 256 * 1'024;
+
+	SocketTest() : Test("socket") { }
+
+	virtual bool run() override {
+		auto message = new uint8_t[MaxMessage];
+		Random rnd{0x5EED'0003};
+		for (size_t i = 0; i < MaxMessage; ++i) { message[i] = uint8_t(rnd.next()); }
+
+		for (auto &e : s_echoEngines) {
+			auto queue = makeEchoQueue(e);
+			if (!queue) {
+				continue;
+			}
+
+			char name[64];
+			auto len = __sprt_snprintf(name, sizeof(name), "echo %s", e.name);
+			runTest(StringView(name, len), [&] {
+				EchoPair pair;
+				bool success = SPRT_TEST_CHECK(pair.init(queue->get(), MaxMessage));
+
+				// sizes around recv buffer and zero-copy send thresholds
+				const size_t sizes[] = {1, 64, 4'096, 16 * 1'024, 16 * 1'024 + 1, 100'000,
+					MaxMessage};
+				for (size_t i = 0; success && i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+					success &= SPRT_TEST_CHECK(pair.roundTrip(message, sizes[i]));
+				}
+
+				for (uint32_t i = 0; success && i < 64; ++i) {
+					auto size = 1 + size_t(rnd.next() % MaxMessage);
+					auto offset = size_t(rnd.next() % (MaxMessage - size + 1));
+					success &= SPRT_TEST_CHECK(pair.roundTrip(message + offset, size));
+				}
+
+				pair.close();
+				queue->get()->cancel();
+				return success;
+			});
+		}
+
+		delete[] message;
+		return _failed == 0;
+	}
+} _SocketTest;
+
+struct SocketBench : Test {
+	static constexpr size_t MaxMessage = 1'024 * 1'024;
+
+	SocketBench() : Test("socket", true) { }
+
+	template <typename Pair>
+	bool runEcho(Pair &pair, dispatch::Queue *queue, const char *engine, const char *mode,
+			const uint8_t *message) {
+		if (!pair.init(queue, MaxMessage)) {
+			__sprt_printf("  [FAIL] %s %s: fail to establish loopback connection\n", engine,
+					mode);
+			pair.close();
+			return false;
+		}
+
+		struct BenchCase {
+			const char *name;
+			size_t size;
+			uint64_t count;
+		} cases[] = {
+			{"64B", 64, 20'000},
+			{"4KiB", 4 * 1'024, 10'000},
+			{"64KiB", 64 * 1'024, 2'000},
+			{"1MiB", MaxMessage, 200},
+		};
+
+		bool success = true;
+		for (auto &c : cases) {
+			char name[64];
+			auto len = __sprt_snprintf(name, sizeof(name), "%s %s %s", engine, mode, c.name);
+			runBench(StringView(name, len), c.count, c.size,
+					[&] { success &= pair.roundTrip(message, c.size); });
+		}
+
+		pair.close();
+		return success;
+	}
+
+	virtual bool run() override {
+		auto message = new uint8_t[MaxMessage];
+		Random rnd{0x5EED'0003};
+		for (size_t i = 0; i < MaxMessage; ++i) { message[i] = uint8_t(rnd.next()); }
+
+		bool success = true;
+		for (auto &e : s_echoEngines) {
+			auto queue = makeEchoQueue(e);
+			if (!queue) {
+				continue;
+			}
+
+			// socket handles against the readiness notifications with manual recv/send
+			EchoPair pair;
+			success &= runEcho(pair, queue->get(), e.name, "echo", message);
+
+			PollEchoPair pollPair;
+			success &= runEcho(pollPair, queue->get(), e.name, "poll echo", message);
+
+			queue->get()->cancel();
+		}
+
+		delete[] message;
+		return success;
+	}
+} _SocketBench;
+
+} // namespace sprt::test
+
+#endif
@@ -0,0 +1,70 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+namespace sprt::test {
+
+static Test *s_first = nullptr;
+static Test *s_last = nullptr;
+static bool s_full = false;
+
+Test *Test::getFirst() { return s_first; }
+
+bool Test::isFull() { return s_full; }
+
+void Test::setFull(bool value) { s_full = value; }
+
+Test::Test(StringView name, bool benchmark) : _name(name), _benchmark(benchmark) {
+	// keep definition order within the translation unit
+	if (s_last) {
+		s_last->_next = this;
+	} else {
+		s_first = this;
+	}
+	s_last = this;
+}
+
+bool Test::check(bool value, const char *expr, const char *file, int line) {
+	if (!value) {
+		__sprt_printf("    %s:%d: check failed: %s\n", file, line, expr);
+	}
+	return value;
+}
+
+void Test::report(StringView name, bool success, uint64_t nanos) {
+	__sprt_printf("  [%s] %.*s (%.3f ms)\n", success ? "ok" : "FAIL", int(name.size()),
+			name.data(), double(nanos) / 1'000'000.0);
+}
+
+void Test::reportBench(StringView name, uint64_t count, uint64_t bytes, uint64_t nanos) {
+	auto perIter = double(nanos) / double(count ? count : 1);
+	if (bytes) {
+		__sprt_printf("  %-40.*s %12.1f ns/iter %10.1f MiB/s\n", int(name.size()), name.data(),
+				perIter, double(bytes) * double(count) / (1024.0 * 1024.0)
+						/ (double(nanos) / 1'000'000'000.0));
+	} else {
+		__sprt_printf("  %-40.*s %12.1f ns/iter\n", int(name.size()), name.data(), perIter);
+	}
+}
+
+} // namespace sprt::test
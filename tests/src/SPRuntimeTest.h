@@ -0,0 +1,116 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#ifndef RUNTIME_TESTS_SRC_SPRUNTIMETEST_H_
+#define RUNTIME_TESTS_SRC_SPRUNTIMETEST_H_
+
+#include <sprt/runtime/stringview.h>
+#include <sprt/runtime/platform.h>
+#include <sprt/c/__sprt_stdio.h>
+
+namespace sprt::test {
+
+/*
+	Self-registered test or benchmark
+
+	Define a static instance of the subclass; the runner calls run() for every registered
+	test (or benchmark with `--bench`), which name starts with one of the command line filters.
+*/
+class Test {
+public:
+	static Test *getFirst();
+
+	// With `--full` tests use exhaustive sweeps instead of the sampled ones
+	static bool isFull();
+	static void setFull(bool);
+
+	Test(StringView name, bool benchmark = false);
+	virtual ~Test() = default;
+
+	// Returns false, if any case failed
+	virtual bool run() = 0;
+
+	StringView getName() const { return _name; }
+	bool isBenchmark() const { return _benchmark; }
+	Test *getNext() const { return _next; }
+
+protected:
+	// Runs named case, callback returns false on failure
+	template <typename Callback>
+	bool runTest(StringView name, const Callback &cb) {
+		auto t = platform::nanoclock(platform::ClockType::Monotonic);
+		auto ret = bool(cb());
+		report(name, ret, platform::nanoclock(platform::ClockType::Monotonic) - t);
+		if (!ret) {
+			++_failed;
+		}
+		return ret;
+	}
+
+	// Runs callback `count` times, reports time per iteration and throughput, if `bytes`
+	// (per iteration) is not zero; returns total time in nanoseconds
+	template <typename Callback>
+	uint64_t runBench(StringView name, uint64_t count, uint64_t bytes, const Callback &cb) {
+		auto t = platform::nanoclock(platform::ClockType::Monotonic);
+		for (uint64_t i = 0; i < count; ++i) { cb(); }
+		auto ret = platform::nanoclock(platform::ClockType::Monotonic) - t;
+		reportBench(name, count, bytes, ret);
+		return ret;
+	}
+
+	// Reports failed condition with the location; returns the condition
+	bool check(bool value, const char *expr, const char *file, int line);
+
+	void report(StringView name, bool success, uint64_t nanos);
+	void reportBench(StringView name, uint64_t count, uint64_t bytes, uint64_t nanos);
+
+	uint32_t _failed = 0;
+
+private:
+	StringView _name;
+	bool _benchmark = false;
+	Test *_next = nullptr;
+};
+
+// Deterministic generator for reproducible inputs (splitmix64)
+struct Random {
+	uint64_t state = 0;
+
+	uint64_t next() {
+		auto z = (state += 0x9E37'79B9'7F4A'7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EBULL;
+		return z ^ (z >> 31);
+	}
+};
+
+// Keeps the value (and memory, it points to) alive for the optimizer
+template <typename T>
+inline void doNotOptimize(const T &value) {
+	__asm__ volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace sprt::test
+
+#define SPRT_TEST_CHECK(expr) check(bool(expr), #expr, __FILE__, __LINE__)
+
+#endif // RUNTIME_TESTS_SRC_SPRUNTIMETEST_H_
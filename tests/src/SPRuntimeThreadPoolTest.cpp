@@ -0,0 +1,219 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/dispatch/task_queue.h>
+
+namespace sprt::test {
+
+using dispatch::Task;
+using dispatch::TaskQueue;
+using dispatch::ThreadPoolFlags;
+
+struct PoolMode {
+	const char *name;
+	ThreadPoolFlags flags;
+};
+
+static const PoolMode s_poolModes[] = {
+	PoolMode{"central", ThreadPoolFlags::None},
+	PoolMode{"stealing", ThreadPoolFlags::WorkStealing},
+};
+
+static Rc<TaskQueue> makeQueue(const PoolMode &mode, uint32_t threads) {
+	return Rc<TaskQueue>::create(dispatch::TaskQueueInfo{.flags = mode.flags,
+		.name = StringView("ThreadPoolTest"),
+		.threadCount = uint16_t(max(threads, uint32_t(2)))});
+}
+
+// Processes completions until the counter reaches the target, fails after the timeout,
+// so the lost wakeup does not hang the whole test run
+static bool waitForCounter(TaskQueue *queue, const sprt::atomic<size_t> &counter, size_t target,
+		uint64_t timeoutMs = 10'000) {
+	auto deadline = platform::nanoclock(platform::ClockType::Monotonic) + timeoutMs * 1'000'000;
+	while (counter.load() < target) {
+		queue->wait(TimeInterval::milliseconds(1));
+		if (platform::nanoclock(platform::ClockType::Monotonic) > deadline) {
+			return false;
+		}
+	}
+	queue->update();
+	return true;
+}
+
+// Binary tree of tasks, every node is performed from the pool's worker
+struct TaskTree {
+	static size_t getCount(uint32_t depth) { return (size_t(2) << depth) - 1; }
+
+	TaskQueue *queue = nullptr;
+	sprt::atomic<size_t> executed = 0;
+
+	void spawn(uint32_t depth) {
+		queue->perform([this, depth] {
+			if (depth > 0) {
+				spawn(depth - 1);
+				spawn(depth - 1);
+			}
+			++executed;
+		});
+	}
+};
+
+struct ThreadPoolTest : Test {
+	ThreadPoolTest() : Test("thread pool") { }
+
+	bool runMode(const PoolMode &mode, uint32_t threads) {
+		char name[128];
+		auto queue = makeQueue(mode, threads);
+
+		auto len = __sprt_snprintf(name, sizeof(name), "%s all executed", mode.name);
+		runTest(StringView(name, len), [&] {
+			static constexpr size_t Count = 10'000;
+			sprt::atomic<size_t> executed = 0;
+			sprt::atomic<size_t> completed = 0;
+			for (size_t i = 0; i < Count; ++i) {
+				queue->perform(Rc<Task>::create([&](const Task &) {
+					++executed;
+					return true;
+				}, [&](const Task &, bool success) {
+					if (success) {
+						++completed;
+					}
+				}));
+			}
+			return SPRT_TEST_CHECK(waitForCounter(queue, completed, Count))
+					&& SPRT_TEST_CHECK(executed.load() == Count);
+		});
+
+		len = __sprt_snprintf(name, sizeof(name), "%s priorities", mode.name);
+		runTest(StringView(name, len), [&] {
+			static constexpr size_t Count = 3'000;
+			const int32_t priorities[] = {-1, 0, 1};
+			sprt::atomic<size_t> executed = 0;
+			sprt::atomic<size_t> completed = 0;
+			for (size_t i = 0; i < Count; ++i) {
+				auto task = Rc<Task>::create([&](const Task &) {
+					++executed;
+					return true;
+				}, [&](const Task &, bool) { ++completed; });
+				task->setPriority(priorities[i % 3]);
+				queue->perform(move(task));
+			}
+			return SPRT_TEST_CHECK(waitForCounter(queue, completed, Count))
+					&& SPRT_TEST_CHECK(executed.load() == Count);
+		});
+
+		len = __sprt_snprintf(name, sizeof(name), "%s recursive", mode.name);
+		runTest(StringView(name, len), [&] {
+			static constexpr uint32_t Depth = 12;
+			TaskTree tree{queue};
+			tree.spawn(Depth);
+			return SPRT_TEST_CHECK(waitForCounter(queue, tree.executed, TaskTree::getCount(Depth)));
+		});
+
+		// workers are parked between the rounds, every round should wake them up
+		len = __sprt_snprintf(name, sizeof(name), "%s idle bursts", mode.name);
+		runTest(StringView(name, len), [&] {
+			static constexpr size_t Rounds = 200;
+			sprt::atomic<size_t> executed = 0;
+			size_t expected = 0;
+			for (size_t i = 0; i < Rounds; ++i) {
+				auto burst = 1 + i % 4;
+				for (size_t j = 0; j < burst; ++j) {
+					queue->perform([&] { ++executed; });
+				}
+				expected += burst;
+				if (!SPRT_TEST_CHECK(waitForCounter(queue, executed, expected, 1'000))) {
+					return false;
+				}
+				if (i % 16 == 0) {
+					queue->wait(TimeInterval::milliseconds(2));
+				}
+			}
+			return true;
+		});
+
+		queue->cancel();
+		return true;
+	}
+
+	virtual bool run() override {
+		const auto threads = uint32_t(thread::hardware_concurrency());
+		for (auto &mode : s_poolModes) { runMode(mode, threads); }
+		return _failed == 0;
+	}
+} _ThreadPoolTest;
+
+struct ThreadPoolBench : Test {
+	ThreadPoolBench() : Test("thread pool", true) { }
+
+	void runMode(const PoolMode &mode, uint32_t threads) {
+		char name[128];
+		auto queue = makeQueue(mode, threads);
+
+		// tasks, performed from outside of the pool
+		static constexpr size_t FanoutCount = 100'000;
+		sprt::atomic<size_t> executed = 0;
+		auto t = platform::nanoclock(platform::ClockType::Monotonic);
+		for (size_t i = 0; i < FanoutCount; ++i) {
+			queue->perform([&] { ++executed; });
+		}
+		waitForCounter(queue, executed, FanoutCount, 60'000);
+		t = platform::nanoclock(platform::ClockType::Monotonic) - t;
+
+		auto len = __sprt_snprintf(name, sizeof(name), "%s fanout 100k", mode.name);
+		reportBench(StringView(name, len), FanoutCount, 0, t);
+
+		// fork-join tree, performed from the workers
+		static constexpr uint32_t Depth = 16;
+		TaskTree tree{queue};
+		t = platform::nanoclock(platform::ClockType::Monotonic);
+		tree.spawn(Depth);
+		waitForCounter(queue, tree.executed, TaskTree::getCount(Depth), 60'000);
+		t = platform::nanoclock(platform::ClockType::Monotonic) - t;
+
+		len = __sprt_snprintf(name, sizeof(name), "%s fork-join %zu", mode.name,
+				TaskTree::getCount(Depth));
+		reportBench(StringView(name, len), TaskTree::getCount(Depth), 0, t);
+
+		// single task round trip to the parked worker
+		len = __sprt_snprintf(name, sizeof(name), "%s ping", mode.name);
+		runBench(StringView(name, len), isFull() ? 10'000 : 2'000, 0, [&] {
+			sprt::atomic<bool> flag = false;
+			queue->perform([&] { flag.store(true); });
+			while (!flag.load()) { }
+			queue->update();
+		});
+
+		queue->cancel();
+	}
+
+	virtual bool run() override {
+		const auto threads = uint32_t(thread::hardware_concurrency());
+		for (auto &mode : s_poolModes) { runMode(mode, threads); }
+		return true;
+	}
+} _ThreadPoolBench;
+
+} // namespace sprt::test
@@ -0,0 +1,671 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/unicode.h>
+#include <sprt/runtime/utils/dso.h>
+
+namespace sprt::test {
+
+struct Utf8Case {
+	StringView input;
+	bool valid;
+};
+
+static const Utf8Case s_utf8Cases[] = {
+	{"", true},
+	{"ascii", true},
+	{"\xC2\x80", true}, // U+0080
+	{"\xD0\x9F\xD1\x80\xD0\xB8", true},
+	{"\xE2\x82\xAC", true}, // U+20AC
+	{"\xED\x9F\xBF", true}, // U+D7FF
+	{"\xEE\x80\x80", true}, // U+E000
+	{"\xEF\xBF\xBF", true}, // U+FFFF
+	{"\xF0\x9F\x98\x80", true}, // U+1F600
+	{"\xF4\x8F\xBF\xBF", true}, // U+10FFFF
+	{"\x80", false}, // continuation without lead
+	{"\xBF", false},
+	{"\xC0\x80", false}, // overlong U+0000
+	{"\xC1\xBF", false}, // overlong U+007F
+	{"\xE0\x80\x80", false},
+	{"\xE0\x9F\xBF", false}, // overlong U+07FF
+	{"\xF0\x80\x80\x80", false},
+	{"\xF0\x8F\xBF\xBF", false}, // overlong U+FFFF
+	{"\xED\xA0\x80", false}, // U+D800
+	{"\xED\xBF\xBF", false}, // U+DFFF
+	{"\xF4\x90\x80\x80", false}, // U+110000
+	{"\xF5\x80\x80\x80", false},
+	{"\xF8\x88\x80\x80\x80", false}, // 5-byte form
+	{"\xFE", false},
+	{"\xFF", false},
+	{"\xC2", false}, // truncated
+	{"\xE2\x82", false},
+	{"\xF0\x9F\x98", false},
+	{"\xC2\x41", false}, // missing continuation
+	{"\xE2\x28\xA1", false},
+	{"\xF0\x9F\x98\x80\x80", false}, // extra continuation
+};
+
+// Independent strict validator (RFC 3629), stops at NUL as isValidUtf8
+static bool isValidUtf8Reference(const uint8_t *ptr, size_t len) {
+	const auto end = ptr + len;
+	while (ptr < end && *ptr != 0) {
+		const uint8_t c = *ptr;
+		uint32_t n = 0;
+		char32_t ch = 0;
+		char32_t min = 0;
+		if (c < 0x80) {
+			++ptr;
+			continue;
+		} else if ((c & 0xE0) == 0xC0) {
+			n = 1;
+			ch = c & 0x1F;
+			min = 0x80;
+		} else if ((c & 0xF0) == 0xE0) {
+			n = 2;
+			ch = c & 0x0F;
+			min = 0x800;
+		} else if ((c & 0xF8) == 0xF0) {
+			n = 3;
+			ch = c & 0x07;
+			min = 0x1'0000;
+		} else {
+			return false;
+		}
+		if (size_t(end - ptr) <= n) {
+			return false;
+		}
+		for (uint32_t i = 1; i <= n; ++i) {
+			if ((ptr[i] & 0xC0) != 0x80) {
+				return false;
+			}
+			ch = (ch << 6) | (ptr[i] & 0x3F);
+		}
+		if (ch < min || ch > 0x10'FFFF || (ch >= 0xD800 && ch <= 0xDFFF)) {
+			return false;
+		}
+		ptr += n + 1;
+	}
+	return true;
+}
+
+// Scalar loops, that defines results for the malformed input
+static size_t getUtf32LengthReference(StringView str) {
+	size_t ret = 0;
+	auto ptr = str.data();
+	auto end = ptr + str.size();
+	while (ptr < end && *ptr != 0) {
+		++ret;
+		ptr += unicode::utf8_length_data[uint8_t(*ptr)];
+	}
+	return ret;
+}
+
+static size_t getUtf16LengthReference(StringView str) {
+	size_t ret = 0;
+	auto ptr = str.data();
+	auto end = ptr + str.size();
+	while (ptr < end && *ptr != 0) {
+		ret += unicode::utf16_length_data[uint8_t(*ptr)];
+		ptr += unicode::utf8_length_data[uint8_t(*ptr)];
+	}
+	return ret;
+}
+
+static size_t toUtf32Reference(char32_t *buf, StringView str) {
+	size_t ret = 0;
+	uint8_t offset = 0;
+	auto ptr = str.data();
+	auto end = ptr + str.size();
+	while (ptr < end) {
+		buf[ret++] = unicode::utf8Decode32(ptr, end - ptr, offset);
+		ptr += offset;
+	}
+	return ret;
+}
+
+static size_t toUtf16Reference(char16_t *buf, StringView str) {
+	size_t ret = 0;
+	uint8_t offset = 0;
+	auto ptr = str.data();
+	auto end = ptr + str.size();
+	while (ptr < end) {
+		ret += unicode::utf16EncodeBuf(buf + ret, 2, unicode::utf8Decode32(ptr, end - ptr, offset));
+		ptr += offset;
+	}
+	return ret;
+}
+
+// Random non-zero scalar value; `mode` 0 - ASCII only, 1 - mixed, 2 - mostly non-ASCII
+static char32_t getRandomChar(Random &rnd, uint32_t mode) {
+	auto v = rnd.next();
+	auto kind = (mode == 0) ? 0 : ((mode == 1) ? (v % 8) : (3 + v % 5));
+	v >>= 8;
+	switch (kind) {
+	case 0:
+	case 1:
+	case 2:
+	case 3: return char32_t(0x20 + v % 0x5F);
+	case 4: return char32_t(0x80 + v % 0x780);
+	case 5: {
+		auto c = char32_t(0x800 + v % 0xF800);
+		return (c >= 0xD800 && c <= 0xDFFF) ? c + 0x800 : c;
+	}
+	case 6: return char32_t(0x1'0000 + v % 0x10'0000);
+	default: break;
+	}
+	return char32_t(1 + v % 0x1F);
+}
+
+struct CaseMapCase {
+	StringView input;
+	StringView lower;
+	StringView upper;
+	StringView title;
+};
+
+// Full mappings from SpecialCasing.txt, Final_Sigma context and title case word boundaries
+static const CaseMapCase s_caseMapCases[] = {
+	{"", "", "", ""},
+	{"Hello wORLD 42", "hello world 42", "HELLO WORLD 42", "Hello World 42"},
+	{"straße", "straße", "STRASSE", "Straße"},
+	{"ß", "ß", "SS", "Ss"},
+	{"ẞ", "ß", "ẞ", "ẞ"},
+	{"ﬁne", "ﬁne", "FINE", "Fine"},
+	{"ŉ", "ŉ", "ʼN", "ʼN"},
+	{"ǆemal", "ǆemal", "ǄEMAL", "ǅemal"},
+	{"İstanbul", "i\u0307stanbul", "İSTANBUL", "İstanbul"},
+	{"ıi", "ıi", "II", "Ii"},
+	{"ΟΔΟΣ", "οδος", "ΟΔΟΣ", "Οδος"},
+	{"ΟΔΟΣ ΣΑ", "οδος σα", "ΟΔΟΣ ΣΑ", "Οδος Σα"},
+	{"Σ", "σ", "Σ", "Σ"},
+	{"ΑΣ.", "ας.", "ΑΣ.", "Ας."},
+	{"ΑΣ'Α", "ασ'α", "ΑΣ'Α", "Ασ'α"},
+	{"ΐ", "ΐ", "\u0399\u0308\u0301", "\u0399\u0308\u0301"},
+	{"ᾳ", "ᾳ", "ΑΙ", "ᾼ"},
+	{"Привет Мир", "привет мир", "ПРИВЕТ МИР", "Привет Мир"},
+	{"𐐨𐐀", "𐐨𐐨", "𐐀𐐀", "𐐀𐐨"},
+	{"가나 一", "가나 一", "가나 一", "가나 一"},
+};
+
+struct CharCase {
+	char32_t c;
+	char32_t lower;
+	char32_t upper;
+	char32_t title;
+};
+
+// Simple mappings from UnicodeData.txt
+static const CharCase s_charCases[] = {
+	{U'A', U'a', U'A', U'A'},
+	{U'z', U'z', U'Z', U'Z'},
+	{U'ß', U'ß', U'ß', U'ß'},
+	{U'ẞ', U'ß', U'ẞ', U'ẞ'},
+	{U'İ', U'i', U'İ', U'İ'},
+	{U'ı', U'ı', U'I', U'I'},
+	{U'ς', U'ς', U'Σ', U'Σ'},
+	{U'Σ', U'σ', U'Σ', U'Σ'},
+	{U'ǅ', U'ǆ', U'Ǆ', U'ǅ'},
+	{U'ǆ', U'ǆ', U'Ǆ', U'ǅ'},
+	{U'ﬁ', U'ﬁ', U'ﬁ', U'ﬁ'},
+	{U'µ', U'µ', U'Μ', U'Μ'},
+	{U'ÿ', U'ÿ', U'Ÿ', U'Ÿ'},
+	{U'𐐀', U'𐐨', U'𐐀', U'𐐀'},
+	{U'가', U'가', U'가', U'가'},
+	{0x1'0570, 0x1'0597, 0x1'0570, 0x1'0570}, // Vithkuqi, added in Unicode 14.0
+};
+
+struct CaseCompareCase {
+	StringView l;
+	StringView r;
+	int result;
+};
+
+// caseCompare(l, r), swapped arguments should give the opposite result
+static const CaseCompareCase s_caseCompareCases[] = {
+	{"", "", 0},
+	{"hello", "HELLO", 0},
+	{"straße", "STRASSE", 0},
+	{"STRAẞE", "strasse", 0},
+	{"ΟΔΟΣ", "οδοσ", 0},
+	{"ΟΔΟΣ", "οδος", 0},
+	{"İ", "i\u0307", 0},
+	{"ﬁ", "FI", 0},
+	{"µ", "μ", 0},
+	{"ǅ", "Ǆ", 0},
+	{"𐐀", "𐐨", 0},
+	{"\U00010570", "\U00010597", 0},
+	{"a", "B", -1},
+	{"", "a", -1},
+	{"abc", "ABCD", -1},
+	{"resume", "Résumé", -1},
+	{"ı", "i", 1},
+};
+
+// Sorted by caseCompare: secondary differences (accents) are weaker than primary ones,
+// Hangul syllables are ordered by jamo, implicit weights order Tangut, core Han,
+// extension Han and unassigned code points
+static const StringView s_collationOrder[] = {
+	"cote",
+	"Coté",
+	"côte",
+	"CÔTÉ",
+	"cotes",
+	"z",
+	"ω",
+	"я",
+	"가",
+	"각",
+	"갛",
+	"개",
+	"나",
+	"힣",
+	"𗀀",
+	"一",
+	"丁",
+	"龥",
+	"㐀",
+	"𠀀",
+	"\U000E0080",
+};
+
+// Checks UTF-8 and UTF-16 variants of the string case mapping function
+template <typename Fn>
+static bool checkCaseMapping(const Fn &fn, StringView input, StringView expected) {
+	char16_t input16[64];
+	char16_t expected16[64];
+	size_t inputLen = 0;
+	size_t expectedLen = 0;
+	unicode::toUtf16(input16, 64, input, &inputLen);
+	unicode::toUtf16(expected16, 64, expected, &expectedLen);
+
+	bool success = false;
+	bool success16 = false;
+	fn([&](StringView result) { success = (result == expected); }, input);
+	fn([&](WideStringView result) {
+		success16 = (result == WideStringView(expected16, expectedLen));
+	}, WideStringView(input16, inputLen));
+	return success && success16;
+}
+
+static bool checkCaseCompare(StringView l, StringView r, int expected) {
+	char16_t l16[64];
+	char16_t r16[64];
+	size_t lLen = 0;
+	size_t rLen = 0;
+	unicode::toUtf16(l16, 64, l, &lLen);
+	unicode::toUtf16(r16, 64, r, &rLen);
+
+	int result = 2;
+	int result16 = 2;
+	int reverse = 2;
+	return unicode::caseCompare(l, r, &result) && result == expected
+			&& unicode::caseCompare(WideStringView(l16, lLen), WideStringView(r16, rLen), &result16)
+			&& result16 == expected && unicode::caseCompare(r, l, &reverse) && reverse == -expected;
+}
+
+struct UnicodeTest : Test {
+	static constexpr size_t MaxChars = 600;
+
+	UnicodeTest() : Test("unicode") { }
+
+	virtual bool run() override {
+		// every case is placed at all offsets within the 64-byte blocks, after ASCII and
+		// after two-byte characters
+		runTest("validate", [&] {
+			bool success = true;
+			char buf[512];
+			for (auto &it : s_utf8Cases) {
+				success &= SPRT_TEST_CHECK(unicode::isValidUtf8(it.input) == it.valid);
+				for (size_t prefix = 0; prefix < 140; ++prefix) {
+					for (uint32_t multibyte = 0; multibyte < 2; ++multibyte) {
+						size_t len = 0;
+						while (len < prefix) {
+							if (multibyte && len + 2 <= prefix) {
+								buf[len++] = char(0xD0);
+								buf[len++] = char(0x9F);
+							} else {
+								buf[len++] = 'a';
+							}
+						}
+						__sprt_memcpy(buf + len, it.input.data(), it.input.size());
+						len += it.input.size();
+
+						success &= SPRT_TEST_CHECK(
+								unicode::isValidUtf8(StringView(buf, len)) == it.valid);
+
+						for (size_t i = 0; i < 70; ++i) { buf[len++] = 'z'; }
+						success &= SPRT_TEST_CHECK(
+								unicode::isValidUtf8(StringView(buf, len)) == it.valid);
+					}
+				}
+			}
+
+			// validation stops at NUL
+			success &= SPRT_TEST_CHECK(unicode::isValidUtf8(StringView("ab\0\xFF", 4)));
+			return success;
+		});
+
+		// valid text with random corrupted bytes against the reference validator
+		runTest("validate random", [&] {
+			bool success = true;
+			char buf[MaxChars * 4];
+			Random rnd;
+			uint32_t count = isFull() ? 10'000'000 : 100'000;
+			for (uint32_t round = 0; round < count && success; ++round) {
+				auto chars = rnd.next() % (MaxChars / 2);
+				size_t len = 0;
+				for (size_t i = 0; i < chars; ++i) {
+					len += unicode::utf8EncodeBuf(buf + len, 4, getRandomChar(rnd, round % 3));
+				}
+
+				auto errors = (round % 4 == 0) ? 0 : rnd.next() % 3;
+				for (size_t i = 0; i < errors && len > 0; ++i) {
+					buf[rnd.next() % len] = char(rnd.next() % 256);
+				}
+
+				success &= SPRT_TEST_CHECK(unicode::isValidUtf8(StringView(buf, len))
+						== isValidUtf8Reference((const uint8_t *)buf, len));
+			}
+			return success;
+		});
+
+		runTest("transcode", [&] {
+			bool success = true;
+			char32_t chars[MaxChars];
+			char utf8[MaxChars * 4];
+			char16_t utf16[MaxChars * 2];
+
+			char32_t out32[MaxChars];
+			char16_t out16[MaxChars * 2];
+			char out8[MaxChars * 4];
+
+			Random rnd;
+			uint32_t count = isFull() ? 1'000'000 : 20'000;
+			for (uint32_t round = 0; round < count && success; ++round) {
+				size_t len = rnd.next() % MaxChars;
+				size_t len8 = 0;
+				size_t len16 = 0;
+				for (size_t i = 0; i < len; ++i) {
+					chars[i] = getRandomChar(rnd, round % 3);
+					len8 += unicode::utf8EncodeBuf(utf8 + len8, 4, chars[i]);
+					len16 += unicode::utf16EncodeBuf(utf16 + len16, 2, chars[i]);
+				}
+
+				auto str8 = StringView(utf8, len8);
+				auto str16 = WideStringView(utf16, len16);
+				auto str32 = StringViewBase<char32_t>(chars, len);
+
+				success &= SPRT_TEST_CHECK(unicode::isValidUtf8(str8));
+				success &= SPRT_TEST_CHECK(unicode::getUtf32Length(str8) == len);
+				success &= SPRT_TEST_CHECK(unicode::getUtf32Length(str16) == len);
+				success &= SPRT_TEST_CHECK(unicode::getUtf16Length(str8) == len16);
+				success &= SPRT_TEST_CHECK(unicode::getUtf16Length(str32) == len16);
+				success &= SPRT_TEST_CHECK(unicode::getUtf8Length(str16) == len8);
+				success &= SPRT_TEST_CHECK(unicode::getUtf8Length(str32) == len8);
+
+				size_t ret = 0;
+				success &= SPRT_TEST_CHECK(
+						unicode::toUtf32(out32, len, str8, &ret) == Status::Ok && ret == len
+						&& __sprt_memcmp(out32, chars, len * sizeof(char32_t)) == 0);
+				success &= SPRT_TEST_CHECK(
+						unicode::toUtf32(out32, len, str16, &ret) == Status::Ok && ret == len
+						&& __sprt_memcmp(out32, chars, len * sizeof(char32_t)) == 0);
+				success &= SPRT_TEST_CHECK(
+						unicode::toUtf16(out16, len16, str8, &ret) == Status::Ok && ret == len16
+						&& __sprt_memcmp(out16, utf16, len16 * sizeof(char16_t)) == 0);
+				success &= SPRT_TEST_CHECK(
+						unicode::toUtf16(out16, len16, str32, &ret) == Status::Ok && ret == len16
+						&& __sprt_memcmp(out16, utf16, len16 * sizeof(char16_t)) == 0);
+				success &= SPRT_TEST_CHECK(
+						unicode::toUtf8(out8, len8, str16, &ret) == Status::Ok && ret == len8
+						&& __sprt_memcmp(out8, utf8, len8) == 0);
+				success &= SPRT_TEST_CHECK(
+						unicode::toUtf8(out8, len8, str32, &ret) == Status::Ok && ret == len8
+						&& __sprt_memcmp(out8, utf8, len8) == 0);
+
+				if (len > 0) {
+					success &= SPRT_TEST_CHECK(unicode::toUtf32(out32, len - 1, str8, &ret)
+							== Status::ErrorBufferOverflow);
+					success &= SPRT_TEST_CHECK(unicode::toUtf16(out16, len16 - 1, str8, &ret)
+							== Status::ErrorBufferOverflow);
+					success &= SPRT_TEST_CHECK(unicode::toUtf8(out8, len8 - 1, str16, &ret)
+							== Status::ErrorBufferOverflow);
+				}
+			}
+			return success;
+		});
+
+		// block fast paths should produce the same results for malformed input as scalar loops
+		runTest("malformed", [&] {
+			bool success = true;
+			char utf8[MaxChars * 4];
+			char32_t out32[MaxChars * 4];
+			char32_t ref32[MaxChars * 4];
+			char16_t out16[MaxChars * 8];
+			char16_t ref16[MaxChars * 8];
+
+			Random rnd;
+			uint32_t count = isFull() ? 1'000'000 : 20'000;
+			for (uint32_t round = 0; round < count && success; ++round) {
+				size_t chars = rnd.next() % MaxChars;
+				size_t len = 0;
+				for (size_t i = 0; i < chars; ++i) {
+					len += unicode::utf8EncodeBuf(utf8 + len, 4, getRandomChar(rnd, 1 + round % 2));
+				}
+
+				// NUL is excluded: transcoding does not stop on it
+				auto errors = 1 + rnd.next() % 4;
+				for (size_t i = 0; i < errors && len > 0; ++i) {
+					utf8[rnd.next() % len] = char(1 + rnd.next() % 255);
+				}
+
+				auto str = StringView(utf8, len);
+				success &= SPRT_TEST_CHECK(
+						unicode::getUtf32Length(str) == getUtf32LengthReference(str));
+				success &= SPRT_TEST_CHECK(
+						unicode::getUtf16Length(str) == getUtf16LengthReference(str));
+
+				size_t ret = 0;
+				auto len32 = toUtf32Reference(ref32, str);
+				auto st = unicode::toUtf32(out32, MaxChars * 4, str, &ret);
+				success &= SPRT_TEST_CHECK(st == Status::Ok && ret == len32
+						&& __sprt_memcmp(out32, ref32, len32 * sizeof(char32_t)) == 0);
+
+				auto len16 = toUtf16Reference(ref16, str);
+				st = unicode::toUtf16(out16, MaxChars * 8, str, &ret);
+				success &= SPRT_TEST_CHECK(st == Status::Ok && ret == len16
+						&& __sprt_memcmp(out16, ref16, len16 * sizeof(char16_t)) == 0);
+			}
+			return success;
+		});
+
+		runTest("case mapping", [&] {
+			bool success = true;
+			for (auto &it : s_caseMapCases) {
+				success &= SPRT_TEST_CHECK(checkCaseMapping(
+						[](auto &&cb, auto str) { return unicode::tolower(cb, str); }, it.input,
+						it.lower));
+				success &= SPRT_TEST_CHECK(checkCaseMapping(
+						[](auto &&cb, auto str) { return unicode::toupper(cb, str); }, it.input,
+						it.upper));
+				success &= SPRT_TEST_CHECK(checkCaseMapping(
+						[](auto &&cb, auto str) { return unicode::totitle(cb, str); }, it.input,
+						it.title));
+			}
+			for (auto &it : s_charCases) {
+				success &= SPRT_TEST_CHECK(unicode::tolower(it.c) == it.lower);
+				success &= SPRT_TEST_CHECK(unicode::toupper(it.c) == it.upper);
+				success &= SPRT_TEST_CHECK(unicode::totitle(it.c) == it.title);
+			}
+			return success;
+		});
+
+		runTest("case compare", [&] {
+			bool success = true;
+			for (auto &it : s_caseCompareCases) {
+				success &= SPRT_TEST_CHECK(checkCaseCompare(it.l, it.r, it.result));
+			}
+			for (size_t i = 1; i < sizeof(s_collationOrder) / sizeof(StringView); ++i) {
+				success &= SPRT_TEST_CHECK(
+						checkCaseCompare(s_collationOrder[i - 1], s_collationOrder[i], -1));
+			}
+			return success;
+		});
+
+		return _failed == 0;
+	}
+} _UnicodeTest;
+
+// String case mapping via ICU, as platform implementation did before the built-in tables:
+// UTF-8 is converted into UTF-16, mapped with u_strToLower (with size preflight) and converted
+// back. ICU is loaded in runtime, benchmark is skipped without it.
+struct IcuCaseMapping {
+	using CaseFn = int32_t (*)(char16_t *, int32_t, const char16_t *, int32_t, const char *, int *);
+
+	static constexpr int IcuBufferOverflowError = 15;
+
+	Dso handle;
+	CaseFn strToLower = nullptr;
+
+	IcuCaseMapping() : handle("libicuuc.so") {
+		if (!handle) {
+			return;
+		}
+
+		// Distributions build ICU with versioned symbols, like u_strToLower_72
+		strToLower = handle.sym<CaseFn>("u_strToLower");
+		char name[64];
+		for (uint32_t version = 99; !strToLower && version >= 50; --version) {
+			auto len = __sprt_snprintf(name, sizeof(name), "u_strToLower_%u", version);
+			strToLower = handle.sym<CaseFn>(StringView(name, len));
+		}
+	}
+
+	explicit operator bool() const { return strToLower != nullptr; }
+
+	bool tolower(const callback<void(StringView)> &cb, StringView data, char16_t *buf,
+			size_t bufSize) {
+		bool ret = false;
+		unicode::toUtf16([&](WideStringView str) {
+			int status = 0;
+			auto len = strToLower(nullptr, 0, str.data(), int32_t(str.size()), "", &status);
+			if ((status != 0 && status != IcuBufferOverflowError) || size_t(len) > bufSize) {
+				return;
+			}
+
+			status = 0;
+			len = strToLower(buf, int32_t(bufSize), str.data(), int32_t(str.size()), "", &status);
+			if (status == 0) {
+				unicode::toUtf8([&](StringView out) {
+					cb(out);
+					ret = true;
+				}, WideStringView(buf, len));
+			}
+		}, data);
+		return ret;
+	}
+};
+
+struct UnicodeBench : Test {
+	static constexpr size_t TextSize = 1'024 * 1'024;
+
+	UnicodeBench() : Test("unicode", true) { }
+
+	virtual bool run() override {
+		auto utf8 = new char[TextSize + 4];
+		auto out8 = new char[TextSize + 4];
+		auto utf16 = new char16_t[TextSize];
+		auto utf32 = new char32_t[TextSize];
+		auto lower16 = new char16_t[TextSize * 3];
+
+		IcuCaseMapping icu;
+		if (!icu) {
+			__sprt_printf("  [skip] ICU tolower: libicuuc is not available\n");
+		}
+
+		const char *names[] = {"ascii", "mixed", "non-ascii"};
+		char name[64];
+		for (uint32_t mode = 0; mode < 3; ++mode) {
+			Random rnd;
+			size_t len = 0;
+			while (len < TextSize) {
+				len += unicode::utf8EncodeBuf(utf8 + len, 4, getRandomChar(rnd, mode));
+			}
+
+			auto str = StringView(utf8, len);
+			size_t len16 = unicode::getUtf16Length(str);
+			size_t ret = 0;
+			unicode::toUtf16(utf16, TextSize, str, &ret);
+			auto str16 = WideStringView(utf16, len16);
+
+			auto n = __sprt_snprintf(name, sizeof(name), "isValidUtf8 %s", names[mode]);
+			runBench(StringView(name, n), 200, len,
+					[&] { doNotOptimize(unicode::isValidUtf8(str)); });
+
+			n = __sprt_snprintf(name, sizeof(name), "getUtf16Length %s", names[mode]);
+			runBench(StringView(name, n), 200, len,
+					[&] { doNotOptimize(unicode::getUtf16Length(str)); });
+
+			n = __sprt_snprintf(name, sizeof(name), "utf8 to utf16 %s", names[mode]);
+			runBench(StringView(name, n), 200, len, [&] {
+				unicode::toUtf16(utf16, TextSize, str, &ret);
+				doNotOptimize(ret);
+			});
+
+			n = __sprt_snprintf(name, sizeof(name), "utf8 to utf32 %s", names[mode]);
+			runBench(StringView(name, n), 200, len, [&] {
+				unicode::toUtf32(utf32, TextSize, str, &ret);
+				doNotOptimize(ret);
+			});
+
+			n = __sprt_snprintf(name, sizeof(name), "utf16 to utf8 %s", names[mode]);
+			runBench(StringView(name, n), 200, len, [&] {
+				unicode::toUtf8(out8, TextSize + 4, str16, &ret);
+				doNotOptimize(ret);
+			});
+
+			n = __sprt_snprintf(name, sizeof(name), "tolower %s", names[mode]);
+			runBench(StringView(name, n), 50, len, [&] {
+				unicode::tolower([&](StringView result) { doNotOptimize(result.size()); }, str);
+			});
+
+			if (icu) {
+				n = __sprt_snprintf(name, sizeof(name), "ICU tolower %s", names[mode]);
+				runBench(StringView(name, n), 50, len, [&] {
+					icu.tolower([&](StringView result) { doNotOptimize(result.size()); }, str,
+							lower16, TextSize * 3);
+				});
+			}
+		}
+
+		delete[] lower16;
+		delete[] utf32;
+		delete[] utf16;
+		delete[] out8;
+		delete[] utf8;
+		return true;
+	}
+} _UnicodeBench;
+
+} // namespace sprt::test
@@ -0,0 +1,224 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+#include "SPRuntimeTest.h"
+
+#include <sprt/runtime/hash.h>
+
+namespace sprt::test {
+
+struct Xxh3Vector {
+	size_t len;
+	uint64_t seed;
+	uint64_t hash64;
+	xxh3::Hash128 hash128;
+};
+
+// Reference values from xxHash 0.8 for the first `len` bytes of `getInput`
+// clang-format off
+static constexpr Xxh3Vector s_xxh3Vectors[] = {
+	{0, 0, 0x2D06'8005'38D3'94C2, {0x6001'C324'468D'497F, 0x99AA'06D3'0147'98D8}},
+	{0, 0x9E37'79B9'7F4A'7C15, 0x602B'0E2C'D666'2C8B, {0x4CA5'1769'9817'1787, 0xD142'977A'2CCA'554B}},
+	{1, 0, 0x4C5C'CA45'D0F4'811F, {0x4C5C'CA45'D0F4'811F, 0x495B'6207'3EF7'0CA4}},
+	{1, 0x9E37'79B9'7F4A'7C15, 0x2F3A'CD38'05F8'1DE3, {0x2F3A'CD38'05F8'1DE3, 0x00A7'11EB'5A73'6B26}},
+	{2, 0, 0x29C6'0963'CBFA'4E6E, {0x29C6'0963'CBFA'4E6E, 0xF1B5'EEC9'02A1'EB5E}},
+	{2, 0x9E37'79B9'7F4A'7C15, 0x28A7'B77C'08C0'91EB, {0x28A7'B77C'08C0'91EB, 0x729F'8AAE'8729'063C}},
+	{3, 0, 0x6E3E'2670'E611'06AC, {0x6E3E'2670'E611'06AC, 0x390C'DC5B'4A89'5DD7}},
+	{3, 0x9E37'79B9'7F4A'7C15, 0xBC74'611D'87F6'59E0, {0xBC74'611D'87F6'59E0, 0x3F5F'D00F'F400'BA58}},
+	{4, 0, 0x5C4C'6313'3443'D03F, {0x3D66'8AF6'F2A4'4D77, 0xAA6E'2F27'4640'A3F4}},
+	{4, 0x9E37'79B9'7F4A'7C15, 0x6C37'5317'7C60'7DE4, {0xC63A'F37D'A30D'5D08, 0x7E5D'191B'D8D3'54E6}},
+	{7, 0, 0x46A5'C724'D51F'E43F, {0x1B17'4AD8'D9A8'1F6B, 0x9C62'F060'5940'4F49}},
+	{7, 0x9E37'79B9'7F4A'7C15, 0x3E79'41A4'5217'9655, {0xF735'DFC4'4777'9D16, 0xA335'3043'B32B'1DC5}},
+	{8, 0, 0xF9FD'4DD0'B04D'78F5, {0x61DD'BE7F'31A6'100D, 0x6A86'A3BD'A6AF'4E3D}},
+	{8, 0x9E37'79B9'7F4A'7C15, 0xBC72'D053'1396'303F, {0x8A88'691D'5CEC'B7B6, 0x9B51'BCD7'0BE0'38F6}},
+	{9, 0, 0x7C20'DF97'12C2'6EDF, {0x8C7B'67FD'458A'936B, 0x664C'7CA1'8AFD'6255}},
+	{9, 0x9E37'79B9'7F4A'7C15, 0x93C5'AA00'6102'DAF5, {0xA1E6'91E7'3AAF'9CA5, 0xC0DD'1F12'F479'931B}},
+	{15, 0, 0xB345'A7B2'698B'A575, {0xD273'8C0B'AD6C'BF9A, 0x6EF1'8F28'EDD0'2B19}},
+	{15, 0x9E37'79B9'7F4A'7C15, 0x0829'33F8'51BA'6E46, {0xB3D5'C583'A947'71DE, 0x9AB3'45E6'BCAC'3ACB}},
+	{16, 0, 0x86AB'F6BA'CCEA'0858, {0xE2CE'54A7'C19C'730D, 0x7F9A'218B'0425'449A}},
+	{16, 0x9E37'79B9'7F4A'7C15, 0x69D0'01B1'6ECF'450A, {0x1097'F793'402C'818A, 0xD5F6'FDBF'62CD'C681}},
+	{17, 0, 0xB58B'F5DC'5022'D071, {0x8D96'EF11'0FCD'EBB4, 0x66FC'23F6'439D'BD77}},
+	{17, 0x9E37'79B9'7F4A'7C15, 0xB7C9'9D19'BE27'EB69, {0x5533'06F0'D043'114C, 0xFDB9'3EA9'BD7C'5A87}},
+	{31, 0, 0x4844'2FCD'5518'B086, {0xCEE4'2516'3875'B69B, 0xD820'1BC2'FEDE'FE5C}},
+	{31, 0x9E37'79B9'7F4A'7C15, 0x4D0C'A634'AB4C'A4F4, {0x71F5'9912'8523'EC7C, 0xB5C7'1D9D'392B'E41C}},
+	{32, 0, 0xE371'2ED8'4C04'A66E, {0xFD35'7CF6'CB2D'DA18, 0x49A1'1EE7'43D6'D342}},
+	{32, 0x9E37'79B9'7F4A'7C15, 0xE5FB'38C8'1D49'C6F5, {0x8113'6762'52DB'E0C7, 0x7314'32CB'CC02'2E37}},
+	{64, 0, 0x1291'D2D4'0423'30DD, {0xBA7E'015A'54F1'4BE1, 0xE0FA'F20E'0E0F'E0DD}},
+	{64, 0x9E37'79B9'7F4A'7C15, 0x543F'A55D'8DB0'3991, {0x60CE'1B9D'00AC'1042, 0x6C80'0FCD'18B4'6B32}},
+	{96, 0, 0x8129'6929'FC06'3365, {0x8B87'20F5'65DC'F40C, 0xFB78'AC18'5EF5'5443}},
+	{96, 0x9E37'79B9'7F4A'7C15, 0x260F'2886'3562'3EE8, {0x79CD'945D'7592'8CA3, 0x4B06'B5D3'40F2'CB02}},
+	{127, 0, 0xED4C'F621'0402'0DB5, {0x4762'E44C'3271'8EA5, 0x52DA'B583'67EF'2D2D}},
+	{127, 0x9E37'79B9'7F4A'7C15, 0x1255'7EB9'B4C6'D9C6, {0xAAEC'1249'D95B'7E26, 0x662C'7376'A748'6957}},
+	{128, 0, 0x10D1'7F72'C0CC'BA41, {0xFF36'1DEC'1385'710A, 0xAEC7'3075'1478'556C}},
+	{128, 0x9E37'79B9'7F4A'7C15, 0x49B8'1C6E'0ABB'9305, {0x1852'8564'1270'01A4, 0x98B7'168A'2696'9C36}},
+	{129, 0, 0x1648'BDC3'DB49'D1A2, {0x4545'B3A0'9738'E31A, 0x98CD'36CC'BB55'7926}},
+	{129, 0x9E37'79B9'7F4A'7C15, 0x5E38'31B2'2181'0B00, {0x54E9'357C'883C'EC48, 0x0315'9DBF'8591'C495}},
+	{200, 0, 0xC0FB'C0F4'E181'C826, {0xA477'3493'FBBE'3543, 0x26D2'8D07'8607'28F6}},
+	{200, 0x9E37'79B9'7F4A'7C15, 0x8326'4818'FB53'1769, {0xBA85'2C1A'37AD'8096, 0xFAC3'060D'AE98'2A81}},
+	{239, 0, 0xF0D1'5481'9ADB'16CD, {0xD032'9D9F'9566'468D, 0x6E78'1781'33D2'C10B}},
+	{239, 0x9E37'79B9'7F4A'7C15, 0x23AD'00DE'A6ED'6611, {0xB9B9'D0E4'B361'2C30, 0x9735'FF51'B080'79C5}},
+	{240, 0, 0xB6CF'AF34'3FAB'81E6, {0x3F2C'53E7'2293'711F, 0x5293'E17B'F553'903D}},
+	{240, 0x9E37'79B9'7F4A'7C15, 0x76A7'3EC2'6433'F82C, {0xFCAC'5437'05C8'C541, 0xDE30'C63E'E85A'3579}},
+	{241, 0, 0x956C'AE59'2C67'279E, {0x956C'AE59'2C67'279E, 0xB538'40FE'3FED'F161}},
+	{241, 0x9E37'79B9'7F4A'7C15, 0x2BE2'36BA'3BAC'F75C, {0x2BE2'36BA'3BAC'F75C, 0x7BE6'397A'1DFD'48CC}},
+	{255, 0, 0x64A6'0730'25EB'7929, {0x64A6'0730'25EB'7929, 0x08C3'B91C'3870'117B}},
+	{255, 0x9E37'79B9'7F4A'7C15, 0x4075'22CE'8DDF'4B58, {0x4075'22CE'8DDF'4B58, 0xA164'8AEE'50EA'C98B}},
+	{256, 0, 0xB15E'5507'33C5'DFAC, {0xB15E'5507'33C5'DFAC, 0xD0D2'829A'226D'0EDB}},
+	{256, 0x9E37'79B9'7F4A'7C15, 0x9299'9D62'F081'5EEF, {0x9299'9D62'F081'5EEF, 0x32F1'0ACE'7868'8C34}},
+	{1023, 0, 0xA94F'FCD2'2543'68E4, {0xA94F'FCD2'2543'68E4, 0x0990'DE11'F2B1'3621}},
+	{1023, 0x9E37'79B9'7F4A'7C15, 0x4DE0'0B8B'A99F'E3EA, {0x4DE0'0B8B'A99F'E3EA, 0x94B1'FE35'114B'E972}},
+	{1024, 0, 0x70BD'377D'9574'F4BB, {0x70BD'377D'9574'F4BB, 0xF696'3061'3F24'324D}},
+	{1024, 0x9E37'79B9'7F4A'7C15, 0xD8CF'6B46'4541'F232, {0xD8CF'6B46'4541'F232, 0xA888'BFDF'0888'3F70}},
+	{1025, 0, 0x66C4'487C'41E1'27A7, {0x66C4'487C'41E1'27A7, 0x621A'F7B8'277E'FFA4}},
+	{1025, 0x9E37'79B9'7F4A'7C15, 0x8DC3'A55E'9C26'D886, {0x8DC3'A55E'9C26'D886, 0xFAFF'F564'F328'2DC7}},
+	{2047, 0, 0xDED1'F434'A151'0C6A, {0xDED1'F434'A151'0C6A, 0xD115'3095'5C33'95AC}},
+	{2047, 0x9E37'79B9'7F4A'7C15, 0x30D2'806C'6F0F'F0D5, {0x30D2'806C'6F0F'F0D5, 0x837E'A510'097C'E411}},
+	{2048, 0, 0x8B46'CAA6'7DAB'3A30, {0x8B46'CAA6'7DAB'3A30, 0x56B7'7F20'7158'A2BA}},
+	{2048, 0x9E37'79B9'7F4A'7C15, 0x9F2F'0261'A259'2B60, {0x9F2F'0261'A259'2B60, 0xA6EE'C338'9BCB'8B72}},
+	{4096, 0, 0x9DDD'66C1'4AF0'DAFF, {0x9DDD'66C1'4AF0'DAFF, 0x3E0F'F38F'A88A'55EA}},
+	{4096, 0x9E37'79B9'7F4A'7C15, 0xC7BC'989F'5D54'7A4D, {0xC7BC'989F'5D54'7A4D, 0x51CF'B433'B55F'B224}},
+};
+// clang-format on
+
+static constexpr size_t InputSize = 4'096;
+
+static constexpr uint8_t getInput(size_t i) { return uint8_t(i * 131 + 7); }
+
+// Constant evaluation uses the scalar implementation, it should match the runtime one
+static constexpr uint64_t getConstantHash(size_t len, uint64_t seed) {
+	char buf[512] = {0};
+	for (size_t i = 0; i < len; ++i) { buf[i] = char(getInput(i)); }
+	return xxh3::chash64(buf, len, seed);
+}
+
+static_assert(getConstantHash(0, 0) == 0x2D06'8005'38D3'94C2);
+static_assert(getConstantHash(3, 0x9E37'79B9'7F4A'7C15) == 0xBC74'611D'87F6'59E0);
+static_assert(getConstantHash(16, 0) == 0x86AB'F6BA'CCEA'0858);
+static_assert(getConstantHash(129, 0x9E37'79B9'7F4A'7C15) == 0x5E38'31B2'2181'0B00);
+static_assert(getConstantHash(256, 0) == 0xB15E'5507'33C5'DFAC);
+static_assert(getConstantHash(512, 0x9E37'79B9'7F4A'7C15) == 0x3638'5C68'AA67'55EA);
+
+struct Xxh3Test : Test {
+	Xxh3Test() : Test("xxh3") { }
+
+	virtual bool run() override {
+		uint8_t input[InputSize];
+		for (size_t i = 0; i < InputSize; ++i) { input[i] = getInput(i); }
+
+		runTest("vectors", [&] {
+			bool success = true;
+			for (auto &it : s_xxh3Vectors) {
+				auto h128 = xxh3::hash128(input, it.len, it.seed);
+				success &= SPRT_TEST_CHECK(xxh3::hash64(input, it.len, it.seed) == it.hash64);
+				success &= SPRT_TEST_CHECK(
+						h128.low == it.hash128.low && h128.high == it.hash128.high);
+				success &= SPRT_TEST_CHECK(
+						xxh3::chash64((const char *)input, it.len, it.seed) == it.hash64);
+			}
+			return success;
+		});
+
+		// chunk sizes cross the internal buffer and block boundaries
+		runTest("streaming", [&] {
+			bool success = true;
+			Random rnd;
+			for (auto &it : s_xxh3Vectors) {
+				for (uint32_t round = 0; round < 8; ++round) {
+					xxh3::Ctx ctx;
+					xxh3::init(ctx, it.seed);
+					size_t offset = 0;
+					while (offset < it.len) {
+						auto chunk = sprt::min(size_t(rnd.next() % (round < 4 ? 64 : 600)),
+								it.len - offset);
+						xxh3::update(ctx, input + offset, chunk);
+						offset += chunk;
+					}
+					auto h128 = xxh3::digest128(ctx);
+					success &= SPRT_TEST_CHECK(xxh3::digest64(ctx) == it.hash64);
+					success &= SPRT_TEST_CHECK(
+							h128.low == it.hash128.low && h128.high == it.hash128.high);
+				}
+			}
+			return success;
+		});
+
+		runTest("hashSize", [&] {
+			constexpr auto value = hashSize("hashSize", 8, 42);
+
+			// prevent constant evaluation
+			volatile char buf[] = "hashSize";
+			char str[8];
+			for (size_t i = 0; i < 8; ++i) { str[i] = buf[i]; }
+			return SPRT_TEST_CHECK(hashSize(str, 8, 42) == value);
+		});
+
+		return _failed == 0;
+	}
+} _Xxh3Test;
+
+struct Xxh3Bench : Test {
+	static constexpr size_t BufferSize = 1 << 20;
+
+	Xxh3Bench() : Test("xxh3", true) { }
+
+	virtual bool run() override {
+		auto buf = new uint8_t[BufferSize];
+		Random rnd;
+		for (size_t i = 0; i < BufferSize; i += 8) {
+			auto v = rnd.next();
+			__builtin_memcpy(buf + i, &v, 8);
+		}
+
+		// from the shortest inputs with the dedicated paths up to the long input loop
+		const size_t sizes[] = {4, 8, 16, 64, 200, 1'024, 16 * 1'024, BufferSize};
+		char name[64];
+		for (auto size : sizes) {
+			auto count = sprt::max(size_t(16), 256 * 1'024 * 1'024 / size / 16);
+			uint64_t sum = 0;
+
+			auto len = __sprt_snprintf(name, sizeof(name), "xxh3 64 %zu", size);
+			runBench(StringView(name, len), count, size, [&] {
+				doNotOptimize(buf);
+				sum += xxh3::hash64(buf, size);
+			});
+
+			len = __sprt_snprintf(name, sizeof(name), "xxh3 128 %zu", size);
+			runBench(StringView(name, len), count, size, [&] {
+				doNotOptimize(buf);
+				sum += xxh3::hash128(buf, size).low;
+			});
+
+			len = __sprt_snprintf(name, sizeof(name), "xxh64 %zu", size);
+			runBench(StringView(name, len), count, size, [&] {
+				doNotOptimize(buf);
+				sum += hash64((const char *)buf, size);
+			});
+
+			doNotOptimize(sum);
+		}
+
+		delete[] buf;
+		return true;
+	}
+} _Xxh3Bench;
+
+} // namespace sprt::test
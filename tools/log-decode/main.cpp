@@ -0,0 +1,139 @@
+/**
+Copyright (c) 2026 Xenolith Team <admin@xenolith.studio>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+**/
+
+
+#include <sprt/runtime/log.h>
+#include <sprt/runtime/stringview.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+using namespace sprt;
+
+/*
+	sprt-log-decode [file...]
+
+	Renders binary log files (written with oslog::enableBinary) as text to stdout,
+	reads stdin, if no files are specified or file is `-`
+*/
+
+static const char *getLogTypeName(oslog::LogType type) {
+	switch (type) {
+	case oslog::LogType::Verbose: return "V";
+	case oslog::LogType::Debug: return "D";
+	case oslog::LogType::Info: return "I";
+	case oslog::LogType::Warn: return "W";
+	case oslog::LogType::Error: return "E";
+	case oslog::LogType::Fatal: return "F";
+	}
+	return "?";
+}
+
+// Reads whole descriptor into the malloc'ed buffer, returns false on read error
+static bool readAll(int fd, uint8_t *&data, size_t &size) {
+	size_t capacity = 64 * 1'024;
+	data = (uint8_t *)::malloc(capacity);
+	size = 0;
+
+	while (data) {
+		if (size == capacity) {
+			capacity *= 2;
+			auto tmp = (uint8_t *)::realloc(data, capacity);
+			if (!tmp) {
+				break;
+			}
+			data = tmp;
+		}
+
+		auto ret = ::read(fd, data + size, capacity - size);
+		if (ret == 0) {
+			return true;
+		} else if (ret < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		size += size_t(ret);
+	}
+
+	::free(data);
+	data = nullptr;
+	size = 0;
+	return false;
+}
+
+static bool decodeFile(const char *path) {
+	auto isStdin = (StringView(path) == "-");
+	auto fd = isStdin ? STDIN_FILENO : ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		::fprintf(stderr, "%s: fail to open file\n", path);
+		return false;
+	}
+
+	uint8_t *data = nullptr;
+	size_t size = 0;
+	auto success = readAll(fd, data, size);
+	if (!isStdin) {
+		::close(fd);
+	}
+
+	if (!success) {
+		::fprintf(stderr, "%s: fail to read file\n", path);
+		return false;
+	}
+
+	auto status = oslog::decodeBinary(BytesView(data, size), [&](const oslog::LogRecord &r) {
+		::printf("%llu.%06llu [%s] %.*s: %.*s", (unsigned long long)(r.time / 1'000'000),
+				(unsigned long long)(r.time % 1'000'000), getLogTypeName(r.type),
+				int(r.tag.size()), r.tag.data(), int(r.text.size()), r.text.data());
+		if (!r.file.empty()) {
+			::printf(" (%.*s:%u)", int(r.file.size()), r.file.data(), r.line);
+		}
+		::printf("\n");
+	});
+
+	::free(data);
+
+	if (status != Status::Ok) {
+		::fprintf(stderr, "%s: malformed binary log\n", path);
+		return false;
+	}
+	return true;
+}
+
+int main(int argc, const char *argv[]) {
+	if (argc < 2) {
+		return decodeFile("-") ? 0 : 1;
+	}
+
+	bool success = true;
+	for (int i = 1; i < argc; ++i) {
+		if (!decodeFile(argv[i])) {
+			success = false;
+		}
+	}
+	return success ? 0 : 1;
+}